@@ -69,6 +69,8 @@ CCANMonitorApp::CCANMonitorApp()
     m_pouFlags = nullptr;
     m_bIsMRU_CreatedInOpen = FALSE;
     m_bFromAutomation = FALSE;
+    m_bVirtualTime = FALSE;
+    m_unVirtualTimeSettleMs = defCLOCK_VIRTUAL_SETTLE_MS;
     GetCurrentDirectory(MAX_PATH, m_acApplicationDirectory);
     m_bIsConfigFileLoaded = false;
 }
@@ -171,6 +173,19 @@ BOOL CCANMonitorApp::InitInstance()
         shRegServer = (short) strcmpi(__targv[1],"/regserver");
         shUnRegServer = (short) strcmpi(__targv[1],"/unregserver");
     }
+    for (int nArg = 1; nArg < __argc; nArg++)
+    {
+        const char* pchVirtualTime = "/virtualtime";
+        size_t nLength = strlen(pchVirtualTime);
+        if (strnicmp(__targv[nArg], pchVirtualTime, nLength) == 0)
+        {
+            m_bVirtualTime = TRUE;
+            if (__targv[nArg][nLength] == ':')
+            {
+                m_unVirtualTimeSettleMs = (UINT) atoi(__targv[nArg] + nLength + 1);
+            }
+        }
+    }
 
     // Don't display a new MDI child window during startup
     if (cmdInfo.m_nShellCommand == CCommandLineInfo::FileNew
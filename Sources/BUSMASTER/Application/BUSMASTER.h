@@ -69,6 +69,9 @@ public:
 
     CFlags* pouGetFlagsPtr();
     BOOL m_bFromAutomation;
+    /** Set by /virtualtime[:<settle ms>], runs the simulated CAN bus in virtual time */
+    BOOL m_bVirtualTime;
+    UINT m_unVirtualTimeSettleMs;
 
     virtual BOOL InitInstance();
     virtual void WinHelp(DWORD dwData, UINT nCmd = HELP_CONTEXT);
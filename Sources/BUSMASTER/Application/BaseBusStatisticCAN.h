@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 enum eLOAD
 {
     CURRENT = 0,
@@ -31,6 +34,121 @@ enum eLOAD
     PEAK
 };
 
+/**
+* Sliding windows of the rate calculation
+*/
+enum eRATE_WINDOW
+{
+    WINDOW_1S = 0,
+    WINDOW_10S,
+    WINDOW_60S
+};
+
+/**
+* Rates of a channel over one sliding window
+*/
+struct sBUSRATES
+{
+    /** length of the window actually covered, shorter right after connect */
+    double m_dWindowSec;
+
+    /** total message rate */
+    double m_dMsgRate;
+
+    /** transmit message rate */
+    double m_dTxMsgRate;
+
+    /** receive message rate */
+    double m_dRxMsgRate;
+
+    /** error rate */
+    double m_dErrorRate;
+
+    /** average bus load in the window */
+    double m_dBusLoad;
+
+    /** peak of the one second bus loads in the window */
+    double m_dPeakBusLoad;
+};
+typedef sBUSRATES SBUSRATES;
+
+/**
+* Message count and rates of one identifier
+*/
+struct sMSGIDRATE
+{
+    /** 11/29 bit identifier */
+    unsigned int m_unMsgID;
+
+    /** true, for (29 Bit) Frame */
+    bool m_bExtended;
+
+    /** messages since the last reset */
+    unsigned int m_unMsgCount;
+
+    /** message rate over the last second */
+    double m_dRate1s;
+
+    /** message rate over the last ten seconds */
+    double m_dRate10s;
+};
+typedef sMSGIDRATE SMSGIDRATE;
+
+/**
+* Timing profile of one identifier on one channel, times in milli seconds
+*/
+struct sMSGIDPROFILE
+{
+    /** channel index */
+    unsigned int m_unChannelIndex;
+
+    /** 11/29 bit identifier */
+    unsigned int m_unMsgID;
+
+    /** true, for (29 Bit) Frame */
+    bool m_bExtended;
+
+    /** messages since the last reset */
+    unsigned int m_unMsgCount;
+
+    /** time stamp of the last message */
+    double m_dLastTime;
+
+    /** shortest, average and longest time between two messages */
+    double m_dMinCycle;
+    double m_dAvgCycle;
+    double m_dMaxCycle;
+
+    /** standard deviation of the time between two messages */
+    double m_dJitter;
+
+    /** largest deviation of one cycle from the average cycle */
+    double m_dMaxDeviation;
+
+    /** cycles longer than one and a half average cycles */
+    unsigned int m_unLateCount;
+
+    /** last data length and number of data length changes */
+    unsigned int m_unLastDLC;
+    unsigned int m_unDLCChanges;
+
+    /** number of messages with data different from the previous one */
+    unsigned int m_unDataChanges;
+
+    /** data changes per second */
+    double m_dDataChangeRate;
+};
+typedef sMSGIDPROFILE SMSGIDPROFILE;
+
+/**
+* File formats of the identifier profile export
+*/
+enum eBS_EXPORT_FORMAT
+{
+    BS_EXPORT_CSV = 0,
+    BS_EXPORT_JSON
+};
+
 struct sSUBBUSSTATISTICS
 {
     /** error transmit count */
@@ -262,4 +380,19 @@ public:
     virtual UCHAR BSC_ucGetControllerStatus(UINT unChannelIndex) = 0;
     //Get the required channel's BusStistic structure.
     virtual HRESULT BSC_GetBusStatistics(UINT unChannelIndex, SBUSSTATISTICS& sBusStatistics) = 0;
+    //Setting the CAN FD data phase BaudRate, 0 if bit rate switching is not used
+    virtual HRESULT BSC_SetDataBaudRate(UINT unChannelIndex, double dDataBaudRate) = 0;
+    //Get the message, error and bus load rates over a sliding window
+    virtual HRESULT BSC_GetWindowedRates(UINT unChannelIndex, eRATE_WINDOW eWindow, SBUSRATES& sRates) = 0;
+    //Get the count and rates of every identifier seen on the channel
+    virtual HRESULT BSC_GetMsgIdRates(UINT unChannelIndex, std::vector<SMSGIDRATE>& ouIdRates) = 0;
+    //Get the number of messages of identifiers the profile had no room for
+    virtual HRESULT BSC_GetUntrackedMsgCount(UINT unChannelIndex, UINT& unMsgCount) = 0;
+    //Size the identifier profile for the expected number of (channel, identifier) pairs,
+    //applied with the next reset
+    virtual HRESULT BSC_SetMsgIdProfileSize(UINT unExpectedIds) = 0;
+    //Get the timing profile of every identifier seen on any channel
+    virtual HRESULT BSC_GetMsgIdProfile(std::vector<SMSGIDPROFILE>& ouProfiles) = 0;
+    //Write the identifier profile to a file
+    virtual HRESULT BSC_ExportMsgIdProfile(const std::string& strFileName, eBS_EXPORT_FORMAT eFormat) = 0;
 };
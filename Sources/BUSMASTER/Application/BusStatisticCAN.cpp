@@ -129,34 +129,22 @@ CBusStatisticCAN::CBusStatisticCAN(void)
     InitializeCriticalSection(&m_omCritSecBS);
     m_ouReadThread.m_hActionEvent = m_ouCanBufFSE.hGetNotifyingEvent();
     m_nTimerHandle = 0;
-    //Initialise Number of Bits in Standard CAN and FD Messages
-    UINT unBitsStdMsg[] = {51, 60, 70, 79, 89, 99, 108, 118, 127};
-    UINT unBitsStdFDMsgCRC15[] = {54, 64, 73, 83, 93, 102, 112, 121, 131};
-    UINT unBitsStdFDMsgCRC17[] = {172, 210};     // 12, 16
-    UINT unBitsStdFDMsgCRC21[] = {253, 292, 369, 522, 676}; // 20, 24, 32, 48, 64
-
-    memcpy(m_unBitsStdMsg, unBitsStdMsg, 9*sizeof(UINT));
-    memcpy(&m_unBitsFDMsgCRC15[0], unBitsStdFDMsgCRC15, 9*sizeof(UINT));
-    memcpy(&m_unBitsFDMsgCRC17[0], unBitsStdFDMsgCRC17, 2*sizeof(UINT));
-    memcpy(&m_unBitsFDMsgCRC21[0], unBitsStdFDMsgCRC21, 5*sizeof(UINT));
-
-    //Initialise Number of Bits in Extended CAN and FD Messages
-    UINT unBitsExtMsg[] = {75, 84, 94, 103, 113, 123, 132, 142, 151};
-    UINT unBitsExtFDMsgCRC15[] = {77, 87, 96, 106, 115, 125, 135, 144, 154};
-    UINT unBitsExtFDMsgCRC17[] = {195, 233};    // 12, 16
-    UINT unBitsExtFDMsgCRC21[] = {276, 315, 391, 545, 699}; // 20, 24, 32, 48, 64
-
-    memcpy(m_unBitsExdMsg, unBitsExtMsg, 9*sizeof(UINT));
-    memcpy(&m_unBitsFDMsgCRC15[1], unBitsExtFDMsgCRC15, 9*sizeof(UINT));
-    memcpy(&m_unBitsFDMsgCRC17[1], unBitsExtFDMsgCRC17, 2*sizeof(UINT));
-    memcpy(&m_unBitsFDMsgCRC21[1], unBitsExtFDMsgCRC21, 5*sizeof(UINT));
-
-    m_nFactorSTDFrame = 0;
-    m_nFactorEXTDFrame = 0;
-    m_nFactorSTDRTRFrame = 0;
-    m_nFactorEXTDRTRFrame = 0;
-    m_nFactorErrorFrame = 0;
-    m_dDiffTime = 0;
+    m_pouDIL_CAN = nullptr;
+
+    m_psShards = static_cast<sCOUNTERSHARD*>(_aligned_malloc(sizeof(sCOUNTERSHARD) * defBS_COUNTER_SHARDS, 64));
+    memset(m_psShards, 0, sizeof(sCOUNTERSHARD) * defBS_COUNTER_SHARDS);
+    m_dwShardTlsIndex = TlsAlloc();
+    m_lShardsAssigned = 0;
+    for (int nChannelIndex = 0; nChannelIndex < defNO_OF_CHANNELS; nChannelIndex++)
+    {
+        m_adDataBaudRate[ nChannelIndex ] = 0;
+        m_abBitRateSwitch[ nChannelIndex ] = false;
+    }
+    m_ouHistory.resize(defNO_OF_CHANNELS * defBS_RATE_HISTORY);
+    QueryPerformanceFrequency(&m_sQPFrequency);
+
+    vInitialiseFrameBits();
+    vInitialiseBSData();
 }
 
 /**
@@ -173,6 +161,64 @@ CBusStatisticCAN::~CBusStatisticCAN(void)
     {
         KillTimer(nullptr, m_nTimerHandle);
     }
+    TlsFree(m_dwShardTlsIndex);
+    _aligned_free(m_psShards);
+}
+
+/**
+ * Fills the frame length tables for every data length, frame format and
+ * bit rate switch combination. Lengths between the CAN FD data length
+ * codes take the length of the next code as the frame is padded.
+ */
+void CBusStatisticCAN::vInitialiseFrameBits(void)
+{
+    //Number of Bits in Standard and Extended CAN and FD Messages
+    UINT aunBitsClassic[2][9] =
+    {
+        {51, 60, 70, 79, 89, 99, 108, 118, 127},
+        {75, 84, 94, 103, 113, 123, 132, 142, 151}
+    };
+    UINT aunBitsFDCRC15[2][9] =
+    {
+        {54, 64, 73, 83, 93, 102, 112, 121, 131},
+        {77, 87, 96, 106, 115, 125, 135, 144, 154}
+    };
+    UINT aunFDLength[] = {12, 16, 20, 24, 32, 48, 64};
+    UINT aunBitsFDLong[2][7] =
+    {
+        {172, 210, 253, 292, 369, 522, 676},    // CRC17: 12, 16 CRC21: 20, 24, 32, 48, 64
+        {195, 233, 276, 315, 391, 545, 699}
+    };
+    UINT aunArbitrationBits[2] = {defBITS_FD_ARB_PHASE_STD, defBITS_FD_ARB_PHASE_EXTD};
+
+    for (int nExtended = 0; nExtended < 2; nExtended++)
+    {
+        for (int nLength = 0; nLength <= defBS_MAX_DATA_LEN; nLength++)
+        {
+            UINT unFDBits = aunBitsFDLong[nExtended][6];
+            if (nLength <= 8)
+            {
+                unFDBits = aunBitsFDCRC15[nExtended][nLength];
+            }
+            else
+            {
+                for (int nCode = 0; nCode < 7; nCode++)
+                {
+                    if ((UINT)nLength <= aunFDLength[nCode])
+                    {
+                        unFDBits = aunBitsFDLong[nExtended][nCode];
+                        break;
+                    }
+                }
+            }
+            m_aunNominalBits[nExtended][0][nLength] = aunBitsClassic[nExtended][min(nLength, 8)];
+            m_aunDataBits[nExtended][0][nLength] = 0;
+            m_aunNominalBits[nExtended][1][nLength] = unFDBits;
+            m_aunDataBits[nExtended][1][nLength] = 0;
+            m_aunNominalBits[nExtended][2][nLength] = aunArbitrationBits[nExtended];
+            m_aunDataBits[nExtended][2][nLength] = unFDBits - aunArbitrationBits[nExtended];
+        }
+    }
 }
 
 /**
@@ -768,6 +814,25 @@ HRESULT CBusStatisticCAN::BSC_SetBaudRate(UINT unChannelIndex, double dBaudRate)
 
     ASSERT(unChannelIndex < defNO_OF_CHANNELS);
     m_sBusStatistics[unChannelIndex].m_dBaudRate = dBaudRate;
+    m_abBitRateSwitch[unChannelIndex] = (m_adDataBaudRate[unChannelIndex] > 0 && m_adDataBaudRate[unChannelIndex] != dBaudRate);
+    LeaveCriticalSection(&m_omCritSecBS);
+    return 0L;
+}
+
+/**
+ * \param[in] unChannelIndex channel index
+ * \param[in] dDataBaudRate CAN FD data phase baud rate, 0 if not used
+ *
+ * Sets the data phase baud rate. CAN FD frames of a channel whose data
+ * rate differs from the nominal rate are counted as bit rate switched.
+ */
+HRESULT CBusStatisticCAN::BSC_SetDataBaudRate(UINT unChannelIndex, double dDataBaudRate)
+{
+    EnterCriticalSection(&m_omCritSecBS);
+
+    ASSERT(unChannelIndex < defNO_OF_CHANNELS);
+    m_adDataBaudRate[unChannelIndex] = dDataBaudRate;
+    m_abBitRateSwitch[unChannelIndex] = (dDataBaudRate > 0 && dDataBaudRate != m_sBusStatistics[unChannelIndex].m_dBaudRate);
     LeaveCriticalSection(&m_omCritSecBS);
     return 0L;
 }
@@ -791,7 +856,9 @@ UCHAR CBusStatisticCAN::BSC_ucGetControllerStatus(UINT unChannelIndex)
  */
 HRESULT CBusStatisticCAN::BSC_GetBusStatistics(UINT unChannelIndex, SBUSSTATISTICS& sBusStatistics)
 {
+    EnterCriticalSection(&m_omCritSecBS);
     sBusStatistics = m_sBusStatistics[unChannelIndex];
+    LeaveCriticalSection(&m_omCritSecBS);
     return S_OK;
 }
 
@@ -818,13 +885,16 @@ BOOL CBusStatisticCAN::bStartBSReadThread(void)
     return TRUE;
 }
 
+
 /**
  * \req RS_24_08 Standard frames are considered.
  * \req RS_24_09 Extended frames are considered.
  * \req RS_24_10 RTR frames are considered.
  * \req RS_24_11 Error frames occurs under the purview of status data
+ * \req RS_24_15 Measurement period always begins (or resets) from the time of connection
  *
- * Initialises the m_sbusstatistics structor
+ * Initialises the m_sbusstatistics structor. The running counters are not
+ * cleared, the current values become the new baseline.
  */
 void CBusStatisticCAN::vInitialiseBSData(void)
 {
@@ -834,51 +904,33 @@ void CBusStatisticCAN::vInitialiseBSData(void)
     {
         // Reset whole statucture
         memset( &m_sBusStatistics[ nChannelIndex ] , 0, sizeof(SBUSSTATISTICS) );
-        memset( &m_sPrevStatData[ nChannelIndex ] , 0, sizeof(SBUSSTATISTICS) );
         // Set Baud rate Manually
         m_sBusStatistics[ nChannelIndex ].m_dBaudRate = _tstof(defBAUDRATE);
+        m_abBitRateSwitch[ nChannelIndex ] = (m_adDataBaudRate[ nChannelIndex ] > 0 &&
+                                              m_adDataBaudRate[ nChannelIndex ] != m_sBusStatistics[ nChannelIndex ].m_dBaudRate);
 
-        memset( &m_sSubBusStatistics[nChannelIndex], 0, sizeof(SSUBBUSSTATISTICS) );
+        vReadCounters(nChannelIndex, m_aunBaseline[ nChannelIndex ]);
     }
-
-
-    memset( &m_unPrevStandardCount, 0, sizeof( m_unPrevStandardCount ) );
-    memset( &m_unPrevExtendedCount, 0, sizeof( m_unPrevExtendedCount ) );
-    memset( &m_unPrevStandardRTRCount, 0, sizeof( m_unPrevStandardRTRCount ) );
-    memset( &m_unPrevExtendedRTRCount, 0, sizeof( m_unPrevExtendedRTRCount ) );
-    memset( &m_unPrevErrorTotalCount, 0, sizeof( m_unPrevErrorTotalCount ) );
-
-
-
-    m_nFactorSTDFrame     = defBITS_STD_FRAME + defBITS_INTER_FRAME;
-    m_nFactorEXTDFrame    = defBITS_EXTD_FRAME + defBITS_INTER_FRAME;
-    m_nFactorSTDRTRFrame  = m_nFactorSTDFrame;
-    m_nFactorEXTDRTRFrame = m_nFactorEXTDFrame;
-    m_nFactorErrorFrame   = defBITS_ERROR_FRAME + defBITS_INTER_FRAME;
-    m_dDiffTime           = defTIME_INTERVAL;
-    m_unPreviousTime = -1;
+    m_unSampleCount = 0;
+    m_ouMsgIdProfiler.vReset();
     LeaveCriticalSection(&m_omCritSecBS);
 }
 
 /**
- * Calculates the differential time in sec
+ * \return Counter shard of the calling thread
+ *
+ * Threads are assigned a shard on their first frame. With more writer
+ * threads than shards a shard is shared, the updates stay atomic.
  */
-void CBusStatisticCAN::vCalculateDiffTime(void)
+CBusStatisticCAN::sCOUNTERSHARD& CBusStatisticCAN::ouGetShard(void)
 {
-
-    // check if the previous time value is not stored. take 1.0s as initial
-    // value for calculation.
-    if(m_unPreviousTime != -1 )
-    {
-        m_dDiffTime         = CTimeManager::nCalculateCurrTimeStamp(FALSE) -
-                              m_unPreviousTime;
-        m_unPreviousTime += static_cast<UINT>(m_dDiffTime);
-        m_dDiffTime         = m_dDiffTime / defDIV_FACT_FOR_SECOND;
-    }
-    else
+    LONG_PTR nShard = (LONG_PTR)TlsGetValue(m_dwShardTlsIndex);
+    if (0 == nShard)
     {
-        m_unPreviousTime = CTimeManager::nCalculateCurrTimeStamp(FALSE);
+        nShard = ((InterlockedIncrement(&m_lShardsAssigned) - 1) % defBS_COUNTER_SHARDS) + 1;
+        TlsSetValue(m_dwShardTlsIndex, (LPVOID)nShard);
     }
+    return m_psShards[nShard - 1];
 }
 
 /**
@@ -887,236 +939,148 @@ void CBusStatisticCAN::vCalculateDiffTime(void)
  * \req RS_24_10 RTR frames are considered.
  * \req RS_24_11 Error frames occurs under the purview of status data
  *
- * Calculate the Bus statistics in m_sBusStatistics structure
+ * Updates the counters of the calling thread's shard, no lock is taken.
  */
 void CBusStatisticCAN::vUpdateBusStatistics(STCANDATA& sCanData)
 {
-    EnterCriticalSection(&m_omCritSecBS);
-
-    // CANFD Frame
-    m_sCurrEntry = sCanData.m_uDataInfo.m_sCANMsg;
-
-    int nCurrentChannelIndex = sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel - 1;
-    INT nDLC = sCanData.m_uDataInfo.m_sCANMsg.m_ucDataLen;
+    const STCAN_MSG& sMsg = sCanData.m_uDataInfo.m_sCANMsg;
 
+    int nCurrentChannelIndex = sMsg.m_ucChannel - 1;
     if ((nCurrentChannelIndex < 0) || (nCurrentChannelIndex > (defNO_OF_CHANNELS - 1)))
     {
         nCurrentChannelIndex = 0;   //take appropriate action
     }
-    if(m_sCurrEntry.m_ucRTR == 1)
-        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unDLCCount+=
-            sCanData.m_uDataInfo.m_sCANMsg.m_ucDataLen;
+    volatile LONG* plCounter = ouGetShard().m_alCounter[ nCurrentChannelIndex ];
+
+    if (sMsg.m_ucRTR == 1)
+    {
+        InterlockedExchangeAdd(&plCounter[ BS_DLC ], sMsg.m_ucDataLen);
+    }
 
-    //is it Tx Message
-    if(IS_TX_MESSAGE(sCanData.m_ucDataType))
+    bool bTx = (IS_TX_MESSAGE(sCanData.m_ucDataType)) ? true : false;
+    if (true == bTx || IS_RX_MESSAGE(sCanData.m_ucDataType))
     {
-        if(IS_ERR_MESSAGE(sCanData.m_ucDataType))
+        if (IS_ERR_MESSAGE(sCanData.m_ucDataType))
         {
-            m_sSubBusStatistics[nCurrentChannelIndex].m_unErrorTxCount++;
+            InterlockedIncrement(&plCounter[ BS_TX_ERROR ]);
+            return;
         }
-        else
+        //Rx counters follow the Tx counters in the same order
+        int nBase = (true == bTx) ? BS_TX_STD : BS_RX_STD;
+        int nExtended = (sMsg.m_ucEXTENDED == 0) ? 0 : 1;
+        InterlockedIncrement(&plCounter[ nBase + (BS_TX_TOTAL - BS_TX_STD) ]);
+        if (sMsg.m_ucRTR == 0) // Non RTR message
         {
-            m_sSubBusStatistics[nCurrentChannelIndex].m_unTotalTxMsgCount++;
-            if (m_sCurrEntry.m_ucRTR == 0) // Non RTR message
-            {
-                /* Check for CAN FD messages */
-                if ( !sCanData.m_uDataInfo.m_sCANMsg.m_bCANFD )
-                {
-                    if (m_sCurrEntry.m_ucEXTENDED == 0)
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTxSTDMsgCount++;
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsStdMsg[nDLC];
-                    }
-                    else
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTxEXTDMsgCount++;
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsExdMsg[nDLC];
-                    }
-                }
-                /* Indicates a CAN FD message */
-                else
-                {
-                    int nIndex = (m_sCurrEntry.m_ucEXTENDED == 0) ? 0:1;
-                    if ( m_sCurrEntry.m_ucEXTENDED == 0 )
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTxSTDMsgCount++;
-                    }
-                    else
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTxEXTDMsgCount++;
-                    }
-
-                    if ( nDLC <=8 )
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC15[nIndex][nDLC];
-                    }
-                    else if ( nDLC > 8  && nDLC <= 16 )
-                    {
-                        switch ( nDLC )
-                        {
-                            case 12:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC17[nIndex][0];
-                                break;
-                            case 16:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC17[nIndex][1];
-                                break;
-                        }
-                    }
-                    else if ( nDLC > 16 )
-                    {
-                        switch ( nDLC )
-                        {
-                            case 20:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][0];
-                                break;
-                            case 24:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][1];
-                                break;
-                            case 32:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][2];
-                                break;
-                            case 48:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][3];
-                                break;
-                            case 64:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][4];
-                                break;
-                        }
-                    }
-                }
-            }
-            else // RTR message
-            {
-                if (m_sCurrEntry.m_ucEXTENDED == 0)
-                {
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTxSTD_RTRMsgCount++;
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsStdMsg[0];
-                }
-                else
-                {
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTxEXTD_RTRMsgCount++;
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsExdMsg[0];
-                }
-            }
+            int nFormat = (false == sMsg.m_bCANFD) ? 0 : ((true == m_abBitRateSwitch[ nCurrentChannelIndex ]) ? 2 : 1);
+            int nLength = min((int)sMsg.m_ucDataLen, defBS_MAX_DATA_LEN);
+            InterlockedIncrement(&plCounter[ nBase + (BS_TX_EXTD - BS_TX_STD) * nExtended ]);
+            InterlockedExchangeAdd(&plCounter[ BS_NOMINAL_BITS ], (LONG)m_aunNominalBits[nExtended][nFormat][nLength]);
+            InterlockedExchangeAdd(&plCounter[ BS_DATA_BITS ], (LONG)m_aunDataBits[nExtended][nFormat][nLength]);
         }
-    }
-    //is it Rx Message
-    else if(IS_RX_MESSAGE(sCanData.m_ucDataType))
-    {
-        if(IS_ERR_MESSAGE(sCanData.m_ucDataType))
+        else // RTR message
         {
-            m_sSubBusStatistics[nCurrentChannelIndex].m_unErrorTxCount++;
+            InterlockedIncrement(&plCounter[ nBase + (BS_TX_STD_RTR - BS_TX_STD) + nExtended ]);
+            InterlockedExchangeAdd(&plCounter[ BS_NOMINAL_BITS ], (LONG)m_aunNominalBits[nExtended][0][0]);
         }
-        else
+        if (false == m_ouMsgIdProfiler.bAddFrame(nCurrentChannelIndex, sMsg.m_unMsgID, (1 == nExtended), sMsg.m_ucDataLen,
+                (sMsg.m_ucRTR == 0) ? sMsg.m_ucData : nullptr, sCanData.m_lTickCount.QuadPart))
         {
-            m_sSubBusStatistics[nCurrentChannelIndex].m_unTotalRxMsgCount++;
-            if (m_sCurrEntry.m_ucRTR == 0) // Non RTR message
-            {
-                /* Check for CAN FD messages */
-                if ( !sCanData.m_uDataInfo.m_sCANMsg.m_bCANFD )
-                {
-                    if (m_sCurrEntry.m_ucEXTENDED == 0)
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unRxSTDMsgCount++;
-                        //m_sSubBusStatistics[ nCurrentChannelIndex ].m_unSTDMsgBits = nDLC + floor((double)(nDLC / 5 + TYPE_STD_CONST1));
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsStdMsg[nDLC];
-                    }
-                    else
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unRxEXTDMsgCount++;
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsExdMsg[nDLC];
-                    }
-                }
-                /* Indicates a CAN FD message */
-                else
-                {
-                    int nIndex = (m_sCurrEntry.m_ucEXTENDED == 0) ? 0:1;
-                    if ( m_sCurrEntry.m_ucEXTENDED == 0 )
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unRxSTDMsgCount++;
-                    }
-                    else
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unRxEXTDMsgCount++;
-                    }
-
-                    if ( nDLC <=8 )
-                    {
-                        m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC15[nIndex][nDLC];
-                    }
-                    else if ( nDLC > 8  && nDLC <= 16 )
-                    {
-                        switch ( nDLC )
-                        {
-                            case 12:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC17[nIndex][0];
-                                break;
-                            case 16:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC17[nIndex][1];
-                                break;
-                        }
-                    }
-                    else if ( nDLC > 16 )
-                    {
-                        switch ( nDLC )
-                        {
-                            case 20:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][0];
-                                break;
-                            case 24:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][1];
-                                break;
-                            case 32:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][2];
-                                break;
-                            case 48:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][3];
-                                break;
-                            case 64:
-                                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsFDMsgCRC21[nIndex][4];
-                                break;
-                        }
-                    }
-                }
-            }
-            else // RTR message
-            {
-                if (m_sCurrEntry.m_ucEXTENDED == 0)
-                {
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unRxSTD_RTRMsgCount++;
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsStdMsg[0];
-                }
-                else
-                {
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unRxEXTD_RTRMsgCount++;
-                    m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += m_unBitsExdMsg[0];
-                }
-            }
+            InterlockedIncrement(&plCounter[ BS_ID_UNTRACKED ]);
         }
     }
     else
     {
         //Is it is Error
-        m_sSubBusStatistics[nCurrentChannelIndex].m_unErrorTotalCount++;
+        InterlockedIncrement(&plCounter[ BS_ERROR_TOTAL ]);
         if (sCanData.m_uDataInfo.m_sErrInfo.m_ucErrType == ERROR_BUS)
         {
-            // Update Statistics information
-            m_sSubBusStatistics[ nCurrentChannelIndex ].m_unErrorTotalCount++;
             USHORT usErrorID = sCanData.m_uDataInfo.m_sErrInfo.m_ucReg_ErrCap /*& 0xE0*/;
             // Received message
             if (usErrorID & 0x20)
             {
-                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unErrorRxCount++;
+                InterlockedIncrement(&plCounter[ BS_RX_ERROR ]);
             }
             else
             {
-                m_sSubBusStatistics[ nCurrentChannelIndex ].m_unErrorTxCount++;
+                InterlockedIncrement(&plCounter[ BS_TX_ERROR ]);
             }
-            m_sSubBusStatistics[ nCurrentChannelIndex ].m_unTotalBitsperSec += defBITS_ERR_FRAME;
+            InterlockedExchangeAdd(&plCounter[ BS_NOMINAL_BITS ], defBITS_ERR_FRAME);
         }
     }
+}
 
-    LeaveCriticalSection(&m_omCritSecBS);
+/**
+ * \param[in] nChannelIndex channel index
+ * \param[out] aunCounter sum of the counters of all shards
+ *
+ * Reads the running counters without locking. Counters wrap around, only
+ * differences between two reads are meaningful for the bit counters.
+ */
+void CBusStatisticCAN::vReadCounters(int nChannelIndex, UINT aunCounter[ BS_COUNTER_COUNT ])
+{
+    memset(aunCounter, 0, sizeof(UINT) * BS_COUNTER_COUNT);
+    for (int nShard = 0; nShard < defBS_COUNTER_SHARDS; nShard++)
+    {
+        volatile LONG* plCounter = m_psShards[nShard].m_alCounter[ nChannelIndex ];
+        for (int nCounter = 0; nCounter < BS_COUNTER_COUNT; nCounter++)
+        {
+            aunCounter[nCounter] += (UINT)plCounter[nCounter];
+        }
+    }
+}
+
+/**
+ * \param[in] unSamplesBack 0 for the latest sample
+ * \return index into the history of the sample
+ */
+UINT CBusStatisticCAN::unGetHistoryIndex(UINT unSamplesBack)
+{
+    return (m_unSampleCount - 1 - unSamplesBack) % defBS_RATE_HISTORY;
+}
+
+/**
+ * \param[in] unWindowSec window length in seconds
+ * \return samples back from the latest one spanning the window
+ *
+ * Samples are taken once a second, right after a reset the window is
+ * shortened to the available history.
+ */
+UINT CBusStatisticCAN::unGetWindowSamples(UINT unWindowSec)
+{
+    if (m_unSampleCount < 2)
+    {
+        return 0;
+    }
+    return min(unWindowSec, min(m_unSampleCount, (UINT)defBS_RATE_HISTORY) - 1);
+}
+
+/**
+ * \param[in] nChannelIndex channel index
+ * \param[in] unNominalBits bits sent at the nominal baud rate
+ * \param[in] unDataBits CAN FD data phase bits sent at the data baud rate
+ * \param[in] dSeconds measurement interval
+ * \return bus load in percent
+ */
+double CBusStatisticCAN::dCalculateBusLoad(int nChannelIndex, UINT unNominalBits, UINT unDataBits, double dSeconds)
+{
+    double dBaudRate = m_sBusStatistics[ nChannelIndex ].m_dBaudRate;
+    if (dBaudRate <= 0 || dSeconds <= 0)
+    {
+        return 0;
+    }
+    //Data phase bits in nominal bit times
+    double dBits = unNominalBits;
+    if (unDataBits > 0 && m_adDataBaudRate[ nChannelIndex ] > 0)
+    {
+        dBits += unDataBits * dBaudRate / m_adDataBaudRate[ nChannelIndex ];
+    }
+    double dBusLoad = (dBits / dSeconds / dBaudRate) * defMAX_PERCENTAGE_BUS_LOAD;
+    // if load is greater than or equal to 100% assign it 99.99%
+    if( dBusLoad > defMAX_PERCENTAGE_BUS_LOAD )
+    {
+        dBusLoad = defMAX_PERCENTAGE_BUS_LOAD_ALLOWED;
+    }
+    return dBusLoad;
 }
 
 /**
@@ -1133,12 +1097,19 @@ void CBusStatisticCAN::vUpdateBusStatistics(STCANDATA& sCanData)
  * \req RS_24_21 Controller status data covers present controller Rx Error Counter (peak)
  * \req RS_24_22 Controller status data covers present controller Rx Error Counter (present)
  *
- * Calculates the Bus Statistics using m_sBusStatistics structure
+ * Samples the counters into the history and calculates the Bus Statistics
+ * in m_sBusStatistics structure. Rates are taken over the last second of
+ * history using the measured sample times.
  */
 void CBusStatisticCAN::vCalculateBusParametres(void)
 {
     EnterCriticalSection(&m_omCritSecBS);
-    vCalculateDiffTime();
+    LARGE_INTEGER sNow;
+    QueryPerformanceCounter(&sNow);
+    UINT unIndex = m_unSampleCount % defBS_RATE_HISTORY;
+    m_allHistoryTime[unIndex] = sNow.QuadPart;
+    m_unSampleCount++;
+
     CFlags* pouFlags = nullptr;
     pouFlags = theApp.pouGetFlagsPtr();
     BOOL bIsConnected = FALSE;
@@ -1149,171 +1120,258 @@ void CBusStatisticCAN::vCalculateBusParametres(void)
 
     for(int nChannelIndex =0; nChannelIndex <defNO_OF_CHANNELS; nChannelIndex++)
     {
-        m_sBusStatistics[nChannelIndex] = m_sSubBusStatistics[nChannelIndex];
-        m_sBusStatistics[nChannelIndex].m_nSamples++;
-        m_sBusStatistics[ nChannelIndex ].m_unTotalMsgCount =
-            m_sBusStatistics[ nChannelIndex ].m_unTotalTxMsgCount +
-            m_sBusStatistics[ nChannelIndex ].m_unTotalRxMsgCount;
-        //***** Total Message Rate *****//
-        if(bIsConnected)
+        sCOUNTERSAMPLE& sSample = m_ouHistory[ nChannelIndex * defBS_RATE_HISTORY + unIndex ];
+        vReadCounters(nChannelIndex, sSample.m_aunCounter);
+        sSample.m_dBusLoad = 0;
+
+        const UINT* punCounter = sSample.m_aunCounter;
+        const UINT* punBaseline = m_aunBaseline[ nChannelIndex ];
+        SBUSSTATISTICS& sStatistics = m_sBusStatistics[ nChannelIndex ];
+        sStatistics.m_unTxSTDMsgCount = punCounter[BS_TX_STD] - punBaseline[BS_TX_STD];
+        sStatistics.m_unTxEXTDMsgCount = punCounter[BS_TX_EXTD] - punBaseline[BS_TX_EXTD];
+        sStatistics.m_unTxSTD_RTRMsgCount = punCounter[BS_TX_STD_RTR] - punBaseline[BS_TX_STD_RTR];
+        sStatistics.m_unTxEXTD_RTRMsgCount = punCounter[BS_TX_EXTD_RTR] - punBaseline[BS_TX_EXTD_RTR];
+        sStatistics.m_unTotalTxMsgCount = punCounter[BS_TX_TOTAL] - punBaseline[BS_TX_TOTAL];
+        sStatistics.m_unErrorTxCount = punCounter[BS_TX_ERROR] - punBaseline[BS_TX_ERROR];
+        sStatistics.m_unRxSTDMsgCount = punCounter[BS_RX_STD] - punBaseline[BS_RX_STD];
+        sStatistics.m_unRxEXTDMsgCount = punCounter[BS_RX_EXTD] - punBaseline[BS_RX_EXTD];
+        sStatistics.m_unRxSTD_RTRMsgCount = punCounter[BS_RX_STD_RTR] - punBaseline[BS_RX_STD_RTR];
+        sStatistics.m_unRxEXTD_RTRMsgCount = punCounter[BS_RX_EXTD_RTR] - punBaseline[BS_RX_EXTD_RTR];
+        sStatistics.m_unTotalRxMsgCount = punCounter[BS_RX_TOTAL] - punBaseline[BS_RX_TOTAL];
+        sStatistics.m_unErrorRxCount = punCounter[BS_RX_ERROR] - punBaseline[BS_RX_ERROR];
+        sStatistics.m_unDLCCount = punCounter[BS_DLC] - punBaseline[BS_DLC];
+
+        sStatistics.m_nSamples++;
+        sStatistics.m_unTotalMsgCount = sStatistics.m_unTotalTxMsgCount + sStatistics.m_unTotalRxMsgCount;
+        // Calculate Error Count
+        sStatistics.m_unErrorTotalCount = sStatistics.m_unErrorRxCount + sStatistics.m_unErrorTxCount;
+
+        //Bus Load of the last interval
+        DOUBLE dBusLoad = 0;
+        if (m_unSampleCount > 1)
         {
-            m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond =
-                m_sBusStatistics[ nChannelIndex ].m_unTotalMsgCount -
-                m_sPrevStatData[ nChannelIndex ].m_unTotalMsgCount;
-
-            FLOAT msgPerSec= (m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond /(FLOAT) m_dDiffTime );
-            if( msgPerSec > 0.50 && msgPerSec < 1)
-            {
-                m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond =1;
+            const sCOUNTERSAMPLE& sPrevSample = m_ouHistory[ nChannelIndex * defBS_RATE_HISTORY + unGetHistoryIndex(1) ];
+            double dSeconds = (double)(sNow.QuadPart - m_allHistoryTime[ unGetHistoryIndex(1) ]) / m_sQPFrequency.QuadPart;
+            dBusLoad = dCalculateBusLoad(nChannelIndex,
+                                         punCounter[BS_NOMINAL_BITS] - sPrevSample.m_aunCounter[BS_NOMINAL_BITS],
+                                         punCounter[BS_DATA_BITS] - sPrevSample.m_aunCounter[BS_DATA_BITS], dSeconds);
+        }
+        sSample.m_dBusLoad = dBusLoad;
+        sStatistics.m_unTotalBitsperSec = 0;
 
-            }
-            else
+        //Rates over the last second
+        UINT unSamplesBack = unGetWindowSamples(1);
+        if(bIsConnected && unSamplesBack > 0)
+        {
+            UINT unOldIndex = unGetHistoryIndex(unSamplesBack);
+            const UINT* punOld = m_ouHistory[ nChannelIndex * defBS_RATE_HISTORY + unOldIndex ].m_aunCounter;
+            double dSeconds = (double)(sNow.QuadPart - m_allHistoryTime[ unOldIndex ]) / m_sQPFrequency.QuadPart;
+            if (dSeconds > 0)
             {
-                m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond =
-                    static_cast<UINT>
-                    (m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond / m_dDiffTime );
-
+                double dMsgRate = ((punCounter[BS_TX_TOTAL] - punOld[BS_TX_TOTAL]) +
+                                   (punCounter[BS_RX_TOTAL] - punOld[BS_RX_TOTAL])) / dSeconds;
+                sStatistics.m_unMsgPerSecond = static_cast<UINT>(dMsgRate + 0.5);
+                sStatistics.m_dErrorRate = ((punCounter[BS_TX_ERROR] - punOld[BS_TX_ERROR]) +
+                                            (punCounter[BS_RX_ERROR] - punOld[BS_RX_ERROR])) / dSeconds;
+                // Transmitted messages
+                sStatistics.m_dTotalTxMsgRate = (punCounter[BS_TX_TOTAL] - punOld[BS_TX_TOTAL]) / dSeconds;
+                sStatistics.m_dTxSTDMsgRate = (punCounter[BS_TX_STD] - punOld[BS_TX_STD]) / dSeconds;
+                sStatistics.m_dTxEXTMsgRate = (punCounter[BS_TX_EXTD] - punOld[BS_TX_EXTD]) / dSeconds;
+                sStatistics.m_dErrorTxRate = (punCounter[BS_TX_ERROR] - punOld[BS_TX_ERROR]) / dSeconds;
+                // Received messages
+                sStatistics.m_dTotalRxMsgRate = (punCounter[BS_RX_TOTAL] - punOld[BS_RX_TOTAL]) / dSeconds;
+                sStatistics.m_dRxSTDMsgRate = (punCounter[BS_RX_STD] - punOld[BS_RX_STD]) / dSeconds;
+                sStatistics.m_dRxEXTMsgRate = (punCounter[BS_RX_EXTD] - punOld[BS_RX_EXTD]) / dSeconds;
+                sStatistics.m_dErrorRxRate = (punCounter[BS_RX_ERROR] - punOld[BS_RX_ERROR]) / dSeconds;
             }
         }
 
-        /* m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond =
-             m_sBusStatistics[ nChannelIndex ].m_unTotalMsgCount -
-             m_sPrevStatData[ nChannelIndex ].m_unTotalMsgCount;
-         m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond =
-             static_cast<UINT>
-             (m_sBusStatistics[ nChannelIndex ].m_unMsgPerSecond / m_dDiffTime );*/
-
-
-
-        // Calculate Error Count & Rate
-        m_sBusStatistics[ nChannelIndex ].m_unErrorTotalCount =
-            m_sBusStatistics[ nChannelIndex ].m_unErrorRxCount +
-            m_sBusStatistics[ nChannelIndex ].m_unErrorTxCount;
-        if(bIsConnected)
-        {
-            m_sBusStatistics[ nChannelIndex ].m_dErrorRate =
-                m_sBusStatistics[ nChannelIndex ].m_unErrorTotalCount -
-                m_sPrevStatData[ nChannelIndex ].m_unErrorTotalCount;
-            // Transmitted messages
-            // Calculate Total Tx Message Rate
-            m_sBusStatistics[nChannelIndex].m_dTotalTxMsgRate =
-                (m_sBusStatistics[nChannelIndex].m_unTotalTxMsgCount -
-                 m_sPrevStatData[nChannelIndex].m_unTotalTxMsgCount);
-            // Calculate STD Tx Message Rate
-            m_sBusStatistics[ nChannelIndex ].m_dTxSTDMsgRate =
-                (m_sBusStatistics[ nChannelIndex ].m_unTxSTDMsgCount -
-                 m_sPrevStatData[ nChannelIndex ].m_unTxSTDMsgCount);
-            // Calculate Extended Tx Message Rate
-            m_sBusStatistics[ nChannelIndex ].m_dTxEXTMsgRate =
-                (m_sBusStatistics[ nChannelIndex ].m_unTxEXTDMsgCount -
-                 m_sPrevStatData[ nChannelIndex ].m_unTxEXTDMsgCount);
-            // Calculate Tx Error Rate
-            m_sBusStatistics[ nChannelIndex ].m_dErrorTxRate =
-                (m_sBusStatistics[ nChannelIndex ].m_unErrorTxCount -
-                 m_sPrevStatData[ nChannelIndex ].m_unErrorTxCount);
-            // Received messages
-            // Calculate Total Rx Message Rate
-            m_sBusStatistics[nChannelIndex].m_dTotalRxMsgRate =
-                (m_sBusStatistics[nChannelIndex].m_unTotalRxMsgCount -
-                 m_sPrevStatData[nChannelIndex].m_unTotalRxMsgCount);
-            // Calculate STD Rx Message Rate
-            m_sBusStatistics[ nChannelIndex ].m_dRxSTDMsgRate =
-                (m_sBusStatistics[ nChannelIndex ].m_unRxSTDMsgCount -
-                 m_sPrevStatData[ nChannelIndex ].m_unRxSTDMsgCount);
-            // Calculate Extended Rx Message Rate
-            m_sBusStatistics[ nChannelIndex ].m_dRxEXTMsgRate =
-                (m_sBusStatistics[ nChannelIndex ].m_unRxEXTDMsgCount -
-                 m_sPrevStatData[ nChannelIndex ].m_unRxEXTDMsgCount);
-            // Calculate Rx Error Rate
-            m_sBusStatistics[ nChannelIndex ].m_dErrorRxRate =
-                (m_sBusStatistics[ nChannelIndex ].m_unErrorRxCount -
-                 m_sPrevStatData[ nChannelIndex ].m_unErrorRxCount);
-        }
         SERROR_CNT sErrorCounter;
         sErrorCounter.m_ucRxErrCount = 0;
         sErrorCounter.m_ucTxErrCount = 0;
 
-        if (m_pouDIL_CAN->DILC_GetErrorCount( sErrorCounter, nChannelIndex, ERR_CNT) == S_OK)
+        if (nullptr != m_pouDIL_CAN && m_pouDIL_CAN->DILC_GetErrorCount( sErrorCounter, nChannelIndex, ERR_CNT) == S_OK)
         {
-            m_sBusStatistics[ nChannelIndex ].m_ucTxErrorCounter =
-                sErrorCounter.m_ucTxErrCount;
-            m_sBusStatistics[ nChannelIndex ].m_ucRxErrorCounter =
-                sErrorCounter.m_ucRxErrCount;
+            sStatistics.m_ucTxErrorCounter = sErrorCounter.m_ucTxErrCount;
+            sStatistics.m_ucRxErrorCounter = sErrorCounter.m_ucRxErrCount;
         }
 
         sErrorCounter.m_ucRxErrCount = 0;
         sErrorCounter.m_ucTxErrCount = 0;
 
-        if (m_pouDIL_CAN->DILC_GetErrorCount( sErrorCounter, nChannelIndex, PEAK_ERR_CNT) == S_OK)
+        if (nullptr != m_pouDIL_CAN && m_pouDIL_CAN->DILC_GetErrorCount( sErrorCounter, nChannelIndex, PEAK_ERR_CNT) == S_OK)
         {
-            m_sBusStatistics[ nChannelIndex ].m_ucTxPeakErrorCount=
-                sErrorCounter.m_ucTxErrCount;
-            m_sBusStatistics[ nChannelIndex ].m_ucRxPeakErrorCount =
-                sErrorCounter.m_ucRxErrCount;
+            sStatistics.m_ucTxPeakErrorCount = sErrorCounter.m_ucTxErrCount;
+            sStatistics.m_ucRxPeakErrorCount = sErrorCounter.m_ucRxErrCount;
         }
 
         // Get the controller status
         LPARAM lParam = 0;
 
-        if (m_pouDIL_CAN->DILC_GetControllerParams( lParam, nChannelIndex,
+        if (nullptr != m_pouDIL_CAN && m_pouDIL_CAN->DILC_GetControllerParams( lParam, nChannelIndex,
                 HW_MODE) == S_OK)
         {
-            m_sBusStatistics[ nChannelIndex ].m_ucStatus = (UCHAR)lParam;
+            sStatistics.m_ucStatus = (UCHAR)lParam;
         }
 
-        //Bus Load
-        DOUBLE dBusLoad  = m_sBusStatistics[ nChannelIndex ].m_unTotalBitsperSec / m_dDiffTime;
-        m_sBusStatistics[ nChannelIndex ].m_unTotalBitsperSec = 0;
-        m_sSubBusStatistics[ nChannelIndex ].m_unTotalBitsperSec = 0;
-
-        if(dBusLoad != 0)
-            dBusLoad = dBusLoad /
-                       ( m_sBusStatistics[ nChannelIndex ].m_dBaudRate /** defBITS_KBUAD_RATE */);
-
-        // Get the percentage load
-        dBusLoad = dBusLoad * defMAX_PERCENTAGE_BUS_LOAD;
-
         // check for peak load
-        if( dBusLoad > m_sBusStatistics[ nChannelIndex ].m_dPeakBusLoad )
+        if( dBusLoad > sStatistics.m_dPeakBusLoad )
         {
-            // if peak load is greater than or equal to 100% assign it 99.99%
-            if( dBusLoad > defMAX_PERCENTAGE_BUS_LOAD )
-            {
-                dBusLoad = defMAX_PERCENTAGE_BUS_LOAD_ALLOWED;
-            }
-
-            m_sBusStatistics[ nChannelIndex ].m_dPeakBusLoad = dBusLoad ;
+            sStatistics.m_dPeakBusLoad = dBusLoad ;
         }
 
-        m_sBusStatistics[ nChannelIndex ].m_dBusLoad = dBusLoad ;
+        sStatistics.m_dBusLoad = dBusLoad ;
         // Calculate avarage bus load
-        m_sBusStatistics[ nChannelIndex ].m_dTotalBusLoad += dBusLoad;
-        // Increament samples
-        // Calculate Avarage bus load
+        sStatistics.m_dTotalBusLoad += dBusLoad;
         if(bIsConnected)
         {
-            m_sBusStatistics[ nChannelIndex ].m_dAvarageBusLoad =
-                m_sBusStatistics[ nChannelIndex ].m_dTotalBusLoad /
-                m_sBusStatistics[ nChannelIndex ].m_nSamples;
+            sStatistics.m_dAvarageBusLoad = sStatistics.m_dTotalBusLoad / sStatistics.m_nSamples;
+        }
+    }
+    m_ouMsgIdProfiler.vSampleCounts(m_unSampleCount);
+
+    LeaveCriticalSection(&m_omCritSecBS);
+}
+
+/**
+ * \param[in] unChannelIndex channel index
+ * \param[in] eWindow WINDOW_1S, WINDOW_10S or WINDOW_60S
+ * \param[out] sRates rates over the window, zero until two samples exist
+ * \return S_OK, S_FALSE for an invalid channel
+ *
+ * Returns the message, error and bus load rates over a sliding window.
+ * The window is shortened to the history available since the last reset.
+ */
+HRESULT CBusStatisticCAN::BSC_GetWindowedRates(UINT unChannelIndex, eRATE_WINDOW eWindow, SBUSRATES& sRates)
+{
+    memset(&sRates, 0, sizeof(SBUSRATES));
+    if (unChannelIndex >= defNO_OF_CHANNELS)
+    {
+        return S_FALSE;
+    }
+    EnterCriticalSection(&m_omCritSecBS);
+
+    UINT unWindowSec = (WINDOW_60S == eWindow) ? 60 : ((WINDOW_10S == eWindow) ? 10 : 1);
+    UINT unSamplesBack = unGetWindowSamples(unWindowSec);
+    if (unSamplesBack > 0)
+    {
+        UINT unNewIndex = unGetHistoryIndex(0);
+        UINT unOldIndex = unGetHistoryIndex(unSamplesBack);
+        const UINT* punNew = m_ouHistory[ unChannelIndex * defBS_RATE_HISTORY + unNewIndex ].m_aunCounter;
+        const UINT* punOld = m_ouHistory[ unChannelIndex * defBS_RATE_HISTORY + unOldIndex ].m_aunCounter;
+        double dSeconds = (double)(m_allHistoryTime[ unNewIndex ] - m_allHistoryTime[ unOldIndex ]) / m_sQPFrequency.QuadPart;
+        if (dSeconds > 0)
+        {
+            sRates.m_dWindowSec = dSeconds;
+            sRates.m_dTxMsgRate = (punNew[BS_TX_TOTAL] - punOld[BS_TX_TOTAL]) / dSeconds;
+            sRates.m_dRxMsgRate = (punNew[BS_RX_TOTAL] - punOld[BS_RX_TOTAL]) / dSeconds;
+            sRates.m_dMsgRate = sRates.m_dTxMsgRate + sRates.m_dRxMsgRate;
+            sRates.m_dErrorRate = ((punNew[BS_TX_ERROR] - punOld[BS_TX_ERROR]) +
+                                   (punNew[BS_RX_ERROR] - punOld[BS_RX_ERROR])) / dSeconds;
+            sRates.m_dBusLoad = dCalculateBusLoad(unChannelIndex, punNew[BS_NOMINAL_BITS] - punOld[BS_NOMINAL_BITS],
+                                                  punNew[BS_DATA_BITS] - punOld[BS_DATA_BITS], dSeconds);
+            for (UINT unSample = 0; unSample < unSamplesBack; unSample++)
+            {
+                double dBusLoad = m_ouHistory[ unChannelIndex * defBS_RATE_HISTORY + unGetHistoryIndex(unSample) ].m_dBusLoad;
+                sRates.m_dPeakBusLoad = max(sRates.m_dPeakBusLoad, dBusLoad);
+            }
         }
-        // Initialise previous values with current values.
-        m_unPrevStandardCount[ nChannelIndex ] =
-            m_sBusStatistics[ nChannelIndex ].m_unRxSTDMsgCount +
-            m_sBusStatistics[ nChannelIndex ].m_unTxSTDMsgCount;
-        m_unPrevExtendedCount[ nChannelIndex ] =
-            m_sBusStatistics[ nChannelIndex ].m_unRxEXTDMsgCount +
-            m_sBusStatistics[ nChannelIndex ].m_unTxEXTDMsgCount;
-        m_unPrevStandardRTRCount[ nChannelIndex ] =
-            m_sBusStatistics[ nChannelIndex ].m_unRxSTD_RTRMsgCount +
-            m_sBusStatistics[ nChannelIndex ].m_unTxSTD_RTRMsgCount;
-        m_unPrevExtendedRTRCount[ nChannelIndex ] =
-            m_sBusStatistics[ nChannelIndex ].m_unRxEXTD_RTRMsgCount +
-            m_sBusStatistics[ nChannelIndex ].m_unTxEXTD_RTRMsgCount;
-        m_unPrevErrorTotalCount[ nChannelIndex ] =
-            m_sBusStatistics[ nChannelIndex ].m_unErrorTotalCount;
-        m_sBusStatistics[ nChannelIndex ].m_unDLCCount = 0;
-        m_sPrevStatData[ nChannelIndex ] = m_sBusStatistics[ nChannelIndex ];
     }
+    LeaveCriticalSection(&m_omCritSecBS);
+    return S_OK;
+}
+
+/**
+ * \param[in] unChannelIndex channel index
+ * \param[out] ouIdRates count and rates of every identifier received or
+ *             transmitted since the last reset
+ * \return S_OK, S_FALSE for an invalid channel
+ *
+ * Returns the per identifier message counts and rates from the identifier
+ * profile, sampled with the channel rates. The BS lock is taken before the
+ * profile lock, as in the timer.
+ */
+HRESULT CBusStatisticCAN::BSC_GetMsgIdRates(UINT unChannelIndex, std::vector<SMSGIDRATE>& ouIdRates)
+{
+    ouIdRates.clear();
+    if (unChannelIndex >= defNO_OF_CHANNELS)
+    {
+        return S_FALSE;
+    }
+    EnterCriticalSection(&m_omCritSecBS);
+
+    UINT unAvailable = (m_unSampleCount > 0) ? (min(m_unSampleCount, (UINT)defPROFILE_COUNT_SAMPLES) - 1) : 0;
+    UINT un1sBack = min(1U, unAvailable);
+    UINT un10sBack = min(10U, unAvailable);
+    double d1s = (0 == un1sBack) ? 0 : (double)(m_allHistoryTime[ unGetHistoryIndex(0) ] -
+                 m_allHistoryTime[ unGetHistoryIndex(un1sBack) ]) / m_sQPFrequency.QuadPart;
+    double d10s = (0 == un10sBack) ? 0 : (double)(m_allHistoryTime[ unGetHistoryIndex(0) ] -
+                  m_allHistoryTime[ unGetHistoryIndex(un10sBack) ]) / m_sQPFrequency.QuadPart;
+    m_ouMsgIdProfiler.vGetRates(unChannelIndex, m_unSampleCount, un1sBack, d1s, un10sBack, d10s, ouIdRates);
+    LeaveCriticalSection(&m_omCritSecBS);
+    return S_OK;
+}
 
+/**
+ * \param[in] unChannelIndex channel index
+ * \param[out] unMsgCount messages since the last reset whose identifier
+ *             found no room in the identifier profile
+ * \return S_OK, S_FALSE for an invalid channel
+ *
+ * These messages are in the channel statistics but in no identifier rate
+ * or profile.
+ */
+HRESULT CBusStatisticCAN::BSC_GetUntrackedMsgCount(UINT unChannelIndex, UINT& unMsgCount)
+{
+    unMsgCount = 0;
+    if (unChannelIndex >= defNO_OF_CHANNELS)
+    {
+        return S_FALSE;
+    }
+    UINT aunCounter[ BS_COUNTER_COUNT ];
+    vReadCounters(unChannelIndex, aunCounter);
+    EnterCriticalSection(&m_omCritSecBS);
+    unMsgCount = aunCounter[ BS_ID_UNTRACKED ] - m_aunBaseline[ unChannelIndex ][ BS_ID_UNTRACKED ];
     LeaveCriticalSection(&m_omCritSecBS);
+    return S_OK;
+}
+
+/**
+ * \param[in] unExpectedIds number of (channel, identifier) pairs expected
+ * \return S_OK
+ *
+ * Sizes the identifier profile table, usually from the number of database
+ * messages. The size is used from the next reset on.
+ */
+HRESULT CBusStatisticCAN::BSC_SetMsgIdProfileSize(UINT unExpectedIds)
+{
+    m_ouMsgIdProfiler.vSetExpectedIds(unExpectedIds);
+    return S_OK;
+}
+
+/**
+ * \param[out] ouProfiles timing profile of every identifier seen since the
+ *             last reset
+ * \return S_OK
+ *
+ * Copies the identifier profile without stopping the read thread.
+ */
+HRESULT CBusStatisticCAN::BSC_GetMsgIdProfile(std::vector<SMSGIDPROFILE>& ouProfiles)
+{
+    m_ouMsgIdProfiler.vGetSnapshot(ouProfiles);
+    return S_OK;
+}
+
+/**
+ * \param[in] strFileName file to create
+ * \param[in] eFormat BS_EXPORT_CSV or BS_EXPORT_JSON
+ * \return S_OK, S_FALSE if the file could not be written
+ *
+ * Writes a snapshot of the identifier profile to a file.
+ */
+HRESULT CBusStatisticCAN::BSC_ExportMsgIdProfile(const std::string& strFileName, eBS_EXPORT_FORMAT eFormat)
+{
+    std::vector<SMSGIDPROFILE> ouProfiles;
+    m_ouMsgIdProfiler.vGetSnapshot(ouProfiles);
+    return CMsgIdProfiler::hExport(ouProfiles, strFileName, eFormat);
 }
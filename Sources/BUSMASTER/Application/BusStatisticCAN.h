@@ -31,51 +31,84 @@
 #include "BaseBusStatisticCAN.h"
 #include "MsgBufFSE.h"
 #include "Flags.h"
+#include "MsgIdProfiler.h"
 
+#define defBS_COUNTER_SHARDS    4       //Writer threads beyond this share shards
+#define defBS_RATE_HISTORY      61      //One second samples, covers the 60 s window
+#define defBS_MAX_DATA_LEN      64
 
-
+/* Counters updated on every Tx/Rx frame */
+enum eBS_COUNTER
+{
+    BS_TX_STD = 0,
+    BS_TX_EXTD,
+    BS_TX_STD_RTR,
+    BS_TX_EXTD_RTR,
+    BS_TX_TOTAL,
+    BS_TX_ERROR,
+    BS_RX_STD,
+    BS_RX_EXTD,
+    BS_RX_STD_RTR,
+    BS_RX_EXTD_RTR,
+    BS_RX_TOTAL,
+    BS_RX_ERROR,
+    BS_ERROR_TOTAL,
+    BS_DLC,
+    BS_NOMINAL_BITS,                    //Bits at the nominal baud rate
+    BS_DATA_BITS,                       //CAN FD data phase bits sent with bit rate switch
+    BS_ID_UNTRACKED,                    //Frames of identifiers the profile had no room for
+    BS_COUNTER_COUNT
+};
 
 class CBusStatisticCAN : public CBaseBusStatisticCAN
 {
     //Attributes
 private:
+    /* Cumulative counters of all channels written by one group of threads.
+       Every counter only grows, readers sum the shards without locking and
+       resets are done by moving the baseline. */
+    struct __declspec(align(64)) sCOUNTERSHARD
+    {
+        volatile LONG m_alCounter[ defNO_OF_CHANNELS ][ BS_COUNTER_COUNT ];
+    };
+    /* Counter snapshot taken by the timer */
+    struct sCOUNTERSAMPLE
+    {
+        UINT m_aunCounter[ BS_COUNTER_COUNT ];
+        double m_dBusLoad;              //Load of the interval ending with this sample
+    };
+
     //used to Creating threads
     CPARAM_THREADPROC m_ouReadThread;
-    //Critical section
+    //Critical section, guards the published statistics and the history
     CRITICAL_SECTION m_omCritSecBS;
     //Bus Statictics Structure
     SBUSSTATISTICS m_sBusStatistics[ defNO_OF_CHANNELS ];
-    //Sub BusStatistics
-    SSUBBUSSTATISTICS m_sSubBusStatistics[ defNO_OF_CHANNELS ];
-    //Temporary Referance of STCAN_MSG
-    STCAN_MSG m_sCurrEntry;
-    //variable to hold current channel
 
     CBaseDIL_CAN* m_pouDIL_CAN;
-    //To keep previous bus data
-    SBUSSTATISTICS m_sPrevStatData[ defNO_OF_CHANNELS ];
-    int m_nFactorSTDFrame;
-    int m_nFactorEXTDFrame;
-    int m_nFactorSTDRTRFrame;
-    int m_nFactorEXTDRTRFrame;
-    int m_nFactorErrorFrame;
-    double m_dDiffTime;
     UINT_PTR m_nTimerHandle;
-    // Just for an intermediate calculations
-    UINT m_unPrevStandardCount[ defNO_OF_CHANNELS ] ;
-    UINT m_unPrevExtendedCount[ defNO_OF_CHANNELS ] ;
-    UINT m_unPrevStandardRTRCount[ defNO_OF_CHANNELS ] ;
-    UINT m_unPrevExtendedRTRCount[ defNO_OF_CHANNELS ] ;
-    UINT m_unPrevErrorTotalCount[ defNO_OF_CHANNELS ] ;
-    INT  m_unPreviousTime;
     static void* sm_pouBSCan;
 
-    UINT m_unBitsStdMsg[9];
-    UINT m_unBitsExdMsg[9];
+    //Lock free counters
+    sCOUNTERSHARD* m_psShards;
+    DWORD m_dwShardTlsIndex;
+    volatile LONG m_lShardsAssigned;
+    UINT m_aunBaseline[ defNO_OF_CHANNELS ][ BS_COUNTER_COUNT ];
+
+    //Sliding window history, sample n is stored at n % defBS_RATE_HISTORY
+    std::vector<sCOUNTERSAMPLE> m_ouHistory;    //defBS_RATE_HISTORY samples per channel
+    LONGLONG m_allHistoryTime[ defBS_RATE_HISTORY ];
+    UINT m_unSampleCount;                       //Samples taken since the last reset
+    LARGE_INTEGER m_sQPFrequency;
+
+    //Frame length in bits for [extended][classic, FD, FD with BRS][data length]
+    UINT m_aunNominalBits[2][3][ defBS_MAX_DATA_LEN + 1 ];
+    UINT m_aunDataBits[2][3][ defBS_MAX_DATA_LEN + 1 ];
+    double m_adDataBaudRate[ defNO_OF_CHANNELS ];
+    volatile bool m_abBitRateSwitch[ defNO_OF_CHANNELS ];
 
-    UINT m_unBitsFDMsgCRC15[2][9];
-    UINT m_unBitsFDMsgCRC17[2][2];
-    UINT m_unBitsFDMsgCRC21[2][5];
+    //Counts, rates and timing profile per channel and identifier, written by the read thread
+    CMsgIdProfiler m_ouMsgIdProfiler;
 
 public:
     CMsgBufFSE<STCANDATA> m_ouCanBufFSE;
@@ -113,6 +146,19 @@ public:
     UCHAR BSC_ucGetControllerStatus(UINT unChannelIndex);
     //Get the required channel's BusStistic structure.
     HRESULT BSC_GetBusStatistics(UINT unChannelIndex, SBUSSTATISTICS& sBusStatistics);
+    //To Set the CAN FD data phase Baud Rate
+    HRESULT BSC_SetDataBaudRate(UINT unChannelIndex, double dDataBaudRate);
+    //Get the rates over a sliding window
+    HRESULT BSC_GetWindowedRates(UINT unChannelIndex, eRATE_WINDOW eWindow, SBUSRATES& sRates);
+    //Get the per identifier counts and rates
+    HRESULT BSC_GetMsgIdRates(UINT unChannelIndex, std::vector<SMSGIDRATE>& ouIdRates);
+    HRESULT BSC_GetUntrackedMsgCount(UINT unChannelIndex, UINT& unMsgCount);
+    //Size the identifier profile, applied with the next reset
+    HRESULT BSC_SetMsgIdProfileSize(UINT unExpectedIds);
+    //Get the timing profile of every identifier
+    HRESULT BSC_GetMsgIdProfile(std::vector<SMSGIDPROFILE>& ouProfiles);
+    //Write the identifier profile to a file
+    HRESULT BSC_ExportMsgIdProfile(const std::string& strFileName, eBS_EXPORT_FORMAT eFormat);
     //Updates the Bus Statics Structure on every Tx/Rx Message.
     void vUpdateBusStatistics(STCANDATA& sCanData);
     //Calculate the Bus statistics on timer
@@ -124,8 +170,18 @@ public:
 private:
     //Initialise or resets the bus statistics.
     void vInitialiseBSData(void);
-    //Calculates the Time differance.
-    void vCalculateDiffTime(void);
+    //Initialises the frame length tables
+    void vInitialiseFrameBits(void);
+    //Shard of the calling thread
+    sCOUNTERSHARD& ouGetShard(void);
+    //Sums the shards of a channel
+    void vReadCounters(int nChannelIndex, UINT aunCounter[ BS_COUNTER_COUNT ]);
+    //Index of the sample unSamplesBack before the latest
+    UINT unGetHistoryIndex(UINT unSamplesBack);
+    //Number of samples back covering the window, 0 if not enough history
+    UINT unGetWindowSamples(UINT unWindowSec);
+    //Bus load of a bit count difference
+    double dCalculateBusLoad(int nChannelIndex, UINT unNominalBits, UINT unDataBits, double dSeconds);
     //Starts the BS Read Thread
     BOOL bStartBSReadThread(void);
 };
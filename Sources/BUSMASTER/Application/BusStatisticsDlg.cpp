@@ -75,7 +75,8 @@ CBusStatisticsDlg::CBusStatisticsDlg(CBaseBusStatisticCAN* pouBSCAN,int nChannel
       m_pouBSCAN(pouBSCAN),
       m_omStrBusLoad(""),
       m_omStrPeakBusLoad(""),
-      m_omStrAvgBusLoad( "" )
+      m_omStrAvgBusLoad( "" ),
+      m_nReorderRow(0)
 
 {
     //{{AFX_DATA_INIT(CBusStatisticsDlg)
@@ -88,7 +89,8 @@ CBusStatisticsDlg::CBusStatisticsDlg(CBaseBusStatisticCAN* pouBSCAN, CWnd* /* pP
       m_pouBSCAN(pouBSCAN),
       m_omStrBusLoad(""),
       m_omStrPeakBusLoad(""),
-      m_omStrAvgBusLoad( "" )
+      m_omStrAvgBusLoad( "" ),
+      m_nReorderRow(0)
 
 {
     //{{AFX_DATA_INIT(CBusStatisticsDlg)
@@ -360,11 +362,86 @@ LRESULT CBusStatisticsDlg::vUpdateFields(WPARAM /*wParam*/, LPARAM /*lParam*/)
                                sBusStatistics.m_ucRxPeakErrorCount );
             m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
             nIndex++;
+            // Increment for the title Sliding Windows
+            nIndex++;
+
+            SBUSRATES sRates10s, sRates60s;
+            m_pouBSCAN->BSC_GetWindowedRates(nChannel, WINDOW_10S, sRates10s);
+            m_pouBSCAN->BSC_GetWindowedRates(nChannel, WINDOW_60S, sRates60s);
+            // Message rate over 10 s and 60 s
+            omDispText.Format( defSTR_FORMAT_FLOAT_DATA, sRates10s.m_dMsgRate );
+            m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
+            nIndex++;
+            omDispText.Format( defSTR_FORMAT_FLOAT_DATA, sRates60s.m_dMsgRate );
+            m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
+            nIndex++;
+            // Error rate over 60 s
+            omDispText.Format( defSTR_FORMAT_FLOAT_DATA, sRates60s.m_dErrorRate );
+            m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
+            nIndex++;
+            // Load over 10 s and 60 s
+            omDispText.Format( defSTR_FORMAT_BUS_LOAD, sRates10s.m_dBusLoad );
+            m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
+            nIndex++;
+            omDispText.Format( defSTR_FORMAT_BUS_LOAD, sRates60s.m_dBusLoad );
+            m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
+            nIndex++;
+            // Peak of the one second loads over 60 s
+            omDispText.Format( defSTR_FORMAT_BUS_LOAD, sRates60s.m_dPeakBusLoad );
+            m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
+            nIndex++;
+            // Messages of identifiers the profile had no room for
+            UINT unUntracked = 0;
+            m_pouBSCAN->BSC_GetUntrackedMsgCount(nChannel, unUntracked);
+            omDispText.Format( defSTR_FORMAT_UINT_DATA, unUntracked );
+            m_omStatList.SetItemText(nIndex, nChannel + 1, omDispText);
+            nIndex++;
         }
+        vUpdateReorderFields();
     }
     return 0;
 }
 
+/*******************************************************************************
+  Function Name  : vUpdateReorderFields
+  Input(s)       : -
+  Output         : -
+  Functionality  : Shows the counters of the driver stage that merges the
+                   received messages of all channels into timestamp order.
+                   The stage serves all channels, so the values are shown in
+                   the first channel column. Drivers without the stage show
+                   the initial value.
+  Member of      : CBusStatisticsDlg
+*******************************************************************************/
+void CBusStatisticsDlg::vUpdateReorderFields(void)
+{
+    SREORDER_STATS sReorder;
+    bool bValid = (nullptr != g_pouDIL_CAN_Interface) &&
+                  (g_pouDIL_CAN_Interface->DILC_GetReorderStats(sReorder) == S_OK);
+    UINT64 aun64Values[defREORDER_ROWS];
+    if (bValid)
+    {
+        aun64Values[0] = sReorder.m_un64Frames;
+        aun64Values[1] = sReorder.m_unDepth;
+        aun64Values[2] = sReorder.m_unMaxDepth;
+        aun64Values[3] = sReorder.m_un64Reordered;
+        aun64Values[4] = sReorder.m_un64Late;
+        aun64Values[5] = sReorder.m_un64HoldExpired;
+        aun64Values[6] = sReorder.m_unActiveChannels;
+        aun64Values[7] = sReorder.m_un64IdleChannels;
+        aun64Values[8] = sReorder.m_unHoldTimeMs;
+    }
+    CString omDispText = _(defSTR_INITIAL_VAL);
+    for (int nRow = 0; nRow < defREORDER_ROWS; nRow++)
+    {
+        if (bValid)
+        {
+            omDispText.Format( "%I64u", aun64Values[nRow] );
+        }
+        m_omStatList.SetItemText(m_nReorderRow + nRow, 1, omDispText);
+    }
+}
+
 /*******************************************************************************
   Function Name  : OnInitDialog
   Input(s)       : -
@@ -600,6 +677,78 @@ BOOL CBusStatisticsDlg::OnInitDialog()
     m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
     m_omStatList.SetItemData(nIndex, nItemColor);
     nIndex++;
+
+    // Insert Sliding Windows Heading
+    m_omStatList.InsertItem(nIndex, _(defSTR_WINDOW_HEADING) );
+    m_omStatList.SetItemData(nIndex, nHeadingColor);
+    nIndex++;
+
+    // Insert Message rate over 10 s
+    m_omStatList.InsertItem(nIndex, _(defSTR_PARAMETER_MSG_RATE_10S) );
+    m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+    m_omStatList.SetItemData(nIndex, nItemColor);
+    nIndex++;
+
+    // Insert Message rate over 60 s
+    m_omStatList.InsertItem(nIndex, _(defSTR_PARAMETER_MSG_RATE_60S) );
+    m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+    m_omStatList.SetItemData(nIndex, nItemColor);
+    nIndex++;
+
+    // Insert Error rate over 60 s
+    m_omStatList.InsertItem(nIndex, _(defSTR_PARAMETER_ERR_RATE_60S) );
+    m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+    m_omStatList.SetItemData(nIndex, nItemColor);
+    nIndex++;
+
+    // Insert Load over 10 s
+    m_omStatList.InsertItem(nIndex, _(defSTR_PARAMETER_LOAD_10S) );
+    m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+    m_omStatList.SetItemData(nIndex, nItemColor);
+    nIndex++;
+
+    // Insert Load over 60 s
+    m_omStatList.InsertItem(nIndex, _(defSTR_PARAMETER_LOAD_60S) );
+    m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+    m_omStatList.SetItemData(nIndex, nItemColor);
+    nIndex++;
+
+    // Insert Peak load over 60 s
+    m_omStatList.InsertItem(nIndex, _(defSTR_PARAMETER_PEAK_LOAD_60S) );
+    m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+    m_omStatList.SetItemData(nIndex, nItemColor);
+    nIndex++;
+
+    // Insert Untracked identifier messages
+    m_omStatList.InsertItem(nIndex, _(defSTR_PARAMETER_UNTRACKED_IDS) );
+    m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+    m_omStatList.SetItemData(nIndex, nItemColor);
+    nIndex++;
+
+    // Insert Receive Order Heading and the counters of the reorder stage
+    m_omStatList.InsertItem(nIndex, _(defSTR_REORDER_HEADING) );
+    m_omStatList.SetItemData(nIndex, nHeadingColor);
+    nIndex++;
+    static const char* const s_apchReorderRows[defREORDER_ROWS] =
+    {
+        defSTR_PARAMETER_REORDER_FRAMES,
+        defSTR_PARAMETER_REORDER_DEPTH,
+        defSTR_PARAMETER_REORDER_MAX_DEPTH,
+        defSTR_PARAMETER_REORDER_REORDERED,
+        defSTR_PARAMETER_REORDER_LATE,
+        defSTR_PARAMETER_REORDER_EXPIRED,
+        defSTR_PARAMETER_REORDER_CHANNELS,
+        defSTR_PARAMETER_REORDER_IDLE,
+        defSTR_PARAMETER_REORDER_HOLD
+    };
+    m_nReorderRow = nIndex;
+    for (int nRow = 0; nRow < defREORDER_ROWS; nRow++)
+    {
+        m_omStatList.InsertItem(nIndex, _(s_apchReorderRows[nRow]) );
+        m_omStatList.SetItemText(nIndex, 1, omStrInitValue);
+        m_omStatList.SetItemData(nIndex, nItemColor);
+        nIndex++;
+    }
     GetWindowPlacement(&sm_sBusSerializationData.m_sDefaultBusStatsDlgCoOrd);
 
     if(sm_sBusSerializationData.m_sBusStatsDlgCoOrd.rcNormalPosition.left == 0)
@@ -31,6 +31,8 @@
 #include "resource.h"
 #include "NetworkStatistics.h"
 
+#define defREORDER_ROWS     9       // Rows of the receive order counters
+
 //BusStatistics Class
 class CBusStatisticsDlg : public CCommonStatistics
 {
@@ -38,7 +40,7 @@ class CBusStatisticsDlg : public CCommonStatistics
     // Construction
 public:
     enum { IDD = IDD_DLG_NETWORK_STATISTICS };
-    CBusStatisticsDlg():CCommonStatistics(CBusStatisticsDlg::IDD, CAN)
+    CBusStatisticsDlg():CCommonStatistics(CBusStatisticsDlg::IDD, CAN), m_nReorderRow(0)
     {
 
     }
@@ -59,12 +61,16 @@ protected:
     //}}AFX_MSG
     DECLARE_MESSAGE_MAP()
     afx_msg LRESULT vUpdateFields(WPARAM wParam, LPARAM lParam);
+    // Updates the rows of the driver reorder stage
+    void vUpdateReorderFields(void);
 private:
     CBaseBusStatisticCAN* m_pouBSCAN;
     // String objects to format bus load related parameters
     CString m_omStrBusLoad;
     CString m_omStrPeakBusLoad;
     CString m_omStrAvgBusLoad;
+    // First row of the receive order counters
+    int m_nReorderRow;
 
 public:
     afx_msg void OnSize(UINT nType, int cx, int cy);
@@ -588,6 +588,7 @@ for (auto itrSchedCmd : ouScheduleTableProps.m_ouCLINSheduleTableItem)
                     pFrame->GetFrameId(unFrameId);
 
                     ouScheduleCmd.m_nId = unFrameId;
+                    vGetAssociatedFrames(pCluster, pFrame, ouScheduleCmd);
                 }
 
                 if (nullptr != pECU)
@@ -606,6 +607,50 @@ for (auto itrSchedCmd : ouScheduleTableProps.m_ouCLINSheduleTableItem)
     }
 }
 
+/* Sporadic and event triggered frames are scheduled as such, with the
+   identifiers of their associated frames */
+void vGetAssociatedFrames(ICluster* pCluster, IFrame* pFrame, CScheduleCommands& ouScheduleCmd)
+{
+    LinFrameProps ouFrameProps;
+    ouFrameProps.m_eLinFrameType = eLinInvalidFrame;
+    pFrame->GetProperties(ouFrameProps);
+
+    std::map<UID_ELEMENT, UID_ELEMENT>* pouAssociated = nullptr;
+    if (eLinSporadicFrame == ouFrameProps.m_eLinFrameType)
+    {
+        ouScheduleCmd.m_eCommandType = COMMAND_SPORADIC;
+        pouAssociated = &ouFrameProps.m_ouLINSporadicFrameProps.m_pouUnconditionalFrame;
+    }
+    else if (eLinEventTriggeredFrame == ouFrameProps.m_eLinFrameType)
+    {
+        ouScheduleCmd.m_eCommandType = COMMAND_EVENT;
+        pouAssociated = &ouFrameProps.m_ouLINEventTrigFrameProps.m_pouUnconditionalFrame;
+
+        IElement* pTable = nullptr;
+        pCluster->GetElement(eScheduleTableElement, ouFrameProps.m_ouLINEventTrigFrameProps.m_nCollisionResolveTable, &pTable);
+        if (nullptr != pTable)
+        {
+            pTable->GetName(ouScheduleCmd.m_strCollisionTable);
+        }
+    }
+    else
+    {
+        return;
+    }
+
+for (auto itrFrame : *pouAssociated)
+    {
+        IFrame* pAssociated = nullptr;
+        pCluster->GetElement(eFrameElement, itrFrame.first, (IElement**)&pAssociated);
+        if (nullptr != pAssociated)
+        {
+            unsigned int unFrameId;
+            pAssociated->GetFrameId(unFrameId);
+            ouScheduleCmd.m_ouFrameIds.push_back(unFrameId);
+        }
+    }
+}
+
 eCommandType vGetScheduleCommandType(eDiagType oueDiagType)
 {
     switch (oueDiagType)
@@ -19,6 +19,7 @@
 #include "BusMasterNetWork.h"
 void vUpdateScheduleTableList( ChannelSettings& ouChannelSettings, unsigned int unChannel, IBMNetWorkService* pBMNetwork );
 eCommandType vGetScheduleCommandType(eDiagType oueDiagType);
+void vGetAssociatedFrames(ICluster* pCluster, IFrame* pFrame, CScheduleCommands& ouScheduleCmd);
 
 
 class CChannelConfigurationDlg : public CDialog
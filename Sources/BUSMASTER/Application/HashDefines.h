@@ -797,6 +797,7 @@ Are you sure you want to delete?"
 details since message length\nfor the selected message is zero!"
 
 #define defLOG_FILTER               "*.log|*.log||"
+#define defREPLAY_FILTER            "*.log;*.blf|*.log;*.blf|*.log|*.log|*.blf|*.blf||"
 #define defSTR_LOG_FILE_EXTENSION   "log"
 // Logging
 #define defLOGDLG_CAPTION           "Select Message Log File..."
@@ -1277,6 +1278,8 @@ transmission is ON.\nDo you want to ignore the changes ?"
 #define defMAX_PERCENTAGE_BUS_LOAD_ALLOWED  99.99
 #define defSTR_FORMAT_BUS_LOAD              _("%-5.2f %%")
 #define defBITS_KBUAD_RATE                  1000.0
+#define defBITS_FD_ARB_PHASE_STD            29 //Nominal rate bits of a CAN FD frame with BRS
+#define defBITS_FD_ARB_PHASE_EXTD           48
 
 #define defBITS_ERR_FRAME_LIN               20
 #define defBITS_STD_FRAME_LIN               50 //Without databytes.
@@ -1545,6 +1548,26 @@ transmission is ON.\nDo you want to ignore the changes ?"
 #define defSTR_PARAMETER_RX_ERROR_COUNT        "Rx Error Counter"
 #define defSTR_PARAMETER_PEAK_RX_ERROR_COUNT   "Peak Rx Error Counter"
 
+#define defSTR_WINDOW_HEADING              "          Sliding Windows    "
+#define defSTR_PARAMETER_MSG_RATE_10S      "Messages 10 s [Msg/s]"
+#define defSTR_PARAMETER_MSG_RATE_60S      "Messages 60 s [Msg/s]"
+#define defSTR_PARAMETER_ERR_RATE_60S      "Errors 60 s   [Err/s]"
+#define defSTR_PARAMETER_LOAD_10S          "Load 10 s"
+#define defSTR_PARAMETER_LOAD_60S          "Load 60 s"
+#define defSTR_PARAMETER_PEAK_LOAD_60S     "Peak Load 60 s"
+#define defSTR_PARAMETER_UNTRACKED_IDS     "Untracked ID Messages"
+
+#define defSTR_REORDER_HEADING             "          Receive Order (all channels)    "
+#define defSTR_PARAMETER_REORDER_FRAMES    "Merged Messages"
+#define defSTR_PARAMETER_REORDER_DEPTH     "Held Messages"
+#define defSTR_PARAMETER_REORDER_MAX_DEPTH "Peak Held Messages"
+#define defSTR_PARAMETER_REORDER_REORDERED "Reordered Messages"
+#define defSTR_PARAMETER_REORDER_LATE      "Late Messages"
+#define defSTR_PARAMETER_REORDER_EXPIRED   "Hold Time Expired"
+#define defSTR_PARAMETER_REORDER_CHANNELS  "Merged Channels"
+#define defSTR_PARAMETER_REORDER_IDLE      "Idle Channel Events"
+#define defSTR_PARAMETER_REORDER_HOLD      "Hold Time     [ms]"
+
 #define defSTR_ACTIVE_STATE                 "Active"
 #define defSTR_PASSIVE_STATE                "Passive"
 #define defSTR_BUSOFF_STATE                 "Bus Off"
@@ -1833,6 +1856,8 @@ transmission is ON.\nDo you want to ignore the changes ?"
 #define defSTR_REPLAY_ERROR         "Replay failed for: %s, %s"
 #define defSTR_REPLAY_FILE_EMPTY    "File is empty and all messages are filtered"
 #define defSTR_REPLAY_FILE_SIZE_EXCEEDED    "File size should be less than 50Mb."
+#define defSTR_BLF_LIBRARY_MISSING  "BLF library could not be loaded"
+#define defSTR_BLF_NI_REPLAY_UNSUPPORTED    "BLF files can be replayed only interactively"
 
 #define defSTR_REPLAY_WINDOW_TITLE  "Replay Window - "
 
@@ -49,6 +49,7 @@
 #include "MsgBufferConfigPage.h"    // For Message Buffer Configuration PPage
 #include "MsgFilterConfigPage.h"    // For Filter configuration page
 #include "DatabaseDissociateDlg.h"
+#include "MsgIdProfileDlg.h"
 #include "AppServices_Impl.h"
 #include "include/utils_macro.h"
 #include "Include/BaseDefs.h"
@@ -325,6 +326,7 @@ BEGIN_MESSAGE_MAP(CMainFrame, CMDIFrameWndEx)
     ON_UPDATE_COMMAND_UI(IDM_CONFIGURE_ACTIVE, OnUpdateConfigureModeActive)
     ON_WM_TIMER()
     ON_COMMAND(IDM_NETWORK_STATISTICS_WND_CAN,OnStatisticsCAN)
+    ON_COMMAND(IDM_MSGID_PROFILE_CAN, OnMsgIdProfileCAN)
     ON_COMMAND(IDM_NETWORK_STATISTICS_WND_LIN,OnStatisticsLIN)
 
     ON_COMMAND(IDM_CONFIGURE_PASSIVE, OnConfigurePassive)
@@ -582,11 +584,12 @@ CMainFrame::CMainFrame()
     }
 
     m_objTSEditorHandler.vLoadTSEditor_DLL();
-    m_objTSExecutorHandler.vLoadTSExecutor_DLL();
+    //The test suite executor DLL is loaded when its window is first opened
 
     m_xmlConfigFiledoc = nullptr;
     m_bIsXmlConfig = TRUE;
     m_pXmlNodeBusStats = nullptr;
+    m_hJ1939DbPreload = nullptr;
 
     // language support
     vGettextBusmaster();
@@ -1464,22 +1467,107 @@ DESCRIPTION:    Loads a database file selected by the user
 PARAMETERS:     file name ,bFrmCom
 RETURN VALUE:   bool
 *******************************************************************************/
-DWORD CMainFrame::dLoadDataBaseFile(CString omStrActiveDataBase, bool /* bFrmCom */)
+void CMainFrame::vGetAbsoluteDbPath(CString& omStrDbPath)
 {
-    DWORD dReturn= (DWORD)E_FAIL;
-    //Check for same DB path......
-    //TODO::Remove
-    m_ouBusmasterNetwork->SetChannelCount( CAN, 1 );
-    if ( TRUE == PathIsRelative( omStrActiveDataBase ) )
+    if ( TRUE == PathIsRelative( omStrDbPath ) )
     {
         std::string omStrBasePath;
         CString omConfigFileName;
         vGetLoadedCfgFileName( omConfigFileName );
         CUtilFunctions::nGetBaseFolder( omConfigFileName.GetBuffer( MAX_PATH ), omStrBasePath );
         char chAbsPath[MAX_PATH];
-        PathCombine( chAbsPath, omStrBasePath.c_str(), omStrActiveDataBase.GetBuffer( MAX_PATH ) );
-        omStrActiveDataBase = chAbsPath;
+        PathCombine( chAbsPath, omStrBasePath.c_str(), omStrDbPath.GetBuffer( MAX_PATH ) );
+        omStrDbPath = chAbsPath;
+    }
+}
+
+void CMainFrame::vWriteDbLoadReport(const char* pchBus, DbLoadReport& ouReport)
+{
+    if ( true == ouReport.m_ouFileTimesMs.empty() )
+    {
+        return;
+    }
+    CString omStrReport;
+    omStrReport.Format( "%s databases loaded in %.1f ms (%u from cache, %u parsed, %u failed)", pchBus,
+                        ouReport.m_dTotalTimeMs, ouReport.m_unFromCache, ouReport.m_unParsed, ouReport.m_unFailed );
+    theApp.bWriteIntoTraceWnd( omStrReport.GetBuffer( 0 ) );
+    for ( auto itr = ouReport.m_ouFileTimesMs.begin(); itr != ouReport.m_ouFileTimesMs.end(); ++itr )
+    {
+        omStrReport.Format( "    %s : %.1f ms", itr->first.c_str(), itr->second );
+        theApp.bWriteIntoTraceWnd( omStrReport.GetBuffer( 0 ) );
     }
+}
+
+DWORD WINAPI CMainFrame::J1939DbPreloadThread(LPVOID pVoid)
+{
+    CMainFrame* pMainFrame = static_cast<CMainFrame*>(pVoid);
+    pMainFrame->m_ouBusmasterNetwork->PreloadDbFiles( J1939, pMainFrame->m_ouJ1939PreloadPaths, pMainFrame->m_ouJ1939PreloadReport );
+    return 0;
+}
+
+/* Clears the J1939 databases and starts loading the ones of the configuration.
+   The CAN databases are preloaded by the DATABASE_SECTION_ID section at the same
+   time, the clusters of both protocols are kept apart by the network. */
+void CMainFrame::vStartJ1939DbPreload(void)
+{
+    bWaitForJ1939DbPreload();
+    m_ouJ1939PreloadPaths.clear();
+    m_ouJ1939PreloadReport = DbLoadReport();
+
+    xmlChar* pchPath = (xmlChar*)"//BUSMASTER_CONFIGURATION/Module_Configuration/J1939_Database_Files/FilePath";
+    xmlXPathObjectPtr pPathObject = xmlUtils::pGetNodes(m_xmlConfigFiledoc, pchPath);
+    if ( nullptr == pPathObject )
+    {
+        return;
+    }
+    xmlNodeSetPtr pNodeSet = pPathObject->nodesetval;
+    for ( int i = 0; ( nullptr != pNodeSet ) && ( i < pNodeSet->nodeNr ); i++ )
+    {
+        xmlChar* ptext = xmlNodeListGetString(m_xmlConfigFiledoc, pNodeSet->nodeTab[i]->xmlChildrenNode, 1);
+        if ( nullptr != ptext )
+        {
+            CString omStrDbPath = ptext;
+            vGetAbsoluteDbPath( omStrDbPath );
+            m_ouJ1939PreloadPaths.push_back( (LPCSTR)omStrDbPath );
+            xmlFree(ptext);
+        }
+    }
+    xmlXPathFreeObject(pPathObject);
+    if ( true == m_ouJ1939PreloadPaths.empty() )
+    {
+        return;
+    }
+
+    vClearDbInfo(J1939);
+    m_hJ1939DbPreload = CreateThread(nullptr, 0, J1939DbPreloadThread, this, 0, nullptr);
+    if ( nullptr == m_hJ1939DbPreload )
+    {
+        //Databases are then parsed one by one while the section loads
+        m_ouJ1939PreloadPaths.clear();
+    }
+}
+
+/* Returns false if no preload was running */
+bool CMainFrame::bWaitForJ1939DbPreload(void)
+{
+    if ( nullptr == m_hJ1939DbPreload )
+    {
+        return false;
+    }
+    WaitForSingleObject(m_hJ1939DbPreload, INFINITE);
+    CloseHandle(m_hJ1939DbPreload);
+    m_hJ1939DbPreload = nullptr;
+    vWriteDbLoadReport( "J1939", m_ouJ1939PreloadReport );
+    return true;
+}
+
+DWORD CMainFrame::dLoadDataBaseFile(CString omStrActiveDataBase, bool /* bFrmCom */)
+{
+    DWORD dReturn= (DWORD)E_FAIL;
+    //Check for same DB path......
+    //TODO::Remove
+    m_ouBusmasterNetwork->SetChannelCount( CAN, 1 );
+    vGetAbsoluteDbPath( omStrActiveDataBase );
 
     int channel = 0;
     ERRORCODE ecError = m_ouBusmasterNetwork->LoadDb( CAN, channel, omStrActiveDataBase.GetBuffer( 0 ) );
@@ -1489,6 +1577,15 @@ DWORD CMainFrame::dLoadDataBaseFile(CString omStrActiveDataBase, bool /* bFrmCom
         m_objTxHandler.SetNetworkConfig(CAN, m_ouBusmasterNetwork);
         sg_pouSWInterface[CAN]->SW_SetClusterInfo( m_ouBusmasterNetwork );
 
+        //Bus statistics identifier profile, sized for every database message on every channel
+        CBaseBusStatisticCAN* pouBusStat = GetICANBusStat();
+        if ( nullptr != pouBusStat )
+        {
+            std::list<IFrame*> ouFrames;
+            m_ouBusmasterNetwork->GetFrameList( CAN, 0, ouFrames );
+            pouBusStat->BSC_SetMsgIdProfileSize( (UINT)ouFrames.size() * max( m_nNumChannels, 1 ) );
+        }
+
         //TODO CAN Nodesim
         //Update in NodeSimEx
         GetICANNodeSim()->NS_UpdateFuncStructsNodeSimEx( (PVOID)&( m_sExFuncPtr[CAN].m_omDefinedMsgHeaders ), UPDATE_UNIONS_HEADER_FILES );
@@ -3042,6 +3139,23 @@ void CMainFrame::OnStatisticsCAN()
     OnStatistics(CAN);
 }
 
+/******************************************************************************/
+/*  Functionality    :  This function is called by framework when user        */
+/*                      clicks the CAN message ID profile. Shows the rates and*/
+/*                      timing of every identifier and exports them.          */
+/******************************************************************************/
+void CMainFrame::OnMsgIdProfileCAN()
+{
+    LONG lParam = 0;
+    int nTotalChannels = defNO_OF_CHANNELS;
+    if (g_pouDIL_CAN_Interface && g_pouDIL_CAN_Interface->DILC_GetControllerParams(lParam, 0, NUMBER_HW) == S_OK)
+    {
+        nTotalChannels = (INT)lParam;
+    }
+    CMsgIdProfileDlg odProfileDlg(GetICANBusStat(), nTotalChannels, this);
+    odProfileDlg.DoModal();
+}
+
 /******************************************************************************/
 /*  Functionality    :  This function is called by framework when user        */
 /*                      clicks the LIN network statistics
@@ -5859,6 +5973,8 @@ void CMainFrame::OnFileConnect()
 #else
                 GetICANBusStat()->BSC_SetBaudRate(i, _tstof(m_asControllerDetails[i].m_omStrBaudrate.c_str()));
 #endif
+                GetICANBusStat()->BSC_SetDataBaudRate(i, m_asControllerDetails[i].m_bcanFDEnabled ?
+                                                      m_asControllerDetails[i].m_unDataBitRate : 0);
             }
             GetICANBusStat()->BSC_bStartUpdation(TRUE);
 
@@ -5911,6 +6027,7 @@ void CMainFrame::OnFileConnect()
 				busStatus.mEventType = eBUSEVENT::ON_PRE_CONNECT;
 				mPluginManager->notifyPlugins(eBusmaster_Event::Bus_Status, &busStatus);
 
+                vSetVirtualTime(true);
 				if (g_pouDIL_CAN_Interface->DILC_StartHardware() == S_OK)
                 {
                     ouWaitIndicator.SetWindowText(_("Connected... "));
@@ -5921,6 +6038,7 @@ void CMainFrame::OnFileConnect()
                 }
                 else
                 {
+                    vSetVirtualTime(false);
                     ouWaitIndicator.SetWindowText(_("Failed to connect the hardware... "));
                     theApp.bWriteIntoTraceWnd(_("Failed to start the hardware"));
                 }
@@ -5933,6 +6051,7 @@ void CMainFrame::OnFileConnect()
         {
             if (g_pouDIL_CAN_Interface->DILC_StopHardware() == S_OK)
             {
+                vSetVirtualTime(false);
 				Event_Bus_Staus busStatus;
 				busStatus.mBus = ETYPE_BUS::CAN;
 				busStatus.mEventType = eBUSEVENT::ON_DISCONNECT;
@@ -10150,6 +10269,8 @@ int CMainFrame::nLoadXMLConfiguration(std::string& m_strCfxFile)
     if ( nullptr != m_xmlConfigFiledoc )           //1. Try to Load as a XML file
     {
         //AfxMessageBox("Loaded");
+        //Module lookups are answered from one walk over the document
+        xmlUtils::bCreateDocIndex(m_xmlConfigFiledoc);
         mPluginManager->notifyPlugins(eBusmaster_Event::new_configuration_loading, nullptr);
 
         nRetValue = nLoadXMLConfiguration();
@@ -10158,6 +10279,7 @@ int CMainFrame::nLoadXMLConfiguration(std::string& m_strCfxFile)
 
         mPluginManager->notifyPlugins(eBusmaster_Event::new_configuration_loaded, nullptr);
 
+        xmlUtils::vFreeDocIndex(m_xmlConfigFiledoc);
         xmlFreeDoc(m_xmlConfigFiledoc);
         m_xmlConfigFiledoc = nullptr;
     }
@@ -11670,8 +11792,17 @@ int CMainFrame::nLoadXMLConfiguration()
     xmlNodeSetPtr pNodeSet;
     xmlXPathObjectPtr pPathObject;
 
+    LARGE_INTEGER sFrequency, sLoadStart, sSectionStart, sSectionEnd;
+    double adSectionTimeMs[SECTION_TOTAL];
+    QueryPerformanceFrequency(&sFrequency);
+    QueryPerformanceCounter(&sLoadStart);
+
+    //Runs on a worker while the CAN databases and bus statistics load
+    vStartJ1939DbPreload();
+
     for (eSECTION_ID eSecId = DATABASE_SECTION_ID; eSecId < SECTION_TOTAL;)
     {
+        QueryPerformanceCounter(&sSectionStart);
         switch(eSecId)
         {
             case MAINFRAME_SECTION_ID:
@@ -11736,6 +11867,7 @@ int CMainFrame::nLoadXMLConfiguration()
 
                     if(nullptr != pNodeSet)
                     {
+                        std::list<std::string> ouDbPaths;
                         for(int i=0; i < pNodeSet->nodeNr; i++)
                         {
                             if (  nullptr != pNodeSet->nodeTab[i]->xmlChildrenNode )
@@ -11743,11 +11875,27 @@ int CMainFrame::nLoadXMLConfiguration()
                                 xmlChar* ptext = xmlNodeListGetString(m_xmlConfigFiledoc, pNodeSet->nodeTab[i]->xmlChildrenNode, 1);
                                 if ( ( nullptr != ptext ) && ( theApp.m_pouMsgSignal != nullptr ) )
                                 {
-                                    dLoadDataBaseFile(ptext, TRUE);
+                                    CString omStrDbPath = ptext;
+                                    vGetAbsoluteDbPath( omStrDbPath );
+                                    ouDbPaths.push_back( (LPCSTR)omStrDbPath );
+                                }
+                                if ( nullptr != ptext )
+                                {
                                     xmlFree(ptext);
                                 }
                             }
                         }
+
+                        //Parse or load the compiled images of all databases up front, in parallel
+                        DbLoadReport ouReport;
+                        m_ouBusmasterNetwork->SetChannelCount( CAN, 1 );
+                        m_ouBusmasterNetwork->PreloadDbFiles( CAN, ouDbPaths, ouReport );
+                        vWriteDbLoadReport( "CAN", ouReport );
+
+                        for ( auto itr = ouDbPaths.begin(); itr != ouDbPaths.end(); ++itr )
+                        {
+                            dLoadDataBaseFile( itr->c_str(), TRUE );
+                        }
                     }
                     else
                     {
@@ -11769,7 +11917,11 @@ int CMainFrame::nLoadXMLConfiguration()
                     m_pouMsgSigJ1939 = new CMsgSignal(sg_asDbParams[J1939], FALSE);
                 }
 
-                vClearDbInfo(J1939);
+                //The preload cleared them before it started
+                if ( false == bWaitForJ1939DbPreload() )
+                {
+                    vClearDbInfo(J1939);
+                }
 
                 CStringArray omDBNames;
                 xmlChar* pchPath = (xmlChar*)"//BUSMASTER_CONFIGURATION/Module_Configuration/J1939_Database_Files/FilePath";
@@ -13137,8 +13289,21 @@ int CMainFrame::nLoadXMLConfiguration()
             }
 
         } //switch(eSecId)
+        QueryPerformanceCounter(&sSectionEnd);
+        adSectionTimeMs[eSecId] = (sSectionEnd.QuadPart - sSectionStart.QuadPart) * 1000.0 / sFrequency.QuadPart;
         eSecId = static_cast<eSECTION_ID>(eSecId + 1);
     }//for
+    bWaitForJ1939DbPreload();
+
+    QueryPerformanceCounter(&sSectionEnd);
+    CString omStrReport;
+    omStrReport.Format("Configuration loaded in %.1f ms", (sSectionEnd.QuadPart - sLoadStart.QuadPart) * 1000.0 / sFrequency.QuadPart);
+    theApp.bWriteIntoTraceWnd(omStrReport.GetBuffer(0));
+    for (int i = 0; i < SECTION_TOTAL; i++)
+    {
+        omStrReport.Format("    %s : %.1f ms", SectionLoadName[i], adSectionTimeMs[i]);
+        theApp.bWriteIntoTraceWnd(omStrReport.GetBuffer(0));
+    }
     nRetValue = S_OK;
     return nRetValue;
 }
@@ -14607,6 +14772,8 @@ void CMainFrame::vInitializeBusStatCAN(void)
 #else
         GetICANBusStat()->BSC_SetBaudRate(i, _tstof(m_asControllerDetails[i].m_omStrBaudrate.c_str()));
 #endif
+        GetICANBusStat()->BSC_SetDataBaudRate(i, m_asControllerDetails[i].m_bcanFDEnabled ?
+                                              m_asControllerDetails[i].m_unDataBitRate : 0);
     }
 }
 
@@ -16514,6 +16681,36 @@ void CMainFrame::vLoadBusmasterKernel()
     mBusmasterKernel->getDatabaseService( &m_ouBusmasterNetwork );
     //return S_OK;
 }
+
+/**
+ * \brief Switches the BUSMASTER clock for a CAN connection
+ * \param[in] bConnect true before the CAN hardware is started, false once it is stopped
+ *
+ * With /virtualtime the node simulation timers, the transmit window, replay and the
+ * test executor run in virtual time while the simulated CAN bus is connected.
+ */
+void CMainFrame::vSetVirtualTime(bool bConnect)
+{
+    IClockService* pouClock = nullptr;
+    if (theApp.m_bVirtualTime == FALSE || nullptr == mBusmasterKernel
+            || mBusmasterKernel->getClockService( &pouClock ) != S_OK)
+    {
+        return;
+    }
+    if (false == bConnect)
+    {
+        pouClock->hSetVirtual(false, 0);
+    }
+    else if (m_dwDriverId == DRIVER_CAN_STUB)
+    {
+        pouClock->hSetVirtual(true, theApp.m_unVirtualTimeSettleMs);
+        theApp.bWriteIntoTraceWnd(_("Running the simulated CAN bus in virtual time"));
+    }
+    else
+    {
+        theApp.bWriteIntoTraceWnd(_("Virtual time is only available on the simulated CAN bus"));
+    }
+}
 int CMainFrame::getDilService( ETYPE_BUS bus, IBusService** busService )
 {
     return mBusmasterKernel->getBusService( bus, busService );
@@ -291,6 +291,7 @@ public:
     DWORD dLoadJ1939DBFile(CString omStrActiveDataBase, bool bFrmCom);
     // To load specified configuration File
     DWORD dLoadDataBaseFile(CString omStrActiveDataBase, bool bFrmCom);
+    void vGetAbsoluteDbPath(CString& omStrDbPath);
     
     // To get Dll path of recent compiled file
     CString omGetDllName();
@@ -716,6 +717,14 @@ private:
     BOOL m_abLogOnConnect[BUS_TOTAL];
 
     xmlNodePtr m_pXmlNodeBusStats;
+    // J1939 databases are preloaded while the sections before them load
+    HANDLE m_hJ1939DbPreload;
+    std::list<std::string> m_ouJ1939PreloadPaths;
+    DbLoadReport m_ouJ1939PreloadReport;
+    void vStartJ1939DbPreload(void);
+    bool bWaitForJ1939DbPreload(void);
+    static DWORD WINAPI J1939DbPreloadThread(LPVOID pVoid);
+    void vWriteDbLoadReport(const char* pchBus, DbLoadReport& ouReport);
     void vSetGlobalConfiguration(xmlNodePtr& pNodePtr);
     void vSW_DoInitialization(ETYPE_BUS eBusType);
     void OnClusterChanged(ETYPE_BUS eBusType);
@@ -809,6 +818,7 @@ public:
 
 
     afx_msg void OnStatisticsCAN();
+    afx_msg void OnMsgIdProfileCAN();
     afx_msg void OnStatisticsLIN();
     
     afx_msg void OnStatistics(ETYPE_BUS ebus);
@@ -895,6 +905,7 @@ public:
 
 private:
     void vLoadBusmasterKernel();
+    void vSetVirtualTime(bool bConnect);
 
     void vVlaidateAndLoadFibexConfig(sLinConfigContainer& ouFibexContainer);
 
@@ -22,6 +22,7 @@
 //
 
 #include "stdafx.h"
+#include <algorithm>
 #include "../DataTypes/Filter_Datatypes.h"
 #include "include/utils_macro.h"
 #include "common.h"
@@ -138,6 +139,7 @@ CMsgFrmtWnd::CMsgFrmtWnd(ETYPE_BUS eBusType, CMsgContainerBase* msgContainer, HW
     m_bSignalWatchON = FALSE;
     m_unDispUpdateTimerId = 0;
     m_bUpdate = FALSE;
+    m_bRepaintAll = FALSE;
     m_nField =-1;
     m_bAscending =true;
 
@@ -231,6 +233,9 @@ BEGIN_MESSAGE_MAP(CMsgFrmtWnd, CWnd)
     ON_COMMAND(IDM_MSGWND_RESET_COLUMNS, OnMsgwndResetColumns)
     ON_COMMAND(IDM_MESSAGE_SEND, OnSendSelectedMessageEntry)
     ON_COMMAND(IDM_MESSAGE_EXPAND, OnExpandSelectedMessageEntry)
+    ON_COMMAND(IDM_MESSAGE_SHOW_ONLY, OnShowOnlySelectedMessage)
+    ON_COMMAND(IDM_MESSAGE_SHOW_ALL, OnShowAllMessages)
+    ON_COMMAND(IDM_MESSAGE_FIND_NEXT, OnFindNextSelectedMessage)
     ON_COMMAND(IDM_MESSAGE_IMPORTLOGFILE, OnImportLogFile)
     ON_MESSAGE(WM_DATABASE_CHANGE, OnToggleInterpretStatusAllEntries)
 
@@ -972,7 +977,20 @@ void CMsgFrmtWnd::OnParentNotify(UINT message, LPARAM lParam)
                     }
                 }
 
-                //3. Send Message
+                //3. History query, only the append view keeps the history
+                SMSGHISTORYQUERY sQuery;
+                if (!IS_MODE_APPEND(m_bExprnFlag_Disp) || nIndex < 0 ||
+                        S_OK != m_pouMsgContainerIntrf->GetHistoryQueryAt(nIndex, sQuery))
+                {
+                    pomContextMenu->EnableMenuItem(IDM_MESSAGE_SHOW_ONLY, MF_DISABLED | MF_GRAYED);
+                    pomContextMenu->EnableMenuItem(IDM_MESSAGE_FIND_NEXT, MF_DISABLED | MF_GRAYED);
+                }
+                if (false == m_bHistoryQueryApplied)
+                {
+                    pomContextMenu->EnableMenuItem(IDM_MESSAGE_SHOW_ALL, MF_DISABLED | MF_GRAYED);
+                }
+
+                //4. Send Message
                 if( bConnected == FALSE )
                 {
                     pomContextMenu->EnableMenuItem( IDM_MESSAGE_SEND,
@@ -1061,6 +1079,79 @@ void CMsgFrmtWnd::OnExpandSelectedMessageEntry()
     }
 }
 
+/******************************************************************************
+ Function Name  : OnShowOnlySelectedMessage
+
+ Input(s)       : -
+ Output         : -
+ Functionality  : Shows only the kept frames with the identifier and channel
+                  of the selected frame. Frames received later are checked
+                  too.
+ Member of      : CMsgFrmtWnd
+******************************************************************************/
+void CMsgFrmtWnd::OnShowOnlySelectedMessage()
+{
+    POSITION Pos = m_lstMsg.GetFirstSelectedItemPosition();
+    if (Pos != nullptr)
+    {
+        int nItem = m_lstMsg.GetNextSelectedItem(Pos);
+        SMSGHISTORYQUERY sQuery;
+        if (S_OK == m_pouMsgContainerIntrf->GetHistoryQueryAt(nItem, sQuery))
+        {
+            m_pouMsgContainerIntrf->ApplyHistoryQuery(&sQuery);
+            m_bHistoryQueryApplied = true;
+            m_lstMsg.SetItemState(-1, 0, LVIS_SELECTED | LVIS_FOCUSED);
+        }
+    }
+}
+
+/******************************************************************************
+ Function Name  : OnShowAllMessages
+
+ Input(s)       : -
+ Output         : -
+ Functionality  : Removes the history query, all kept frames passing the
+                  filter are shown again.
+ Member of      : CMsgFrmtWnd
+******************************************************************************/
+void CMsgFrmtWnd::OnShowAllMessages()
+{
+    m_pouMsgContainerIntrf->ApplyHistoryQuery(nullptr);
+    m_bHistoryQueryApplied = false;
+    m_lstMsg.SetItemState(-1, 0, LVIS_SELECTED | LVIS_FOCUSED);
+}
+
+/******************************************************************************
+ Function Name  : OnFindNextSelectedMessage
+
+ Input(s)       : -
+ Output         : -
+ Functionality  : Selects the next shown frame with the identifier and
+                  channel of the selected frame, from the top after the
+                  last one.
+ Member of      : CMsgFrmtWnd
+******************************************************************************/
+void CMsgFrmtWnd::OnFindNextSelectedMessage()
+{
+    POSITION Pos = m_lstMsg.GetFirstSelectedItemPosition();
+    if (Pos != nullptr)
+    {
+        int nItem = m_lstMsg.GetNextSelectedItem(Pos);
+        SMSGHISTORYQUERY sQuery;
+        std::vector<int> ouIndices;
+        if (S_OK == m_pouMsgContainerIntrf->GetHistoryQueryAt(nItem, sQuery) &&
+                S_OK == m_pouMsgContainerIntrf->FindInHistory(sQuery, ouIndices) && false == ouIndices.empty())
+        {
+            //The indices are ascending
+            auto itrNext = std::upper_bound(ouIndices.begin(), ouIndices.end(), nItem);
+            int nNext = (ouIndices.end() != itrNext) ? *itrNext : ouIndices.front();
+            m_lstMsg.SetItemState(-1, 0, LVIS_SELECTED | LVIS_FOCUSED);
+            m_lstMsg.SetItemState(nNext, LVIS_SELECTED | LVIS_FOCUSED, LVIS_SELECTED | LVIS_FOCUSED);
+            m_lstMsg.EnsureVisible(nNext, FALSE);
+        }
+    }
+}
+
 
 /******************************************************************************
  Function Name  : OnImportLogFile
@@ -1186,10 +1277,52 @@ void CMsgFrmtWnd::OnTimer(UINT nIDEvent)
                 //item count in VFSE buffer
                 nBuffMsgCnt = m_omMgsIndexVec.size();
             }
+
+            //Repaint only the rows changed since the last tick
+            SMSGWNDCHANGES sChanges;
+            if (m_pouMsgContainerIntrf != nullptr)
+            {
+                m_pouMsgContainerIntrf->GetChangedRows(sChanges);
+            }
+            std::set<__int64> omChangedKeys(sChanges.m_ouChangedKeys.begin(), sChanges.m_ouChangedKeys.end());
+            int nPrevMsgCnt = m_lstMsg.GetItemCount();
+            BOOL bRepaintAll = (m_bRepaintAll == TRUE) || sChanges.m_bAllChanged || (nBuffMsgCnt < nPrevMsgCnt);
+            if (IS_MODE_APPEND(m_bExprnFlag_Disp) && nBuffMsgCnt == nPrevMsgCnt && !omChangedKeys.empty())
+            {
+                //A full circular buffer moves its rows
+                bRepaintAll = TRUE;
+            }
+
             m_lstMsg.SetItemCountEx(nBuffMsgCnt);
             //vDoInterpretation();
-            m_lstMsg.Invalidate(FALSE);
+            if (bRepaintAll == TRUE)
+            {
+                m_lstMsg.Invalidate(FALSE);
+            }
+            else
+            {
+                if (nBuffMsgCnt > nPrevMsgCnt)
+                {
+                    m_lstMsg.RedrawItems(nPrevMsgCnt, nBuffMsgCnt - 1);
+                }
+                if (!IS_MODE_APPEND(m_bExprnFlag_Disp) && !omChangedKeys.empty())
+                {
+                    //Only the visible rows are checked, the others are painted when scrolled in
+                    EnterCriticalSection(&m_ouCriticalSection);
+                    int nTopItem = m_lstMsg.GetTopIndex();
+                    int nEndItem = min(nTopItem + m_lstMsg.GetCountPerPage() + 1, (int)m_omMgsIndexVec.size());
+                    for (int nItem = max(nTopItem, 0); nItem < nEndItem; nItem++)
+                    {
+                        if (omChangedKeys.find(m_omMgsIndexVec[nItem]) != omChangedKeys.end())
+                        {
+                            m_lstMsg.RedrawItems(nItem, nItem);
+                        }
+                    }
+                    LeaveCriticalSection(&m_ouCriticalSection);
+                }
+            }
             m_bUpdate = FALSE;
+            m_bRepaintAll = FALSE;
 
             if( IS_MODE_APPEND(m_bExprnFlag_Disp) )
             {
@@ -1199,42 +1332,45 @@ void CMsgFrmtWnd::OnTimer(UINT nIDEvent)
                 m_lstMsg.EnsureVisible( nBuffMsgCnt-1, TRUE);
             }
 
-            //Update Message Interpretation Window.
+            //Update Message Interpretation Window when its message was received.
             if( m_podMsgIntprtnDlg->IsWindowVisible() )
             {
-                unsigned int msgId;
-                CString strName = "";
                 m_nIndex = nBuffMsgCnt-1;
-                SSignalInfoArray SigInfoArray;
-                vGetSignalInfoArray(m_unCurrInterpretedMapIndex, SigInfoArray);
-                bool bHex = IS_NUM_DEC_SET(m_bExprnFlag_Disp);
-                m_pouMsgContainerIntrf->GetMessageDetails(m_unCurrInterpretedMapIndex, msgId, strName, bHex);
-
-
-                int nCnt = SigInfoArray.GetSize();
-                SSignalInfo sTempSignal;
-                CStringArray arrSignals;
-                CStringArray arrSigRawValues;
-                CStringArray arrSigPhyValues;
-                CStringArray arrSigUnits;
-                for (int i = 0; i < nCnt; i++)
+                if (bRepaintAll == TRUE || omChangedKeys.find(m_unCurrInterpretedMapIndex) != omChangedKeys.end())
                 {
-                    sTempSignal = SigInfoArray.GetAt(i);
-                    arrSignals.Add(sTempSignal.m_omSigName);
-                    arrSigRawValues.Add(sTempSignal.m_omRawValue);
-                    arrSigPhyValues.Add(sTempSignal.m_omEnggValue);
-                    arrSigUnits.Add(sTempSignal.m_omUnit);
+                    unsigned int msgId;
+                    CString strName = "";
+                    SSignalInfoArray SigInfoArray;
+                    vGetSignalInfoArray(m_unCurrInterpretedMapIndex, SigInfoArray);
+                    bool bHex = IS_NUM_DEC_SET(m_bExprnFlag_Disp);
+                    m_pouMsgContainerIntrf->GetMessageDetails(m_unCurrInterpretedMapIndex, msgId, strName, bHex);
+
+
+                    int nCnt = SigInfoArray.GetSize();
+                    SSignalInfo sTempSignal;
+                    CStringArray arrSignals;
+                    CStringArray arrSigRawValues;
+                    CStringArray arrSigPhyValues;
+                    CStringArray arrSigUnits;
+                    for (int i = 0; i < nCnt; i++)
+                    {
+                        sTempSignal = SigInfoArray.GetAt(i);
+                        arrSignals.Add(sTempSignal.m_omSigName);
+                        arrSigRawValues.Add(sTempSignal.m_omRawValue);
+                        arrSigPhyValues.Add(sTempSignal.m_omEnggValue);
+                        arrSigUnits.Add(sTempSignal.m_omUnit);
+                    }
+                    m_podMsgIntprtnDlg->vUpdateMessageData(m_unCurrInterpretedMsgID
+                                                           ,strName,arrSignals,arrSigRawValues,arrSigPhyValues,
+                                                           arrSigUnits, IS_NUM_HEX_SET(m_bExprnFlag_Disp));
                 }
-                m_podMsgIntprtnDlg->vUpdateMessageData(m_unCurrInterpretedMsgID
-                                                       ,strName,arrSignals,arrSigRawValues,arrSigPhyValues,
-                                                       arrSigUnits, IS_NUM_HEX_SET(m_bExprnFlag_Disp));
             }
 
             //Update Signal Tree items.
             EnterCriticalSection(&m_CritSec1);
             if(IS_MODE_INTRP(m_bExprnFlag_Disp))
             {
-                vUpdateAllTreeWnd();
+                vUpdateAllTreeWnd((bRepaintAll == TRUE) ? nullptr : &omChangedKeys);
             }
             LeaveCriticalSection(&m_CritSec1);
         }
@@ -2293,6 +2429,10 @@ LRESULT CMsgFrmtWnd::ModifyMsgWndProperty(WPARAM wParam, LPARAM lParam)
         }
     }
     m_bUpdate = bToUpdate;
+    if (bToUpdate == TRUE)
+    {
+        m_bRepaintAll = TRUE;
+    }
     vUpdatePtrInLstCtrl();
     LeaveCriticalSection(&m_CritSec1);
 
@@ -2838,13 +2978,14 @@ void CMsgFrmtWnd::vArrangeAllTreeWnd()
   Function Name  : vUpdateAllTreeWnd
   Input(s)       : -
   Output         : -
-  Functionality  : Updates the signal data for all the messages.
+  Functionality  : Updates the signal data for all the messages, or only for
+                   the given ones. The tree positions are always updated.
   Member of      : CMsgFrmtWnd
   Author(s)      : Arunkumar K
   Date Created   : 07-09-2010
-  Modifications  :
+  Modifications  : Signal values are only formatted for changed messages
 *******************************************************************************/
-void CMsgFrmtWnd::vUpdateAllTreeWnd()
+void CMsgFrmtWnd::vUpdateAllTreeWnd(const std::set<__int64>* pomChangedKeys)
 {
     // Variable to keep entry details
     SMSGDISPMAPENTRY sTemp;
@@ -2860,27 +3001,32 @@ void CMsgFrmtWnd::vUpdateAllTreeWnd()
         {
             if (sTemp.m_opTreeWndParam != nullptr)
             {
-                COLORREF rgbTreeItem = RGB(0,0,0);
-                if (n64Temp != nInvalidKey)
-                {
-                    rgbTreeItem = m_pouMsgContainerIntrf->getMessageColor(n64Temp, true, &m_ouMsgAttr);
-                }
-                else
+                int nSignalCnt = sTemp.m_nSignalCnt;
+                if (pomChangedKeys == nullptr || pomChangedKeys->find(n64Temp) != pomChangedKeys->end())
                 {
-                    rgbTreeItem = RGB(0,0,0);
-                }
+                    SSignalInfoArray SigInfoArray;
+                    vGetSignalInfoArray(n64Temp, SigInfoArray);
+                    nSignalCnt = SigInfoArray.GetSize();
 
-                SSignalInfoArray SigInfoArray;
-                vGetSignalInfoArray(n64Temp, SigInfoArray);
+                    COLORREF rgbTreeItem = RGB(0,0,0);
+                    if (n64Temp != nInvalidKey)
+                    {
+                        rgbTreeItem = m_pouMsgContainerIntrf->getMessageColor(n64Temp, true, &m_ouMsgAttr);
+                    }
+                    else
+                    {
+                        rgbTreeItem = RGB(0,0,0);
+                    }
 
-                //Get the signal info in Formatted strings array
-                CStringArray omSigStrArray;
-                vFormatSignalInfo (SigInfoArray, omSigStrArray);
-                // String to format interpretted data
+                    //Get the signal info in Formatted strings array
+                    CStringArray omSigStrArray;
+                    vFormatSignalInfo (SigInfoArray, omSigStrArray);
+                    // String to format interpretted data
 
-                sTemp.m_opTreeWndParam->vUpdateTreeValues(omSigStrArray, rgbTreeItem);
+                    sTemp.m_opTreeWndParam->vUpdateTreeValues(omSigStrArray, rgbTreeItem);
+                }
                 CRect omTreeRect;
-                vGetTreeRect(i, SigInfoArray.GetSize(), omTreeRect);
+                vGetTreeRect(i, nSignalCnt, omTreeRect);
 
                 sTemp.m_opTreeWndParam->vUpdateTreeItemRect(omTreeRect);
             }
@@ -102,6 +102,7 @@ private:
 
     CMessageAttrib& m_ouMsgAttr;
     CMsgContainerBase* m_pouMsgContainerIntrf = nullptr;
+    bool m_bHistoryQueryApplied = false;    //Only frames like a selected one are shown
 
     IBMNetWorkGetService* m_pBmNetWork;
 
@@ -142,7 +143,7 @@ private:
     int m_nIndex;
     void vShowUpdateMsgIntrpDlg(__int64 nMapIndex);
     void vUpdateMsgTreeWnd(__int64 nMapIndex);
-    void vUpdateAllTreeWnd();
+    void vUpdateAllTreeWnd(const std::set<__int64>* pomChangedKeys = nullptr);
     void vSetDefaultPlacement();
     void CmdRouteMenu(CWnd* pWnd,CMenu* pPopupMenu);
     void UnloadFile(bool bFileUnload);
@@ -188,6 +189,8 @@ protected:
     //Array of SMSGDISPMAPENTRY on overwrite display
     std::vector<__int64> m_omMgsIndexVec;
     BOOL m_bUpdate;
+    //Display settings changed, every visible row has to be repainted
+    BOOL m_bRepaintAll;
 
     HWND m_hMainWnd;
     //BOOL m_bLogON;
@@ -227,6 +230,9 @@ public:
     afx_msg void OnEditClearAll();
     afx_msg void OnSendSelectedMessageEntry();
     afx_msg void OnExpandSelectedMessageEntry();
+    afx_msg void OnShowOnlySelectedMessage();
+    afx_msg void OnShowAllMessages();
+    afx_msg void OnFindNextSelectedMessage();
 
 
     afx_msg void OnImportLogFile();
@@ -0,0 +1,247 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      MsgIdProfileDlg.cpp
+ * \brief     Implementation of the CAN message identifier profile dialog
+ * \copyright Copyright (c) 2011, Robert Bosch Engineering and Business Solutions. All rights reserved.
+ *
+ * Implementation of the CAN message identifier profile dialog
+ */
+#include "stdafx.h"
+#include "BUSMASTER.h"
+#include "MsgIdProfileDlg.h"
+#include <algorithm>
+#include <map>
+
+#define defMSGID_PROFILE_TIMER      1
+#define defMSGID_PROFILE_PERIOD     1000
+
+/* Columns of the profile list */
+enum eMSGID_PROFILE_COLUMN
+{
+    COL_CHANNEL = 0,
+    COL_ID,
+    COL_COUNT,
+    COL_RATE_1S,
+    COL_RATE_10S,
+    COL_MIN_CYCLE,
+    COL_AVG_CYCLE,
+    COL_MAX_CYCLE,
+    COL_JITTER,
+    COL_LATE,
+    COL_DLC,
+    COL_DATA_CHANGES
+};
+
+static bool bProfileLess(const SMSGIDPROFILE& sLeft, const SMSGIDPROFILE& sRight)
+{
+    if (sLeft.m_unChannelIndex != sRight.m_unChannelIndex)
+    {
+        return sLeft.m_unChannelIndex < sRight.m_unChannelIndex;
+    }
+    if (sLeft.m_bExtended != sRight.m_bExtended)
+    {
+        return sRight.m_bExtended;
+    }
+    return sLeft.m_unMsgID < sRight.m_unMsgID;
+}
+
+static UINT unRateKey(UINT unMsgID, bool bExtended)
+{
+    return (bExtended ? 0x80000000 : 0) | unMsgID;
+}
+
+IMPLEMENT_DYNAMIC(CMsgIdProfileDlg, CDialog)
+
+CMsgIdProfileDlg::CMsgIdProfileDlg(CBaseBusStatisticCAN* pouBSCAN, int nChannelCount, CWnd* pParent)
+    : CDialog(CMsgIdProfileDlg::IDD, pParent),
+      m_pouBSCAN(pouBSCAN),
+      m_nChannelCount(nChannelCount),
+      m_nTimerID(0)
+{
+}
+
+CMsgIdProfileDlg::~CMsgIdProfileDlg()
+{
+}
+
+void CMsgIdProfileDlg::DoDataExchange(CDataExchange* pDX)
+{
+    CDialog::DoDataExchange(pDX);
+    DDX_Control(pDX, IDC_LST_MSGID_PROFILE, m_omProfileList);
+}
+
+BEGIN_MESSAGE_MAP(CMsgIdProfileDlg, CDialog)
+    ON_BN_CLICKED(IDC_BTN_EXPORT_MSGID_PROFILE, OnBnClickedExport)
+    ON_WM_TIMER()
+    ON_WM_DESTROY()
+END_MESSAGE_MAP()
+
+/**
+ * Creates the list columns, fills the list and starts the refresh timer.
+ */
+BOOL CMsgIdProfileDlg::OnInitDialog()
+{
+    CDialog::OnInitDialog();
+
+    m_omProfileList.SetExtendedStyle(LVS_EX_FULLROWSELECT | LVS_EX_GRIDLINES);
+    m_omProfileList.InsertColumn(COL_CHANNEL, _("Channel"), LVCFMT_LEFT, 55);
+    m_omProfileList.InsertColumn(COL_ID, _("ID"), LVCFMT_LEFT, 80);
+    m_omProfileList.InsertColumn(COL_COUNT, _("Count"), LVCFMT_RIGHT, 70);
+    m_omProfileList.InsertColumn(COL_RATE_1S, _("Msg/s 1 s"), LVCFMT_RIGHT, 65);
+    m_omProfileList.InsertColumn(COL_RATE_10S, _("Msg/s 10 s"), LVCFMT_RIGHT, 70);
+    m_omProfileList.InsertColumn(COL_MIN_CYCLE, _("Min Cycle [ms]"), LVCFMT_RIGHT, 85);
+    m_omProfileList.InsertColumn(COL_AVG_CYCLE, _("Avg Cycle [ms]"), LVCFMT_RIGHT, 85);
+    m_omProfileList.InsertColumn(COL_MAX_CYCLE, _("Max Cycle [ms]"), LVCFMT_RIGHT, 85);
+    m_omProfileList.InsertColumn(COL_JITTER, _("Jitter [ms]"), LVCFMT_RIGHT, 70);
+    m_omProfileList.InsertColumn(COL_LATE, _("Late"), LVCFMT_RIGHT, 50);
+    m_omProfileList.InsertColumn(COL_DLC, _("DLC"), LVCFMT_RIGHT, 40);
+    m_omProfileList.InsertColumn(COL_DATA_CHANGES, _("Data Changes"), LVCFMT_RIGHT, 80);
+
+    vUpdateList();
+    m_nTimerID = SetTimer(defMSGID_PROFILE_TIMER, defMSGID_PROFILE_PERIOD, nullptr);
+    return TRUE;
+}
+
+/**
+ * Refills the list with the profile sorted by channel and identifier,
+ * together with the identifier rates of the channel. Rows are updated in
+ * place so the selection and scroll position stay.
+ */
+void CMsgIdProfileDlg::vUpdateList(void)
+{
+    if (nullptr == m_pouBSCAN)
+    {
+        return;
+    }
+    std::vector<SMSGIDPROFILE> ouProfiles;
+    m_pouBSCAN->BSC_GetMsgIdProfile(ouProfiles);
+    std::sort(ouProfiles.begin(), ouProfiles.end(), bProfileLess);
+
+    std::vector< std::map<UINT, SMSGIDRATE> > ouRates(m_nChannelCount);
+    std::vector<SMSGIDRATE> ouIdRates;
+    for (int nChannel = 0; nChannel < m_nChannelCount; nChannel++)
+    {
+        m_pouBSCAN->BSC_GetMsgIdRates(nChannel, ouIdRates);
+        for (size_t nIndex = 0; nIndex < ouIdRates.size(); nIndex++)
+        {
+            ouRates[nChannel][unRateKey(ouIdRates[nIndex].m_unMsgID, ouIdRates[nIndex].m_bExtended)] = ouIdRates[nIndex];
+        }
+    }
+
+    m_omProfileList.SetRedraw(FALSE);
+    int nRow = 0;
+    CString omText;
+    for (size_t nIndex = 0; nIndex < ouProfiles.size(); nIndex++)
+    {
+        const SMSGIDPROFILE& sProfile = ouProfiles[nIndex];
+        if ((int)sProfile.m_unChannelIndex >= m_nChannelCount)
+        {
+            continue;
+        }
+        omText.Format("%u", sProfile.m_unChannelIndex + 1);
+        if (nRow >= m_omProfileList.GetItemCount())
+        {
+            m_omProfileList.InsertItem(nRow, omText);
+        }
+        else
+        {
+            m_omProfileList.SetItemText(nRow, COL_CHANNEL, omText);
+        }
+        omText.Format(sProfile.m_bExtended ? "0x%08X x" : "0x%03X", sProfile.m_unMsgID);
+        m_omProfileList.SetItemText(nRow, COL_ID, omText);
+        omText.Format("%u", sProfile.m_unMsgCount);
+        m_omProfileList.SetItemText(nRow, COL_COUNT, omText);
+
+        double dRate1s = 0, dRate10s = 0;
+        const std::map<UINT, SMSGIDRATE>& ouChannelRates = ouRates[sProfile.m_unChannelIndex];
+        std::map<UINT, SMSGIDRATE>::const_iterator itRate =
+            ouChannelRates.find(unRateKey(sProfile.m_unMsgID, sProfile.m_bExtended));
+        if (itRate != ouChannelRates.end())
+        {
+            dRate1s = itRate->second.m_dRate1s;
+            dRate10s = itRate->second.m_dRate10s;
+        }
+        omText.Format("%.1f", dRate1s);
+        m_omProfileList.SetItemText(nRow, COL_RATE_1S, omText);
+        omText.Format("%.1f", dRate10s);
+        m_omProfileList.SetItemText(nRow, COL_RATE_10S, omText);
+        omText.Format("%.1f", sProfile.m_dMinCycle);
+        m_omProfileList.SetItemText(nRow, COL_MIN_CYCLE, omText);
+        omText.Format("%.3f", sProfile.m_dAvgCycle);
+        m_omProfileList.SetItemText(nRow, COL_AVG_CYCLE, omText);
+        omText.Format("%.1f", sProfile.m_dMaxCycle);
+        m_omProfileList.SetItemText(nRow, COL_MAX_CYCLE, omText);
+        omText.Format("%.3f", sProfile.m_dJitter);
+        m_omProfileList.SetItemText(nRow, COL_JITTER, omText);
+        omText.Format("%u", sProfile.m_unLateCount);
+        m_omProfileList.SetItemText(nRow, COL_LATE, omText);
+        omText.Format("%u", sProfile.m_unLastDLC);
+        m_omProfileList.SetItemText(nRow, COL_DLC, omText);
+        omText.Format("%u", sProfile.m_unDataChanges);
+        m_omProfileList.SetItemText(nRow, COL_DATA_CHANGES, omText);
+        nRow++;
+    }
+    while (m_omProfileList.GetItemCount() > nRow)
+    {
+        m_omProfileList.DeleteItem(m_omProfileList.GetItemCount() - 1);
+    }
+    m_omProfileList.SetRedraw(TRUE);
+}
+
+void CMsgIdProfileDlg::OnTimer(UINT_PTR nIDEvent)
+{
+    if (defMSGID_PROFILE_TIMER == nIDEvent)
+    {
+        vUpdateList();
+    }
+    CDialog::OnTimer(nIDEvent);
+}
+
+void CMsgIdProfileDlg::OnDestroy()
+{
+    if (0 != m_nTimerID)
+    {
+        KillTimer(m_nTimerID);
+        m_nTimerID = 0;
+    }
+    CDialog::OnDestroy();
+}
+
+/**
+ * Asks for a file and writes the profile as CSV or JSON, depending on the
+ * extension chosen.
+ */
+void CMsgIdProfileDlg::OnBnClickedExport()
+{
+    CFileDialog fileDlg( FALSE,     // Save File dialog
+                         "csv",     // Default Extension,
+                         "MsgIdProfile.csv",
+                         OFN_HIDEREADONLY | OFN_OVERWRITEPROMPT,
+                         _("CSV File(*.csv)|*.csv|JSON File(*.json)|*.json||"),
+                         this );
+    fileDlg.m_ofn.lpstrTitle = _("Export Message ID Profile");
+
+    if ( IDOK == fileDlg.DoModal() )
+    {
+        eBS_EXPORT_FORMAT eFormat = (0 == fileDlg.GetFileExt().CompareNoCase("json")) ? BS_EXPORT_JSON : BS_EXPORT_CSV;
+        std::string strFileName = (LPCSTR)fileDlg.GetPathName();
+        if (S_OK != m_pouBSCAN->BSC_ExportMsgIdProfile(strFileName, eFormat))
+        {
+            AfxMessageBox(_("The message ID profile could not be written."), MB_OK | MB_ICONERROR);
+        }
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      MsgIdProfileDlg.h
+ * \brief     Definition of the CAN message identifier profile dialog
+ * \copyright Copyright (c) 2011, Robert Bosch Engineering and Business Solutions. All rights reserved.
+ *
+ * Shows the rates and timing profile of every CAN identifier and exports
+ * the profile to CSV or JSON.
+ */
+#pragma once
+
+#include "BaseBusStatisticCAN.h"
+
+class CMsgIdProfileDlg : public CDialog
+{
+    DECLARE_DYNAMIC(CMsgIdProfileDlg)
+    enum { IDD = IDD_DLG_MSGID_PROFILE };
+
+    CBaseBusStatisticCAN* m_pouBSCAN;
+    int m_nChannelCount;
+    UINT_PTR m_nTimerID;
+
+public:
+    CMsgIdProfileDlg(CBaseBusStatisticCAN* pouBSCAN, int nChannelCount, CWnd* pParent = nullptr);
+    virtual ~CMsgIdProfileDlg();
+
+protected:
+    virtual void DoDataExchange(CDataExchange* pDX);    // DDX/DDV support
+    //Refills the list from the bus statistics
+    void vUpdateList(void);
+
+    DECLARE_MESSAGE_MAP()
+
+public:
+    CListCtrl m_omProfileList;
+    virtual BOOL OnInitDialog();
+    afx_msg void OnTimer(UINT_PTR nIDEvent);
+    afx_msg void OnDestroy();
+    afx_msg void OnBnClickedExport();
+};
@@ -0,0 +1,460 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      MsgIdProfiler.cpp
+ * \brief     CMsgIdProfiler implementation.
+ */
+#include "StdAfx.h"
+#include <math.h>
+#include "MsgIdProfiler.h"
+
+/**
+ * Constructor, the table is created for the minimum size.
+ */
+CMsgIdProfiler::CMsgIdProfiler(void)
+{
+    InitializeCriticalSection(&m_omCritSec);
+    m_lResetPending = 0;
+    m_lExpectedIds = 0;
+    m_psTable = psCreateTable(defPROFILE_MIN_SLOTS / 2);
+}
+
+CMsgIdProfiler::~CMsgIdProfiler(void)
+{
+    vDeleteTable(m_psTable);
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+/**
+ * \param[in] unMinEntries number of entries to be held at half load
+ *
+ * Creates an empty table, the size is the next power of 2 holding twice
+ * the requested entries.
+ */
+CMsgIdProfiler::sTABLE* CMsgIdProfiler::psCreateTable(UINT unMinEntries)
+{
+    sTABLE* psTable = new sTABLE;
+    psTable->m_unCapacity = defPROFILE_MIN_SLOTS;
+    psTable->m_unShift = 32;
+    for (UINT unCapacity = psTable->m_unCapacity; unCapacity > 1; unCapacity >>= 1)
+    {
+        psTable->m_unShift--;
+    }
+    while (psTable->m_unCapacity < unMinEntries * 2 && psTable->m_unCapacity < defPROFILE_MAX_SLOTS)
+    {
+        psTable->m_unCapacity <<= 1;
+        psTable->m_unShift--;
+    }
+    psTable->m_unUsed = 0;
+    psTable->m_psEntries = static_cast<sENTRY*>(_aligned_malloc(sizeof(sENTRY) * psTable->m_unCapacity, 64));
+    memset(psTable->m_psEntries, 0, sizeof(sENTRY) * psTable->m_unCapacity);
+    return psTable;
+}
+
+void CMsgIdProfiler::vDeleteTable(sTABLE* psTable)
+{
+    if (nullptr != psTable)
+    {
+        _aligned_free(psTable->m_psEntries);
+        delete psTable;
+    }
+}
+
+/**
+ * \param[in] psTable table to search
+ * \param[in] unChannelIndex channel index
+ * \param[in] unKey identifier key
+ * \param[in] unMaxProbes number of entries to search
+ * \return Entry of the key or the free entry it is to be stored in,
+ *         nullptr if neither is found within unMaxProbes entries
+ *
+ * Linear probing from the multiplicative hash of the key. The table is
+ * never more than half full so a search of the whole table always finds
+ * a free entry.
+ */
+CMsgIdProfiler::sENTRY* CMsgIdProfiler::psFindEntry(sTABLE* psTable, UINT unChannelIndex, UINT unKey, UINT unMaxProbes)
+{
+    UINT unMask = psTable->m_unCapacity - 1;
+    UINT unSlot = ((unKey ^ (unChannelIndex << 24)) * 2654435761U) >> psTable->m_unShift;
+    for (UINT unProbe = 0; unProbe < unMaxProbes; unProbe++)
+    {
+        sENTRY* psEntry = &psTable->m_psEntries[unSlot & unMask];
+        if (0 == psEntry->m_unKey || (unKey == psEntry->m_unKey && unChannelIndex == psEntry->m_unChannelIndex))
+        {
+            return psEntry;
+        }
+        unSlot++;
+    }
+    return nullptr;
+}
+
+/**
+ * \param[in] psTable table taking the place of the current one
+ *
+ * Publishes a new table and frees the old one. Readers copy under the same
+ * lock and the writer is the caller, so the old table is no longer in use.
+ */
+void CMsgIdProfiler::vReplaceTable(sTABLE* psTable)
+{
+    EnterCriticalSection(&m_omCritSec);
+    sTABLE* psOldTable = m_psTable;
+    m_psTable = psTable;
+    LeaveCriticalSection(&m_omCritSec);
+    vDeleteTable(psOldTable);
+}
+
+/**
+ * Doubles the table. Only the writer changes the entries, they are copied
+ * without checking the sequence numbers. The copy is made under the lock
+ * so that no count sample of the timer is lost.
+ */
+void CMsgIdProfiler::vGrowTable(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    sTABLE* psOldTable = m_psTable;
+    sTABLE* psTable = psCreateTable(psOldTable->m_unCapacity);
+    for (UINT unSlot = 0; unSlot < psOldTable->m_unCapacity; unSlot++)
+    {
+        const sENTRY& sOld = psOldTable->m_psEntries[unSlot];
+        if (0 != sOld.m_unKey)
+        {
+            sENTRY* psEntry = psFindEntry(psTable, sOld.m_unChannelIndex, sOld.m_unKey, psTable->m_unCapacity);
+            memcpy(psEntry, &sOld, sizeof(sENTRY));
+            psEntry->m_lSequence = 0;
+            psTable->m_unUsed++;
+        }
+    }
+    m_psTable = psTable;
+    LeaveCriticalSection(&m_omCritSec);
+    vDeleteTable(psOldTable);
+}
+
+/**
+ * \param[in] unExpectedIds number of (channel, identifier) pairs expected,
+ *            usually the database messages times the channels
+ *
+ * Takes effect with the next reset. Identifiers beyond the expected
+ * number grow the table, so the size only avoids resizing while measuring.
+ */
+void CMsgIdProfiler::vSetExpectedIds(UINT unExpectedIds)
+{
+    InterlockedExchange(&m_lExpectedIds, (LONG)min(unExpectedIds, (UINT)(defPROFILE_MAX_SLOTS / 2)));
+}
+
+/**
+ * Requests a reset. The writer replaces the table on its next frame,
+ * snapshots taken in the meantime are empty.
+ */
+void CMsgIdProfiler::vReset(void)
+{
+    InterlockedExchange(&m_lResetPending, 1);
+}
+
+/**
+ * \param[in] unChannelIndex channel index
+ * \param[in] unMsgID 11/29 bit identifier
+ * \param[in] bExtended true for 29 bit identifiers
+ * \param[in] ucDataLen data length in bytes
+ * \param[in] pucData message data, nullptr for remote frames
+ * \param[in] llTimeStamp time stamp in 100 micro seconds
+ * \return false if the identifier is new and has no room in the table
+ *
+ * Updates the entry of the identifier. Must be called from one thread,
+ * no lock is taken unless the table is reset or resized. A new identifier
+ * grows a half full table or one without a free entry within
+ * defPROFILE_MAX_PROBES, up to defPROFILE_MAX_SLOTS.
+ */
+bool CMsgIdProfiler::bAddFrame(UINT unChannelIndex, UINT unMsgID, bool bExtended, UCHAR ucDataLen,
+                               const UCHAR* pucData, LONGLONG llTimeStamp)
+{
+    if (0 != m_lResetPending)
+    {
+        vReplaceTable(psCreateTable((UINT)m_lExpectedIds));
+        InterlockedExchange(&m_lResetPending, 0);
+    }
+
+    UINT unKey = 0x80000000 | (bExtended ? 0x40000000 : 0) | (unMsgID & 0x1FFFFFFF);
+    sENTRY* psEntry = psFindEntry(m_psTable, unChannelIndex, unKey, defPROFILE_MAX_PROBES);
+    if (nullptr == psEntry || (0 == psEntry->m_unKey && m_psTable->m_unUsed * 2 >= m_psTable->m_unCapacity))
+    {
+        if (m_psTable->m_unCapacity >= defPROFILE_MAX_SLOTS)
+        {
+            return false;
+        }
+        vGrowTable();
+        psEntry = psFindEntry(m_psTable, unChannelIndex, unKey, defPROFILE_MAX_PROBES);
+        if (nullptr == psEntry)
+        {
+            return false;
+        }
+    }
+    int nDataLen = (nullptr == pucData) ? 0 : min((int)ucDataLen, defPROFILE_MAX_DATA_LEN);
+
+    InterlockedIncrement(&psEntry->m_lSequence);
+    if (0 == psEntry->m_unKey)
+    {
+        psEntry->m_unChannelIndex = unChannelIndex;
+        psEntry->m_unMsgCount = 1;
+        psEntry->m_ucDataLen = ucDataLen;
+        psEntry->m_llFirstTime = llTimeStamp;
+        psEntry->m_llLastTime = llTimeStamp;
+        if (nDataLen > 0)
+        {
+            memcpy(psEntry->m_aucData, pucData, nDataLen);
+        }
+        psEntry->m_unKey = unKey;
+        m_psTable->m_unUsed++;
+    }
+    else
+    {
+        LONGLONG llCycle = llTimeStamp - psEntry->m_llLastTime;
+        UINT unCycles = psEntry->m_unMsgCount;  //Cycles including this one
+        if (1 == unCycles || llCycle < psEntry->m_llMinCycle)
+        {
+            psEntry->m_llMinCycle = llCycle;
+        }
+        if (1 == unCycles || llCycle > psEntry->m_llMaxCycle)
+        {
+            psEntry->m_llMaxCycle = llCycle;
+        }
+        if (unCycles > 1)
+        {
+            double dDeviation = fabs((double)llCycle - psEntry->m_dMeanCycle);
+            if (dDeviation > psEntry->m_dMaxDeviation)
+            {
+                psEntry->m_dMaxDeviation = dDeviation;
+            }
+            if ((double)llCycle * 2 > psEntry->m_dMeanCycle * 3)
+            {
+                psEntry->m_unLateCount++;
+            }
+        }
+        double dDelta = (double)llCycle - psEntry->m_dMeanCycle;
+        psEntry->m_dMeanCycle += dDelta / unCycles;
+        psEntry->m_dSquares += dDelta * ((double)llCycle - psEntry->m_dMeanCycle);
+
+        if (ucDataLen != psEntry->m_ucDataLen)
+        {
+            psEntry->m_unDLCChanges++;
+            psEntry->m_ucDataLen = ucDataLen;
+        }
+        if (nDataLen > 0 && 0 != memcmp(psEntry->m_aucData, pucData, nDataLen))
+        {
+            psEntry->m_unDataChanges++;
+            memcpy(psEntry->m_aucData, pucData, nDataLen);
+        }
+        psEntry->m_llLastTime = llTimeStamp;
+        psEntry->m_unMsgCount++;
+    }
+    InterlockedIncrement(&psEntry->m_lSequence);
+    return true;
+}
+
+/**
+ * \param[in] unSampleCount samples taken since the last reset, including
+ *            this one
+ *
+ * Stores the message count of every entry in its count history. Entries
+ * added later start with zero counts, which they had before.
+ */
+void CMsgIdProfiler::vSampleCounts(UINT unSampleCount)
+{
+    if (0 == unSampleCount)
+    {
+        return;
+    }
+    UINT unIndex = (unSampleCount - 1) % defPROFILE_COUNT_SAMPLES;
+    EnterCriticalSection(&m_omCritSec);
+    if (0 == m_lResetPending)
+    {
+        for (UINT unSlot = 0; unSlot < m_psTable->m_unCapacity; unSlot++)
+        {
+            sENTRY& sEntry = m_psTable->m_psEntries[unSlot];
+            if (0 != sEntry.m_unKey)
+            {
+                sEntry.m_aunCountSamples[unIndex] = sEntry.m_unMsgCount;
+            }
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/**
+ * \param[in] unChannelIndex channel index
+ * \param[in] unSampleCount samples taken since the last reset
+ * \param[in] un1sBack samples back spanning the one second rate, 0 if none
+ * \param[in] d1s time between those samples in seconds
+ * \param[in] un10sBack samples back spanning the ten second rate, 0 if none
+ * \param[in] d10s time between those samples in seconds
+ * \param[out] ouIdRates count and rates of every identifier of the channel
+ */
+void CMsgIdProfiler::vGetRates(UINT unChannelIndex, UINT unSampleCount, UINT un1sBack, double d1s,
+                               UINT un10sBack, double d10s, std::vector<SMSGIDRATE>& ouIdRates)
+{
+    ouIdRates.clear();
+    EnterCriticalSection(&m_omCritSec);
+    if (0 == m_lResetPending)
+    {
+        UINT unNewIndex = (unSampleCount + defPROFILE_COUNT_SAMPLES - 1) % defPROFILE_COUNT_SAMPLES;
+        UINT un1sIndex = (unSampleCount + defPROFILE_COUNT_SAMPLES - 1 - un1sBack) % defPROFILE_COUNT_SAMPLES;
+        UINT un10sIndex = (unSampleCount + defPROFILE_COUNT_SAMPLES - 1 - un10sBack) % defPROFILE_COUNT_SAMPLES;
+        for (UINT unSlot = 0; unSlot < m_psTable->m_unCapacity; unSlot++)
+        {
+            const sENTRY& sEntry = m_psTable->m_psEntries[unSlot];
+            if (0 == sEntry.m_unKey || unChannelIndex != sEntry.m_unChannelIndex)
+            {
+                continue;
+            }
+            SMSGIDRATE sIdRate;
+            sIdRate.m_unMsgID = sEntry.m_unKey & 0x1FFFFFFF;
+            sIdRate.m_bExtended = (0 != (sEntry.m_unKey & 0x40000000));
+            sIdRate.m_unMsgCount = sEntry.m_unMsgCount;
+            UINT unNew = sEntry.m_aunCountSamples[unNewIndex];
+            sIdRate.m_dRate1s = (un1sBack > 0 && d1s > 0) ? (unNew - sEntry.m_aunCountSamples[un1sIndex]) / d1s : 0;
+            sIdRate.m_dRate10s = (un10sBack > 0 && d10s > 0) ? (unNew - sEntry.m_aunCountSamples[un10sIndex]) / d10s : 0;
+            ouIdRates.push_back(sIdRate);
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/**
+ * \param[out] ouProfiles profile of every identifier
+ *
+ * Copies every used entry, an entry being written is read again.
+ */
+void CMsgIdProfiler::vGetSnapshot(std::vector<SMSGIDPROFILE>& ouProfiles)
+{
+    ouProfiles.clear();
+    EnterCriticalSection(&m_omCritSec);
+    if (0 == m_lResetPending)
+    {
+        ouProfiles.reserve(m_psTable->m_unUsed);
+        for (UINT unSlot = 0; unSlot < m_psTable->m_unCapacity; unSlot++)
+        {
+            const sENTRY& sShared = m_psTable->m_psEntries[unSlot];
+            if (0 == sShared.m_unKey)
+            {
+                continue;
+            }
+            sENTRY sEntry;
+            LONG lSequence;
+            do
+            {
+                lSequence = sShared.m_lSequence;
+                if (0 != (lSequence & 1))
+                {
+                    YieldProcessor();
+                    continue;
+                }
+                memcpy(&sEntry, (const void*)&sShared, offsetof(sENTRY, m_aucData));
+                MemoryBarrier();
+            }
+            while ((0 != (lSequence & 1)) || lSequence != sShared.m_lSequence);
+
+            SMSGIDPROFILE sProfile;
+            sProfile.m_unChannelIndex = sEntry.m_unChannelIndex;
+            sProfile.m_unMsgID = sEntry.m_unKey & 0x1FFFFFFF;
+            sProfile.m_bExtended = (0 != (sEntry.m_unKey & 0x40000000));
+            sProfile.m_unMsgCount = sEntry.m_unMsgCount;
+            sProfile.m_dLastTime = sEntry.m_llLastTime / defPROFILE_TICKS_PER_MS;
+            sProfile.m_unLateCount = sEntry.m_unLateCount;
+            sProfile.m_unLastDLC = sEntry.m_ucDataLen;
+            sProfile.m_unDLCChanges = sEntry.m_unDLCChanges;
+            sProfile.m_unDataChanges = sEntry.m_unDataChanges;
+            sProfile.m_dMinCycle = 0;
+            sProfile.m_dAvgCycle = 0;
+            sProfile.m_dMaxCycle = 0;
+            sProfile.m_dJitter = 0;
+            sProfile.m_dMaxDeviation = 0;
+            sProfile.m_dDataChangeRate = 0;
+            if (sEntry.m_unMsgCount > 1)
+            {
+                UINT unCycles = sEntry.m_unMsgCount - 1;
+                sProfile.m_dMinCycle = sEntry.m_llMinCycle / defPROFILE_TICKS_PER_MS;
+                sProfile.m_dAvgCycle = sEntry.m_dMeanCycle / defPROFILE_TICKS_PER_MS;
+                sProfile.m_dMaxCycle = sEntry.m_llMaxCycle / defPROFILE_TICKS_PER_MS;
+                sProfile.m_dJitter = sqrt(sEntry.m_dSquares / unCycles) / defPROFILE_TICKS_PER_MS;
+                sProfile.m_dMaxDeviation = sEntry.m_dMaxDeviation / defPROFILE_TICKS_PER_MS;
+                LONGLONG llDuration = sEntry.m_llLastTime - sEntry.m_llFirstTime;
+                if (llDuration > 0)
+                {
+                    sProfile.m_dDataChangeRate = sEntry.m_unDataChanges * 1000.0 * defPROFILE_TICKS_PER_MS / llDuration;
+                }
+            }
+            ouProfiles.push_back(sProfile);
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/**
+ * \param[in] ouProfiles profiles to write
+ * \param[in] strFileName file to create
+ * \param[in] eFormat BS_EXPORT_CSV or BS_EXPORT_JSON
+ * \return S_OK, S_FALSE if the file could not be written
+ *
+ * Writes one row or object per identifier. Channels are written 1 based
+ * and times in milli seconds.
+ */
+HRESULT CMsgIdProfiler::hExport(const std::vector<SMSGIDPROFILE>& ouProfiles, const std::string& strFileName,
+                                eBS_EXPORT_FORMAT eFormat)
+{
+    FILE* pFile = nullptr;
+    if (0 != fopen_s(&pFile, strFileName.c_str(), "w") || nullptr == pFile)
+    {
+        return S_FALSE;
+    }
+    if (BS_EXPORT_CSV == eFormat)
+    {
+        fprintf(pFile, "Channel,ID,Extended,Count,LastTime,MinCycle,AvgCycle,MaxCycle,Jitter,MaxDeviation,"
+                "Late,DLC,DLCChanges,DataChanges,DataChangeRate\n");
+    }
+    else
+    {
+        fprintf(pFile, "[\n");
+    }
+    for (size_t nIndex = 0; nIndex < ouProfiles.size(); nIndex++)
+    {
+        const SMSGIDPROFILE& sProfile = ouProfiles[nIndex];
+        if (BS_EXPORT_CSV == eFormat)
+        {
+            fprintf(pFile, "%u,0x%X,%d,%u,%.1f,%.1f,%.3f,%.1f,%.3f,%.3f,%u,%u,%u,%u,%.3f\n",
+                    sProfile.m_unChannelIndex + 1, sProfile.m_unMsgID, sProfile.m_bExtended ? 1 : 0,
+                    sProfile.m_unMsgCount, sProfile.m_dLastTime, sProfile.m_dMinCycle, sProfile.m_dAvgCycle,
+                    sProfile.m_dMaxCycle, sProfile.m_dJitter, sProfile.m_dMaxDeviation, sProfile.m_unLateCount,
+                    sProfile.m_unLastDLC, sProfile.m_unDLCChanges, sProfile.m_unDataChanges, sProfile.m_dDataChangeRate);
+        }
+        else
+        {
+            fprintf(pFile, "  {\"channel\": %u, \"id\": %u, \"extended\": %s, \"count\": %u, \"lastTime\": %.1f, "
+                    "\"minCycle\": %.1f, \"avgCycle\": %.3f, \"maxCycle\": %.1f, \"jitter\": %.3f, \"maxDeviation\": %.3f, "
+                    "\"late\": %u, \"dlc\": %u, \"dlcChanges\": %u, \"dataChanges\": %u, \"dataChangeRate\": %.3f}%s\n",
+                    sProfile.m_unChannelIndex + 1, sProfile.m_unMsgID, sProfile.m_bExtended ? "true" : "false",
+                    sProfile.m_unMsgCount, sProfile.m_dLastTime, sProfile.m_dMinCycle, sProfile.m_dAvgCycle,
+                    sProfile.m_dMaxCycle, sProfile.m_dJitter, sProfile.m_dMaxDeviation, sProfile.m_unLateCount,
+                    sProfile.m_unLastDLC, sProfile.m_unDLCChanges, sProfile.m_unDataChanges, sProfile.m_dDataChangeRate,
+                    (nIndex + 1 < ouProfiles.size()) ? "," : "");
+        }
+    }
+    if (BS_EXPORT_JSON == eFormat)
+    {
+        fprintf(pFile, "]\n");
+    }
+    bool bWritten = (0 == ferror(pFile));
+    fclose(pFile);
+    return bWritten ? S_OK : S_FALSE;
+}
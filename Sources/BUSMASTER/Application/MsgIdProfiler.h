@@ -0,0 +1,108 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      MsgIdProfiler.h
+ * \brief     CMsgIdProfiler declaration.
+ *
+ * Per channel and identifier timing profile of the CAN traffic.
+ */
+
+#pragma once
+
+#include "BaseBusStatisticCAN.h"
+
+#define defPROFILE_MIN_SLOTS        256     //Power of 2
+#define defPROFILE_MAX_SLOTS        65536   //Power of 2, holds half as many identifiers
+#define defPROFILE_MAX_PROBES       32      //Entries searched for a new identifier
+#define defPROFILE_COUNT_SAMPLES    11      //One second count samples, covers the 10 s rate
+#define defPROFILE_MAX_DATA_LEN     64
+#define defPROFILE_TICKS_PER_MS     10.0    //Time stamps are in 100 micro seconds
+
+/* Open addressing table of (channel, identifier) entries. Frames are added
+   by one thread without locking, every entry carries a sequence number that
+   is odd while the entry is written so readers can take consistent copies.
+   Resizing and resets are done by the writing thread on its next frame,
+   under the lock the readers hold while copying. The table grows up to
+   defPROFILE_MAX_SLOTS, frames of identifiers that find no entry within
+   defPROFILE_MAX_PROBES are not profiled. The statistics timer samples the
+   message counts once a second for the per identifier rates. */
+class CMsgIdProfiler
+{
+public:
+    CMsgIdProfiler(void);
+    ~CMsgIdProfiler(void);
+
+    //Table size for the given number of (channel, identifier) pairs, used from the next reset
+    void vSetExpectedIds(UINT unExpectedIds);
+    //Discards the profile, may be called while frames are added
+    void vReset(void);
+    //Adds a frame, pucData is nullptr for remote frames. Called from one thread only.
+    //Returns false if the identifier did not fit in the table.
+    bool bAddFrame(UINT unChannelIndex, UINT unMsgID, bool bExtended, UCHAR ucDataLen,
+                   const UCHAR* pucData, LONGLONG llTimeStamp);
+    //Stores the message counts as sample unSampleCount - 1 since the last reset
+    void vSampleCounts(UINT unSampleCount);
+    //Copies the count and rates of every identifier of a channel, the samples
+    //back and their time spans are given by the caller
+    void vGetRates(UINT unChannelIndex, UINT unSampleCount, UINT un1sBack, double d1s,
+                   UINT un10sBack, double d10s, std::vector<SMSGIDRATE>& ouIdRates);
+    //Copies the profile of every identifier seen since the last reset
+    void vGetSnapshot(std::vector<SMSGIDPROFILE>& ouProfiles);
+    //Writes profiles to a CSV or JSON file
+    static HRESULT hExport(const std::vector<SMSGIDPROFILE>& ouProfiles, const std::string& strFileName,
+                           eBS_EXPORT_FORMAT eFormat);
+
+private:
+    /* Hot fields fill the first cache line, the data is only touched on a hit */
+    struct __declspec(align(64)) sENTRY
+    {
+        volatile LONG m_lSequence;
+        UINT m_unKey;                   //Used flag, extended flag and identifier, 0 if free
+        UINT m_unChannelIndex;
+        UINT m_unMsgCount;
+        UINT m_unLateCount;
+        UINT m_unDLCChanges;
+        UINT m_unDataChanges;
+        UCHAR m_ucDataLen;
+        LONGLONG m_llFirstTime;
+        LONGLONG m_llLastTime;
+        LONGLONG m_llMinCycle;
+        LONGLONG m_llMaxCycle;
+        double m_dMeanCycle;            //Running mean and sum of squared differences of the cycles
+        double m_dSquares;
+        double m_dMaxDeviation;
+        UCHAR m_aucData[ defPROFILE_MAX_DATA_LEN ];
+        UINT m_aunCountSamples[ defPROFILE_COUNT_SAMPLES ];     //Written by the timer under the lock
+    };
+    struct sTABLE
+    {
+        UINT m_unCapacity;              //Power of 2
+        UINT m_unShift;                 //32 - log2(capacity)
+        UINT m_unUsed;
+        sENTRY* m_psEntries;
+    };
+
+    CRITICAL_SECTION m_omCritSec;
+    sTABLE* m_psTable;
+    volatile LONG m_lResetPending;
+    volatile LONG m_lExpectedIds;
+
+    static sTABLE* psCreateTable(UINT unMinEntries);
+    static void vDeleteTable(sTABLE* psTable);
+    static sENTRY* psFindEntry(sTABLE* psTable, UINT unChannelIndex, UINT unKey, UINT unMaxProbes);
+    void vReplaceTable(sTABLE* psTable);
+    void vGrowTable(void);
+};
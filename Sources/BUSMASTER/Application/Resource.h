@@ -1192,6 +1192,9 @@
 #define ID_RIBBON_HIDE                  40105
 #define ID_ACCELERATOR40109             40109
 #define ID_BUTTON_TOGGLERIBBON          40111
+#define IDM_MESSAGE_SHOW_ONLY           40113
+#define IDM_MESSAGE_SHOW_ALL            40114
+#define IDM_MESSAGE_FIND_NEXT           40115
 #define IDS_INVALID_DB_PROMPT           61447
 #define IDC_COMB_TOOLBAR                61448
 #define ID_ACTIVE_DATABASE_NAME         61448
@@ -1244,13 +1247,17 @@
 #define IDC_STATIC_LIN_OVERWRITE        63502
 #define ID_CONFIGURE_MESSAGEDISPLAY_ETH 63506
 #define IDB_HELP						63507
+#define IDD_DLG_MSGID_PROFILE           63508
+#define IDC_LST_MSGID_PROFILE           63509
+#define IDC_BTN_EXPORT_MSGID_PROFILE    63510
+#define IDM_MSGID_PROFILE_CAN           63511
 
 // Next default values for new objects
 // 
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NEXT_RESOURCE_VALUE        149
-#define _APS_NEXT_COMMAND_VALUE         40113
+#define _APS_NEXT_COMMAND_VALUE         40116
 #define _APS_NEXT_CONTROL_VALUE         1026
 #define _APS_NEXT_SYMED_VALUE           122
 #endif
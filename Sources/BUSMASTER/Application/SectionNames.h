@@ -85,6 +85,40 @@ static char SectionName[SECTION_TOTAL][MAX_PATH] =
     "TestSetupEditorSectionName",
     "TestSuiteExecutorSectionName"
 };
+//Names used in the configuration load report, in eSECTION_ID sequence
+static const char* SectionLoadName[SECTION_TOTAL] =
+{
+    "CAN Database",
+    "Bus Statistics",
+    "J1939 Database",
+    "LIN Database",
+    "CAN Driver",
+    "LIN Driver",
+    "CAN Filter",
+    "LIN Filter",
+    "Main Frame",
+    "CAN Signal Watch",
+    "J1939 Signal Watch",
+    "LIN Signal Watch",
+    "Signal Graph",
+    "CAN Log",
+    "J1939 Log",
+    "LIN Log",
+    "CAN Node Simulation",
+    "J1939 Node Simulation",
+    "Replay",
+    "CAN Message Window",
+    "J1939 Message Window",
+    "LIN Message Window",
+    "CAN Transmission Window",
+    "Waveform",
+    "Test Setup Editor",
+    "Test Suite Executor",
+    "LIN Node Simulation",
+    "LIN Cluster",
+    "LIN Transmission Window",
+    "LIN Schedule Table"
+};
 // XML GENERATION DEFINES
 #define DEF_BUSMASTER_INIT_CONFIG       "Busmaster_Init_Config"
 #define DEF_TOOLBAR_POSITION_DEFAULT    "Toolbar_Position_Default"
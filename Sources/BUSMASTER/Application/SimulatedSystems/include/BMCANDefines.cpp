@@ -10,6 +10,7 @@
 
 extern HMODULE g_hModuleHandle;
 static APPFUNCPROC sg_SendMsgFunc = NULL;
+static APPFUNCPROCMULTI sg_SendMsgsFunc = NULL;
 
 unsigned long* longAt(STCAN_MSG* sMsg,int nByte)
 {
@@ -76,6 +77,54 @@ UINT SendMsg(STCAN_MSG sTxMsg)
     return nResult;
 }
 
+/******************************************************************************
+    Function Name    :  vSetSendMsgsProcAddress
+    Input(s)         :  APPFUNCPROCMULTI which is a pointer to a global function
+    Output           :  None
+    Functionality    :  This function is used to pass a pointer to a global
+                        function which is called by the wrapper function.
+    Member of        :  None (Global function)
+    Friend of        :  None
+******************************************************************************/
+void vSetSendMsgsProcAddress(APPFUNCPROCMULTI pAppFunc)
+{
+    sg_SendMsgsFunc = pAppFunc;
+}
+
+/******************************************************************************
+    Function Name    :  SendMsgs
+    Input(s)         :  psTxMsgs, messages to send
+                        unCount, number of messages
+    Output           :  Returns 0->success, else failure
+    Functionality    :  This is a interface\wrapper function and user can
+                        call this function to send several messages to CAN
+                        bus in one call. Applications without the batched
+                        call get the messages one by one.
+    Member of        :  None (Global function)
+    Friend of        :  None
+******************************************************************************/
+UINT SendMsgs(STCAN_MSG* psTxMsgs, UINT unCount)
+{
+    UINT nResult = ERR_INVALID_ADDRESS;
+    if (sg_SendMsgsFunc != NULL)
+    {
+        nResult = (*sg_SendMsgsFunc)(psTxMsgs, unCount, sizeof(STCAN_MSG), g_hModuleHandle);
+    }
+    else if (sg_SendMsgFunc != NULL)
+    {
+        nResult = 0;
+        for (UINT i = 0; i < unCount; i++)
+        {
+            if ((*sg_SendMsgFunc)(&psTxMsgs[i], g_hModuleHandle) != 0)
+            {
+                nResult = 1;
+            }
+        }
+    }
+
+    return nResult;
+}
+
 static RESETCONTROLLER sg_ResetController = NULL;
 
 /******************************************************************************
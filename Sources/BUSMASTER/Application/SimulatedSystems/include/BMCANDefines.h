@@ -88,6 +88,7 @@ typedef void (*RESETCONTROLLER) (BOOL);
 typedef UINT (*CONTROLLERMODE) (BOOL);
 typedef UINT (*DLLMSGTXONOFF)(BOOL,HMODULE);
 typedef UINT (*APPFUNCPROC) (void*,HMODULE);
+typedef UINT (*APPFUNCPROCMULTI) (void*,UINT,UINT,HMODULE);
 typedef int (*GETMESSAGENAME)(DWORD, DWORD , char* ,DWORD );
 typedef void (*DLLGETMESSAGENAME)(GETMESSAGENAME);
 typedef DWORD (*GETFIRSTCANDBNAME)(char* , DWORD );
@@ -97,11 +98,13 @@ typedef void (*DLLGETFIRSTCANDBNAME)(GETFIRSTCANDBNAME);
 
 // BUSMASTER interface functions
 GCC_EXTERN UINT GCC_EXPORT SendMsg(STCAN_MSG);
+GCC_EXTERN UINT GCC_EXPORT SendMsgs(STCAN_MSG*, UINT);
 GCC_EXTERN void GCC_EXPORT ResetController(BOOL) ;
 GCC_EXTERN UINT GCC_EXPORT SetPassiveMode() ;
 GCC_EXTERN UINT GCC_EXPORT SetActiveMode() ;
 GCC_EXTERN BOOL GCC_EXPORT EnableDisableMsgTx(BOOL);
 GCC_EXTERN void GCC_EXPORT vSetSendMsgProcAddress(APPFUNCPROC pAppFunc);
+GCC_EXTERN void GCC_EXPORT vSetSendMsgsProcAddress(APPFUNCPROCMULTI pAppFunc);
 GCC_EXTERN void GCC_EXPORT vSetResetControllerProcAddress(RESETCONTROLLER pResetFunc);
 GCC_EXTERN void GCC_EXPORT vSetSetActiveModeProcAddress(CONTROLLERMODE pActiveModeFunc);
 GCC_EXTERN void GCC_EXPORT vSetSetPassiveModeProcAddress(CONTROLLERMODE pPassiveModeFunc);
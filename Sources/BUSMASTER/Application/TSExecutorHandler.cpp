@@ -23,7 +23,10 @@
 #include <libxml/xmlmemory.h>
 #include <libxml/parser.h>
 #include <libxml/xpath.h>
+#include "Utility/XMLUtils.h"
 #include "ProtocolsDefinitions.h"
+#include "SectionNames.h"
+#define def_STR_TSEXECUTOR_CONFIG_PATH  "/BUSMASTER_CONFIGURATION/Module_Configuration/CAN_TS_Executor"
 typedef HRESULT (*SHOWTSEXECUTORWINDOW)(void* pParentWnd);
 typedef HRESULT (*TSEXECUTORWINDOWSHOWN)();
 //typedef HRESULT (*TSEXECUTORGETCONFIGDATA)(BYTE*& pDesBuffer, UINT& nBuffSize);
@@ -52,10 +55,18 @@ TSExecutorHandler::TSExecutorHandler(void)
 {
     m_bConnected = FALSE;
     m_hTSExecutorHandle = nullptr;
+    m_bLoadFailed = FALSE;
+    m_pxmlPendingConfig = nullptr;
+    for (int i = 0; i < BUS_TOTAL; i++)
+    {
+        m_abInitialised[i] = FALSE;
+        m_abReadThread[i] = FALSE;
+    }
 }
 
 TSExecutorHandler::~TSExecutorHandler(void)
 {
+    vFreePendingConfig();
     if ( m_hTSExecutorHandle != nullptr )
     {
         FreeLibrary(m_hTSExecutorHandle);
@@ -71,6 +82,65 @@ void TSExecutorHandler::vLoadTSExecutor_DLL()
     m_hTSExecutorHandle = LoadLibrary(def_STR_TESTSIUTEEXECUTORDLL);
     vloadFuncPtrAddress();
 }
+/* The executor DLL is loaded when its window is first opened. Until then the
+   handler keeps the executor node of the configuration and the state of the
+   buses, and hands both to the DLL once it is loaded. The DLL owns the
+   configuration from then on, the handler keeps no copy of it. */
+bool TSExecutorHandler::bLoadOnFirstUse()
+{
+    if ( m_hTSExecutorHandle != nullptr )
+    {
+        return true;
+    }
+    if ( TRUE == m_bLoadFailed )
+    {
+        return false;
+    }
+    vLoadTSExecutor_DLL();
+    if ( m_hTSExecutorHandle == nullptr )
+    {
+        m_bLoadFailed = TRUE;
+        return false;
+    }
+    for (int i = 0; i < BUS_TOTAL; i++)
+    {
+        if ( (TRUE == m_abInitialised[i]) && (pfTSDoInitialization != nullptr) )
+        {
+            pfTSDoInitialization((ETYPE_BUS)i);
+            if ( (TRUE == m_abReadThread[i]) && (pfTSStartStopReadThread != nullptr) )
+            {
+                pfTSStartStopReadThread((ETYPE_BUS)i, TRUE);
+            }
+        }
+    }
+    vApplyPendingConfig();
+    return true;
+}
+void TSExecutorHandler::vApplyPendingConfig()
+{
+    if( (nullptr == m_pxmlPendingConfig) || (nullptr == pfTSExecutorSetXMLConfigdata) )
+    {
+        vFreePendingConfig();
+        return;
+    }
+    //The DLL looks the node up by its path, so it gets a document with only that node
+    xmlDocPtr pDoc = xmlNewDoc(BAD_CAST "1.0");
+    xmlNodePtr pRootPtr = xmlNewNode(nullptr, BAD_CAST DEF_BUSMASTER_CONFIGURATION);
+    xmlDocSetRootElement(pDoc, pRootPtr);
+    xmlNodePtr pModulePtr = xmlNewChild(pRootPtr, nullptr, BAD_CAST DEF_MODULE_CONFIGURATION, nullptr);
+    xmlAddChild(pModulePtr, m_pxmlPendingConfig);
+    m_pxmlPendingConfig = nullptr;
+    pfTSExecutorSetXMLConfigdata(pDoc);
+    xmlFreeDoc(pDoc);
+}
+void TSExecutorHandler::vFreePendingConfig()
+{
+    if( nullptr != m_pxmlPendingConfig )
+    {
+        xmlFreeNode(m_pxmlPendingConfig);
+        m_pxmlPendingConfig = nullptr;
+    }
+}
 void TSExecutorHandler::vInitializeFuncPtrs()
 {
     pfShowTSExecutorwindow = nullptr;
@@ -100,7 +170,7 @@ void TSExecutorHandler::vloadFuncPtrAddress()
 }
 void TSExecutorHandler::vShowTSExecutorWindow(void* pParentWnd)
 {
-    if(pfShowTSExecutorwindow != nullptr)
+    if( (true == bLoadOnFirstUse()) && (pfShowTSExecutorwindow != nullptr) )
     {
         pfShowTSExecutorwindow(pParentWnd);
         pfTSBusConnected(m_bConnected);
@@ -113,7 +183,12 @@ void TSExecutorHandler::vGetConfigurationData(BYTE*& /* pDesBuffer */, UINT& /*
 
 void TSExecutorHandler::vGetConfigurationData(xmlNodePtr& pxmlNodePtr)
 {
-    if(pfTSExecutorGetConfigdata != nullptr)
+    if(m_hTSExecutorHandle == nullptr)
+    {
+        //Not used since it was loaded, save it unchanged
+        pxmlNodePtr = (m_pxmlPendingConfig != nullptr) ? xmlCopyNode(m_pxmlPendingConfig, 1) : nullptr;
+    }
+    else if(pfTSExecutorGetConfigdata != nullptr)
     {
         pfTSExecutorGetConfigdata(&pxmlNodePtr);
     }
@@ -121,6 +196,8 @@ void TSExecutorHandler::vGetConfigurationData(xmlNodePtr& pxmlNodePtr)
 
 void TSExecutorHandler::vSetConfigurationData(BYTE*& pSrcBuffer, UINT& unBuffSize)
 {
+    //A DLL loaded later starts with the default configuration
+    vFreePendingConfig();
     if(pfTSExecutorSetConfigdata!= nullptr)
     {
         pfTSExecutorSetConfigdata(pSrcBuffer, unBuffSize);
@@ -128,13 +205,27 @@ void TSExecutorHandler::vSetConfigurationData(BYTE*& pSrcBuffer, UINT& unBuffSiz
 }
 void TSExecutorHandler::vSetConfigurationData(xmlDocPtr pDoc)
 {
-    if( nullptr != pfTSExecutorSetXMLConfigdata )
+    vFreePendingConfig();
+    if( m_hTSExecutorHandle == nullptr )
+    {
+        xmlXPathObjectPtr pPathObject = xmlUtils::pGetNodes(pDoc, (xmlChar*)def_STR_TSEXECUTOR_CONFIG_PATH);
+        if( nullptr != pPathObject )
+        {
+            if( (nullptr != pPathObject->nodesetval) && (pPathObject->nodesetval->nodeNr > 0) )
+            {
+                m_pxmlPendingConfig = xmlCopyNode(pPathObject->nodesetval->nodeTab[0], 1);
+            }
+            xmlXPathFreeObject(pPathObject);
+        }
+    }
+    else if( nullptr != pfTSExecutorSetXMLConfigdata )
     {
         pfTSExecutorSetXMLConfigdata(pDoc);
     }
 }
 void TSExecutorHandler::vStartStopReadThread(ETYPE_BUS eBus, BOOL bStart)
 {
+    m_abReadThread[eBus] = bStart;
     if(pfShowTSExecutorwindow != nullptr)
     {
         pfTSStartStopReadThread(eBus, bStart);
@@ -142,6 +233,7 @@ void TSExecutorHandler::vStartStopReadThread(ETYPE_BUS eBus, BOOL bStart)
 }
 void TSExecutorHandler::vDoInitailization(ETYPE_BUS eBus)
 {
+    m_abInitialised[eBus] = TRUE;
     if(pfTSDoInitialization != nullptr)
     {
         pfTSDoInitialization(eBus);
@@ -149,6 +241,8 @@ void TSExecutorHandler::vDoInitailization(ETYPE_BUS eBus)
 }
 void TSExecutorHandler::vDoDeInitailization(ETYPE_BUS eBus)
 {
+    m_abInitialised[eBus] = FALSE;
+    m_abReadThread[eBus] = FALSE;
     if (pfTSDoDeInitialization != nullptr)
     {
         pfTSDoDeInitialization(eBus);
@@ -156,9 +250,9 @@ void TSExecutorHandler::vDoDeInitailization(ETYPE_BUS eBus)
 }
 void TSExecutorHandler::vBusConnected(BOOL bConnected)
 {
+    m_bConnected = bConnected;
     if(pfTSBusConnected != nullptr)
     {
-        m_bConnected = bConnected;
         pfTSBusConnected(m_bConnected);
     }
 }
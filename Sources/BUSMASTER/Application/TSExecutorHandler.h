@@ -26,8 +26,16 @@ class TSExecutorHandler
 private:
     HMODULE m_hTSExecutorHandle;
     BOOL m_bConnected;
+    BOOL m_bLoadFailed;
+    //State of the configuration and buses kept until the DLL is loaded
+    xmlNodePtr m_pxmlPendingConfig;
+    BOOL m_abInitialised[BUS_TOTAL];
+    BOOL m_abReadThread[BUS_TOTAL];
     void vInitializeFuncPtrs();
     void vloadFuncPtrAddress();
+    bool bLoadOnFirstUse();
+    void vApplyPendingConfig();
+    void vFreePendingConfig();
 public:
     TSExecutorHandler(void);
     virtual ~TSExecutorHandler(void);
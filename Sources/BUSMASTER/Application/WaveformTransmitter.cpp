@@ -243,117 +243,201 @@ void CWaveformTransmitter::vSetSignalValue(int byte, int startBitIndexInByte, in
     *pu64Target |= u64SignVal;
 }
 
-void CWaveformTransmitter::vProcessWaveForm(int CurrItr,int& iStep,eWAVEFORMTYPE& eWFType)
+UINT64 CWaveformTransmitter::un64PlaceSignalValue(UINT64 u64SignVal, std::pair<ISignal*, SignalInstanse>& Signal, int nDLC)
+{
+    unsigned char aucData[64] = { 0 };
+    vGetDataBytesFromSignal(u64SignVal, Signal, nDLC, aucData);
+    UINT64 un64Placed = 0;
+    memcpy(&un64Placed, aucData, sizeof(un64Placed));
+    return un64Placed;
+}
+
+BOOL CWaveformTransmitter::bCompileMessage(SSigGeneration& ouMsgEntry, UINT unPeriod, sWAVEMSGPLAN& sPlan)
 {
     /*  Steps involved are:
-        1. Get list of waveform messages and start with the first message
-        2. Calculate value of each of the selected signals based on current iteration
-        3. Update CAN frame and do it for all the selected signals.
-        4. Assume default values for other signals
-        5. Transmit the frame.
-        6. Repeat steps 2 to 5 for the entire set of messages. */
+        1. Encode the default amplitude of every signal without waveform
+           into the frame.
+        2. For each waveform signal compute the amplitude of every sample
+           of the cycle and place it at the signal bits.
+        3. The last waveform signal decides the cycle length, a sawtooth
+           cycle ends on a restart. */
+    IFrame* frame = nullptr;
+    m_ppouDBPtr->GetFrame(CAN, 0, ouMsgEntry.m_nMsgID, nullptr, &frame);
+    if (nullptr == frame)
+    {
+        return FALSE;
+    }
 
-    POSITION CurrMsgPos = m_omSigGenList.GetHeadPosition();
-    while (nullptr != CurrMsgPos)
+    unsigned int nLength = 0;
+    memset(&sPlan.m_sFrame, 0, sizeof(sPlan.m_sFrame)); // m_ucEXTENDED & m_ucRTR are zero.
+    sPlan.m_sFrame.m_unMsgID = ouMsgEntry.m_nMsgID;
+    frame->GetLength(nLength);
+    sPlan.m_sFrame.m_ucDataLen = (UCHAR)(nLength);
+    sPlan.m_sFrame.m_ucChannel = 0x1;
+    sPlan.m_ouSignals.clear();
+    sPlan.m_unPeriod = unPeriod;
+    sPlan.m_unNextDue = unPeriod;
+    sPlan.m_unCurrSample = 0;
+
+    std::map<ISignal*, SignalInstanse> signalList;
+    frame->GetSignalList(signalList);
+
+    // First pass: the cycle length follows the last waveform signal.
+    UINT unSampleCount = m_nIterLimit + 1;
+    std::string name;
+    for (auto signal : signalList)
     {
-        // Retrieve the present entry and query for the next one
-        SSigGeneration& ouCurrEntry = m_omSigGenList.GetNext(CurrMsgPos);
+        sSigWaveMap ouCurrSig;
+        signal.first->GetName(name);
+        if (bGetSignalEntry(name.c_str(), &(ouMsgEntry.m_omSigWaveMapList), ouCurrSig))
+        {
+            unSampleCount = m_nIterLimit + 1;
+            if (eWave_SAWTOOTH == ouCurrSig.sWaveInfo.m_eSignalWaveType)
+            {
+                int nStep = max((int)( 1 / (ouCurrSig.sWaveInfo.m_fGranularity/(2 * PI )) ), 1);
+                int nLimit = m_nIterLimit;
+                if (((nLimit % nStep) != 0) && (nLimit > nStep))
+                {
+                    nLimit -= (nLimit % nStep);
+                }
+                unSampleCount = max(nLimit, 1);
+            }
+        }
+    }
+    sPlan.m_unSampleCount = unSampleCount;
 
-        if(nullptr == m_ppouDBPtr)
+    for (auto signal : signalList)
+    {
+        sSigWaveMap ouCurrSig;
+        signal.first->GetName(name);
+        std::pair<ISignal*, SignalInstanse> signalPair(signal.first, signal.second);
+        if (bGetSignalEntry(name.c_str(), &(ouMsgEntry.m_omSigWaveMapList), ouCurrSig))
         {
-            break;
+            sWAVESIGNALPLAN sSignalPlan;
+            sSignalPlan.m_un64Mask = un64PlaceSignalValue((UINT64)-1, signalPair, sPlan.m_sFrame.m_ucDataLen);
+            sSignalPlan.m_ouSamples.resize(unSampleCount);
+            UINT unStep = max((UINT)( 1 / (ouCurrSig.sWaveInfo.m_fGranularity/(2 * PI )) ), (UINT)1);
+            bool bSawtooth = (eWave_SAWTOOTH == ouCurrSig.sWaveInfo.m_eSignalWaveType);
+            if (true == bSawtooth)
+            {
+                sSignalPlan.m_ouSawtoothReset.resize(unSampleCount, false);
+            }
+            for (UINT unSample = 0; unSample < unSampleCount; unSample++)
+            {
+                UINT64 Amplitude = 0;
+                if (true == bSawtooth && (unSample % unStep) == 0)
+                {
+                    // Peak value, the frame is sent again with the signal at 0
+                    Amplitude = (UINT64)ouCurrSig.sWaveInfo.m_fAmplitude * 2;
+                    sSignalPlan.m_ouSawtoothReset[unSample] = true;
+                }
+                else
+                {
+                    Amplitude = u64GetCurrAmplitude(unSample, ouCurrSig.sWaveInfo);
+                }
+                sSignalPlan.m_ouSamples[unSample] = un64PlaceSignalValue(Amplitude, signalPair, sPlan.m_sFrame.m_ucDataLen);
+            }
+            sPlan.m_ouSignals.push_back(sSignalPlan);
         }
+        else
+        {
+            vGetDataBytesFromSignal((UINT64)ouMsgEntry.m_fDefaultAmplitude, signalPair, sPlan.m_sFrame.m_ucDataLen, sPlan.m_sFrame.m_ucData);
+        }
+    }
+    return TRUE;
+}
 
-        // Get message and signal details from database.
-        IFrame* frame = nullptr;
-        m_ppouDBPtr->GetFrame(CAN, 0, ouCurrEntry.m_nMsgID, nullptr, &frame);
+void CWaveformTransmitter::vCompileWaveforms(UINT unPeriod)
+{
+    m_ouMsgPlans.clear();
+    m_unElapsed = 0;
+    m_unTickPeriod = unPeriod;
+    if (nullptr == m_ppouDBPtr)
+    {
+        return;
+    }
 
-        if (nullptr == frame)
+    POSITION CurrMsgPos = m_omSigGenList.GetHeadPosition();
+    while (nullptr != CurrMsgPos)
+    {
+        SSigGeneration& ouCurrEntry = m_omSigGenList.GetNext(CurrMsgPos);
+        sWAVEMSGPLAN sPlan;
+        if (TRUE == bCompileMessage(ouCurrEntry, unPeriod, sPlan))
         {
-            break;
+            m_ouMsgPlans.push_back(sPlan);
         }
+    }
 
-        // Assign values to the CAN frame to transmit
-        unsigned int nLength = 0;
-        STCAN_MSG sCurrFrame = {'\0'}; // m_ucEXTENDED & m_ucRTR are zero.
-        sCurrFrame.m_unMsgID = ouCurrEntry.m_nMsgID;
-        frame->GetLength(nLength);
-        sCurrFrame.m_ucDataLen = (UCHAR)(nLength);
-        sCurrFrame.m_ucChannel = 0x1;
+    // The scheduler runs at the greatest common divisor of the periods
+    for (size_t nPlan = 0; nPlan < m_ouMsgPlans.size(); nPlan++)
+    {
+        UINT unA = m_ouMsgPlans[nPlan].m_unPeriod;
+        UINT unB = (0 == nPlan) ? unA : m_unTickPeriod;
+        while (0 != unB)
+        {
+            UINT unRem = unA % unB;
+            unA = unB;
+            unB = unRem;
+        }
+        m_unTickPeriod = max(unA, (UINT)1);
+    }
+}
 
-        // Iterate through the master signal list and query for each signal in
-        // the waveform list.
-        std::map<ISignal*, SignalInstanse> signalList;
-        frame->GetSignalList(signalList);
+void CWaveformTransmitter::vTransmitSample(sWAVEMSGPLAN& sPlan)
+{
+    UINT64 un64Data = 0;
+    memcpy(&un64Data, sPlan.m_sFrame.m_ucData, sizeof(un64Data));
+    bool bSawtoothReset = false;
+    for (auto itrSignal = sPlan.m_ouSignals.begin(); itrSignal != sPlan.m_ouSignals.end(); ++itrSignal)
+    {
+        un64Data = (un64Data & ~itrSignal->m_un64Mask) | itrSignal->m_ouSamples[sPlan.m_unCurrSample];
+        if (false == itrSignal->m_ouSawtoothReset.empty() && true == itrSignal->m_ouSawtoothReset[sPlan.m_unCurrSample])
+        {
+            bSawtoothReset = true;
+        }
+    }
 
+    STCAN_MSG sCurrFrame = sPlan.m_sFrame;
+    memcpy(sCurrFrame.m_ucData, &un64Data, sizeof(un64Data));
+    m_ouTickFrames.push_back(sCurrFrame);
 
-        bool bSawtoothExists = false;
-        std::string name = "";
-for (auto signal : signalList)
+    /* If sawtooth signals restart, send them again with value 0 */
+    if (true == bSawtoothReset)
+    {
+        for (auto itrSignal = sPlan.m_ouSignals.begin(); itrSignal != sPlan.m_ouSignals.end(); ++itrSignal)
         {
-            // Search if it occurs in the waveform list.
-            sSigWaveMap ouCurrSig;
-            signal.first->GetName(name);
-            if (bGetSignalEntry(name.c_str(),
-                                &(ouCurrEntry.m_omSigWaveMapList), ouCurrSig))
-            {
-                UINT unStep = ( 1 / (ouCurrSig.sWaveInfo.m_fGranularity/(2 * PI )) );
-
-                if ( ouCurrSig.sWaveInfo.m_eSignalWaveType == eWave_SAWTOOTH && ( (CurrItr == 0x00) || (CurrItr % unStep) == 0) )
-                {
-                    std::pair<ISignal*, SignalInstanse> signalPair(signal.first, signal.second);
-                    vGetDataBytesFromSignal((UINT64)ouCurrSig.sWaveInfo.m_fAmplitude * 2, signalPair, sCurrFrame.m_ucDataLen, sCurrFrame.m_ucData);
-                    bSawtoothExists = true;
-                }
-                else
-                {
-                    UINT64 Amplitude = u64GetCurrAmplitude(CurrItr, ouCurrSig.sWaveInfo);
-                    std::pair<ISignal*, SignalInstanse> signalPair(signal.first, signal.second);
-                    vGetDataBytesFromSignal((UINT64)Amplitude, signalPair, sCurrFrame.m_ucDataLen, sCurrFrame.m_ucData);
-                }
-                iStep = unStep;
-                eWFType =  ouCurrSig.sWaveInfo.m_eSignalWaveType;
-            }
-            else
+            if (false == itrSignal->m_ouSawtoothReset.empty() && true == itrSignal->m_ouSawtoothReset[sPlan.m_unCurrSample])
             {
-                std::pair<ISignal*, SignalInstanse> signalPair(signal.first, signal.second);
-                vGetDataBytesFromSignal((UINT64)ouCurrEntry.m_fDefaultAmplitude, signalPair, sCurrFrame.m_ucDataLen, sCurrFrame.m_ucData);
+                un64Data &= ~itrSignal->m_un64Mask;
             }
         }
-        // End of processing. Now transmit the CAN frame.
-        m_pouDIL_CAN_Interface->DILC_SendMsg(m_dwClientID, sCurrFrame);
+        memcpy(sCurrFrame.m_ucData, &un64Data, sizeof(un64Data));
+        m_ouTickFrames.push_back(sCurrFrame);
+    }
+}
 
-        /* If sawtooth signals are present */
-        if ( bSawtoothExists == true)
+void CWaveformTransmitter::vProcessTick(void)
+{
+    m_unElapsed += m_unTickPeriod;
+    for (auto itrPlan = m_ouMsgPlans.begin(); itrPlan != m_ouMsgPlans.end(); ++itrPlan)
+    {
+        if ((int)(m_unElapsed - itrPlan->m_unNextDue) >= 0)
         {
-            /* Reloop for sending Sawtooth signals with value 0 */
-for (auto signal : signalList)
-            {
-                // Search if it occurs in the waveform list.
-                sSigWaveMap ouCurrSig;
-                std::string name;
-                signal.first->GetName(name);
-                if (bGetSignalEntry(name.c_str(),
-                                    &(ouCurrEntry.m_omSigWaveMapList), ouCurrSig))
-                {
-                    UINT unStep = ( 1 / (ouCurrSig.sWaveInfo.m_fGranularity/(2 * PI )) );
-                    if ( ouCurrSig.sWaveInfo.m_eSignalWaveType == eWave_SAWTOOTH && ( (CurrItr == 0x00) || (CurrItr % unStep) == 0) )
-                    {
-                        std::pair<ISignal*, SignalInstanse> signalPair(signal.first, signal.second);
-                        vGetDataBytesFromSignal(0, signalPair, sCurrFrame.m_ucDataLen, sCurrFrame.m_ucData);
-
-                    }
-                }
-                else
-                {
-                    std::pair<ISignal*, SignalInstanse> signalPair(signal.first, signal.second);
-                    vGetDataBytesFromSignal((UINT64)ouCurrEntry.m_fDefaultAmplitude, signalPair, sCurrFrame.m_ucDataLen, sCurrFrame.m_ucData);
-                }
-            }
-            // End of processing. Now transmit the CAN frame.
-            m_pouDIL_CAN_Interface->DILC_SendMsg(m_dwClientID, sCurrFrame);
+            vTransmitSample(*itrPlan);
+            itrPlan->m_unNextDue += itrPlan->m_unPeriod;
+            itrPlan->m_unCurrSample = (itrPlan->m_unCurrSample + 1) % itrPlan->m_unSampleCount;
         }
     }
+    if (false == m_ouTickFrames.empty())
+    {
+        m_pouDIL_CAN_Interface->DILC_SendMsgs(m_dwClientID, &m_ouTickFrames[0], (UINT)m_ouTickFrames.size(), nullptr);
+        m_ouTickFrames.clear();
+    }
+}
+
+UINT CWaveformTransmitter::unGetTickPeriod(void)
+{
+    return m_unTickPeriod;
 }
 
 /******************************************************************************
@@ -375,8 +459,7 @@ DWORD WINAPI TransmissionThreadProc(LPVOID pVoid)
     CWaveformTransmitter* pCurrObj = static_cast<CWaveformTransmitter*> (pThreadParam->m_pBuffer);
     ASSERT(nullptr != pCurrObj);
 
-    UINT SamplingRate = pCurrObj->shGetSamplingTimePeriod();
-    int nIterLimit = pCurrObj->nGetIterationLimit();
+    UINT SamplingRate = pCurrObj->unGetTickPeriod();
 
     TIMECAPS time;
     if (timeGetDevCaps(&time, sizeof(TIMECAPS)) == TIMERR_NOERROR)
@@ -405,9 +488,6 @@ DWORD WINAPI TransmissionThreadProc(LPVOID pVoid)
     //ASSERT(nullptr != Result);
 
     bool bLoopON = true;
-    int i = 0;
-    int iStep =0;
-    eWAVEFORMTYPE eWaveType;
 
     while (bLoopON)
     {
@@ -417,9 +497,8 @@ DWORD WINAPI TransmissionThreadProc(LPVOID pVoid)
         {
             case INVOKE_FUNCTION:
             {
-                // Calculate signal values at the curent iteration and transmit
-                // the message(s).
-                pCurrObj->vProcessWaveForm(i,iStep,eWaveType);
+                // Transmit the current samples of the message(s) due.
+                pCurrObj->vProcessTick();
             }
             break;
             case EXIT_THREAD:
@@ -434,20 +513,6 @@ DWORD WINAPI TransmissionThreadProc(LPVOID pVoid)
             }
             break;
         }
-        if(eWaveType == eWave_SAWTOOTH)
-        {
-            int nExcess= 0;
-            if( ((nIterLimit % iStep) != 0)&& (nIterLimit > iStep))
-            {
-                nExcess = (nIterLimit % iStep);
-                nIterLimit = nIterLimit - ( nExcess);
-            }
-            i = (i < nIterLimit-1) ? ++i : 0;
-        }
-        else
-        {
-            i = (i < nIterLimit) ? ++i : 0;
-        }
     }
     SetEvent(pThreadParam->hGetExitNotifyEvent());
 
@@ -467,6 +532,8 @@ CWaveformTransmitter::CWaveformTransmitter()
     m_bEnabled = FALSE;
     m_bTxON = FALSE;
     m_nIterLimit = 0;
+    m_unTickPeriod = 125;
+    m_unElapsed = 0;
     m_pWaveDataHandler      = nullptr;
     m_pouDIL_CAN_Interface  = nullptr;
     m_ppouDBPtr             = nullptr;
@@ -563,6 +630,13 @@ void CWaveformTransmitter::vStartSignalTransmission(DWORD dwClientID)
         m_nIterLimit = 1000 / shWvfrm - 1;
     }
 
+    if (FALSE == m_bTxON)
+    {
+        // Every message uses the sampling period, the configuration has no
+        // period per message.
+        vCompileWaveforms((UINT)shWvfrm);
+    }
+
     if (FALSE == m_bTxON)
     {
         m_ouTransmitThread.m_pBuffer = this;
@@ -30,8 +30,30 @@
 #include "WaveFormDataHandler.h"
 #include "MsgSignal.h"
 #include "Utility/Utility_Thread.h"
+#include <vector>
 
 
+/* A waveform signal compiled for transmission: its bits in the first eight
+   data bytes and its value at every sample of the message cycle, already
+   placed at these bits. */
+struct sWAVESIGNALPLAN
+{
+    UINT64 m_un64Mask;
+    std::vector<UINT64> m_ouSamples;
+    std::vector<bool> m_ouSawtoothReset;    // Sawtooth restarts, empty for other waves
+};
+
+/* A waveform message compiled for transmission. The frame holds the default
+   value of every other signal. */
+struct sWAVEMSGPLAN
+{
+    STCAN_MSG m_sFrame;
+    std::vector<sWAVESIGNALPLAN> m_ouSignals;
+    UINT m_unSampleCount;   // Samples of one cycle
+    UINT m_unCurrSample;
+    UINT m_unPeriod;        // Transmission period in ms
+    UINT m_unNextDue;       // Time of the next transmission in ms
+};
 
 class CWaveformTransmitter
 {
@@ -50,6 +72,10 @@ private:
     BOOL m_bTxON;       // Current Tx state
     int m_nIterLimit;   // Iteration limit
     DWORD m_dwClientID; // Client ID to use while transmitting wave patterns
+    std::vector<sWAVEMSGPLAN> m_ouMsgPlans; // Compiled waveform messages
+    UINT m_unTickPeriod;    // Scheduler period in ms, divides every message period
+    UINT m_unElapsed;       // Time since transmission start in ms
+    std::vector<STCAN_MSG> m_ouTickFrames;  // Frames due at the current tick, sent in one call
 
     // Given signal name and CSigWaveMapList, this retrieves the sSigWaveMap entry
     BOOL bGetSignalEntry(CString omSignalName,
@@ -59,6 +85,14 @@ private:
     UINT64 u64GetCurrAmplitude(int CurrIteration, sWaveformInfo& ouCurrSig);
     // To know if at least one waveform signal has been defined
     BOOL bIsWaveformSignalPresent(void);
+    // Compiles the waveform messages into transmission plans
+    void vCompileWaveforms(UINT unPeriod);
+    // Compiles one waveform message
+    BOOL bCompileMessage(SSigGeneration& ouMsgEntry, UINT unPeriod, sWAVEMSGPLAN& sPlan);
+    // Signal value placed in the first eight data bytes
+    UINT64 un64PlaceSignalValue(UINT64 u64SignVal, std::pair<ISignal*, SignalInstanse>& Signal, int nDLC);
+    // Transmits the current sample of a message
+    void vTransmitSample(sWAVEMSGPLAN& sPlan);
 
     //To0 calculate Rounding values for floats.
     float fRound(float val, unsigned int decimals);
@@ -70,8 +104,10 @@ public:
     ~CWaveformTransmitter();    // Destructor
 
     // Helper functions; to be invoked from thread
-    // To calculate signal values at the curent iteration and transmit
-    void vProcessWaveForm(int CurrIteration,int& iStep,eWAVEFORMTYPE& eWFType);
+    // To transmit the messages due at the current scheduler tick
+    void vProcessTick(void);
+    // Get the scheduler period.
+    UINT unGetTickPeriod(void);
     // Get sampling Time period.
     short shGetSamplingTimePeriod(void);
     // To get the iteration limit
@@ -365,6 +365,49 @@ STDMETHODIMP CSimENG::SendMessage(USHORT ClientID, USHORT CurrDataLength,
     return Result;
 }
 
+/**
+ * \brief     Send several messages
+ *
+ * Call this function to send frames of the same length to the virtual bus
+ * in one call. The frames are added under one lock of the message entry.
+ */
+STDMETHODIMP CSimENG::SendMessages(USHORT ClientID, USHORT CurrDataLength,
+                                   ULONG TotalLength, BYTE* pbMsgBytes)
+{
+    HRESULT Result = S_FALSE;
+    if ((0 == CurrDataLength) || (nullptr == pbMsgBytes) ||
+            ((1 + SIZE_TIMESTAMP + CurrDataLength) > sg_nEntryLen))
+    {
+        return E_INVALIDARG;
+    }
+    // First ensure this node is active
+    CLIENT_MAP::iterator itr = sg_ClientMap.find(ClientID);
+    if (itr != sg_ClientMap.end())
+    {
+        if (itr->second.m_bActive)
+        {
+            EnterCriticalSection(&sg_CSMsgEntry);
+
+            INT TotalEntryLength = 1 + SIZE_TIMESTAMP + CurrDataLength;
+            UINT64 un64TS = (UINT64) ClientID;
+            ULONG ulCount = TotalLength / CurrDataLength;
+            for (ULONG i = 0; i < ulCount; i++)
+            {
+                memset(sg_pbEntry, '\0', TotalEntryLength);
+                memcpy(sg_pbEntry + 1, &un64TS, SIZE_TIMESTAMP);
+                memcpy(sg_pbEntry + 1 + SIZE_TIMESTAMP, pbMsgBytes + i * CurrDataLength, CurrDataLength);
+                sg_MessageBuf.WriteIntoBuffer(itr->second.m_nBus, sg_pbEntry, TotalEntryLength);
+            }
+
+            LeaveCriticalSection(&sg_CSMsgEntry);
+
+            Result = S_OK;
+        }
+    }
+
+    return Result;
+}
+
 /**
  * \brief     Register Client
  * \req       RSI_5_001 - RegisterClient
@@ -67,6 +67,10 @@ public:
     STDMETHOD(DisconnectNode)(USHORT ClientID);
     STDMETHOD(GetTimeModeMapping)(SYSTEMTIME* CurrSysTime, ULONGLONG* TimeStamp, LARGE_INTEGER* lQueryTickCount);
     STDMETHOD(GetCurrentStatus)(USHORT ClientID, VARIANT* pNodeStatus);
+
+    /* Transmits TotalLength / CurrDataLength frames of CurrDataLength bytes
+    each, laid out one after the other, in one call */
+    STDMETHOD(SendMessages)(USHORT ClientID, USHORT CurrDataLength, ULONG TotalLength, BYTE* pbMsgBytes);
 };
 
 OBJECT_ENTRY_AUTO(__uuidof(SimENG), CSimENG)
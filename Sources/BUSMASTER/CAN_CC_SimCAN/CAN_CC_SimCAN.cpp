@@ -203,6 +203,7 @@ public:
     HRESULT CAN_GetCurrStatus(STATUSMSG& StatusData);
     HRESULT CAN_GetTxMsgBuffer(BYTE*& pouFlxTxMsgBuffer);
     HRESULT CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMsg);
+    HRESULT CAN_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults);
     HRESULT CAN_GetBusConfigInfo(BYTE* BusInfo);
     HRESULT CAN_GetLastErrorString(std::string& acErrorStr);
     HRESULT CAN_GetControllerParams(LONG& lParam, UINT nChannel, ECONTR_PARAM eContrParam);
@@ -1582,6 +1583,51 @@ HRESULT CDIL_CAN_CCSimCAN::CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sMessa
     return hResult;
 }
 
+/**
+* \brief         Sends unCount STCAN_MSG structures from the client dwClientID
+*                under one lock of the write section.
+* \param[in]     dwClientID is the client ID
+* \param[in]     psCanTxMsgs are the messages
+* \param[in]     unCount is the number of messages
+* \param[out]    phResults, if not nullptr, gets the result of every message
+* \return        S_OK if all messages were sent, else the first failure
+*/
+HRESULT CDIL_CAN_CCSimCAN::CAN_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults)
+{
+    VALIDATE_VALUE_RETURN_VAL(sg_bCurrState, STATE_CONNECTED, ERR_IMPROPER_STATE);
+
+    if (!bClientIdExist(dwClientID))
+    {
+        return ERR_NO_CLIENT_EXIST;
+    }
+
+    HRESULT hResult = S_OK;
+    EnterCriticalSection(&sg_CritSectForWrite); // Lock the buffer
+    for (UINT i = 0; i < unCount; i++)
+    {
+        HRESULT hFrameResult = S_FALSE;
+        if (psCanTxMsgs[i].m_ucChannel > sg_nNoOfChannels)
+        {
+            hFrameResult = ERR_INVALID_CHANNEL;
+        }
+        else if (nWriteMessage(psCanTxMsgs[i], dwClientID) == S_OK)
+        {
+            hFrameResult = S_OK;
+        }
+        if (nullptr != phResults)
+        {
+            phResults[i] = hFrameResult;
+        }
+        if ((S_OK == hResult) && (S_OK != hFrameResult))
+        {
+            hResult = hFrameResult;
+        }
+    }
+    LeaveCriticalSection(&sg_CritSectForWrite); // Unlock the buffer
+
+    return hResult;
+}
+
 /**
 * \brief         Gets bus config info.
 * \param[out]    BusInfo, is BYTE
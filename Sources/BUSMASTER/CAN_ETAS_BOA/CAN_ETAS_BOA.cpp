@@ -35,6 +35,8 @@
 #include "CAN_ETAS_BOA.h"
 #include "BaseDIL_CAN_Controller.h"
 #include "DILPluginHelperDefs.h"
+#include "ClientDispatch.h"
+#include "DeviceTimebase.h"
 
 //#include "DataTypes/Base_WrapperErrorLogger.h"
 //#include "DataTypes/MsgBufAll_DataTypes.h"
@@ -180,8 +182,6 @@ typedef struct tagCHANNEL
 
     OCI_TimerCapabilities m_OCI_TimerCapabilities;
 
-    FLOAT m_fResolution;
-
     /** controller capability of CAN_FD */
     bool m_bSupportCANFD;
 } SCHANNEL;
@@ -216,23 +216,21 @@ public:
 */
 static std::vector<SCLIENTBUFMAP> sg_asClientToBufMap(MAX_CLIENT_ALLOWED);
 
-typedef struct tagAckMap
-{
-    UINT m_MsgID;
-    UINT m_ClientID;
-    UINT m_Channel;
+static CTxEchoMap sg_ouTxEchoMap; // Sending client of each pending Tx message
 
-    BOOL operator == (const tagAckMap& RefObj)
-    {
-        return ((m_MsgID == RefObj.m_MsgID) && (m_Channel == RefObj.m_Channel));
-    }
-} SACK_MAP;
+static CClientDispatch<STCANDATA> sg_ouClientDispatch;
 
-typedef std::list<SACK_MAP> CACK_MAP_LIST;
+static CReorderStage<STCANDATA> sg_ouReorderStage;  // Merges the channels into timestamp order
 
-static CACK_MAP_LIST sg_asAckMapBuf;
+static CDeviceTimebase sg_ouTimebase;               // Maps the timer of each controller into host time
 
-static CRITICAL_SECTION sg_CritSectForAckBuf; // To make it thread safe
+/* The BOA callbacks add to the reorder stage, the flush thread writes the
+   frames that are due to the clients when it gets the DIL lock, so a burst
+   of callbacks is written once */
+static HANDLE sg_hFlushEvent = nullptr;
+static HANDLE sg_hFlushThread = nullptr;
+static volatile LONG sg_lStopFlush = 0;
+#define defFLUSH_THREAD_STOP_WAIT   1000    // ms the flush thread gets to exit
 
 /**
 * Channel instances
@@ -267,7 +265,6 @@ static SCONTROLLER_DETAILS sg_ControllerDetails[defNO_OF_CHANNELS];
 static SYSTEMTIME sg_CurrSysTime;
 static LONGLONG sg_TimeStamp = 0;
 static LARGE_INTEGER sg_QueryTickCount;
-static LARGE_INTEGER sg_lnFrequency;
 
 /* Required libraries */
 static HMODULE sg_hLibCSI = nullptr;
@@ -358,6 +355,8 @@ public:
     HRESULT CAN_ManageMsgBuf(BYTE bAction, DWORD ClientID, CBaseCANBufFSE* pBufObj);
     HRESULT CAN_RegisterClient(BOOL bRegister, DWORD& ClientID, char* pacClientName);
     HRESULT CAN_GetCntrlStatus(const HANDLE& hEvent, UINT& unCntrlStatus);
+    HRESULT CAN_SetReorderHoldTime(UINT unHoldTimeMs);
+    HRESULT CAN_GetReorderStats(SREORDER_STATS& sStats);
     HRESULT CAN_LoadDriverLibrary(void);
     HRESULT CAN_UnloadDriverLibrary(void);
     HRESULT CAN_SetHardwareChannel(PSCONTROLLER_DETAILS,DWORD dwDriverId,bool bIsHardwareListed, unsigned int unChannelCount);
@@ -868,30 +867,6 @@ static DWORD dwGetAvailableClientSlot()
     return nClientId;
 }
 
-/**
-* Pushes an entry into the list at the last position
-*/
-static void vMarkEntryIntoMap(const SACK_MAP& RefObj)
-{
-    sg_asAckMapBuf.push_back(RefObj);
-}
-
-static BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
-{
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    BOOL bResult = FALSE;
-    CACK_MAP_LIST::iterator iResult =
-        find(sg_asAckMapBuf.begin(), sg_asAckMapBuf.end(), RefObj);
-    if (iResult != sg_asAckMapBuf.end())
-    {
-        bResult = TRUE;
-        ClientID = (*iResult).m_ClientID;
-        sg_asAckMapBuf.erase(iResult);
-    }
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-    return bResult;
-}
-
 /**
 * Initialize default values for controller configuration
 *
@@ -1164,9 +1139,10 @@ static HRESULT ManageQueue(BYTE byCode, UINT nChannel)
 }
 
 /**
-* copies from OCI_CANRxMessage struct into STCANDATA struct
+* copies from OCI_CANRxMessage struct into STCANDATA struct. un64HostNs
+* gets the host time of the message in ns.
 */
-static void vCopyOCI_CAN_RX_2_DATA(const OCI_CANRxMessage* SrcMsg, STCANDATA* DestMsg)
+static void vCopyOCI_CAN_RX_2_DATA(const OCI_CANRxMessage* SrcMsg, STCANDATA* DestMsg, UINT64& un64HostNs)
 {
     DestMsg->m_uDataInfo.m_sCANMsg.m_unMsgID = SrcMsg->frameID;
     DestMsg->m_uDataInfo.m_sCANMsg.m_ucDataLen = min(SrcMsg->dlc, 8);
@@ -1180,7 +1156,9 @@ static void vCopyOCI_CAN_RX_2_DATA(const OCI_CANRxMessage* SrcMsg, STCANDATA* De
         Channel = 1; // Take appropriate action
     }
 
-    DestMsg->m_lTickCount.QuadPart = (LONGLONG)(SrcMsg->timeStamp * sg_asChannel[Channel - 1].m_fResolution);
+    /* Every controller has its own timer, map it into the common host time */
+    un64HostNs = sg_ouTimebase.un64GetHostTime(Channel - 1, SrcMsg->timeStamp);
+    DestMsg->m_lTickCount.QuadPart = CDeviceTimebase::n64ToTickCount(un64HostNs);
     memcpy(DestMsg->m_uDataInfo.m_sCANMsg.m_ucData, SrcMsg->data, sizeof(SrcMsg->data));
 }
 
@@ -1211,61 +1189,152 @@ static void vCreateTimeModeMapping(HANDLE hEvent)
     GetLocalTime(&sg_CurrSysTime);
     /* Query Tick Count */
     QueryPerformanceCounter(&sg_QueryTickCount);
+    /* Frame ticks are host time, so the mapping is the host time of sg_CurrSysTime */
+    sg_TimeStamp = CDeviceTimebase::n64ToTickCount(sg_ouTimebase.un64QpcToNs(sg_QueryTickCount.QuadPart));
+}
+
+/**
+* Writes the collected messages into the buffers of all clients.
+* The caller holds sg_DIL_CriticalSection.
+*/
+static void vWriteBatchToClients(void)
+{
+    for (UINT i = 0; i < sg_unClientCnt; ++i)
+    {
+        sg_ouClientDispatch.vWriteClient(sg_asClientToBufMap[i].m_dwClientID,
+                                         sg_asClientToBufMap[i].m_pClientBuf,
+                                         sg_asClientToBufMap[i].m_unBufCount);
+    }
+    sg_ouClientDispatch.vClearBatch();
+}
+
+/**
+* Takes the frames the reorder stage releases into the batch, a full batch
+* is written to the clients at once.
+*/
+struct sBOA_DISPATCH
+{
+    void vAddFrame(const STCANDATA& sData, DWORD dwSenderID)
+    {
+        sg_ouClientDispatch.vAddFrame(sData, dwSenderID);
+    }
+    bool bIsFull(void) const
+    {
+        return sg_ouClientDispatch.bIsFull();
+    }
+    void vFlush(SCLIENTBUFMAP* /*psClients*/, UINT /*unClientCount*/)
+    {
+        vWriteBatchToClients();
+    }
+};
+
+/**
+* Writes the messages that are due in the reorder stage to the clients,
+* bAll writes all held messages. The caller holds sg_DIL_CriticalSection.
+*/
+static void vFlushClientsBuffer(bool bAll = false)
+{
+    sBOA_DISPATCH sDispatch;
+    sg_ouReorderStage.vRelease(sDispatch, &sg_asClientToBufMap[0], sg_unClientCnt, bAll);
+    vWriteBatchToClients();
 }
 
 /**
-* This function writes the message to the corresponding clients buffer
+* This function queues the message in the reorder stage, merged by its host
+* time un64HostNs. BOA calls back for every single message of a channel, the
+* flush thread writes them in timestamp order as soon as they are due and it
+* gets the DIL lock.
 */
-static void vWriteIntoClientsBuffer(STCANDATA& sCanData)
+static void vWriteIntoClientsBuffer(STCANDATA& sCanData, UINT64 un64HostNs)
 {
-    /* Write into the client's buffer and Increment message Count */
-    if (sCanData.m_ucDataType == TX_FLAG)
+    UINT ClientId = 0;
+    /* Tx messages are only given to the clients if the sender is known */
+    if ((sCanData.m_ucDataType == TX_FLAG) &&
+            !sg_ouTxEchoMap.bRemoveEntry(sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                         sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID, ClientId))
+    {
+        return;
+    }
+    sg_ouReorderStage.vAddFrame(sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel - 1, sCanData, ClientId, un64HostNs);
+    if (sg_hFlushThread == nullptr)
+    {
+        vFlushClientsBuffer(true);
+    }
+    else
     {
-        static SACK_MAP sAckMap;
-        UINT ClientId = 0;
-        static UINT Index = (UINT)-1;
-        sAckMap.m_Channel = sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;
-        sAckMap.m_MsgID = sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID;
+        SetEvent(sg_hFlushEvent);
+    }
+}
 
-        if (bRemoveMapEntry(sAckMap, ClientId))
+/**
+* Flush thread, writes the messages of the BOA callbacks. Wakes up on every
+* callback and when the oldest held message is due.
+*/
+static DWORD WINAPI FlushThreadProc(LPVOID /*pVoid*/)
+{
+    DWORD dwWait = INFINITE;
+    while (true)
+    {
+        DWORD dwResult = WaitForSingleObject(sg_hFlushEvent, dwWait);
+        if ((dwResult != WAIT_OBJECT_0) && (dwResult != WAIT_TIMEOUT))
         {
-            BOOL bClientExists = bGetClientObj(ClientId, Index);
-            for (UINT i = 0; i < sg_unClientCnt; i++)
-            {
-                /* Tx for monitor nodes and sender node */
-                if (bClientExists && (i == Index))
-                {
-                    for (UINT j = 0; j < sg_asClientToBufMap[i].m_unBufCount; ++j)
-                    {
-                        sg_asClientToBufMap[i].m_pClientBuf[j]->WriteIntoBuffer(&sCanData);
-                    }
-                }
-                else
-                {
-                    /* Send the other nodes as Rx. */
-                    for (UINT j = 0; j < sg_asClientToBufMap[i].m_unBufCount; ++j)
-                    {
-                        static STCANDATA sTempCanData;
-                        sTempCanData = sCanData;
-                        sTempCanData.m_ucDataType = RX_FLAG;
-                        sg_asClientToBufMap[i].m_pClientBuf[j]->WriteIntoBuffer(&sTempCanData);
-                    }
-                }
-            }
+            break;
+        }
+        EnterCriticalSection(&sg_DIL_CriticalSection);
+        vFlushClientsBuffer();
+        dwWait = sg_ouReorderStage.dwGetWaitTime();
+        LeaveCriticalSection(&sg_DIL_CriticalSection);
+        if (sg_lStopFlush != 0)
+        {
+            break;
         }
     }
-    else // provide it to everybody
+    return 0;
+}
+
+/**
+* Starts the flush thread on connect.
+*/
+static void vStartFlushThread(void)
+{
+    if (sg_hFlushThread == nullptr)
     {
-        for (UINT i = 0; i < sg_unClientCnt; ++i)
+        sg_ouReorderStage.vInit(sg_nNoOfChannels);
+        InterlockedExchange(&sg_lStopFlush, 0);
+        sg_hFlushEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        if (sg_hFlushEvent != nullptr)
         {
-            for (UINT j = 0; j < sg_asClientToBufMap[i].m_unBufCount; ++j)
-            {
-                sg_asClientToBufMap[i].m_pClientBuf[j]->WriteIntoBuffer(&sCanData);
-            }
+            sg_hFlushThread = CreateThread(nullptr, 0, FlushThreadProc, nullptr, 0, nullptr);
         }
     }
 }
 
+/**
+* Stops the flush thread on disconnect, the held messages are written before.
+*/
+static void vStopFlushThread(void)
+{
+    if (sg_hFlushThread != nullptr)
+    {
+        InterlockedExchange(&sg_lStopFlush, 1);
+        SetEvent(sg_hFlushEvent);
+        if (WaitForSingleObject(sg_hFlushThread, defFLUSH_THREAD_STOP_WAIT) != WAIT_OBJECT_0)
+        {
+            TerminateThread(sg_hFlushThread, 0);
+        }
+        CloseHandle(sg_hFlushThread);
+        sg_hFlushThread = nullptr;
+    }
+    if (sg_hFlushEvent != nullptr)
+    {
+        CloseHandle(sg_hFlushEvent);
+        sg_hFlushEvent = nullptr;
+    }
+    EnterCriticalSection(&sg_DIL_CriticalSection);
+    vFlushClientsBuffer(true);
+    LeaveCriticalSection(&sg_DIL_CriticalSection);
+}
+
 /**
 * Processes Rx msg and writes into regiastered clients buffer.
 */
@@ -1279,6 +1348,7 @@ static void vProcessRxMsg(void* userData, struct OCI_CANMessage* msg)
     EnterCriticalSection(&sg_DIL_CriticalSection);
 
     static STCANDATA sCanData;
+    static UINT64 un64HostNs = 0;
     static OCI_ControllerHandle hHandle;
 
     hHandle = (OCI_ControllerHandle)userData;
@@ -1287,35 +1357,20 @@ static void vProcessRxMsg(void* userData, struct OCI_CANMessage* msg)
     if ( msg->type == OCI_CAN_RX_MESSAGE )
     {
         // sCanData.m_uDataInfo.m_sCANMsg.m_bCANFDMsg = false;
-        vCopyOCI_CAN_RX_2_DATA(&(msg->data.rxMessage), &sCanData);
+        vCopyOCI_CAN_RX_2_DATA(&(msg->data.rxMessage), &sCanData, un64HostNs);
         sCanData.m_uDataInfo.m_sCANMsg.m_bCANFD = false;
     }
 
     if (sg_byCurrState == CREATE_MAP_TIMESTAMP)
     {
-        // sg_TimeStamp = sCanData.m_lTickCount.QuadPart;
+        /* Message ticks are host time already, no device offset to apply */
         SetEvent(sg_hEvent);
         vCreateTimeModeMapping(sg_hEvent);
         sg_byCurrState = CALC_TIMESTAMP_READY;
-
-        LARGE_INTEGER g_QueryTickCount;
-        QueryPerformanceCounter(&g_QueryTickCount);
-        LONGLONG unConnectionTime;
-        unConnectionTime = ((g_QueryTickCount.QuadPart * 10000) / sg_lnFrequency.QuadPart) - sg_TimeStamp;
-
-        /* Time difference should be +ve value */
-        if(sCanData.m_lTickCount.QuadPart >= unConnectionTime)
-        {
-            sg_TimeStamp  = sCanData.m_lTickCount.QuadPart - unConnectionTime;
-        }
-        else
-        {
-            sg_TimeStamp  = unConnectionTime - sCanData.m_lTickCount.QuadPart;
-        }
     }
 
     /* Write the msg into registered client's buffer */
-    vWriteIntoClientsBuffer(sCanData);
+    vWriteIntoClientsBuffer(sCanData, un64HostNs);
 
     LeaveCriticalSection(&sg_DIL_CriticalSection);
 }
@@ -1338,7 +1393,6 @@ static void vCopyOCI_CAN_ERR_2_DATA(const OCI_CANErrorFrameMessage* SrcMsg, STCA
 {
     DestMsg->m_uDataInfo.m_sCANMsg.m_unMsgID = SrcMsg->frameID;
     DestMsg->m_uDataInfo.m_sCANMsg.m_ucDataLen = SrcMsg->dlc;
-    DestMsg->m_lTickCount.QuadPart = SrcMsg->timeStamp;
     DestMsg->m_uDataInfo.m_sCANMsg.m_ucEXTENDED = (SrcMsg->flags & OCI_CAN_MSG_FLAG_EXTENDED) ? 1 : 0;
     DestMsg->m_uDataInfo.m_sCANMsg.m_ucRTR = (SrcMsg->flags & OCI_CAN_MSG_FLAG_REMOTE_FRAME) ? 1 : 0;
     DestMsg->m_ucDataType = ERR_FLAG;
@@ -1425,6 +1479,12 @@ static void vProcessErrMsg(void* userData, struct OCI_CANMessage* msg)
     sCanData.m_uDataInfo.m_sCANMsg.m_ucDataLen = 0;
     sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel = (UCHAR)nGetChannel((OCI_ControllerHandle)userData);
     sCanData.m_uDataInfo.m_sErrInfo.m_ucChannel = sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;
+    /* The Rx callback feeds the same timebase source under the DIL lock */
+    EnterCriticalSection(&sg_DIL_CriticalSection);
+    sCanData.m_lTickCount.QuadPart = CDeviceTimebase::n64ToTickCount(
+                                         sg_ouTimebase.un64GetHostTime(sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel - 1,
+                                                 msg->data.errorFrameMessage.timeStamp));
+    LeaveCriticalSection(&sg_DIL_CriticalSection);
 
     /*  Update channel error counter */
     vUpdateErrorCounter(sCanData.m_uDataInfo.m_sErrInfo.m_ucTxErrCount,
@@ -1718,6 +1778,25 @@ HRESULT CDIL_CAN_ETAS_BOA::CAN_GetCntrlStatus(const HANDLE& /*hEvent*/, UINT& un
     return S_OK;
 }
 
+/**
+* Sets the longest time received messages are held back to merge the
+* channels into timestamp order, 0 passes them on as BOA calls back.
+*/
+HRESULT CDIL_CAN_ETAS_BOA::CAN_SetReorderHoldTime(UINT unHoldTimeMs)
+{
+    sg_ouReorderStage.vSetHoldTime(unHoldTimeMs);
+    return S_OK;
+}
+
+/**
+* Gets the reorder depth and late arrival counters.
+*/
+HRESULT CDIL_CAN_ETAS_BOA::CAN_GetReorderStats(SREORDER_STATS& sStats)
+{
+    sg_ouReorderStage.vGetStats(sStats);
+    return S_OK;
+}
+
 HRESULT CDIL_CAN_ETAS_BOA::CAN_LoadDriverLibrary(void)
 {
     HRESULT hResult = S_FALSE;
@@ -2188,12 +2267,7 @@ HRESULT CDIL_CAN_ETAS_BOA::CAN_SelectHwInterface(const INTERFACE_HW_LIST& asSelH
                     {
 						hResult = (*(sBOA_PTRS.m_sOCI.timeVTable.getTimerCapabilities))(sg_asChannel[nChannelIndex].m_OCI_HwHandle,
 							&(sg_asChannel[nChannelIndex].m_OCI_TimerCapabilities));
-                        if (hResult == S_OK)
-                        {
-							sg_asChannel[nChannelIndex].m_fResolution = (float)10000 /
-								(float)(sg_asChannel[nChannelIndex].m_OCI_TimerCapabilities.tickFrequency);
-                        }
-                        else
+                        if (hResult != S_OK)
                         {
                             hResult = ERR_LOAD_HW_INTERFACE;
                         }
@@ -2391,25 +2465,17 @@ HRESULT CDIL_CAN_ETAS_BOA::CAN_StartHardware(void)
     if (hResult == S_OK)
     {
         sg_bCurrState = STATE_CONNECTED;
+        /* OCI timestamps are 64 bit, each controller reports its tick frequency */
+        sg_ouTimebase.vInit(sg_nNoOfChannels, 0, 64);
+        for (UINT i = 0; i < sg_nNoOfChannels; i++)
+        {
+            sg_ouTimebase.vSetTicksPerSec(i, sg_asChannel[i].m_OCI_TimerCapabilities.tickFrequency);
+        }
         SetEvent(sg_hEvent);
         vCreateTimeModeMapping(sg_hEvent);
 
-        InitializeCriticalSection(&sg_CritSectForAckBuf);
-
-        QueryPerformanceCounter(&sg_QueryTickCount);
-
-        /* Get frequency of the performance counter */
-        QueryPerformanceFrequency(&sg_lnFrequency);
-
-        /* Convert it to time stamp with the granularity of hundreds of microsecond */
-        if ((sg_QueryTickCount.QuadPart * 10000) > sg_lnFrequency.QuadPart)
-        {
-            sg_TimeStamp = (sg_QueryTickCount.QuadPart * 10000) / sg_lnFrequency.QuadPart;
-        }
-        else
-        {
-            sg_TimeStamp = (sg_QueryTickCount.QuadPart / sg_lnFrequency.QuadPart) * 10000;
-        }
+        sg_ouTxEchoMap.vClear();
+        vStartFlushThread();
     }
 
     return hResult;
@@ -2452,9 +2518,10 @@ HRESULT CDIL_CAN_ETAS_BOA::CAN_StopHardware(void)
     /* Check for the success */
     if (hResult == S_OK)
     {
+        vStopFlushThread();
+        sg_ouTxEchoMap.vClear();
         sg_byCurrState = CREATE_MAP_TIMESTAMP;
         sg_bCurrState = STATE_HW_INTERFACE_SELECTED;
-        DeleteCriticalSection(&sg_CritSectForAckBuf);
     }
 
     return hResult;
@@ -2479,21 +2546,15 @@ HRESULT CDIL_CAN_ETAS_BOA::CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTx
 			OCI_CANMessage sOciCanMsg;
 
 			OCI_CANTxMessage sOciTxCanMsg;
-			SACK_MAP sAckMap;
 			vCopy_2_OCI_CAN_Data(sOciTxCanMsg, sCanTxMsg);
 			sOciCanMsg.type = OCI_CAN_TX_MESSAGE;
 			sOciCanMsg.reserved = 0;
 			uint32 nRemaining = 0;
 			memcpy(&(sOciCanMsg.data.txMessage), &(sOciTxCanMsg), sizeof(OCI_CANTxMessage));
-			sAckMap.m_ClientID = dwClientID;
-			sAckMap.m_Channel = sCanTxMsg.m_ucChannel;
-			sAckMap.m_MsgID = sOciCanMsg.data.txMessage.frameID;
-			EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
 			if (sg_asChannel[sCanTxMsg.m_ucChannel - 1].m_OCI_CANConfig.selfReceptionMode == OCI_SELF_RECEPTION_ON)
 			{
-				vMarkEntryIntoMap(sAckMap);
+				sg_ouTxEchoMap.vAddEntry(sCanTxMsg.m_ucChannel, sOciCanMsg.data.txMessage.frameID, dwClientID);
 			}
-			LeaveCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
 			BOA_ResultCode ErrCode;
 
 			ErrCode = (*(sBOA_PTRS.m_sOCI.canioVTable.writeCANData))
@@ -34,6 +34,7 @@
 #include "CAN_ICS_neoVI_Channel.h"
 #include "CAN_ICS_neoVI_Network.h"
 #include "Utility/Utility_Thread.h"
+#include "ClientDispatch.h"
 //#include "Include/DIL_CommonDefs.h"
 #include "EXTERNAL/icsnVC40.h"
 //#include "DIL_Interface/BaseDIL_CAN_Controller.h"
@@ -141,21 +142,8 @@ typedef tagClientBufMap sClientBufMap;
 typedef sClientBufMap SCLIENTBUFMAP;
 typedef sClientBufMap* PSCLIENTBUFMAP;
 
-typedef struct tagAckMap
-{
-    UINT m_MsgID;
-    UINT m_ClientID;
-    UINT m_Channel;
-
-    BOOL operator == (const tagAckMap& RefObj)const
-    {
-        return ((m_MsgID == RefObj.m_MsgID) && (m_Channel == RefObj.m_Channel));
-    }
-} SACK_MAP;
-
-static  CRITICAL_SECTION sg_CritSectForAckBuf;       // To make it thread safe
-typedef std::list<SACK_MAP> CACK_MAP_LIST;
-static CACK_MAP_LIST sg_asAckMapBuf;
+static CTxEchoMap sg_ouTxEchoMap;                   // Sending client of each pending Tx message
+static CClientDispatch<STCANDATA> sg_ouClientDispatch;
 
 /**
  * Starts code for the state machine
@@ -1103,80 +1091,23 @@ static BOOL bRemoveClientBuffer(CBaseCANBufFSE* RootBufferArray[MAX_BUFF_ALLOWED
     return bReturn;
 }
 
-void vMarkEntryIntoMap(const SACK_MAP& RefObj)
-{
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    sg_asAckMapBuf.push_back(RefObj);
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-}
-
-BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
-{
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    BOOL bResult = FALSE;
-    CACK_MAP_LIST::iterator  iResult =
-        std::find( sg_asAckMapBuf.begin(), sg_asAckMapBuf.end(), RefObj );
-    //if ((*iResult).m_ClientID > 0)
-    if (iResult != sg_asAckMapBuf.end())
-    {
-        bResult = TRUE;
-        ClientID = (*iResult).m_ClientID;
-        sg_asAckMapBuf.erase(iResult);
-    }
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-    return bResult;
-}
-
 /**
- * This function writes the message to the corresponding clients buffer
+ * This function queues the message for the corresponding clients buffer
  */
 static void vWriteIntoClientsBuffer(STCANDATA& sCanData)
 {
-    //Write into the client's buffer and Increment message Count
-    if (sCanData.m_ucDataType == TX_FLAG)
+    UINT ClientId = 0;
+    //Tx messages are only given to the clients if the sender is known
+    if ((sCanData.m_ucDataType == TX_FLAG) &&
+            !sg_ouTxEchoMap.bRemoveEntry(sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                         sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID, ClientId))
     {
-        static SACK_MAP sAckMap;
-        UINT ClientId = 0;
-        static UINT Index = (UINT)-1;
-        sAckMap.m_Channel = sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;
-        sAckMap.m_MsgID = sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID;
-
-        if (bRemoveMapEntry(sAckMap, ClientId))
-        {
-            BOOL bClientExists = bGetClientObj(ClientId, Index);
-            for (UINT i = 0; i < sg_unClientCnt; i++)
-            {
-                //Tx for sender node
-                if (/*(i == CAN_MONITOR_NODE_INDEX)  || */(bClientExists && (i == Index)))
-                {
-                    for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-                    {
-                        sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sCanData);
-                    }
-                }
-                else
-                {
-                    //Send the other nodes as Rx.
-                    for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-                    {
-                        static STCANDATA sTempCanData;
-                        sTempCanData = sCanData;
-                        sTempCanData.m_ucDataType = RX_FLAG;
-                        sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sTempCanData);
-                    }
-                }
-            }
-        }
+        return;
     }
-    else // provide it to everybody
+    sg_ouClientDispatch.vAddFrame(sCanData, ClientId);
+    if (sg_ouClientDispatch.bIsFull())
     {
-        for (UINT i = 0; i < sg_unClientCnt; i++)
-        {
-            for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-            {
-                sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sCanData);
-            }
-        }
+        sg_ouClientDispatch.vFlush(sg_asClientToBufMap, sg_unClientCnt);
     }
 }
 
@@ -1192,6 +1123,7 @@ static void ProcessCANMsg(int nChannelIndex)
         {
             vWriteIntoClientsBuffer(sg_asMsgBuffer[unCount]);
         }
+        sg_ouClientDispatch.vFlush(sg_asClientToBufMap, sg_unClientCnt);
     }
 }
 
@@ -2119,11 +2051,7 @@ static int nConnect(BOOL bConnect, BYTE /*hClient*/)
     }
     if ( sg_bIsConnected )
     {
-        InitializeCriticalSection(&sg_CritSectForAckBuf);
-    }
-    else
-    {
-        DeleteCriticalSection(&sg_CritSectForAckBuf);
+        sg_ouTxEchoMap.vClear();
     }
     return nReturn;
 }
@@ -2921,18 +2849,14 @@ static int nWriteMessage(STCAN_MSG sMessage)
 HRESULT CDIL_CAN_ICSNeoVI::CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sMessage)
 {
     VALIDATE_VALUE_RETURN_VAL(sg_bCurrState, STATE_CONNECTED, ERR_IMPROPER_STATE);
-    static SACK_MAP sAckMap;
     HRESULT hResult = S_FALSE;
     if (bClientIdExist(dwClientID))
     {
         if (sMessage.m_ucChannel <= sg_ucNoOfHardware)
         {
-            sAckMap.m_ClientID = dwClientID;
-            sAckMap.m_MsgID = sMessage.m_unMsgID;
-            sAckMap.m_Channel = sMessage.m_ucChannel;
             /*Mark an entry in Map. This is helpful to idendify
               which client has been sent this message in later stage*/
-            vMarkEntryIntoMap(sAckMap);
+            sg_ouTxEchoMap.vAddEntry(sMessage.m_ucChannel, sMessage.m_unMsgID, dwClientID);
             if (nWriteMessage(sMessage) == S_OK)
             {
                 hResult = S_OK;
@@ -28,6 +28,7 @@
 //#include "DIL_Interface/BaseDIL_CAN_Controller.h"
 #include "BaseDIL_CAN_Controller.h"
 #include "DILPluginHelperDefs.h"
+#include "ClientDispatch.h"
 #define USAGE_EXPORT
 #include "CAN_ISOLAR_EVE_VCAN_Extern.h"
 
@@ -35,6 +36,7 @@ BEGIN_MESSAGE_MAP(CISOLAR_EVE_VCAN, CWinApp)
 END_MESSAGE_MAP()
 
 static STCANDATA sg_EVE_CANMsg;
+static CClientDispatch<STCANDATA> sg_ouClientDispatch;
 
 CISOLAR_EVE_VCAN::CISOLAR_EVE_VCAN()
 {
@@ -93,48 +95,9 @@ public:
 };
 
 /**
-* \brief         Function to store the Tx message entry into sg_asAckMapBuf list.
-* \param[in]     RefObj, is SACK_MAP entry
-* \return        void
-* \authors       Arunkumar Karri
-* \date          12.10.2011 Created
-*/
-void vMarkEntryIntoMap(const SACK_MAP& RefObj)
-{
-    //EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    sg_asAckMapBuf.push_back(RefObj);
-    //LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-}
-
-/**
-* \brief         Function to retreive the Tx message entry from sg_asAckMapBuf list and delete.
-*                Also returns the respective client ID.
-* \param[in]     RefObj, is SACK_MAP entry to find and delete
-* \param[out]    ClientID, is client ID of the RefObj found
-* \return        TRUE if RefObj is found, else FALSE
-* \authors       Arunkumar Karri
-* \date          12.10.2011 Created
-*/
-BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
-{
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    BOOL bResult = FALSE;
-    CACK_MAP_LIST::iterator  iResult =
-        std::find( sg_asAckMapBuf.begin(), sg_asAckMapBuf.end(), RefObj );
-
-    //if ((*iResult).m_ClientID > 0)
-    if (iResult != sg_asAckMapBuf.end())
-    {
-        bResult = TRUE;
-        ClientID = (*iResult).m_ClientID;
-        sg_asAckMapBuf.erase(iResult);
-    }
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-    return bResult;
-}
-
-/**
-* \brief         Writes the message 'sCanData' to the corresponding clients buffer
+* \brief         Writes the message 'sCanData' to the corresponding clients buffer.
+*                EVE reports the type of the message itself, so there is no
+*                Tx message to match with its sender.
 * \param[out]    sCanData, is STCANDATA structure
 * \return        void
 * \authors       Arunkumar Karri
@@ -142,19 +105,8 @@ BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
 */
 static void vWriteIntoClientsBuffer(STCANDATA& sCanData)
 {
-    //Write into the client's buffer and Increment message Count
-    static SACK_MAP sAckMap;
-    sAckMap.m_Channel = sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;
-    sAckMap.m_MsgID = sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID;
-
-    for (UINT i = 0; i < sg_unClientCnt; i++)
-    {
-        for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-        {
-            sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sCanData);
-        }
-    }
-
+    sg_ouClientDispatch.vAddFrame(sCanData, 0);
+    sg_ouClientDispatch.vFlush(sg_asClientToBufMap, sg_unClientCnt);
 }
 
 /**
@@ -30,6 +30,9 @@
 //#include "DataTypes/MsgBufAll_DataTypes.h"
 //#include "DataTypes/DIL_Datatypes.h"
 #include "Utility/Utility_Thread.h"
+#include "ClientDispatch.h"
+#include "DeviceTimebase.h"
+#include "ReorderStage.h"
 //#include "Include/BaseDefs.h"
 //#include "Include/DIL_CommonDefs.h"
 //#include "Include/CanUsbDefs.h"
@@ -142,39 +145,20 @@ BYTE sg_bCurrState = STATE_DRIVER_SELECTED;
 static SYSTEMTIME sg_CurrSysTime;
 static UINT64 sg_TimeStamp = 0;
 
-enum
-{
-    CREATE_MAP_TIMESTAMP = 0x1,
-    CALC_TIMESTAMP_READY = 0x2,
-};
-
-/**
- * Current state machine
- */
-static BYTE sg_byCurrState = CREATE_MAP_TIMESTAMP;
-
-typedef struct tagAckMap
-{
-    UINT m_MsgID;
-    UINT m_ClientID;
-    UINT m_Channel;
-
-    BOOL operator == (const tagAckMap& RefObj)const
-    {
-        return ((m_MsgID == RefObj.m_MsgID) && (m_Channel == RefObj.m_Channel));
-    }
-} SACK_MAP;
-
 static  CRITICAL_SECTION sg_CritSectForAckBuf;       // To make it thread safe
-typedef std::list<SACK_MAP> CACK_MAP_LIST;
-static CACK_MAP_LIST sg_asAckMapBuf;
+static CTxEchoMap sg_ouTxEchoMap;                   // Sending client of each pending Tx message
+static CClientDispatch<STCANDATA> sg_ouClientDispatch;
+static CDeviceTimebase sg_ouTimebase;               // Maps the timer of each read handle into host time
+static CReorderStage<STCANDATA> sg_ouReorderStage;  // Merges the channels into timestamp order
+
+#define defTIMER_SCALE_US       1                   // Resolution of the read handle timestamps in microseconds
+#define defTIMER_SCALE_DEF_US   1000                // CANLIB default resolution
 
 
 /**
  * Query Tick Count
  */
 static LARGE_INTEGER sg_QueryTickCount;
-static LARGE_INTEGER sg_lnFrequency;
 
 /**
  * Channel information
@@ -358,6 +342,8 @@ public:
     HRESULT CAN_ManageMsgBuf(BYTE bAction, DWORD ClientID, CBaseCANBufFSE* pBufObj);
     HRESULT CAN_RegisterClient(BOOL bRegister, DWORD& ClientID, char* pacClientName);
     HRESULT CAN_GetCntrlStatus(const HANDLE& hEvent, UINT& unCntrlStatus);
+    HRESULT CAN_SetReorderHoldTime(UINT unHoldTimeMs);
+    HRESULT CAN_GetReorderStats(SREORDER_STATS& sStats);
     HRESULT CAN_LoadDriverLibrary(void);
     HRESULT CAN_UnloadDriverLibrary(void);
     HRESULT CAN_SetHardwareChannel(PSCONTROLLER_DETAILS,DWORD dwDriverId,bool bIsHardwareListed, unsigned int unChannelCount);
@@ -602,6 +588,29 @@ HRESULT CDIL_CAN_Kvaser::CAN_GetCntrlStatus(const HANDLE& /*hEvent*/, UINT& /*un
     return WARN_DUMMY_API;
 }
 
+/**
+* \brief         Sets the longest time received messages are held back to
+*                merge the channels into timestamp order.
+* \param[in]     unHoldTimeMs, hold time in milliseconds, 0 to pass them on as read
+* \return        S_OK
+*/
+HRESULT CDIL_CAN_Kvaser::CAN_SetReorderHoldTime(UINT unHoldTimeMs)
+{
+    sg_ouReorderStage.vSetHoldTime(unHoldTimeMs);
+    return S_OK;
+}
+
+/**
+* \brief         Gets the reorder depth and late arrival counters.
+* \param[out]    sStats, is SREORDER_STATS structure
+* \return        S_OK
+*/
+HRESULT CDIL_CAN_Kvaser::CAN_GetReorderStats(SREORDER_STATS& sStats)
+{
+    sg_ouReorderStage.vGetStats(sStats);
+    return S_OK;
+}
+
 /**
 * \brief         Performs intial operations.
 *                Initializes filter, queue, controller config with default values.
@@ -1089,100 +1098,34 @@ HRESULT CDIL_CAN_Kvaser::CAN_SetConfigData(PSCONTROLLER_DETAILS ConfigFile, int
 }
 
 /**
-* \brief         Function to store the Tx message entry into sg_asAckMapBuf list.
-* \param[in]     RefObj, is SACK_MAP entry
+* \brief         Queues the message 'sCanData' for the clients buffer. The
+*                sender of an acknowledgement message gets it as Tx, the
+*                other clients as Rx. The message waits in the reorder stage
+*                until vFlushClientsBuffer finds it due.
+* \param[out]    sCanData, is STCANDATA structure
+* \param[in]     un64HostNs, host time of the message in ns, merges it at
+*                full resolution
 * \return        void
 * \authors       Arunkumar Karri
 * \date          12.10.2011 Created
 */
-void vMarkEntryIntoMap(const SACK_MAP& RefObj)
-{
-    //EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    sg_asAckMapBuf.push_back(RefObj);
-    //LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-}
-
-/**
-* \brief         Function to retreive the Tx message entry from sg_asAckMapBuf list and delete.
-*                Also returns the respective client ID.
-* \param[in]     RefObj, is SACK_MAP entry to find and delete
-* \param[out]    ClientID, is client ID of the RefObj found
-* \return        TRUE if RefObj is found, else FALSE
-* \authors       Arunkumar Karri
-* \date          12.10.2011 Created
-*/
-BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
+static void vWriteIntoClientsBuffer(STCANDATA& sCanData, UINT64 un64HostNs)
 {
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    BOOL bResult = FALSE;
-    CACK_MAP_LIST::iterator  iResult =
-        std::find( sg_asAckMapBuf.begin(), sg_asAckMapBuf.end(), RefObj );
-
-    //if ((*iResult).m_ClientID > 0)
-    if (iResult != sg_asAckMapBuf.end())
-    {
-        bResult = TRUE;
-        ClientID = (*iResult).m_ClientID;
-        sg_asAckMapBuf.erase(iResult);
-    }
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-    return bResult;
+    UINT unSenderID = 0;
+    UCHAR ucChannel = sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;
+    sg_ouTxEchoMap.bRemoveEntry(ucChannel, sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID, unSenderID);
+    sg_ouReorderStage.vAddFrame(ucChannel - 1, sCanData, unSenderID, un64HostNs);
 }
 
 /**
-* \brief         Writes the message 'sCanData' to the corresponding clients buffer
-* \param[out]    sCanData, is STCANDATA structure
+* \brief         Writes the messages that are due to the clients buffer
+* \param[in]     bAll, true to write all held messages
 * \return        void
-* \authors       Arunkumar Karri
-* \date          12.10.2011 Created
 */
-static void vWriteIntoClientsBuffer(STCANDATA& sCanData)
+static void vFlushClientsBuffer(bool bAll = false)
 {
-    //Write into the client's buffer and Increment message Count
-    static SACK_MAP sAckMap;
-    UINT ClientId = 0;
-    static UINT Index = (UINT)-1;
-    sAckMap.m_Channel = sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;
-    sAckMap.m_MsgID = sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID;
-
-    //Check if it is an acknowledgement message
-    if (bRemoveMapEntry(sAckMap, ClientId))
-    {
-        BOOL bClientExists = bGetClientObj(ClientId, Index);
-        for (UINT i = 0; i < sg_unClientCnt; i++)
-        {
-            //Tx for sender node
-            if (/*(i == CAN_MONITOR_NODE_INDEX)  ||*/ (bClientExists && (i == Index)))
-            {
-                sCanData.m_ucDataType = TX_FLAG;
-                for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-                {
-                    sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sCanData);
-                }
-            }
-            else
-            {
-                //Send the other nodes as Rx.
-                for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-                {
-                    static STCANDATA sTempCanData;
-                    sTempCanData = sCanData;
-                    sTempCanData.m_ucDataType = RX_FLAG;
-                    sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sTempCanData);
-                }
-            }
-        }
-    }
-    else // provide it to everybody
-    {
-        for (UINT i = 0; i < sg_unClientCnt; i++)
-        {
-            for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-            {
-                sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sCanData);
-            }
-        }
-    }
+    sg_ouReorderStage.vRelease(sg_ouClientDispatch, sg_asClientToBufMap, sg_unClientCnt, bAll);
+    sg_ouClientDispatch.vFlush(sg_asClientToBufMap, sg_unClientCnt);
 }
 
 /**
@@ -1264,6 +1207,8 @@ static void vCreateTimeModeMapping(HANDLE hDataEvent)
     GetLocalTime(&sg_CurrSysTime);
     /*Query Tick Count*/
     QueryPerformanceCounter(&sg_QueryTickCount);
+    /* Frame ticks are host time, so the mapping is the host time of sg_CurrSysTime */
+    sg_TimeStamp = CDeviceTimebase::n64ToTickCount(sg_ouTimebase.un64QpcToNs(sg_QueryTickCount.QuadPart));
 }
 
 /**
@@ -1277,31 +1222,9 @@ static void vCreateTimeModeMapping(HANDLE hDataEvent)
 */
 static void ProcessCANMsg(int nChannelIndex, UINT& nFlags, DWORD& dwTime)
 {
-    static LONGLONG QuadPartRef = 0;
-    if (CREATE_MAP_TIMESTAMP == sg_byCurrState)
-    {
-        QuadPartRef = (LONGLONG)dwTime *10;
-        sg_byCurrState = CALC_TIMESTAMP_READY;
-
-        LARGE_INTEGER g_QueryTickCount;
-        QueryPerformanceCounter(&g_QueryTickCount);
-        UINT64 unConnectionTime;
-        unConnectionTime = ((g_QueryTickCount.QuadPart * 10000) / sg_lnFrequency.QuadPart) - sg_TimeStamp;
-        //Time difference should be +ve value
-        if((dwTime * 10) >= unConnectionTime)
-        {
-            sg_TimeStamp  = (LONGLONG)((dwTime * 10) - unConnectionTime);
-        }
-        else
-        {
-            sg_TimeStamp  = (LONGLONG)(unConnectionTime - (dwTime * 10));
-        }
-
-    }
-
-    sg_asCANMsg.m_lTickCount.QuadPart = (LONGLONG)(dwTime * 10);
-    /*sg_asCANMsg.m_lTickCount.QuadPart =
-                           _abs64(sg_asCANMsg.m_lTickCount.QuadPart - QuadPartRef);*/
+    /* Every channel has its own device timer, map it into the common host time */
+    UINT64 un64HostNs = sg_ouTimebase.un64GetHostTime(nChannelIndex, dwTime);
+    sg_asCANMsg.m_lTickCount.QuadPart = CDeviceTimebase::n64ToTickCount(un64HostNs);
     /*Set CAN FD to false*/
     sg_asCANMsg.m_uDataInfo.m_sCANMsg.m_bCANFD = false;
 
@@ -1375,7 +1298,7 @@ static void ProcessCANMsg(int nChannelIndex, UINT& nFlags, DWORD& dwTime)
 
 
     //Write into client buffer.
-    vWriteIntoClientsBuffer(sg_asCANMsg);
+    vWriteIntoClientsBuffer(sg_asCANMsg, un64HostNs);
 }
 
 /**
@@ -1414,6 +1337,22 @@ DWORD WINAPI CanMsgReadThreadProc_CAN_Kvaser_CAN(LPVOID pVoid)
             g_hDataEvent[i] = tmp;
         }
     }
+    //Read the timestamps with microsecond resolution, or in milliseconds if a device can't
+    DWORD dwTimerScale = defTIMER_SCALE_US;
+    for (UINT i = 0; i < sg_nNoOfChannels; i++)
+    {
+        if (canIoCtl(sg_arrReadHandles[i], canIOCTL_SET_TIMER_SCALE, &dwTimerScale, sizeof(dwTimerScale)) != canOK)
+        {
+            dwTimerScale = defTIMER_SCALE_DEF_US;
+            for (UINT j = 0; j < i; j++)
+            {
+                canIoCtl(sg_arrReadHandles[j], canIOCTL_SET_TIMER_SCALE, &dwTimerScale, sizeof(dwTimerScale));
+            }
+            break;
+        }
+    }
+    sg_ouTimebase.vInit(sg_nNoOfChannels, 1000000 / dwTimerScale, 32);
+    sg_ouReorderStage.vInit(sg_nNoOfChannels);
     //Apply filters for read handles
     nSetFilter(false);
 
@@ -1431,7 +1370,8 @@ DWORD WINAPI CanMsgReadThreadProc_CAN_Kvaser_CAN(LPVOID pVoid)
     //New approach{{
     while (bLoopON)
     {
-        WaitForMultipleObjects(sg_nNoOfChannels, g_hDataEvent, FALSE, INFINITE);
+        //Wake up when held messages are due even if nothing is received
+        WaitForMultipleObjects(sg_nNoOfChannels, g_hDataEvent, FALSE, sg_ouReorderStage.dwGetWaitTime());
         switch (pThreadParam->m_unActionCode)
         {
             case INVOKE_FUNCTION:
@@ -1463,10 +1403,12 @@ DWORD WINAPI CanMsgReadThreadProc_CAN_Kvaser_CAN(LPVOID pVoid)
                     }
                 }
                 while (moreDataExist);
+                vFlushClientsBuffer();
             }
             break;
             case EXIT_THREAD:
             {
+                vFlushClientsBuffer(true);
                 bLoopON = false;
             }
             break;
@@ -1643,19 +1585,14 @@ HRESULT CDIL_CAN_Kvaser::CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMs
 {
     VALIDATE_VALUE_RETURN_VAL(sg_bCurrState, STATE_CONNECTED, ERR_IMPROPER_STATE);
     EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    static SACK_MAP sAckMap;
     HRESULT hResult = S_FALSE;
     if (bClientIdExist(dwClientID))
     {
         if (sCanTxMsg.m_ucChannel <= sg_nNoOfChannels)
         {
-            sAckMap.m_ClientID = dwClientID;
-            sAckMap.m_MsgID    = sCanTxMsg.m_unMsgID;
-            sAckMap.m_Channel  = sCanTxMsg.m_ucChannel;
-
             /* Mark an entry in Map. This is helpful to identify
                which client has been sent this message in later stage */
-            vMarkEntryIntoMap(sAckMap);
+            sg_ouTxEchoMap.vAddEntry(sCanTxMsg.m_ucChannel, sCanTxMsg.m_unMsgID, dwClientID);
             if (nWriteMessage(sCanTxMsg, dwClientID) == S_OK)
             {
                 hResult = S_OK;
@@ -2109,8 +2046,6 @@ static int nConnect(BOOL bConnect, BYTE /*hClient*/)
         }
         if(nStatus == canOK)
         {
-            /* Transit into 'CREATE TIME MAP' state */
-            sg_byCurrState = CREATE_MAP_TIMESTAMP;
             sg_bIsConnected = bConnect;
             nReturn = S_OK;
             // Update configuration to restore the settings
@@ -2132,19 +2067,7 @@ static int nConnect(BOOL bConnect, BYTE /*hClient*/)
     if ( sg_bIsConnected )
     {
         InitializeCriticalSection(&sg_CritSectForAckBuf);
-
-        QueryPerformanceCounter(&sg_QueryTickCount);
-        // Get frequency of the performance counter
-        QueryPerformanceFrequency(&sg_lnFrequency);
-        // Convert it to time stamp with the granularity of hundreds of microsecond
-        if ((sg_QueryTickCount.QuadPart * 10000) > sg_lnFrequency.QuadPart)
-        {
-            sg_TimeStamp = (sg_QueryTickCount.QuadPart * 10000) / sg_lnFrequency.QuadPart;
-        }
-        else
-        {
-            sg_TimeStamp = (sg_QueryTickCount.QuadPart / sg_lnFrequency.QuadPart) * 10000;
-        }
+        sg_ouTxEchoMap.vClear();
     }
     else
     {
@@ -43,6 +43,7 @@
 #include "Utility\MultiLanguageSupport.h"
 //#include "../Application/GettextBusmaster.h"
 #include "DIL_Interface/HardwareListingCAN.h"
+#include "ClientDispatch.h"
 #include "mhs_types.h"
 
 #define USAGE_EXPORT
@@ -157,20 +158,8 @@ typedef struct tagClientBufMap
  */
 static SCLIENTBUFMAP sg_asClientToBufMap[MAX_CLIENT_ALLOWED];
 
-typedef struct tagAckMap
-{
-    UINT m_MsgID;
-    UINT m_ClientID;
-    UINT m_Channel;
-
-    BOOL operator == (const tagAckMap& RefObj)
-    {
-        return ((m_MsgID == RefObj.m_MsgID) && (m_Channel == RefObj.m_Channel));
-    }
-} SACK_MAP;
-
-typedef std::list<SACK_MAP> CACK_MAP_LIST;
-static CACK_MAP_LIST sg_asAckMapBuf;
+static CTxEchoMap sg_ouTxEchoMap;                   // Sending client of each pending Tx message
+static CClientDispatch<STCANDATA> sg_ouClientDispatch;
 
 static BYTE sg_bCurrState = STATE_DRIVER_SELECTED;
 static CRITICAL_SECTION sg_DIL_CriticalSection;
@@ -231,8 +220,7 @@ static BOOL bClientExist(std::string pcClientName, INT& Index);
 static BOOL bRemoveClient(DWORD dwClientId);
 static BOOL bClientIdExist(const DWORD& dwClientId);
 static DWORD dwGetAvailableClientSlot(void);
-static void vMarkEntryIntoMap(const SACK_MAP& RefObj);
-static BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID);
+static void vFlushClientsBuffer(void);
 static int str_has_char(char* s);
 
 
@@ -714,60 +702,40 @@ HRESULT CDIL_CAN_MHS::CAN_SetConfigData(PSCONTROLLER_DETAILS ConfigFile, int Len
 
 
 /**
- * This function writes the message to the corresponding clients buffer
+ * This function queues the message for the corresponding clients buffer
  */
 static void vWriteIntoClientsBuffer(STCANDATA& can_data)
 {
-    UINT ClientId, i, j;
-    BOOL bClientExists;
-    static SACK_MAP sAckMap;
-    static UINT Index = (UINT)-1;
-    static STCANDATA sTempCanData;
-
-    // Write into the client's buffer and Increment message Count
-    if (can_data.m_ucDataType == TX_FLAG)
+    UINT ClientId = 0;
+
+    // Tx messages are only given to the clients if the sender is known
+    if ((can_data.m_ucDataType == TX_FLAG) &&
+            !sg_ouTxEchoMap.bRemoveEntry(can_data.m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                         can_data.m_uDataInfo.m_sCANMsg.m_unMsgID, ClientId))
     {
-        ClientId = 0;
-        sAckMap.m_Channel = can_data.m_uDataInfo.m_sCANMsg.m_ucChannel;
-        sAckMap.m_MsgID = can_data.m_uDataInfo.m_sCANMsg.m_unMsgID;
-        if (bRemoveMapEntry(sAckMap, ClientId))
-        {
-            bClientExists = bGetClientObj(ClientId, Index);
-            for (i = 0; i < sg_unClientCnt; i++)
-            {
-                //Tx for sender node
-                if (/*(i == CAN_MONITOR_NODE_INDEX)  ||*/ (bClientExists && (i == Index)))
-                {
-                    for (j = 0; j < sg_asClientToBufMap[i].m_unBufCount; j++)
-                    {
-                        sg_asClientToBufMap[i].m_pClientBuf[j]->WriteIntoBuffer(&can_data);
-                    }
-                }
-                else
-                {
-                    //Send the other nodes as Rx.
-                    for (UINT j = 0; j < sg_asClientToBufMap[i].m_unBufCount; j++)
-                    {
-                        sTempCanData = can_data;
-                        sTempCanData.m_ucDataType = RX_FLAG;
-                        sg_asClientToBufMap[i].m_pClientBuf[j]->WriteIntoBuffer(&sTempCanData);
-                    }
-                }
-            }
-        }
+        return;
     }
-    else // provide it to everybody
+    sg_ouClientDispatch.vAddFrame(can_data, ClientId);
+    if (sg_ouClientDispatch.bIsFull())
     {
-        for (i = 0; i < sg_unClientCnt; i++)
-        {
-            for (j = 0; j < sg_asClientToBufMap[i].m_unBufCount; j++)
-            {
-                sg_asClientToBufMap[i].m_pClientBuf[j]->WriteIntoBuffer(&can_data);
-            }
-        }
+        vFlushClientsBuffer();
     }
 }
 
+/**
+ * Writes the queued messages to the clients buffer
+ */
+static void vFlushClientsBuffer(void)
+{
+    for (UINT i = 0; i < sg_unClientCnt; i++)
+    {
+        sg_ouClientDispatch.vWriteClient(sg_asClientToBufMap[i].m_dwClientID,
+                                         sg_asClientToBufMap[i].m_pClientBuf,
+                                         sg_asClientToBufMap[i].m_unBufCount);
+    }
+    sg_ouClientDispatch.vClearBatch();
+}
+
 // Plug & Play Event-Funktion
 static void CALLBACK_TYPE CanPnPEvent(uint32_t /* index */, int32_t status)
 {
@@ -836,6 +804,9 @@ static void CALLBACK_TYPE CanRxEvent(uint32_t index, struct TCanMsg* msg, int32_
         LeaveCriticalSection(&sg_DIL_CriticalSection);
         msg++;
     }
+    EnterCriticalSection(&sg_DIL_CriticalSection);
+    vFlushClientsBuffer();
+    LeaveCriticalSection(&sg_DIL_CriticalSection);
 }
 
 /**
@@ -895,6 +866,8 @@ HRESULT CDIL_CAN_MHS::CAN_StopHardware(void)
 {
     VALIDATE_VALUE_RETURN_VAL(sg_bCurrState, STATE_CONNECTED, ERR_IMPROPER_STATE);
     (void)CanDeviceClose(0);
+    //Echoes of the pending transmits will not come any more
+    sg_ouTxEchoMap.vClear();
     return(S_OK);
 }
 
@@ -930,7 +903,6 @@ HRESULT CDIL_CAN_MHS::CAN_GetTxMsgBuffer(BYTE*& /*pouFlxTxMsgBuffer*/)
 HRESULT CDIL_CAN_MHS::CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sMessage)
 {
     struct TCanMsg msg;
-    static SACK_MAP sAckMap;
     HRESULT hResult;
 
     VALIDATE_VALUE_RETURN_VAL(sg_bCurrState, STATE_CONNECTED, ERR_IMPROPER_STATE);
@@ -954,10 +926,7 @@ HRESULT CDIL_CAN_MHS::CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sMessage)
             msg.Id = sMessage.m_unMsgID;
             msg.MsgLen = sMessage.m_ucDataLen;
             memcpy(msg.MsgData, &sMessage.m_ucData, msg.MsgLen);
-            sAckMap.m_ClientID = dwClientID;
-            sAckMap.m_Channel  = sMessage.m_ucChannel;
-            sAckMap.m_MsgID    = msg.Id;
-            vMarkEntryIntoMap(sAckMap);
+            sg_ouTxEchoMap.vAddEntry(sMessage.m_ucChannel, msg.Id, dwClientID);
             if (CanTransmit(0, &msg, 1) >= 0)
             {
                 hResult = S_OK;
@@ -1233,31 +1202,6 @@ static DWORD dwGetAvailableClientSlot(void)
     return(nClientId);
 }
 
-/**
- * Pushes an entry into the list at the last position
- */
-static void vMarkEntryIntoMap(const SACK_MAP& RefObj)
-{
-    EnterCriticalSection(&sg_DIL_CriticalSection); // Lock the buffer
-    sg_asAckMapBuf.push_back(RefObj);
-    LeaveCriticalSection(&sg_DIL_CriticalSection); // Unlock the buffer
-}
-
-static BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
-{
-    BOOL bResult = FALSE;
-    CACK_MAP_LIST::iterator  iResult =
-        std::find( sg_asAckMapBuf.begin(), sg_asAckMapBuf.end(), RefObj );
-
-    if (iResult != sg_asAckMapBuf.end())
-    {
-        bResult = TRUE;
-        ClientID = (*iResult).m_ClientID;
-        sg_asAckMapBuf.erase(iResult);
-    }
-    return bResult;
-}
-
 HRESULT CDIL_CAN_MHS::CAN_SetHardwareChannel(PSCONTROLLER_DETAILS,DWORD /*dwDriverId*/,bool /*bIsHardwareListed*/, unsigned int /*unChannelCount*/)
 {
     return S_OK;
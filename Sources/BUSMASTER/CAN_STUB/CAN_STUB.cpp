@@ -85,6 +85,9 @@ static CRITICAL_SECTION sg_CSBroker;
 static HRESULT          sg_hResult          = S_FALSE;
 static HANDLE           sg_hNotifyFinish    = nullptr;
 static STCAN_MSG*       sg_pouCanTxMsg      = nullptr;
+static const STCAN_MSG* sg_psCanTxMsgs      = nullptr;
+static UINT             sg_unCanTxMsgCount  = 0;
+static HRESULT*         sg_phCanTxResults   = nullptr;
 static SYSTEMTIME       sg_CurrSysTime      = {'\0'};
 static LARGE_INTEGER    sg_QueryTickCount;
 static UINT64           sg_TimeStampRef     = 0x0;
@@ -105,6 +108,7 @@ enum
     STOP_HARDWARE,
     START_HARDWARE,
     SEND_MESSAGE,
+    SEND_MESSAGES,
     GET_TIME_MAP,
     REGISTER,
     UNREGISTER,
@@ -128,6 +132,7 @@ const BYTE SIZE_TIMESTAMP = sizeof(UINT64);
 
 #define MAX_CLIENT_ALLOWED 16
 #define MAX_BUFF_ALLOWED 16
+#define MAX_RX_BATCH 64     // Frames taken from the pipe before the client buffers are written
 
 /**
  * Client and Client Buffer map
@@ -212,6 +217,7 @@ public:
     HRESULT CAN_GetCurrStatus( STATUSMSG& StatusData );
     HRESULT CAN_GetTxMsgBuffer(BYTE*& pouFlxTxMsgBuffer);
     HRESULT CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMsg);
+    HRESULT CAN_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults);
     HRESULT CAN_GetBusConfigInfo(BYTE* BusInfo);
     HRESULT CAN_GetLastErrorString(std::string& acErrorStr);
     HRESULT CAN_GetControllerParams(LONG& lParam, UINT nChannel, ECONTR_PARAM eContrParam);
@@ -256,6 +262,7 @@ HRESULT Worker_Disconnect(ISimENG*);
 HRESULT Worker_StopHardware(ISimENG*);
 HRESULT Worker_StartHardware(ISimENG*);
 HRESULT Worker_SendCanMsg(ISimENG*, STCAN_MSG*);
+HRESULT Worker_SendCanMsgs(ISimENG*, const STCAN_MSG*, UINT, HRESULT*);
 HRESULT Worker_GetTimeModeMapping(ISimENG*);
 HRESULT Worker_RegisterClient(ISimENG* pISimENG);
 HRESULT Worker_UnregisterClient(ISimENG* pISimENG);
@@ -349,48 +356,73 @@ static BOOL bIsBufferExists(const SCLIENTBUFMAP& sClientObj, const CBaseCANBufFS
 change if there is any modifications in SimEng.cpp*/
 
 const USHORT SIZE_DAT_P = sizeof(SPIPE_CANMSG);
+
+/* Converts one pipe entry, returns false if it is not a complete CAN entry */
+static bool bReadPipeEntry(HANDLE hClientHandle, STCANDATA& sCanData)
+{
+    SPIPE_CANMSG sPipeCanMsg;
+    DWORD dwBytes = 0;
+
+    BYTE abyData[SIZE_DAT_P] = {'\0'};
+
+    if (!ReadFile(hClientHandle, abyData, SIZE_DAT_P, &dwBytes, nullptr))
+    {
+        GetSystemErrorString();
+        return false;
+    }
+    if (dwBytes != SIZE_PIPE_CANMSG)
+    {
+        return false;
+    }
+    memcpy(&(sPipeCanMsg.m_byTxRxFlag), abyData, 1);
+    memcpy(&(sPipeCanMsg.m_unTimeStamp), abyData + 1, SIZE_TIMESTAMP);
+    memcpy(&(sPipeCanMsg.m_sCanMsg), abyData + 1 + SIZE_TIMESTAMP, sizeof(STCAN_MSG));
+
+    sCanData.m_lTickCount.QuadPart = sPipeCanMsg.m_unTimeStamp;
+    sCanData.m_uDataInfo.m_sCANMsg = sPipeCanMsg.m_sCanMsg;
+    /*Set CAN FD field to false*/
+    sCanData.m_uDataInfo.m_sCANMsg.m_bCANFD = false;
+
+    if (sPipeCanMsg.m_byTxRxFlag == FLAG_TX)
+    {
+        sCanData.m_ucDataType = TX_FLAG;
+    }
+    else
+    {
+        sCanData.m_ucDataType = RX_FLAG;
+    }
+    return true;
+}
+
 static void ProcessCanMsg(HANDLE hClientHandle, UINT unIndex)
 {
-    static SPIPE_CANMSG sPipeCanMsg;
-    static STCANDATA sCanData;
-    static DWORD dwBytes = 0;
+    static STCANDATA asCanData[MAX_RX_BATCH];
 
     /* To be noted - there is no validation for any pointer. This is because
     this function assumes them to have been duly validated beforehand and it
     is so by implementation. Efficiency is the motivation behind. */
-    BYTE abyData[SIZE_DAT_P] = {'\0'};
+    int nFrames = 0;
+
+    /* Take all the entries that queued up, so every client buffer is locked
+    once for all of them. The event is set once per entry, so it may come
+    after an earlier call took the entries already. A read on an empty pipe
+    would block this thread for every client. */
+    DWORD dwAvailable = 0;
+    while ( (nFrames < MAX_RX_BATCH) &&
+            PeekNamedPipe(hClientHandle, nullptr, 0, nullptr, &dwAvailable, nullptr) &&
+            (dwAvailable >= SIZE_PIPE_CANMSG) &&
+            bReadPipeEntry(hClientHandle, asCanData[nFrames]) )
+    {
+        nFrames++;
+    }
 
-    //if (ReadFile(hClientHandle, &sPipeCanMsg, SIZE_PIPE_CANMSG, &dwBytes, nullptr))
-    if (ReadFile(hClientHandle, abyData, SIZE_DAT_P, &dwBytes, nullptr))
+    if (nFrames > 0)
     {
-        memcpy(&(sPipeCanMsg.m_byTxRxFlag), abyData, 1);
-        memcpy(&(sPipeCanMsg.m_unTimeStamp), abyData + 1, SIZE_TIMESTAMP);
-        memcpy(&(sPipeCanMsg.m_sCanMsg), abyData + 1 + SIZE_TIMESTAMP, sizeof(STCAN_MSG));
-        if (dwBytes == SIZE_PIPE_CANMSG)
+        for (UINT i = 0; i < sg_asClientToBufMap[unIndex].unBufCount; i++)
         {
-            sCanData.m_lTickCount.QuadPart = sPipeCanMsg.m_unTimeStamp;
-            sCanData.m_uDataInfo.m_sCANMsg = sPipeCanMsg.m_sCanMsg;
-            /*Set CAN FD field to false*/
-            sCanData.m_uDataInfo.m_sCANMsg.m_bCANFD = false;
-
-            if (sPipeCanMsg.m_byTxRxFlag == FLAG_TX)
-            {
-                sCanData.m_ucDataType = TX_FLAG;
-            }
-            else
-            {
-                sCanData.m_ucDataType = RX_FLAG;
-            }
-            for (UINT i = 0; i < sg_asClientToBufMap[unIndex].unBufCount; i++)
-            {
-                sg_asClientToBufMap[unIndex].pClientBuf[i]->WriteIntoBuffer(&sCanData);
-            }
+            sg_asClientToBufMap[unIndex].pClientBuf[i]->nWriteMultiple(asCanData, nFrames);
         }
     }
-    else
-    {
-        GetSystemErrorString();
-    }
 }
 
 DWORD WINAPI FlexMsgReadThreadProc_Stub(LPVOID pVoid)
@@ -797,6 +829,38 @@ HRESULT CDIL_CAN_STUB::CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMsg)
     return hResult;
 }
 
+/* All frames go to the broker thread in one assignment */
+HRESULT CDIL_CAN_STUB::CAN_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults)
+{
+    HRESULT hResult = S_FALSE;
+    if (0 == unCount)
+    {
+        return S_OK;
+    }
+
+    // Lock so that no other thread may use the common resources
+    EnterCriticalSection(&sg_CSBroker);
+
+    // Assign parameter
+    sg_psCanTxMsgs = psCanTxMsgs;
+    sg_unCanTxMsgCount = unCount;
+    sg_phCanTxResults = phResults;
+    sg_ushTempClientID = (USHORT)dwClientID;
+    // Identify current assignment of the broker thread
+    sg_sBrokerObjBusEmulation.m_unActionCode = SEND_MESSAGES;
+    // Now release the harness
+    SetEvent(sg_sBrokerObjBusEmulation.m_hActionEvent);
+    // Wait until current assignment of broker thread is over
+    WaitForSingleObject(sg_hNotifyFinish, INFINITE);
+    // Save the result
+    hResult = sg_hResult;
+
+    // Work is over, now unlock for others to use common resources
+    LeaveCriticalSection(&sg_CSBroker);
+
+    return hResult;
+}
+
 HRESULT CDIL_CAN_STUB::CAN_GetCntrlStatus(const HANDLE& /*hEvent*/, UINT& unCntrlStatus)
 {
     HRESULT hResult = S_OK;
@@ -1053,6 +1117,12 @@ DWORD WINAPI BrokerThreadBusEmulation(LPVOID pVoid)
                 SetEvent(sg_hNotifyFinish);
             }
             break;
+            case SEND_MESSAGES:
+            {
+                sg_hResult = Worker_SendCanMsgs(pISimENG, sg_psCanTxMsgs, sg_unCanTxMsgCount, sg_phCanTxResults);
+                SetEvent(sg_hNotifyFinish);
+            }
+            break;
             case GET_TIME_MAP:
             {
                 sg_hResult = Worker_GetTimeModeMapping(pISimENG);
@@ -1207,6 +1277,25 @@ HRESULT Worker_SendCanMsg(ISimENG* pISimENGLoc, STCAN_MSG* pouCanTxMsg)
     return pISimENGLoc->SendMessage(sg_ushTempClientID, sizeof(STCAN_MSG), (BYTE*)pouCanTxMsg);
 }
 
+HRESULT Worker_SendCanMsgs(ISimENG* pISimENGLoc, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults)
+{
+    HRESULT hResult = S_OK;
+    if (unCount > 0)
+    {
+        // One call to the simulation engine for all frames
+        hResult = pISimENGLoc->SendMessages(sg_ushTempClientID, sizeof(STCAN_MSG),
+                                            (ULONG)(unCount * sizeof(STCAN_MSG)), (BYTE*)psCanTxMsgs);
+    }
+    if (nullptr != phResults)
+    {
+        for (UINT i = 0; i < unCount; i++)
+        {
+            phResults[i] = hResult;
+        }
+    }
+    return hResult;
+}
+
 HRESULT Worker_GetTimeModeMapping(ISimENG* pISimENGLoc)
 {
     return pISimENGLoc->GetTimeModeMapping(&sg_CurrSysTime, &sg_TimeStampRef, &sg_QueryTickCount);
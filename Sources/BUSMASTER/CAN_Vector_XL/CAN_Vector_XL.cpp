@@ -42,6 +42,7 @@
 #include "../Application/MultiLanguage.h"
 #include "Utility/MultiLanguageSupport.h"
 #include "DILPluginHelperDefs.h"
+#include "DeviceTimebase.h"
 
 #define DYNAMIC_XLDRIVER_DLL
 #include "EXTERNAL/vxlapi.h"
@@ -145,17 +146,7 @@ XLCANFLUSHTRANSMITQUEUE        xlCanFlushTransmitQueue = nullptr;
 XLCANTRANSMIT                  xlCanTransmit = nullptr;
 
 static  CRITICAL_SECTION sg_CritSectForWrite;       // To make it thread safe
-
-enum
-{
-    CREATE_MAP_TIMESTAMP = 0x1,
-    CALC_TIMESTAMP_READY = 0x2,
-};
-
-/**
- * Current state machine
- */
-static BYTE sg_byCurrState = CREATE_MAP_TIMESTAMP;
+static CDeviceTimebase sg_ouTimebase;               // Maps the event timestamps of each channel into host time
 
 #define MAX_BUFF_ALLOWED 16
 #define RECEIVE_EVENT_SIZE 1                // DO NOT EDIT! Currently 1 is supported only
@@ -331,7 +322,6 @@ static UINT64 sg_TimeStamp = 0;
  * Query Tick Count
  */
 static LARGE_INTEGER sg_QueryTickCount;
-static LARGE_INTEGER sg_lnFrequency;
 
 /**
  * Channel information
@@ -1288,6 +1278,8 @@ static void vCreateTimeModeMapping(HANDLE hDataEvent)
     GetLocalTime(&sg_CurrSysTime);
     /*Query Tick Count*/
     QueryPerformanceCounter(&sg_QueryTickCount);
+    /* Frame ticks are host time, so the mapping is the host time of sg_CurrSysTime */
+    sg_TimeStamp = CDeviceTimebase::n64ToTickCount(sg_ouTimebase.un64QpcToNs(sg_QueryTickCount.QuadPart));
 }
 
 /**
@@ -1351,26 +1343,9 @@ static UCHAR USB_ucGetErrorCode(LONG lError, BYTE byDir)
 */
 static BYTE bClassifyMsgType(XLevent& xlEvent, STCANDATA& sCanData)
 {
-    sCanData.m_lTickCount.QuadPart = (LONGLONG)xlEvent.timeStamp / 100000;
-
-    if (CREATE_MAP_TIMESTAMP == sg_byCurrState)
-    {
-        LARGE_INTEGER g_QueryTickCount;
-        QueryPerformanceCounter(&g_QueryTickCount);
-        UINT64 unConnectionTime;
-        unConnectionTime = ((g_QueryTickCount.QuadPart * 10000) / sg_lnFrequency.QuadPart) - sg_TimeStamp;
-        //Time difference should be +ve value
-        if(sCanData.m_lTickCount.QuadPart >= unConnectionTime)
-        {
-            sg_TimeStamp  = (LONGLONG)(sCanData.m_lTickCount.QuadPart - unConnectionTime);
-        }
-        else
-        {
-            sg_TimeStamp  = (LONGLONG)(unConnectionTime - sCanData.m_lTickCount.QuadPart);
-        }
-
-        sg_byCurrState = CALC_TIMESTAMP_READY;
-    }
+    /* Event timestamps are in ns of the device clock, map them into the common host time */
+    sCanData.m_lTickCount.QuadPart = CDeviceTimebase::n64ToTickCount(
+                                         sg_ouTimebase.un64GetHostTime(sg_unDevChannelMap[xlEvent.chanIndex], xlEvent.timeStamp));
 
     if ( !(xlEvent.tagData.msg.flags & XL_CAN_MSG_FLAG_ERROR_FRAME) &&
             !(xlEvent.tagData.msg.flags & XL_CAN_MSG_FLAG_OVERRUN)     &&
@@ -1687,23 +1662,8 @@ static int nConnect(bool bConnect)
 
         if (XL_SUCCESS == xlStatus)
         {
-            //Calculate connected Timestamp
-            QueryPerformanceCounter(&sg_QueryTickCount);
-            // Get frequency of the performance counter
-            QueryPerformanceFrequency(&sg_lnFrequency);
-            // Convert it to time stamp with the granularity of hundreds of microsecond
-            //if (sg_QueryTickCount.QuadPart * 10000 > sg_QueryTickCount.QuadPart)
-            if ((sg_QueryTickCount.QuadPart * 10000) > sg_lnFrequency.QuadPart)
-            {
-                sg_TimeStamp = (sg_QueryTickCount.QuadPart * 10000) / sg_lnFrequency.QuadPart;
-            }
-            else
-            {
-                sg_TimeStamp = (sg_QueryTickCount.QuadPart / sg_lnFrequency.QuadPart) * 10000;
-            }
-
-            /* Transit into 'CREATE TIME MAP' state */
-            sg_byCurrState = CREATE_MAP_TIMESTAMP;
+            /* Start the timestamp mapping of all channels over */
+            sg_ouTimebase.vInit(sg_nNoOfChannels, 1000000000, 64);
             vMapDeviceChannelIndex();
             sg_bIsConnected = bConnect;
             // ------------------------------------
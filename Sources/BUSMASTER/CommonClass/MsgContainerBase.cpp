@@ -100,11 +100,70 @@ CMsgContainerBase::CMsgContainerBase()
     m_pRxMsgCallBack  = nullptr;
     m_pouImportLogFile = nullptr;
     m_bIsFileImported=false;
+    m_bAllChanged = false;
+    InitializeCriticalSection(&m_omCritSecChanges);
 }
 
 CMsgContainerBase::~CMsgContainerBase()
 {
     m_sDataCopyThread.bTerminateThread();
+    DeleteCriticalSection(&m_omCritSecChanges);
+}
+
+/******************************************************************************
+    Function Name    :  vMarkChanged
+    Input(s)         :  n64MapIndex - Map index of the message received
+    Output           :  -
+    Functionality    :  Records a message whose rows have to be repainted.
+                        Too many of them turn into a full repaint.
+    Member of        :  CMsgContainerBase
+******************************************************************************/
+void CMsgContainerBase::vMarkChanged(__int64 n64MapIndex)
+{
+    EnterCriticalSection(&m_omCritSecChanges);
+    if (false == m_bAllChanged)
+    {
+        m_ouChangedKeys.insert(n64MapIndex);
+        if (m_ouChangedKeys.size() > defMAX_CHANGED_KEYS)
+        {
+            m_ouChangedKeys.clear();
+            m_bAllChanged = true;
+        }
+    }
+    LeaveCriticalSection(&m_omCritSecChanges);
+}
+
+/******************************************************************************
+    Function Name    :  vMarkAllChanged
+    Input(s)         :  -
+    Output           :  -
+    Functionality    :  Requests a full repaint, the rows have moved.
+    Member of        :  CMsgContainerBase
+******************************************************************************/
+void CMsgContainerBase::vMarkAllChanged(void)
+{
+    EnterCriticalSection(&m_omCritSecChanges);
+    m_ouChangedKeys.clear();
+    m_bAllChanged = true;
+    LeaveCriticalSection(&m_omCritSecChanges);
+}
+
+/******************************************************************************
+    Function Name    :  GetChangedRows
+    Input(s)         :  sChanges - The changes. An [out] parameter.
+    Output           :  -
+    Functionality    :  Takes the messages received and the full repaint
+                        request since the previous call.
+    Member of        :  CMsgContainerBase
+******************************************************************************/
+void CMsgContainerBase::GetChangedRows(SMSGWNDCHANGES& sChanges)
+{
+    EnterCriticalSection(&m_omCritSecChanges);
+    sChanges.m_ouChangedKeys.assign(m_ouChangedKeys.begin(), m_ouChangedKeys.end());
+    sChanges.m_bAllChanged = m_bAllChanged;
+    m_ouChangedKeys.clear();
+    m_bAllChanged = false;
+    LeaveCriticalSection(&m_omCritSecChanges);
 }
 
 /******************************************************************************
@@ -30,6 +30,39 @@
 #include "Utility/IImportLogFile.h"
 #include "DataTypes\MsgSignal_Datatypes.h"
 #include "Application\MessageAttrib.h"
+#include <vector>
+#include <unordered_set>
+
+#define defMAX_CHANGED_KEYS     4096    //Beyond this the whole message window is repainted
+
+/* Query over the frames kept by the message window */
+struct sMSGHISTORYQUERY
+{
+    std::vector<UINT> m_ouMsgIds;   //Frame identifiers, empty for all
+    UINT m_unChannel;               //Channel number, 0 for all
+    __int64 m_n64Duration;          //Period before the latest frame in 100 micro seconds, 0 for all
+
+    sMSGHISTORYQUERY()
+    {
+        m_unChannel = 0;
+        m_n64Duration = 0;
+    }
+};
+typedef sMSGHISTORYQUERY SMSGHISTORYQUERY;
+
+/* Display changes since the previous query */
+struct sMSGWNDCHANGES
+{
+    std::vector<__int64> m_ouChangedKeys;   //Map indices of the messages received
+    bool m_bAllChanged;                     //Rows moved or too many changes
+
+    sMSGWNDCHANGES()
+    {
+        m_bAllChanged = false;
+    }
+};
+typedef sMSGWNDCHANGES SMSGWNDCHANGES;
+
 class IRxMsgCallBack
 {
 public:
@@ -46,6 +79,12 @@ protected:
     IImportLogFile* m_pouImportLogFile;
     bool m_bIsFileImported;
     CMessageAttrib* mMsgAttributes;
+    //Changes not yet taken by the display
+    CRITICAL_SECTION m_omCritSecChanges;
+    std::unordered_set<__int64> m_ouChangedKeys;
+    bool m_bAllChanged;
+    void vMarkChanged(__int64 n64MapIndex);
+    void vMarkAllChanged(void);
 public:
     virtual ~CMsgContainerBase(void);
     virtual void InitTimeParams(void) = 0;
@@ -77,6 +116,23 @@ public:
     virtual HRESULT GetFilterScheme(void* pvFilterApplied) = 0;
     virtual HRESULT EnableFilterApplied(BOOL bEnable) = 0;
     virtual void SetDisplaySettings(DisplaySettings /*ouSettings*/) {};
+    //Shows only the kept frames matching the query and the filter, nullptr shows all again
+    virtual HRESULT ApplyHistoryQuery(const SMSGHISTORYQUERY* /*psQuery*/)
+    {
+        return S_FALSE;
+    };
+    //Display indices of the shown frames matching the query
+    virtual HRESULT FindInHistory(const SMSGHISTORYQUERY& /*sQuery*/, std::vector<int>& /*ouIndices*/)
+    {
+        return S_FALSE;
+    };
+    //Query for the identifier and channel of the frame at a display index
+    virtual HRESULT GetHistoryQueryAt(int /*nIndex*/, SMSGHISTORYQUERY& /*sQuery*/)
+    {
+        return S_FALSE;
+    };
+    //Takes the changes since the previous call
+    virtual void GetChangedRows(SMSGWNDCHANGES& sChanges);
     virtual BOOL bGetDilInterFace() = 0;
     virtual __int64 nCreateMapIndexKey(LPVOID pMsgData) = 0;
     virtual HRESULT hToggleDILBufferRead(BOOL bRead) = 0;
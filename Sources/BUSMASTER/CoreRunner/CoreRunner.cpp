@@ -0,0 +1,763 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      CoreRunner.cpp
+ * \brief     Implementation of CCoreRunner class
+ *
+ * Implementation of CCoreRunner class
+ */
+
+#include "CoreRunner_stdafx.h"
+#include "CoreRunner.h"
+#include "Error.h"
+#include "DataTypes/DIL_Datatypes_.h"
+#include "Utility/XMLUtils.h"
+#include "Application/CFilesDefs_CAN.h"
+
+#define defRUNNER_TICKS_PER_MS      10          // STCANDATA::m_lTickCount counts 0.1 ms
+
+static CBaseDIL_CAN* sg_pouRunnerDIL = nullptr;
+static DWORD sg_dwRunnerClientID = 0;
+
+//Exports of the test executor
+typedef HRESULT (*PTSDOINITIALIZATION)(ETYPE_BUS eBus);
+typedef HRESULT (*PTSDODEINITIALIZATION)(ETYPE_BUS eBus);
+typedef HRESULT (*PFTSSTARTSTOPREADTHREAD)(ETYPE_BUS eBus, BOOL bStart);
+typedef HRESULT (*TSEXECUTORSETXMLCONFIGDATA)(xmlDocPtr);
+typedef HRESULT (*PTSEXECUTETESTSUITE)(ETYPE_BUS eBus, const char* pchTestSetupFile, UINT* punExecuted, UINT* punFailed);
+static PTSDOINITIALIZATION sg_pfTSDoInitialization = nullptr;
+static PTSDODEINITIALIZATION sg_pfTSDoDeInitialization = nullptr;
+static PFTSSTARTSTOPREADTHREAD sg_pfTSStartStopReadThread = nullptr;
+static TSEXECUTORSETXMLCONFIGDATA sg_pfTSSetXMLConfigData = nullptr;
+static PTSEXECUTETESTSUITE sg_pfTSExecuteTestSuite = nullptr;
+
+//Transmission of the nodes
+static int Runner_SendMsg(void* pMsg, HMODULE /*hModule*/)
+{
+    STCAN_MSG* psMsg = (STCAN_MSG*)pMsg;
+    return sg_pouRunnerDIL->DILC_SendMsg(sg_dwRunnerClientID, *psMsg);
+}
+
+CCoreRunner::CCoreRunner(void)
+{
+    m_pDoc = nullptr;
+    m_pouKernel = nullptr;
+    m_pouNetwork = nullptr;
+    m_pouClock = nullptr;
+    m_pouDIL = nullptr;
+    m_pouLogger = nullptr;
+    m_pouNodeSim = nullptr;
+    m_nChannels = 0;
+    m_dwClientID = 0;
+    m_bConnected = false;
+    m_bVirtual = false;
+    m_hStop = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    m_hTSExecutor = nullptr;
+    m_hTestSuite = nullptr;
+    m_hTestSuiteResult = S_FALSE;
+    m_unTCExecuted = 0;
+    m_unTCFailed = 0;
+
+    LARGE_INTEGER lFreq;
+    QueryPerformanceFrequency(&lFreq);
+    m_n64QpcFreq = lFreq.QuadPart;
+    m_un64RefTicks = 0;
+    m_n64RefQpc = 0;
+
+    memset(&m_sInterval, 0, sizeof(m_sInterval));
+    memset(&m_sTotal, 0, sizeof(m_sTotal));
+    m_un64LastReportUs = 0;
+    m_lReportedDrops = 0;
+}
+
+CCoreRunner::~CCoreRunner(void)
+{
+    vClose();
+    CloseHandle(m_hStop);
+}
+
+/******************************************************************************
+  Function Name    :  nRun
+  Input(s)         :  sSettings - Command line of the runner
+  Output           :  0 if the configuration ran, 1 if it could not connect,
+                      2 if the configuration could not be read, with a test
+                      suite 3 if a test case failed and 4 if the suite could
+                      not be run or had no test case
+  Functionality    :  Loads and connects the configuration, reads the client
+                      buffer until the duration is over or vStop is called
+                      and reports the counters every interval. Duration and
+                      interval are measured on the BUSMASTER clock, so with
+                      virtual time the reports cover the same bus time in
+                      every run.
+  Member of        :  CCoreRunner
+******************************************************************************/
+int CCoreRunner::nRun(const sRUNNER_SETTINGS& sSettings)
+{
+    m_sSettings = sSettings;
+    if (false == bLoadConfig())
+    {
+        return 2;
+    }
+    if (getBusmasterKernel(&m_pouKernel) != S_OK
+            || m_pouKernel->getDatabaseService(&m_pouNetwork) != S_OK
+            || m_pouKernel->getClockService(&m_pouClock) != S_OK)
+    {
+        printf("The BUSMASTER kernel could not be loaded\n");
+        return 1;
+    }
+    vLoadDatabases();
+
+    if (false == bInitDIL() || false == bInitLogger() || false == bInitNodes())
+    {
+        vClose();
+        return 1;
+    }
+    if (false == bInitTestSuite())
+    {
+        vClose();
+        return 4;
+    }
+    if (false == bConnect())
+    {
+        vClose();
+        return 1;
+    }
+    if (nullptr != m_hTSExecutor)
+    {
+        //Ends the run through vStop when the suite is over
+        m_hTestSuite = CreateThread(nullptr, 0, dwTestSuiteProc, this, 0, nullptr);
+    }
+
+    m_pouClock->vAttach();
+    UINT64 un64StartUs = m_pouClock->un64GetTime();
+    UINT64 un64EndUs = (0 == m_sSettings.m_unDurationSec) ? _UI64_MAX
+                       : un64StartUs + (UINT64)m_sSettings.m_unDurationSec * 1000000;
+    UINT64 un64IntervalUs = (UINT64)m_sSettings.m_unIntervalSec * 1000000;
+    UINT64 un64NextReportUs = (0 == un64IntervalUs) ? _UI64_MAX : un64StartUs + un64IntervalUs;
+
+    while (WaitForSingleObject(m_hStop, 0) != WAIT_OBJECT_0)
+    {
+        UINT64 un64NowUs = m_pouClock->un64GetTime();
+        if (un64NowUs >= un64EndUs)
+        {
+            break;
+        }
+        if (un64NowUs >= un64NextReportUs)
+        {
+            vReadFrames();
+            vReport(un64NowUs - un64StartUs, false);
+            un64NextReportUs += un64IntervalUs;
+            continue;
+        }
+        //Wakes up for Ctrl+C at least every defRUNNER_WAIT_MS
+        UINT64 un64DueUs = min(min(un64EndUs, un64NextReportUs),
+                               un64NowUs + defRUNNER_WAIT_MS * 1000);
+        m_pouClock->dwWaitUntil(m_ouBuf.hGetNotifyingEvent(), un64DueUs);
+        vReadFrames();
+    }
+    UINT64 un64ElapsedUs = m_pouClock->un64GetTime() - un64StartUs;
+    m_pouClock->vDetach();
+
+    if (nullptr != m_hTestSuite)
+    {
+        //A test suite cannot be cancelled, the bus stays connected until it is over
+        if (WaitForSingleObject(m_hTestSuite, 0) != WAIT_OBJECT_0)
+        {
+            printf("Waiting for the test suite to end\n");
+            WaitForSingleObject(m_hTestSuite, INFINITE);
+        }
+        CloseHandle(m_hTestSuite);
+        m_hTestSuite = nullptr;
+    }
+    vDisconnect();
+    vReadFrames();
+    vReport(un64ElapsedUs, true);
+    int nResult = (nullptr != m_hTSExecutor) ? nGetTestVerdict() : 0;
+    vClose();
+    return nResult;
+}
+
+void CCoreRunner::vStop(void)
+{
+    SetEvent(m_hStop);
+}
+
+BOOL CCoreRunner::bWriteToTrace(char* pcTraceStr)
+{
+    if (nullptr != pcTraceStr)
+    {
+        printf("%s\n", pcTraceStr);
+    }
+    return TRUE;
+}
+
+void CCoreRunner::vLogAMessage(char File[], int Line, std::string Msg)
+{
+    printf("%s(%d): %s\n", File, Line, Msg.c_str());
+}
+
+bool CCoreRunner::bLoadConfig(void)
+{
+    m_pDoc = xmlReadFile(m_sSettings.m_strCfxFile.c_str(), "UTF-8", 0);
+    if (nullptr == m_pDoc)
+    {
+        printf("%s could not be read\n", m_sSettings.m_strCfxFile.c_str());
+        return false;
+    }
+    //Module lookups are answered from one walk over the document
+    xmlUtils::bCreateDocIndex(m_pDoc);
+    return true;
+}
+
+/******************************************************************************
+  Function Name    :  dwGetDriverId
+  Input(s)         :  -
+  Output           :  Driver of the command line or of the configuration
+  Functionality    :  Looks the name up in the driver list like the channel
+                      selection does, without the '&' of the menu. An unknown
+                      name runs the simulated bus.
+  Member of        :  CCoreRunner
+******************************************************************************/
+DWORD CCoreRunner::dwGetDriverId(void)
+{
+    std::string strName = m_sSettings.m_strDriver;
+    if (strName.empty())
+    {
+        xmlXPathObjectPtr pPathObject = xmlUtils::pGetNodes(m_pDoc,
+                                        (xmlChar*)"//BUSMASTER_CONFIGURATION/Module_Configuration/CAN_DIL_Section/DriverName");
+        if (nullptr != pPathObject)
+        {
+            xmlNodeSetPtr pNodeSet = pPathObject->nodesetval;
+            if (nullptr != pNodeSet && pNodeSet->nodeNr > 0 && nullptr != pNodeSet->nodeTab[0]->xmlChildrenNode)
+            {
+                xmlChar* ptext = xmlNodeListGetString(m_pDoc, pNodeSet->nodeTab[0]->xmlChildrenNode, 1);
+                if (nullptr != ptext)
+                {
+                    strName = (char*)ptext;
+                    xmlFree(ptext);
+                }
+            }
+            xmlXPathFreeObject(pPathObject);
+        }
+    }
+
+    DILLIST asDrivers;
+    DWORD dwCount = m_pouDIL->DILC_GetDILList(false, &asDrivers);
+    for (DWORD i = 0; i < dwCount; i++)
+    {
+        CString omStrDriver = asDrivers[i].m_acName.c_str();
+        omStrDriver.Replace("&", "");
+        if (omStrDriver.CompareNoCase(strName.c_str()) == 0)
+        {
+            return asDrivers[i].m_dwDriverID;
+        }
+    }
+    if (false == strName.empty())
+    {
+        printf("Unknown driver %s, running the simulated bus\n", strName.c_str());
+    }
+    return DRIVER_CAN_STUB;
+}
+
+/******************************************************************************
+  Function Name    :  vLoadDatabases
+  Input(s)         :  -
+  Output           :  -
+  Functionality    :  Preloads the CAN databases of the configuration in
+                      parallel and loads them into channel 0, as the
+                      configuration load of the main frame does. Relative
+                      paths are relative to the configuration file.
+  Member of        :  CCoreRunner
+******************************************************************************/
+void CCoreRunner::vLoadDatabases(void)
+{
+    std::list<std::string> ouDbPaths;
+    xmlXPathObjectPtr pPathObject = xmlUtils::pGetNodes(m_pDoc,
+                                    (xmlChar*)"//BUSMASTER_CONFIGURATION/Module_Configuration/CAN_Database_Files/FilePath");
+    if (nullptr != pPathObject)
+    {
+        xmlNodeSetPtr pNodeSet = pPathObject->nodesetval;
+        char acCfxDir[MAX_PATH] = {0};
+        strncpy_s(acCfxDir, m_sSettings.m_strCfxFile.c_str(), _TRUNCATE);
+        PathRemoveFileSpec(acCfxDir);
+        for (int i = 0; nullptr != pNodeSet && i < pNodeSet->nodeNr; i++)
+        {
+            if (nullptr == pNodeSet->nodeTab[i]->xmlChildrenNode)
+            {
+                continue;
+            }
+            xmlChar* ptext = xmlNodeListGetString(m_pDoc, pNodeSet->nodeTab[i]->xmlChildrenNode, 1);
+            if (nullptr != ptext)
+            {
+                char acPath[MAX_PATH] = {0};
+                if (PathIsRelative((char*)ptext))
+                {
+                    PathCombine(acPath, acCfxDir, (char*)ptext);
+                }
+                else
+                {
+                    strncpy_s(acPath, (char*)ptext, _TRUNCATE);
+                }
+                ouDbPaths.push_back(acPath);
+                xmlFree(ptext);
+            }
+        }
+        xmlXPathFreeObject(pPathObject);
+    }
+
+    DbLoadReport ouReport;
+    m_pouNetwork->SetChannelCount(CAN, 1);
+    m_pouNetwork->PreloadDbFiles(CAN, ouDbPaths, ouReport);
+    for (auto itr = ouDbPaths.begin(); itr != ouDbPaths.end(); ++itr)
+    {
+        if (m_pouNetwork->LoadDb(CAN, 0, *itr) != EC_SUCCESS)
+        {
+            printf("Database %s could not be loaded\n", itr->c_str());
+        }
+    }
+}
+
+/******************************************************************************
+  Function Name    :  bInitDIL
+  Input(s)         :  -
+  Output           :  true if the runner is a client of the driver
+  Functionality    :  Selects the driver and its interfaces as the DIL
+                      initialisation of the main frame does. The controller
+                      settings are the defaults of the driver.
+  Member of        :  CCoreRunner
+******************************************************************************/
+bool CCoreRunner::bInitDIL(void)
+{
+    if (DIL_GetInterface(CAN, (void**)&m_pouDIL) != S_OK || nullptr == m_pouDIL)
+    {
+        printf("The CAN driver interface could not be loaded\n");
+        return false;
+    }
+    DWORD dwDriverId = dwGetDriverId();
+    if (m_pouDIL->DILC_SelectDriver(dwDriverId, nullptr) != S_OK)
+    {
+        printf("The CAN driver could not be selected\n");
+        return false;
+    }
+    m_pouDIL->DILC_PerformInitOperations();
+    m_pouDIL->DILC_SetHardwareChannel(m_asControllers, dwDriverId, false);
+
+    m_nChannels = defNO_OF_CHANNELS;
+    if (m_pouDIL->DILC_ListHwInterfaces(m_asHwList, m_nChannels, m_asControllers, false) != S_OK)
+    {
+        printf("No CAN hardware found\n");
+        return false;
+    }
+    HRESULT hResult = m_pouDIL->DILC_SelectHwInterfaces(m_asHwList, m_nChannels);
+    if ((hResult != S_OK) && (hResult != HW_INTERFACE_ALREADY_SELECTED))
+    {
+        printf("The CAN hardware could not be selected\n");
+        return false;
+    }
+    hResult = m_pouDIL->DILC_RegisterClient(TRUE, m_dwClientID, defRUNNER_CLIENT_NAME);
+    if ((hResult != S_OK) && (hResult != ERR_CLIENT_EXISTS))
+    {
+        printf("The runner could not register with the CAN driver\n");
+        return false;
+    }
+    m_pouDIL->DILC_SetConfigData(m_asControllers, m_nChannels);
+
+    sg_pouRunnerDIL = m_pouDIL;
+    sg_dwRunnerClientID = m_dwClientID;
+    return true;
+}
+
+/******************************************************************************
+  Function Name    :  bInitLogger
+  Input(s)         :  -
+  Output           :  true if the frame processor is initialised
+  Functionality    :  The frame processor reads the driver for the runner and
+                      passes every frame on to m_ouBuf, logging as the
+                      logging blocks of the configuration say.
+  Member of        :  CCoreRunner
+******************************************************************************/
+bool CCoreRunner::bInitLogger(void)
+{
+    if (FP_GetInterface(FRAMEPROC_CAN, (void**)&m_pouLogger) != S_OK || nullptr == m_pouLogger)
+    {
+        printf("The frame processor could not be loaded\n");
+        return false;
+    }
+    SCANPROC_PARAMS sCANProcParams;
+    strncpy_s(sCANProcParams.m_acVersion, defRUNNER_VERSION, _TRUNCATE);
+    sCANProcParams.dwClientID = m_dwClientID;
+    sCANProcParams.m_pouCANBuffer = &m_ouBuf;
+    sCANProcParams.m_pILog = this;
+    if (m_pouLogger->FPC_DoInitialisation(&sCANProcParams) != S_OK)
+    {
+        printf("The frame processor could not be initialised\n");
+        return false;
+    }
+
+    m_pouLogger->StartEditingSession();
+    m_pouLogger->SetConfigData(m_pDoc);
+    m_pouLogger->StopEditingSession(TRUE);
+    if (m_sSettings.m_bLogging && m_pouLogger->GetLoggingBlockCount() > 0)
+    {
+        m_pouLogger->vSetMeasurementFileName();
+    }
+    return true;
+}
+
+bool CCoreRunner::bInitNodes(void)
+{
+    if (false == m_sSettings.m_bNodes)
+    {
+        return true;
+    }
+    if (NS_GetInterface(CAN, (void**)&m_pouNodeSim) != S_OK || nullptr == m_pouNodeSim)
+    {
+        printf("The node simulation could not be loaded\n");
+        return false;
+    }
+
+    char acAppDir[MAX_PATH] = {0};
+    GetModuleFileName(nullptr, acAppDir, MAX_PATH);
+    PathRemoveFileSpec(acAppDir);
+
+    m_sExFuncPtr.m_hWmdMDIParentFrame = nullptr;
+    m_sExFuncPtr.m_omAPIList.RemoveAll();
+    m_sExFuncPtr.m_omAPINames.RemoveAll();
+    for (int i = 0; i < TOTAL_API_COUNT; i++)
+    {
+        m_sExFuncPtr.m_omAPIList.Add(sg_omAPIFuncList[i]);
+        m_sExFuncPtr.m_omAPINames.Add(sg_omAPIFuncNames[i]);
+    }
+    m_sExFuncPtr.m_omErrorHandlerList.RemoveAll();
+    for (int i = 0; i < TOTAL_ERROR_COUNT; i++)
+    {
+        m_sExFuncPtr.m_omErrorHandlerList.Add(sg_omMcNetErrorHandlerList[i]);
+    }
+    m_sExFuncPtr.m_omDefinedMsgHeaders.RemoveAll();
+    m_sExFuncPtr.m_omAppDirectory = acAppDir;
+    m_sExFuncPtr.m_omObjWrapperName = WRAPPER_NAME;
+    m_sExFuncPtr.m_omStructFile = STRUCT_FILE;
+    m_sExFuncPtr.m_omStructName = MSG_STRUCT_NAME;
+    m_sExFuncPtr.m_pouITraceWndPtr = this;
+    m_sExFuncPtr.m_podNodeToDllMap = nullptr;
+    m_sExFuncPtr.Send_Msg = Runner_SendMsg;
+    m_sExFuncPtr.DisConnectTool = nullptr;
+    m_sExFuncPtr.EnDisableLog = nullptr;
+    m_sExFuncPtr.WriteToLog = nullptr;
+    m_sExFuncPtr.RestController = nullptr;
+
+    m_pouNodeSim->NS_SetBmNetworkConfig(m_pouNetwork, false);
+    m_pouNodeSim->NS_SetSimSysConfigData(m_pDoc);
+    m_pouNodeSim->NS_UpdateFuncStructsNodeSimEx((PVOID)&m_sExFuncPtr, UPDATE_ALL);
+    return true;
+}
+
+/******************************************************************************
+  Function Name    :  bInitTestSuite
+  Input(s)         :  -
+  Output           :  false if the test executor could not be loaded
+  Functionality    :  Loads the test executor for /testsuite, hands it the
+                      configuration if no test setup file was given and
+                      starts its DIL client and read thread as the main frame
+                      does before connecting.
+  Member of        :  CCoreRunner
+******************************************************************************/
+bool CCoreRunner::bInitTestSuite(void)
+{
+    if (false == m_sSettings.m_bTestSuite)
+    {
+        return true;
+    }
+    m_hTSExecutor = LoadLibrary(defRUNNER_TS_EXECUTOR_DLL);
+    if (nullptr == m_hTSExecutor)
+    {
+        printf("%s could not be loaded\n", defRUNNER_TS_EXECUTOR_DLL);
+        return false;
+    }
+    sg_pfTSDoInitialization = (PTSDOINITIALIZATION)GetProcAddress(m_hTSExecutor, "TS_DoInitialization");
+    sg_pfTSDoDeInitialization = (PTSDODEINITIALIZATION)GetProcAddress(m_hTSExecutor, "TS_DoDeInitialization");
+    sg_pfTSStartStopReadThread = (PFTSSTARTSTOPREADTHREAD)GetProcAddress(m_hTSExecutor, "TS_StartStopReadThread");
+    sg_pfTSSetXMLConfigData = (TSEXECUTORSETXMLCONFIGDATA)GetProcAddress(m_hTSExecutor, "TS_hSetXMLConfigurationData");
+    sg_pfTSExecuteTestSuite = (PTSEXECUTETESTSUITE)GetProcAddress(m_hTSExecutor, "TS_hExecuteTestSuite");
+    if (nullptr == sg_pfTSDoInitialization || nullptr == sg_pfTSDoDeInitialization
+            || nullptr == sg_pfTSStartStopReadThread || nullptr == sg_pfTSSetXMLConfigData
+            || nullptr == sg_pfTSExecuteTestSuite)
+    {
+        printf("%s does not run test suites without its window\n", defRUNNER_TS_EXECUTOR_DLL);
+        FreeLibrary(m_hTSExecutor);
+        m_hTSExecutor = nullptr;
+        return false;
+    }
+    if (m_sSettings.m_strTestSetup.empty())
+    {
+        sg_pfTSSetXMLConfigData(m_pDoc);
+    }
+    sg_pfTSDoInitialization(CAN);
+    sg_pfTSStartStopReadThread(CAN, TRUE);
+    return true;
+}
+
+DWORD WINAPI CCoreRunner::dwTestSuiteProc(LPVOID pParam)
+{
+    CCoreRunner* pouRunner = (CCoreRunner*)pParam;
+    pouRunner->m_hTestSuiteResult = sg_pfTSExecuteTestSuite(CAN, pouRunner->m_sSettings.m_strTestSetup.c_str(),
+                                    &pouRunner->m_unTCExecuted, &pouRunner->m_unTCFailed);
+    pouRunner->vStop();
+    return 0;
+}
+
+/******************************************************************************
+  Function Name    :  nGetTestVerdict
+  Input(s)         :  -
+  Output           :  Exit code of the run, see nRun
+  Functionality    :  Prints the verdict of the test suite.
+  Member of        :  CCoreRunner
+******************************************************************************/
+int CCoreRunner::nGetTestVerdict(void)
+{
+    if (S_OK != m_hTestSuiteResult)
+    {
+        printf("The test suite could not be run\n");
+        return 4;
+    }
+    if (0 == m_unTCExecuted)
+    {
+        printf("The test suite has no enabled test case\n");
+        return 4;
+    }
+    printf("Test cases: %u run, %u passed, %u failed\n",
+           m_unTCExecuted, m_unTCExecuted - m_unTCFailed, m_unTCFailed);
+    return (0 == m_unTCFailed) ? 0 : 3;
+}
+
+void CCoreRunner::vCloseTestSuite(void)
+{
+    if (nullptr == m_hTSExecutor)
+    {
+        return;
+    }
+    sg_pfTSStartStopReadThread(CAN, FALSE);
+    sg_pfTSDoDeInitialization(CAN);
+    FreeLibrary(m_hTSExecutor);
+    m_hTSExecutor = nullptr;
+}
+
+/******************************************************************************
+  Function Name    :  bConnect
+  Input(s)         :  -
+  Output           :  true if the hardware runs
+  Functionality    :  Builds and loads the enabled nodes, then connects in
+                      the order of the main frame: logging, virtual time,
+                      hardware, nodes.
+  Member of        :  CCoreRunner
+******************************************************************************/
+bool CCoreRunner::bConnect(void)
+{
+    if (nullptr != m_pouNodeSim && FALSE == m_pouNodeSim->NS_DLLBuildLoadAllEnabled())
+    {
+        printf("The enabled nodes could not be built\n");
+        return false;
+    }
+    if (m_sSettings.m_bLogging && m_pouLogger->GetLoggingBlockCount() > 0)
+    {
+        m_pouLogger->EnableLogging(true);
+    }
+    if (m_sSettings.m_bVirtualTime)
+    {
+        if (m_pouDIL->DILC_GetSelectedDriver() == DRIVER_CAN_STUB)
+        {
+            m_bVirtual = (m_pouClock->hSetVirtual(true, m_sSettings.m_unVirtualTimeSettleMs) == S_OK);
+        }
+        else
+        {
+            printf("Virtual time is only available on the simulated CAN bus\n");
+        }
+    }
+
+    if (m_pouDIL->DILC_StartHardware() != S_OK)
+    {
+        printf("The CAN hardware could not be started\n");
+        vDisconnect();
+        return false;
+    }
+    m_bConnected = true;
+
+    //Reference of the frame time stamps for the latency
+    SYSTEMTIME sSysTime;
+    LARGE_INTEGER lQpc;
+    m_pouDIL->DILC_GetTimeModeMapping(sSysTime, m_un64RefTicks, lQpc);
+    m_n64RefQpc = lQpc.QuadPart;
+
+    if (nullptr != m_pouNodeSim)
+    {
+        m_pouNodeSim->NS_nOnBusConnected(TRUE);
+        m_pouNodeSim->NS_ManageBusEventHandler(BUS_CONNECT);
+    }
+    return true;
+}
+
+void CCoreRunner::vDisconnect(void)
+{
+    if (nullptr != m_pouNodeSim && m_bConnected)
+    {
+        m_pouNodeSim->NS_ManageBusEventHandler(BUS_DISCONNECT);
+    }
+    if (m_bConnected)
+    {
+        m_pouDIL->DILC_StopHardware();
+        m_bConnected = false;
+    }
+    if (m_bVirtual)
+    {
+        m_pouClock->hSetVirtual(false, 0);
+        m_bVirtual = false;
+    }
+    if (nullptr != m_pouNodeSim)
+    {
+        m_pouNodeSim->NS_nOnBusConnected(FALSE);
+        m_pouNodeSim->NS_DLLUnloadAllEnabled();
+    }
+    if (nullptr != m_pouLogger)
+    {
+        m_pouLogger->EnableLogging(false);
+    }
+}
+
+void CCoreRunner::vClose(void)
+{
+    vCloseTestSuite();
+    if (nullptr != m_pouDIL)
+    {
+        m_pouDIL->DILC_RegisterClient(FALSE, m_dwClientID, defRUNNER_CLIENT_NAME);
+        m_pouDIL->DILC_PerformClosureOperations();
+        m_pouDIL = nullptr;
+        sg_pouRunnerDIL = nullptr;
+    }
+    m_pouLogger = nullptr;
+    m_pouNodeSim = nullptr;
+    if (nullptr != m_pDoc)
+    {
+        xmlUtils::vFreeDocIndex(m_pDoc);
+        xmlFreeDoc(m_pDoc);
+        m_pDoc = nullptr;
+    }
+}
+
+/******************************************************************************
+  Function Name    :  vReadFrames
+  Input(s)         :  -
+  Output           :  -
+  Functionality    :  Empties the client buffer and counts the frames by
+                      type. The latency is the age of a frame when the runner
+                      takes it: the time of the driver now, extrapolated with
+                      the performance counter, minus the time stamp.
+  Member of        :  CCoreRunner
+******************************************************************************/
+void CCoreRunner::vReadFrames(void)
+{
+    int nRead = 0;
+    while ((nRead = m_ouBuf.nReadMultiple(m_asFrames, defRUNNER_READ_BATCH)) > 0)
+    {
+        UINT64 un64NowTicks = un64GetNowTicks();
+        for (int i = 0; i < nRead; i++)
+        {
+            const STCANDATA& sFrame = m_asFrames[i];
+            if (sFrame.m_ucDataType & ERR_FLAG)
+            {
+                m_sInterval.m_un64Errors++;
+                continue;
+            }
+            if (IS_TX_MESSAGE(sFrame.m_ucDataType))
+            {
+                m_sInterval.m_un64Tx++;
+            }
+            else
+            {
+                m_sInterval.m_un64Rx++;
+            }
+            UINT64 un64Frame = (UINT64)sFrame.m_lTickCount.QuadPart;
+            UINT64 un64Latency = (un64NowTicks > un64Frame) ? (un64NowTicks - un64Frame) : 0;
+            m_sInterval.m_un64LatencySum += un64Latency;
+            m_sInterval.m_un64MaxLatency = max(m_sInterval.m_un64MaxLatency, un64Latency);
+        }
+    }
+}
+
+UINT64 CCoreRunner::un64GetNowTicks(void)
+{
+    LARGE_INTEGER lNow;
+    QueryPerformanceCounter(&lNow);
+    LONGLONG n64Delta = lNow.QuadPart - m_n64RefQpc;
+    return m_un64RefTicks + (UINT64)(n64Delta * 1000 * defRUNNER_TICKS_PER_MS / m_n64QpcFreq);
+}
+
+/******************************************************************************
+  Function Name    :  vReport
+  Input(s)         :  un64ElapsedUs - Time since connect
+                      bFinal - Report over the whole run instead of the interval
+  Output           :  -
+  Functionality    :  Prints the frame rates and latency of the runner, the
+                      frames lost in its buffer, the reorder stage counters
+                      of the driver and the message handler counters of the
+                      nodes.
+  Member of        :  CCoreRunner
+******************************************************************************/
+void CCoreRunner::vReport(UINT64 un64ElapsedUs, bool bFinal)
+{
+    m_sTotal.m_un64Rx += m_sInterval.m_un64Rx;
+    m_sTotal.m_un64Tx += m_sInterval.m_un64Tx;
+    m_sTotal.m_un64Errors += m_sInterval.m_un64Errors;
+    m_sTotal.m_un64LatencySum += m_sInterval.m_un64LatencySum;
+    m_sTotal.m_un64MaxLatency = max(m_sTotal.m_un64MaxLatency, m_sInterval.m_un64MaxLatency);
+
+    const sRUNNER_COUNTERS& sCounters = bFinal ? m_sTotal : m_sInterval;
+    UINT64 un64PeriodUs = bFinal ? un64ElapsedUs : (un64ElapsedUs - m_un64LastReportUs);
+    double dSeconds = (un64PeriodUs > 0) ? (un64PeriodUs / 1000000.0) : 1.0;
+    UINT64 un64Frames = sCounters.m_un64Rx + sCounters.m_un64Tx;
+    double dMeanMs = (un64Frames > 0) ? ((double)sCounters.m_un64LatencySum / un64Frames / defRUNNER_TICKS_PER_MS) : 0.0;
+    LONG lDropped = m_ouBuf.lGetDropped();
+
+    printf("%s %.3f s: Rx %.0f/s Tx %.0f/s Err %.0f/s, dropped %ld, latency mean %.2f ms max %.2f ms\n",
+           bFinal ? "Total" : "Interval", un64ElapsedUs / 1000000.0,
+           sCounters.m_un64Rx / dSeconds, sCounters.m_un64Tx / dSeconds, sCounters.m_un64Errors / dSeconds,
+           bFinal ? lDropped : (lDropped - m_lReportedDrops),
+           dMeanMs, (double)sCounters.m_un64MaxLatency / defRUNNER_TICKS_PER_MS);
+
+    SREORDER_STATS sReorder;
+    if (nullptr != m_pouDIL && m_pouDIL->DILC_GetReorderStats(sReorder) == S_OK)
+    {
+        printf("  Reorder: frames %I64u, reordered %I64u, late %I64u (max %.1f ms), hold expired %I64u, depth %u (max %u), channels %u (idle %I64u), hold %u ms\n",
+               sReorder.m_un64Frames, sReorder.m_un64Reordered, sReorder.m_un64Late,
+               (double)sReorder.m_un64MaxLateness / 1000000.0, sReorder.m_un64HoldExpired,
+               sReorder.m_unDepth, sReorder.m_unMaxDepth, sReorder.m_unActiveChannels,
+               sReorder.m_un64IdleChannels, sReorder.m_unHoldTimeMs);
+    }
+
+    if (nullptr != m_pouNodeSim)
+    {
+        SMSG_HANDLER_STATS sHandlers;
+        m_pouNodeSim->NS_GetMsgHandlerStats(sHandlers);
+        printf("  Handlers: executed %I64u, dropped %I64u, depth %u (max %u), latency mean %I64u us max %I64u us, run mean %I64u us max %I64u us\n",
+               sHandlers.m_un64Executed, sHandlers.m_un64Dropped, sHandlers.m_unDepth, sHandlers.m_unMaxDepth,
+               sHandlers.m_un64MeanLatencyUs, sHandlers.m_un64MaxLatencyUs,
+               sHandlers.m_un64MeanRunUs, sHandlers.m_un64MaxRunUs);
+    }
+    fflush(stdout);
+
+    memset(&m_sInterval, 0, sizeof(m_sInterval));
+    m_un64LastReportUs = un64ElapsedUs;
+    m_lReportedDrops = lDropped;
+}
@@ -0,0 +1,195 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      CoreRunner.h
+ * \brief     Interface file for CCoreRunner class
+ *
+ * Interface file for CCoreRunner class
+ */
+
+#pragma once
+
+#include "IBusMasterKernel.h"
+#include "BaseDIL_CAN.h"
+#include "MsgBufFSE.h"
+#include "ReorderStage.h"
+#include "FrameProcessor/FrameProcessor_extern.h"
+#include "NodeSimEx/BaseNodeSim.h"
+#include "NodeSimEx/NodeSimEx_Extern.h"
+
+#define defRUNNER_CLIENT_NAME       "CAN_RUNNER"
+#define defRUNNER_VERSION           "Ver 3.2.2"
+#define defRUNNER_READ_BATCH        256         // Frames taken from the client buffer at once
+#define defRUNNER_WAIT_MS           100         // Longest wait for frames, bounds the report delay
+#define defRUNNER_TS_EXECUTOR_DLL   "TestSuiteExecutorGUI.dll"
+
+/* Command line of the runner */
+struct sRUNNER_SETTINGS
+{
+    std::string m_strCfxFile;
+    std::string m_strDriver;        // Overrides the driver of the configuration if not empty
+    UINT m_unDurationSec;           // 0 runs until Ctrl+C
+    UINT m_unIntervalSec;           // Time between two reports, 0 reports at the end only
+    bool m_bVirtualTime;            // Simulated bus only
+    UINT m_unVirtualTimeSettleMs;
+    bool m_bLogging;                // Log as configured in the logging blocks
+    bool m_bNodes;                  // Build, load and connect the enabled nodes
+    bool m_bTestSuite;              // Run a test suite, the run ends with it
+    std::string m_strTestSetup;     // Test setup file, empty runs the test suite of the configuration
+    std::string m_strBench;         // Runs this benchmark instead of a configuration if not empty
+    UINT m_unIterations;            // Iterations of the benchmark, 0 for its default
+};
+
+/* Received frames of the runner between two reports */
+struct sRUNNER_COUNTERS
+{
+    UINT64 m_un64Rx;
+    UINT64 m_un64Tx;
+    UINT64 m_un64Errors;
+    UINT64 m_un64LatencySum;        // In ticks of STCANDATA::m_lTickCount
+    UINT64 m_un64MaxLatency;
+};
+
+/**
+ * Client buffer of the runner, counts the frames that did not fit.
+ */
+class CRunnerBufFSE : public CMsgBufFSE<STCANDATA>
+{
+public:
+    CRunnerBufFSE(void) : m_lDropped(0)
+    {
+    }
+
+    HRESULT WriteIntoBuffer(STCANDATA* psMsgBuffer)
+    {
+        HRESULT hResult = CMsgBufFSE<STCANDATA>::WriteIntoBuffer(psMsgBuffer);
+        if (ERR_FULL_APP_BUFFER == hResult)
+        {
+            InterlockedIncrement(&m_lDropped);
+        }
+        return hResult;
+    }
+
+    int nWriteMultiple(STCANDATA* psMsgBuffers, int nCount)
+    {
+        int nWritten = CMsgBufFSE<STCANDATA>::nWriteMultiple(psMsgBuffers, nCount);
+        if (nWritten < nCount)
+        {
+            InterlockedExchangeAdd(&m_lDropped, nCount - nWritten);
+        }
+        return nWritten;
+    }
+
+    LONG lGetDropped(void) const
+    {
+        return m_lDropped;
+    }
+
+private:
+    volatile LONG m_lDropped;
+};
+
+/**
+ * Runs a configuration without any window.
+ *
+ * Loads the CAN part of a .cfx: driver, databases, logging blocks and the
+ * simulated nodes, connects, and counts what the frame processor passes on
+ * to the client buffer of the runner, as it does for the message window.
+ * Every report prints the frame rates, the frames lost in the client
+ * buffer, the age of the frames when the runner read them, the reorder stage
+ * counters of the driver and the message handler counters of the nodes, so
+ * a run gives the same numbers each time on the simulated bus.
+ *
+ * With /testsuite the test executor runs a test setup file or the test suite
+ * of the configuration while the counters go on, the run ends with the suite
+ * and the exit code gives its verdict. Results go to the report files of the
+ * test setups.
+ *
+ * Controller settings are the defaults of the driver.
+ */
+class CCoreRunner : public CBaseAppServices, public Base_WrapperErrorLogger
+{
+public:
+    CCoreRunner(void);
+    ~CCoreRunner(void);
+
+    //Returns the exit code of the process
+    int nRun(const sRUNNER_SETTINGS& sSettings);
+    //Ends nRun, may be called from any thread
+    void vStop(void);
+
+    //Trace of the nodes and the logger, goes to the console
+    BOOL bWriteToTrace(char* pcTraceStr);
+    void vLogAMessage(char File[], int Line, std::string Msg);
+
+private:
+    bool bLoadConfig(void);
+    DWORD dwGetDriverId(void);
+    void vLoadDatabases(void);
+    bool bInitDIL(void);
+    bool bInitLogger(void);
+    bool bInitNodes(void);
+    bool bInitTestSuite(void);
+    int nGetTestVerdict(void);
+    void vCloseTestSuite(void);
+    static DWORD WINAPI dwTestSuiteProc(LPVOID pParam);
+    bool bConnect(void);
+    void vDisconnect(void);
+    void vClose(void);
+
+    void vReadFrames(void);
+    void vReport(UINT64 un64ElapsedUs, bool bFinal);
+    UINT64 un64GetNowTicks(void);
+
+    sRUNNER_SETTINGS m_sSettings;
+    xmlDocPtr m_pDoc;
+
+    IBusMasterKernel* m_pouKernel;
+    IBMNetWorkService* m_pouNetwork;
+    IClockService* m_pouClock;      // Time base of the run, virtual with /virtualtime
+    CBaseDIL_CAN* m_pouDIL;
+    CBaseFrameProcessor_CAN* m_pouLogger;
+    CBaseNodeSim* m_pouNodeSim;
+    S_EXFUNC_PTR m_sExFuncPtr;
+
+    SCONTROLLER_DETAILS m_asControllers[defNO_OF_CHANNELS];
+    INTERFACE_HW_LIST m_asHwList;
+    INT m_nChannels;
+    DWORD m_dwClientID;
+    CRunnerBufFSE m_ouBuf;
+    STCANDATA m_asFrames[defRUNNER_READ_BATCH];
+    bool m_bConnected;
+    bool m_bVirtual;                // Virtual time was switched on at connect
+    HANDLE m_hStop;
+
+    HMODULE m_hTSExecutor;          // Test executor, loaded for /testsuite only
+    HANDLE m_hTestSuite;            // Thread running the test suite
+    HRESULT m_hTestSuiteResult;
+    UINT m_unTCExecuted;
+    UINT m_unTCFailed;
+
+    UINT64 m_un64RefTicks;          // Frame ticks at m_n64RefQpc
+    LONGLONG m_n64RefQpc;
+    LONGLONG m_n64QpcFreq;
+
+    sRUNNER_COUNTERS m_sInterval;   // Since the last report
+    sRUNNER_COUNTERS m_sTotal;
+    UINT64 m_un64LastReportUs;      // Elapsed time of the last report
+    LONG m_lReportedDrops;
+
+    CCoreRunner(const CCoreRunner&);
+    CCoreRunner& operator=(const CCoreRunner&);
+};
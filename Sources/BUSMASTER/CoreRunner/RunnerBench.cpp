@@ -0,0 +1,1130 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      RunnerBench.cpp
+ * \brief     Benchmarks of the core runner
+ *
+ * Benchmarks of the core runner
+ */
+
+#include "CoreRunner_stdafx.h"
+#include "RunnerBench.h"
+#include "Error.h"
+#include "MsgBufVSE.h"
+#include "J1939MsgPool.h"
+#include "CANDriverDefines.h"
+#include "MsgBufFSE.h"
+#include "ClientDispatch.h"
+#include "DIL_Interface/LinScheduleEngine.h"
+#include "DeviceTimebase.h"
+#include "TimebaseDriftFixture.h"
+#include "NodeSimEx/HandlerPool.h"
+#include <algorithm>
+
+typedef int (*PFRUNNER_BENCH)(UINT unIterations);
+
+struct sRUNNER_BENCH
+{
+    const char* m_pchName;
+    const char* m_pchDescription;
+    PFRUNNER_BENCH m_pfBench;
+};
+
+//Seconds since sStart
+static double dGetElapsed(const LARGE_INTEGER& sStart)
+{
+    LARGE_INTEGER sNow, sFrequency;
+    QueryPerformanceCounter(&sNow);
+    QueryPerformanceFrequency(&sFrequency);
+    return (double)(sNow.QuadPart - sStart.QuadPart) / (double)sFrequency.QuadPart;
+}
+
+/* J1939 ---------------------------------------------------------------------*/
+
+#define defBENCH_J1939_CLIENTS      4       //Message window, logger, node simulation and signal watch
+#define defBENCH_J1939_SLOW_CLIENT  3       //Reads seldom into the smallest buffer, so it overruns
+#define defBENCH_J1939_SLOW_READ    1024    //Messages between two reads of the slow client
+#define defBENCH_J1939_BAM_EVERY    5       //One transport protocol message every n messages
+#define defBENCH_J1939_BAM_LEN      100     //Data bytes of a DM1 with 24 DTCs
+#define defBENCH_J1939_BUFFER_SIZE  100000
+
+//Every 5th message a DM1 by BAM, the others EEC1 single frames
+static void vMakeJ1939Msg(STJ1939_MSG& sMsg, UINT unIndex)
+{
+    bool bBam = (0 == (unIndex % defBENCH_J1939_BAM_EVERY));
+    sMsg.m_sMsgProperties.m_un64TimeStamp = (UINT64)unIndex * 10;
+    sMsg.m_sMsgProperties.m_byChannel = 1;
+    sMsg.m_sMsgProperties.m_eType = bBam ? MSG_TYPE_BROADCAST : MSG_TYPE_DATA;
+    sMsg.m_sMsgProperties.m_eDirection = DIR_RX;
+    sMsg.m_sMsgProperties.m_uExtendedID.m_unExtID = bBam ? 0x18FECA00 : 0x0CF00400;
+    sMsg.m_unDLC = bBam ? defBENCH_J1939_BAM_LEN : 8;
+    for (UINT unByte = 0; unByte < sMsg.m_unDLC; unByte++)
+    {
+        sMsg.m_pbyData[unByte] = (BYTE)(unIndex + unByte);
+    }
+}
+
+//What a client does with a message, the sum keeps the reads from being optimised away
+static UINT unUseJ1939Msg(const STJ1939_MSG& sMsg)
+{
+    return sMsg.m_sMsgProperties.m_uExtendedID.m_unExtID + sMsg.m_pbyData[sMsg.m_unDLC - 1];
+}
+
+//Reads the stream entries of a client the way the clients did before the pool
+static UINT unReadJ1939Streams(CMsgBufVSE& ouBuf, BYTE* pbyStream)
+{
+    UINT unSum = 0;
+    while (ouBuf.GetMsgCount() > 0)
+    {
+        INT nType = 0;
+        INT nSize = MAX_MSG_LEN_J1939;
+        if (ouBuf.ReadFromBuffer(nType, pbyStream, nSize) == CALL_SUCCESS)
+        {
+            STJ1939_MSG sMsg;
+            sMsg.vAttachDataStream(pbyStream);
+            unSum += unUseJ1939Msg(sMsg);
+        }
+    }
+    return unSum;
+}
+
+//Reads the pool entries of a client the way the clients do now
+static UINT unReadJ1939Pool(CMsgBufVSE& ouBuf)
+{
+    UINT unSum = 0;
+    sJ1939POOLMSG* psPoolMsg = nullptr;
+    while (ouBuf.GetMsgCount() > 0)
+    {
+        if (CJ1939MsgPool::hReadFromBuffer(ouBuf, psPoolMsg) == CALL_SUCCESS)
+        {
+            STJ1939_MSG sMsg;
+            sMsg.vAttachDataStream(psPoolMsg->m_abyStream);
+            unSum += unUseJ1939Msg(sMsg);
+            CJ1939MsgPool::vRelease(psPoolMsg);
+        }
+    }
+    return unSum;
+}
+
+/**
+ * Fans J1939 messages out to four client buffers, once as rendered streams
+ * as before the shared pool and once as pool references as
+ * CNodeConManager::WriteIntoClientsBuffer does now. One client reads seldom
+ * into a small buffer, its overruns release their references through the
+ * drop handler. Fails if a pool block is still referenced at the end.
+ */
+static int nBenchJ1939(UINT unIterations)
+{
+    CMsgBufVSE aouClients[defBENCH_J1939_CLIENTS];
+    BYTE abyStream[MAX_MSG_LEN_J1939];
+    STJ1939_MSG sMsg;
+    sMsg.vInitialize(MAX_DATA_LEN_J1939);
+    UINT unSum = 0;
+    UINT64 un64StreamBytes = 0;
+
+    for (int nClient = 0; nClient < defBENCH_J1939_CLIENTS; nClient++)
+    {
+        int nSize = (defBENCH_J1939_SLOW_CLIENT == nClient) ? 0 : defBENCH_J1939_BUFFER_SIZE;
+        aouClients[nClient].nSetBufferSize(nSize);
+    }
+
+    //Rendered stream written into every client buffer
+    LARGE_INTEGER sStart;
+    QueryPerformanceCounter(&sStart);
+    for (UINT unIndex = 0; unIndex < unIterations; unIndex++)
+    {
+        vMakeJ1939Msg(sMsg, unIndex);
+        sMsg.vGetDataStream(abyStream);
+        UINT unSize = sMsg.unGetSize();
+        un64StreamBytes += unSize;
+        for (int nClient = 0; nClient < defBENCH_J1939_CLIENTS; nClient++)
+        {
+            aouClients[nClient].WriteIntoBuffer(J1939, abyStream, unSize);
+        }
+        for (int nClient = 0; nClient < defBENCH_J1939_CLIENTS; nClient++)
+        {
+            if ((defBENCH_J1939_SLOW_CLIENT != nClient) || (0 == ((unIndex + 1) % defBENCH_J1939_SLOW_READ)))
+            {
+                unSum += unReadJ1939Streams(aouClients[nClient], abyStream);
+            }
+        }
+    }
+    double dStreamSec = dGetElapsed(sStart);
+    int nStreamSkipped = aouClients[defBENCH_J1939_SLOW_CLIENT].GetSkippedMsgCount();
+    for (int nClient = 0; nClient < defBENCH_J1939_CLIENTS; nClient++)
+    {
+        aouClients[nClient].vClearMessageBuffer();
+        aouClients[nClient].vSetDropHandler(CJ1939MsgPool::vReleaseEntry);
+    }
+
+    //Pool block rendered once, its pointer written into every client buffer
+    CJ1939MsgPool ouPool;
+    QueryPerformanceCounter(&sStart);
+    for (UINT unIndex = 0; unIndex < unIterations; unIndex++)
+    {
+        vMakeJ1939Msg(sMsg, unIndex);
+        sJ1939POOLMSG* psPoolMsg = ouPool.psAlloc(sMsg.unGetSize());
+        if (nullptr == psPoolMsg)
+        {
+            printf("j1939: pool allocation failed\n");
+            return 1;
+        }
+        sMsg.vGetDataStream(psPoolMsg->m_abyStream);
+        CJ1939MsgPool::vAddRef(psPoolMsg, defBENCH_J1939_CLIENTS);
+        for (int nClient = 0; nClient < defBENCH_J1939_CLIENTS; nClient++)
+        {
+            int nResult = aouClients[nClient].WriteIntoBuffer(J1939, (BYTE*)&psPoolMsg, sizeof(psPoolMsg));
+            if ((CALL_SUCCESS != nResult) && (WARN_BUFFER_OVERRUN != nResult))
+            {
+                CJ1939MsgPool::vRelease(psPoolMsg);
+            }
+        }
+        CJ1939MsgPool::vRelease(psPoolMsg);
+        for (int nClient = 0; nClient < defBENCH_J1939_CLIENTS; nClient++)
+        {
+            if ((defBENCH_J1939_SLOW_CLIENT != nClient) || (0 == ((unIndex + 1) % defBENCH_J1939_SLOW_READ)))
+            {
+                unSum += unReadJ1939Pool(aouClients[nClient]);
+            }
+        }
+    }
+    double dPoolSec = dGetElapsed(sStart);
+    int nPoolSkipped = aouClients[defBENCH_J1939_SLOW_CLIENT].GetSkippedMsgCount();
+    for (int nClient = 0; nClient < defBENCH_J1939_CLIENTS; nClient++)
+    {
+        aouClients[nClient].vClearMessageBuffer();
+    }
+
+    double dStreamBytes = (double)un64StreamBytes / unIterations;
+    printf("j1939: %u messages, %d clients, one DM1 of %d bytes every %d messages (checksum %u)\n",
+           unIterations, defBENCH_J1939_CLIENTS, defBENCH_J1939_BAM_LEN, defBENCH_J1939_BAM_EVERY, unSum);
+    printf("  stream: %8.0f msg/s, %6.0f bytes copied/msg, %d dropped by the slow client\n",
+           unIterations / dStreamSec, dStreamBytes * (1 + 2 * defBENCH_J1939_CLIENTS), nStreamSkipped);
+    printf("  pool:   %8.0f msg/s, %6.0f bytes copied/msg, %d dropped by the slow client\n",
+           unIterations / dPoolSec, dStreamBytes + 2.0 * defBENCH_J1939_CLIENTS * sizeof(sJ1939POOLMSG*), nPoolSkipped);
+    printf("  pool blocks allocated %ld, still referenced %ld\n", ouPool.lGetAllocated(), ouPool.lGetInUse());
+    return (0 == ouPool.lGetInUse()) ? 0 : 1;
+}
+
+/* TX echo -------------------------------------------------------------------*/
+
+#define defBENCH_TXECHO_CLIENTS     4       //Each client transmits, all receive
+#define defBENCH_TXECHO_IDS         64      //Identifiers the clients transmit on
+#define defBENCH_TXECHO_IN_FLIGHT   256     //Transmits sent and not yet echoed
+#define defBENCH_TXECHO_RX_PER_TX   3       //Frames of other nodes per echo
+#define defBENCH_TXECHO_READ_BURST  16      //Frames the mock driver queue returns per read
+
+//Client map entry of the mock driver, as CClientDispatch expects it
+struct sBENCH_CLIENT
+{
+    DWORD dwClientID;
+    CBaseCANBufFSE* pClientBuf[1];
+    UINT unBufCount;
+};
+
+//Pending transmit of the list the drivers walked before the echo map
+struct sBENCH_ACK
+{
+    UINT m_unMsgID;
+    UINT m_unChannel;
+    DWORD m_dwClientID;
+    bool operator == (const sBENCH_ACK& sOther) const
+    {
+        return (m_unMsgID == sOther.m_unMsgID) && (m_unChannel == sOther.m_unChannel);
+    }
+};
+
+//The frame the mock driver reads as unIndex, every (1 + RX_PER_TX)th is the echo of a transmit
+static void vMakeTxEchoFrame(STCANDATA& sData, UINT unIndex, bool& bEcho)
+{
+    bEcho = (0 == (unIndex % (1 + defBENCH_TXECHO_RX_PER_TX)));
+    sData.m_ucDataType = bEcho ? TX_FLAG : RX_FLAG;
+    sData.m_lTickCount.QuadPart = unIndex;
+    sData.m_uDataInfo.m_sCANMsg.m_ucChannel = 1;
+    sData.m_uDataInfo.m_sCANMsg.m_unMsgID = bEcho ? (unIndex / (1 + defBENCH_TXECHO_RX_PER_TX)) % defBENCH_TXECHO_IDS
+                                            : 0x400 + (unIndex % 37);
+    sData.m_uDataInfo.m_sCANMsg.m_ucDataLen = 8;
+}
+
+//Client that sent the nth transmit
+static DWORD dwGetTxEchoSender(UINT unTransmit)
+{
+    return 1 + (unTransmit % defBENCH_TXECHO_CLIENTS);
+}
+
+//Reads all client buffers, counts the frames each client got flagged as its own echo
+static void vReadTxEchoClients(sBENCH_CLIENT* psClients, STCANDATA* psFrames, UINT* punOwnEchoes)
+{
+    for (int nClient = 0; nClient < defBENCH_TXECHO_CLIENTS; nClient++)
+    {
+        int nRead = 0;
+        while ((nRead = psClients[nClient].pClientBuf[0]->nReadMultiple(psFrames, defDISPATCH_BATCH_SIZE)) > 0)
+        {
+            for (int nFrame = 0; nFrame < nRead; nFrame++)
+            {
+                punOwnEchoes[nClient] += (TX_FLAG == psFrames[nFrame].m_ucDataType) ? 1 : 0;
+            }
+        }
+    }
+}
+
+/**
+ * Mock CAN driver with four clients that keep 256 transmits in flight, the
+ * echo of each transmit comes back between frames of other nodes. Runs the
+ * read loop once with the pending list walked per echo and one buffer write
+ * per frame and client, as the drivers did before CTxEchoMap, and once with
+ * CTxEchoMap and CClientDispatch. Fails if a client does not get exactly its
+ * own echoes flagged as TX, or a transmit is still pending at the end.
+ */
+static int nBenchTxEcho(UINT unIterations)
+{
+    sBENCH_CLIENT asClients[defBENCH_TXECHO_CLIENTS];
+    for (int nClient = 0; nClient < defBENCH_TXECHO_CLIENTS; nClient++)
+    {
+        asClients[nClient].dwClientID = nClient + 1;
+        asClients[nClient].pClientBuf[0] = new CMsgBufFSE<STCANDATA>;
+        asClients[nClient].unBufCount = 1;
+    }
+    STCANDATA asFrames[defDISPATCH_BATCH_SIZE];
+    UINT aunListEchoes[defBENCH_TXECHO_CLIENTS] = { 0 };
+    UINT aunMapEchoes[defBENCH_TXECHO_CLIENTS] = { 0 };
+    UINT unTransmits = 0;
+    int nResult = 0;
+
+    //Pending list walked per echo, every frame written on its own
+    std::list<sBENCH_ACK> ouPending;
+    LARGE_INTEGER sStart;
+    QueryPerformanceCounter(&sStart);
+    for (UINT unIndex = 0; unIndex < unIterations; unIndex++)
+    {
+        STCANDATA sData;
+        bool bEcho = false;
+        vMakeTxEchoFrame(sData, unIndex, bEcho);
+        if (bEcho)
+        {
+            //The clients keep the window full, the echo is of the oldest transmit of the ID
+            while (unTransmits < (unIndex / (1 + defBENCH_TXECHO_RX_PER_TX)) + defBENCH_TXECHO_IN_FLIGHT)
+            {
+                sBENCH_ACK sAck = { unTransmits % defBENCH_TXECHO_IDS, 1, dwGetTxEchoSender(unTransmits) };
+                ouPending.push_back(sAck);
+                unTransmits++;
+            }
+            sBENCH_ACK sAck = { sData.m_uDataInfo.m_sCANMsg.m_unMsgID, 1, 0 };
+            std::list<sBENCH_ACK>::iterator itrAck = std::find(ouPending.begin(), ouPending.end(), sAck);
+            if (itrAck != ouPending.end())
+            {
+                sAck.m_dwClientID = itrAck->m_dwClientID;
+                ouPending.erase(itrAck);
+            }
+            for (int nClient = 0; nClient < defBENCH_TXECHO_CLIENTS; nClient++)
+            {
+                STCANDATA sClientData = sData;
+                sClientData.m_ucDataType = (asClients[nClient].dwClientID == sAck.m_dwClientID) ? TX_FLAG : RX_FLAG;
+                asClients[nClient].pClientBuf[0]->WriteIntoBuffer(&sClientData);
+            }
+        }
+        else
+        {
+            for (int nClient = 0; nClient < defBENCH_TXECHO_CLIENTS; nClient++)
+            {
+                asClients[nClient].pClientBuf[0]->WriteIntoBuffer(&sData);
+            }
+        }
+        if (0 == ((unIndex + 1) % defBENCH_TXECHO_READ_BURST))
+        {
+            vReadTxEchoClients(asClients, asFrames, aunListEchoes);
+        }
+    }
+    vReadTxEchoClients(asClients, asFrames, aunListEchoes);
+    double dListSec = dGetElapsed(sStart);
+
+    //Echo map and one buffer write per client and read burst
+    CTxEchoMap ouEchoMap;
+    CClientDispatch<STCANDATA>* pouDispatch = new CClientDispatch<STCANDATA>;
+    unTransmits = 0;
+    QueryPerformanceCounter(&sStart);
+    for (UINT unIndex = 0; unIndex < unIterations; unIndex++)
+    {
+        STCANDATA sData;
+        bool bEcho = false;
+        vMakeTxEchoFrame(sData, unIndex, bEcho);
+        if (bEcho)
+        {
+            while (unTransmits < (unIndex / (1 + defBENCH_TXECHO_RX_PER_TX)) + defBENCH_TXECHO_IN_FLIGHT)
+            {
+                ouEchoMap.vAddEntry(1, unTransmits % defBENCH_TXECHO_IDS, dwGetTxEchoSender(unTransmits));
+                unTransmits++;
+            }
+            pouDispatch->vDispatch(sData, ouEchoMap, 1, sData.m_uDataInfo.m_sCANMsg.m_unMsgID,
+                                   asClients, defBENCH_TXECHO_CLIENTS);
+        }
+        else
+        {
+            pouDispatch->vAddFrame(sData, 0);
+            if (pouDispatch->bIsFull())
+            {
+                pouDispatch->vFlush(asClients, defBENCH_TXECHO_CLIENTS);
+            }
+        }
+        //The driver queue is drained after every read burst
+        if (0 == ((unIndex + 1) % defBENCH_TXECHO_READ_BURST))
+        {
+            pouDispatch->vFlush(asClients, defBENCH_TXECHO_CLIENTS);
+            vReadTxEchoClients(asClients, asFrames, aunMapEchoes);
+        }
+    }
+    pouDispatch->vFlush(asClients, defBENCH_TXECHO_CLIENTS);
+    vReadTxEchoClients(asClients, asFrames, aunMapEchoes);
+    double dMapSec = dGetElapsed(sStart);
+
+    //Echoes the transmits still in flight, after which nothing may be pending
+    UINT unEchoes = (unIterations + defBENCH_TXECHO_RX_PER_TX) / (1 + defBENCH_TXECHO_RX_PER_TX);
+    for (UINT unTransmit = unEchoes; unTransmit < unTransmits; unTransmit++)
+    {
+        UINT unClientID = 0;
+        if ((FALSE == ouEchoMap.bRemoveEntry(1, unTransmit % defBENCH_TXECHO_IDS, unClientID))
+                || (dwGetTxEchoSender(unTransmit) != unClientID))
+        {
+            nResult = 1;
+        }
+    }
+    if (0 != ouEchoMap.unGetCount())
+    {
+        nResult = 1;
+    }
+
+    printf("txecho: %u frames, %d clients, %d transmits in flight on %d IDs\n",
+           unIterations, defBENCH_TXECHO_CLIENTS, defBENCH_TXECHO_IN_FLIGHT, defBENCH_TXECHO_IDS);
+    printf("  list:  %8.0f frames/s\n", unIterations / dListSec);
+    printf("  map:   %8.0f frames/s\n", unIterations / dMapSec);
+    for (int nClient = 0; nClient < defBENCH_TXECHO_CLIENTS; nClient++)
+    {
+        //Client n sent every 4th transmit from the nth on
+        UINT unExpected = (unEchoes + defBENCH_TXECHO_CLIENTS - 1 - nClient) / defBENCH_TXECHO_CLIENTS;
+        if ((aunListEchoes[nClient] != unExpected) || (aunMapEchoes[nClient] != unExpected))
+        {
+            printf("  client %d: %u own echoes by list, %u by map, %u expected\n",
+                   nClient + 1, aunListEchoes[nClient], aunMapEchoes[nClient], unExpected);
+            nResult = 1;
+        }
+        delete asClients[nClient].pClientBuf[0];
+    }
+    delete pouDispatch;
+    return nResult;
+}
+
+/* DIL batches ---------------------------------------------------------------*/
+
+#define defBENCH_DILBATCH_SIZE      64      //Frames per batched send and read, as the message window reads
+#define defBENCH_DILBATCH_READ      4096    //Frames sent between two reads of the receiving client
+
+//Broker thread of the simulation stub, one action event and one finish event per call
+struct sBENCH_BROKER
+{
+    HANDLE m_hAction;
+    HANDLE m_hFinish;
+    const STCAN_MSG* m_psMsgs;
+    UINT m_unCount;
+    volatile bool m_bExit;
+    CMsgBufFSE<STCANDATA>* m_pouBus;
+};
+
+static DWORD WINAPI dwBenchBrokerProc(LPVOID pVoid)
+{
+    sBENCH_BROKER* psBroker = (sBENCH_BROKER*)pVoid;
+    STCANDATA asData[defBENCH_DILBATCH_SIZE];
+    while ((WaitForSingleObject(psBroker->m_hAction, INFINITE) == WAIT_OBJECT_0) && (false == psBroker->m_bExit))
+    {
+        for (UINT i = 0; i < psBroker->m_unCount; i++)
+        {
+            asData[i].m_ucDataType = TX_FLAG;
+            asData[i].m_uDataInfo.m_sCANMsg = psBroker->m_psMsgs[i];
+        }
+        if (1 == psBroker->m_unCount)
+        {
+            psBroker->m_pouBus->WriteIntoBuffer(&asData[0]);
+        }
+        else
+        {
+            psBroker->m_pouBus->nWriteMultiple(asData, (int)psBroker->m_unCount);
+        }
+        SetEvent(psBroker->m_hFinish);
+    }
+    return 0;
+}
+
+//One round trip to the broker thread
+static void vBrokerSend(sBENCH_BROKER& sBroker, const STCAN_MSG* psMsgs, UINT unCount)
+{
+    sBroker.m_psMsgs = psMsgs;
+    sBroker.m_unCount = unCount;
+    SetEvent(sBroker.m_hAction);
+    WaitForSingleObject(sBroker.m_hFinish, INFINITE);
+}
+
+//Empties the bus buffer entry by entry or in batches, false if a frame is missing or out of order
+static bool bReadBenchBus(CMsgBufFSE<STCANDATA>& ouBus, bool bBatched, UINT& unNext)
+{
+    bool bInOrder = true;
+    STCANDATA asData[defBENCH_DILBATCH_SIZE];
+    int nRead = 0;
+    do
+    {
+        nRead = 0;
+        if (bBatched)
+        {
+            nRead = ouBus.nReadMultiple(asData, defBENCH_DILBATCH_SIZE);
+        }
+        else if (ouBus.ReadFromBuffer(&asData[0]) == CALL_SUCCESS)
+        {
+            nRead = 1;
+        }
+        for (int i = 0; i < nRead; i++, unNext++)
+        {
+            bInOrder = bInOrder && (asData[i].m_uDataInfo.m_sCANMsg.m_unMsgID == (unNext & 0x7FF));
+        }
+    }
+    while (nRead > 0);
+    return bInOrder;
+}
+
+/**
+ * Sends CAN frames through a thread that stands in for the broker thread of
+ * the simulation stub and reads them back from the bus buffer. Runs once
+ * with one round trip and one buffer write per frame and the receiver
+ * reading entry by entry, as before DILC_SendMsgs and DILC_ReadMsgs, and once
+ * with batches of 64 frames on both sides. Fails if a frame is lost or
+ * comes out of order.
+ */
+static int nBenchDilBatch(UINT unIterations)
+{
+    CMsgBufFSE<STCANDATA> ouBus;
+    sBENCH_BROKER sBroker;
+    sBroker.m_hAction = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    sBroker.m_hFinish = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    sBroker.m_psMsgs = nullptr;
+    sBroker.m_unCount = 0;
+    sBroker.m_bExit = false;
+    sBroker.m_pouBus = &ouBus;
+    HANDLE hBroker = CreateThread(nullptr, 0, dwBenchBrokerProc, &sBroker, 0, nullptr);
+
+    STCAN_MSG asMsgs[defBENCH_DILBATCH_SIZE];
+    memset(asMsgs, 0, sizeof(asMsgs));
+    double adSec[2] = { 0, 0 };
+    int nResult = 0;
+    for (int nBatched = 0; nBatched < 2; nBatched++)
+    {
+        UINT unBatch = (0 == nBatched) ? 1 : defBENCH_DILBATCH_SIZE;
+        UINT unNext = 0;
+        bool bInOrder = true;
+        LARGE_INTEGER sStart;
+        QueryPerformanceCounter(&sStart);
+        for (UINT unSent = 0; unSent < unIterations; )
+        {
+            //Batches don't cross a read of the receiver
+            UINT unCount = min(unBatch, unIterations - unSent);
+            unCount = min(unCount, defBENCH_DILBATCH_READ - (unSent % defBENCH_DILBATCH_READ));
+            for (UINT i = 0; i < unCount; i++)
+            {
+                asMsgs[i].m_unMsgID = (unSent + i) & 0x7FF;
+                asMsgs[i].m_ucDataLen = 8;
+                asMsgs[i].m_ucChannel = 1;
+            }
+            vBrokerSend(sBroker, asMsgs, unCount);
+            unSent += unCount;
+            if (0 == (unSent % defBENCH_DILBATCH_READ))
+            {
+                bInOrder = bReadBenchBus(ouBus, (1 == nBatched), unNext) && bInOrder;
+            }
+        }
+        bInOrder = bReadBenchBus(ouBus, (1 == nBatched), unNext) && bInOrder;
+        adSec[nBatched] = dGetElapsed(sStart);
+        if ((false == bInOrder) || (unNext != unIterations))
+        {
+            printf("  %s: %u of %u frames read, %s\n", (0 == nBatched) ? "single" : "batched",
+                   unNext, unIterations, bInOrder ? "in order" : "out of order");
+            nResult = 1;
+        }
+    }
+
+    sBroker.m_bExit = true;
+    SetEvent(sBroker.m_hAction);
+    WaitForSingleObject(hBroker, INFINITE);
+    CloseHandle(hBroker);
+    CloseHandle(sBroker.m_hAction);
+    CloseHandle(sBroker.m_hFinish);
+
+    printf("dilbatch: %u frames, batches of %d, receiver reads every %d frames\n",
+           unIterations, defBENCH_DILBATCH_SIZE, defBENCH_DILBATCH_READ);
+    printf("  single:  %8.0f frames/s\n", unIterations / adSec[0]);
+    printf("  batched: %8.0f frames/s\n", unIterations / adSec[1]);
+    return nResult;
+}
+
+/* LIN slots -----------------------------------------------------------------*/
+
+#define defBENCH_LINSLOT_PER_ITER   200     //Iterations per slot, a slot takes milliseconds
+
+//Slot lengths of the bench table in milliseconds, as in a typical LDF
+static const double sg_adBenchSlotMs[] = { 10, 5, 5, 10, 2, 1, 20, 5 };
+
+/**
+ * Runs one pass of unSlots slots of the bench table on the slot timer, as
+ * the LIN transmit thread does, and prints the slot start errors and the
+ * processor time the thread used.
+ */
+static int nRunLinSlots(UINT unSlots, UINT unSpinUs)
+{
+    CSheduleTable ouTable;
+    ouTable.m_strTableName = "Bench";
+    for (int nIndex = 0; nIndex < (int)(sizeof(sg_adBenchSlotMs) / sizeof(sg_adBenchSlotMs[0])); nIndex++)
+    {
+        CScheduleCommands ouCommand;
+        ouCommand.m_eCommandType = COMMAND_UNCONDITIONAL;
+        ouCommand.m_fDelay = sg_adBenchSlotMs[nIndex];
+        ouCommand.m_nId = nIndex;
+        ouCommand.m_bEnabled = true;
+        ouTable.m_listCommands.push_back(ouCommand);
+    }
+    CLinScheduleEngine ouEngine;
+    CLinSlotTimer ouTimer;
+    ouTimer.vSetSpinUs(unSpinUs);
+
+    std::vector<UINT> ounErrors;
+    ounErrors.reserve(unSlots);
+    FILETIME sCreation, sExit, sKernelStart, sUserStart, sKernel, sUser;
+    GetThreadTimes(GetCurrentThread(), &sCreation, &sExit, &sKernelStart, &sUserStart);
+    LARGE_INTEGER sStart;
+    QueryPerformanceCounter(&sStart);
+
+    ouEngine.bStartTable(ouEngine.nAddTable(ouTable), CLinScheduleEngine::un64GetTimeUs());
+    sLIN_SLOT_ACTION sAction;
+    while (ounErrors.size() < unSlots)
+    {
+        UINT64 un64DueUs = ouEngine.un64GetNextDue();
+        ouTimer.vWaitUntil(un64DueUs, NULL);
+        UINT64 un64NowUs = CLinScheduleEngine::un64GetTimeUs();
+        if (true == ouEngine.bGetDueAction(un64NowUs, sAction))
+        {
+            ounErrors.push_back((UINT)(un64NowUs - un64DueUs));
+        }
+    }
+
+    double dSec = dGetElapsed(sStart);
+    GetThreadTimes(GetCurrentThread(), &sCreation, &sExit, &sKernel, &sUser);
+    ULARGE_INTEGER aulTimes[4];
+    const FILETIME* apsTimes[4] = { &sKernelStart, &sUserStart, &sKernel, &sUser };
+    for (int nIndex = 0; nIndex < 4; nIndex++)
+    {
+        aulTimes[nIndex].LowPart = apsTimes[nIndex]->dwLowDateTime;
+        aulTimes[nIndex].HighPart = apsTimes[nIndex]->dwHighDateTime;
+    }
+    double dCpuSec = (double)((aulTimes[2].QuadPart - aulTimes[0].QuadPart) + (aulTimes[3].QuadPart - aulTimes[1].QuadPart)) / 1.0e7;
+
+    SLIN_SCHEDULE_STATS sStats;
+    ouEngine.vGetStats(sStats);
+    std::sort(ounErrors.begin(), ounErrors.end());
+    printf("  %s timer, spin %4u us: mean %5u us, p99 %5u us, max %5u us, late %u, skipped %u, cpu %5.1f %%\n",
+           ouTimer.bIsHighResolution() ? "high resolution" : "1 ms period", unSpinUs,
+           sStats.m_unMeanErrorUs, ounErrors[(ounErrors.size() * 99) / 100], ounErrors.back(),
+           (UINT)sStats.m_un64LateSlots, (UINT)sStats.m_un64SkippedSlots, (100.0 * dCpuSec) / dSec);
+    return (sStats.m_un64Slots == unSlots) ? 0 : 1;
+}
+
+/**
+ * Executes a schedule table of unconditional slots between 1 and 20 ms
+ * headless, with the slot timer of the LIN transmit thread, and reports the
+ * start error of every slot against its due time. Runs without spinning,
+ * with the default spin of the timer and with the 500 us spin the transmit
+ * thread used before. Fails if the engine did not execute every slot.
+ */
+static int nBenchLinSlot(UINT unIterations)
+{
+    UINT unSlots = max(unIterations / defBENCH_LINSLOT_PER_ITER, (UINT)1);
+    CLinSlotTimer ouTimer;
+    printf("linslot: %u slots per pass\n", unSlots);
+    int nResult = nRunLinSlots(unSlots, 0);
+    if (0 != ouTimer.unGetSpinUs())
+    {
+        nResult |= nRunLinSlots(unSlots, ouTimer.unGetSpinUs());
+    }
+    nResult |= nRunLinSlots(unSlots, 500);
+    return nResult;
+}
+
+/* Reorder -------------------------------------------------------------------*/
+
+#define defBENCH_REORDER_CHANNELS   4       //Channels of the merge
+#define defBENCH_REORDER_BURST      16      //Frames a channel delivers per read, as a USB device does
+#define defBENCH_REORDER_HOLD_MS    10      //Hold time of the silent channel pass
+#define defBENCH_REORDER_PER_FRAME  1000    //Iterations per paced frame, a frame takes a millisecond
+
+//Takes the frames the stage releases in place of CClientDispatch
+struct sBENCH_REORDER_SINK
+{
+    std::vector<LONGLONG> m_an64Added;      //Performance counter when frame n was added, n is the identifier
+    LONGLONG m_n64LastTime;
+    UINT m_unFrames;
+    UINT m_unOutOfOrder;
+    double m_dLatencySum;
+    double m_dLatencyMax;
+    LONGLONG m_n64Frequency;
+
+    sBENCH_REORDER_SINK(void) : m_n64LastTime(0), m_unFrames(0), m_unOutOfOrder(0),
+        m_dLatencySum(0), m_dLatencyMax(0)
+    {
+        LARGE_INTEGER sFrequency;
+        QueryPerformanceFrequency(&sFrequency);
+        m_n64Frequency = sFrequency.QuadPart;
+    }
+
+    void vAddFrame(const STCANDATA& sData, DWORD /*dwSenderID*/)
+    {
+        //Older than the newest frame so far
+        if (sData.m_lTickCount.QuadPart < m_n64LastTime)
+        {
+            m_unOutOfOrder++;
+        }
+        else
+        {
+            m_n64LastTime = sData.m_lTickCount.QuadPart;
+        }
+        m_unFrames++;
+        UINT unFrame = sData.m_uDataInfo.m_sCANMsg.m_unMsgID;
+        if (unFrame < m_an64Added.size())
+        {
+            LARGE_INTEGER sNow;
+            QueryPerformanceCounter(&sNow);
+            double dLatency = (double)(sNow.QuadPart - m_an64Added[unFrame]) / (double)m_n64Frequency;
+            m_dLatencySum += dLatency;
+            m_dLatencyMax = max(m_dLatencyMax, dLatency);
+        }
+    }
+
+    bool bIsFull(void) const
+    {
+        return false;
+    }
+
+    void vFlush(sBENCH_REORDER_SINK* /*psClients*/, UINT /*unClientCount*/)
+    {
+    }
+};
+
+static void vMakeReorderFrame(STCANDATA& sData, UINT unChannel, UINT unFrame, LONGLONG n64Time)
+{
+    memset(&sData, 0, sizeof(sData));
+    sData.m_ucDataType = RX_FLAG;
+    sData.m_uDataInfo.m_sCANMsg.m_unMsgID = unFrame;
+    sData.m_uDataInfo.m_sCANMsg.m_ucChannel = (UCHAR)(unChannel + 1);
+    sData.m_uDataInfo.m_sCANMsg.m_ucDataLen = 8;
+    sData.m_lTickCount.QuadPart = n64Time;
+}
+
+/**
+ * Merges four channels that each deliver their frames in bursts of 16, as
+ * the USB devices read them, and reports the frames per second through the
+ * reorder stage. Then paces a frame every millisecond on three channels
+ * while the fourth has sent once and stays silent, and reports the time
+ * from adding a frame to its release: the silent channel is dropped from
+ * the merge after the hold time, so only the frames of that first hold
+ * time wait for it. Fails if a frame comes out of timestamp order that the
+ * stage did not count as late, or the silent channel is not found idle.
+ * The first burst goes out before the other channels have sent and the
+ * frames that follow it are late, as on connect.
+ */
+static int nBenchReorder(UINT unIterations)
+{
+    CReorderStage<STCANDATA> ouStage;
+    int nResult = 0;
+    STCANDATA sData;
+
+    //Bursts of every channel, the timestamps of the channels interleave
+    ouStage.vInit(defBENCH_REORDER_CHANNELS);
+    ouStage.vSetHoldTime(1000);
+    sBENCH_REORDER_SINK sSink;
+    UINT aunNext[defBENCH_REORDER_CHANNELS] = { 0 };
+    LARGE_INTEGER sStart;
+    QueryPerformanceCounter(&sStart);
+    for (UINT unFrame = 0; unFrame < unIterations; unFrame++)
+    {
+        UINT unChannel = (unFrame / defBENCH_REORDER_BURST) % defBENCH_REORDER_CHANNELS;
+        LONGLONG n64Time = (LONGLONG)aunNext[unChannel]++ * defBENCH_REORDER_CHANNELS + unChannel;
+        vMakeReorderFrame(sData, unChannel, unFrame, n64Time);
+        ouStage.vAddFrame(unChannel, sData, 0);
+        if (0 == ((unFrame + 1) % defBENCH_REORDER_BURST))
+        {
+            ouStage.vRelease(sSink, &sSink, 0);
+        }
+    }
+    ouStage.vRelease(sSink, &sSink, 0, true);
+    double dSec = dGetElapsed(sStart);
+    SREORDER_STATS sStats;
+    ouStage.vGetStats(sStats);
+    printf("reorder: %d channels, bursts of %d frames\n", defBENCH_REORDER_CHANNELS, defBENCH_REORDER_BURST);
+    printf("  merge:  %8.0f frames/s, %I64u reordered, %I64u late, peak depth %u\n",
+           unIterations / dSec, sStats.m_un64Reordered, sStats.m_un64Late, sStats.m_unMaxDepth);
+    if ((sSink.m_unFrames != unIterations) || (sSink.m_unOutOfOrder != sStats.m_un64Late))
+    {
+        nResult = 1;
+    }
+
+    //Paced frames on all but the last channel, which has sent once
+    UINT unPaced = max(unIterations / defBENCH_REORDER_PER_FRAME, (UINT)50);
+    ouStage.vInit(defBENCH_REORDER_CHANNELS);
+    ouStage.vSetHoldTime(defBENCH_REORDER_HOLD_MS);
+    sBENCH_REORDER_SINK sPaced;
+    sPaced.m_an64Added.resize(unPaced + 1);
+    LARGE_INTEGER sNow;
+    QueryPerformanceCounter(&sNow);
+    sPaced.m_an64Added[unPaced] = sNow.QuadPart;
+    vMakeReorderFrame(sData, defBENCH_REORDER_CHANNELS - 1, unPaced, 0);
+    ouStage.vAddFrame(defBENCH_REORDER_CHANNELS - 1, sData, 0);
+    for (UINT unFrame = 0; unFrame < unPaced; unFrame++)
+    {
+        Sleep(1);
+        UINT unChannel = unFrame % (defBENCH_REORDER_CHANNELS - 1);
+        QueryPerformanceCounter(&sNow);
+        sPaced.m_an64Added[unFrame] = sNow.QuadPart;
+        vMakeReorderFrame(sData, unChannel, unFrame, unFrame + 1);
+        ouStage.vAddFrame(unChannel, sData, 0);
+        ouStage.vRelease(sPaced, &sPaced, 0);
+    }
+    ouStage.vRelease(sPaced, &sPaced, 0, true);
+    ouStage.vGetStats(sStats);
+    printf("  silent: %u frames, hold %d ms, release latency mean %.2f ms, max %.2f ms, %I64u expired, %I64u idle\n",
+           unPaced, defBENCH_REORDER_HOLD_MS, (1000.0 * sPaced.m_dLatencySum) / max(sPaced.m_unFrames, (UINT)1),
+           1000.0 * sPaced.m_dLatencyMax, sStats.m_un64HoldExpired, sStats.m_un64IdleChannels);
+    if ((sPaced.m_unOutOfOrder != sStats.m_un64Late) || (0 == sStats.m_un64IdleChannels))
+    {
+        nResult = 1;
+    }
+    return nResult;
+}
+
+/* Timebase ------------------------------------------------------------------*/
+
+#define defBENCH_TIMEBASE_SETTLE_US     10000000    //Frames read before are left out of the settled figures
+#define defBENCH_TIMEBASE_MAX_SPREAD_NS 1000000     //Largest settled spread of a frame, one USB frame
+
+/**
+ * Replays the frames of two looped channels from TimebaseDriftFixture.h
+ * through CDeviceTimebase, as a driver read thread does, and reports how
+ * far apart the host times of the two copies of each bus frame are, in ns
+ * and after the conversion into 0.1 ms ticks. The replay is repeated for
+ * unIterations frames to time the mapping. Fails if a host time goes back
+ * on a channel or lies after the read, or if a settled spread exceeds the
+ * 1 ms USB frame.
+ */
+static int nBenchTimebase(UINT unIterations)
+{
+    const UINT unRows = sizeof(sg_asTimebaseFixture) / sizeof(sg_asTimebaseFixture[0]);
+    UINT unFrames = 0;
+    for (UINT unRow = 0; unRow < unRows; unRow++)
+    {
+        unFrames = max(unFrames, sg_asTimebaseFixture[unRow].m_unFrame + 1);
+    }
+    std::vector<UINT64> aun64Host(unFrames * defTIMEBASE_FIXTURE_SOURCES, 0);
+    std::vector<UINT> aunReadUs(unFrames, 0);
+
+    LARGE_INTEGER sFrequency, sBase;
+    QueryPerformanceFrequency(&sFrequency);
+    QueryPerformanceCounter(&sBase);
+    CDeviceTimebase ouTimebase;
+    double adDriftPpm[defTIMEBASE_FIXTURE_SOURCES] = { 0 };
+    UINT unBackwards = 0, unAfterRead = 0, unReplayed = 0;
+    LARGE_INTEGER sStart;
+    QueryPerformanceCounter(&sStart);
+    do
+    {
+        ouTimebase.vInit(defTIMEBASE_FIXTURE_SOURCES, defTIMEBASE_FIXTURE_TICKS_PER_SEC, defTIMEBASE_FIXTURE_COUNTER_BITS);
+        UINT64 aun64Last[defTIMEBASE_FIXTURE_SOURCES] = { 0 };
+        for (UINT unRow = 0; unRow < unRows; unRow++)
+        {
+            const sTIMEBASE_FIXTURE_FRAME& sFrame = sg_asTimebaseFixture[unRow];
+            LONGLONG n64ReadQpc = sBase.QuadPart + (LONGLONG)(((UINT64)sFrame.m_unReadUs * sFrequency.QuadPart) / 1000000);
+            UINT64 un64Host = ouTimebase.un64GetHostTime(sFrame.m_unSource, sFrame.m_unDevTicks, n64ReadQpc);
+            if (0 == unReplayed)
+            {
+                unBackwards += (un64Host < aun64Last[sFrame.m_unSource]) ? 1 : 0;
+                unAfterRead += (un64Host > ouTimebase.un64QpcToNs(n64ReadQpc)) ? 1 : 0;
+                aun64Last[sFrame.m_unSource] = un64Host;
+                aun64Host[sFrame.m_unFrame * defTIMEBASE_FIXTURE_SOURCES + sFrame.m_unSource] = un64Host;
+                aunReadUs[sFrame.m_unFrame] = max(aunReadUs[sFrame.m_unFrame], sFrame.m_unReadUs);
+            }
+        }
+        if (0 == unReplayed)
+        {
+            for (UINT unSource = 0; unSource < defTIMEBASE_FIXTURE_SOURCES; unSource++)
+            {
+                double dOffsetNs = 0;
+                ouTimebase.bGetEstimate(unSource, dOffsetNs, adDriftPpm[unSource]);
+            }
+        }
+        unReplayed += unRows;
+    }
+    while (unReplayed < unIterations);
+    double dSec = dGetElapsed(sStart);
+
+    //Spread of the two copies of a frame, in ns and in the ticks clients get
+    UINT unSettled = 0;
+    double dSpreadSum = 0;
+    UINT64 un64MaxSpread = 0, un64MaxSettled = 0, un64MaxTickSpread = 0;
+    for (UINT unFrame = 0; unFrame < unFrames; unFrame++)
+    {
+        UINT64 un64First = aun64Host[unFrame * defTIMEBASE_FIXTURE_SOURCES];
+        UINT64 un64Second = aun64Host[unFrame * defTIMEBASE_FIXTURE_SOURCES + 1];
+        if ((0 == un64First) || (0 == un64Second))
+        {
+            continue;
+        }
+        UINT64 un64Spread = (un64First > un64Second) ? (un64First - un64Second) : (un64Second - un64First);
+        LONGLONG n64Ticks = CDeviceTimebase::n64ToTickCount(un64First) - CDeviceTimebase::n64ToTickCount(un64Second);
+        UINT64 un64TickSpread = (UINT64)((n64Ticks < 0) ? -n64Ticks : n64Ticks) * defTIMEBASE_NS_PER_TICK;
+        un64MaxSpread = max(un64MaxSpread, un64Spread);
+        if (aunReadUs[unFrame] >= defBENCH_TIMEBASE_SETTLE_US)
+        {
+            unSettled++;
+            dSpreadSum += (double)un64Spread;
+            un64MaxSettled = max(un64MaxSettled, un64Spread);
+            un64MaxTickSpread = max(un64MaxTickSpread, un64TickSpread);
+        }
+    }
+
+    printf("timebase: %u fixture frames on %d channels, %u settled after %d s\n",
+           unFrames, defTIMEBASE_FIXTURE_SOURCES, unSettled, defBENCH_TIMEBASE_SETTLE_US / 1000000);
+    printf("  drift estimate: %+.1f ppm, %+.1f ppm\n", adDriftPpm[0], adDriftPpm[1]);
+    printf("  spread settled: mean %.1f us, max %.1f us, max in 0.1 ms ticks %.1f us, max overall %.1f us\n",
+           (unSettled > 0) ? (dSpreadSum / unSettled / 1000.0) : 0.0, un64MaxSettled / 1000.0,
+           un64MaxTickSpread / 1000.0, un64MaxSpread / 1000.0);
+    printf("  %u went back, %u after the read, %.0f ns per frame\n", unBackwards, unAfterRead, (dSec * 1.0e9) / unReplayed);
+    return ((0 == unBackwards) && (0 == unAfterRead) && (un64MaxSettled <= defBENCH_TIMEBASE_MAX_SPREAD_NS)) ? 0 : 1;
+}
+
+/* Handlers ------------------------------------------------------------------*/
+
+#define defBENCH_HANDLER_MAX_NODES  8
+#define defBENCH_HANDLER_IDS        8       //Message IDs of a node
+#define defBENCH_HANDLER_WORK       2000    //Loop rounds of a handler, a few us
+#define defBENCH_HANDLER_HANG_MS    200     //Run time of the handler still running at the stop
+#define defBENCH_HANDLER_STOP_MS    20
+
+struct sBENCH_HANDLER_MSG
+{
+    UINT m_unID;
+    UINT m_unSeq;       //Per ID
+};
+
+inline UINT unGetHandlerKey(const sBENCH_HANDLER_MSG& sMsg)
+{
+    return sMsg.m_unID;
+}
+
+//Node whose handler checks the order of its IDs and burns some CPU
+class CBenchHandlerNode
+{
+public:
+    CBenchHandlerNode() : m_lOutOfOrder(0), m_dwHangMs(0), m_bReturned(false)
+    {
+        memset(m_aunNextSeq, 0, sizeof(m_aunNextSeq));
+        memset(m_aunSum, 0, sizeof(m_aunSum));
+    }
+
+    //Only the lane of the ID touches its counters
+    void vExecute(sBENCH_HANDLER_MSG sMsg)
+    {
+        if (sMsg.m_unSeq != m_aunNextSeq[sMsg.m_unID])
+        {
+            InterlockedIncrement(&m_lOutOfOrder);
+        }
+        m_aunNextSeq[sMsg.m_unID] = sMsg.m_unSeq + 1;
+        UINT unSum = m_aunSum[sMsg.m_unID];
+        for (UINT unRound = 0; unRound < defBENCH_HANDLER_WORK; unRound++)
+        {
+            unSum = unSum * 1103515245 + 12345 + sMsg.m_unSeq;
+        }
+        m_aunSum[sMsg.m_unID] = unSum;
+        if (0 != m_dwHangMs)
+        {
+            Sleep(m_dwHangMs);
+            m_bReturned = true;
+        }
+    }
+
+    volatile LONG m_lOutOfOrder;
+    DWORD m_dwHangMs;
+    volatile bool m_bReturned;
+
+private:
+    UINT m_aunNextSeq[defBENCH_HANDLER_IDS];
+    UINT m_aunSum[defBENCH_HANDLER_IDS];
+};
+
+typedef CNodeMsgQueue<sBENCH_HANDLER_MSG, CBenchHandlerNode> CBenchHandlerQueue;
+
+//Spreads unMsgs messages over the nodes and waits until all ran. Seconds taken.
+static double dRunHandlerNodes(std::vector<CBenchHandlerQueue*>& aouQueues, UINT unMsgs, UINT& unLost)
+{
+    UINT unNodes = (UINT)aouQueues.size();
+    LARGE_INTEGER sStart;
+    QueryPerformanceCounter(&sStart);
+    for (UINT unMsg = 0; unMsg < unMsgs; unMsg++)
+    {
+        UINT unSlot = unMsg / unNodes;
+        sBENCH_HANDLER_MSG sMsg;
+        sMsg.m_unID = unSlot % defBENCH_HANDLER_IDS;
+        sMsg.m_unSeq = unSlot / defBENCH_HANDLER_IDS;
+        if (!aouQueues[unMsg % unNodes]->bAddMsg(sMsg))
+        {
+            unLost++;
+        }
+    }
+    UINT64 un64Executed = 0;
+    while (un64Executed + unLost < unMsgs)
+    {
+        Sleep(1);
+        un64Executed = 0;
+        for (UINT unNode = 0; unNode < unNodes; unNode++)
+        {
+            SMSG_HANDLER_STATS sStats;
+            aouQueues[unNode]->vGetStats(sStats, nullptr);
+            un64Executed += sStats.m_un64Executed;
+        }
+    }
+    return dGetElapsed(sStart);
+}
+
+/**
+ * Runs unIterations messages through the handler pool, spread over 1 to 8
+ * nodes with one lane each and then on one node with a lane per message
+ * ID, and reports the throughput against a single lane. Then stops a node
+ * whose handler runs past the stop wait. Fails if a message is lost or
+ * out of order within its ID, or if the retired worker is not joined once
+ * its handler returns.
+ */
+static int nBenchHandlers(UINT unIterations)
+{
+    UINT unMsgs = max(unIterations - (unIterations % (defBENCH_HANDLER_MAX_NODES * defBENCH_HANDLER_IDS)),
+                      (UINT)(defBENCH_HANDLER_MAX_NODES * defBENCH_HANDLER_IDS));
+    printf("handlers: %u messages per run on %u pool workers\n", unMsgs, CHandlerPool::ouGetPool().unGetWorkerCount());
+
+    int nResult = 0;
+    double dSingleRate = 0;
+    for (UINT unRun = 0; unRun <= 4; unRun++)
+    {
+        //Runs 0 to 3: 1, 2, 4 and 8 nodes, run 4: one node with per ID lanes
+        bool bPerId = (4 == unRun);
+        UINT unNodes = bPerId ? 1 : (1 << unRun);
+        std::vector<CBenchHandlerNode> aouNodes(unNodes);
+        std::vector<CBenchHandlerQueue*> aouQueues;
+        for (UINT unNode = 0; unNode < unNodes; unNode++)
+        {
+            aouQueues.push_back(new CBenchHandlerQueue(&aouNodes[unNode], &CBenchHandlerNode::vExecute, unMsgs));
+            aouQueues[unNode]->vSetPerIdLanes(bPerId);
+        }
+        UINT unLost = 0;
+        double dSec = dRunHandlerNodes(aouQueues, unMsgs, unLost);
+        LONG lOutOfOrder = 0;
+        for (UINT unNode = 0; unNode < unNodes; unNode++)
+        {
+            delete aouQueues[unNode];
+            lOutOfOrder += aouNodes[unNode].m_lOutOfOrder;
+        }
+        double dRate = unMsgs / dSec;
+        if (0 == unRun)
+        {
+            dSingleRate = dRate;
+        }
+        printf("  %u node%s%s: %.0f msg/s, x%.2f, %u lost, %ld out of order\n", unNodes, (1 == unNodes) ? "" : "s",
+               bPerId ? " per ID" : "", dRate, dRate / dSingleRate, unLost, lOutOfOrder);
+        if ((0 != unLost) || (0 != lOutOfOrder))
+        {
+            nResult = 1;
+        }
+    }
+
+    //A handler still running at the stop, its worker is retired and joined
+    CBenchHandlerNode ouHanging;
+    ouHanging.m_dwHangMs = defBENCH_HANDLER_HANG_MS;
+    CBenchHandlerQueue* pouQueue = new CBenchHandlerQueue(&ouHanging, &CBenchHandlerNode::vExecute, 16);
+    sBENCH_HANDLER_MSG sMsg = { 0, 0 };
+    pouQueue->bAddMsg(sMsg);
+    Sleep(defBENCH_HANDLER_STOP_MS);
+    LARGE_INTEGER sStart;
+    QueryPerformanceCounter(&sStart);
+    bool bIdle = pouQueue->bStop(defBENCH_HANDLER_STOP_MS);
+    double dStopSec = dGetElapsed(sStart);
+    bool bReturned = ouHanging.m_bReturned;
+    delete pouQueue;
+    printf("  stop: handler of %d ms %s, stop took %.1f ms\n", defBENCH_HANDLER_HANG_MS,
+           bIdle ? "done in the stop wait" : (bReturned ? "joined after the retirement" : "terminated"), dStopSec * 1000.0);
+    if (bIdle || !bReturned)
+    {
+        nResult = 1;
+    }
+
+    //The pool still has all its workers
+    std::vector<CBenchHandlerNode> aouNodes(defBENCH_HANDLER_MAX_NODES);
+    std::vector<CBenchHandlerQueue*> aouQueues;
+    for (UINT unNode = 0; unNode < defBENCH_HANDLER_MAX_NODES; unNode++)
+    {
+        aouQueues.push_back(new CBenchHandlerQueue(&aouNodes[unNode], &CBenchHandlerNode::vExecute, unMsgs));
+    }
+    UINT unLost = 0;
+    double dSec = dRunHandlerNodes(aouQueues, unMsgs, unLost);
+    for (UINT unNode = 0; unNode < defBENCH_HANDLER_MAX_NODES; unNode++)
+    {
+        delete aouQueues[unNode];
+    }
+    printf("  after the stop: %d nodes, %.0f msg/s, x%.2f\n", defBENCH_HANDLER_MAX_NODES, unMsgs / dSec, (unMsgs / dSec) / dSingleRate);
+    return (0 == unLost) ? nResult : 1;
+}
+
+/* Table ---------------------------------------------------------------------*/
+
+static const sRUNNER_BENCH sg_asBenchmarks[] =
+{
+    { "j1939", "J1939 fan out to the DIL clients, rendered streams against pool references", nBenchJ1939 },
+    { "txecho", "Mock CAN driver, TX echo list and per frame writes against echo map and batches", nBenchTxEcho },
+    { "dilbatch", "CAN frames through a stub broker thread, per frame calls against batched send and read", nBenchDilBatch },
+    { "linslot", "LIN schedule table on the slot timer, start error of every slot", nBenchLinSlot },
+    { "reorder", "Receive streams of several channels merged by timestamp, with one channel silent", nBenchReorder },
+    { "timebase", "Device timestamps of two looped channels replayed from a drift fixture", nBenchTimebase },
+    { "handlers", "Node message handlers on the handler pool, 1 to 8 nodes and per ID lanes, and a stop", nBenchHandlers },
+};
+
+int nRunBenchmark(const char* pchName, UINT unIterations)
+{
+    for (size_t nIndex = 0; nIndex < sizeof(sg_asBenchmarks) / sizeof(sg_asBenchmarks[0]); nIndex++)
+    {
+        if (stricmp(pchName, sg_asBenchmarks[nIndex].m_pchName) == 0)
+        {
+            return sg_asBenchmarks[nIndex].m_pfBench((0 == unIterations) ? defBENCH_ITERATIONS : unIterations);
+        }
+    }
+    printf("Unknown benchmark %s\n", pchName);
+    vPrintBenchmarks();
+    return 2;
+}
+
+void vPrintBenchmarks(void)
+{
+    printf("\nBenchmarks (/bench:<name>):\n");
+    for (size_t nIndex = 0; nIndex < sizeof(sg_asBenchmarks) / sizeof(sg_asBenchmarks[0]); nIndex++)
+    {
+        printf("  %-12s %s\n", sg_asBenchmarks[nIndex].m_pchName, sg_asBenchmarks[nIndex].m_pchDescription);
+    }
+}
@@ -0,0 +1,35 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      RunnerBench.h
+ * \brief     Benchmarks of the core runner
+ *
+ * Benchmarks of the message paths that need no hardware and no
+ * configuration, run with CoreRunner /bench:<name> [/iterations:<n>].
+ * Each benchmark prints its figures to the console and returns the process
+ * exit code, non zero when a check of the benchmark failed.
+ */
+
+#pragma once
+
+//Iterations of a benchmark if /iterations is not given
+#define defBENCH_ITERATIONS     200000
+
+//Runs the benchmark pchName, 2 if there is none of that name
+int nRunBenchmark(const char* pchName, UINT unIterations);
+
+//Lists the benchmarks for the usage text
+void vPrintBenchmarks(void);
@@ -0,0 +1,177 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      RunnerMain.cpp
+ * \brief     Entry point of the core runner
+ *
+ * Runs a BUSMASTER configuration from the command line, without any window:
+ *
+ *   CoreRunner <cfx> [/driver:<name>] [/duration:<s>] [/interval:<s>]
+ *              [/virtualtime[:<settle ms>]] [/nolog] [/nonodes]
+ *              [/testsuite[:<test setup file>]]
+ *   CoreRunner /bench:<name> [/iterations:<n>]
+ */
+
+#include "CoreRunner_stdafx.h"
+#include "CoreRunner.h"
+#include "RunnerBench.h"
+
+//Big because of the client buffer, and reached from the console handler
+static CCoreRunner sg_ouRunner;
+
+static BOOL WINAPI bConsoleCtrlHandler(DWORD /*dwCtrlType*/)
+{
+    sg_ouRunner.vStop();
+    return TRUE;
+}
+
+//Value of the option pchOption in pchArg, nullptr if pchArg is another option
+static const char* pchGetOption(const char* pchArg, const char* pchOption)
+{
+    size_t nLength = strlen(pchOption);
+    if (strnicmp(pchArg, pchOption, nLength) != 0)
+    {
+        return nullptr;
+    }
+    return pchArg + nLength;
+}
+
+static void vPrintUsage(void)
+{
+    printf("Usage: CoreRunner <cfx> [/driver:<name>] [/duration:<s>] [/interval:<s>]\n"
+           "                  [/virtualtime[:<settle ms>]] [/nolog] [/nonodes]\n"
+           "                  [/testsuite[:<test setup file>]]\n"
+           "       CoreRunner /bench:<name> [/iterations:<n>]\n\n"
+           "  /driver       Driver as named in the driver menu, overrides the configuration\n"
+           "  /duration     Seconds to run, until Ctrl+C if not given\n"
+           "  /interval     Seconds between two reports, one report at the end if not given\n"
+           "  /virtualtime  Runs the simulated bus in virtual time\n"
+           "  /nolog        Does not log, even if the configuration has logging blocks\n"
+           "  /nonodes      Does not build and load the simulated nodes\n"
+           "  /testsuite    Runs the test setup file, or the test suite of the configuration,\n"
+           "                and ends with exit code 0 if all test cases passed, 3 if one failed\n"
+           "  /bench        Runs a benchmark, no configuration is loaded\n"
+           "  /iterations   Iterations of the benchmark\n");
+    vPrintBenchmarks();
+}
+
+static bool bParseArgs(int argc, char* argv[], sRUNNER_SETTINGS& sSettings)
+{
+    sSettings.m_unDurationSec = 0;
+    sSettings.m_unIntervalSec = 0;
+    sSettings.m_bVirtualTime = false;
+    sSettings.m_unVirtualTimeSettleMs = defCLOCK_VIRTUAL_SETTLE_MS;
+    sSettings.m_bLogging = true;
+    sSettings.m_bNodes = true;
+    sSettings.m_bTestSuite = false;
+    sSettings.m_unIterations = 0;
+
+    for (int nArg = 1; nArg < argc; nArg++)
+    {
+        const char* pchValue = nullptr;
+        if (argv[nArg][0] != '/')
+        {
+            if (false == sSettings.m_strCfxFile.empty())
+            {
+                return false;
+            }
+            sSettings.m_strCfxFile = argv[nArg];
+        }
+        else if ((pchValue = pchGetOption(argv[nArg], "/driver:")) != nullptr)
+        {
+            sSettings.m_strDriver = pchValue;
+        }
+        else if ((pchValue = pchGetOption(argv[nArg], "/duration:")) != nullptr)
+        {
+            sSettings.m_unDurationSec = (UINT) atoi(pchValue);
+        }
+        else if ((pchValue = pchGetOption(argv[nArg], "/interval:")) != nullptr)
+        {
+            sSettings.m_unIntervalSec = (UINT) atoi(pchValue);
+        }
+        else if ((pchValue = pchGetOption(argv[nArg], "/virtualtime")) != nullptr)
+        {
+            sSettings.m_bVirtualTime = true;
+            if (*pchValue == ':')
+            {
+                sSettings.m_unVirtualTimeSettleMs = (UINT) atoi(pchValue + 1);
+            }
+            else if (*pchValue != '\0')
+            {
+                return false;
+            }
+        }
+        else if (stricmp(argv[nArg], "/nolog") == 0)
+        {
+            sSettings.m_bLogging = false;
+        }
+        else if (stricmp(argv[nArg], "/nonodes") == 0)
+        {
+            sSettings.m_bNodes = false;
+        }
+        else if ((pchValue = pchGetOption(argv[nArg], "/testsuite")) != nullptr)
+        {
+            sSettings.m_bTestSuite = true;
+            if (*pchValue == ':')
+            {
+                sSettings.m_strTestSetup = pchValue + 1;
+            }
+            else if (*pchValue != '\0')
+            {
+                return false;
+            }
+        }
+        else if ((pchValue = pchGetOption(argv[nArg], "/bench:")) != nullptr)
+        {
+            sSettings.m_strBench = pchValue;
+        }
+        else if ((pchValue = pchGetOption(argv[nArg], "/iterations:")) != nullptr)
+        {
+            sSettings.m_unIterations = (UINT) atoi(pchValue);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    //Either a configuration or a benchmark
+    return (sSettings.m_strCfxFile.empty() != sSettings.m_strBench.empty());
+}
+
+int main(int argc, char* argv[])
+{
+    if (FALSE == AfxWinInit(::GetModuleHandle(nullptr), nullptr, ::GetCommandLine(), 0))
+    {
+        printf("MFC could not be initialised\n");
+        return 1;
+    }
+
+    sRUNNER_SETTINGS sSettings;
+    if (false == bParseArgs(argc, argv, sSettings))
+    {
+        vPrintUsage();
+        return 2;
+    }
+    if (false == sSettings.m_strBench.empty())
+    {
+        return nRunBenchmark(sSettings.m_strBench.c_str(), sSettings.m_unIterations);
+    }
+
+    SetConsoleCtrlHandler(bConsoleCtrlHandler, TRUE);
+    int nResult = sg_ouRunner.nRun(sSettings);
+    SetConsoleCtrlHandler(bConsoleCtrlHandler, FALSE);
+    return nResult;
+}
@@ -0,0 +1,2442 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      TimebaseDriftFixture.h
+ * \brief     Frames of two looped channels for the timebase bench
+ *
+ * Every bus frame is read once on each of two channels of different
+ * devices wired to the same bus, so both copies were on the bus at the same
+ * moment. A row holds the raw device timer of the channel and the host time
+ * at which the read thread got the frame, in the order the frames were read.
+ * The two device timers count microseconds in 32 bit and drift against the
+ * host clock, the first one wraps about 60 s into the run.
+ *
+ * The rows were generated from a model of two USB devices: drift +42 ppm
+ * and -17 ppm, a frame every 100 ms for 120 s, reads on the 1 ms USB frame
+ * plus 0.15 ms and an exponential 0.3 ms, and 3 % of the reads delayed by
+ * 2 to 10 ms more. A recording of real devices in the same form can replace
+ * them.
+ */
+
+#pragma once
+
+#define defTIMEBASE_FIXTURE_SOURCES         2
+#define defTIMEBASE_FIXTURE_TICKS_PER_SEC   1000000
+#define defTIMEBASE_FIXTURE_COUNTER_BITS    32
+
+struct sTIMEBASE_FIXTURE_FRAME
+{
+    UINT m_unFrame;         //Bus frame, read once per channel
+    UINT m_unSource;        //Channel that read it, 0 based
+    UINT m_unDevTicks;      //Raw device timer of the channel
+    UINT m_unReadUs;        //Host time of the read in us from the start of the run
+};
+
+static const sTIMEBASE_FIXTURE_FRAME sg_asTimebaseFixture[] =
+{
+    { 0, 1, 1235049423u, 482006u },
+    { 0, 0, 4235448858u, 482817u },
+    { 1, 0, 4235579039u, 612641u },
+    { 1, 1, 1235179597u, 612826u },
+    { 2, 0, 4235662220u, 696034u },
+    { 2, 1, 1235262773u, 696242u },
+    { 3, 1, 1235354924u, 787961u },
+    { 3, 0, 4235754376u, 788031u },
+    { 4, 1, 1235468371u, 901093u },
+    { 4, 0, 4235867831u, 901666u },
+    { 5, 0, 4235970344u, 1003602u },
+    { 5, 1, 1235570879u, 1003839u },
+    { 6, 1, 1235681434u, 1114042u },
+    { 6, 0, 4236080906u, 1114565u },
+    { 7, 0, 4236181574u, 1214723u },
+    { 7, 1, 1235782096u, 1215161u },
+    { 8, 0, 4236272260u, 1305924u },
+    { 8, 1, 1235872777u, 1305941u },
+    { 9, 0, 4236375401u, 1408515u },
+    { 9, 1, 1235975912u, 1409275u },
+    { 10, 1, 1236071520u, 1504098u },
+    { 10, 0, 4236471015u, 1504598u },
+    { 11, 0, 4236569442u, 1602496u },
+    { 11, 1, 1236169941u, 1603273u },
+    { 12, 1, 1236276468u, 1709096u },
+    { 12, 0, 4236675974u, 1709473u },
+    { 13, 0, 4236752457u, 1785487u },
+    { 13, 1, 1236352945u, 1785870u },
+    { 14, 0, 4236851732u, 1885690u },
+    { 14, 1, 1236452215u, 1894060u },
+    { 15, 0, 4236986445u, 2019500u },
+    { 15, 1, 1236586919u, 2021178u },
+    { 16, 1, 1236683255u, 2116027u },
+    { 16, 0, 4237082786u, 2116584u },
+    { 17, 1, 1236775973u, 2208966u },
+    { 17, 0, 4237175509u, 2209017u },
+    { 18, 0, 4237251110u, 2284529u },
+    { 18, 1, 1236851569u, 2284976u },
+    { 19, 0, 4237370422u, 2403550u },
+    { 19, 1, 1236970874u, 2404551u },
+    { 20, 0, 4237461280u, 2494522u },
+    { 20, 1, 1237061727u, 2495347u },
+    { 21, 1, 1237186445u, 2618895u },
+    { 21, 0, 4237586005u, 2619792u },
+    { 22, 1, 1237256505u, 2688896u },
+    { 22, 0, 4237656069u, 2689605u },
+    { 23, 1, 1237350291u, 2783105u },
+    { 23, 0, 4237749861u, 2783468u },
+    { 24, 1, 1237484427u, 2917079u },
+    { 24, 0, 4237884005u, 2918052u },
+    { 25, 1, 1237553036u, 2985822u },
+    { 25, 0, 4237952619u, 2985893u },
+    { 26, 0, 4238052406u, 3085752u },
+    { 26, 1, 1237652818u, 3090995u },
+    { 27, 0, 4238160565u, 3193551u },
+    { 27, 1, 1237760970u, 3194077u },
+    { 28, 0, 4238255421u, 3288473u },
+    { 28, 1, 1237855821u, 3289181u },
+    { 29, 0, 4238373339u, 3406483u },
+    { 29, 1, 1237973732u, 3406866u },
+    { 30, 0, 4238476627u, 3509653u },
+    { 30, 1, 1238077014u, 3509921u },
+    { 31, 0, 4238559407u, 3592657u },
+    { 31, 1, 1238159790u, 3593550u },
+    { 32, 0, 4238669391u, 3703020u },
+    { 32, 1, 1238269767u, 3703206u },
+    { 33, 0, 4238770459u, 3803532u },
+    { 33, 1, 1238370829u, 3804126u },
+    { 34, 0, 4238871714u, 3904468u },
+    { 34, 1, 1238472078u, 3905461u },
+    { 35, 0, 4238983640u, 4017132u },
+    { 35, 1, 1238583997u, 4018083u },
+    { 36, 0, 4239076669u, 4109678u },
+    { 36, 1, 1238677021u, 4110020u },
+    { 37, 0, 4239159361u, 4192585u },
+    { 37, 1, 1238759707u, 4192913u },
+    { 38, 0, 4239279651u, 4312593u },
+    { 38, 1, 1238879990u, 4313279u },
+    { 39, 0, 4239365380u, 4398571u },
+    { 39, 1, 1238965714u, 4398901u },
+    { 40, 1, 1239062791u, 4496090u },
+    { 40, 0, 4239462462u, 4497040u },
+    { 41, 0, 4239549433u, 4582520u },
+    { 41, 1, 1239149757u, 4583286u },
+    { 42, 1, 1239254953u, 4688198u },
+    { 42, 0, 4239654635u, 4688296u },
+    { 43, 1, 1239358246u, 4790882u },
+    { 43, 0, 4239757934u, 4791668u },
+    { 44, 1, 1239483073u, 4915863u },
+    { 44, 0, 4239882769u, 4916013u },
+    { 45, 1, 1239560138u, 4992870u },
+    { 45, 0, 4239959839u, 4993885u },
+    { 46, 0, 4240063235u, 5096602u },
+    { 46, 1, 1239663528u, 5097004u },
+    { 47, 0, 4240173446u, 5206494u },
+    { 47, 1, 1239773732u, 5207020u },
+    { 48, 1, 1239859289u, 5292180u },
+    { 48, 0, 4240259008u, 5292790u },
+    { 49, 0, 4240369277u, 5402656u },
+    { 49, 1, 1239969552u, 5402953u },
+    { 50, 0, 4240460768u, 5493473u },
+    { 50, 1, 1240061038u, 5494361u },
+    { 51, 0, 4240572677u, 5605529u },
+    { 51, 1, 1240172940u, 5605981u },
+    { 52, 0, 4240672923u, 5706486u },
+    { 52, 1, 1240273181u, 5706611u },
+    { 53, 1, 1240357575u, 5790855u },
+    { 53, 0, 4240757322u, 5790907u },
+    { 54, 0, 4240850432u, 5884081u },
+    { 54, 1, 1240450678u, 5884315u },
+    { 55, 0, 4240956527u, 5989558u },
+    { 55, 1, 1240556768u, 5990290u },
+    { 56, 0, 4241060398u, 6093942u },
+    { 56, 1, 1240660632u, 6094117u },
+    { 57, 1, 1240774330u, 6206888u },
+    { 57, 0, 4241174103u, 6207645u },
+    { 58, 1, 1240881094u, 6313870u },
+    { 58, 0, 4241280873u, 6323175u },
+    { 59, 0, 4241370708u, 6403898u },
+    { 59, 1, 1240970924u, 6403996u },
+    { 60, 0, 4241452485u, 6485758u },
+    { 60, 1, 1241052696u, 6486173u },
+    { 61, 0, 4241568549u, 6601539u },
+    { 61, 1, 1241168754u, 6601823u },
+    { 62, 1, 1241251870u, 6684842u },
+    { 62, 0, 4241651670u, 6690671u },
+    { 63, 0, 4241764880u, 6797802u },
+    { 63, 1, 1241365073u, 6798141u },
+    { 64, 1, 1241484748u, 6917953u },
+    { 64, 0, 4241884562u, 6917959u },
+    { 65, 0, 4241960421u, 6993560u },
+    { 65, 1, 1241560603u, 6993827u },
+    { 66, 1, 1241651309u, 7083987u },
+    { 66, 0, 4242051133u, 7084744u },
+    { 67, 0, 4242185407u, 7218566u },
+    { 67, 1, 1241785575u, 7218930u },
+    { 68, 0, 4242273368u, 7306568u },
+    { 68, 1, 1241873531u, 7306932u },
+    { 69, 0, 4242379346u, 7412533u },
+    { 69, 1, 1241979503u, 7412940u },
+    { 70, 0, 4242458908u, 7491495u },
+    { 70, 1, 1242059060u, 7492791u },
+    { 71, 0, 4242565399u, 7598630u },
+    { 71, 1, 1242165545u, 7599154u },
+    { 72, 1, 1242258098u, 7690933u },
+    { 72, 0, 4242657958u, 7691755u },
+    { 73, 0, 4242779495u, 7812749u },
+    { 73, 1, 1242379628u, 7812993u },
+    { 74, 0, 4242866898u, 7899549u },
+    { 74, 1, 1242467025u, 7900298u },
+    { 75, 1, 1242563859u, 7996876u },
+    { 75, 0, 4242963737u, 8005369u },
+    { 76, 0, 4243061628u, 8094753u },
+    { 76, 1, 1242661744u, 8095039u },
+    { 77, 0, 4243184444u, 8217720u },
+    { 77, 1, 1242784553u, 8218121u },
+    { 78, 1, 1242859879u, 8293441u },
+    { 78, 0, 4243259774u, 8302737u },
+    { 79, 1, 1242976197u, 8409001u },
+    { 79, 0, 4243376099u, 8409502u },
+    { 80, 1, 1243057977u, 8490913u },
+    { 80, 0, 4243457884u, 8499171u },
+    { 81, 1, 1243165391u, 8597875u },
+    { 81, 0, 4243565304u, 8598669u },
+    { 82, 0, 4243669431u, 8702821u },
+    { 82, 1, 1243269512u, 8703338u },
+    { 83, 1, 1243387376u, 8819954u },
+    { 83, 0, 4243787303u, 8820599u },
+    { 84, 0, 4243884755u, 8917728u },
+    { 84, 1, 1243484823u, 8917870u },
+    { 85, 1, 1243559141u, 8992115u },
+    { 85, 0, 4243959078u, 8992555u },
+    { 86, 1, 1243675668u, 9109302u },
+    { 86, 0, 4244075611u, 9109800u },
+    { 87, 0, 4244186525u, 9219588u },
+    { 87, 1, 1243786575u, 9228736u },
+    { 88, 0, 4244283587u, 9317140u },
+    { 88, 1, 1243883631u, 9317208u },
+    { 89, 0, 4244365474u, 9398765u },
+    { 89, 1, 1243965514u, 9399581u },
+    { 90, 0, 4244457365u, 9490628u },
+    { 90, 1, 1244057399u, 9490962u },
+    { 91, 0, 4244572877u, 9605575u },
+    { 91, 1, 1244172904u, 9605846u },
+    { 92, 1, 1244252275u, 9684962u },
+    { 92, 0, 4244652252u, 9685657u },
+    { 93, 1, 1244387315u, 9819832u },
+    { 93, 0, 4244787300u, 9827206u },
+    { 94, 1, 1244484256u, 9917361u },
+    { 94, 0, 4244884247u, 9917478u },
+    { 95, 0, 4244952985u, 9985478u },
+    { 95, 1, 1244552990u, 9986252u },
+    { 96, 1, 1244661654u, 10095303u },
+    { 96, 0, 4245061656u, 10095695u },
+    { 97, 0, 4245165844u, 10198920u },
+    { 97, 1, 1244765837u, 10199518u },
+    { 98, 0, 4245272668u, 10306009u },
+    { 98, 1, 1244872654u, 10306423u },
+    { 99, 1, 1244962710u, 10395932u },
+    { 99, 0, 4245362729u, 10396330u },
+    { 100, 0, 4245461823u, 10494622u },
+    { 100, 1, 1245061798u, 10494848u },
+    { 101, 1, 1245172155u, 10604924u },
+    { 101, 0, 4245572187u, 10605474u },
+    { 102, 0, 4245679805u, 10712944u },
+    { 102, 1, 1245279767u, 10713214u },
+    { 103, 1, 1245351203u, 10783828u },
+    { 103, 0, 4245751245u, 10784590u },
+    { 104, 1, 1245448370u, 10881016u },
+    { 104, 0, 4245848418u, 10881578u },
+    { 105, 0, 4245969606u, 11002497u },
+    { 105, 1, 1245569551u, 11003361u },
+    { 106, 1, 1245683133u, 11116124u },
+    { 106, 0, 4246083195u, 11116788u },
+    { 107, 1, 1245753247u, 11186441u },
+    { 107, 0, 4246153313u, 11187147u },
+    { 108, 0, 4246269785u, 11302748u },
+    { 108, 1, 1245869712u, 11304240u },
+    { 109, 0, 4246363159u, 11396584u },
+    { 109, 1, 1245963080u, 11396664u },
+    { 110, 0, 4246453000u, 11485690u },
+    { 110, 1, 1246052917u, 11485995u },
+    { 111, 0, 4246548345u, 11581710u },
+    { 111, 1, 1246148256u, 11587607u },
+    { 112, 0, 4246684486u, 11717806u },
+    { 112, 1, 1246284388u, 11717962u },
+    { 113, 1, 1246365920u, 11799110u },
+    { 113, 0, 4246766022u, 11799416u },
+    { 114, 1, 1246451327u, 11883848u },
+    { 114, 0, 4246851434u, 11884544u },
+    { 115, 0, 4246980910u, 12013571u },
+    { 115, 1, 1246580795u, 12014021u },
+    { 116, 0, 4247065967u, 12098470u },
+    { 116, 1, 1246665848u, 12098860u },
+    { 117, 1, 1246775662u, 12208897u },
+    { 117, 0, 4247175788u, 12209432u },
+    { 118, 1, 1246874224u, 12307296u },
+    { 118, 0, 4247274357u, 12307558u },
+    { 119, 1, 1246948893u, 12382100u },
+    { 119, 0, 4247349030u, 12382133u },
+    { 120, 0, 4247455644u, 12488552u },
+    { 120, 1, 1247055501u, 12488918u },
+    { 121, 1, 1247148538u, 12581892u },
+    { 121, 0, 4247548687u, 12581953u },
+    { 122, 0, 4247662832u, 12695826u },
+    { 122, 1, 1247262677u, 12696415u },
+    { 123, 1, 1247358206u, 12790839u },
+    { 123, 0, 4247758367u, 12791498u },
+    { 124, 0, 4247855661u, 12888986u },
+    { 124, 1, 1247455495u, 12889358u },
+    { 125, 0, 4247977666u, 13010789u },
+    { 125, 1, 1247577493u, 13011218u },
+    { 126, 1, 1247663243u, 13096327u },
+    { 126, 0, 4248063422u, 13096518u },
+    { 127, 1, 1247778174u, 13211210u },
+    { 127, 0, 4248178359u, 13219346u },
+    { 128, 0, 4248262625u, 13295806u },
+    { 128, 1, 1247862434u, 13295899u },
+    { 129, 1, 1247950087u, 13382897u },
+    { 129, 0, 4248350283u, 13383569u },
+    { 130, 0, 4248473887u, 13507381u },
+    { 130, 1, 1248073685u, 13507889u },
+    { 131, 0, 4248549736u, 13582556u },
+    { 131, 1, 1248149528u, 13582941u },
+    { 132, 0, 4248686658u, 13720046u },
+    { 132, 1, 1248286443u, 13720083u },
+    { 133, 0, 4248748628u, 13781559u },
+    { 133, 1, 1248348409u, 13782033u },
+    { 134, 1, 1248459752u, 13892926u },
+    { 134, 0, 4248859978u, 13893664u },
+    { 135, 0, 4248956801u, 13989590u },
+    { 135, 1, 1248556569u, 13989991u },
+    { 136, 0, 4249076693u, 14109463u },
+    { 136, 1, 1248676454u, 14109993u },
+    { 137, 0, 4249177725u, 14210878u },
+    { 137, 1, 1248777481u, 14211127u },
+    { 138, 1, 1248868056u, 14300826u },
+    { 138, 0, 4249268306u, 14302008u },
+    { 139, 1, 1248970683u, 14403820u },
+    { 139, 0, 4249370938u, 14404128u },
+    { 140, 0, 4249487029u, 14519587u },
+    { 140, 1, 1249086766u, 14519893u },
+    { 141, 1, 1249178162u, 14611091u },
+    { 141, 0, 4249578430u, 14611574u },
+    { 142, 0, 4249649158u, 14681511u },
+    { 142, 1, 1249248886u, 14681874u },
+    { 143, 0, 4249775324u, 14808892u },
+    { 143, 1, 1249375044u, 14810040u },
+    { 144, 0, 4249853619u, 14886597u },
+    { 144, 1, 1249453335u, 14887237u },
+    { 145, 0, 4249981467u, 15014736u },
+    { 145, 1, 1249581176u, 15014770u },
+    { 146, 0, 4250072967u, 15105817u },
+    { 146, 1, 1249672670u, 15106425u },
+    { 147, 1, 1249770406u, 15203945u },
+    { 147, 0, 4250170709u, 15204463u },
+    { 148, 1, 1249868150u, 15300822u },
+    { 148, 0, 4250268459u, 15301732u },
+    { 149, 0, 4250379842u, 15412634u },
+    { 149, 1, 1249979527u, 15412846u },
+    { 150, 0, 4250482393u, 15515751u },
+    { 150, 1, 1250082072u, 15521721u },
+    { 151, 1, 1250154056u, 15587039u },
+    { 151, 0, 4250554382u, 15587562u },
+    { 152, 1, 1250251056u, 15684058u },
+    { 152, 0, 4250651387u, 15684949u },
+    { 153, 1, 1250369038u, 15802056u },
+    { 153, 0, 4250769376u, 15802513u },
+    { 154, 0, 4250851763u, 15885003u },
+    { 154, 1, 1250451419u, 15885933u },
+    { 155, 0, 4250959009u, 15991759u },
+    { 155, 1, 1250558660u, 15992620u },
+    { 156, 1, 1250651946u, 16084855u },
+    { 156, 0, 4251052301u, 16085975u },
+    { 157, 0, 4251161756u, 16194470u },
+    { 157, 1, 1250761394u, 16195374u },
+    { 158, 0, 4251265961u, 16298470u },
+    { 158, 1, 1250865593u, 16298945u },
+    { 159, 0, 4251354258u, 16386562u },
+    { 159, 1, 1250953885u, 16388199u },
+    { 160, 0, 4251461074u, 16493808u },
+    { 160, 1, 1251060695u, 16493829u },
+    { 161, 0, 4251553187u, 16585717u },
+    { 161, 1, 1251152803u, 16585943u },
+    { 162, 1, 1251248221u, 16681367u },
+    { 162, 0, 4251648611u, 16681488u },
+    { 163, 1, 1251350057u, 16782996u },
+    { 163, 0, 4251750453u, 16783822u },
+    { 164, 1, 1251482931u, 16916358u },
+    { 164, 0, 4251883335u, 16916524u },
+    { 165, 1, 1251578055u, 17010994u },
+    { 165, 0, 4251978465u, 17011484u },
+    { 166, 1, 1251659075u, 17092370u },
+    { 166, 0, 4252059490u, 17092485u },
+    { 167, 0, 4252161875u, 17194895u },
+    { 167, 1, 1251761455u, 17194996u },
+    { 168, 1, 1251865934u, 17298913u },
+    { 168, 0, 4252266360u, 17300017u },
+    { 169, 1, 1251976764u, 17409988u },
+    { 169, 0, 4252377197u, 17410157u },
+    { 170, 1, 1252070063u, 17503468u },
+    { 170, 0, 4252470501u, 17503692u },
+    { 171, 0, 4252585088u, 17617676u },
+    { 171, 1, 1252184643u, 17618297u },
+    { 172, 0, 4252652250u, 17684787u },
+    { 172, 1, 1252251801u, 17685305u },
+    { 173, 1, 1252377123u, 17810144u },
+    { 173, 0, 4252777580u, 17818486u },
+    { 174, 0, 4252864763u, 17897503u },
+    { 174, 1, 1252464301u, 17897904u },
+    { 175, 1, 1252579105u, 18012041u },
+    { 175, 0, 4252979573u, 18012604u },
+    { 176, 1, 1252672158u, 18105030u },
+    { 176, 0, 4253072632u, 18105658u },
+    { 177, 0, 4253148753u, 18181461u },
+    { 177, 1, 1252748274u, 18181940u },
+    { 178, 0, 4253251967u, 18284635u },
+    { 178, 1, 1252851482u, 18285344u },
+    { 179, 0, 4253377880u, 18410802u },
+    { 179, 1, 1252977388u, 18411484u },
+    { 180, 0, 4253467904u, 18500858u },
+    { 180, 1, 1253067407u, 18501347u },
+    { 181, 0, 4253575173u, 18607901u },
+    { 181, 1, 1253174669u, 18608093u },
+    { 182, 1, 1253261802u, 18694842u },
+    { 182, 0, 4253662311u, 18697078u },
+    { 183, 1, 1253368857u, 18802151u },
+    { 183, 0, 4253769373u, 18802252u },
+    { 184, 0, 4253849970u, 18882738u },
+    { 184, 1, 1253449450u, 18882846u },
+    { 185, 1, 1253582891u, 19015921u },
+    { 185, 0, 4253983419u, 19016893u },
+    { 186, 0, 4254057102u, 19089581u },
+    { 186, 1, 1253656570u, 19090274u },
+    { 187, 0, 4254156116u, 19188803u },
+    { 187, 1, 1253755578u, 19189902u },
+    { 188, 1, 1253874210u, 19306836u },
+    { 188, 0, 4254274755u, 19307869u },
+    { 189, 0, 4254348918u, 19382174u },
+    { 189, 1, 1253948368u, 19382305u },
+    { 190, 0, 4254451802u, 19484834u },
+    { 190, 1, 1254051247u, 19485181u },
+    { 191, 1, 1254159913u, 19592870u },
+    { 191, 0, 4254560475u, 19593744u },
+    { 192, 1, 1254269907u, 19702935u },
+    { 192, 0, 4254670476u, 19703802u },
+    { 193, 0, 4254778090u, 19811226u },
+    { 193, 1, 1254377515u, 19816671u },
+    { 194, 0, 4254867867u, 19900700u },
+    { 194, 1, 1254467287u, 19901004u },
+    { 195, 0, 4254969407u, 20001575u },
+    { 195, 1, 1254568821u, 20001948u },
+    { 196, 0, 4255086053u, 20118847u },
+    { 196, 1, 1254685460u, 20119328u },
+    { 197, 0, 4255149857u, 20182860u },
+    { 197, 1, 1254749261u, 20182952u },
+    { 198, 1, 1254848001u, 20281252u },
+    { 198, 0, 4255248604u, 20282174u },
+    { 199, 0, 4255378887u, 20411560u },
+    { 199, 1, 1254978277u, 20411908u },
+    { 200, 1, 1255072941u, 20505967u },
+    { 200, 0, 4255473556u, 20506514u },
+    { 201, 1, 1255163121u, 20596230u },
+    { 201, 0, 4255563742u, 20596544u },
+    { 202, 0, 4255680579u, 20713530u },
+    { 202, 1, 1255279951u, 20722582u },
+    { 203, 1, 1255361041u, 20793893u },
+    { 203, 0, 4255761674u, 20794672u },
+    { 204, 1, 1255485028u, 20917968u },
+    { 204, 0, 4255885668u, 20918665u },
+    { 205, 0, 4255972430u, 21004647u },
+    { 205, 1, 1255571784u, 21005422u },
+    { 206, 1, 1255660114u, 21092845u },
+    { 206, 0, 4256060764u, 21093864u },
+    { 207, 1, 1255750068u, 21183311u },
+    { 207, 0, 4256150723u, 21183794u },
+    { 208, 0, 4256269171u, 21301598u },
+    { 208, 1, 1255868508u, 21301962u },
+    { 209, 0, 4256361391u, 21393532u },
+    { 209, 1, 1255960723u, 21393885u },
+    { 210, 0, 4256471288u, 21503484u },
+    { 210, 1, 1256070614u, 21504208u },
+    { 211, 0, 4256573162u, 21605804u },
+    { 211, 1, 1256172481u, 21606240u },
+    { 212, 0, 4256656384u, 21688575u },
+    { 212, 1, 1256255698u, 21689408u },
+    { 213, 1, 1256370854u, 21804067u },
+    { 213, 0, 4256771547u, 21804523u },
+    { 214, 0, 4256871325u, 21903643u },
+    { 214, 1, 1256470627u, 21903865u },
+    { 215, 1, 1256549928u, 21982850u },
+    { 215, 0, 4256950631u, 21983546u },
+    { 216, 0, 4257064137u, 22096810u },
+    { 216, 1, 1256663427u, 22097318u },
+    { 217, 0, 4257178252u, 22210675u },
+    { 217, 1, 1256777535u, 22211290u },
+    { 218, 1, 1256854889u, 22288025u },
+    { 218, 0, 4257255610u, 22288474u },
+    { 219, 0, 4257366392u, 22398627u },
+    { 219, 1, 1256965664u, 22399143u },
+    { 220, 0, 4257474941u, 22508124u },
+    { 220, 1, 1257074207u, 22508441u },
+    { 221, 1, 1257151926u, 22584965u },
+    { 221, 0, 4257552665u, 22585476u },
+    { 222, 0, 4257687856u, 22720838u },
+    { 222, 1, 1257287109u, 22722662u },
+    { 223, 0, 4257779509u, 22811521u },
+    { 223, 1, 1257378757u, 22812219u },
+    { 224, 0, 4257862109u, 22894861u },
+    { 224, 1, 1257461352u, 22895672u },
+    { 225, 0, 4257972298u, 23004625u },
+    { 225, 1, 1257571535u, 23004825u },
+    { 226, 0, 4258066258u, 23098818u },
+    { 226, 1, 1257665489u, 23098972u },
+    { 227, 0, 4258163342u, 23195622u },
+    { 227, 1, 1257762568u, 23203692u },
+    { 228, 1, 1257871160u, 23304151u },
+    { 228, 0, 4258271941u, 23304809u },
+    { 229, 0, 4258373562u, 23405621u },
+    { 229, 1, 1257972775u, 23405897u },
+    { 230, 0, 4258478106u, 23510618u },
+    { 230, 1, 1258077312u, 23511189u },
+    { 231, 0, 4258587033u, 23619651u },
+    { 231, 1, 1258186234u, 23619976u },
+    { 232, 0, 4258681104u, 23713493u },
+    { 232, 1, 1258280299u, 23714084u },
+    { 233, 0, 4258772012u, 23804702u },
+    { 233, 1, 1258371201u, 23805005u },
+    { 234, 0, 4258883515u, 23915649u },
+    { 234, 1, 1258482698u, 23916705u },
+    { 235, 1, 1258561129u, 23993927u },
+    { 235, 0, 4258961951u, 23995124u },
+    { 236, 0, 4259081415u, 24113512u },
+    { 236, 1, 1258680587u, 24113829u },
+    { 237, 1, 1258770820u, 24203942u },
+    { 237, 0, 4259171654u, 24204596u },
+    { 238, 0, 4259258103u, 24290623u },
+    { 238, 1, 1258857264u, 24291411u },
+    { 239, 0, 4259376195u, 24408601u },
+    { 239, 1, 1258975349u, 24409069u },
+    { 240, 1, 1259052825u, 24485906u },
+    { 240, 0, 4259453675u, 24486556u },
+    { 241, 0, 4259559203u, 24591935u },
+    { 241, 1, 1259158346u, 24592056u },
+    { 242, 1, 1259275451u, 24709395u },
+    { 242, 0, 4259676315u, 24709784u },
+    { 243, 0, 4259781587u, 24813497u },
+    { 243, 1, 1259380717u, 24814059u },
+    { 244, 0, 4259871629u, 24903612u },
+    { 244, 1, 1259470754u, 24904258u },
+    { 245, 0, 4259964262u, 24996761u },
+    { 245, 1, 1259563381u, 24997314u },
+    { 246, 1, 1259658512u, 25091867u },
+    { 246, 0, 4260059399u, 25092067u },
+    { 247, 1, 1259766274u, 25199963u },
+    { 247, 0, 4260167167u, 25200048u },
+    { 248, 0, 4260262524u, 25294497u },
+    { 248, 1, 1259861626u, 25294885u },
+    { 249, 0, 4260371134u, 25403701u },
+    { 249, 1, 1259970229u, 25404426u },
+    { 250, 1, 1260079932u, 25513011u },
+    { 250, 0, 4260480844u, 25513558u },
+    { 251, 0, 4260553111u, 25585764u },
+    { 251, 1, 1260152196u, 25586006u },
+    { 252, 0, 4260679330u, 25711488u },
+    { 252, 1, 1260278407u, 25711971u },
+    { 253, 0, 4260760434u, 25792482u },
+    { 253, 1, 1260359507u, 25793237u },
+    { 254, 1, 1260461056u, 25893907u },
+    { 254, 0, 4260861989u, 25896012u },
+    { 255, 0, 4260966270u, 25998529u },
+    { 255, 1, 1260565330u, 25999293u },
+    { 256, 1, 1260652364u, 26086559u },
+    { 256, 0, 4261053309u, 26086664u },
+    { 257, 0, 4261161590u, 26193925u },
+    { 257, 1, 1260760639u, 26194246u },
+    { 258, 1, 1260864835u, 26298089u },
+    { 258, 0, 4261265793u, 26298695u },
+    { 259, 1, 1260954110u, 26387071u },
+    { 259, 0, 4261355073u, 26387647u },
+    { 260, 0, 4261487695u, 26519849u },
+    { 260, 1, 1261086724u, 26519996u },
+    { 261, 1, 1261179454u, 26612830u },
+    { 261, 0, 4261580430u, 26613246u },
+    { 262, 0, 4261669551u, 26701477u },
+    { 262, 1, 1261268570u, 26707265u },
+    { 263, 0, 4261783384u, 26815845u },
+    { 263, 1, 1261382396u, 26816200u },
+    { 264, 1, 1261458419u, 26891922u },
+    { 264, 0, 4261859412u, 26892207u },
+    { 265, 0, 4261983443u, 27015995u },
+    { 265, 1, 1261582443u, 27016454u },
+    { 266, 0, 4262087327u, 27119539u },
+    { 266, 1, 1261686321u, 27122378u },
+    { 267, 1, 1261768885u, 27202089u },
+    { 267, 0, 4262169896u, 27202925u },
+    { 268, 0, 4262285091u, 27317672u },
+    { 268, 1, 1261884073u, 27317851u },
+    { 269, 0, 4262363578u, 27396076u },
+    { 269, 1, 1261962556u, 27405026u },
+    { 270, 1, 1262074083u, 27506943u },
+    { 270, 0, 4262475112u, 27507763u },
+    { 271, 1, 1262163476u, 27597110u },
+    { 271, 0, 4262564510u, 27597190u },
+    { 272, 1, 1262254637u, 27687872u },
+    { 272, 0, 4262655676u, 27688009u },
+    { 273, 1, 1262363039u, 27796174u },
+    { 273, 0, 4262764085u, 27804071u },
+    { 274, 0, 4262849498u, 27881657u },
+    { 274, 1, 1262448447u, 27881893u },
+    { 275, 1, 1262555066u, 27988150u },
+    { 275, 0, 4262956123u, 27988474u },
+    { 276, 0, 4263065978u, 28098510u },
+    { 276, 1, 1262664914u, 28099085u },
+    { 277, 1, 1262755055u, 28188484u },
+    { 277, 0, 4263156124u, 28188539u },
+    { 278, 0, 4263272224u, 28304645u },
+    { 278, 1, 1262871148u, 28305745u },
+    { 279, 0, 4263382452u, 28414699u },
+    { 279, 1, 1262981370u, 28415323u },
+    { 280, 0, 4263481729u, 28513535u },
+    { 280, 1, 1263080640u, 28514444u },
+    { 281, 0, 4263576297u, 28608831u },
+    { 281, 1, 1263175203u, 28609120u },
+    { 282, 1, 1263262886u, 28695864u },
+    { 282, 0, 4263663985u, 28696849u },
+    { 283, 0, 4263758502u, 28790515u },
+    { 283, 1, 1263357397u, 28790880u },
+    { 284, 1, 1263456825u, 28890182u },
+    { 284, 0, 4263857935u, 28890679u },
+    { 285, 0, 4263966819u, 28998497u },
+    { 285, 1, 1263565702u, 28999227u },
+    { 286, 0, 4264067740u, 29099719u },
+    { 286, 1, 1263666617u, 29099874u },
+    { 287, 0, 4264159255u, 29191808u },
+    { 287, 1, 1263758127u, 29192152u },
+    { 288, 0, 4264262474u, 29294519u },
+    { 288, 1, 1263861340u, 29295736u },
+    { 289, 1, 1263967789u, 29401301u },
+    { 289, 0, 4264368930u, 29411357u },
+    { 290, 1, 1264070752u, 29503900u },
+    { 290, 0, 4264471899u, 29504463u },
+    { 291, 1, 1264154530u, 29588648u },
+    { 291, 0, 4264555681u, 29588776u },
+    { 292, 1, 1264262848u, 29695963u },
+    { 292, 0, 4264664006u, 29696516u },
+    { 293, 1, 1264370967u, 29804041u },
+    { 293, 0, 4264772131u, 29804489u },
+    { 294, 0, 4264855642u, 29887706u },
+    { 294, 1, 1264454472u, 29888346u },
+    { 295, 0, 4264978461u, 30010485u },
+    { 295, 1, 1264577284u, 30011074u },
+    { 296, 0, 4265078575u, 30110792u },
+    { 296, 1, 1264677393u, 30110890u },
+    { 297, 0, 4265174396u, 30206716u },
+    { 297, 1, 1264773208u, 30206926u },
+    { 298, 1, 1264856739u, 30290209u },
+    { 298, 0, 4265257932u, 30291287u },
+    { 299, 1, 1264959907u, 30393102u },
+    { 299, 0, 4265361106u, 30393486u },
+    { 300, 1, 1265060471u, 30494054u },
+    { 300, 0, 4265461676u, 30495026u },
+    { 301, 1, 1265157020u, 30590124u },
+    { 301, 0, 4265558231u, 30590553u },
+    { 302, 1, 1265276837u, 30709848u },
+    { 302, 0, 4265678055u, 30711096u },
+    { 303, 0, 4265759371u, 30791477u },
+    { 303, 1, 1265358148u, 30792377u },
+    { 304, 1, 1265470033u, 30903012u },
+    { 304, 0, 4265871262u, 30904381u },
+    { 305, 0, 4265951317u, 30983624u },
+    { 305, 1, 1265550083u, 30983899u },
+    { 306, 0, 4266052591u, 31084777u },
+    { 306, 1, 1265651351u, 31085049u },
+    { 307, 0, 4266187461u, 31219723u },
+    { 307, 1, 1265786213u, 31219911u },
+    { 308, 1, 1265879992u, 31313194u },
+    { 308, 0, 4266281245u, 31314000u },
+    { 309, 1, 1265985725u, 31418821u },
+    { 309, 0, 4266386985u, 31419866u },
+    { 310, 0, 4266466324u, 31498589u },
+    { 310, 1, 1266065060u, 31498993u },
+    { 311, 0, 4266553436u, 31585567u },
+    { 311, 1, 1266152167u, 31585839u },
+    { 312, 0, 4266679727u, 31711561u },
+    { 312, 1, 1266278450u, 31718087u },
+    { 313, 1, 1266369938u, 31803049u },
+    { 313, 0, 4266771221u, 31803579u },
+    { 314, 1, 1266469686u, 31902980u },
+    { 314, 0, 4266870974u, 31903815u },
+    { 315, 1, 1266554969u, 31988017u },
+    { 315, 0, 4266956262u, 31988486u },
+    { 316, 0, 4267061380u, 32093714u },
+    { 316, 1, 1266660081u, 32094272u },
+    { 317, 0, 4267175400u, 32207506u },
+    { 317, 1, 1266774094u, 32208032u },
+    { 318, 0, 4267277336u, 32309600u },
+    { 318, 1, 1266876024u, 32310195u },
+    { 319, 1, 1266974819u, 32407999u },
+    { 319, 0, 4267376137u, 32408484u },
+    { 320, 0, 4267449547u, 32481746u },
+    { 320, 1, 1267048224u, 32481854u },
+    { 321, 0, 4267571470u, 32603736u },
+    { 321, 1, 1267170141u, 32604102u },
+    { 322, 0, 4267654864u, 32686659u },
+    { 322, 1, 1267253530u, 32687150u },
+    { 323, 0, 4267782418u, 32814529u },
+    { 323, 1, 1267381076u, 32815014u },
+    { 324, 0, 4267880907u, 32912548u },
+    { 324, 1, 1267479559u, 32913776u },
+    { 325, 0, 4267961535u, 32993732u },
+    { 325, 1, 1267560182u, 32993943u },
+    { 326, 1, 1267654409u, 33087837u },
+    { 326, 0, 4268055767u, 33088422u },
+    { 327, 1, 1267755941u, 33189389u },
+    { 327, 0, 4268157305u, 33189690u },
+    { 328, 1, 1267849910u, 33282883u },
+    { 328, 0, 4268251280u, 33284373u },
+    { 329, 0, 4268367968u, 33399758u },
+    { 329, 1, 1267966591u, 33399830u },
+    { 330, 1, 1268077972u, 33511053u },
+    { 330, 0, 4268479355u, 33512175u },
+    { 331, 0, 4268560974u, 33592632u },
+    { 331, 1, 1268159586u, 33592914u },
+    { 332, 0, 4268667604u, 33699465u },
+    { 332, 1, 1268266210u, 33700006u },
+    { 333, 1, 1268351795u, 33784939u },
+    { 333, 0, 4268753195u, 33785548u },
+    { 334, 1, 1268464440u, 33897920u },
+    { 334, 0, 4268865846u, 33899077u },
+    { 335, 1, 1268558736u, 33992195u },
+    { 335, 0, 4268960147u, 33992905u },
+    { 336, 0, 4269055334u, 34087547u },
+    { 336, 1, 1268653917u, 34087723u },
+    { 337, 0, 4269160980u, 34192662u },
+    { 337, 1, 1268759557u, 34193218u },
+    { 338, 0, 4269282475u, 34314485u },
+    { 338, 1, 1268881045u, 34315540u },
+    { 339, 0, 4269372825u, 34404567u },
+    { 339, 1, 1268971389u, 34405622u },
+    { 340, 1, 1269076589u, 34509881u },
+    { 340, 0, 4269478031u, 34509926u },
+    { 341, 0, 4269581023u, 34612682u },
+    { 341, 1, 1269179575u, 34612899u },
+    { 342, 0, 4269680540u, 34712495u },
+    { 342, 1, 1269279086u, 34712862u },
+    { 343, 1, 1269376905u, 34809997u },
+    { 343, 0, 4269778365u, 34811230u },
+    { 344, 0, 4269858008u, 34889488u },
+    { 344, 1, 1269456543u, 34889964u },
+    { 345, 1, 1269586957u, 35020164u },
+    { 345, 0, 4269988429u, 35020503u },
+    { 346, 0, 4270055714u, 35087836u },
+    { 346, 1, 1269654238u, 35087949u },
+    { 347, 1, 1269756661u, 35189824u },
+    { 347, 0, 4270158144u, 35190500u },
+    { 348, 0, 4270276547u, 35308732u },
+    { 348, 1, 1269875058u, 35309037u },
+    { 349, 0, 4270385690u, 35417552u },
+    { 349, 1, 1269984194u, 35417974u },
+    { 350, 1, 1270073118u, 35506918u },
+    { 350, 0, 4270474619u, 35506986u },
+    { 351, 1, 1270180730u, 35613992u },
+    { 351, 0, 4270582237u, 35614940u },
+    { 352, 0, 4270677953u, 35709953u },
+    { 352, 1, 1270276440u, 35710182u },
+    { 353, 1, 1270386592u, 35820280u },
+    { 353, 0, 4270788111u, 35820588u },
+    { 354, 1, 1270451778u, 35884834u },
+    { 354, 0, 4270853302u, 35885841u },
+    { 355, 0, 4270973970u, 36005493u },
+    { 355, 1, 1270572440u, 36005874u },
+    { 356, 1, 1270655589u, 36088980u },
+    { 356, 0, 4271057124u, 36090169u },
+    { 357, 1, 1270750824u, 36184094u },
+    { 357, 0, 4271152364u, 36185179u },
+    { 358, 1, 1270881897u, 36314962u },
+    { 358, 0, 4271283445u, 36315645u },
+    { 359, 1, 1270961749u, 36394864u },
+    { 359, 0, 4271363302u, 36396024u },
+    { 360, 0, 4271487745u, 36519487u },
+    { 360, 1, 1271086184u, 36519874u },
+    { 361, 0, 4271560018u, 36591812u },
+    { 361, 1, 1271158454u, 36591861u },
+    { 362, 0, 4271653574u, 36685740u },
+    { 362, 1, 1271252004u, 36686227u },
+    { 363, 1, 1271354231u, 36787956u },
+    { 363, 0, 4271755807u, 36787981u },
+    { 364, 1, 1271457019u, 36890824u },
+    { 364, 0, 4271858601u, 36890966u },
+    { 365, 0, 4271963086u, 36994923u },
+    { 365, 1, 1271561498u, 36995826u },
+    { 366, 1, 1271655828u, 37089017u },
+    { 366, 0, 4272057423u, 37089722u },
+    { 367, 1, 1271784565u, 37217902u },
+    { 367, 0, 4272186167u, 37217963u },
+    { 368, 0, 4272264425u, 37296473u },
+    { 368, 1, 1271862819u, 37296552u },
+    { 369, 0, 4272366848u, 37398644u },
+    { 369, 1, 1271965236u, 37399074u },
+    { 370, 0, 4272452679u, 37484476u },
+    { 370, 1, 1272051061u, 37484903u },
+    { 371, 0, 4272588719u, 37620586u },
+    { 371, 1, 1272187093u, 37621277u },
+    { 372, 1, 1272280836u, 37713872u },
+    { 372, 0, 4272682467u, 37715268u },
+    { 373, 1, 1272373011u, 37806973u },
+    { 373, 0, 4272774647u, 37808301u },
+    { 374, 1, 1272460067u, 37893884u },
+    { 374, 0, 4272861708u, 37894061u },
+    { 375, 1, 1272549523u, 37982977u },
+    { 375, 0, 4272951170u, 37983688u },
+    { 376, 0, 4273073982u, 38105535u },
+    { 376, 1, 1272672328u, 38106800u },
+    { 377, 0, 4273181905u, 38213591u },
+    { 377, 1, 1272780244u, 38213928u },
+    { 378, 1, 1272856849u, 38290172u },
+    { 378, 0, 4273258514u, 38290652u },
+    { 379, 1, 1272965225u, 38398904u },
+    { 379, 0, 4273366896u, 38399027u },
+    { 380, 0, 4273474057u, 38505634u },
+    { 380, 1, 1273072379u, 38505986u },
+    { 381, 0, 4273582898u, 38614723u },
+    { 381, 1, 1273181214u, 38615067u },
+    { 382, 0, 4273672805u, 38704577u },
+    { 382, 1, 1273271116u, 38705124u },
+    { 383, 0, 4273769302u, 38801546u },
+    { 383, 1, 1273367607u, 38808257u },
+    { 384, 0, 4273857160u, 38888767u },
+    { 384, 1, 1273455460u, 38888935u },
+    { 385, 0, 4273954826u, 38986532u },
+    { 385, 1, 1273553120u, 38987233u },
+    { 386, 1, 1273680830u, 39114116u },
+    { 386, 0, 4274082543u, 39114630u },
+    { 387, 1, 1273758658u, 39192193u },
+    { 387, 0, 4274160377u, 39192603u },
+    { 388, 0, 4274269949u, 39301522u },
+    { 388, 1, 1273868224u, 39301939u },
+    { 389, 0, 4274375693u, 39407478u },
+    { 389, 1, 1273973962u, 39407831u },
+    { 390, 0, 4274488830u, 39521325u },
+    { 390, 1, 1274087093u, 39526725u },
+    { 391, 1, 1274166588u, 39600265u },
+    { 391, 0, 4274568331u, 39600896u },
+    { 392, 0, 4274681336u, 39713686u },
+    { 392, 1, 1274279587u, 39715340u },
+    { 393, 1, 1274366742u, 39799876u },
+    { 393, 0, 4274768496u, 39800626u },
+    { 394, 1, 1274469354u, 39903147u },
+    { 394, 0, 4274871114u, 39903443u },
+    { 395, 0, 4274986688u, 40018729u },
+    { 395, 1, 1274584921u, 40019520u },
+    { 396, 0, 4275088091u, 40119677u },
+    { 396, 1, 1274686318u, 40120154u },
+    { 397, 0, 4275163928u, 40195810u },
+    { 397, 1, 1274762150u, 40196169u },
+    { 398, 0, 4275280811u, 40312601u },
+    { 398, 1, 1274879027u, 40313409u },
+    { 399, 0, 4275383806u, 40415649u },
+    { 399, 1, 1274982016u, 40416265u },
+    { 400, 1, 1275074860u, 40507983u },
+    { 400, 0, 4275476656u, 40508711u },
+    { 401, 0, 4275584295u, 40615507u },
+    { 401, 1, 1275182493u, 40616134u },
+    { 402, 1, 1275262763u, 40695823u },
+    { 402, 0, 4275664571u, 40696674u },
+    { 403, 1, 1275372662u, 40805910u },
+    { 403, 0, 4275774475u, 40806478u },
+    { 404, 0, 4275861042u, 40892788u },
+    { 404, 1, 1275459223u, 40893002u },
+    { 405, 0, 4275959990u, 40991521u },
+    { 405, 1, 1275558165u, 40991989u },
+    { 406, 0, 4276072102u, 41103805u },
+    { 406, 1, 1275670271u, 41104438u },
+    { 407, 1, 1275786604u, 41219826u },
+    { 407, 0, 4276188442u, 41220594u },
+    { 408, 0, 4276281776u, 41313676u },
+    { 408, 1, 1275879933u, 41314174u },
+    { 409, 0, 4276385229u, 41416520u },
+    { 409, 1, 1275983379u, 41417281u },
+    { 410, 0, 4276463995u, 41495619u },
+    { 410, 1, 1276062141u, 41495976u },
+    { 411, 1, 1276186134u, 41619895u },
+    { 411, 0, 4276587995u, 41619979u },
+    { 412, 1, 1276252866u, 41686986u },
+    { 412, 0, 4276654732u, 41687000u },
+    { 413, 0, 4276755209u, 41786473u },
+    { 413, 1, 1276353337u, 41788045u },
+    { 414, 0, 4276871223u, 41902638u },
+    { 414, 1, 1276469345u, 41903559u },
+    { 415, 0, 4276967787u, 41999482u },
+    { 415, 1, 1276565903u, 41999856u },
+    { 416, 0, 4277054278u, 42085481u },
+    { 416, 1, 1276652389u, 42086035u },
+    { 417, 1, 1276774686u, 42207953u },
+    { 417, 0, 4277176582u, 42208857u },
+    { 418, 1, 1276862392u, 42296496u },
+    { 418, 0, 4277264293u, 42302894u },
+    { 419, 0, 4277363917u, 42395951u },
+    { 419, 1, 1276962010u, 42396726u },
+    { 420, 1, 1277060480u, 42494545u },
+    { 420, 0, 4277462393u, 42494547u },
+    { 421, 1, 1277166980u, 42600983u },
+    { 421, 0, 4277568899u, 42601212u },
+    { 422, 0, 4277673926u, 42705495u },
+    { 422, 1, 1277272000u, 42705907u },
+    { 423, 1, 1277376513u, 42810102u },
+    { 423, 0, 4277778445u, 42810731u },
+    { 424, 0, 4277886356u, 42917598u },
+    { 424, 1, 1277484418u, 42917838u },
+    { 425, 1, 1277568067u, 43001976u },
+    { 425, 0, 4277970010u, 43002490u },
+    { 426, 0, 4278081141u, 43112768u },
+    { 426, 1, 1277679191u, 43112847u },
+    { 427, 0, 4278183196u, 43214570u },
+    { 427, 1, 1277781241u, 43214825u },
+    { 428, 0, 4278284790u, 43316489u },
+    { 428, 1, 1277882828u, 43317132u },
+    { 429, 1, 1277984766u, 43417872u },
+    { 429, 0, 4278386734u, 43418476u },
+    { 430, 0, 4278458297u, 43489675u },
+    { 430, 1, 1278056325u, 43490494u },
+    { 431, 1, 1278157796u, 43590943u },
+    { 431, 0, 4278559774u, 43591712u },
+    { 432, 1, 1278261002u, 43694872u },
+    { 432, 0, 4278662986u, 43697165u },
+    { 433, 0, 4278768046u, 43799482u },
+    { 433, 1, 1278366056u, 43799846u },
+    { 434, 0, 4278887065u, 43918484u },
+    { 434, 1, 1278485067u, 43919111u },
+    { 435, 1, 1278561625u, 43994842u },
+    { 435, 0, 4278963627u, 44003416u },
+    { 436, 0, 4279079346u, 44110700u },
+    { 436, 1, 1278677337u, 44110850u },
+    { 437, 0, 4279172030u, 44203621u },
+    { 437, 1, 1278770016u, 44203861u },
+    { 438, 0, 4279262348u, 44293534u },
+    { 438, 1, 1278860329u, 44294836u },
+    { 439, 0, 4279358450u, 44389744u },
+    { 439, 1, 1278956425u, 44390270u },
+    { 440, 0, 4279482330u, 44513533u },
+    { 440, 1, 1279080297u, 44514335u },
+    { 441, 1, 1279174476u, 44608003u },
+    { 441, 0, 4279576514u, 44608731u },
+    { 442, 1, 1279257492u, 44691697u },
+    { 442, 0, 4279659535u, 44691894u },
+    { 443, 0, 4279757883u, 44789509u },
+    { 443, 1, 1279355834u, 44799206u },
+    { 444, 1, 1279463764u, 44896842u },
+    { 444, 0, 4279865819u, 44898241u },
+    { 445, 0, 4279957033u, 44989009u },
+    { 445, 1, 1279554973u, 44989145u },
+    { 446, 0, 4280054482u, 45085744u },
+    { 446, 1, 1279652416u, 45086434u },
+    { 447, 1, 1279770459u, 45204086u },
+    { 447, 0, 4280172532u, 45205006u },
+    { 448, 0, 4280251966u, 45283718u },
+    { 448, 1, 1279849888u, 45283874u },
+    { 449, 0, 4280372161u, 45403478u },
+    { 449, 1, 1279970076u, 45404023u },
+    { 450, 1, 1280081745u, 45515133u },
+    { 450, 0, 4280483837u, 45515720u },
+    { 451, 1, 1280186468u, 45619988u },
+    { 451, 0, 4280588566u, 45620564u },
+    { 452, 0, 4280682178u, 45713653u },
+    { 452, 1, 1280280075u, 45714449u },
+    { 453, 1, 1280351524u, 45784843u },
+    { 453, 0, 4280753631u, 45786535u },
+    { 454, 0, 4280872220u, 45903581u },
+    { 454, 1, 1280470105u, 45904246u },
+    { 455, 1, 1280567246u, 46000954u },
+    { 455, 0, 4280969366u, 46001008u },
+    { 456, 0, 4281056761u, 46088771u },
+    { 456, 1, 1280654636u, 46089095u },
+    { 457, 1, 1280753692u, 46187405u },
+    { 457, 0, 4281155823u, 46188442u },
+    { 458, 0, 4281262984u, 46294486u },
+    { 458, 1, 1280860847u, 46294881u },
+    { 459, 0, 4281372984u, 46404587u },
+    { 459, 1, 1280970840u, 46405569u },
+    { 460, 0, 4281470023u, 46501865u },
+    { 460, 1, 1281067874u, 46502144u },
+    { 461, 0, 4281562113u, 46593506u },
+    { 461, 1, 1281159958u, 46594177u },
+    { 462, 0, 4281675514u, 46706760u },
+    { 462, 1, 1281273352u, 46706988u },
+    { 463, 0, 4281779297u, 46810724u },
+    { 463, 1, 1281377130u, 46810854u },
+    { 464, 0, 4281860017u, 46891568u },
+    { 464, 1, 1281457844u, 46892956u },
+    { 465, 1, 1281562311u, 46995895u },
+    { 465, 0, 4281964490u, 46996085u },
+    { 466, 0, 4282059341u, 47090491u },
+    { 466, 1, 1281657157u, 47090845u },
+    { 467, 1, 1281759749u, 47192900u },
+    { 467, 0, 4282161939u, 47193470u },
+    { 468, 1, 1281874774u, 47308835u },
+    { 468, 0, 4282276971u, 47308846u },
+    { 469, 0, 4282379227u, 47410481u },
+    { 469, 1, 1281977023u, 47411108u },
+    { 470, 0, 4282455516u, 47486829u },
+    { 470, 1, 1282053309u, 47487035u },
+    { 471, 0, 4282577527u, 47608482u },
+    { 471, 1, 1282175312u, 47609252u },
+    { 472, 0, 4282687013u, 47718485u },
+    { 472, 1, 1282284792u, 47718866u },
+    { 473, 1, 1282375494u, 47808902u },
+    { 473, 0, 4282777721u, 47809787u },
+    { 474, 0, 4282872186u, 47903489u },
+    { 474, 1, 1282469954u, 47903885u },
+    { 475, 1, 1282571733u, 48005084u },
+    { 475, 0, 4282973972u, 48005593u },
+    { 476, 1, 1282657684u, 48091078u },
+    { 476, 0, 4283059927u, 48091551u },
+    { 477, 0, 4283151311u, 48182550u },
+    { 477, 1, 1282749063u, 48183080u },
+    { 478, 1, 1282881627u, 48315239u },
+    { 478, 0, 4283283884u, 48316483u },
+    { 479, 0, 4283386406u, 48417861u },
+    { 479, 1, 1282984144u, 48417927u },
+    { 480, 0, 4283477276u, 48508685u },
+    { 480, 1, 1283075008u, 48508993u },
+    { 481, 0, 4283567630u, 48598712u },
+    { 481, 1, 1283165357u, 48599044u },
+    { 482, 1, 1283248614u, 48681837u },
+    { 482, 0, 4283650893u, 48682659u },
+    { 483, 1, 1283384451u, 48818552u },
+    { 483, 0, 4283786738u, 48818694u },
+    { 484, 0, 4283882385u, 48913590u },
+    { 484, 1, 1283480093u, 48914113u },
+    { 485, 0, 4283963013u, 48994538u },
+    { 485, 1, 1283560717u, 48999872u },
+    { 486, 0, 4284074338u, 49105634u },
+    { 486, 1, 1283672035u, 49105967u },
+    { 487, 0, 4284174353u, 49205602u },
+    { 487, 1, 1283772044u, 49210418u },
+    { 488, 0, 4284270214u, 49301835u },
+    { 488, 1, 1283867899u, 49302131u },
+    { 489, 1, 1283949547u, 49382865u },
+    { 489, 0, 4284351867u, 49383555u },
+    { 490, 0, 4284471390u, 49502602u },
+    { 490, 1, 1284069064u, 49502851u },
+    { 491, 1, 1284150495u, 49583872u },
+    { 491, 0, 4284552826u, 49584513u },
+    { 492, 0, 4284670303u, 49701529u },
+    { 492, 1, 1284267965u, 49701828u },
+    { 493, 1, 1284372961u, 49806823u },
+    { 493, 0, 4284775305u, 49806874u },
+    { 494, 1, 1284457785u, 49892480u },
+    { 494, 0, 4284860135u, 49898519u },
+    { 495, 0, 4284980460u, 50011699u },
+    { 495, 1, 1284578103u, 50012636u },
+    { 496, 0, 4285062277u, 50093923u },
+    { 496, 1, 1284659916u, 50094065u },
+    { 497, 1, 1284765539u, 50199194u },
+    { 497, 0, 4285167907u, 50200026u },
+    { 498, 1, 1284876359u, 50310328u },
+    { 498, 0, 4285278733u, 50310481u },
+    { 499, 1, 1284973495u, 50407004u },
+    { 499, 0, 4285375875u, 50407596u },
+    { 500, 1, 1285076486u, 50510084u },
+    { 500, 0, 4285478872u, 50510542u },
+    { 501, 0, 4285582472u, 50613519u },
+    { 501, 1, 1285180080u, 50614043u },
+    { 502, 1, 1285262927u, 50697014u },
+    { 502, 0, 4285665324u, 50697073u },
+    { 503, 0, 4285776524u, 50807559u },
+    { 503, 1, 1285374120u, 50808190u },
+    { 504, 0, 4285876375u, 50907490u },
+    { 504, 1, 1285473965u, 50908362u },
+    { 505, 0, 4285977368u, 51008585u },
+    { 505, 1, 1285574953u, 51008941u },
+    { 506, 1, 1285647349u, 51080863u },
+    { 506, 0, 4286049769u, 51081621u },
+    { 507, 0, 4286170692u, 51201738u },
+    { 507, 1, 1285768265u, 51201869u },
+    { 508, 0, 4286279344u, 51310505u },
+    { 508, 1, 1285876911u, 51311202u },
+    { 509, 1, 1285952638u, 51385921u },
+    { 509, 0, 4286355076u, 51386849u },
+    { 510, 1, 1286047517u, 51481557u },
+    { 510, 0, 4286449961u, 51481719u },
+    { 511, 0, 4286583894u, 51615703u },
+    { 511, 1, 1286181443u, 51616057u },
+    { 512, 1, 1286264637u, 51698573u },
+    { 512, 0, 4286667093u, 51699120u },
+    { 513, 0, 4286777239u, 51808676u },
+    { 513, 1, 1286374776u, 51809435u },
+    { 514, 1, 1286457403u, 51891235u },
+    { 514, 0, 4286859871u, 51892115u },
+    { 515, 0, 4286971588u, 52002986u },
+    { 515, 1, 1286569113u, 52003263u },
+    { 516, 0, 4287050397u, 52081726u },
+    { 516, 1, 1286647918u, 52081899u },
+    { 517, 0, 4287159705u, 52190621u },
+    { 517, 1, 1286757220u, 52191061u },
+    { 518, 0, 4287283379u, 52314806u },
+    { 518, 1, 1286880886u, 52314929u },
+    { 519, 1, 1286965640u, 52398933u },
+    { 519, 0, 4287368137u, 52400118u },
+    { 520, 1, 1287085507u, 52519256u },
+    { 520, 0, 4287488012u, 52520294u },
+    { 521, 0, 4287585331u, 52616903u },
+    { 521, 1, 1287182821u, 52617222u },
+    { 522, 1, 1287268466u, 52702399u },
+    { 522, 0, 4287670981u, 52703246u },
+    { 523, 1, 1287352444u, 52785821u },
+    { 523, 0, 4287754964u, 52786605u },
+    { 524, 0, 4287869727u, 52900588u },
+    { 524, 1, 1287467200u, 52901046u },
+    { 525, 1, 1287572607u, 53005926u },
+    { 525, 0, 4287975140u, 53006728u },
+    { 526, 0, 4288063816u, 53094494u },
+    { 526, 1, 1287661278u, 53094891u },
+    { 527, 0, 4288182325u, 53213701u },
+    { 527, 1, 1287779780u, 53213908u },
+    { 528, 1, 1287864741u, 53298925u },
+    { 528, 0, 4288267292u, 53298948u },
+    { 529, 1, 1287983347u, 53417130u },
+    { 529, 0, 4288385905u, 53417501u },
+    { 530, 0, 4288452596u, 53484193u },
+    { 530, 1, 1288050035u, 53484568u },
+    { 531, 1, 1288147525u, 53581058u },
+    { 531, 0, 4288550092u, 53581529u },
+    { 532, 1, 1288285308u, 53719126u },
+    { 532, 0, 4288687883u, 53725783u },
+    { 533, 0, 4288772337u, 53803488u },
+    { 533, 1, 1288369757u, 53804758u },
+    { 534, 1, 1288457481u, 53891183u },
+    { 534, 0, 4288860066u, 53891963u },
+    { 535, 0, 4288973757u, 54004738u },
+    { 535, 1, 1288571164u, 54005236u },
+    { 536, 1, 1288682525u, 54116005u },
+    { 536, 0, 4289085124u, 54116507u },
+    { 537, 1, 1288754551u, 54187924u },
+    { 537, 0, 4289157154u, 54190068u },
+    { 538, 0, 4289267531u, 54298549u },
+    { 538, 1, 1288864921u, 54299234u },
+    { 539, 0, 4289379772u, 54410513u },
+    { 539, 1, 1288977155u, 54418475u },
+    { 540, 0, 4289460826u, 54491771u },
+    { 540, 1, 1289058205u, 54492144u },
+    { 541, 0, 4289567750u, 54598473u },
+    { 541, 1, 1289165123u, 54598985u },
+    { 542, 0, 4289673252u, 54704683u },
+    { 542, 1, 1289270619u, 54708464u },
+    { 543, 1, 1289357725u, 54791844u },
+    { 543, 0, 4289760364u, 54791936u },
+    { 544, 0, 4289850378u, 54881650u },
+    { 544, 1, 1289447734u, 54882026u },
+    { 545, 1, 1289556442u, 54989960u },
+    { 545, 0, 4289959092u, 54990523u },
+    { 546, 1, 1289668496u, 55101947u },
+    { 546, 0, 4290071153u, 55103128u },
+    { 547, 1, 1289759364u, 55193073u },
+    { 547, 0, 4290162027u, 55193508u },
+    { 548, 1, 1289861818u, 55296048u },
+    { 548, 0, 4290264486u, 55296129u },
+    { 549, 1, 1289968576u, 55401899u },
+    { 549, 0, 4290371251u, 55402556u },
+    { 550, 0, 4290459899u, 55490710u },
+    { 550, 1, 1290057219u, 55500394u },
+    { 551, 0, 4290573485u, 55604564u },
+    { 551, 1, 1290170799u, 55605109u },
+    { 552, 1, 1290259421u, 55692947u },
+    { 552, 0, 4290662113u, 55693676u },
+    { 553, 0, 4290781647u, 55812700u },
+    { 553, 1, 1290378949u, 55812827u },
+    { 554, 1, 1290482563u, 55916068u },
+    { 554, 0, 4290885268u, 55916692u },
+    { 555, 1, 1290548301u, 55981970u },
+    { 555, 0, 4290951010u, 55982526u },
+    { 556, 0, 4291055561u, 56086504u },
+    { 556, 1, 1290652846u, 56087222u },
+    { 557, 1, 1290771509u, 56205143u },
+    { 557, 0, 4291174231u, 56205822u },
+    { 558, 1, 1290864099u, 56298204u },
+    { 558, 0, 4291266827u, 56298535u },
+    { 559, 1, 1290971829u, 56406168u },
+    { 559, 0, 4291374563u, 56406175u },
+    { 560, 1, 1291082565u, 56515924u },
+    { 560, 0, 4291485305u, 56516572u },
+    { 561, 1, 1291148485u, 56582161u },
+    { 561, 0, 4291551229u, 56582595u },
+    { 562, 1, 1291285268u, 56719077u },
+    { 562, 0, 4291688021u, 56720125u },
+    { 563, 1, 1291383441u, 56816939u },
+    { 563, 0, 4291786199u, 56817869u },
+    { 564, 1, 1291473589u, 56907583u },
+    { 564, 0, 4291876353u, 56907792u },
+    { 565, 1, 1291577315u, 57011020u },
+    { 565, 0, 4291980084u, 57011672u },
+    { 566, 0, 4292083407u, 57114791u },
+    { 566, 1, 1291680631u, 57115121u },
+    { 567, 0, 4292175416u, 57206761u },
+    { 567, 1, 1291772635u, 57206951u },
+    { 568, 1, 1291884530u, 57318135u },
+    { 568, 0, 4292287318u, 57318796u },
+    { 569, 0, 4292369486u, 57400486u },
+    { 569, 1, 1291966694u, 57401628u },
+    { 570, 1, 1292057418u, 57490871u },
+    { 570, 0, 4292460216u, 57491795u },
+    { 571, 1, 1292152294u, 57586099u },
+    { 571, 0, 4292555098u, 57586703u },
+    { 572, 0, 4292652442u, 57683524u },
+    { 572, 1, 1292249633u, 57684488u },
+    { 573, 1, 1292359373u, 57793193u },
+    { 573, 0, 4292762188u, 57794163u },
+    { 574, 0, 4292874798u, 57905529u },
+    { 574, 1, 1292471976u, 57906050u },
+    { 575, 1, 1292556099u, 57990655u },
+    { 575, 0, 4292958927u, 57991184u },
+    { 576, 1, 1292649383u, 58083047u },
+    { 576, 0, 4293052216u, 58083647u },
+    { 577, 1, 1292779369u, 58213313u },
+    { 577, 0, 4293182210u, 58213752u },
+    { 578, 1, 1292850496u, 58284562u },
+    { 578, 0, 4293253340u, 58285070u },
+    { 579, 0, 4293358912u, 58389582u },
+    { 579, 1, 1292956061u, 58389890u },
+    { 580, 0, 4293460913u, 58491517u },
+    { 580, 1, 1293058057u, 58491898u },
+    { 581, 1, 1293156520u, 58589900u },
+    { 581, 0, 4293559383u, 58590778u },
+    { 582, 1, 1293272533u, 58706014u },
+    { 582, 0, 4293675403u, 58707701u },
+    { 583, 0, 4293774606u, 58805542u },
+    { 583, 1, 1293371730u, 58805853u },
+    { 584, 1, 1293456538u, 58889962u },
+    { 584, 0, 4293859418u, 58891619u },
+    { 585, 1, 1293568269u, 59002306u },
+    { 585, 0, 4293971156u, 59002916u },
+    { 586, 1, 1293680530u, 59113914u },
+    { 586, 0, 4294083423u, 59114838u },
+    { 587, 0, 4294153631u, 59184842u },
+    { 587, 1, 1293750733u, 59185010u },
+    { 588, 0, 4294253634u, 59284527u },
+    { 588, 1, 1293850730u, 59285011u },
+    { 589, 0, 4294375597u, 59406552u },
+    { 589, 1, 1293972686u, 59408228u },
+    { 590, 0, 4294469661u, 59500478u },
+    { 590, 1, 1294066744u, 59501945u },
+    { 591, 1, 1294184374u, 59617972u },
+    { 591, 0, 4294587298u, 59619171u },
+    { 592, 0, 4294654982u, 59685877u },
+    { 592, 1, 1294252055u, 59685892u },
+    { 593, 1, 1294351272u, 59785155u },
+    { 593, 0, 4294754206u, 59785957u },
+    { 594, 1, 1294450308u, 59883972u },
+    { 594, 0, 4294853247u, 59884678u },
+    { 595, 1, 1294567797u, 60001943u },
+    { 595, 0, 3447u, 60002086u },
+    { 596, 1, 1294647980u, 60082182u },
+    { 596, 0, 83635u, 60082273u },
+    { 597, 1, 1294762281u, 60195997u },
+    { 597, 0, 197943u, 60196517u },
+    { 598, 1, 1294853225u, 60287153u },
+    { 598, 0, 288892u, 60288340u },
+    { 599, 1, 1294979022u, 60413099u },
+    { 599, 0, 414696u, 60413270u },
+    { 600, 0, 512601u, 60510771u },
+    { 600, 1, 1295076921u, 60510898u },
+    { 601, 0, 598700u, 60596745u },
+    { 601, 1, 1295163015u, 60597681u },
+    { 602, 0, 708124u, 60706528u },
+    { 602, 1, 1295272433u, 60706952u },
+    { 603, 1, 1295366170u, 60799821u },
+    { 603, 0, 801867u, 60800573u },
+    { 604, 1, 1295457182u, 60890981u },
+    { 604, 0, 892885u, 60891582u },
+    { 605, 1, 1295551247u, 60985116u },
+    { 605, 0, 986955u, 60985536u },
+    { 606, 0, 1112338u, 61110713u },
+    { 606, 1, 1295676622u, 61111347u },
+    { 607, 0, 1220500u, 61218615u },
+    { 607, 1, 1295784779u, 61219390u },
+    { 608, 0, 1293065u, 61291836u },
+    { 608, 1, 1295857339u, 61300422u },
+    { 609, 1, 1295950395u, 61383915u },
+    { 609, 0, 1386126u, 61384513u },
+    { 610, 0, 1495462u, 61493622u },
+    { 610, 1, 1296059724u, 61494019u },
+    { 611, 1, 1296174444u, 61607940u },
+    { 611, 0, 1610189u, 61608465u },
+    { 612, 1, 1296251492u, 61684869u },
+    { 612, 0, 1687242u, 61685603u },
+    { 613, 0, 1801520u, 61799489u },
+    { 613, 1, 1296365764u, 61799995u },
+    { 614, 1, 1296479251u, 61913081u },
+    { 614, 0, 1915014u, 61913757u },
+    { 615, 0, 1998864u, 61996686u },
+    { 615, 1, 1296563096u, 61997105u },
+    { 616, 1, 1296673098u, 62107167u },
+    { 616, 0, 2108872u, 62111019u },
+    { 617, 0, 2195436u, 62193510u },
+    { 617, 1, 1296759657u, 62194201u },
+    { 618, 0, 2321520u, 62319576u },
+    { 618, 1, 1296885733u, 62320533u },
+    { 619, 1, 1296947006u, 62381029u },
+    { 619, 0, 2382797u, 62381129u },
+    { 620, 1, 1297082198u, 62516872u },
+    { 620, 0, 2517996u, 62516919u },
+    { 621, 0, 2592832u, 62590696u },
+    { 621, 1, 1297157029u, 62591187u },
+    { 622, 0, 2712882u, 62710947u },
+    { 622, 1, 1297277072u, 62711070u },
+    { 623, 0, 2785500u, 62783489u },
+    { 623, 1, 1297349685u, 62784372u },
+    { 624, 0, 2921748u, 62919464u },
+    { 624, 1, 1297485926u, 62919919u },
+    { 625, 1, 1297582680u, 63017171u },
+    { 625, 0, 3018508u, 63017523u },
+    { 626, 1, 1297651329u, 63084887u },
+    { 626, 0, 3087161u, 63085950u },
+    { 627, 1, 1297785720u, 63220047u },
+    { 627, 0, 3221560u, 63220269u },
+    { 628, 0, 3320793u, 63318854u },
+    { 628, 1, 1297884948u, 63318930u },
+    { 629, 1, 1297984793u, 63419012u },
+    { 629, 0, 3420645u, 63419132u },
+    { 630, 0, 3503559u, 63501686u },
+    { 630, 1, 1298067703u, 63501895u },
+    { 631, 0, 3605836u, 63603914u },
+    { 631, 1, 1298169974u, 63604151u },
+    { 632, 1, 1298280229u, 63713926u },
+    { 632, 0, 3716098u, 63714515u },
+    { 633, 0, 3806672u, 63804767u },
+    { 633, 1, 1298370798u, 63805520u },
+    { 634, 1, 1298484789u, 63918836u },
+    { 634, 0, 3920670u, 63927369u },
+    { 635, 0, 3987423u, 63986020u },
+    { 635, 1, 1298551537u, 63986304u },
+    { 636, 0, 4094857u, 64092552u },
+    { 636, 1, 1298658965u, 64092943u },
+    { 637, 1, 1298784698u, 64219302u },
+    { 637, 0, 4220597u, 64221200u },
+    { 638, 1, 1298886107u, 64320272u },
+    { 638, 0, 4322012u, 64320880u },
+    { 639, 1, 1298961435u, 64394935u },
+    { 639, 0, 4397344u, 64395553u },
+    { 640, 1, 1299078318u, 64512003u },
+    { 640, 0, 4514234u, 64512552u },
+    { 641, 0, 4620554u, 64618795u },
+    { 641, 1, 1299184632u, 64619616u },
+    { 642, 1, 1299263451u, 64696821u },
+    { 642, 0, 4699378u, 64698700u },
+    { 643, 0, 4802553u, 64800526u },
+    { 643, 1, 1299366619u, 64801262u },
+    { 644, 1, 1299479369u, 64912875u },
+    { 644, 0, 4915309u, 64913591u },
+    { 645, 0, 4995976u, 64993713u },
+    { 645, 1, 1299560032u, 64994272u },
+    { 646, 0, 5098436u, 65096570u },
+    { 646, 1, 1299662486u, 65096948u },
+    { 647, 1, 1299780261u, 65214440u },
+    { 647, 0, 5216218u, 65214601u },
+    { 648, 0, 5318715u, 65316598u },
+    { 648, 1, 1299882751u, 65316987u },
+    { 649, 0, 5398907u, 65396862u },
+    { 649, 1, 1299962938u, 65396949u },
+    { 650, 0, 5517043u, 65514568u },
+    { 650, 1, 1300081067u, 65514965u },
+    { 651, 0, 5620563u, 65618694u },
+    { 651, 1, 1300184581u, 65618956u },
+    { 652, 0, 5691884u, 65689821u },
+    { 652, 1, 1300255899u, 65690314u },
+    { 653, 1, 1300355438u, 65789184u },
+    { 653, 0, 5791430u, 65789703u },
+    { 654, 0, 5921758u, 65920173u },
+    { 654, 1, 1300485759u, 65920194u },
+    { 655, 0, 6008532u, 66006595u },
+    { 655, 1, 1300572527u, 66007510u },
+    { 656, 1, 1300686114u, 66119939u },
+    { 656, 0, 6122125u, 66120478u },
+    { 657, 0, 6208317u, 66206518u },
+    { 657, 1, 1300772301u, 66206526u },
+    { 658, 0, 6310296u, 66308519u },
+    { 658, 1, 1300874274u, 66309017u },
+    { 659, 1, 1300968749u, 66402867u },
+    { 659, 0, 6404777u, 66403348u },
+    { 660, 0, 6516733u, 66514842u },
+    { 660, 1, 1301080699u, 66514853u },
+    { 661, 1, 1301183057u, 66617162u },
+    { 661, 0, 6619097u, 66617289u },
+    { 662, 0, 6708780u, 66706537u },
+    { 662, 1, 1301272734u, 66707778u },
+    { 663, 1, 1301359110u, 66793352u },
+    { 663, 0, 6795160u, 66793511u },
+    { 664, 1, 1301476229u, 66909965u },
+    { 664, 0, 6912286u, 66910996u },
+    { 665, 0, 7014754u, 67012601u },
+    { 665, 1, 1301578690u, 67013072u },
+    { 666, 0, 7097534u, 67095659u },
+    { 666, 1, 1301661466u, 67096098u },
+    { 667, 0, 7213910u, 67211686u },
+    { 667, 1, 1301777835u, 67212146u },
+    { 668, 0, 7321524u, 67319774u },
+    { 668, 1, 1301885442u, 67319933u },
+    { 669, 0, 7413596u, 67411905u },
+    { 669, 1, 1301977508u, 67418276u },
+    { 670, 0, 7516831u, 67514932u },
+    { 670, 1, 1302080738u, 67514965u },
+    { 671, 1, 1302176188u, 67610216u },
+    { 671, 0, 7612287u, 67611473u },
+    { 672, 1, 1302268274u, 67701968u },
+    { 672, 0, 7704378u, 67702771u },
+    { 673, 1, 1302350372u, 67783845u },
+    { 673, 0, 7786481u, 67784880u },
+    { 674, 0, 7911134u, 67908590u },
+    { 674, 1, 1302475018u, 67909094u },
+    { 675, 0, 7986115u, 67983561u },
+    { 675, 1, 1302549994u, 67984259u },
+    { 676, 0, 8089993u, 68087779u },
+    { 676, 1, 1302653866u, 68088178u },
+    { 677, 1, 1302786378u, 68220295u },
+    { 677, 0, 8222513u, 68220916u },
+    { 678, 1, 1302872147u, 68305844u },
+    { 678, 0, 8308288u, 68307101u },
+    { 679, 0, 8415666u, 68413745u },
+    { 679, 1, 1302979520u, 68414032u },
+    { 680, 0, 8484093u, 68481665u },
+    { 680, 1, 1303047942u, 68481873u },
+    { 681, 0, 8602817u, 68600780u },
+    { 681, 1, 1303166660u, 68601217u },
+    { 682, 0, 8686061u, 68683841u },
+    { 682, 1, 1303249898u, 68684474u },
+    { 683, 0, 8809894u, 68807523u },
+    { 683, 1, 1303373724u, 68807916u },
+    { 684, 0, 8898911u, 68896775u },
+    { 684, 1, 1303462736u, 68896957u },
+    { 685, 0, 9020872u, 69018742u },
+    { 685, 1, 1303584690u, 69019277u },
+    { 686, 1, 1303671171u, 69105262u },
+    { 686, 0, 9107358u, 69105683u },
+    { 687, 1, 1303775032u, 69208993u },
+    { 687, 0, 9211226u, 69209829u },
+    { 688, 1, 1303868097u, 69302230u },
+    { 688, 0, 9304295u, 69311043u },
+    { 689, 0, 9386073u, 69383504u },
+    { 689, 1, 1303949869u, 69384042u },
+    { 690, 1, 1304052093u, 69485843u },
+    { 690, 0, 9488303u, 69486538u },
+    { 691, 0, 9621722u, 69619604u },
+    { 691, 1, 1304185505u, 69619854u },
+    { 692, 0, 9688606u, 69686636u },
+    { 692, 1, 1304252384u, 69686920u },
+    { 693, 1, 1304386230u, 69820262u },
+    { 693, 0, 9822459u, 69820733u },
+    { 694, 1, 1304469111u, 69902847u },
+    { 694, 0, 9905345u, 69903467u },
+    { 695, 0, 10019651u, 70017525u },
+    { 695, 1, 1304583410u, 70018062u },
+    { 696, 0, 10097099u, 70094629u },
+    { 696, 1, 1304660853u, 70094993u },
+    { 697, 0, 10186156u, 70183483u },
+    { 697, 1, 1304749906u, 70183967u },
+    { 698, 1, 1304880917u, 70314987u },
+    { 698, 0, 10317175u, 70314989u },
+    { 699, 0, 10398863u, 70396645u },
+    { 699, 1, 1304962599u, 70397165u },
+    { 700, 0, 10522885u, 70520659u },
+    { 700, 1, 1305086614u, 70520980u },
+    { 701, 0, 10613145u, 70610474u },
+    { 701, 1, 1305176869u, 70611477u },
+    { 702, 0, 10718001u, 70715656u },
+    { 702, 1, 1305281719u, 70715976u },
+    { 703, 1, 1305368084u, 70801949u },
+    { 703, 0, 10804372u, 70802469u },
+    { 704, 0, 10918036u, 70915572u },
+    { 704, 1, 1305481742u, 70924714u },
+    { 705, 0, 11010154u, 71007637u },
+    { 705, 1, 1305573855u, 71007833u },
+    { 706, 0, 11112981u, 71110732u },
+    { 706, 1, 1305676676u, 71111195u },
+    { 707, 1, 1305773090u, 71207026u },
+    { 707, 0, 11209401u, 71207798u },
+    { 708, 0, 11287130u, 71284711u },
+    { 708, 1, 1305850814u, 71285408u },
+    { 709, 1, 1305982361u, 71417151u },
+    { 709, 0, 11418684u, 71417197u },
+    { 710, 0, 11511702u, 71509487u },
+    { 710, 1, 1306075373u, 71509909u },
+    { 711, 0, 11592365u, 71590602u },
+    { 711, 1, 1306156031u, 71590622u },
+    { 712, 0, 11706374u, 71704572u },
+    { 712, 1, 1306270034u, 71704878u },
+    { 713, 0, 11800317u, 71797743u },
+    { 713, 1, 1306363971u, 71798106u },
+    { 714, 1, 1306478319u, 71911876u },
+    { 714, 0, 11914672u, 71912521u },
+    { 715, 1, 1306555566u, 71989824u },
+    { 715, 0, 11991923u, 71989929u },
+    { 716, 1, 1306656145u, 72090069u },
+    { 716, 0, 12092509u, 72090551u },
+    { 717, 0, 12197409u, 72195484u },
+    { 717, 1, 1306761040u, 72195917u },
+    { 718, 0, 12312202u, 72309577u },
+    { 718, 1, 1306875826u, 72310377u },
+    { 719, 1, 1306946975u, 72381042u },
+    { 719, 0, 12383356u, 72381747u },
+    { 720, 1, 1307074051u, 72507836u },
+    { 720, 0, 12510439u, 72508713u },
+    { 721, 0, 12593972u, 72591652u },
+    { 721, 1, 1307157579u, 72591902u },
+    { 722, 1, 1307266187u, 72700135u },
+    { 722, 0, 12702586u, 72700726u },
+    { 723, 1, 1307362004u, 72796263u },
+    { 723, 0, 12798409u, 72796573u },
+    { 724, 1, 1307482184u, 72915949u },
+    { 724, 0, 12918596u, 72916723u },
+    { 725, 0, 12983966u, 72981591u },
+    { 725, 1, 1307547551u, 72982285u },
+    { 726, 1, 1307654164u, 73087832u },
+    { 726, 0, 13090586u, 73088678u },
+    { 727, 1, 1307771578u, 73205856u },
+    { 727, 0, 13208007u, 73206820u },
+    { 728, 1, 1307877281u, 73310834u },
+    { 728, 0, 13313716u, 73312403u },
+    { 729, 0, 13418387u, 73415512u },
+    { 729, 1, 1307981946u, 73416162u },
+    { 730, 0, 13490072u, 73487766u },
+    { 730, 1, 1308053626u, 73487885u },
+    { 731, 1, 1308184660u, 73618838u },
+    { 731, 0, 13621113u, 73618842u },
+    { 732, 0, 13701838u, 73699667u },
+    { 732, 1, 1308265380u, 73700956u },
+    { 733, 1, 1308351974u, 73785926u },
+    { 733, 0, 13788437u, 73786468u },
+    { 734, 0, 13902401u, 73899637u },
+    { 734, 1, 1308465931u, 73900240u },
+    { 735, 1, 1308568138u, 74001900u },
+    { 735, 0, 14004614u, 74002577u },
+    { 736, 1, 1308662157u, 74096164u },
+    { 736, 0, 14098638u, 74096497u },
+    { 737, 0, 14200893u, 74198748u },
+    { 737, 1, 1308764405u, 74198951u },
+    { 738, 1, 1308853027u, 74287298u },
+    { 738, 0, 14289520u, 74288261u },
+    { 739, 0, 14416136u, 74413481u },
+    { 739, 1, 1308979636u, 74414105u },
+    { 740, 0, 14490704u, 74488574u },
+    { 740, 1, 1309054200u, 74488661u },
+    { 741, 0, 14592028u, 74589570u },
+    { 741, 1, 1309155518u, 74589904u },
+    { 742, 0, 14696446u, 74693558u },
+    { 742, 1, 1309259929u, 74694142u },
+    { 743, 0, 14804280u, 74801676u },
+    { 743, 1, 1309367756u, 74801881u },
+    { 744, 0, 14893350u, 74890591u },
+    { 744, 1, 1309456821u, 74890829u },
+    { 745, 0, 14984546u, 74982549u },
+    { 745, 1, 1309548012u, 74988833u },
+    { 746, 1, 1309653110u, 75087221u },
+    { 746, 0, 15089650u, 75087757u },
+    { 747, 0, 15215434u, 75212651u },
+    { 747, 1, 1309778886u, 75212998u },
+    { 748, 0, 15291944u, 75289650u },
+    { 748, 1, 1309855392u, 75290379u },
+    { 749, 1, 1309981193u, 75414920u },
+    { 749, 0, 15417752u, 75416663u },
+    { 750, 0, 15500475u, 75498072u },
+    { 750, 1, 1310063910u, 75506617u },
+    { 751, 0, 15593159u, 75590554u },
+    { 751, 1, 1310156589u, 75590907u },
+    { 752, 0, 15708704u, 75706484u },
+    { 752, 1, 1310272127u, 75706619u },
+    { 753, 1, 1310365041u, 75799225u },
+    { 753, 0, 15801623u, 75799704u },
+    { 754, 1, 1310479225u, 75913222u },
+    { 754, 0, 15915814u, 75913655u },
+    { 755, 1, 1310576012u, 76010283u },
+    { 755, 0, 16012607u, 76010791u },
+    { 756, 1, 1310676207u, 76109880u },
+    { 756, 0, 16112808u, 76110517u },
+    { 757, 0, 16199354u, 76196591u },
+    { 757, 1, 1310762749u, 76196941u },
+    { 758, 0, 16292281u, 76289665u },
+    { 758, 1, 1310855670u, 76290306u },
+    { 759, 0, 16421375u, 76418511u },
+    { 759, 1, 1310984756u, 76418864u },
+    { 760, 0, 16506248u, 76503748u },
+    { 760, 1, 1311069624u, 76503895u },
+    { 761, 1, 1311157107u, 76591194u },
+    { 761, 0, 16593736u, 76591549u },
+    { 762, 1, 1311269128u, 76703940u },
+    { 762, 0, 16705763u, 76704173u },
+    { 763, 1, 1311386373u, 76820912u },
+    { 763, 0, 16823016u, 76821081u },
+    { 764, 0, 16916046u, 76913568u },
+    { 764, 1, 1311479398u, 76914012u },
+    { 765, 1, 1311580965u, 77014847u },
+    { 765, 0, 17017619u, 77015488u },
+    { 766, 0, 17097246u, 77094929u },
+    { 766, 1, 1311660587u, 77095746u },
+    { 767, 0, 17210194u, 77207598u },
+    { 767, 1, 1311773529u, 77207892u },
+    { 768, 0, 17317928u, 77315620u },
+    { 768, 1, 1311881257u, 77315957u },
+    { 769, 0, 17383469u, 77380877u },
+    { 769, 1, 1311946793u, 77381051u },
+    { 770, 0, 17486331u, 77483600u },
+    { 770, 1, 1312049649u, 77484001u },
+    { 771, 0, 17595113u, 77592729u },
+    { 771, 1, 1312158425u, 77593222u },
+    { 772, 1, 1312265931u, 77700069u },
+    { 772, 0, 17702626u, 77700777u },
+    { 773, 1, 1312377928u, 77812299u },
+    { 773, 0, 17814629u, 77812512u },
+    { 774, 0, 17894740u, 77892863u },
+    { 774, 1, 1312458034u, 77892935u },
+    { 775, 0, 18001563u, 77999116u },
+    { 775, 1, 1312564851u, 77999395u },
+    { 776, 0, 18085157u, 78082983u },
+    { 776, 1, 1312648440u, 78083269u },
+    { 777, 1, 1312772938u, 78207031u },
+    { 777, 0, 18209663u, 78210559u },
+    { 778, 1, 1312865914u, 78299884u },
+    { 778, 0, 18302644u, 78301258u },
+    { 779, 0, 18397133u, 78394790u },
+    { 779, 1, 1312960397u, 78395260u },
+    { 780, 1, 1313073120u, 78507509u },
+    { 780, 0, 18509862u, 78507555u },
+    { 781, 0, 18601882u, 78599753u },
+    { 781, 1, 1313165135u, 78599784u },
+    { 782, 0, 18703518u, 78700644u },
+    { 782, 1, 1313266765u, 78700973u },
+    { 783, 0, 18815261u, 78812992u },
+    { 783, 1, 1313378501u, 78813032u },
+    { 784, 1, 1313448694u, 78882860u },
+    { 784, 0, 18885458u, 78882869u },
+    { 785, 0, 19005230u, 79002828u },
+    { 785, 1, 1313568459u, 79002861u },
+    { 786, 0, 19088399u, 79085577u },
+    { 786, 1, 1313651623u, 79086449u },
+    { 787, 0, 19207545u, 79204561u },
+    { 787, 1, 1313770762u, 79204973u },
+    { 788, 1, 1313859104u, 79292935u },
+    { 788, 0, 19295892u, 79293466u },
+    { 789, 1, 1313977987u, 79412134u },
+    { 789, 0, 19414782u, 79413256u },
+    { 790, 0, 19503616u, 79500777u },
+    { 790, 1, 1314066816u, 79500972u },
+    { 791, 0, 19599018u, 79596630u },
+    { 791, 1, 1314162212u, 79597204u },
+    { 792, 0, 19700132u, 79697540u },
+    { 792, 1, 1314263320u, 79697844u },
+    { 793, 1, 1314368197u, 79801846u },
+    { 793, 0, 19805016u, 79802933u },
+    { 794, 1, 1314463118u, 79897191u },
+    { 794, 0, 19899942u, 79897773u },
+    { 795, 1, 1314549603u, 79983948u },
+    { 795, 0, 19986432u, 79984170u },
+    { 796, 1, 1314672279u, 80106846u },
+    { 796, 0, 20109115u, 80107304u },
+    { 797, 0, 20184556u, 80181478u },
+    { 797, 1, 1314747716u, 80182148u },
+    { 798, 1, 1314853105u, 80286821u },
+    { 798, 0, 20289952u, 80287513u },
+    { 799, 1, 1314972327u, 80407055u },
+    { 799, 0, 20409180u, 80407688u },
+    { 800, 1, 1315083132u, 80517038u },
+    { 800, 0, 20519992u, 80517732u },
+    { 801, 0, 20588623u, 80585595u },
+    { 801, 1, 1315151758u, 80585842u },
+    { 802, 0, 20707456u, 80704762u },
+    { 802, 1, 1315270584u, 80705666u },
+    { 803, 0, 20788116u, 80785554u },
+    { 803, 1, 1315351239u, 80786117u },
+    { 804, 0, 20886279u, 80883807u },
+    { 804, 1, 1315449397u, 80883881u },
+    { 805, 0, 21005546u, 81002869u },
+    { 805, 1, 1315568657u, 81003310u },
+    { 806, 0, 21104093u, 81101677u },
+    { 806, 1, 1315667198u, 81101822u },
+    { 807, 0, 21214290u, 81211538u },
+    { 807, 1, 1315777388u, 81213209u },
+    { 808, 0, 21303210u, 81300527u },
+    { 808, 1, 1315866304u, 81301376u },
+    { 809, 0, 21407023u, 81404577u },
+    { 809, 1, 1315970110u, 81409233u },
+    { 810, 1, 1316067475u, 81501825u },
+    { 810, 0, 21504394u, 81501989u },
+    { 811, 0, 21608571u, 81606065u },
+    { 811, 1, 1316171646u, 81606530u },
+    { 812, 0, 21723352u, 81720775u },
+    { 812, 1, 1316286421u, 81722277u },
+    { 813, 1, 1316346880u, 81780861u },
+    { 813, 0, 21783815u, 81781594u },
+    { 814, 0, 21899512u, 81896470u },
+    { 814, 1, 1316462570u, 81897060u },
+    { 815, 1, 1316553080u, 81986841u },
+    { 815, 0, 21990027u, 81987634u },
+    { 816, 0, 22086716u, 82083595u },
+    { 816, 1, 1316649763u, 82084298u },
+    { 817, 1, 1316748990u, 82183378u },
+    { 817, 0, 22185949u, 82183743u },
+    { 818, 0, 22290332u, 82287725u },
+    { 818, 1, 1316853367u, 82287869u },
+    { 819, 0, 22389456u, 82386515u },
+    { 819, 1, 1316952485u, 82387185u },
+    { 820, 1, 1317075323u, 82509850u },
+    { 820, 0, 22512301u, 82510108u },
+    { 821, 1, 1317181120u, 82614822u },
+    { 821, 0, 22618104u, 82615488u },
+    { 822, 1, 1317272040u, 82705835u },
+    { 822, 0, 22709030u, 82706511u },
+    { 823, 1, 1317346912u, 82781154u },
+    { 823, 0, 22783906u, 82781469u },
+    { 824, 1, 1317473961u, 82907846u },
+    { 824, 0, 22910962u, 82908506u },
+    { 825, 0, 23021239u, 83018792u },
+    { 825, 1, 1317584231u, 83018961u },
+    { 826, 1, 1317683433u, 83118010u },
+    { 826, 0, 23120447u, 83127473u },
+    { 827, 1, 1317761896u, 83195901u },
+    { 827, 0, 23198914u, 83196511u },
+    { 828, 0, 23315700u, 83312823u },
+    { 828, 1, 1317878674u, 83312887u },
+    { 829, 1, 1317952013u, 83386002u },
+    { 829, 0, 23389043u, 83386533u },
+    { 830, 0, 23489853u, 83487716u },
+    { 830, 1, 1318052817u, 83488143u },
+    { 831, 0, 23598712u, 83595729u },
+    { 831, 1, 1318161670u, 83596465u },
+    { 832, 1, 1318260309u, 83694915u },
+    { 832, 0, 23697357u, 83695116u },
+    { 833, 1, 1318356636u, 83790935u },
+    { 833, 0, 23793689u, 83791146u },
+    { 834, 1, 1318472012u, 83906307u },
+    { 834, 0, 23909073u, 83906704u },
+    { 835, 0, 24011788u, 84008488u },
+    { 835, 1, 1318574722u, 84018824u },
+    { 836, 0, 24104597u, 84102032u },
+    { 836, 1, 1318667525u, 84102033u },
+    { 837, 1, 1318751976u, 84186052u },
+    { 837, 0, 24189053u, 84186735u },
+    { 838, 0, 24292618u, 84289633u },
+    { 838, 1, 1318855535u, 84290272u },
+    { 839, 1, 1318965025u, 84399364u },
+    { 839, 0, 24402115u, 84399783u },
+    { 840, 0, 24486010u, 84483467u },
+    { 840, 1, 1319048915u, 84487905u },
+    { 841, 1, 1319162913u, 84597397u },
+    { 841, 0, 24600014u, 84597833u },
+    { 842, 0, 24703380u, 84700492u },
+    { 842, 1, 1319266272u, 84700856u },
+    { 843, 1, 1319376997u, 84811298u },
+    { 843, 0, 24814110u, 84811584u },
+    { 844, 0, 24883839u, 84880581u },
+    { 844, 1, 1319446721u, 84881232u },
+    { 845, 1, 1319547800u, 84981883u },
+    { 845, 0, 24984924u, 84982726u },
+    { 846, 0, 25088673u, 85085569u },
+    { 846, 1, 1319651543u, 85085946u },
+    { 847, 0, 25208755u, 85205606u },
+    { 847, 1, 1319771618u, 85206025u },
+    { 848, 0, 25308358u, 85305517u },
+    { 848, 1, 1319871215u, 85305970u },
+    { 849, 1, 1319981015u, 85415215u },
+    { 849, 0, 25418164u, 85416080u },
+    { 850, 0, 25498683u, 85495796u },
+    { 850, 1, 1320061529u, 85496081u },
+    { 851, 0, 25586105u, 85583520u },
+    { 851, 1, 1320148945u, 85590133u },
+    { 852, 0, 25706867u, 85703634u },
+    { 852, 1, 1320269700u, 85704318u },
+    { 853, 0, 25807420u, 85804462u },
+    { 853, 1, 1320370248u, 85804971u },
+    { 854, 1, 1320459797u, 85893891u },
+    { 854, 0, 25896975u, 85894567u },
+    { 855, 0, 25983840u, 85980802u },
+    { 855, 1, 1320546657u, 85981966u },
+    { 856, 1, 1320679978u, 86114203u },
+    { 856, 0, 26117169u, 86114645u },
+    { 857, 1, 1320777335u, 86212407u },
+    { 857, 0, 26214531u, 86212519u },
+    { 858, 0, 26295702u, 86292715u },
+    { 858, 1, 1320858501u, 86292902u },
+    { 859, 1, 1320960507u, 86394843u },
+    { 859, 0, 26397715u, 86395292u },
+    { 860, 1, 1321071866u, 86506048u },
+    { 860, 0, 26509080u, 86506514u },
+    { 861, 1, 1321153083u, 86586906u },
+    { 861, 0, 26590302u, 86587595u },
+    { 862, 0, 26688198u, 86685597u },
+    { 862, 1, 1321250974u, 86685617u },
+    { 863, 0, 26783849u, 86780881u },
+    { 863, 1, 1321346619u, 86781263u },
+    { 864, 0, 26916525u, 86913692u },
+    { 864, 1, 1321479288u, 86914367u },
+    { 865, 1, 1321575828u, 87010132u },
+    { 865, 0, 27013071u, 87010967u },
+    { 866, 0, 27108935u, 87105499u },
+    { 866, 1, 1321671686u, 87106139u },
+    { 867, 0, 27184727u, 87181790u },
+    { 867, 1, 1321747473u, 87181886u },
+    { 868, 0, 27290507u, 87287554u },
+    { 868, 1, 1321853247u, 87288246u },
+    { 869, 0, 27422739u, 87419914u },
+    { 869, 1, 1321985471u, 87421423u },
+    { 870, 1, 1322069450u, 87503867u },
+    { 870, 0, 27506723u, 87504378u },
+    { 871, 1, 1322163445u, 87598431u },
+    { 871, 0, 27600723u, 87598751u },
+    { 872, 0, 27707791u, 87704843u },
+    { 872, 1, 1322270506u, 87705312u },
+    { 873, 1, 1322361966u, 87795938u },
+    { 873, 0, 27799256u, 87796611u },
+    { 874, 1, 1322476667u, 87910853u },
+    { 874, 0, 27913964u, 87911441u },
+    { 875, 1, 1322556023u, 87989923u },
+    { 875, 0, 27993324u, 87990487u },
+    { 876, 1, 1322678188u, 88112937u },
+    { 876, 0, 28115497u, 88113454u },
+    { 877, 0, 28189206u, 88186529u },
+    { 877, 1, 1322751893u, 88186588u },
+    { 878, 0, 28300779u, 88297766u },
+    { 878, 1, 1322863459u, 88298536u },
+    { 879, 1, 1322953974u, 88387924u },
+    { 879, 0, 28391299u, 88388560u },
+    { 880, 1, 1323071942u, 88505973u },
+    { 880, 0, 28509274u, 88506479u },
+    { 881, 1, 1323153791u, 88587969u },
+    { 881, 0, 28591128u, 88588503u },
+    { 882, 0, 28722747u, 88719703u },
+    { 882, 1, 1323285403u, 88719996u },
+    { 883, 0, 28809757u, 88807019u },
+    { 883, 1, 1323372407u, 88807032u },
+    { 884, 1, 1323446789u, 88881132u },
+    { 884, 0, 28884143u, 88881666u },
+    { 885, 0, 28999466u, 88996523u },
+    { 885, 1, 1323562105u, 88997627u },
+    { 886, 0, 29118621u, 89115842u },
+    { 886, 1, 1323681253u, 89116005u },
+    { 887, 0, 29195271u, 89192730u },
+    { 887, 1, 1323757898u, 89192881u },
+    { 888, 0, 29301890u, 89298591u },
+    { 888, 1, 1323864512u, 89299023u },
+    { 889, 0, 29411456u, 89408705u },
+    { 889, 1, 1323974071u, 89408888u },
+    { 890, 1, 1324079657u, 89513842u },
+    { 890, 0, 29517048u, 89514530u },
+    { 891, 1, 1324149957u, 89583864u },
+    { 891, 0, 29587352u, 89584565u },
+    { 892, 1, 1324259985u, 89694341u },
+    { 892, 0, 29697387u, 89694781u },
+    { 893, 0, 29803950u, 89800465u },
+    { 893, 1, 1324366542u, 89801104u },
+    { 894, 1, 1324449802u, 89884269u },
+    { 894, 0, 29887215u, 89885096u },
+    { 895, 0, 30009740u, 90006782u },
+    { 895, 1, 1324572320u, 90006924u },
+    { 896, 1, 1324684685u, 90118855u },
+    { 896, 0, 30122112u, 90119504u },
+    { 897, 1, 1324755750u, 90189969u },
+    { 897, 0, 30193181u, 90190611u },
+    { 898, 0, 30296682u, 90293507u },
+    { 898, 1, 1324859244u, 90294109u },
+    { 899, 0, 30412478u, 90409541u },
+    { 899, 1, 1324975034u, 90409822u },
+    { 900, 1, 1325048980u, 90482869u },
+    { 900, 0, 30486428u, 90483685u },
+    { 901, 1, 1325162881u, 90596862u },
+    { 901, 0, 30600336u, 90597744u },
+    { 902, 0, 30713825u, 90710615u },
+    { 902, 1, 1325276363u, 90711324u },
+    { 903, 1, 1325366770u, 90801219u },
+    { 903, 0, 30804237u, 90801557u },
+    { 904, 0, 30916702u, 90913626u },
+    { 904, 1, 1325479228u, 90914886u },
+    { 905, 1, 1325571713u, 91006395u },
+    { 905, 0, 31009192u, 91007246u },
+    { 906, 0, 31115011u, 91112118u },
+    { 906, 1, 1325677525u, 91112329u },
+    { 907, 1, 1325774870u, 91208914u },
+    { 907, 0, 31212361u, 91209471u },
+    { 908, 1, 1325878921u, 91312994u },
+    { 908, 0, 31316418u, 91321449u },
+    { 909, 1, 1325974945u, 91408937u },
+    { 909, 0, 31412448u, 91409634u },
+    { 910, 1, 1326082875u, 91517293u },
+    { 910, 0, 31520384u, 91518215u },
+    { 911, 1, 1326155873u, 91589874u },
+    { 911, 0, 31593387u, 91590650u },
+    { 912, 1, 1326260940u, 91695305u },
+    { 912, 0, 31698460u, 91696009u },
+    { 913, 0, 31804764u, 91801488u },
+    { 913, 1, 1326367238u, 91801830u },
+    { 914, 1, 1326477710u, 91911888u },
+    { 914, 0, 31915243u, 91913094u },
+    { 915, 0, 32018803u, 92015465u },
+    { 915, 1, 1326581264u, 92015935u },
+    { 916, 0, 32097810u, 92094507u },
+    { 916, 1, 1326660267u, 92094873u },
+    { 917, 1, 1326749148u, 92183858u },
+    { 917, 0, 32186697u, 92184042u },
+    { 918, 1, 1326856865u, 92290927u },
+    { 918, 0, 32294420u, 92291633u },
+    { 919, 0, 32408850u, 92406005u },
+    { 919, 1, 1326971288u, 92407225u },
+    { 920, 0, 32502151u, 92507060u },
+    { 920, 1, 1327064584u, 92508935u },
+    { 921, 1, 1327182952u, 92616912u },
+    { 921, 0, 32620527u, 92617562u },
+    { 922, 1, 1327281628u, 92716148u },
+    { 922, 0, 32719208u, 92716581u },
+    { 923, 0, 32803123u, 92799693u },
+    { 923, 1, 1327365538u, 92800295u },
+    { 924, 0, 32902184u, 92898658u },
+    { 924, 1, 1327464593u, 92898891u },
+    { 925, 1, 1327574871u, 93008896u },
+    { 925, 0, 33012469u, 93009544u },
+    { 926, 1, 1327667942u, 93102049u },
+    { 926, 0, 33105545u, 93102475u },
+    { 927, 1, 1327759795u, 93194247u },
+    { 927, 0, 33197404u, 93195623u },
+    { 928, 1, 1327875063u, 93310130u },
+    { 928, 0, 33312679u, 93311289u },
+    { 929, 0, 33401804u, 93398724u },
+    { 929, 1, 1327964183u, 93398993u },
+    { 930, 0, 33516876u, 93513700u },
+    { 930, 1, 1328079249u, 93514104u },
+    { 931, 0, 33592063u, 93588514u },
+    { 931, 1, 1328154432u, 93589006u },
+    { 932, 0, 33708791u, 93705658u },
+    { 932, 1, 1328271152u, 93706410u },
+    { 933, 0, 33802938u, 93799532u },
+    { 933, 1, 1328365294u, 93799881u },
+    { 934, 0, 33902884u, 93899612u },
+    { 934, 1, 1328465234u, 93900287u },
+    { 935, 1, 1328575611u, 94010751u },
+    { 935, 0, 34013268u, 94010799u },
+    { 936, 1, 1328685011u, 94120360u },
+    { 936, 0, 34122674u, 94121428u },
+    { 937, 1, 1328747704u, 94182014u },
+    { 937, 0, 34185371u, 94182672u },
+    { 938, 0, 34306658u, 94303568u },
+    { 938, 1, 1328868984u, 94304132u },
+    { 939, 0, 34404772u, 94401516u },
+    { 939, 1, 1328967093u, 94402484u },
+    { 940, 0, 34515164u, 94511571u },
+    { 940, 1, 1329077477u, 94511825u },
+    { 941, 0, 34600876u, 94597549u },
+    { 941, 1, 1329163185u, 94598524u },
+    { 942, 1, 1329277928u, 94712103u },
+    { 942, 0, 34715626u, 94712816u },
+    { 943, 1, 1329360620u, 94794848u },
+    { 943, 0, 34798323u, 94795611u },
+    { 944, 0, 34913531u, 94910799u },
+    { 944, 1, 1329475821u, 94910834u },
+    { 945, 0, 34994138u, 94990517u },
+    { 945, 1, 1329556424u, 94990852u },
+    { 946, 0, 35110706u, 95107808u },
+    { 946, 1, 1329672985u, 95107903u },
+    { 947, 1, 1329773598u, 95208447u },
+    { 947, 0, 35211325u, 95209624u },
+    { 948, 0, 35290245u, 95286598u },
+    { 948, 1, 1329852513u, 95287124u },
+    { 949, 0, 35414787u, 95411570u },
+    { 949, 1, 1329977048u, 95412345u },
+    { 950, 0, 35499047u, 95495585u },
+    { 950, 1, 1330061303u, 95496138u },
+    { 951, 0, 35617249u, 95613686u },
+    { 951, 1, 1330179498u, 95613846u },
+    { 952, 1, 1330285924u, 95719951u },
+    { 952, 0, 35723682u, 95720647u },
+    { 953, 0, 35809287u, 95806078u },
+    { 953, 1, 1330371524u, 95806554u },
+    { 954, 0, 35896708u, 95893726u },
+    { 954, 1, 1330458940u, 95894904u },
+    { 955, 1, 1330560129u, 95995295u },
+    { 955, 0, 35997902u, 96002305u },
+    { 956, 0, 36088173u, 96084480u },
+    { 956, 1, 1330650394u, 96085122u },
+    { 957, 0, 36203294u, 96199770u },
+    { 957, 1, 1330765508u, 96205886u },
+    { 958, 1, 1330868956u, 96303906u },
+    { 958, 0, 36306747u, 96304150u },
+    { 959, 1, 1330981459u, 96415904u },
+    { 959, 0, 36419258u, 96416191u },
+    { 960, 0, 36506033u, 96502734u },
+    { 960, 1, 1331068229u, 96502884u },
+    { 961, 0, 36615202u, 96612152u },
+    { 961, 1, 1331177392u, 96612175u },
+    { 962, 1, 1331253632u, 96688678u },
+    { 962, 0, 36691447u, 96689409u },
+    { 963, 0, 36791791u, 96789076u },
+    { 963, 1, 1331353970u, 96789154u },
+    { 964, 0, 36885830u, 96883140u },
+    { 964, 1, 1331448004u, 96883188u },
+    { 965, 0, 37002028u, 96998698u },
+    { 965, 1, 1331564195u, 96998856u },
+    { 966, 1, 1331672874u, 97106829u },
+    { 966, 0, 37110713u, 97107813u },
+    { 967, 0, 37222921u, 97219636u },
+    { 967, 1, 1331785075u, 97219888u },
+    { 968, 1, 1331850508u, 97284841u },
+    { 968, 0, 37288357u, 97284842u },
+    { 969, 0, 37387091u, 97383477u },
+    { 969, 1, 1331949235u, 97384015u },
+    { 970, 1, 1332060545u, 97494946u },
+    { 970, 0, 37498407u, 97500335u },
+    { 971, 0, 37615865u, 97612530u },
+    { 971, 1, 1332177996u, 97613051u },
+    { 972, 0, 37684896u, 97681635u },
+    { 972, 1, 1332247023u, 97681894u },
+    { 973, 0, 37823230u, 97819568u },
+    { 973, 1, 1332385349u, 97819990u },
+    { 974, 1, 1332480894u, 97915323u },
+    { 974, 0, 37918781u, 97915939u },
+    { 975, 1, 1332549742u, 97984072u },
+    { 975, 0, 37987633u, 97984877u },
+    { 976, 0, 38091121u, 98087656u },
+    { 976, 1, 1332653224u, 98088066u },
+    { 977, 0, 38184198u, 98180542u },
+    { 977, 1, 1332746295u, 98181067u },
+    { 978, 0, 38296798u, 98293621u },
+    { 978, 1, 1332858889u, 98293879u },
+    { 979, 1, 1332947635u, 98382144u },
+    { 979, 0, 38385550u, 98382509u },
+    { 980, 0, 38510131u, 98506618u },
+    { 980, 1, 1333072209u, 98507548u },
+    { 981, 1, 1333148766u, 98583044u },
+    { 981, 0, 38586692u, 98583515u },
+    { 982, 1, 1333284597u, 98719730u },
+    { 982, 0, 38722532u, 98719781u },
+    { 983, 0, 38822862u, 98819488u },
+    { 983, 1, 1333384922u, 98820268u },
+    { 984, 0, 38910157u, 98907089u },
+    { 984, 1, 1333472212u, 98907221u },
+    { 985, 0, 38987133u, 98983461u },
+    { 985, 1, 1333549183u, 98985013u },
+    { 986, 1, 1333661815u, 99095835u },
+    { 986, 0, 39099772u, 99096713u },
+    { 987, 0, 39221322u, 99217851u },
+    { 987, 1, 1333783359u, 99224399u },
+    { 988, 0, 39323924u, 99320774u },
+    { 988, 1, 1333885954u, 99320901u },
+    { 989, 1, 1333986033u, 99421283u },
+    { 989, 0, 39424009u, 99426287u },
+    { 990, 1, 1334082867u, 99517250u },
+    { 990, 0, 39520848u, 99517645u },
+    { 991, 1, 1334152509u, 99586979u },
+    { 991, 0, 39590494u, 99587768u },
+    { 992, 1, 1334257670u, 99692473u },
+    { 992, 0, 39695661u, 99692645u },
+    { 993, 1, 1334348769u, 99783041u },
+    { 993, 0, 39786766u, 99783833u },
+    { 994, 1, 1334465781u, 99900237u },
+    { 994, 0, 39903785u, 99901255u },
+    { 995, 1, 1334552594u, 99987121u },
+    { 995, 0, 39990604u, 99987536u },
+    { 996, 1, 1334679356u, 100113958u },
+    { 996, 0, 40117372u, 100113962u },
+    { 997, 0, 40198882u, 100195508u },
+    { 997, 1, 1334760861u, 100196448u },
+    { 998, 1, 1334885232u, 100320215u },
+    { 998, 0, 40323261u, 100320333u },
+    { 999, 0, 40391062u, 100387587u },
+    { 999, 1, 1334953029u, 100387916u },
+    { 1000, 0, 40520190u, 100516524u },
+    { 1000, 1, 1335082150u, 100516940u },
+    { 1001, 0, 40593078u, 100589497u },
+    { 1001, 1, 1335155033u, 100590088u },
+    { 1002, 0, 40686444u, 100682964u },
+    { 1002, 1, 1335248394u, 100683534u },
+    { 1003, 0, 40787827u, 100785213u },
+    { 1003, 1, 1335349771u, 100793981u },
+    { 1004, 1, 1335476832u, 100911041u },
+    { 1004, 0, 40914896u, 100911515u },
+    { 1005, 1, 1335552494u, 100986894u },
+    { 1005, 0, 40990562u, 100987495u },
+    { 1006, 0, 41116942u, 101113675u },
+    { 1006, 1, 1335678866u, 101113914u },
+    { 1007, 0, 41219169u, 101215559u },
+    { 1007, 1, 1335781087u, 101216178u },
+    { 1008, 0, 41294174u, 101290660u },
+    { 1008, 1, 1335856088u, 101291092u },
+    { 1009, 1, 1335982567u, 101416947u },
+    { 1009, 0, 41420661u, 101417941u },
+    { 1010, 1, 1336084762u, 101519209u },
+    { 1010, 0, 41522861u, 101519470u },
+    { 1011, 1, 1336179534u, 101613980u },
+    { 1011, 0, 41617639u, 101614543u },
+    { 1012, 0, 41704191u, 101700701u },
+    { 1012, 1, 1336266080u, 101701251u },
+    { 1013, 0, 41799552u, 101795664u },
+    { 1013, 1, 1336361436u, 101795919u },
+    { 1014, 0, 41909034u, 101905635u },
+    { 1014, 1, 1336470911u, 101905998u },
+    { 1015, 0, 41998460u, 101994618u },
+    { 1015, 1, 1336560332u, 101995235u },
+    { 1016, 0, 42085278u, 102081647u },
+    { 1016, 1, 1336647145u, 102081878u },
+    { 1017, 0, 42206258u, 102202524u },
+    { 1017, 1, 1336768118u, 102202890u },
+    { 1018, 1, 1336871489u, 102306192u },
+    { 1018, 0, 42309635u, 102306586u },
+    { 1019, 0, 42418514u, 102414779u },
+    { 1019, 1, 1336980362u, 102414878u },
+    { 1020, 0, 42489552u, 102485630u },
+    { 1020, 1, 1337051395u, 102486199u },
+    { 1021, 0, 42594605u, 102590836u },
+    { 1021, 1, 1337156442u, 102590957u },
+    { 1022, 0, 42702447u, 102698501u },
+    { 1022, 1, 1337264277u, 102698876u },
+    { 1023, 0, 42818136u, 102814678u },
+    { 1023, 1, 1337379960u, 102814943u },
+    { 1024, 1, 1337460420u, 102895039u },
+    { 1024, 0, 42898601u, 102895426u },
+    { 1025, 1, 1337578365u, 103012861u },
+    { 1025, 0, 43016553u, 103012953u },
+    { 1026, 0, 43106697u, 103103646u },
+    { 1026, 1, 1337668504u, 103104120u },
+    { 1027, 1, 1337756593u, 103190823u },
+    { 1027, 0, 43194791u, 103191477u },
+    { 1028, 0, 43309005u, 103305647u },
+    { 1028, 1, 1337870800u, 103305995u },
+    { 1029, 1, 1337950751u, 103384880u },
+    { 1029, 0, 43388961u, 103385622u },
+    { 1030, 0, 43492310u, 103488847u },
+    { 1030, 1, 1338054094u, 103489093u },
+    { 1031, 1, 1338152224u, 103586865u },
+    { 1031, 0, 43590446u, 103586886u },
+    { 1032, 0, 43704195u, 103700697u },
+    { 1032, 1, 1338265967u, 103701206u },
+    { 1033, 0, 43793338u, 103789529u },
+    { 1033, 1, 1338355104u, 103790031u },
+    { 1034, 1, 1338455689u, 103890164u },
+    { 1034, 0, 43893928u, 103890725u },
+    { 1035, 0, 44007946u, 104004996u },
+    { 1035, 1, 1338569700u, 104005227u },
+    { 1036, 1, 1338685929u, 104120828u },
+    { 1036, 0, 44124182u, 104121657u },
+    { 1037, 1, 1338783531u, 104218353u },
+    { 1037, 0, 44221790u, 104218768u },
+    { 1038, 1, 1338880484u, 104315016u },
+    { 1038, 0, 44318748u, 104316203u },
+    { 1039, 1, 1338974672u, 104408848u },
+    { 1039, 0, 44412942u, 104409651u },
+    { 1040, 1, 1339073407u, 104508196u },
+    { 1040, 0, 44511683u, 104508335u },
+    { 1041, 1, 1339164728u, 104599086u },
+    { 1041, 0, 44603009u, 104600435u },
+    { 1042, 0, 44720379u, 104716546u },
+    { 1042, 1, 1339282091u, 104716977u },
+    { 1043, 0, 44806074u, 104802578u },
+    { 1043, 1, 1339367781u, 104802845u },
+    { 1044, 0, 44923493u, 104919545u },
+    { 1044, 1, 1339485193u, 104921702u },
+    { 1045, 1, 1339563485u, 104998144u },
+    { 1045, 0, 45001790u, 104998667u },
+    { 1046, 1, 1339679511u, 105114151u },
+    { 1046, 0, 45117823u, 105114882u },
+    { 1047, 0, 45190347u, 105187227u },
+    { 1047, 1, 1339752031u, 105187431u },
+    { 1048, 1, 1339884288u, 105318931u },
+    { 1048, 0, 45322612u, 105319105u },
+    { 1049, 0, 45392573u, 105388561u },
+    { 1049, 1, 1339954245u, 105389838u },
+    { 1050, 1, 1340069562u, 105504337u },
+    { 1050, 0, 45507897u, 105505056u },
+    { 1051, 0, 45611695u, 105607465u },
+    { 1051, 1, 1340173354u, 105608249u },
+    { 1052, 0, 45690313u, 105686743u },
+    { 1052, 1, 1340251967u, 105686863u },
+    { 1053, 1, 1340381479u, 105816098u },
+    { 1053, 0, 45819832u, 105816811u },
+    { 1054, 0, 45887653u, 105883498u },
+    { 1054, 1, 1340449296u, 105883876u },
+    { 1055, 1, 1340568442u, 106003257u },
+    { 1055, 0, 46006806u, 106004114u },
+    { 1056, 1, 1340656721u, 106091374u },
+    { 1056, 0, 46095091u, 106091463u },
+    { 1057, 0, 46193628u, 106189474u },
+    { 1057, 1, 1340755253u, 106190327u },
+    { 1058, 1, 1340879672u, 106314299u },
+    { 1058, 0, 46318054u, 106314649u },
+    { 1059, 0, 46388533u, 106384659u },
+    { 1059, 1, 1340950146u, 106384837u },
+    { 1060, 0, 46506558u, 106502649u },
+    { 1060, 1, 1341068164u, 106502989u },
+    { 1061, 0, 46586152u, 106582581u },
+    { 1061, 1, 1341147753u, 106584185u },
+    { 1062, 0, 46702770u, 106698505u },
+    { 1062, 1, 1341264365u, 106699005u },
+    { 1063, 1, 1341355704u, 106790049u },
+    { 1063, 0, 46794114u, 106790670u },
+    { 1064, 0, 46904432u, 106900875u },
+    { 1064, 1, 1341466015u, 106905384u },
+    { 1065, 1, 1341569414u, 107004161u },
+    { 1065, 0, 47007837u, 107004552u },
+    { 1066, 0, 47096404u, 107092692u },
+    { 1066, 1, 1341657975u, 107093127u },
+    { 1067, 1, 1341766809u, 107201940u },
+    { 1067, 0, 47205244u, 107202498u },
+    { 1068, 1, 1341885467u, 107320407u },
+    { 1068, 0, 47323909u, 107320586u },
+    { 1069, 0, 47390494u, 107386748u },
+    { 1069, 1, 1341952048u, 107386908u },
+    { 1070, 1, 1342065699u, 107499960u },
+    { 1070, 0, 47504151u, 107500991u },
+    { 1071, 1, 1342176486u, 107611548u },
+    { 1071, 0, 47614945u, 107612054u },
+    { 1072, 0, 47722383u, 107718569u },
+    { 1072, 1, 1342283918u, 107718979u },
+    { 1073, 1, 1342374489u, 107809115u },
+    { 1073, 0, 47812960u, 107809879u },
+    { 1074, 1, 1342485507u, 107920244u },
+    { 1074, 0, 47923984u, 107928145u },
+    { 1075, 0, 48014299u, 108010554u },
+    { 1075, 1, 1342575817u, 108011123u },
+    { 1076, 0, 48111749u, 108107685u },
+    { 1076, 1, 1342673261u, 108108090u },
+    { 1077, 0, 48185520u, 108181661u },
+    { 1077, 1, 1342747027u, 108181929u },
+    { 1078, 1, 1342869514u, 108303852u },
+    { 1078, 0, 48308014u, 108304478u },
+    { 1079, 0, 48413658u, 108409556u },
+    { 1079, 1, 1342975152u, 108409905u },
+    { 1080, 1, 1343051525u, 108486191u },
+    { 1080, 0, 48490036u, 108486553u },
+    { 1081, 0, 48596520u, 108592681u },
+    { 1081, 1, 1343158003u, 108592836u },
+    { 1082, 0, 48722235u, 108718521u },
+    { 1082, 1, 1343283710u, 108718550u },
+    { 1083, 0, 48813769u, 108809956u },
+    { 1083, 1, 1343375239u, 108810586u },
+    { 1084, 1, 1343483444u, 108918392u },
+    { 1084, 0, 48921980u, 108924102u },
+    { 1085, 1, 1343546460u, 108980948u },
+    { 1085, 0, 48985000u, 108981655u },
+    { 1086, 0, 49119312u, 109115526u },
+    { 1086, 1, 1343680764u, 109115953u },
+    { 1087, 0, 49188304u, 109184792u },
+    { 1087, 1, 1343749753u, 109185086u },
+    { 1088, 0, 49313613u, 109309510u },
+    { 1088, 1, 1343875053u, 109310221u },
+    { 1089, 0, 49394720u, 109390461u },
+    { 1089, 1, 1343956156u, 109390916u },
+    { 1090, 0, 49519533u, 109515493u },
+    { 1090, 1, 1344080962u, 109515842u },
+    { 1091, 0, 49602703u, 109599044u },
+    { 1091, 1, 1344164127u, 109599867u },
+    { 1092, 1, 1344257396u, 109692171u },
+    { 1092, 0, 49695978u, 109693065u },
+    { 1093, 0, 49804882u, 109800623u },
+    { 1093, 1, 1344366294u, 109801485u },
+    { 1094, 0, 49902468u, 109898763u },
+    { 1094, 1, 1344463874u, 109898948u },
+    { 1095, 1, 1344573379u, 110007850u },
+    { 1095, 0, 50011979u, 110008506u },
+    { 1096, 1, 1344656686u, 110091262u },
+    { 1096, 0, 50095291u, 110091630u },
+    { 1097, 0, 50200703u, 110196747u },
+    { 1097, 1, 1344762092u, 110196830u },
+    { 1098, 0, 50304927u, 110300611u },
+    { 1098, 1, 1344866309u, 110301671u },
+    { 1099, 0, 50414756u, 110410551u },
+    { 1099, 1, 1344976132u, 110411639u },
+    { 1100, 1, 1345052548u, 110487196u },
+    { 1100, 0, 50491177u, 110487617u },
+    { 1101, 1, 1345148080u, 110583229u },
+    { 1101, 0, 50586714u, 110590422u },
+    { 1102, 1, 1345247401u, 110682490u },
+    { 1102, 0, 50686041u, 110683939u },
+    { 1103, 1, 1345347538u, 110782042u },
+    { 1103, 0, 50786184u, 110783389u },
+    { 1104, 0, 50889904u, 110885463u },
+    { 1104, 1, 1345451252u, 110886868u },
+    { 1105, 0, 50996542u, 110992673u },
+    { 1105, 1, 1345557884u, 110992919u },
+    { 1106, 1, 1345683352u, 111118374u },
+    { 1106, 0, 51122018u, 111118591u },
+    { 1107, 1, 1345780292u, 111214834u },
+    { 1107, 0, 51218964u, 111215102u },
+    { 1108, 0, 51303699u, 111299741u },
+    { 1108, 1, 1345865022u, 111299846u },
+    { 1109, 0, 51407532u, 111403510u },
+    { 1109, 1, 1345968849u, 111403863u },
+    { 1110, 1, 1346058018u, 111492921u },
+    { 1110, 0, 51496707u, 111492926u },
+    { 1111, 1, 1346150634u, 111585318u },
+    { 1111, 0, 51589327u, 111585492u },
+    { 1112, 1, 1346268325u, 111702916u },
+    { 1112, 0, 51707025u, 111703744u },
+    { 1113, 0, 51796313u, 111793102u },
+    { 1113, 1, 1346357607u, 111798379u },
+    { 1114, 1, 1346455643u, 111889972u },
+    { 1114, 0, 51894354u, 111890490u },
+    { 1115, 0, 51998935u, 111994771u },
+    { 1115, 1, 1346560217u, 111994837u },
+    { 1116, 0, 52102793u, 112098499u },
+    { 1116, 1, 1346664069u, 112099000u },
+    { 1117, 0, 52219436u, 112215967u },
+    { 1117, 1, 1346780705u, 112216154u },
+    { 1118, 1, 1346855597u, 112290272u },
+    { 1118, 0, 52294332u, 112290605u },
+    { 1119, 0, 52409517u, 112405521u },
+    { 1119, 1, 1346970775u, 112406307u },
+    { 1120, 0, 52502108u, 112498466u },
+    { 1120, 1, 1347063361u, 112498751u },
+    { 1121, 0, 52603770u, 112599461u },
+    { 1121, 1, 1347165017u, 112600165u },
+    { 1122, 0, 52716770u, 112712914u },
+    { 1122, 1, 1347278010u, 112713043u },
+    { 1123, 0, 52812995u, 112808500u },
+    { 1123, 1, 1347374230u, 112808925u },
+    { 1124, 1, 1347454414u, 112888954u },
+    { 1124, 0, 52893184u, 112889652u },
+    { 1125, 1, 1347569429u, 113004160u },
+    { 1125, 0, 53008207u, 113004511u },
+    { 1126, 0, 53090834u, 113086505u },
+    { 1126, 1, 1347652052u, 113093930u },
+    { 1127, 1, 1347757365u, 113191866u },
+    { 1127, 0, 53196154u, 113192558u },
+    { 1128, 0, 53304644u, 113300469u },
+    { 1128, 1, 1347865849u, 113301648u },
+    { 1129, 0, 53412751u, 113408835u },
+    { 1129, 1, 1347973950u, 113408939u },
+    { 1130, 1, 1348053385u, 113488037u },
+    { 1130, 0, 53492190u, 113488547u },
+    { 1131, 1, 1348176014u, 113610851u },
+    { 1131, 0, 53614827u, 113611014u },
+    { 1132, 0, 53707651u, 113703557u },
+    { 1132, 1, 1348268833u, 113703872u },
+    { 1133, 0, 53798996u, 113794751u },
+    { 1133, 1, 1348360172u, 113794963u },
+    { 1134, 0, 53919966u, 113915473u },
+    { 1134, 1, 1348481135u, 113915832u },
+    { 1135, 0, 53988249u, 113984948u },
+    { 1135, 1, 1348549414u, 113988420u },
+    { 1136, 1, 1348671408u, 114106072u },
+    { 1136, 0, 54110250u, 114106747u },
+    { 1137, 1, 1348783563u, 114218115u },
+    { 1137, 0, 54222411u, 114218710u },
+    { 1138, 0, 54285629u, 114281470u },
+    { 1138, 1, 1348846776u, 114282292u },
+    { 1139, 1, 1348985041u, 114419844u },
+    { 1139, 0, 54423902u, 114420118u },
+    { 1140, 0, 54485057u, 114480662u },
+    { 1140, 1, 1349046193u, 114481569u },
+    { 1141, 0, 54616080u, 114611912u },
+    { 1141, 1, 1349177208u, 114612064u },
+    { 1142, 1, 1349252659u, 114687878u },
+    { 1142, 0, 54691535u, 114692831u },
+    { 1143, 1, 1349384462u, 114818879u },
+    { 1143, 0, 54823346u, 114819724u },
+    { 1144, 1, 1349455391u, 114890045u },
+    { 1144, 0, 54894280u, 114890891u },
+    { 1145, 1, 1349556361u, 114991461u },
+    { 1145, 0, 54995255u, 114991635u },
+    { 1146, 0, 55114028u, 115109585u },
+    { 1146, 1, 1349675127u, 115110176u },
+    { 1147, 0, 55203932u, 115199883u },
+    { 1147, 1, 1349765026u, 115200434u },
+    { 1148, 0, 55300029u, 115296002u },
+    { 1148, 1, 1349861117u, 115296166u },
+    { 1149, 0, 55417890u, 115414303u },
+    { 1149, 1, 1349978970u, 115414456u },
+    { 1150, 0, 55484919u, 115480901u },
+    { 1150, 1, 1350045996u, 115481309u },
+    { 1151, 1, 1350177474u, 115611898u },
+    { 1151, 0, 55616405u, 115612502u },
+    { 1152, 1, 1350274529u, 115709148u },
+    { 1152, 0, 55713466u, 115709971u },
+    { 1153, 0, 55808794u, 115804790u },
+    { 1153, 1, 1350369851u, 115805051u },
+    { 1154, 0, 55914704u, 115910476u },
+    { 1154, 1, 1350475755u, 115911173u },
+    { 1155, 0, 56011660u, 116007916u },
+    { 1155, 1, 1350572706u, 116008042u },
+    { 1156, 1, 1350678853u, 116113830u },
+    { 1156, 0, 56117813u, 116113974u },
+    { 1157, 1, 1350776488u, 116210868u },
+    { 1157, 0, 56215454u, 116211721u },
+    { 1158, 1, 1350852359u, 116286994u },
+    { 1158, 0, 56291330u, 116287500u },
+    { 1159, 1, 1350955299u, 116390374u },
+    { 1159, 0, 56394276u, 116390659u },
+    { 1160, 1, 1351076229u, 116511795u },
+    { 1160, 0, 56515213u, 116511854u },
+    { 1161, 0, 56620662u, 116616769u },
+    { 1161, 1, 1351181672u, 116616953u },
+    { 1162, 0, 56686856u, 116682590u },
+    { 1162, 1, 1351247861u, 116683167u },
+    { 1163, 0, 56820199u, 116815672u },
+    { 1163, 1, 1351381197u, 116816397u },
+    { 1164, 0, 56920143u, 116915749u },
+    { 1164, 1, 1351481135u, 116915855u },
+    { 1165, 0, 57009903u, 117005620u },
+    { 1165, 1, 1351570889u, 117006078u },
+    { 1166, 0, 57119656u, 117115617u },
+    { 1166, 1, 1351680636u, 117116144u },
+    { 1167, 1, 1351785482u, 117219888u },
+    { 1167, 0, 57224508u, 117220613u },
+    { 1168, 0, 57314656u, 117310495u },
+    { 1168, 1, 1351875625u, 117311465u },
+    { 1169, 0, 57399107u, 117394635u },
+    { 1169, 1, 1351960071u, 117395505u },
+    { 1170, 1, 1352067318u, 117502043u },
+    { 1170, 0, 57506360u, 117503208u },
+    { 1171, 0, 57600734u, 117596660u },
+    { 1171, 1, 1352161686u, 117596958u },
+    { 1172, 0, 57691922u, 117687725u },
+    { 1172, 1, 1352252868u, 117688211u },
+    { 1173, 0, 57791924u, 117787508u },
+    { 1173, 1, 1352352865u, 117788083u },
+    { 1174, 0, 57885708u, 117881614u },
+    { 1174, 1, 1352446643u, 117881931u },
+    { 1175, 0, 58002021u, 117997646u },
+    { 1175, 1, 1352562949u, 117997825u },
+    { 1176, 1, 1352684516u, 118119236u },
+    { 1176, 0, 58123595u, 118120025u },
+    { 1177, 0, 58215656u, 118211536u },
+    { 1177, 1, 1352776571u, 118212909u },
+    { 1178, 0, 58309197u, 118304551u },
+    { 1178, 1, 1352870107u, 118304985u },
+    { 1179, 0, 58395916u, 118391711u },
+    { 1179, 1, 1352956821u, 118391879u },
+    { 1180, 0, 58518830u, 118514874u },
+    { 1180, 1, 1353079728u, 118514894u },
+    { 1181, 1, 1353155380u, 118589969u },
+    { 1181, 0, 58594487u, 118590521u },
+    { 1182, 1, 1353254283u, 118688901u },
+    { 1182, 0, 58693396u, 118689682u },
+    { 1183, 1, 1353352282u, 118787021u },
+    { 1183, 0, 58791401u, 118787674u },
+    { 1184, 1, 1353464466u, 118899110u },
+    { 1184, 0, 58903591u, 118899899u },
+    { 1185, 0, 58998962u, 118994465u },
+    { 1185, 1, 1353559832u, 118994854u },
+    { 1186, 0, 59088604u, 119084595u },
+    { 1186, 1, 1353649468u, 119084803u },
+    { 1187, 1, 1353785413u, 119220306u },
+    { 1187, 0, 59224557u, 119220473u },
+    { 1188, 0, 59305012u, 119300583u },
+    { 1188, 1, 1353865863u, 119300953u },
+    { 1189, 1, 1353980673u, 119415890u },
+    { 1189, 0, 59419829u, 119416479u },
+    { 1190, 1, 1354085773u, 119520901u },
+    { 1190, 0, 59524935u, 119520901u },
+    { 1191, 0, 59602843u, 119598600u },
+    { 1191, 1, 1354163676u, 119598845u },
+    { 1192, 1, 1354274663u, 119709864u },
+    { 1192, 0, 59713836u, 119710084u },
+    { 1193, 1, 1354366019u, 119800913u },
+    { 1193, 0, 59805197u, 119801318u },
+    { 1194, 1, 1354452376u, 119887139u },
+    { 1194, 0, 59891559u, 119887805u },
+    { 1195, 1, 1354579371u, 120014030u },
+    { 1195, 0, 60018562u, 120014508u },
+};
@@ -255,6 +255,15 @@ HRESULT CCommanDIL_LIN::LIN_SendMsg(DWORD dwClientID, STLIN_MSG& pouFlxTxMsg)
             /* Mark an entry in Map. This is helpful to identify
                which client has been sent this message in later stage */
             vMarkEntryIntoMap(sAckMap);
+
+            /* New response data, a sporadic slot may send it */
+            int nChannel = pouFlxTxMsg.m_ucChannel - 1;
+            if ( pouFlxTxMsg.m_ucMsgTyp == LIN_SLAVE_RESPONSE && nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
+            {
+                EnterCriticalSection(&m_ouCriticalSection);
+                m_aouSchedule[nChannel].vMarkUpdated(pouFlxTxMsg.m_ucMsgID);
+                LeaveCriticalSection(&m_ouCriticalSection);
+            }
         }
         else
         {
@@ -370,6 +379,20 @@ void CCommanDIL_LIN::vWriteIntoClientsBuffer(STLINDATA& sLinData)
     sAckMap.m_unChannel = sLinData.m_uDataInfo.m_sLINMsg.m_ucChannel;;
     sAckMap.m_unMsgID = sLinData.m_uDataInfo.m_sLINMsg.m_ucMsgID;
 
+    //A corrupted response to an event triggered header is a collision
+    if ( sLinData.m_eLinMsgType == LIN_EVENT )
+    {
+        const SERROR_INFO_LIN& sErrInfo = sLinData.m_uDataInfo.m_sErrInfo;
+        int nChannel = sErrInfo.m_ucChannel - 1;
+        if ( (sErrInfo.m_eEventType == EVENT_LIN_COLLISION || sErrInfo.m_eEventType == EVENT_LIN_ERRCRC)
+                && nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
+        {
+            EnterCriticalSection(&m_ouCriticalSection);
+            m_aouSchedule[nChannel].vOnCollision(sErrInfo.m_ucId);
+            LeaveCriticalSection(&m_ouCriticalSection);
+        }
+    }
+
     //Check if it is an acknowledgement message
 
     if ( (sLinData.m_eLinMsgType == LIN_MSG) &&
@@ -579,12 +602,10 @@ HRESULT CCommanDIL_LIN::LIN_RegisterLinScheduleTable(DWORD& dwClientId, int& nCh
     if ( nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
     {
         EnterCriticalSection(&m_ouCriticalSection);
-        nHandle = ++(m_ouScheduleController[nChannel].m_nTotalTables);
-        m_ouScheduleController[nChannel].m_ouScheduleTableList[nHandle] = ouTable;
+        nHandle = m_aouSchedule[nChannel].nAddTable(ouTable);
 
 
         //Register All Commands
-        std::list<CScheduleCommands>::iterator itrCommands = ouTable.m_listCommands.begin();
         STLIN_MSG ouMsg;
         ouMsg.m_ucChannel = nChannel+1;
         ouMsg.m_ucMsgTyp = LIN_MASTER_RESPONSE;
@@ -593,15 +614,27 @@ for(auto itrCommands : ouTable.m_listCommands)
             ouMsg.m_ucMsgID= itrCommands.m_nId;
             ouMsg.m_ucDataLen = m_ucConfiguredMasterDlc[nChannel][itrCommands.m_nId];
             memset(ouMsg.m_ucData, 0xFF, sizeof(ouMsg.m_ucData));
-            if ( ouMsg.m_ucMsgID == 0x3C)
+            if ( ouMsg.m_ucMsgID == defLIN_DIAG_REQUEST_ID)
             {
                 ouMsg.m_ucMsgTyp = LIN_SLAVE_RESPONSE;
                 ouMsg.m_ucDataLen = 8;
-                memcpy(ouMsg.m_ucData, m_ouScheduleController[nChannel].m_ouCurrentCommand.m_listIDs, 8);
+                memcpy(ouMsg.m_ucData, itrCommands.m_listIDs, 8);
                 LIN_Send(ouMsg);
             }
             ouMsg.m_ucMsgTyp = LIN_MASTER_RESPONSE;
             LIN_Send(ouMsg);
+
+            //Frames a sporadic slot may send
+for(auto nFrameId : itrCommands.m_ouFrameIds)
+            {
+                if ( COMMAND_SPORADIC == itrCommands.m_eCommandType && nFrameId >= 0 && nFrameId < 64 )
+                {
+                    ouMsg.m_ucMsgID = nFrameId;
+                    ouMsg.m_ucDataLen = m_ucConfiguredMasterDlc[nChannel][nFrameId];
+                    memset(ouMsg.m_ucData, 0xFF, sizeof(ouMsg.m_ucData));
+                    LIN_Send(ouMsg);
+                }
+            }
         }
         LeaveCriticalSection(&m_ouCriticalSection);
     }
@@ -623,11 +656,7 @@ HRESULT CCommanDIL_LIN::LIN_DeRegisterLinScheduleTabel(DWORD& dwClientId, int& n
     if ( nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
     {
         EnterCriticalSection(&m_ouCriticalSection);
-        std::map<int, CSheduleTable>::iterator itr = m_ouScheduleController[nChannel].m_ouScheduleTableList.find(nTableHandle);
-        if ( itr != m_ouScheduleController[nChannel].m_ouScheduleTableList.end() )
-        {
-            m_ouScheduleController[nChannel].m_ouScheduleTableList.erase(itr);
-        }
+        m_aouSchedule[nChannel].bRemoveTable(nTableHandle);
         LeaveCriticalSection(&m_ouCriticalSection);
     }
     else
@@ -651,27 +680,11 @@ HRESULT CCommanDIL_LIN::LIN_StartLinScheduleTable(DWORD& dwClientId, int& nChann
     if ( nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
     {
         EnterCriticalSection(&m_ouCriticalSection);
-        if ( m_ouScheduleController[nChannel].m_nCurrentHandle == nTableHandle )
-        {
-            hr = S_OK;
-        }
-        else
-        {
-            std::map<int, CSheduleTable>::iterator itr = m_ouScheduleController[nChannel].m_ouScheduleTableList.find(nTableHandle);
-            if ( itr != m_ouScheduleController[nChannel].m_ouScheduleTableList.end() )
-            {
-                std::list<CScheduleCommands>::iterator itrCommand = itr->second.m_listCommands.begin();
-                if ( itrCommand != itr->second.m_listCommands.end() )
-                {
-                    m_ouScheduleController[nChannel].m_ouCurrentCommand = *itrCommand;
-                    m_ouScheduleController[nChannel].m_nCurrentHandle = nTableHandle;
-                    m_ouScheduleController[nChannel].m_nCurrentCommandIndex = 0;
-                    m_ouScheduleController[nChannel].m_nCurrentDelay = static_cast<int>(itrCommand->m_fDelay);
-                }
-            }
-            hr = S_OK;
-        }
+        m_aouSchedule[nChannel].bStartTable(nTableHandle, CLinScheduleEngine::un64GetTimeUs());
         LeaveCriticalSection(&m_ouCriticalSection);
+        //The transmit thread may be waiting for nothing
+        SetEvent(m_ouTransmitThread.m_hActionEvent);
+        hr = S_OK;
     }
     else
     {
@@ -691,11 +704,7 @@ HRESULT CCommanDIL_LIN::LIN_UpdateLinScheduleTable( DWORD& dwClientId, int& nCha
     if ( nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
     {
         EnterCriticalSection(&m_ouCriticalSection);
-        std::map<int, CSheduleTable>::iterator itr = m_ouScheduleController[nChannel].m_ouScheduleTableList.find(nTableHandle);
-        if ( itr != m_ouScheduleController[nChannel].m_ouScheduleTableList.end() )
-        {
-            itr->second = ouTable;
-        }
+        m_aouSchedule[nChannel].bUpdateTable(nTableHandle, ouTable);
         LeaveCriticalSection(&m_ouCriticalSection);
     }
     else
@@ -708,17 +717,12 @@ HRESULT CCommanDIL_LIN::LIN_UpdateLinScheduleTable( DWORD& dwClientId, int& nCha
 
 HRESULT CCommanDIL_LIN::LIN_EnableLinScheuleCommand( DWORD& /*dwClientId*/, int& nChannel, int nTableHandle, int nIndex, bool bEnable )
 {
-    EnterCriticalSection(&m_ouCriticalSection);
-    std::map<int, CSheduleTable>::iterator itrTable = m_ouScheduleController[nChannel].m_ouScheduleTableList.find(nTableHandle);
-    if ( itrTable != m_ouScheduleController[nChannel].m_ouScheduleTableList.end() )
+    if ( nChannel < 0 || nChannel >= CHANNEL_ALLOWED )
     {
-        std::list<CScheduleCommands>::iterator itrCommand = itrTable->second.m_listCommands.begin();
-        advance(itrCommand, nIndex);
-        if ( itrCommand != itrTable->second.m_listCommands.end() )
-        {
-            itrCommand->m_bEnabled = bEnable;
-        }
+        return ERR_INVALID_CHANNEL;
     }
+    EnterCriticalSection(&m_ouCriticalSection);
+    m_aouSchedule[nChannel].bEnableSlot(nTableHandle, nIndex, bEnable);
     LeaveCriticalSection(&m_ouCriticalSection);
     return S_OK;
 }
@@ -734,10 +738,10 @@ HRESULT CCommanDIL_LIN::LIN_RegisterLinHeader( DWORD& dwClientId, int& nChannel,
 
     if ( nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
     {
-        sIdDelay ouidDelay;
-        ouidDelay.m_nActualDelay = ouidDelay.m_nCurrentDelay = nCycleTimer;
-
-        m_ouScheduleController[nChannel].m_ouHeaderCommands[nId] = ouidDelay;
+        EnterCriticalSection(&m_ouCriticalSection);
+        m_aouSchedule[nChannel].vSetHeader(nId, (nCycleTimer > 0) ? (UINT)nCycleTimer : 0, CLinScheduleEngine::un64GetTimeUs());
+        LeaveCriticalSection(&m_ouCriticalSection);
+        SetEvent(m_ouTransmitThread.m_hActionEvent);
     }
     else
     {
@@ -755,11 +759,9 @@ HRESULT CCommanDIL_LIN::LIN_DeRegisterLinHeader( DWORD& dwClientId, int& nChanne
 
     if ( nChannel >= 0 && nChannel < CHANNEL_ALLOWED )
     {
-        std::map<int, sIdDelay>::iterator itr = m_ouScheduleController[nChannel].m_ouHeaderCommands.find(nId);
-        if ( itr!= m_ouScheduleController[nChannel].m_ouHeaderCommands.end() )
-        {
-            m_ouScheduleController[nChannel].m_ouHeaderCommands.erase(itr);
-        }
+        EnterCriticalSection(&m_ouCriticalSection);
+        m_aouSchedule[nChannel].vRemoveHeader(nId);
+        LeaveCriticalSection(&m_ouCriticalSection);
     }
     else
     {
@@ -768,6 +770,18 @@ HRESULT CCommanDIL_LIN::LIN_DeRegisterLinHeader( DWORD& dwClientId, int& nChanne
     return S_OK;
 }
 
+HRESULT CCommanDIL_LIN::LIN_GetScheduleStats(int nChannel, SLIN_SCHEDULE_STATS& sStats)
+{
+    if ( nChannel < 0 || nChannel >= CHANNEL_ALLOWED )
+    {
+        return ERR_INVALID_CHANNEL;
+    }
+    EnterCriticalSection(&m_ouCriticalSection);
+    m_aouSchedule[nChannel].vGetStats(sStats);
+    LeaveCriticalSection(&m_ouCriticalSection);
+    return S_OK;
+}
+
 
 HRESULT CCommanDIL_LIN::LIN_StartHardware(void)
 {
@@ -787,88 +801,73 @@ HRESULT CCommanDIL_LIN::LIN_PreStartHardware(void)
 HRESULT CCommanDIL_LIN::LIN_StopHardware(void)
 {
     m_ouTransmitThread.m_unActionCode = SUSPEND;
+    EnterCriticalSection(&m_ouCriticalSection);
     for ( int nChannel = 0; nChannel < CHANNEL_ALLOWED; nChannel++ )
     {
-        m_ouScheduleController[nChannel].m_nCurrentCommandIndex = -1;
-        m_ouScheduleController[nChannel].m_nCurrentDelay = -1;
-        m_ouScheduleController[nChannel].m_nCurrentHandle = -1;
-        m_ouScheduleController[nChannel].m_nTotalTables = 0;
-        m_ouScheduleController[nChannel].m_ouHeaderCommands.clear();
-        m_ouScheduleController[nChannel].m_ouScheduleTableList.clear();
-        m_ouScheduleController[nChannel].m_ouCurrentCommand.m_bEnabled = false;
-
+        m_aouSchedule[nChannel].vReset();
     }
+    LeaveCriticalSection(&m_ouCriticalSection);
 
     StopHardware();
     return S_OK;
 }
 
-INT CCommanDIL_LIN::nTransmitMessages(int nChannel)
+void CCommanDIL_LIN::vSendScheduleAction(int nChannel, const sLIN_SLOT_ACTION& sAction)
 {
     STLIN_MSG ouMsg;
-    ouMsg.m_ucMsgTyp = LIN_MASTER_RESPONSE;
     ouMsg.m_ucChannel = nChannel+1;
+    ouMsg.m_ucMsgID = static_cast<UCHAR>(sAction.m_nId);
+    ouMsg.m_ucDataLen = m_ucConfiguredMasterDlc[nChannel][ouMsg.m_ucMsgID & 0x3F];
+    memset(ouMsg.m_ucData, 0xFF, sizeof(ouMsg.m_ucData));
 
-    if ( nChannel < 0 || nChannel >= CHANNEL_ALLOWED )
+    //Diag Message
+    if ( true == sAction.m_bDiagRequest )
     {
-        return S_FALSE;
+        ouMsg.m_ucMsgTyp = LIN_SLAVE_RESPONSE;
+        ouMsg.m_ucDataLen = 8;
+        memcpy(ouMsg.m_ucData, sAction.m_aucData, 8);
+        LIN_Send(ouMsg);
     }
-    EnterCriticalSection(&m_ouCriticalSection);
-    //1. SCeduale Table
-    m_ouScheduleController[nChannel].m_nCurrentDelay--;
+    ouMsg.m_ucMsgTyp = LIN_MASTER_RESPONSE;
+    LIN_Send(ouMsg);
+}
 
-    if ( 0 >= m_ouScheduleController[nChannel].m_nCurrentDelay )
+/******************************************************************************
+  Function Name    :  un64TransmitMessages
+  Input(s)         :  -
+  Output           :  Time the next slot or header of any channel is due,
+                      defLIN_SCHEDULE_IDLE if nothing is scheduled
+  Functionality    :  Sends the headers of all slots and headers that are due
+                      on all channels. The lock is not held while sending.
+  Member of        :  CCommanDIL_LIN
+******************************************************************************/
+UINT64 CCommanDIL_LIN::un64TransmitMessages(void)
+{
+    UINT64 un64NextDue = defLIN_SCHEDULE_IDLE;
+    for ( int nChannel = 0; nChannel < CHANNEL_ALLOWED; nChannel++ )
     {
-        //1. Transmit Messages
-        ouMsg.m_ucMsgID= m_ouScheduleController[nChannel].m_ouCurrentCommand.m_nId;
-        if ( m_ouScheduleController[nChannel].m_ouCurrentCommand.m_bEnabled == true)
+        sLIN_SLOT_ACTION sAction;
+        for (;;)
         {
-            ouMsg.m_ucDataLen = m_ucConfiguredMasterDlc[nChannel][ouMsg.m_ucMsgID];
-            memset(ouMsg.m_ucData, 0xFF, sizeof(ouMsg.m_ucData));
-
-            //Diag Message
-            if ( ouMsg.m_ucMsgID == 0x3C )
+            EnterCriticalSection(&m_ouCriticalSection);
+            bool bDue = m_aouSchedule[nChannel].bGetDueAction(CLinScheduleEngine::un64GetTimeUs(), sAction);
+            UINT64 un64Due = m_aouSchedule[nChannel].un64GetNextDue();
+            LeaveCriticalSection(&m_ouCriticalSection);
+            if ( false == bDue )
             {
-                ouMsg.m_ucMsgTyp = LIN_SLAVE_RESPONSE;
-                ouMsg.m_ucDataLen = 8;
-                memcpy(ouMsg.m_ucData, m_ouScheduleController[nChannel].m_ouCurrentCommand.m_listIDs, 8);
-                LIN_Send(ouMsg);
+                if ( un64Due < un64NextDue )
+                {
+                    un64NextDue = un64Due;
+                }
+                break;
             }
-            ouMsg.m_ucMsgTyp = LIN_MASTER_RESPONSE;
-            LIN_Send(ouMsg);
-        }
-        //2. Get Next Message
-        std::map<int, CSheduleTable>::iterator itrTable = m_ouScheduleController[nChannel].m_ouScheduleTableList.find(m_ouScheduleController[nChannel].m_nCurrentHandle);
-        if ( itrTable != m_ouScheduleController[nChannel].m_ouScheduleTableList.end() )
-        {
-            m_ouScheduleController[nChannel].m_nCurrentCommandIndex++;
-            if (m_ouScheduleController[nChannel].m_nCurrentCommandIndex >= itrTable->second.m_listCommands.size() )
+            if ( -1 != sAction.m_nId )
             {
-                m_ouScheduleController[nChannel].m_nCurrentCommandIndex =  0;
+                vSendScheduleAction(nChannel, sAction);
             }
-            std::list<CScheduleCommands>::iterator itrCommand = itrTable->second.m_listCommands.begin();
-            advance(itrCommand, m_ouScheduleController[nChannel].m_nCurrentCommandIndex);
-            m_ouScheduleController[nChannel].m_ouCurrentCommand = *itrCommand;
-            m_ouScheduleController[nChannel].m_nCurrentDelay =  static_cast<int>(itrCommand->m_fDelay);
         }
-
     }
-
-    //For Normal Headers
-    for (std::map<int, sIdDelay>::iterator itr = m_ouScheduleController[nChannel].m_ouHeaderCommands.begin(); itr != m_ouScheduleController[nChannel].m_ouHeaderCommands.end(); itr++ )
-    {
-        itr->second.m_nCurrentDelay--;
-        if ( itr->second.m_nCurrentDelay == 0 )
-        {
-            ouMsg.m_ucMsgID= itr->first;
-            ouMsg.m_ucDataLen = m_ucConfiguredMasterDlc[nChannel][ouMsg.m_ucMsgID];
-            memset(ouMsg.m_ucData, 0xFF, sizeof(ouMsg.m_ucData));
-            itr->second.m_nCurrentDelay = itr->second.m_nActualDelay;
-            LIN_Send(ouMsg);
-        }
-    }
-    LeaveCriticalSection(&m_ouCriticalSection);
-    return S_OK;
+    return un64NextDue;
 }
 
 
@@ -886,17 +885,26 @@ DWORD WINAPI CCommanDIL_LIN::LINTxWndTransmitThread(LPVOID pVoid)
         return (DWORD)-1;
     }
 
+    CLinSlotTimer ouSlotTimer;
+
     bool bLoopON = true;
 
     while (bLoopON)
     {
-        WaitForSingleObject(pThreadParam->m_hActionEvent, 1);
         switch (pThreadParam->m_unActionCode)
         {
             case INVOKE_FUNCTION:
             {
-                //TODO:: Required to loop by number of channels.
-                pouData->nTransmitMessages(0);
+                UINT64 un64DueUs = pouData->un64TransmitMessages();
+                if ( defLIN_SCHEDULE_IDLE == un64DueUs )
+                {
+                    //Starting a table or a header sets the event
+                    WaitForSingleObject(pThreadParam->m_hActionEvent, INFINITE);
+                }
+                else
+                {
+                    ouSlotTimer.vWaitUntil(un64DueUs, pThreadParam->m_hActionEvent);
+                }
             }
             break;
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "BaseDIL_LIN_Controller.h"
 #include "Utility\Utility_Thread.h"
+#include "LinScheduleEngine.h"
 
 #define MAX_CLIENT_ALLOWED 16
 #define MAX_BUFF_ALLOWED    16
@@ -55,23 +56,6 @@ typedef struct tagClientBufMap
 
 typedef std::list<SACK_MAP> CACK_MAP_LIST;
 
-struct sIdDelay
-{
-    int m_nActualDelay;
-    int m_nCurrentDelay;
-};
-
-struct ScheduleController
-{
-    CScheduleCommands m_ouCurrentCommand;
-    int m_nCurrentDelay;
-    int m_nCurrentHandle;
-    int m_nCurrentCommandIndex;
-    int m_nTotalTables;
-    std::map<int, CSheduleTable> m_ouScheduleTableList;
-    std::map<int, sIdDelay> m_ouHeaderCommands;
-};
-
 
 class CCommanDIL_LIN:public CBaseDIL_LIN_Controller
 {
@@ -80,8 +64,8 @@ class CCommanDIL_LIN:public CBaseDIL_LIN_Controller
     //static CACK_MAP_LIST m_asAckMapBuf;
 
     CPARAM_THREADPROC m_ouTransmitThread;
-    ScheduleController m_ouScheduleController[CHANNEL_ALLOWED];
-    CRITICAL_SECTION m_ouCriticalSection;
+    CLinScheduleEngine m_aouSchedule[CHANNEL_ALLOWED];
+    CRITICAL_SECTION m_ouCriticalSection;   //Guards m_aouSchedule
     IBMNetWorkGetService* m_pBMNetwork;
 
 
@@ -144,6 +128,8 @@ public:
     virtual HRESULT LIN_RegisterLinHeader( DWORD& dwClientId, int& nChannel, int nId, int nCycleTimer );
     virtual HRESULT LIN_DeRegisterLinHeader( DWORD& dwClientId, int& nChannel, int nId);
 
+    virtual HRESULT LIN_GetScheduleStats(int nChannel, SLIN_SCHEDULE_STATS& sStats);
+
 
 protected:
     void vWriteIntoClientsBuffer(STLINDATA& sLinData);
@@ -171,7 +157,8 @@ public:
 private:
     CACK_MAP_LIST   sg_asAckMapBuf;
     static DWORD WINAPI LINTxWndTransmitThread(LPVOID pVoid);
-    INT nTransmitMessages(int nChannel);
+    UINT64 un64TransmitMessages(void);
+    void vSendScheduleAction(int nChannel, const sLIN_SLOT_ACTION& sAction);
 
 protected:
     std::map< SLOT, std::list<int> > m_mapSlotClient;
@@ -0,0 +1,495 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LinScheduleEngine.cpp
+ * \brief     Source file for CLinScheduleEngine class
+ *
+ * Source file for CLinScheduleEngine class
+ */
+
+#include "DIL_Interface_stdafx.h"
+#include <mmsystem.h>
+#include "LinScheduleEngine.h"
+
+//Not in the SDK of Visual Studio 2013, Windows 10 1803 and later know it
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION   0x00000002
+#endif
+
+CLinScheduleEngine::CLinScheduleEngine(void)
+{
+    vReset();
+}
+
+void CLinScheduleEngine::vReset(void)
+{
+    m_ouTables.clear();
+    m_ouHeaders.clear();
+    m_ouUpdated.clear();
+    m_nLastHandle = 0;
+    vStop();
+
+    SLIN_SCHEDULE_STATS sEmpty = {0};
+    m_sStats = sEmpty;
+    m_un64ErrorSumUs = 0;
+}
+
+void CLinScheduleEngine::vStop(void)
+{
+    m_nCurrent = -1;
+    m_nSlot = 0;
+    m_un64SlotDueUs = defLIN_SCHEDULE_IDLE;
+    m_nPending = -1;
+    m_nPendingSlot = 0;
+    m_nResume = -1;
+    m_nResumeSlot = 0;
+    m_nEventId = -1;
+    m_nEventTable = -1;
+}
+
+int CLinScheduleEngine::nAddTable(const CSheduleTable& ouTable)
+{
+    int nHandle = ++m_nLastHandle;
+    sTABLE& sTable = m_ouTables[nHandle];
+    sTable.m_ouSource = ouTable;
+    vCompile(sTable);
+    return nHandle;
+}
+
+bool CLinScheduleEngine::bRemoveTable(int nHandle)
+{
+    std::map<int, sTABLE>::iterator itrTable = m_ouTables.find(nHandle);
+    if (m_ouTables.end() == itrTable)
+    {
+        return false;
+    }
+    m_ouTables.erase(itrTable);
+    if (m_nCurrent == nHandle)
+    {
+        vStop();
+    }
+    if (m_nPending == nHandle)
+    {
+        m_nPending = -1;
+    }
+    if (m_nResume == nHandle)
+    {
+        m_nResume = -1;
+    }
+    if (m_nEventTable == nHandle)
+    {
+        m_nEventId = -1;
+        m_nEventTable = -1;
+    }
+    return true;
+}
+
+bool CLinScheduleEngine::bUpdateTable(int nHandle, const CSheduleTable& ouTable)
+{
+    std::map<int, sTABLE>::iterator itrTable = m_ouTables.find(nHandle);
+    if (m_ouTables.end() == itrTable)
+    {
+        return false;
+    }
+    itrTable->second.m_ouSource = ouTable;
+    vCompile(itrTable->second);
+
+    size_t nSlots = itrTable->second.m_asSlots.size();
+    if (m_nCurrent == nHandle)
+    {
+        if (0 == nSlots)
+        {
+            vStop();
+        }
+        else if (m_nSlot >= nSlots)
+        {
+            m_nSlot = 0;
+        }
+    }
+    if (m_nResume == nHandle && m_nResumeSlot >= nSlots)
+    {
+        m_nResumeSlot = 0;
+    }
+    return true;
+}
+
+bool CLinScheduleEngine::bEnableSlot(int nHandle, int nIndex, bool bEnable)
+{
+    std::map<int, sTABLE>::iterator itrTable = m_ouTables.find(nHandle);
+    if (m_ouTables.end() == itrTable || nIndex < 0 || (size_t)nIndex >= itrTable->second.m_asSlots.size())
+    {
+        return false;
+    }
+    std::list<CScheduleCommands>::iterator itrCommand = itrTable->second.m_ouSource.m_listCommands.begin();
+    advance(itrCommand, nIndex);
+    itrCommand->m_bEnabled = bEnable;
+    itrTable->second.m_asSlots[nIndex].m_ouCommand.m_bEnabled = bEnable;
+    return true;
+}
+
+bool CLinScheduleEngine::bStartTable(int nHandle, UINT64 un64NowUs)
+{
+    std::map<int, sTABLE>::iterator itrTable = m_ouTables.find(nHandle);
+    if (m_ouTables.end() == itrTable || itrTable->second.m_asSlots.empty())
+    {
+        return false;
+    }
+    m_nResume = -1;
+    if (-1 == m_nCurrent)
+    {
+        m_nCurrent = nHandle;
+        m_nSlot = 0;
+        m_un64SlotDueUs = un64NowUs;
+        m_sStats.m_unTableSwitches++;
+    }
+    else if (m_nCurrent == nHandle)
+    {
+        m_nPending = -1;
+    }
+    else
+    {
+        m_nPending = nHandle;
+        m_nPendingSlot = 0;
+    }
+    return true;
+}
+
+void CLinScheduleEngine::vSetHeader(int nId, UINT unCycleMs, UINT64 un64NowUs)
+{
+    if (0 == unCycleMs)
+    {
+        vRemoveHeader(nId);
+        return;
+    }
+    sHEADER& sHeader = m_ouHeaders[nId];
+    sHeader.m_un64CycleUs = (UINT64)unCycleMs * 1000;
+    sHeader.m_un64DueUs = un64NowUs + sHeader.m_un64CycleUs;
+}
+
+void CLinScheduleEngine::vRemoveHeader(int nId)
+{
+    m_ouHeaders.erase(nId);
+}
+
+void CLinScheduleEngine::vMarkUpdated(int nId)
+{
+    m_ouUpdated.insert(nId);
+}
+
+void CLinScheduleEngine::vOnCollision(int nId)
+{
+    if (nId != m_nEventId || -1 == m_nEventTable || -1 == m_nCurrent || -1 != m_nResume)
+    {
+        return;
+    }
+    std::map<int, sTABLE>::iterator itrTable = m_ouTables.find(m_nEventTable);
+    if (m_ouTables.end() == itrTable || itrTable->second.m_asSlots.empty() || m_nEventTable == m_nCurrent)
+    {
+        return;
+    }
+    m_nResume = m_nCurrent;
+    m_nResumeSlot = m_nSlot;
+    m_nPending = m_nEventTable;
+    m_nPendingSlot = 0;
+    m_nEventId = -1;
+    m_sStats.m_unCollisions++;
+}
+
+UINT64 CLinScheduleEngine::un64GetNextDue(void) const
+{
+    UINT64 un64Due = (-1 != m_nCurrent) ? m_un64SlotDueUs : defLIN_SCHEDULE_IDLE;
+    for (std::map<int, sHEADER>::const_iterator itr = m_ouHeaders.begin(); itr != m_ouHeaders.end(); ++itr)
+    {
+        if (itr->second.m_un64DueUs < un64Due)
+        {
+            un64Due = itr->second.m_un64DueUs;
+        }
+    }
+    return un64Due;
+}
+
+bool CLinScheduleEngine::bGetDueAction(UINT64 un64NowUs, sLIN_SLOT_ACTION& sAction)
+{
+    std::map<int, sHEADER>::iterator itrHeader = m_ouHeaders.end();
+    for (std::map<int, sHEADER>::iterator itr = m_ouHeaders.begin(); itr != m_ouHeaders.end(); ++itr)
+    {
+        if (m_ouHeaders.end() == itrHeader || itr->second.m_un64DueUs < itrHeader->second.m_un64DueUs)
+        {
+            itrHeader = itr;
+        }
+    }
+    bool bSlotDue = (-1 != m_nCurrent) && (m_un64SlotDueUs <= un64NowUs);
+    bool bHeaderDue = (m_ouHeaders.end() != itrHeader) && (itrHeader->second.m_un64DueUs <= un64NowUs);
+
+    if (bSlotDue && (!bHeaderDue || m_un64SlotDueUs <= itrHeader->second.m_un64DueUs))
+    {
+        vTakeSlot(un64NowUs, sAction);
+        return true;
+    }
+    if (bHeaderDue)
+    {
+        sHEADER& sHeader = itrHeader->second;
+        sAction.m_nId = itrHeader->first;
+        sAction.m_bDiagRequest = false;
+        sHeader.m_un64DueUs += sHeader.m_un64CycleUs;
+        if (sHeader.m_un64DueUs <= un64NowUs)
+        {
+            //Missed cycles are not caught up
+            sHeader.m_un64DueUs = un64NowUs + sHeader.m_un64CycleUs;
+        }
+        return true;
+    }
+    return false;
+}
+
+/******************************************************************************
+  Function Name    :  vTakeSlot
+  Input(s)         :  un64NowUs - Current time
+                      sAction - What to send for the slot
+  Output           :  -
+  Functionality    :  Executes the due slot of the running table, after
+                      switching to a pending table, and moves on to the next
+                      slot. A slot whose time is already over stays silent.
+  Member of        :  CLinScheduleEngine
+******************************************************************************/
+void CLinScheduleEngine::vTakeSlot(UINT64 un64NowUs, sLIN_SLOT_ACTION& sAction)
+{
+    if (-1 != m_nPending)
+    {
+        m_nCurrent = m_nPending;
+        m_nSlot = m_nPendingSlot;
+        m_nPending = -1;
+        m_sStats.m_unTableSwitches++;
+    }
+    sTABLE& sTable = m_ouTables[m_nCurrent];
+    const sSLOT& sSlot = sTable.m_asSlots[m_nSlot];
+    const CScheduleCommands& ouCommand = sSlot.m_ouCommand;
+
+    sAction.m_nId = -1;
+    sAction.m_bDiagRequest = false;
+    UINT64 un64ErrorUs = un64NowUs - m_un64SlotDueUs;
+    m_sStats.m_un64Slots++;
+    if (un64ErrorUs >= sSlot.m_unLengthUs)
+    {
+        m_sStats.m_un64SkippedSlots++;
+    }
+    else
+    {
+        m_sStats.m_unLastErrorUs = (UINT)un64ErrorUs;
+        if (m_sStats.m_unLastErrorUs > m_sStats.m_unMaxErrorUs)
+        {
+            m_sStats.m_unMaxErrorUs = m_sStats.m_unLastErrorUs;
+        }
+        if (un64ErrorUs > defLIN_SLOT_LATE_US)
+        {
+            m_sStats.m_un64LateSlots++;
+        }
+        m_un64ErrorSumUs += un64ErrorUs;
+        UINT64 un64Started = m_sStats.m_un64Slots - m_sStats.m_un64SkippedSlots;
+        m_sStats.m_unMeanErrorUs = (UINT)(m_un64ErrorSumUs / un64Started);
+
+        if (true == ouCommand.m_bEnabled)
+        {
+            switch (ouCommand.m_eCommandType)
+            {
+                case COMMAND_SPORADIC:
+                {
+                    for (std::list<int>::const_iterator itrId = ouCommand.m_ouFrameIds.begin(); itrId != ouCommand.m_ouFrameIds.end(); ++itrId)
+                    {
+                        std::set<int>::iterator itrUpdated = m_ouUpdated.find(*itrId);
+                        if (m_ouUpdated.end() != itrUpdated)
+                        {
+                            sAction.m_nId = *itrId;
+                            m_ouUpdated.erase(itrUpdated);
+                            break;
+                        }
+                    }
+                }
+                break;
+
+                case COMMAND_EVENT:
+                {
+                    sAction.m_nId = ouCommand.m_nId;
+                    m_nEventId = ouCommand.m_nId;
+                    m_nEventTable = nFindTable(ouCommand.m_strCollisionTable);
+                }
+                break;
+
+                default:
+                {
+                    sAction.m_nId = ouCommand.m_nId;
+                    if (defLIN_DIAG_REQUEST_ID == ouCommand.m_nId)
+                    {
+                        sAction.m_bDiagRequest = true;
+                        memcpy(sAction.m_aucData, ouCommand.m_listIDs, sizeof(sAction.m_aucData));
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    m_un64SlotDueUs += sSlot.m_unLengthUs;
+    if (++m_nSlot >= sTable.m_asSlots.size())
+    {
+        m_nSlot = 0;
+        //A collision resolving table runs once
+        if (-1 != m_nResume && -1 == m_nPending)
+        {
+            m_nPending = m_nResume;
+            m_nPendingSlot = m_nResumeSlot;
+            m_nResume = -1;
+        }
+    }
+}
+
+void CLinScheduleEngine::vGetStats(SLIN_SCHEDULE_STATS& sStats) const
+{
+    sStats = m_sStats;
+    sStats.m_nCurrentTable = m_nCurrent;
+}
+
+UINT64 CLinScheduleEngine::un64GetTimeUs(void)
+{
+    static LONGLONG s_n64Frequency = 0;
+    if (0 == s_n64Frequency)
+    {
+        LARGE_INTEGER lnFrequency;
+        QueryPerformanceFrequency(&lnFrequency);
+        s_n64Frequency = lnFrequency.QuadPart;
+    }
+    LARGE_INTEGER lnCounter;
+    QueryPerformanceCounter(&lnCounter);
+    UINT64 un64Counter = (UINT64)lnCounter.QuadPart;
+    UINT64 un64Frequency = (UINT64)s_n64Frequency;
+    return (un64Counter / un64Frequency) * 1000000 + ((un64Counter % un64Frequency) * 1000000) / un64Frequency;
+}
+
+void CLinScheduleEngine::vCompile(sTABLE& sTable) const
+{
+    sTable.m_asSlots.clear();
+    sTable.m_un64CycleUs = 0;
+    for (std::list<CScheduleCommands>::const_iterator itrCommand = sTable.m_ouSource.m_listCommands.begin();
+            itrCommand != sTable.m_ouSource.m_listCommands.end(); ++itrCommand)
+    {
+        sSLOT sSlot;
+        sSlot.m_un64OffsetUs = sTable.m_un64CycleUs;
+        double dLengthUs = itrCommand->m_fDelay * 1000.0 + 0.5;
+        sSlot.m_unLengthUs = (dLengthUs < defLIN_MIN_SLOT_US) ? defLIN_MIN_SLOT_US : (UINT)dLengthUs;
+        sSlot.m_ouCommand = *itrCommand;
+        sTable.m_un64CycleUs += sSlot.m_unLengthUs;
+        sTable.m_asSlots.push_back(sSlot);
+    }
+}
+
+int CLinScheduleEngine::nFindTable(const std::string& strName) const
+{
+    if (strName.empty())
+    {
+        return -1;
+    }
+    for (std::map<int, sTABLE>::const_iterator itr = m_ouTables.begin(); itr != m_ouTables.end(); ++itr)
+    {
+        if (itr->second.m_ouSource.m_strTableName == strName)
+        {
+            return itr->first;
+        }
+    }
+    return -1;
+}
+
+CLinSlotTimer::CLinSlotTimer(void)
+{
+    m_hTimer = CreateWaitableTimerEx(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    m_bHighResolution = (NULL != m_hTimer);
+    if (false == m_bHighResolution)
+    {
+        m_hTimer = CreateWaitableTimer(NULL, FALSE, NULL);
+        timeBeginPeriod(1);
+    }
+    m_unSpinUs = m_bHighResolution ? defLIN_TX_SPIN_US : 0;
+}
+
+CLinSlotTimer::~CLinSlotTimer(void)
+{
+    if (false == m_bHighResolution)
+    {
+        timeEndPeriod(1);
+    }
+    if (NULL != m_hTimer)
+    {
+        CancelWaitableTimer(m_hTimer);
+        CloseHandle(m_hTimer);
+    }
+}
+
+void CLinSlotTimer::vSetSpinUs(UINT unSpinUs)
+{
+    m_unSpinUs = unSpinUs;
+}
+
+UINT CLinSlotTimer::unGetSpinUs(void) const
+{
+    return m_unSpinUs;
+}
+
+bool CLinSlotTimer::bIsHighResolution(void) const
+{
+    return m_bHighResolution;
+}
+
+/******************************************************************************
+  Function Name    :  vWaitUntil
+  Input(s)         :  un64DueUs - Time of the performance counter to wake at
+                      hEvent - Event that ends the wait early, may be NULL
+  Output           :  -
+  Functionality    :  Sleeps on the timer until the spin time before
+                      un64DueUs. Within the spin time it spins to the due
+                      time.
+  Member of        :  CLinSlotTimer
+******************************************************************************/
+void CLinSlotTimer::vWaitUntil(UINT64 un64DueUs, HANDLE hEvent)
+{
+    UINT64 un64NowUs = CLinScheduleEngine::un64GetTimeUs();
+    if (un64DueUs > un64NowUs + m_unSpinUs)
+    {
+        UINT64 un64SleepUs = un64DueUs - un64NowUs - m_unSpinUs;
+        if (NULL != m_hTimer)
+        {
+            LARGE_INTEGER lnDueTime;
+            lnDueTime.QuadPart = -(LONGLONG)(un64SleepUs * 10);
+            SetWaitableTimer(m_hTimer, &lnDueTime, 0, NULL, NULL, FALSE);
+            HANDLE ahWait[2] = { m_hTimer, hEvent };
+            if (WAIT_OBJECT_0 != WaitForMultipleObjects((NULL == hEvent) ? 1 : 2, ahWait, FALSE, INFINITE))
+            {
+                CancelWaitableTimer(m_hTimer);
+            }
+        }
+        else if (NULL != hEvent)
+        {
+            WaitForSingleObject(hEvent, (DWORD)(un64SleepUs / 1000));
+        }
+        else
+        {
+            Sleep((DWORD)(un64SleepUs / 1000));
+        }
+        return;
+    }
+    while (CLinScheduleEngine::un64GetTimeUs() < un64DueUs)
+    {
+        YieldProcessor();
+    }
+}
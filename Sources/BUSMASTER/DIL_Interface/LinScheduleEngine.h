@@ -0,0 +1,171 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LinScheduleEngine.h
+ * \brief     Interface file for CLinScheduleEngine class
+ *
+ * Interface file for CLinScheduleEngine class
+ */
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <vector>
+#include "BaseDIL_LIN_Controller.h"
+
+#define defLIN_SCHEDULE_IDLE        _UI64_MAX   // Nothing is due
+#define defLIN_MIN_SLOT_US          1000        // Shortest slot, a slot of 0 ms would never end
+#define defLIN_DIAG_REQUEST_ID      0x3C
+#define defLIN_TX_SPIN_US           20          // Spin before a due slot on a high resolution timer
+
+/* What has to go on the bus for one due slot or header */
+struct sLIN_SLOT_ACTION
+{
+    int m_nId;                      // Header to send, -1 for a silent slot
+    bool m_bDiagRequest;            // Set m_aucData as master request response first
+    unsigned char m_aucData[8];
+};
+
+/**
+ * Master schedule of one LIN channel.
+ *
+ * Every table is compiled into a timeline of slots with their offset from
+ * the start of the table and their length in microseconds. The running
+ * table keeps the absolute due time of its next slot, which advances by the
+ * slot lengths and not by the time the owner woke up, so late wakeups do
+ * not add up. A header goes out at the start of its slot.
+ *
+ * - Unconditional and diagnostic slots send their header; a master request
+ *   slot sets its data bytes as response first.
+ * - A sporadic slot sends the first associated frame the master updated
+ *   since it was last sent, otherwise it stays silent.
+ * - An event triggered slot sends its header. If its response collides the
+ *   collision resolving table runs once, from the next slot boundary on, and
+ *   the interrupted table continues after the event triggered slot.
+ * - A newly started table takes over at the next slot boundary.
+ *
+ * The engine is not thread safe and does not send anything itself: the
+ * owner asks for the due actions under its own lock and sends them.
+ */
+class CLinScheduleEngine
+{
+public:
+    CLinScheduleEngine(void);
+
+    //Drops all tables, headers and counters
+    void vReset(void);
+
+    //Returns the handle of the new table
+    int nAddTable(const CSheduleTable& ouTable);
+    bool bRemoveTable(int nHandle);
+    bool bUpdateTable(int nHandle, const CSheduleTable& ouTable);
+    bool bEnableSlot(int nHandle, int nIndex, bool bEnable);
+    //Runs the table from the next slot boundary on, at once if no table runs
+    bool bStartTable(int nHandle, UINT64 un64NowUs);
+
+    //Header sent every unCycleMs outside of the tables, 0 removes it
+    void vSetHeader(int nId, UINT unCycleMs, UINT64 un64NowUs);
+    void vRemoveHeader(int nId);
+
+    //The master has new data for frame nId, used by sporadic slots
+    void vMarkUpdated(int nId);
+    //The response to header nId was corrupted, used by event triggered slots
+    void vOnCollision(int nId);
+
+    //Time the next slot or header is due, defLIN_SCHEDULE_IDLE if none
+    UINT64 un64GetNextDue(void) const;
+    //Takes the earliest slot or header due at un64NowUs, false if none is due
+    bool bGetDueAction(UINT64 un64NowUs, sLIN_SLOT_ACTION& sAction);
+
+    void vGetStats(SLIN_SCHEDULE_STATS& sStats) const;
+
+    //Microseconds of the performance counter
+    static UINT64 un64GetTimeUs(void);
+
+private:
+    struct sSLOT
+    {
+        UINT64 m_un64OffsetUs;      // Start within the table
+        UINT m_unLengthUs;
+        CScheduleCommands m_ouCommand;
+    };
+    struct sTABLE
+    {
+        CSheduleTable m_ouSource;
+        std::vector<sSLOT> m_asSlots;
+        UINT64 m_un64CycleUs;
+    };
+    struct sHEADER
+    {
+        UINT64 m_un64DueUs;
+        UINT64 m_un64CycleUs;
+    };
+
+    void vCompile(sTABLE& sTable) const;
+    int nFindTable(const std::string& strName) const;
+    void vTakeSlot(UINT64 un64NowUs, sLIN_SLOT_ACTION& sAction);
+    void vStop(void);
+
+    std::map<int, sTABLE> m_ouTables;
+    int m_nLastHandle;
+
+    int m_nCurrent;                 // Running table, -1 if none
+    size_t m_nSlot;                 // Next slot of the running table
+    UINT64 m_un64SlotDueUs;         // Due time of that slot
+    int m_nPending;                 // Table to take over at the next slot boundary
+    size_t m_nPendingSlot;
+
+    int m_nResume;                  // Table interrupted by a collision resolving table
+    size_t m_nResumeSlot;
+    int m_nEventId;                 // Header of the last event triggered slot, -1 if none
+    int m_nEventTable;              // Its collision resolving table
+
+    std::map<int, sHEADER> m_ouHeaders;
+    std::set<int> m_ouUpdated;
+
+    SLIN_SCHEDULE_STATS m_sStats;
+    UINT64 m_un64ErrorSumUs;
+};
+
+/**
+ * Sleeps until the due time of a slot.
+ *
+ * Uses a high resolution waitable timer where Windows offers one and spins
+ * only the last few microseconds. Without it the plain waitable timer runs
+ * with a 1 ms timer period and nothing is spun by default, a slot then
+ * starts up to a tick late instead of a core being kept busy.
+ */
+class CLinSlotTimer
+{
+public:
+    CLinSlotTimer(void);
+    ~CLinSlotTimer(void);
+
+    //Microseconds spun before a due time instead of sleeping
+    void vSetSpinUs(UINT unSpinUs);
+    UINT unGetSpinUs(void) const;
+    bool bIsHighResolution(void) const;
+
+    //Returns at un64DueUs, or earlier if hEvent is set; hEvent may be NULL.
+    //The caller checks the time again, a wakeup before the spin is not an error.
+    void vWaitUntil(UINT64 un64DueUs, HANDLE hEvent);
+
+private:
+    HANDLE m_hTimer;
+    bool m_bHighResolution;
+    UINT m_unSpinUs;
+};
@@ -21,6 +21,8 @@
 
 #define defNameSpace               "namespace"
 
+#define defNS_ELEMENTS_PER_UNIT    64      // Pdus or frames defined in one compiled unit
+
 NodeSimCodeGenerator::NodeSimCodeGenerator()
 {
 
@@ -38,7 +40,7 @@ std::string NodeSimCodeGenerator::AddDoubleQuotes(std::string strTarget)
     return ( strQuotes + strTarget + strQuotes);
 }
 
-ERRORCODE NodeSimCodeGenerator::GenerateCode(std::string pchHeaderFilePath, std::string pchCppFilePath, ICluster* pCluster, INsCodeGenHelper* codeGenHelper)
+ERRORCODE NodeSimCodeGenerator::GenerateCode(std::string pchHeaderFilePath, std::string strUnitFolder, ICluster* pCluster, INsCodeGenHelper* codeGenHelper, std::vector<std::string>& ouUnitFiles)
 {
     ETYPE_BUS clusterType;
     pCluster->GetClusterType(clusterType);
@@ -49,30 +51,21 @@ ERRORCODE NodeSimCodeGenerator::GenerateCode(std::string pchHeaderFilePath, std:
         return E_NOTIMPL;
     }
     codeGenHelper->SetCluster(pCluster);
-    std::ostringstream omStringStream;
     std::fstream m_omFileHeader;
-    std::fstream m_omFileCode;
-    std::string strName;
-
-    std::string strPath;
-
-
-
 
     m_omFileHeader.open(pchHeaderFilePath, std::fstream::out|std::fstream::binary);
-    m_omFileCode.open(pchCppFilePath, std::fstream::out|std::fstream::binary);
 
 
-    if(m_omFileHeader.is_open() == false || m_omFileCode.is_open() == false)
+    if(m_omFileHeader.is_open() == false)
     {
         return EC_FAILURE;
     }
 
 
     GenerateHeaderFile(m_omFileHeader, codeGenHelper, pCluster);
-    GenerateCppFile(m_omFileCode, codeGenHelper, pCluster);
+    m_omFileHeader.close();
 
-    return S_OK;
+    return GenerateCppUnits(strUnitFolder, codeGenHelper, pCluster, ouUnitFiles);
 
 }
 
@@ -87,6 +80,9 @@ ERRORCODE NodeSimCodeGenerator::GenerateHeaderFile(std::fstream& fileHeader, INs
 
     fileHeader << defNameSpace << TAG_SPACE << clusterName << TAG_OPENFBRACE << std::endl;
 
+    //Cluster Id, defined in one unit of the cluster code
+    fileHeader << "extern unsigned long long g_strClusterPath" << TAG_SEMICOLON << std::endl;
+
     //3. Pdu namespace
     fileHeader << defNameSpace  <<" " <<"PDU" << TAG_OPENFBRACE <<std::endl;
 
@@ -171,8 +167,18 @@ for ( auto itrPdu : frameList )
 
 }
 
-ERRORCODE NodeSimCodeGenerator::GenerateCppFile(std::fstream& fileHeader, INsCodeGenHelper* codeGenHelper, ICluster* cluster)
+bool NodeSimCodeGenerator::OpenCppUnit(std::fstream& fileUnit, std::string strUnitFolder, ICluster* cluster, const char* pchNameSpace, std::vector<std::string>& ouUnitFiles)
 {
+    char chUnitPath[MAX_PATH*2];
+    char chUnitName[32];
+    sprintf_s(chUnitName, sizeof(chUnitName), "Unit%u.cpp", (unsigned int)ouUnitFiles.size());
+    PathCombine(chUnitPath, strUnitFolder.c_str(), chUnitName);
+    fileUnit.open(chUnitPath, std::fstream::out|std::fstream::binary);
+    if ( fileUnit.is_open() == false )
+    {
+        return false;
+    }
+
     //1. Header path
     std::string dbAppPath;
     GetBusMasterDBCachePath(dbAppPath);
@@ -183,74 +189,111 @@ ERRORCODE NodeSimCodeGenerator::GenerateCppFile(std::fstream& fileHeader, INsCod
     char headerFilePath[MAX_PATH*2];
     headerfilePath = strChkSum + ".h";
     PathCombine(headerFilePath, dbAppPath.c_str(), headerfilePath.c_str());
-    fileHeader <<"#include " << AddDoubleQuotes(headerFilePath) <<std::endl ;
+    fileUnit <<"#include " << AddDoubleQuotes(headerFilePath) <<std::endl ;
 
     //2. namespace cluster
-    std::string clusterName = GetClusterName(cluster);
+    fileUnit <<defNameSpace <<" " << GetClusterName(cluster) <<"{" <<std::endl ;
 
-    fileHeader <<defNameSpace <<" " << clusterName <<"{" <<std::endl ;
+    //3. Cluster Id, only in the first unit
+    if ( ouUnitFiles.empty() == true )
+    {
+        fileUnit << "unsigned long long g_strClusterPath = " <<"0x" << strChkSum  <<TAG_SEMICOLON << std::endl ;
+    }
 
-    //3. Cluster Id
-    fileHeader << "unsigned long long g_strClusterPath = " <<"0x" << strChkSum  <<TAG_SEMICOLON << std::endl ;
+    //4. Pdu or Frame namespace
+    fileUnit << defNameSpace <<" " << pchNameSpace << TAG_OPENFBRACE <<std::endl;
+    if ( 0 == strcmp(pchNameSpace, "Frame") )
+    {
+        fileUnit <<"using namespace PDU;" << std::endl;
+    }
 
-    //4. Pdu namespace
-    fileHeader << defNameSpace  <<" " <<"PDU" << TAG_OPENFBRACE <<std::endl;
+    ouUnitFiles.push_back(chUnitPath);
+    return true;
+}
+
+void NodeSimCodeGenerator::CloseCppUnit(std::fstream& fileUnit)
+{
+    //Endl Pdu or Frame namespace and cluster namespace
+    fileUnit << TAG_CLOSEFBRACE << std::endl;
+    fileUnit << TAG_CLOSEFBRACE << std::endl;
+    fileUnit.close();
+}
+
+ERRORCODE NodeSimCodeGenerator::GenerateCppUnits(std::string strUnitFolder, INsCodeGenHelper* codeGenHelper, ICluster* cluster, std::vector<std::string>& ouUnitFiles)
+{
+    //The definitions are split into units of defNS_ELEMENTS_PER_UNIT pdus or frames,
+    //which are compiled in parallel
+    std::fstream fileUnit;
+    size_t unInUnit = 0;
+    ouUnitFiles.clear();
 
-    //5. pdu definition
-	std::string pduName;
+    //1. pdu definition, the first unit is written even without pdus for the cluster Id
     std::map<UID_ELEMENT, IElement*> pduList;
     cluster->GetElementList(ePduElement, pduList);
     IPduCodeGenHelper* pduCodeGenHelper = codeGenHelper->GetPduCodeGenHelper();
-    PduProps pduProps;
-for ( auto itrPdu : pduList )
+    if ( false == OpenCppUnit(fileUnit, strUnitFolder, cluster, "PDU", ouUnitFiles) )
     {
+        return EC_FAILURE;
+    }
+    for ( auto itrPdu : pduList )
+    {
+        if ( unInUnit == defNS_ELEMENTS_PER_UNIT )
+        {
+            CloseCppUnit(fileUnit);
+            if ( false == OpenCppUnit(fileUnit, strUnitFolder, cluster, "PDU", ouUnitFiles) )
+            {
+                return EC_FAILURE;
+            }
+            unInUnit = 0;
+        }
         IPdu* pdu = (IPdu*)(itrPdu.second);
-        fileHeader << pduCodeGenHelper->GetConstructorDef(pdu) <<":"  <<std::endl;
-        fileHeader << pduCodeGenHelper->GetBaseClassConstructorDef(pdu) <<std::endl;
-        fileHeader << pduCodeGenHelper->GetSignalsConstructorDef(pdu) << std::endl;
-        fileHeader << TAG_OPENFBRACE << std::endl << TAG_CLOSEFBRACE <<std::endl;
+        fileUnit << pduCodeGenHelper->GetConstructorDef(pdu) <<":"  <<std::endl;
+        fileUnit << pduCodeGenHelper->GetBaseClassConstructorDef(pdu) <<std::endl;
+        fileUnit << pduCodeGenHelper->GetSignalsConstructorDef(pdu) << std::endl;
+        fileUnit << TAG_OPENFBRACE << std::endl << TAG_CLOSEFBRACE <<std::endl;
+        unInUnit++;
     }
+    CloseCppUnit(fileUnit);
 
-    //6. Endl Pdu namespace
-    fileHeader << TAG_CLOSEFBRACE << std::endl;
-
-    //7. Frame Namespace start
-    fileHeader << defNameSpace <<" " <<"Frame" << TAG_OPENFBRACE <<std::endl;
-
-    //8. Using namespace
-    fileHeader <<"using namespace PDU;" << std::endl;
-
-    //9. Frame definition
-
-    std::string frameName;
+    //2. Frame definition
     std::map<UID_ELEMENT, IElement*> frameList;
     std::map<IPdu*, PduInstanse> pduMap;
     cluster->GetElementList(eFrameElement, frameList);
     IFrameCodeGenHelper* frameCodeGenHelper = codeGenHelper->GetFrameCodeGenHelper();
-
-for ( auto itrFrame : frameList )
+    unInUnit = defNS_ELEMENTS_PER_UNIT;
+    for ( auto itrFrame : frameList )
     {
+        if ( unInUnit == defNS_ELEMENTS_PER_UNIT )
+        {
+            if ( fileUnit.is_open() == true )
+            {
+                CloseCppUnit(fileUnit);
+            }
+            if ( false == OpenCppUnit(fileUnit, strUnitFolder, cluster, "Frame", ouUnitFiles) )
+            {
+                return EC_FAILURE;
+            }
+            unInUnit = 0;
+        }
         IFrame* frame = (IFrame*)(itrFrame.second);
-        fileHeader << frameCodeGenHelper->GetConstructorDef(frame) <<":"  <<std::endl;
-        fileHeader << frameCodeGenHelper->GetBaseClassConstructorDef(frame) <<std::endl;
-        fileHeader << frameCodeGenHelper->GetPdusConstructorDef(frame) << std::endl;
+        fileUnit << frameCodeGenHelper->GetConstructorDef(frame) <<":"  <<std::endl;
+        fileUnit << frameCodeGenHelper->GetBaseClassConstructorDef(frame) <<std::endl;
+        fileUnit << frameCodeGenHelper->GetPdusConstructorDef(frame) << std::endl;
 
         pduMap.clear();
         frame->GetPduList(pduMap);
         if ( pduMap.size() == 0 )
         {
-            fileHeader << frameCodeGenHelper->GetSignalsConstructorDef(frame) << std::endl;
+            fileUnit << frameCodeGenHelper->GetSignalsConstructorDef(frame) << std::endl;
         }
 
-        fileHeader << TAG_OPENFBRACE << std::endl << TAG_CLOSEFBRACE <<std::endl;
+        fileUnit << TAG_OPENFBRACE << std::endl << TAG_CLOSEFBRACE <<std::endl;
+        unInUnit++;
+    }
+    if ( fileUnit.is_open() == true )
+    {
+        CloseCppUnit(fileUnit);
     }
-
-    //10. Endl Frame namespace
-    fileHeader << TAG_CLOSEFBRACE << std::endl;
-
-    //11. Cluster namespace
-    fileHeader << TAG_CLOSEFBRACE << std::endl;
-
 
     return EC_SUCCESS;
 }
@@ -330,7 +373,18 @@ bool NodeSimCodeGenerator::bIsDependentFileModified(ICluster* pCluster)
     return true;
 }
 
-ERRORCODE NodeSimCodeGenerator::GenerateObjectFile(std::string strCppFilePath, ICluster* pCluster)
+namespace
+{
+//Compiler runs of one cluster, taken by the worker threads in turn
+class NsCompileJob
+{
+public:
+    std::vector<std::string> m_ouCommands;
+    std::vector<DWORD> m_ouExitCodes;
+    volatile LONG m_lNextIndex;
+};
+
+DWORD dwRunCompiler(const std::string& strCommand)
 {
     PROCESS_INFORMATION sProcessInfo;
     STARTUPINFO         sStartInfo;
@@ -345,8 +399,70 @@ ERRORCODE NodeSimCodeGenerator::GenerateObjectFile(std::string strCppFilePath, I
     // Use this if you want to hide the child:
     sStartInfo.wShowWindow  = SW_HIDE;
 
-    CString omStrCommandParam;
+    std::vector<char> ouCommandLine(strCommand.begin(), strCommand.end());
+    ouCommandLine.push_back('\0');
+
+    //No handles are inherited, the runs of the other workers may be started at the same time
+    if ( FALSE == CreateProcess( nullptr, &ouCommandLine[0],
+                                 nullptr, nullptr,
+                                 FALSE, CREATE_NO_WINDOW,
+                                 nullptr, nullptr,
+                                 &sStartInfo, &sProcessInfo) )
+    {
+        return (DWORD)-1;
+    }
+    DWORD dwExitCode = (DWORD)-1;
+    WaitForSingleObject(sProcessInfo.hProcess, INFINITE);
+    GetExitCodeProcess(sProcessInfo.hProcess, &dwExitCode);
+    CloseHandle(sProcessInfo.hThread);
+    CloseHandle(sProcessInfo.hProcess);
+    return dwExitCode;
+}
 
+DWORD WINAPI NsCompileThreadProc(LPVOID pParam)
+{
+    NsCompileJob* pouJob = (NsCompileJob*)pParam;
+    LONG lIndex;
+    while ( ( lIndex = InterlockedIncrement(&pouJob->m_lNextIndex) - 1 ) < (LONG)pouJob->m_ouCommands.size() )
+    {
+        //Each worker writes only its own slot
+        pouJob->m_ouExitCodes[lIndex] = dwRunCompiler(pouJob->m_ouCommands[lIndex]);
+    }
+    return 0;
+}
+
+void vRunCompileJob(NsCompileJob& ouJob)
+{
+    ouJob.m_lNextIndex = 0;
+    ouJob.m_ouExitCodes.assign(ouJob.m_ouCommands.size(), (DWORD)-1);
+
+    SYSTEM_INFO sSysInfo;
+    GetSystemInfo(&sSysInfo);
+    size_t unThreads = min(ouJob.m_ouCommands.size(), (size_t)max(sSysInfo.dwNumberOfProcessors, (DWORD)1));
+    std::vector<HANDLE> ouThreads;
+    for ( size_t i = 1; i < unThreads; i++ )
+    {
+        HANDLE hThread = CreateThread(nullptr, 0, NsCompileThreadProc, &ouJob, 0, nullptr);
+        if ( nullptr != hThread )
+        {
+            ouThreads.push_back(hThread);
+        }
+    }
+    //Calling thread takes part as well, so the job completes even if no thread could be created
+    NsCompileThreadProc(&ouJob);
+    if ( false == ouThreads.empty() )
+    {
+        WaitForMultipleObjects(ouThreads.size(), &ouThreads[0], TRUE, INFINITE);
+        for ( auto itr = ouThreads.begin(); itr != ouThreads.end(); ++itr )
+        {
+            CloseHandle(*itr);
+        }
+    }
+}
+}
+
+ERRORCODE NodeSimCodeGenerator::GenerateObjectFile(std::string strUnitFolder, const std::vector<std::string>& ouUnitFiles, std::string strHeaderFilePath, ICluster* pCluster)
+{
     std::string strIncludeDir;
     GetBusmasterNodeSimualtionFolder(NS_INCLUDE_FOLDER, strIncludeDir);
 
@@ -362,23 +478,91 @@ ERRORCODE NodeSimCodeGenerator::GenerateObjectFile(std::string strCppFilePath, I
     std::string strObjFile = strDbAppPath + "\\";
     strObjFile += strCheckSum + "_gcc" + strGccVer + ".obj";
 
+    //1. Precompiled header, picked up by the -include of every node makefile.
+    //Built with the options of the node compilation, else gcc ignores it.
+    NsCompileJob ouJob;
+    std::string strPchFile = strHeaderFilePath + ".gch";
+    std::string strCommand = "g++ -x c++-header -I";
+    strCommand += AddDoubleQuotes(strIncludeDir);
+    strCommand += " " + AddDoubleQuotes(strHeaderFilePath);
+    strCommand += " -o" + AddDoubleQuotes(strPchFile + ".tmp");
+    ouJob.m_ouCommands.push_back(strCommand);
+
+    //2. One object per unit
+    std::vector<std::string> ouObjFiles;
+    for ( auto itrUnit = ouUnitFiles.begin(); itrUnit != ouUnitFiles.end(); ++itrUnit )
+    {
+        std::string strUnitObj = itrUnit->substr(0, itrUnit->rfind('.')) + ".o";
+        strCommand = "g++ -DNO_INCLUDE_TEMPSTRUCT -c -I";
+        strCommand += AddDoubleQuotes(strIncludeDir);
+        strCommand += " -xc++ ";
+        strCommand += AddDoubleQuotes(*itrUnit);
+        strCommand += " -o";
+        strCommand += AddDoubleQuotes(strUnitObj);
+        ouJob.m_ouCommands.push_back(strCommand);
+        ouObjFiles.push_back(strUnitObj);
+    }
 
-    omStrCommandParam = "g++ -DNO_INCLUDE_TEMPSTRUCT -c -I";
-    omStrCommandParam += AddDoubleQuotes(strIncludeDir).c_str();
-    omStrCommandParam += "\ -xc++ ";
-    omStrCommandParam += AddDoubleQuotes(strCppFilePath).c_str();
-    omStrCommandParam += " -o";
-    omStrCommandParam += AddDoubleQuotes(strObjFile).c_str();
+    vRunCompileJob(ouJob);
 
+    //The header stays usable without its precompiled form
+    if ( 0 == ouJob.m_ouExitCodes[0] )
+    {
+        MoveFileEx((strPchFile + ".tmp").c_str(), strPchFile.c_str(), MOVEFILE_REPLACE_EXISTING);
+    }
+    else
+    {
+        DeleteFile((strPchFile + ".tmp").c_str());
+    }
 
-    CreateProcess( nullptr, omStrCommandParam.GetBuffer(omStrCommandParam.GetLength()),
-                   nullptr, nullptr,
-                   true, CREATE_NO_WINDOW,
-                   nullptr, nullptr,
-                   &sStartInfo, &sProcessInfo);
+    ERRORCODE ecRetVal = EC_SUCCESS;
+    for ( size_t i = 1; i < ouJob.m_ouExitCodes.size(); i++ )
+    {
+        if ( 0 != ouJob.m_ouExitCodes[i] )
+        {
+            ecRetVal = EC_FAILURE;
+        }
+    }
 
-    return WaitForSingleObject(sProcessInfo.hProcess, INFINITE);
+    //3. Unit objects linked into the single object the node makefiles expect.
+    //The object list goes through a response file, ld reads backslashes there as escapes.
+    std::string strListFile = strUnitFolder + "\\Units.rsp";
+    if ( EC_SUCCESS == ecRetVal )
+    {
+        std::fstream fileList;
+        fileList.open(strListFile, std::fstream::out|std::fstream::binary);
+        for ( auto itrObj = ouObjFiles.begin(); itrObj != ouObjFiles.end(); ++itrObj )
+        {
+            std::string strObj = *itrObj;
+            std::replace(strObj.begin(), strObj.end(), '\\', '/');
+            fileList << AddDoubleQuotes(strObj) << std::endl;
+        }
+        fileList.close();
 
+        strCommand = "ld -r -o";
+        strCommand += AddDoubleQuotes(strObjFile + ".tmp");
+        strCommand += " @" + AddDoubleQuotes(strListFile);
+        if ( 0 == dwRunCompiler(strCommand)
+                && FALSE != MoveFileEx((strObjFile + ".tmp").c_str(), strObjFile.c_str(), MOVEFILE_REPLACE_EXISTING) )
+        {
+            ecRetVal = EC_SUCCESS;
+        }
+        else
+        {
+            DeleteFile((strObjFile + ".tmp").c_str());
+            ecRetVal = EC_FAILURE;
+        }
+    }
+
+    DeleteFile(strListFile.c_str());
+    for ( size_t i = 0; i < ouUnitFiles.size(); i++ )
+    {
+        DeleteFile(ouUnitFiles[i].c_str());
+        DeleteFile(ouObjFiles[i].c_str());
+    }
+    RemoveDirectory(strUnitFolder.c_str());
+
+    return ecRetVal;
 }
 
 ERRORCODE NodeSimCodeGenerator::GenerateMakeFile(IBMNetWorkGetService* pBmNetWork, ETYPE_BUS eBus, std::string strForCppFile)
@@ -536,6 +720,7 @@ ERRORCODE NodeSimCodeGenerator::CompileCode(ICluster* pCluster, bool bRegenerate
             std::string strCheckSum;
             pCluster->GetDBFileChecksum(strCheckSum);
 
+            //The units of the cluster are written into a folder of their own
             char chTempFolder[MAX_PATH];
             char chTempPath[MAX_PATH];
             GetTempPath( MAX_PATH, chTempFolder );
@@ -543,27 +728,34 @@ ERRORCODE NodeSimCodeGenerator::CompileCode(ICluster* pCluster, bool bRegenerate
                             TEXT("BM"),     // temp file name prefix
                             0,                // create unique name
                             chTempPath);  // buffer for name
+            DeleteFile(chTempPath);
+            if ( FALSE == CreateDirectory(chTempPath, nullptr) )
+            {
+                return EC_FAILURE;
+            }
 
-            std::string strCppFilePath =  chTempPath; //+ ".cpp";
-
-
-
-
-
+            std::string strUnitFolder =  chTempPath;
 
             std::string strDbAppPath;
             GetBusMasterDBCachePath(strDbAppPath);
 
-
-
-
             std::string strHeaderFilePath = strDbAppPath + "\\";
             strHeaderFilePath += strCheckSum + ".h";
 
-            GenerateCode(strHeaderFilePath, strCppFilePath, pCluster, codeGenHelper);
-            ecRetVal = GenerateObjectFile(strCppFilePath, pCluster);
-
-            //DeleteFile(chTempPath);
+            std::vector<std::string> ouUnitFiles;
+            ecRetVal = GenerateCode(strHeaderFilePath, strUnitFolder, pCluster, codeGenHelper, ouUnitFiles);
+            if ( EC_SUCCESS == ecRetVal )
+            {
+                ecRetVal = GenerateObjectFile(strUnitFolder, ouUnitFiles, strHeaderFilePath, pCluster);
+            }
+            else
+            {
+                for ( auto itrUnit = ouUnitFiles.begin(); itrUnit != ouUnitFiles.end(); ++itrUnit )
+                {
+                    DeleteFile(itrUnit->c_str());
+                }
+                RemoveDirectory(strUnitFolder.c_str());
+            }
         }
         else
         {
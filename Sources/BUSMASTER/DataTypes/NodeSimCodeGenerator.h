@@ -2,6 +2,7 @@
 #include "ICluster.h"
 #include "INsCodeGenHelper.h"
 #include <fstream>
+#include <vector>
 class IBMNetWorkGetService;
 class NodeSimCodeGenerator
 {
@@ -9,12 +10,14 @@ public:
     NodeSimCodeGenerator();
     ~NodeSimCodeGenerator(void);
 
-    ERRORCODE GenerateCode(std::string pchHeaderFilePath, std::string pchCppFilePath, ICluster* pCluster, INsCodeGenHelper* codeGenHelper);
+    ERRORCODE GenerateCode(std::string pchHeaderFilePath, std::string strUnitFolder, ICluster* pCluster, INsCodeGenHelper* codeGenHelper, std::vector<std::string>& ouUnitFiles);
     ERRORCODE CompileCode(ICluster*, bool bRegenerateCode, bool bReCompile, INsCodeGenHelper* codeGenHelper);
     ERRORCODE GenerateMakeFile( IBMNetWorkGetService* pBmNetWork, ETYPE_BUS eBus, std::string strForCppFile);
 private:
     ERRORCODE GenerateHeaderFile(std::fstream&, class INsCodeGenHelper*, ICluster*);
-    ERRORCODE GenerateCppFile(std::fstream&, class INsCodeGenHelper*, ICluster*);
+    ERRORCODE GenerateCppUnits(std::string strUnitFolder, class INsCodeGenHelper*, ICluster*, std::vector<std::string>& ouUnitFiles);
+    bool OpenCppUnit(std::fstream& fileUnit, std::string strUnitFolder, ICluster* cluster, const char* pchNameSpace, std::vector<std::string>& ouUnitFiles);
+    void CloseCppUnit(std::fstream& fileUnit);
 
     std::string GetClusterName(ICluster* pCluster);
     std::string GetProtocolLib(ETYPE_BUS);
@@ -28,6 +31,6 @@ private:
 
 
     bool bIsDependentFileModified(ICluster*);
-    ERRORCODE GenerateObjectFile(std::string strCppFilePath, ICluster* pCluster);
+    ERRORCODE GenerateObjectFile(std::string strUnitFolder, const std::vector<std::string>& ouUnitFiles, std::string strHeaderFilePath, ICluster* pCluster);
 };
 
@@ -20,12 +20,15 @@
 
 #include "resource.h"       // main symbols
 #include <atlctl.h>
+#include <vector>
 #include "DMGraphCP.h"
 #include "GraphCollection.h"
 #include "ElementPoint.h"
 #include "DMGraphCursorState.h"
 
 #define TOOLTIP_TXT_LEN 128
+#define PLOT_TIMER_ID   1
+#define PLOT_FRAME_MS   40      // Points plotted in between are drawn together, 25 frames per second
 
 class CGraphElement;
 class CGraphAnnotation;
@@ -126,6 +129,8 @@ public:
     MESSAGE_HANDLER(WM_RBUTTONDOWN, OnRButtonDown)
     MESSAGE_HANDLER(WM_ERASEBKGND, OnEraseBackground)
     MESSAGE_HANDLER(WM_KILLFOCUS, OnKillFocus)
+    MESSAGE_HANDLER(WM_TIMER, OnTimer)
+    MESSAGE_HANDLER(WM_DESTROY, OnDestroy)
     DEFAULT_REFLECTION_HANDLER()
     END_MSG_MAP()
     // Handler prototypes:
@@ -138,6 +143,8 @@ public:
     LRESULT OnLButtonDown(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
     LRESULT OnLButtonUp(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
     LRESULT OnMouseMove(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
+    LRESULT OnTimer(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
+    LRESULT OnDestroy(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
     LRESULT OnRButtonDown(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
     LRESULT OnKillFocus(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
     LRESULT OnEraseBackground(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled)
@@ -253,6 +260,7 @@ public:
     FrameStyle          m_eFrameStyle;
 
     void Refresh(BOOL withPenAndBrushes);
+    void RefreshPlot(); //refresh after new points, coalesced to PLOT_FRAME_MS; may be called from any thread
     void UpdateAutoRange(double X, double Y, BOOL bFirstPoint);
     void OnPlotDeleted(); //updates m_nAvailablePlots when a graph with at least one point was deleted
 
@@ -331,6 +339,9 @@ private:
     POINT   m_panPoint;
     BOOL    m_bUnzoom;
     long    m_nAvailablePlots; //non zero if we have at least one point in one element to draw
+    BOOL    m_bPlotTimer;       //plot refreshes are done from the timer
+    volatile LONG m_lPlotChanged;   //points were added since the last plot refresh
+    std::vector<CElementPoint> m_DrawPointList; //points of the element being drawn
     double RoundUp(double val, int ex);
 
     CWindow     m_ttip;
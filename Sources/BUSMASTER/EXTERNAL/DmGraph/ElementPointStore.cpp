@@ -0,0 +1,347 @@
+/////////////////////////////////////////////////////////////////////////////
+// (c) Copyright The Code Project Open License (CPOL)
+//  http://www.codeproject.com/info/cpol10.aspx
+//
+// FILE NAME
+//      ElementPointStore.cpp: implementation for the CElementPointStore class
+//
+// CLASS NAME
+//      CElementPointStore
+//
+// DESCRIPTION
+//
+#include "stdafx.h"
+#include <float.h>
+#include "ElementPointStore.h"
+
+static double WINAPI GetAxisX(double x, BOOL bXLog);
+static __int64 WINAPI GetColumn(double x, double dMinX, double dResX, BOOL bXLog);
+
+CElementPointStore::CElementPointStore(int nCapacity)
+{
+    ATLASSERT(nCapacity > 0);
+
+    m_nCapacity  = nCapacity;
+    m_n64First   = 0;
+    m_n64Next    = 0;
+    m_bMonotonic = TRUE;
+
+    for(int nLevel = 0; nLevel < ELEMENT_PYRAMID_LEVELS; nLevel++)
+    {
+        m_asLevels[nLevel].m_nShift = ELEMENT_PYRAMID_BASE_SHIFT + nLevel * ELEMENT_PYRAMID_LEVEL_SHIFT;
+        m_asLevels[nLevel].m_nSlots = (nCapacity >> m_asLevels[nLevel].m_nShift) + 2;
+    }
+}
+
+int CElementPointStore::GetSize() const
+{
+    return (int)(m_n64Next - m_n64First);
+}
+
+const CElementPoint& CElementPointStore::operator[](int nIndex) const
+{
+    ATLASSERT(nIndex >= 0 && nIndex < GetSize());
+    return GetPoint(m_n64First + nIndex);
+}
+
+__int64 CElementPointStore::GetAddedCount() const
+{
+    return m_n64Next;
+}
+
+void CElementPointStore::Add(const CElementPoint& point)
+{
+    __int64 n64Seq = m_n64Next;
+
+    if(GetSize() > 0 && point.x < GetPoint(n64Seq - 1).x)
+    {
+        m_bMonotonic = FALSE;
+    }
+    if(GetSize() == m_nCapacity)
+    {
+        m_n64First++;   // drop the oldest point
+    }
+
+    int nSlot = (int)(n64Seq % m_nCapacity);
+    if(nSlot == (int)m_ouPoints.size())
+    {
+        m_ouPoints.push_back(point);
+    }
+    else
+    {
+        m_ouPoints[nSlot] = point;
+    }
+
+    for(int nLevel = 0; nLevel < ELEMENT_PYRAMID_LEVELS; nLevel++)
+    {
+        sLEVEL& sLevel = m_asLevels[nLevel];
+        nSlot = (int)((n64Seq >> sLevel.m_nShift) % sLevel.m_nSlots);
+        if(nSlot == (int)sLevel.m_ouBlocks.size())
+        {
+            sLevel.m_ouBlocks.push_back(sBLOCK());
+        }
+
+        sBLOCK& sBlock = sLevel.m_ouBlocks[nSlot];
+        if((n64Seq & (((__int64)1 << sLevel.m_nShift) - 1)) == 0)
+        {
+            // first point of a new block
+            sBlock.m_dMinY    = sBlock.m_dMaxY    = point.y;
+            sBlock.m_n64MinAt = sBlock.m_n64MaxAt = n64Seq;
+        }
+        else
+        {
+            MergePoint(sBlock, point, n64Seq);
+        }
+    }
+
+    m_n64Next++;
+}
+
+void CElementPointStore::SetAt(int nIndex, const CElementPoint& point)
+{
+    ATLASSERT(nIndex >= 0 && nIndex < GetSize());
+
+    __int64 n64Seq = m_n64First + nIndex;
+
+    if( (n64Seq > m_n64First && point.x < GetPoint(n64Seq - 1).x) ||
+            (n64Seq + 1 < m_n64Next && GetPoint(n64Seq + 1).x < point.x) )
+    {
+        m_bMonotonic = FALSE;
+    }
+
+    m_ouPoints[(int)(n64Seq % m_nCapacity)] = point;
+    RebuildBlocks(n64Seq);
+}
+
+void CElementPointStore::RemoveAll()
+{
+    m_n64First   = 0;
+    m_n64Next    = 0;
+    m_bMonotonic = TRUE;
+    m_ouPoints.clear();
+
+    for(int nLevel = 0; nLevel < ELEMENT_PYRAMID_LEVELS; nLevel++)
+    {
+        m_asLevels[nLevel].m_ouBlocks.clear();
+    }
+}
+
+void CElementPointStore::GetDrawPoints(double dMinX, double dMaxX, double dResX, BOOL bXLog,
+                                       std::vector<CElementPoint>& ouPoints) const
+{
+    ouPoints.clear();
+
+    __int64 n64Begin = m_n64First;
+    __int64 n64End   = m_n64Next;
+
+    if(!(dResX > 0))    // no plot area yet
+    {
+        for(__int64 n64Seq = n64Begin; n64Seq < n64End; n64Seq++)
+        {
+            ouPoints.push_back(GetPoint(n64Seq));
+        }
+        return;
+    }
+
+    if(m_bMonotonic)
+    {
+        // the neighbours of the visible range give the lines entering and leaving it
+        n64Begin = max(FindFirst(dMinX, bXLog, TRUE) - 1, m_n64First);
+        n64End   = min(FindFirst(dMaxX, bXLog, FALSE) + 1, m_n64Next);
+    }
+
+    __int64 n64Seq = n64Begin;
+    while(n64Seq < n64End)
+    {
+        __int64 n64Column  = GetColumn(GetPoint(n64Seq).x, dMinX, dResX, bXLog);
+        __int64 n64FirstAt = n64Seq;
+        __int64 n64LastAt  = n64Seq;
+
+        sBLOCK sColumn;
+        sColumn.m_dMinY    = sColumn.m_dMaxY    = GetPoint(n64Seq).y;
+        sColumn.m_n64MinAt = sColumn.m_n64MaxAt = n64Seq;
+        n64Seq++;
+
+        while(n64Seq < n64End)
+        {
+            if(m_bMonotonic)
+            {
+                // take the largest block starting here that ends in the same column
+                int nLevel;
+                for(nLevel = ELEMENT_PYRAMID_LEVELS - 1; nLevel >= 0; nLevel--)
+                {
+                    __int64 n64Size = (__int64)1 << m_asLevels[nLevel].m_nShift;
+                    if( (n64Seq & (n64Size - 1)) == 0 && n64Seq + n64Size <= n64End &&
+                            GetColumn(GetPoint(n64Seq + n64Size - 1).x, dMinX, dResX, bXLog) == n64Column )
+                    {
+                        break;
+                    }
+                }
+                if(nLevel >= 0)
+                {
+                    MergeBlock(sColumn, GetBlock(nLevel, n64Seq));
+                    n64Seq += (__int64)1 << m_asLevels[nLevel].m_nShift;
+                    n64LastAt = n64Seq - 1;
+                    continue;
+                }
+            }
+
+            const CElementPoint& point = GetPoint(n64Seq);
+            if(GetColumn(point.x, dMinX, dResX, bXLog) != n64Column)
+            {
+                break;
+            }
+            MergePoint(sColumn, point, n64Seq);
+            n64LastAt = n64Seq;
+            n64Seq++;
+        }
+
+        // keep the column points in their original order
+        __int64 an64At[4] = { n64FirstAt, sColumn.m_n64MinAt, sColumn.m_n64MaxAt, n64LastAt };
+        if(an64At[1] > an64At[2])
+        {
+            an64At[1] = sColumn.m_n64MaxAt;
+            an64At[2] = sColumn.m_n64MinAt;
+        }
+        for(int i = 0; i < 4; i++)
+        {
+            if(i == 0 || an64At[i] != an64At[i - 1])
+            {
+                ouPoints.push_back(GetPoint(an64At[i]));
+            }
+        }
+    }
+}
+
+const CElementPoint& CElementPointStore::GetPoint(__int64 n64Seq) const
+{
+    return m_ouPoints[(int)(n64Seq % m_nCapacity)];
+}
+
+CElementPointStore::sBLOCK& CElementPointStore::GetBlock(int nLevel, __int64 n64Seq)
+{
+    const sLEVEL& sLevel = m_asLevels[nLevel];
+    return m_asLevels[nLevel].m_ouBlocks[(int)((n64Seq >> sLevel.m_nShift) % sLevel.m_nSlots)];
+}
+
+const CElementPointStore::sBLOCK& CElementPointStore::GetBlock(int nLevel, __int64 n64Seq) const
+{
+    const sLEVEL& sLevel = m_asLevels[nLevel];
+    return sLevel.m_ouBlocks[(int)((n64Seq >> sLevel.m_nShift) % sLevel.m_nSlots)];
+}
+
+//recalculates the blocks holding a changed point, from the points or the blocks below
+void CElementPointStore::RebuildBlocks(__int64 n64Seq)
+{
+    for(int nLevel = 0; nLevel < ELEMENT_PYRAMID_LEVELS; nLevel++)
+    {
+        int nShift = m_asLevels[nLevel].m_nShift;
+        __int64 n64Start = (n64Seq >> nShift) << nShift;
+        __int64 n64End   = min(n64Start + ((__int64)1 << nShift), m_n64Next);
+
+        if(n64Start < m_n64First)
+        {
+            return;     // holds dropped points and is never used, neither are the blocks above
+        }
+
+        sBLOCK& sBlock = GetBlock(nLevel, n64Seq);
+        if(nLevel == 0)
+        {
+            sBlock.m_dMinY    = sBlock.m_dMaxY    = GetPoint(n64Start).y;
+            sBlock.m_n64MinAt = sBlock.m_n64MaxAt = n64Start;
+            for(__int64 n64Point = n64Start + 1; n64Point < n64End; n64Point++)
+            {
+                MergePoint(sBlock, GetPoint(n64Point), n64Point);
+            }
+        }
+        else
+        {
+            __int64 n64SubSize = (__int64)1 << m_asLevels[nLevel - 1].m_nShift;
+            sBlock = GetBlock(nLevel - 1, n64Start);
+            for(__int64 n64Sub = n64Start + n64SubSize; n64Sub < n64End; n64Sub += n64SubSize)
+            {
+                MergeBlock(sBlock, GetBlock(nLevel - 1, n64Sub));
+            }
+        }
+    }
+}
+
+void CElementPointStore::MergePoint(sBLOCK& sTarget, const CElementPoint& point, __int64 n64Seq)
+{
+    if(point.y < sTarget.m_dMinY)
+    {
+        sTarget.m_dMinY    = point.y;
+        sTarget.m_n64MinAt = n64Seq;
+    }
+    if(point.y > sTarget.m_dMaxY)
+    {
+        sTarget.m_dMaxY    = point.y;
+        sTarget.m_n64MaxAt = n64Seq;
+    }
+}
+
+void CElementPointStore::MergeBlock(sBLOCK& sTarget, const sBLOCK& sSource)
+{
+    if(sSource.m_dMinY < sTarget.m_dMinY)
+    {
+        sTarget.m_dMinY    = sSource.m_dMinY;
+        sTarget.m_n64MinAt = sSource.m_n64MinAt;
+    }
+    if(sSource.m_dMaxY > sTarget.m_dMaxY)
+    {
+        sTarget.m_dMaxY    = sSource.m_dMaxY;
+        sTarget.m_n64MaxAt = sSource.m_n64MaxAt;
+    }
+}
+
+//sequence number of the first point right of dX, or at dX if bOrEqual is set
+//only valid while X never decreases
+__int64 CElementPointStore::FindFirst(double dX, BOOL bXLog, BOOL bOrEqual) const
+{
+    __int64 n64Low  = m_n64First;
+    __int64 n64High = m_n64Next;
+
+    while(n64Low < n64High)
+    {
+        __int64 n64Mid = n64Low + (n64High - n64Low) / 2;
+        double dMidX = GetAxisX(GetPoint(n64Mid).x, bXLog);
+
+        if(dMidX < dX || (!bOrEqual && dMidX == dX))
+        {
+            n64Low = n64Mid + 1;
+        }
+        else
+        {
+            n64High = n64Mid;
+        }
+    }
+    return n64Low;
+}
+
+///////////////////////////////////////////////
+// helpers
+
+static double WINAPI GetAxisX(double x, BOOL bXLog)
+{
+    if(!bXLog)
+    {
+        return x;
+    }
+    return x > 0 ? log10(x) : -DBL_MAX;
+}
+
+//pixel column of x, points far outside the plot area share one column on each side
+static __int64 WINAPI GetColumn(double x, double dMinX, double dResX, BOOL bXLog)
+{
+    double dColumn = (GetAxisX(x, bXLog) - dMinX) / dResX;
+
+    if(!(dColumn >= -1.))
+    {
+        return -1;
+    }
+    if(dColumn > (double)INT_MAX)
+    {
+        return INT_MAX;
+    }
+    return (__int64)floor(dColumn);
+}
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////
+// (c) Copyright The Code Project Open License (CPOL)
+//  http://www.codeproject.com/info/cpol10.aspx
+//
+// FILE NAME
+//      ElementPointStore.h: Declaration of the CElementPointStore class
+//
+// CLASS NAME
+//      CElementPointStore
+//
+// DESCRIPTION
+//      Bounded point storage of a graph element. Points are kept in a ring
+//      buffer, the oldest point is dropped once the capacity is reached.
+//      A min/max pyramid over the points lets the drawing code reduce any
+//      range to a few points per pixel column without visiting every point.
+//
+
+#pragma once
+
+#include <vector>
+#include "ElementPoint.h"
+
+#define ELEMENT_POINT_CAPACITY      (1 << 20)   // Points kept per element
+#define ELEMENT_PYRAMID_LEVELS      6
+#define ELEMENT_PYRAMID_BASE_SHIFT  4           // 16 points per block on the first level
+#define ELEMENT_PYRAMID_LEVEL_SHIFT 3           // 8 blocks of a level per block of the next one
+
+///////////////////////////////////////////////////////////
+// Declaration of the CElementPointStore class.
+class CElementPointStore
+{
+public:
+    CElementPointStore(int nCapacity = ELEMENT_POINT_CAPACITY);
+
+    int GetSize() const;
+    // Index 0 is the oldest point kept
+    const CElementPoint& operator[](int nIndex) const;
+    // Number of points added since the last RemoveAll, including dropped ones
+    __int64 GetAddedCount() const;
+
+    void Add(const CElementPoint& point);
+    void SetAt(int nIndex, const CElementPoint& point);
+    void RemoveAll();
+
+    // Reduces the points to the first, lowest, highest and last point of every
+    // pixel column. Columns are dResX wide starting at dMinX, in axis units
+    // (log10 of X when bXLog is set). Points just outside [dMinX, dMaxX] are
+    // kept so that lines leave the plot area at the right place.
+    void GetDrawPoints(double dMinX, double dMaxX, double dResX, BOOL bXLog,
+                       std::vector<CElementPoint>& ouPoints) const;
+
+private:
+    // Y extremes of a block of consecutive points
+    struct sBLOCK
+    {
+        double  m_dMinY;
+        double  m_dMaxY;
+        __int64 m_n64MinAt;     // Sequence number of the lowest point
+        __int64 m_n64MaxAt;
+    };
+
+    struct sLEVEL
+    {
+        int                 m_nShift;   // log2 of the points per block
+        int                 m_nSlots;   // Ring size, the blocks of all kept points and one partial block
+        std::vector<sBLOCK> m_ouBlocks; // Grows up to m_nSlots
+    };
+
+    int     m_nCapacity;
+    __int64 m_n64First;                 // Sequence number of the oldest point kept
+    __int64 m_n64Next;                  // Sequence number of the next point added
+    BOOL    m_bMonotonic;               // X never decreases, the pyramid may be used while drawing
+    std::vector<CElementPoint> m_ouPoints;      // Grows up to m_nCapacity
+    sLEVEL  m_asLevels[ ELEMENT_PYRAMID_LEVELS ];
+
+    const CElementPoint& GetPoint(__int64 n64Seq) const;
+    sBLOCK& GetBlock(int nLevel, __int64 n64Seq);
+    const sBLOCK& GetBlock(int nLevel, __int64 n64Seq) const;
+    void RebuildBlocks(__int64 n64Seq);
+    static void MergePoint(sBLOCK& sTarget, const CElementPoint& point, __int64 n64Seq);
+    static void MergeBlock(sBLOCK& sTarget, const sBLOCK& sSource);
+    __int64 FindFirst(double dX, BOOL bXLog, BOOL bOrEqual) const;
+};
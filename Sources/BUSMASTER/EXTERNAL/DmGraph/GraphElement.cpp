@@ -381,7 +381,7 @@ STDMETHODIMP CGraphElement::get_Count(/*[out, retval]*/ long* pVal)
 // Get X point value at point index
 STDMETHODIMP CGraphElement::get_XValue(/*[in]*/ long index, /*[out, retval]*/ double* pVal)
 {
-    if(index < 0 || index > m_PointList.GetSize())
+    if(index < 0 || index >= m_PointList.GetSize())
     {
         return AtlReportError(CLSID_NULL, L"Point not found!", IID_NULL, E_INVALIDARG);
     }
@@ -396,11 +396,15 @@ STDMETHODIMP CGraphElement::get_XValue(/*[in]*/ long index, /*[out, retval]*/ do
 // Set X point value at point index
 STDMETHODIMP CGraphElement::put_XValue(/*[in]*/ long index, /*[in]*/ double newVal)
 {
-    if(index < 0 || index > m_PointList.GetSize())
+    if(index < 0 || index >= m_PointList.GetSize())
     {
         return AtlReportError(CLSID_NULL, L"Point not found!", IID_NULL, E_INVALIDARG);
     }
-    m_PointList[index].x = newVal;
+    EnterCriticalSection(&m_CritSectionForPlot);
+    CElementPoint point = m_PointList[index];
+    point.x = newVal;
+    m_PointList.SetAt(index, point);
+    LeaveCriticalSection(&m_CritSectionForPlot);
     if(m_pCtrl)
     {
         m_pCtrl->Refresh(FALSE);
@@ -412,7 +416,7 @@ STDMETHODIMP CGraphElement::put_XValue(/*[in]*/ long index, /*[in]*/ double newV
 // Get Y point value at point index
 STDMETHODIMP CGraphElement::get_YValue(/*[in]*/ long index, /*[out, retval]*/ double* pVal)
 {
-    if(index < 0 || index > m_PointList.GetSize())
+    if(index < 0 || index >= m_PointList.GetSize())
     {
         return AtlReportError(CLSID_NULL, L"Point not found!", IID_NULL, E_INVALIDARG);
     }
@@ -427,11 +431,15 @@ STDMETHODIMP CGraphElement::get_YValue(/*[in]*/ long index, /*[out, retval]*/ do
 // Get Y point value at point index
 STDMETHODIMP CGraphElement::put_YValue(/*[in]*/ long index, /*[in]*/ double newVal)
 {
-    if(index < 0 || index > m_PointList.GetSize())
+    if(index < 0 || index >= m_PointList.GetSize())
     {
         return E_INVALIDARG;
     }
-    m_PointList[index].y = newVal;
+    EnterCriticalSection(&m_CritSectionForPlot);
+    CElementPoint point = m_PointList[index];
+    point.y = newVal;
+    m_PointList.SetAt(index, point);
+    LeaveCriticalSection(&m_CritSectionForPlot);
     if(m_pCtrl)
     {
         m_pCtrl->Refresh(FALSE);
@@ -445,7 +453,9 @@ STDMETHODIMP CGraphElement::PlotXY(double X, double Y)
 {
     CElementPoint point(X, Y);
 
+    EnterCriticalSection(&m_CritSectionForPlot);
     m_PointList.Add(point);
+    LeaveCriticalSection(&m_CritSectionForPlot);
 
     if(min.x > point.x)
     {
@@ -467,9 +477,9 @@ STDMETHODIMP CGraphElement::PlotXY(double X, double Y)
     if(m_pCtrl)
     {
         m_pCtrl->UpdateAutoRange(X, Y,
-                                 m_PointList.GetSize() == 1 );   //TRUE only for first added point
+                                 m_PointList.GetAddedCount() == 1 );   //TRUE only for first added point
 
-        m_pCtrl->Refresh(FALSE);
+        m_pCtrl->RefreshPlot();     //redrawn at most once per frame
     }
     return S_OK;
 }
@@ -478,8 +488,8 @@ STDMETHODIMP CGraphElement::PlotXY(double X, double Y)
 // Set element Y data
 STDMETHODIMP CGraphElement::PlotY(double Y)
 {
-    int X;
-    X = m_PointList.GetSize();
+    double X;
+    X = (double)m_PointList.GetAddedCount();   //keeps counting once old points are dropped
 
     return PlotXY(X, Y);
 }
@@ -564,7 +574,9 @@ STDMETHODIMP CGraphElement::Plot(VARIANT newXVals, VARIANT newYVals)
         }
 
         CElementPoint point(x, y);
+        EnterCriticalSection(&m_CritSectionForPlot);
         m_PointList.Add(point);
+        LeaveCriticalSection(&m_CritSectionForPlot);
 
         if(min.x > point.x)
         {
@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include "ElementPoint.h"
+#include "ElementPointStore.h"
 #include "GraphItem.h"
 
 class CDMGraphCtrl;
@@ -83,7 +83,7 @@ public:
     long            m_nPointSize;
     CComBSTR        m_strName;
     CElementPoint   min, max;
-    CSimpleArray<CElementPoint> m_PointList;
+    CElementPointStore m_PointList;
 
     CRITICAL_SECTION m_CritSectionForPlot;
 };
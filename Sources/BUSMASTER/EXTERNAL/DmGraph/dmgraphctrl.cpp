@@ -89,6 +89,8 @@ CDMGraphCtrl::CDMGraphCtrl()
 
     m_nAvailablePlots = 0;
     m_bUnzoom = FALSE;
+    m_bPlotTimer = FALSE;
+    m_lPlotChanged = 0;
 
     m_pElementList      = nullptr;
     m_pAnnotationList   = nullptr;
@@ -335,6 +337,18 @@ void CDMGraphCtrl::Refresh(BOOL withPenAndBrushes)
     m_bRequiresSave = TRUE;
 }
 
+void CDMGraphCtrl::RefreshPlot()
+{
+    if(m_bPlotTimer)
+    {
+        InterlockedExchange(&m_lPlotChanged, 1);
+    }
+    else
+    {
+        Refresh(FALSE);
+    }
+}
+
 STDMETHODIMP CDMGraphCtrl::AboutBox()
 {
     CAboutDlg dlg;
@@ -2194,20 +2208,23 @@ void CDMGraphCtrl::PlotElementLines(HDC hDC, CGraphElement* pElement, BOOL bOpti
     //SSH -
     //BoundingRect.NormalizeRect ();
 
-    // Lock the plot access
-    EnterCriticalSection(&pElement->m_CritSectionForPlot);
-
     POINT point;
     CElementPoint pt;
     VARIANT_BOOL bXLog, bYLog;
     POINT oldpt;
+
+    m_pAxis[ HorizontalX ]->get_Log(&bXLog);
+    m_pAxis[ VerticalY  ]->get_Log(&bYLog);
+
+    // Lock the plot access while the visible points are reduced to a few per pixel column
+    EnterCriticalSection(&pElement->m_CritSectionForPlot);
+    pElement->m_PointList.GetDrawPoints(dRangeX[MIN], dRangeX[MAX], dResX, bXLog, m_DrawPointList);
+    LeaveCriticalSection(&pElement->m_CritSectionForPlot);
+
     //Proceed only if it contains at least 2 points
-    if ( pElement->m_PointList.GetSize() > 1 )
+    if ( m_DrawPointList.size() > 1 )
     {
-        pt = pElement->m_PointList[0];
-
-        m_pAxis[ HorizontalX ]->get_Log(&bXLog);
-        m_pAxis[ VerticalY  ]->get_Log(&bYLog);
+        pt = m_DrawPointList[0];
 
         if(bXLog)
         {
@@ -2228,11 +2245,9 @@ void CDMGraphCtrl::PlotElementLines(HDC hDC, CGraphElement* pElement, BOOL bOpti
 
     //Start plot all available data.
     int i;
-    for(i=1; i<pElement->m_PointList.GetSize(); i++)
+    for(i=1; i<(int)m_DrawPointList.size(); i++)
     {
-        //pt = pElement->m_PointList[i];
-        pt.x = pElement->m_PointList[i].x;
-        pt.y = pElement->m_PointList[i].y;
+        pt = m_DrawPointList[i];
 
         if(bXLog)
         {
@@ -2420,8 +2435,6 @@ void CDMGraphCtrl::PlotElementLines(HDC hDC, CGraphElement* pElement, BOOL bOpti
         oldpt = point;
 
     }
-    // Unlock the plot access
-    LeaveCriticalSection(&pElement->m_CritSectionForPlot);
 
     if (! bOptimized)
     {
@@ -2485,20 +2498,23 @@ void CDMGraphCtrl::PlotElementPoints(HDC hDC, CGraphElement* pElement, BOOL bOpt
     InflateRect(&BoundingRect, -pElement->m_nLineWidth, -pElement->m_nLineWidth);
     //BoundingRect.NormalizeRect ();
 
-    // Lock the plot access
-    EnterCriticalSection(&pElement->m_CritSectionForPlot);
-
     POINT point;
     CElementPoint pt;
     VARIANT_BOOL bXLog, bYLog;
     POINT oldpt;
+
+    m_pAxis[ HorizontalX ]->get_Log(&bXLog);
+    m_pAxis[ VerticalY  ]->get_Log(&bYLog);
+
+    // Lock the plot access while the visible points are reduced to a few per pixel column
+    EnterCriticalSection(&pElement->m_CritSectionForPlot);
+    pElement->m_PointList.GetDrawPoints(dRangeX[MIN], dRangeX[MAX], dResX, bXLog, m_DrawPointList);
+    LeaveCriticalSection(&pElement->m_CritSectionForPlot);
+
     //Proceed only if it contains any points
-    if ( pElement->m_PointList.GetSize() > 0 )
+    if ( m_DrawPointList.size() > 0 )
     {
-        pt = pElement->m_PointList[0];
-
-        m_pAxis[ HorizontalX ]->get_Log(&bXLog);
-        m_pAxis[ VerticalY  ]->get_Log(&bYLog);
+        pt = m_DrawPointList[0];
 
         if(bXLog)
         {
@@ -2533,11 +2549,9 @@ void CDMGraphCtrl::PlotElementPoints(HDC hDC, CGraphElement* pElement, BOOL bOpt
 
 
     //Start plot all available data.
-    for(int i=0; i<pElement->m_PointList.GetSize(); i++)
+    for(int i=0; i<(int)m_DrawPointList.size(); i++)
     {
-        //pt = pElement->m_PointList[i];
-        pt.x = pElement->m_PointList[i].x;
-        pt.y = pElement->m_PointList[i].y;
+        pt = m_DrawPointList[i];
 
         if(bXLog)
         {
@@ -2621,8 +2635,6 @@ void CDMGraphCtrl::PlotElementPoints(HDC hDC, CGraphElement* pElement, BOOL bOpt
         oldpt = point;
 
     }
-    // Unlock the plot access
-    LeaveCriticalSection(&pElement->m_CritSectionForPlot);
 
     if (! bOptimized)
     {
@@ -2665,6 +2677,8 @@ LRESULT CDMGraphCtrl::OnCreate(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bH
     m_ttip.SendMessage(TTM_SETDELAYTIME, TTDT_INITIAL, 0);
 
     ::SetClassLongPtr(m_hWnd, GCL_HCURSOR, (LONG_PTR)LoadCursor(nullptr, IDC_CROSS));
+
+    m_bPlotTimer = (SetTimer(PLOT_TIMER_ID, PLOT_FRAME_MS) != 0);
     return 0;
 }
 
@@ -2888,6 +2902,33 @@ LRESULT CDMGraphCtrl::OnKillFocus(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL&
     return 0;
 }
 
+LRESULT CDMGraphCtrl::OnTimer(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled)
+{
+    if(wParam != PLOT_TIMER_ID)
+    {
+        bHandled = FALSE;
+        return 0;
+    }
+
+    //draw the points plotted since the last frame at once
+    if(InterlockedExchange(&m_lPlotChanged, 0))
+    {
+        Refresh(FALSE);
+    }
+    return 0;
+}
+
+LRESULT CDMGraphCtrl::OnDestroy(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled)
+{
+    if(m_bPlotTimer)
+    {
+        KillTimer(PLOT_TIMER_ID);
+        m_bPlotTimer = FALSE;
+    }
+    bHandled = FALSE;
+    return 0;
+}
+
 ////////////////////////////////////////////////////////
 // display the property pages of the control at runtime.
 //
@@ -24,9 +24,8 @@
 
 /* Project includes */
 #include "AscLogConverter.h"
+#include "AscLogStream.h"
 
-extern "C" int nConvertFile(FILE* fpInputFile, FILE* fpOutputFile);
-extern "C" char gchErrorString[255];
 /**
  * \brief Constructor
  *
@@ -167,16 +166,29 @@ HRESULT CAscLogConverter::ConvertFile(string& chInputFile, string& chOutputFile)
     HRESULT hResult = S_OK;
     FILE* fpInputFile = NULL;
     FILE* fpOutputFile = NULL;
-    fopen_s(&fpInputFile, chInputFile.c_str(), _T("r"));
+    fopen_s(&fpInputFile, chInputFile.c_str(), _T("rb"));
 
     if(NULL != fpInputFile)
     {
-        fopen_s(&fpOutputFile, chOutputFile.c_str(), _T("w"));
+        fopen_s(&fpOutputFile, chOutputFile.c_str(), _T("wb"));
 
         if(NULL != fpOutputFile)
         {
-            nConvertFile(fpInputFile, fpOutputFile);
-            m_omstrConversionStatus = gchErrorString;
+            CAscLogStream ouStream;
+            if (ouStream.hConvert(fpInputFile, fpOutputFile) != S_OK)
+            {
+                m_omstrConversionStatus = _("Conversion failed");
+                hResult = S_FALSE;
+            }
+            else if (false == ouStream.bTimeStampFound())
+            {
+                m_omstrConversionStatus = _("Proper Header was not found in ASC File.Logging Mode is Assumed as Absolute & Numeric Format Assumed as Hex");
+            }
+            else
+            {
+                m_omstrConversionStatus = _("Conversion Completed Successfully");
+                ouStream.vAppendThroughput(m_omstrConversionStatus);
+            }
             fclose(fpInputFile);
             fclose(fpOutputFile);
         }
@@ -95,7 +95,6 @@ DllMain(HINSTANCE hInstance, DWORD dwReason, LPVOID lpReserved)
 #pragma managed(pop)
 #endif
 
-extern "C" int nConvertFile(FILE* fpInputFile, FILE* fpOutputFile);
 extern "C" __declspec(dllexport) HRESULT GetBaseConverter(CBaseConverter*& pouConverter)
 {
     pouConverter = new CAscLogConverter();
@@ -0,0 +1,493 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      AscLogStream.cpp
+ * \brief     Implementation of the CAscLogStream class.
+ *
+ * Converts CANoe ASC lines into BUSMASTER CAN log lines.
+ */
+
+/* Project includes */
+#include "AscLogStream.h"
+
+#define DEF_LOG_END_TEXT            "\r\n***END DATE AND TIME ***"
+#define DEF_LOG_STOP_TEXT           "\r\n***[STOP LOGGING SESSION]***\r\n"
+
+static const char* const sg_apchMonths[] =
+{
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+/**
+ * \brief Constructor
+ *
+ * Constructor of CAscLogStream, hex numbers and absolute time are the defaults.
+ */
+CAscLogStream::CAscLogStream(void)
+{
+    m_sBase.m_bFound = false;
+    m_sBase.m_bDecimal = false;
+    m_sBase.m_bRelative = false;
+
+    m_sDate.m_bFound = false;
+    m_sDate.m_nDay = 1;
+    m_sDate.m_nMonth = 1;
+    m_sDate.m_nYear = 2000;
+    m_sDate.m_nHour = 1;
+    m_sDate.m_nMins = 1;
+    m_sDate.m_nSec = 1;
+
+    m_bFormatLines = false;
+}
+
+bool CAscLogStream::bTimeStampFound(void) const
+{
+    return m_sBase.m_bFound;
+}
+
+/**
+ * \brief     Enables the number format lines
+ * \param[in] bFormatLines true to write them
+ *
+ * The log header holds only the last number format of the file. A reader
+ * that takes the converted chunks directly, like the log export, needs the
+ * format in effect at every chunk start and every change.
+ */
+void CAscLogStream::vSetFormatLines(bool bFormatLines)
+{
+    m_bFormatLines = bFormatLines;
+}
+
+size_t CAscLogStream::nGetHeaderReserve(void) const
+{
+    return defASC_LOG_HEADER_SIZE;
+}
+
+/**
+ * \brief      Writes the log file header
+ * \param[out] ouWriter Header text
+ *
+ * Called after the last line, with the last "base" and "date" values.
+ */
+void CAscLogStream::vWriteHeader(CLineWriter& ouWriter)
+{
+    ouWriter.vAppend("***BUSMASTER Ver " BUSMASTER_VER "***\r\n");
+    ouWriter.vAppend("***PROTOCOL CAN***\r\n");
+    ouWriter.vAppend("***NOTE: PLEASE DO NOT EDIT THIS DOCUMENT***\r\n");
+    ouWriter.vAppend("***[START LOGGING SESSION]***\r\n");
+
+    ouWriter.vAppend("***START DATE AND TIME ");
+    ouWriter.vAppendUInt(m_sDate.m_nDay);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt(m_sDate.m_nMonth);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt(m_sDate.m_nYear);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppendUInt(m_sDate.m_nHour);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt(m_sDate.m_nMins);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt(m_sDate.m_nSec);
+    ouWriter.vAppend(":000***\r\n");
+
+    ouWriter.vAppend(m_sBase.m_bDecimal ? "***DEC***\r\n" : "***HEX***\r\n");
+    ouWriter.vAppend(m_sBase.m_bRelative ? "***RELATIVE MODE***\r\n" : "***ABSOLUTE MODE***\r\n");
+    ouWriter.vAppend("***START DATABASE FILES***\r\n");
+    ouWriter.vAppend("***END DATABASE FILES***\r\n");
+    ouWriter.vAppend("***<Time><Tx/Rx><Channel><CAN ID><Type><DLC><DataBytes>***");
+}
+
+void CAscLogStream::vBeginWindow(UINT unChunks)
+{
+    if (m_ouChunkStates.size() < unChunks)
+    {
+        m_ouChunkStates.resize(unChunks);
+    }
+}
+
+/**
+ * \brief     Collects the "base" and "date" lines of a chunk
+ * \param[in] unChunk Chunk index
+ * \param[in] pchBegin Chunk start
+ * \param[in] pchEnd Chunk end
+ */
+void CAscLogStream::vScanChunk(UINT unChunk, const char* pchBegin, const char* pchEnd)
+{
+    sCHUNK_STATE& sState = m_ouChunkStates[unChunk];
+    sState.m_sLastBase.m_bFound = false;
+    sState.m_sLastDate.m_bFound = false;
+
+    const char* pchLine = pchBegin;
+    while (pchLine < pchEnd)
+    {
+        const char* pchLineEnd = (const char*)memchr(pchLine, '\n', pchEnd - pchLine);
+        if (NULL == pchLineEnd)
+        {
+            pchLineEnd = pchEnd;
+        }
+
+        //Skip message lines without tokenizing them
+        const char* pchFirst = pchLine;
+        while ( (pchFirst < pchLineEnd) && ((*pchFirst == ' ') || (*pchFirst == '\t')) )
+        {
+            pchFirst++;
+        }
+        if ( (pchFirst < pchLineEnd) &&
+                ((*pchFirst == 'b') || (*pchFirst == 'B') || (*pchFirst == 'd') || (*pchFirst == 'D')) )
+        {
+            CLineTokenizer ouTokens(pchFirst, pchLineEnd);
+            STEXTVIEW sToken;
+            ouTokens.bNext(sToken);
+            if (sToken.bEqualsNoCase("base"))
+            {
+                bParseBase(ouTokens, sState.m_sLastBase);
+            }
+            else if (sToken.bEqualsNoCase("date"))
+            {
+                bParseDate(ouTokens, sState.m_sLastDate);
+            }
+        }
+        pchLine = pchLineEnd + 1;
+    }
+}
+
+/**
+ * \brief     Hands the number format from chunk to chunk
+ * \param[in] unChunks Number of chunks
+ */
+void CAscLogStream::vJoinChunks(UINT unChunks)
+{
+    for (UINT i = 0; i < unChunks; i++)
+    {
+        sCHUNK_STATE& sState = m_ouChunkStates[i];
+        sState.m_sStartBase = m_sBase;
+        if (sState.m_sLastBase.m_bFound)
+        {
+            m_sBase = sState.m_sLastBase;
+        }
+        if (sState.m_sLastDate.m_bFound)
+        {
+            m_sDate = sState.m_sLastDate;
+        }
+    }
+}
+
+/**
+ * \brief      Converts the lines of a chunk
+ * \param[in]  unChunk Chunk index
+ * \param[in]  pchBegin Chunk start
+ * \param[in]  pchEnd Chunk end
+ * \param[out] ouWriter Converted lines
+ */
+void CAscLogStream::vConvertChunk(UINT unChunk, const char* pchBegin, const char* pchEnd, CLineWriter& ouWriter)
+{
+    sASC_BASE sBase = m_ouChunkStates[unChunk].m_sStartBase;
+    if (m_bFormatLines)
+    {
+        vWriteFormatLine(sBase, ouWriter);
+    }
+
+    const char* pchLine = pchBegin;
+    while (pchLine < pchEnd)
+    {
+        const char* pchLineEnd = (const char*)memchr(pchLine, '\n', pchEnd - pchLine);
+        if (NULL == pchLineEnd)
+        {
+            pchLineEnd = pchEnd;
+        }
+
+        CLineTokenizer ouTokens(pchLine, pchLineEnd);
+        STEXTVIEW sToken;
+        if (ouTokens.bNext(sToken))
+        {
+            if ( (sToken.m_pchText[0] >= '0') && (sToken.m_pchText[0] <= '9') )
+            {
+                vConvertMessage(sToken, ouTokens, sBase.m_bDecimal, ouWriter);
+            }
+            else if (sToken.bEqualsNoCase("base"))
+            {
+                if (bParseBase(ouTokens, sBase) && m_bFormatLines)
+                {
+                    vWriteFormatLine(sBase, ouWriter);
+                }
+            }
+            else if (sToken.bEqualsNoCase("End"))
+            {
+                if (ouTokens.bNext(sToken) && sToken.bEqualsNoCase("Triggerblock"))
+                {
+                    ouWriter.vAppend(DEF_LOG_END_TEXT);
+                    ouWriter.vAppend(DEF_LOG_STOP_TEXT);
+                }
+            }
+        }
+        pchLine = pchLineEnd + 1;
+    }
+}
+
+/**
+ * \brief        Parses the rest of a "base" line
+ * \param[in]    ouTokens Tokens following "base"
+ * \param[inout] sBase Number format and time mode, changed only if the line is valid
+ * \return       true if the line is valid
+ *
+ * Accepts "base hex|dec timestamps absolute|relative" and
+ * "base hex|dec no internal events logged", the latter meaning absolute time.
+ */
+bool CAscLogStream::bParseBase(CLineTokenizer& ouTokens, sASC_BASE& sBase)
+{
+    STEXTVIEW sToken;
+    bool bDecimal = false;
+    bool bRelative = false;
+
+    if (false == ouTokens.bNext(sToken))
+    {
+        return false;
+    }
+    if (sToken.bEqualsNoCase("dec"))
+    {
+        bDecimal = true;
+    }
+    else if (false == sToken.bEqualsNoCase("hex"))
+    {
+        return false;
+    }
+
+    if (false == ouTokens.bNext(sToken))
+    {
+        return false;
+    }
+    if (sToken.bEqualsNoCase("timestamps"))
+    {
+        if (false == ouTokens.bNext(sToken))
+        {
+            return false;
+        }
+        if (sToken.bEqualsNoCase("relative"))
+        {
+            bRelative = true;
+        }
+        else if (false == sToken.bEqualsNoCase("absolute"))
+        {
+            return false;
+        }
+    }
+    else if (false == sToken.bEqualsNoCase("no"))
+    {
+        return false;
+    }
+
+    sBase.m_bFound = true;
+    sBase.m_bDecimal = bDecimal;
+    sBase.m_bRelative = bRelative;
+    return true;
+}
+
+void CAscLogStream::vWriteFormatLine(const sASC_BASE& sBase, CLineWriter& ouWriter)
+{
+    ouWriter.vAppend(sBase.m_bDecimal ? "\r\n***DEC***" : "\r\n***HEX***");
+}
+
+/**
+ * \brief        Parses the rest of a "date" line
+ * \param[in]    ouTokens Tokens following "date"
+ * \param[inout] sDate Start date, changed only if the line is valid
+ * \return       true if the line is valid
+ *
+ * Accepts "date Wed Dec 7 12:23:39 pm 2011", am/pm being optional.
+ */
+bool CAscLogStream::bParseDate(CLineTokenizer& ouTokens, sASC_DATE& sDate)
+{
+    STEXTVIEW sWeekDay, sMonth, sDay, sTime, sToken;
+    if ( (false == ouTokens.bNext(sWeekDay)) || (false == ouTokens.bNext(sMonth)) ||
+            (false == ouTokens.bNext(sDay)) || (false == ouTokens.bNext(sTime)) ||
+            (false == ouTokens.bNext(sToken)) || (false == sDay.bIsNumber()) )
+    {
+        return false;
+    }
+
+    int nMonth = 0;
+    for (int i = 0; i < 12; i++)
+    {
+        if (sMonth.bEqualsNoCase(sg_apchMonths[i]))
+        {
+            nMonth = i + 1;
+            break;
+        }
+    }
+    if (0 == nMonth)
+    {
+        return false;
+    }
+
+    //hh:mm:ss
+    int anTime[3] = { 0, 0, 0 };
+    int nField = 0;
+    for (size_t i = 0; i < sTime.m_nLength; i++)
+    {
+        char chValue = sTime.m_pchText[i];
+        if ( (':' == chValue) && (nField < 2) )
+        {
+            nField++;
+        }
+        else if ( (chValue >= '0') && (chValue <= '9') )
+        {
+            anTime[nField] = (anTime[nField] * 10) + (chValue - '0');
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (nField != 2)
+    {
+        return false;
+    }
+
+    if (sToken.bEqualsNoCase("am") || sToken.bEqualsNoCase("pm"))
+    {
+        anTime[0] = anTime[0] % 12;
+        if (sToken.bEqualsNoCase("pm"))
+        {
+            anTime[0] += 12;
+        }
+        if (false == ouTokens.bNext(sToken))
+        {
+            return false;
+        }
+    }
+    if (false == sToken.bIsNumber())
+    {
+        return false;
+    }
+
+    sDate.m_bFound = true;
+    sDate.m_nDay = (int)sDay.un64GetNumber();
+    sDate.m_nMonth = nMonth;
+    sDate.m_nYear = (int)sToken.un64GetNumber();
+    sDate.m_nHour = anTime[0];
+    sDate.m_nMins = anTime[1];
+    sDate.m_nSec = anTime[2];
+    return true;
+}
+
+/**
+ * \brief      Converts a message line
+ * \param[in]  sTime First token of the line, seconds with fraction
+ * \param[in]  ouTokens Remaining tokens
+ * \param[in]  bDecimal Numbers of the line are decimal
+ * \param[out] ouWriter Converted line
+ *
+ * "<time> <channel> <id>[x] <Rx|Tx|TxRq> d <dlc> <data bytes>" or
+ * "<time> <channel> <id>[x] <Rx|Tx|TxRq> r" becomes
+ * "<h:m:s:ffff> <Rx|Tx> <channel> <id> <s|x>[r] <dlc> <data bytes>".
+ * Anything else, like error frames or comments, is skipped.
+ */
+void CAscLogStream::vConvertMessage(const STEXTVIEW& sTime, CLineTokenizer& ouTokens, bool bDecimal, CLineWriter& ouWriter)
+{
+    //Seconds and fraction
+    STEXTVIEW sSeconds = sTime, sFraction;
+    const char* pchDot = (const char*)memchr(sTime.m_pchText, '.', sTime.m_nLength);
+    if (NULL != pchDot)
+    {
+        sSeconds.m_nLength = pchDot - sTime.m_pchText;
+        sFraction.m_pchText = pchDot + 1;
+        sFraction.m_nLength = sTime.m_nLength - sSeconds.m_nLength - 1;
+    }
+    if ( (false == sSeconds.bIsNumber()) || ((sFraction.m_nLength > 0) && (false == sFraction.bIsNumber())) )
+    {
+        return;
+    }
+
+    STEXTVIEW sChannel, sId, sDir, sType, sDlc, sByte;
+    if ( (false == ouTokens.bNext(sChannel)) || (false == sChannel.bIsNumber()) ||
+            (false == ouTokens.bNext(sId)) || (false == ouTokens.bNext(sDir)) ||
+            (false == ouTokens.bNext(sType)) )
+    {
+        return;
+    }
+
+    bool bExtended = (sId.m_nLength > 1) && ((sId.m_pchText[sId.m_nLength - 1] == 'x') || (sId.m_pchText[sId.m_nLength - 1] == 'X'));
+    if (bExtended)
+    {
+        sId.m_nLength--;
+    }
+    if (false == sId.bIsHexNumber())
+    {
+        return;
+    }
+
+    if (sDir.bEqualsNoCase("TxRq"))
+    {
+        sDir.m_nLength = 2;
+    }
+    else if ( (false == sDir.bEqualsNoCase("Tx")) && (false == sDir.bEqualsNoCase("Rx")) )
+    {
+        return;
+    }
+
+    bool bRemote = sType.bEqualsNoCase("r");
+    if ( (false == bRemote) &&
+            ((false == sType.bIsHexNumber()) || (false == ouTokens.bNext(sDlc)) || (false == sDlc.bIsHexNumber())) )
+    {
+        return;
+    }
+
+    unsigned __int64 un64Seconds = sSeconds.un64GetNumber();
+    ouWriter.vAppend("\r\n");
+    ouWriter.vAppendUInt(un64Seconds / 3600);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt((un64Seconds / 60) % 60);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt(un64Seconds % 60);
+    ouWriter.vAppendChar(':');
+    for (size_t i = 0; i < 4; i++)
+    {
+        ouWriter.vAppendChar((i < sFraction.m_nLength) ? sFraction.m_pchText[i] : '0');
+    }
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppend(sDir);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppend(sChannel);
+    ouWriter.vAppendChar(' ');
+    if (false == bDecimal)
+    {
+        ouWriter.vAppend("0x", 2);
+    }
+    ouWriter.vAppend(sId);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppendChar(bExtended ? 'x' : 's');
+
+    if (bRemote)
+    {
+        ouWriter.vAppend("r 0 ");
+        return;
+    }
+
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppend(sDlc);
+    ouWriter.vAppendChar(' ');
+    //Data bytes end with the line or with "Length = ..."
+    while (ouTokens.bNext(sByte) && sByte.bIsHexNumber())
+    {
+        //3 digits per byte in decimal mode
+        for (size_t i = sByte.m_nLength; bDecimal && (i < 3); i++)
+        {
+            ouWriter.vAppendChar('0');
+        }
+        ouWriter.vAppend(sByte);
+        ouWriter.vAppendChar(' ');
+    }
+}
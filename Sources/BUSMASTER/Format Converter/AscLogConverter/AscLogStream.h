@@ -0,0 +1,86 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      AscLogStream.h
+ * \brief     Definition of the CAscLogStream class.
+ *
+ * Converts CANoe ASC lines into BUSMASTER CAN log lines.
+ */
+
+#pragma once
+
+/* Project includes */
+#include "../FormatConverterApp/LineStreamConverter.h"
+
+#define defASC_LOG_HEADER_SIZE      400
+
+/**
+ * ASC to LOG conversion. The number format of a message line is given by the
+ * last "base" line before it, the log header takes the last "base" and
+ * "date" lines of the file.
+ */
+class CAscLogStream : public CLineStreamConverter
+{
+public:
+    CAscLogStream(void);
+
+    //A "base" line was found, otherwise absolute hex mode was assumed
+    bool bTimeStampFound(void) const;
+    //Writes "***HEX***" or "***DEC***" at every chunk start and "base" line, for readers of the chunks
+    void vSetFormatLines(bool bFormatLines);
+
+protected:
+    virtual size_t nGetHeaderReserve(void) const;
+    virtual void vWriteHeader(CLineWriter& ouWriter);
+    virtual void vBeginWindow(UINT unChunks);
+    virtual void vScanChunk(UINT unChunk, const char* pchBegin, const char* pchEnd);
+    virtual void vJoinChunks(UINT unChunks);
+    virtual void vConvertChunk(UINT unChunk, const char* pchBegin, const char* pchEnd, CLineWriter& ouWriter);
+
+private:
+    struct sASC_BASE
+    {
+        bool m_bFound;
+        bool m_bDecimal;
+        bool m_bRelative;
+    };
+    struct sASC_DATE
+    {
+        bool m_bFound;
+        int m_nDay;
+        int m_nMonth;
+        int m_nYear;
+        int m_nHour;
+        int m_nMins;
+        int m_nSec;
+    };
+    struct sCHUNK_STATE
+    {
+        sASC_BASE m_sStartBase;     // In effect at the chunk start
+        sASC_BASE m_sLastBase;      // Last "base" line of the chunk
+        sASC_DATE m_sLastDate;      // Last "date" line of the chunk
+    };
+
+    sASC_BASE m_sBase;              // In effect after the chunks joined so far
+    sASC_DATE m_sDate;
+    bool m_bFormatLines;
+    std::vector<sCHUNK_STATE> m_ouChunkStates;
+
+    static bool bParseBase(CLineTokenizer& ouTokens, sASC_BASE& sBase);
+    static void vWriteFormatLine(const sASC_BASE& sBase, CLineWriter& ouWriter);
+    static bool bParseDate(CLineTokenizer& ouTokens, sASC_DATE& sDate);
+    static void vConvertMessage(const STEXTVIEW& sTime, CLineTokenizer& ouTokens, bool bDecimal, CLineWriter& ouWriter);
+};
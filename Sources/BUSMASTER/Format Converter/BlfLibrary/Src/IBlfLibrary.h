@@ -108,8 +108,61 @@ public:
     virtual SYSTEMTIME GetStartTime() = 0;
 };
 
+//! Reader of big BLF files. Unlike IBlfLibrary it doesn't load the whole file: the file is memory mapped,
+//! only an index of its log containers is kept, and containers are uncompressed on demand into a small cache.
+//! The objects are indexed while they are read, so opening costs only the container headers.
+class IBlfReader : public IDumper
+{
+public:
+    //! Enables logging mechanism of the library. Disabled by default.
+    virtual bool EnableLogging(const std::string& sLogFilePath) = 0;
+
+    //! Opens desired BLF file and reads the headers of its log containers, no container is uncompressed.
+    //! \param sBlfFilePath Path to BLF file that should be opened.
+    virtual HRESULT Open(const std::string& sBlfFilePath) = 0;
+    //! Releases the file, the index and the cache.
+    virtual bool Close() = 0;
+
+    //! Returns start time for opened blf file
+    virtual SYSTEMTIME GetStartTime() = 0;
+    //! Returns count of all BLF objects in the file. It is the count from BLF file header until the file was
+    //! read to the end, then the count of objects that were read.
+    virtual ULONGLONG GetBlfObjectsCount() = 0;
+    //! Returns timestamp of the first timestamped object in the file, reads the file up to it if it wasn't yet.
+    virtual ULONGLONG GetFirstTimestamp() = 0;
+    //! Returns timestamp of the last timestamped object read so far, the one of the file once it was read to the end.
+    virtual ULONGLONG GetLastTimestamp() = 0;
+
+    //! Sets the count of uncompressed containers kept in memory (at least 1).
+    virtual void SetCacheSize(size_t containers) = 0;
+    //! Limits objects returned by GetNextBlfObject.
+    //! \param kindMask Bit (1 << BlfObjectKind) for every accepted kind, 0 accepts all kinds.
+    //! \param channelNo Accepted channel of CAN messages, 0 accepts all channels.
+    virtual void SetFilter(DWORD kindMask, WORD channelNo) = 0;
+
+    //! Moves to the first object of the file.
+    virtual bool Rewind() = 0;
+    //! Moves to the first object with a timestamp not less than desired one.
+    //! \return false if there is no such object.
+    virtual bool SeekToTime(ULONGLONG timestamp) = 0;
+    //! Returns position of the next object, to come back to it via SetPosition.
+    virtual ULONGLONG GetPosition() = 0;
+    //! Moves to desired position, it shall be returned by GetPosition for the same file.
+    virtual bool SetPosition(ULONGLONG position) = 0;
+    //! Returns the next object accepted by the filter, or NULL at the end of the file.
+    //! The object stays valid until the next call.
+    virtual IBlfObject* GetNextBlfObject() = 0;
+};
+
 //! Returns the library interface.
 BLFLIBRARY_API IBlfLibrary* GetIBlfLibrary();
+//! Returns the reader interface.
+BLFLIBRARY_API IBlfReader* GetIBlfReader();
+//! Creates a reader of its own, for a caller that keeps its file open next to other readers.
+//! Exported without name decoration to be found by GetProcAddress.
+extern "C" BLFLIBRARY_API IBlfReader* CreateIBlfReader();
+//! Closes and destroys a reader created by CreateIBlfReader.
+extern "C" BLFLIBRARY_API void ReleaseIBlfReader(IBlfReader* pReader);
 
 } // namespace blf
 
@@ -4,6 +4,12 @@
 #define BLF_OBJECT_TYPE_CAN_MESSAGE 1
 #define BLF_OBJECT_TYPE_LOG_CONTAINER 10
 
+// Results of IBlfLibrary::Load and IBlfReader::Open
+#define ERR_INPUT_FILE_OPEN              (-1)
+#define ERR_INVALID_HEADER               (-2)
+#define ERR_INVALID_BLF_SIGNATURE        (-3)
+#define ERR_UNSUPPORTED_BLF_OBJ          (-4)
+
 //! Structure that describes common information in BLF file (start part of BLF file).
 struct BlfFileHeader
 {
@@ -27,10 +27,6 @@
 #include "ErrorManager.h"
 
 #define RAW_CANMESSAGE_FLAGS_DIRECTION_MASK 0xF
-#define ERR_INPUT_FILE_OPEN              (-1)
-#define ERR_INVALID_HEADER               (-2)
-#define ERR_INVALID_BLF_SIGNATURE        (-3)
-#define ERR_UNSUPPORTED_BLF_OBJ          (-4)
 
 namespace BLF
 {
@@ -37,6 +37,10 @@ public:
     {
         return NULL;
     }
+    virtual bool Dump()
+    {
+        return true;
+    }
 };
 
 //! Just to implement ICanMessage - see that interface for details.
@@ -0,0 +1,560 @@
+/*
+ * BLF Library
+ * (c) 2014, Robert Bosch Engineering and Business Solutions. All rights reserved.
+ *
+ * Annotation:  Implementation of the BLF reader.
+ *              Opening a file reads only the headers of its log containers. Reading uncompresses the containers
+ *              on demand and indexes where the objects start, so seeking back doesn't scan the file again.
+ */
+
+#include "zlib.h"
+
+#include "BlfReader.h"
+#include "ErrorManager.h"
+
+// Count of uncompressed containers kept in memory by default
+#define BLF_READER_DEFAULT_CACHE_SIZE 8
+
+namespace BLF
+{
+
+BLFLIBRARY_API IBlfReader* GetIBlfReader()
+{
+    static BlfReader reader;
+    return &reader;
+}
+
+BLFLIBRARY_API IBlfReader* CreateIBlfReader()
+{
+    return new BlfReader();
+}
+
+BLFLIBRARY_API void ReleaseIBlfReader(IBlfReader* pReader)
+{
+    delete (BlfReader*)pReader;
+}
+
+//////////////////////////////////////////////////////
+// BlfReader
+//////////////////////////////////////////////////////
+
+BlfReader::BlfReader()
+    : m_DataSize(0), m_CacheSize(BLF_READER_DEFAULT_CACHE_SIZE), m_Container(0), m_Pos(0), m_ObjectLen(0)
+    , m_CanMessage(0, 0, 0, m_Object.m_Data, 0, 0), m_KindMask(0), m_ChannelNo(0)
+    , m_ObjectsCount(0), m_ScanPos(0), m_ScannedContainers(0), m_ScannedObjects(0)
+    , m_FirstTimestamp(0), m_LastTimestamp(0), m_MaxTimestamp(0), m_HasTimestamps(false)
+{
+    memset(&m_Object, 0, sizeof(BlfObject_CanMessage));
+    memset(&m_StartTime, 0, sizeof(SYSTEMTIME));
+}
+
+BlfReader::~BlfReader()
+{
+    Close();
+}
+
+bool BlfReader::EnableLogging(const std::string& sLogFilePath)
+{
+    // Enable error/warning/info messages logging
+    EM_ENABLE_LOGGING(sLogFilePath);
+    EM_INFO("BLF Reader log:");
+    EM_LOG_DEPTH_INC();
+    return true;
+}
+
+HRESULT BlfReader::Open(const std::string& sBlfFilePath)
+{
+    EM_INFO("BLF file opening - start");
+    EM_LOG_DEPTH_INC();
+    HRESULT result = S_OK;
+
+    // Call close function for the case when this method wasn't correctly called manually
+    Close();
+
+    // Map the file
+    if (!m_File.Open(sBlfFilePath))
+    {
+        result = ERR_INPUT_FILE_OPEN;
+    }
+
+    // Read BLF file header
+    BlfFileHeader blfFileHeader;
+    if (S_OK == result)
+    {
+        EM_INFO("Read BLF file header");
+        if (!m_File.GetData(0, &blfFileHeader, sizeof(BlfFileHeader)))
+        {
+            result = ERR_INVALID_HEADER;
+        }
+    }
+
+    // Check BLF file signature, the first four bytes shall be "LOGG"
+    if (S_OK == result)
+    {
+        EM_INFO("Check BLF file signature");
+        if (blfFileHeader.m_Signature != 'GGOL')
+        {
+            EM_ERROR(std::string("Unexpected BLF file signature (") + (int)blfFileHeader.m_Signature + ").");
+            result = ERR_INVALID_BLF_SIGNATURE;
+        }
+    }
+
+    // Index log containers
+    if (S_OK == result)
+    {
+        if (!BuildIndex(min(blfFileHeader.m_FileSize, m_File.GetSize())))
+        {
+            result = ERR_UNSUPPORTED_BLF_OBJ;
+        }
+    }
+
+    if (S_OK == result)
+    {
+        m_StartTime = blfFileHeader.m_TimeStart;
+        m_ObjectsCount = blfFileHeader.m_CountOfObjects;
+    }
+    else
+    {
+        Close();
+    }
+
+    EM_LOG_DEPTH_DEC();
+    EM_INFO("BLF file opening - finish");
+    return result;
+}
+
+bool BlfReader::BuildIndex(ULONGLONG fileSize)
+{
+    EM_INFO("Building index of BLF log containers - start");
+    EM_LOG_DEPTH_INC();
+    bool isOk = true;
+
+    ULONGLONG offset = sizeof(BlfFileHeader);
+    while (isOk && (offset + sizeof(BlfObjectHeaderBase) <= fileSize))
+    {
+        // Read BLF object header
+        BlfObject_LogContainer logContainer;
+        memset(&logContainer, 0, sizeof(BlfObject_LogContainer));
+        isOk = m_File.GetData(offset, &logContainer.m_Header, sizeof(BlfObjectHeaderBase));
+        if (!isOk)
+        {
+            break;
+        }
+
+        // Skip objects other than log containers
+        if (BLF_OBJECT_TYPE_LOG_CONTAINER != logContainer.m_Header.m_ObjectType)
+        {
+            EM_WARNING(std::string("Unexpected BLF object (code: ") + (int)logContainer.m_Header.m_ObjectType + ") is found and skipped.");
+            isOk = (logContainer.m_Header.m_ObjectSize >= sizeof(BlfObjectHeaderBase));
+            if (!isOk)
+            {
+                EM_ERROR(std::string("Broken BLF object (size: ") + (int)logContainer.m_Header.m_ObjectSize + ").");
+            }
+            offset += logContainer.m_Header.m_ObjectSize;
+            continue;
+        }
+
+        isOk = (logContainer.m_Header.m_ObjectSize >= sizeof(BlfObject_LogContainer))
+               && m_File.GetData(offset, &logContainer, sizeof(BlfObject_LogContainer));
+        if (!isOk)
+        {
+            EM_ERROR("Broken BLF log container.");
+            break;
+        }
+
+        // Objects of the container are found when they are read
+        ContainerIndex entry;
+        entry.m_FileOffset = offset + sizeof(BlfObject_LogContainer);
+        entry.m_SizeCompressed = logContainer.m_Header.m_ObjectSize - sizeof(BlfObject_LogContainer);
+        entry.m_SizeUncompressed = (DWORD)logContainer.m_SizeUncompressed;
+        entry.m_Pos = m_DataSize;
+        entry.m_FirstObjectPos = m_DataSize + entry.m_SizeUncompressed;
+        entry.m_ObjectsCount = 0;
+        entry.m_LastTimestamp = 0;
+        m_Containers.push_back(entry);
+        m_DataSize += entry.m_SizeUncompressed;
+
+        // Skip container data and its padding bytes
+        offset = entry.m_FileOffset + entry.m_SizeCompressed + entry.m_SizeCompressed % 4;
+    }
+
+    EM_INFO(std::string("Containers: ") + m_Containers.size() + ".");
+
+    EM_LOG_DEPTH_DEC();
+    EM_INFO("Building index of BLF log containers - finish");
+    return isOk;
+}
+
+void BlfReader::IndexObject(ULONGLONG pos, ULONGLONG nextPos)
+{
+    ContainerIndex& entry = m_Containers[FindContainer(pos)];
+    if (0 == entry.m_ObjectsCount)
+    {
+        entry.m_FirstObjectPos = pos;
+    }
+    ++entry.m_ObjectsCount;
+    ++m_ScannedObjects;
+
+    if (HasTimestamp())
+    {
+        ULONGLONG timestamp = m_Object.m_Header.m_TimeStamp;
+        if (!m_HasTimestamps)
+        {
+            m_FirstTimestamp = timestamp;
+            m_HasTimestamps = true;
+        }
+        m_LastTimestamp = timestamp;
+        // Kept non-decreasing for SeekToTime, timestamps of several channels may be out of order
+        m_MaxTimestamp = max(m_MaxTimestamp, timestamp);
+    }
+
+    // The containers before the one of the following object are complete, the object may span several of them
+    m_ScanPos = nextPos;
+    size_t scannedContainers = (nextPos < m_DataSize) ? FindContainer(nextPos) : m_Containers.size();
+    for (; m_ScannedContainers < scannedContainers; ++m_ScannedContainers)
+    {
+        m_Containers[m_ScannedContainers].m_LastTimestamp = m_MaxTimestamp;
+    }
+    if (m_ScannedContainers == m_Containers.size())
+    {
+        m_ObjectsCount = m_ScannedObjects;
+    }
+}
+
+bool BlfReader::ReadContainer(size_t container, std::vector<char>& data)
+{
+    const ContainerIndex& entry = m_Containers[container];
+
+    const char* pDataCompressed = m_File.GetData(entry.m_FileOffset, entry.m_SizeCompressed);
+    if (NULL == pDataCompressed)
+    {
+        return false;
+    }
+
+    data.resize(entry.m_SizeUncompressed);
+    if (data.empty())
+    {
+        return true;
+    }
+    return UnCompress(pDataCompressed, entry.m_SizeCompressed, &data[0], data.size());
+}
+
+bool BlfReader::UnCompress(const char* pDataCompressed, size_t dataLenCompressed, char* pDataUnCompressed, size_t dataLenUnCompressed)
+{
+    z_stream d_stream; // Decompression stream
+    memset(&d_stream, 0, sizeof(z_stream));
+
+    d_stream.next_in = (Bytef*)pDataCompressed;
+    d_stream.avail_in = (uInt)dataLenCompressed;
+    d_stream.next_out = (Bytef*)pDataUnCompressed;
+    d_stream.avail_out = (uInt)dataLenUnCompressed;
+
+    // The whole container is in memory, so it is uncompressed at once
+    int err = inflateInit(&d_stream);
+    if (Z_OK == err)
+    {
+        err = inflate(&d_stream, Z_FINISH);
+        if ((Z_STREAM_END == err) || (0 == d_stream.avail_out))
+        {
+            err = Z_OK;
+        }
+        inflateEnd(&d_stream);
+    }
+
+    if (Z_OK != err)
+    {
+        EM_ERROR(std::string("Unable to uncompress the data with zlib, error code: ") + err + ".");
+    }
+
+    return (Z_OK == err);
+}
+
+const std::vector<char>* BlfReader::GetContainer(size_t container)
+{
+    std::map<size_t, CachedContainer>::iterator iCached = m_Cache.find(container);
+    if (iCached != m_Cache.end())
+    {
+        m_Lru.splice(m_Lru.begin(), m_Lru, iCached->second.m_LruPos);
+        return &iCached->second.m_Data;
+    }
+
+    // Drop the least recently used containers, the buffer of the last one is reused
+    std::vector<char> data;
+    while (!m_Lru.empty() && (m_Cache.size() >= m_CacheSize))
+    {
+        std::map<size_t, CachedContainer>::iterator iOldest = m_Cache.find(m_Lru.back());
+        data.swap(iOldest->second.m_Data);
+        m_Cache.erase(iOldest);
+        m_Lru.pop_back();
+    }
+
+    if (!ReadContainer(container, data))
+    {
+        return NULL;
+    }
+
+    CachedContainer& cached = m_Cache[container];
+    cached.m_Data.swap(data);
+    m_Lru.push_front(container);
+    cached.m_LruPos = m_Lru.begin();
+    return &cached.m_Data;
+}
+
+size_t BlfReader::FindContainer(ULONGLONG pos)
+{
+    // Most accesses are in the container of the previous access or in the next one
+    for (size_t container = m_Container; (container < m_Container + 2) && (container < m_Containers.size()); ++container)
+    {
+        const ContainerIndex& entry = m_Containers[container];
+        if ((pos >= entry.m_Pos) && (pos < entry.m_Pos + entry.m_SizeUncompressed))
+        {
+            m_Container = container;
+            return m_Container;
+        }
+    }
+
+    // Find the last container that starts not after the position
+    size_t first = 0;
+    size_t last = m_Containers.size();
+    while (first + 1 < last)
+    {
+        size_t middle = (first + last) / 2;
+        if (m_Containers[middle].m_Pos <= pos)
+        {
+            first = middle;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    m_Container = first;
+    return m_Container;
+}
+
+bool BlfReader::CopyData(ULONGLONG pos, char* pData, size_t len)
+{
+    if ((pos > m_DataSize) || (len > m_DataSize - pos))
+    {
+        return false;
+    }
+
+    for (size_t container = FindContainer(pos); len > 0; ++container)
+    {
+        const std::vector<char>* pContainer = GetContainer(container);
+        if (NULL == pContainer)
+        {
+            return false;
+        }
+
+        size_t containerPos = (size_t)(pos - m_Containers[container].m_Pos);
+        size_t copyLen = min(len, pContainer->size() - containerPos);
+        if (copyLen > 0)
+        {
+            memcpy(pData, &(*pContainer)[containerPos], copyLen);
+        }
+        pData += copyLen;
+        pos += copyLen;
+        len -= copyLen;
+    }
+    return true;
+}
+
+bool BlfReader::ReadObject(ULONGLONG pos, ULONGLONG& nextPos)
+{
+    if (pos + sizeof(BlfObjectHeaderBase) > m_DataSize)
+    {
+        return false;
+    }
+
+    BlfObjectHeaderBase& header = m_Object.m_Header.m_Header;
+    if (!CopyData(pos, (char*)&header, sizeof(BlfObjectHeaderBase)))
+    {
+        return false;
+    }
+    if (header.m_ObjectSize < sizeof(BlfObjectHeaderBase))
+    {
+        EM_ERROR(std::string("Broken BLF object (size: ") + (int)header.m_ObjectSize + ").");
+        return false;
+    }
+
+    // Only the beginning of the object is decoded, so the rest is not copied
+    m_ObjectLen = min(sizeof(BlfObject_CanMessage), (size_t)header.m_ObjectSize);
+    if (!CopyData(pos + sizeof(BlfObjectHeaderBase), (char*)&m_Object + sizeof(BlfObjectHeaderBase), m_ObjectLen - sizeof(BlfObjectHeaderBase)))
+    {
+        return false;
+    }
+
+    // Skip the object and its padding bytes
+    nextPos = pos + header.m_ObjectSize + header.m_ObjectSize % 4;
+    if (pos == m_ScanPos)
+    {
+        IndexObject(pos, nextPos);
+    }
+    return true;
+}
+
+IBlfObject* BlfReader::DecodeObject()
+{
+    if ((BLF_OBJECT_TYPE_CAN_MESSAGE == m_Object.m_Header.m_Header.m_ObjectType) && (m_ObjectLen >= sizeof(BlfObject_CanMessage)))
+    {
+        if (((0 != m_KindMask) && (0 == (m_KindMask & (1 << bokCanMessage))))
+                || ((0 != m_ChannelNo) && (m_Object.m_Channel != m_ChannelNo)))
+        {
+            return NULL;
+        }
+        m_CanMessage = CanMessage(m_Object.m_Channel
+                                  , m_Object.m_ID
+                                  , m_Object.m_DLC
+                                  , m_Object.m_Data
+                                  , m_Object.m_Header.m_TimeStamp
+                                  , m_Object.m_Flags);
+        return &m_CanMessage;
+    }
+
+    if ((0 != m_KindMask) && (0 == (m_KindMask & (1 << bokUnknown))))
+    {
+        return NULL;
+    }
+    return &m_UnknownObject;
+}
+
+bool BlfReader::Close()
+{
+    m_File.Close();
+    m_Containers.clear();
+    m_DataSize = 0;
+    m_Cache.clear();
+    m_Lru.clear();
+    m_Container = 0;
+    m_Pos = 0;
+    m_ObjectLen = 0;
+    m_ObjectsCount = 0;
+    m_ScanPos = 0;
+    m_ScannedContainers = 0;
+    m_ScannedObjects = 0;
+    m_FirstTimestamp = 0;
+    m_LastTimestamp = 0;
+    m_MaxTimestamp = 0;
+    m_HasTimestamps = false;
+    return true;
+}
+
+void BlfReader::SetCacheSize(size_t containers)
+{
+    m_CacheSize = max(containers, (size_t)1);
+    while (m_Cache.size() > m_CacheSize)
+    {
+        m_Cache.erase(m_Lru.back());
+        m_Lru.pop_back();
+    }
+}
+
+void BlfReader::SetFilter(DWORD kindMask, WORD channelNo)
+{
+    m_KindMask = kindMask;
+    m_ChannelNo = channelNo;
+}
+
+bool BlfReader::Rewind()
+{
+    m_Pos = 0;
+    return m_File.IsOk();
+}
+
+ULONGLONG BlfReader::GetFirstTimestamp()
+{
+    // Index up to the first timestamped object, GetNextBlfObject returns a copy so m_Object may be overwritten
+    ULONGLONG nextPos = 0;
+    while (!m_HasTimestamps && ReadObject(m_ScanPos, nextPos))
+    {
+        // ReadObject indexes the object and moves m_ScanPos
+    }
+    return m_FirstTimestamp;
+}
+
+bool BlfReader::SeekToTime(ULONGLONG timestamp)
+{
+    // Find the first indexed container with an object that is not earlier than desired timestamp,
+    // m_LastTimestamp of containers doesn't decrease. Without one the search goes on from the first
+    // object that is not indexed yet, indexing the objects on its way.
+    size_t first = 0;
+    size_t last = m_ScannedContainers;
+    while (first < last)
+    {
+        size_t middle = (first + last) / 2;
+        if (m_Containers[middle].m_LastTimestamp < timestamp)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    // The object starts in that container, earlier objects of the container are skipped
+    m_Pos = (first < m_ScannedContainers) ? m_Containers[first].m_FirstObjectPos : m_ScanPos;
+    ULONGLONG nextPos = 0;
+    while (ReadObject(m_Pos, nextPos))
+    {
+        if (HasTimestamp() && (m_Object.m_Header.m_TimeStamp >= timestamp))
+        {
+            return true;
+        }
+        m_Pos = nextPos;
+    }
+    return false;
+}
+
+bool BlfReader::SetPosition(ULONGLONG position)
+{
+    // Positions come from GetPosition, so they are never after the first object that is not indexed yet
+    if (position > m_ScanPos)
+    {
+        return false;
+    }
+    m_Pos = position;
+    return true;
+}
+
+IBlfObject* BlfReader::GetNextBlfObject()
+{
+    ULONGLONG nextPos = 0;
+    while (ReadObject(m_Pos, nextPos))
+    {
+        m_Pos = nextPos;
+        IBlfObject* pObject = DecodeObject();
+        if (NULL != pObject)
+        {
+            return pObject;
+        }
+    }
+    return NULL;
+}
+
+bool BlfReader::Dump()
+{
+    bool isOk = true;
+
+    // Outputs measurement start time in format like:
+    // measurementStartTime: 2008-10-23 4 18:50:17.137
+    SYSTEMTIME startTime = GetStartTime();
+    std::cout << "measurementStartTime: " << startTime.wYear << "-" << startTime.wMonth << "-" << startTime.wDay
+              << " " << startTime.wDayOfWeek << " " << startTime.wHour << ":" << startTime.wMinute << ":" << startTime.wSecond
+              << "." << startTime.wMilliseconds << std::endl;
+
+    Rewind();
+    for (IBlfObject* pObject = GetNextBlfObject(); NULL != pObject; pObject = GetNextBlfObject())
+    {
+        isOk = pObject->Dump();
+        if (!isOk)
+        {
+            break;
+        }
+    }
+
+    return isOk;
+}
+
+} // namespace BLF
@@ -0,0 +1,189 @@
+/*
+ * BLF Library
+ * (c) 2014, Robert Bosch Engineering and Business Solutions. All rights reserved.
+ *
+ * Annotation:  Internal interfaces of the BLF reader.
+ *              The reader gives a sequential access to BLF files of any size: the file is memory mapped,
+ *              an index of its log container headers is built on opening, the objects are indexed while
+ *              they are read, and containers are uncompressed on demand into a small cache, so memory
+ *              doesn't grow with the file.
+ */
+
+#include <list>
+#include <map>
+#include <vector>
+
+#include "BlfLibrary.h"
+#include "MappedFile.h"
+
+
+namespace BLF
+{
+
+//! Just to implement IBlfReader - see that interface for details.
+class BlfReader : public IBlfReader
+{
+public:
+    //! Constructor.
+    BlfReader();
+    //! Destructor.
+    virtual ~BlfReader();
+
+public:
+    virtual bool EnableLogging(const std::string& sLogFilePath);
+
+    virtual HRESULT Open(const std::string& sBlfFilePath);
+    virtual bool Close();
+
+    virtual SYSTEMTIME GetStartTime()
+    {
+        return m_StartTime;
+    }
+    virtual ULONGLONG GetBlfObjectsCount()
+    {
+        return m_ObjectsCount;
+    }
+    virtual ULONGLONG GetFirstTimestamp();
+    virtual ULONGLONG GetLastTimestamp()
+    {
+        return m_LastTimestamp;
+    }
+
+    virtual void SetCacheSize(size_t containers);
+    virtual void SetFilter(DWORD kindMask, WORD channelNo);
+
+    virtual bool Rewind();
+    virtual bool SeekToTime(ULONGLONG timestamp);
+    virtual ULONGLONG GetPosition()
+    {
+        return m_Pos;
+    }
+    virtual bool SetPosition(ULONGLONG position);
+    virtual IBlfObject* GetNextBlfObject();
+
+    virtual bool Dump();
+
+private:
+    //! Index entry of a log container. Positions are offsets in the uncompressed data of all containers
+    //! appended one by one, objects may start in one container and end in the next ones.
+    //! The object fields are valid only for the containers before m_ScannedContainers.
+    struct ContainerIndex
+    {
+        //! Offset of the compressed data in the file.
+        ULONGLONG m_FileOffset;
+        //! Length of the compressed data.
+        DWORD m_SizeCompressed;
+        //! Length of the uncompressed data.
+        DWORD m_SizeUncompressed;
+        //! Position of the uncompressed data.
+        ULONGLONG m_Pos;
+        //! Position of the first object that starts in the container, or the end of the container if there is none.
+        ULONGLONG m_FirstObjectPos;
+        //! Count of objects that start in the container.
+        DWORD m_ObjectsCount;
+        //! Greatest timestamp of the objects that start in the container or before it.
+        ULONGLONG m_LastTimestamp;
+    };
+
+    //! Uncompressed container kept in the cache.
+    struct CachedContainer
+    {
+        //! Uncompressed data.
+        std::vector<char> m_Data;
+        //! Place of the container in m_Lru.
+        std::list<size_t>::iterator m_LruPos;
+    };
+
+    //! Reads log container headers of the file. Nothing is uncompressed, the objects are indexed later by ReadObject.
+    //! \param fileSize Expected size of the file (according to the information from BLF file header).
+    //! \return false if there was an error.
+    bool BuildIndex(ULONGLONG fileSize);
+    //! Adds the object in m_Object to the index, it shall be the object at m_ScanPos.
+    //! \param pos Position of the object.
+    //! \param nextPos Position of the following object.
+    void IndexObject(ULONGLONG pos, ULONGLONG nextPos);
+    //! Uncompresses desired container of the file.
+    //! \param container Index of the container.
+    //! \param[out] data Uncompressed data.
+    //! \return false if there was an error.
+    bool ReadContainer(size_t container, std::vector<char>& data);
+    //! Uncompresses desired data. The data shall be compressed via zlib algorithm.
+    //! \param pDataCompressed Compressed data.
+    //! \param dataLenCompressed Length of compressed data.
+    //! \param[in,out] pDataUnCompressed Buffer for uncompressed data, allocated outside of the method, will be filled here.
+    //! \param dataLenUnCompressed Expected length of uncompressed data. It also means length of pDataUnCompressed buffer.
+    //! \return false if there was an error.
+    bool UnCompress(const char* pDataCompressed, size_t dataLenCompressed, char* pDataUnCompressed, size_t dataLenUnCompressed);
+    //! Returns desired uncompressed container from the cache, uncompresses it if it is not there.
+    //! \return NULL if there was an error.
+    const std::vector<char>* GetContainer(size_t container);
+    //! Returns index of the container that holds desired position.
+    size_t FindContainer(ULONGLONG pos);
+    //! Copies uncompressed data of desired range, the range may cross several containers.
+    //! \return false if the range is out of the data or there was an error.
+    bool CopyData(ULONGLONG pos, char* pData, size_t len);
+    //! Reads the beginning of the object at desired position into m_Object, as much of it as is decoded.
+    //! Indexes the object if it is the first one that was not indexed yet.
+    //! \param pos Position of the object.
+    //! \param[out] nextPos Position of the following object.
+    //! \return false at the end of the data or if there was an error.
+    bool ReadObject(ULONGLONG pos, ULONGLONG& nextPos);
+    //! Returns true if the object in m_Object has a timestamp.
+    bool HasTimestamp()
+    {
+        return (m_ObjectLen >= sizeof(BlfObjectHeader)) && (m_Object.m_Header.m_Header.m_HeaderSize >= sizeof(BlfObjectHeader));
+    }
+    //! Decodes the object in m_Object.
+    //! \return The object if it is accepted by the filter, NULL otherwise.
+    IBlfObject* DecodeObject();
+
+private:
+    //! Opened BLF file.
+    MappedFile m_File;
+    //! Index of all log containers in the file.
+    std::vector<ContainerIndex> m_Containers;
+    //! Length of the uncompressed data of all containers.
+    ULONGLONG m_DataSize;
+    //! Uncompressed containers by container index.
+    std::map<size_t, CachedContainer> m_Cache;
+    //! Cached container indices, the most recently used one first.
+    std::list<size_t> m_Lru;
+    //! Count of containers kept in m_Cache.
+    size_t m_CacheSize;
+    //! Container of the last access, most accesses are in it or in the next one.
+    size_t m_Container;
+    //! Position of the next object.
+    ULONGLONG m_Pos;
+    //! Beginning of the current object.
+    BlfObject_CanMessage m_Object;
+    //! Length of the current object in m_Object.
+    size_t m_ObjectLen;
+    //! Current object if it is a CAN message.
+    CanMessage m_CanMessage;
+    //! Current object if it is not supported.
+    BlfObject m_UnknownObject;
+    //! Accepted object kinds, bit (1 << BlfObjectKind) for each, 0 for all.
+    DWORD m_KindMask;
+    //! Accepted channel, 0 for all.
+    WORD m_ChannelNo;
+    //! Start time in blf file.
+    SYSTEMTIME m_StartTime;
+    //! Count of objects in all containers, taken from BLF file header until all objects are indexed.
+    ULONGLONG m_ObjectsCount;
+    //! Position of the first object that is not indexed yet.
+    ULONGLONG m_ScanPos;
+    //! Count of containers whose objects are all indexed.
+    size_t m_ScannedContainers;
+    //! Count of indexed objects.
+    ULONGLONG m_ScannedObjects;
+    //! Timestamp of the first timestamped object.
+    ULONGLONG m_FirstTimestamp;
+    //! Timestamp of the last timestamped object indexed so far.
+    ULONGLONG m_LastTimestamp;
+    //! Greatest timestamp of the objects indexed so far.
+    ULONGLONG m_MaxTimestamp;
+    //! True if any timestamped object was indexed.
+    bool m_HasTimestamps;
+};
+
+} // namespace BLF
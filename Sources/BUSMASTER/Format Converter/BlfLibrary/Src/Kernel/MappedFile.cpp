@@ -0,0 +1,122 @@
+/*
+ * BLF Library
+ * (c) 2014, Robert Bosch Engineering and Business Solutions. All rights reserved.
+ *
+ * Annotation:  Aux class to access big binary files through a memory mapped view.
+ */
+
+#include "MappedFile.h"
+#include "ErrorManager.h"
+#include "Strings.h"
+
+// Smallest window that is mapped at once. Log containers are much smaller, so most of them are served by one view.
+#define MAPPED_FILE_VIEW_SIZE (16 * 1024 * 1024)
+
+MappedFile::MappedFile()
+    : m_hFile(INVALID_HANDLE_VALUE), m_hMapping(NULL), m_Size(0), m_pView(NULL), m_ViewOffset(0), m_ViewSize(0)
+{
+    SYSTEM_INFO sysInfo;
+    GetSystemInfo(&sysInfo);
+    m_Granularity = sysInfo.dwAllocationGranularity;
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::string& fileName)
+{
+    Close();
+    m_FileName = fileName;
+
+    m_hFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (INVALID_HANDLE_VALUE == m_hFile)
+    {
+        EM_ERROR("File can't be opened: " + fileName);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_hFile, &size) || (0 == size.QuadPart))
+    {
+        EM_ERROR("File is empty: " + fileName);
+        Close();
+        return false;
+    }
+    m_Size = (ULONGLONG)size.QuadPart;
+
+    m_hMapping = CreateFileMappingA(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (NULL == m_hMapping)
+    {
+        EM_ERROR("File can't be mapped: " + fileName);
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (NULL != m_pView)
+    {
+        UnmapViewOfFile(m_pView);
+        m_pView = NULL;
+    }
+    m_ViewOffset = 0;
+    m_ViewSize = 0;
+    if (NULL != m_hMapping)
+    {
+        CloseHandle(m_hMapping);
+        m_hMapping = NULL;
+    }
+    if (INVALID_HANDLE_VALUE != m_hFile)
+    {
+        CloseHandle(m_hFile);
+        m_hFile = INVALID_HANDLE_VALUE;
+    }
+    m_Size = 0;
+}
+
+const char* MappedFile::GetData(ULONGLONG offset, size_t len)
+{
+    if (!IsOk() || (offset > m_Size) || (len > m_Size - offset))
+    {
+        EM_ERROR("Not enough data in file: " + m_FileName);
+        return NULL;
+    }
+
+    // Remap only if the range is not in the current window
+    if ((NULL == m_pView) || (offset < m_ViewOffset) || (offset + len > m_ViewOffset + m_ViewSize))
+    {
+        if (NULL != m_pView)
+        {
+            UnmapViewOfFile(m_pView);
+            m_pView = NULL;
+        }
+        m_ViewOffset = offset - (offset % m_Granularity);
+        ULONGLONG viewSize = max((ULONGLONG)MAPPED_FILE_VIEW_SIZE, offset + len - m_ViewOffset);
+        m_ViewSize = (size_t)min(viewSize, m_Size - m_ViewOffset);
+        m_pView = (const char*)MapViewOfFile(m_hMapping, FILE_MAP_READ, (DWORD)(m_ViewOffset >> 32),
+                                             (DWORD)(m_ViewOffset & 0xFFFFFFFF), m_ViewSize);
+        if (NULL == m_pView)
+        {
+            EM_ERROR("File view can't be mapped: " + m_FileName);
+            m_ViewSize = 0;
+            return NULL;
+        }
+    }
+    return m_pView + (size_t)(offset - m_ViewOffset);
+}
+
+bool MappedFile::GetData(ULONGLONG offset, void* pData, size_t len)
+{
+    const char* pSource = GetData(offset, len);
+    if (NULL == pSource)
+    {
+        return false;
+    }
+    memcpy(pData, pSource, len);
+    return true;
+}
@@ -0,0 +1,74 @@
+/*
+ * BLF Library
+ * (c) 2014, Robert Bosch Engineering and Business Solutions. All rights reserved.
+ *
+ * Annotation:  Aux class to access big binary files through a memory mapped view.
+ *              Only a window of the file is mapped at a time, so files larger than
+ *              the address space of the process can be read.
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <windows.h>
+
+//! Aux class to get data from a memory mapped binary file.
+class MappedFile
+{
+public:
+    //! Constructor of the object.
+    MappedFile();
+    //! Destructor of the object. Closes the file.
+    ~MappedFile();
+
+    //! Opens desired file for reading.
+    //! \param fileName Full path to desired binary file. For example, "C:\file.blf".
+    //! \return false if the file can't be opened or mapped.
+    bool Open(const std::string& fileName);
+    //! Unmaps and closes the file.
+    void Close();
+
+    //! Returns true if the file is opened.
+    bool IsOk()
+    {
+        return (NULL != m_hMapping);
+    }
+    //! Returns size of the file.
+    ULONGLONG GetSize()
+    {
+        return m_Size;
+    }
+
+    //! Returns pointer to desired range of the file. The pointer stays valid until the next call.
+    //! \param offset Offset of the range in the file.
+    //! \param len Length of the range.
+    //! \return NULL if the range is not in the file or can't be mapped.
+    const char* GetData(ULONGLONG offset, size_t len);
+    //! Copies desired range of the file into desired structure.
+    bool GetData(ULONGLONG offset, void* pData, size_t len);
+
+private:
+    //! Forbidden
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+    //! Full path to accessed binary file.
+    std::string m_FileName;
+    //! File handle.
+    HANDLE m_hFile;
+    //! File mapping handle.
+    HANDLE m_hMapping;
+    //! File size.
+    ULONGLONG m_Size;
+    //! Currently mapped window of the file.
+    const char* m_pView;
+    //! Offset of the mapped window in the file, multiple of the allocation granularity.
+    ULONGLONG m_ViewOffset;
+    //! Length of the mapped window.
+    size_t m_ViewSize;
+    //! Allocation granularity of the system, view offsets shall be its multiple.
+    DWORD m_Granularity;
+};
+
+#endif //#ifndef MAPPED_FILE_H
@@ -209,37 +209,34 @@ void CBlfLogConverter::WriteTimestamp(ULONGLONG timestamp, std::ofstream& stream
 }
 
 /**
- * \brief     Internal conversion function, uses already prepared blf library and output file
- * \param     pBlfLib blf library with loaded input file
+ * \brief     Internal conversion function, uses already prepared blf reader and output file
+ * \param     pBlfReader blf reader with opened input file
  * \param     stream Output file stream
  * \return    Result code
  *
+ * Messages are read one by one, so the input file is never held in memory as a whole.
  */
-HRESULT CBlfLogConverter::WriteToLog(BLF::IBlfLibrary* pBlfLib, std::ofstream& stream) const
+HRESULT CBlfLogConverter::WriteToLog(BLF::IBlfReader* pBlfReader, std::ofstream& stream) const
 {
-    if(pBlfLib == NULL)
+    if(pBlfReader == NULL)
     {
         return E_INVALIDARG;
     }
 
-    SYSTEMTIME startTime = pBlfLib->GetStartTime();
-    size_t objectsCount = pBlfLib->GetBlfObjectsCount();
+    SYSTEMTIME startTime = pBlfReader->GetStartTime();
 
-    if(objectsCount <= 0)
+    pBlfReader->SetFilter(1 << BLF::bokCanMessage, 0);
+    pBlfReader->Rewind();
+    BLF::IBlfObject* object = pBlfReader->GetNextBlfObject();
+    if(object == NULL)
     {
         return ERR_PROTOCOL_NOT_SUPPORTED;
     }
 
     AddFunctionHeader(stream, startTime.wDay, startTime.wMonth, startTime.wYear, startTime.wHour, startTime.wMinute, startTime.wSecond);
 
-    for(size_t i = 0; i < objectsCount; i++)
+    for(; object != NULL; object = pBlfReader->GetNextBlfObject())
     {
-        BLF::IBlfObject* object = pBlfLib->GetBlfObject(i);
-        if(object == NULL)
-        {
-            continue;
-        }
-
         if(object->GetKind() == BLF::bokCanMessage)
         {
             BLF::ICanMessage* canMessage = object->GetICanMessage();
@@ -312,9 +309,9 @@ HRESULT CBlfLogConverter::ConvertFile(string& chInputFile, string& chOutputFile)
     {
         bool isOk = true;
 
-        // Create BLF Library interface
-        BLF::IBlfLibrary* pBlfLib = BLF::GetIBlfLibrary();
-        isOk = (NULL != pBlfLib);
+        // Create BLF Reader interface
+        BLF::IBlfReader* pBlfReader = BLF::GetIBlfReader();
+        isOk = (NULL != pBlfReader);
         if (!isOk)
         {
             m_omstrConversionStatus = _("Unable to get BLF Library interface");
@@ -322,9 +319,9 @@ HRESULT CBlfLogConverter::ConvertFile(string& chInputFile, string& chOutputFile)
             return ERR_UNABLE_TO_GET_LIB_INTERFACE;
         }
 
-        // Load BLF file
-        CBlfLibraryKeeper blfKeeper(pBlfLib);
-        HRESULT hResult = pBlfLib->Load(chInputFile);
+        // Open BLF file
+        CBlfReaderKeeper blfKeeper(pBlfReader);
+        HRESULT hResult = pBlfReader->Open(chInputFile);
 
         if (hResult != S_OK)
         {
@@ -343,7 +340,7 @@ HRESULT CBlfLogConverter::ConvertFile(string& chInputFile, string& chOutputFile)
             return ERR_OUTPUT_FILE_NOTFOUND;
         }
 
-        HRESULT hRes = WriteToLog(pBlfLib, fout);
+        HRESULT hRes = WriteToLog(pBlfReader, fout);
         if (!SUCCEEDED(hRes))
         {
             if(hRes == ERR_PROTOCOL_NOT_SUPPORTED)
@@ -394,18 +391,18 @@ BOOL CBlfLogConverter::bHaveOwnWindow()
 
 
 ///////////////////////////////////////////////////
-//CBlfLibraryKeeper
+//CBlfReaderKeeper
 
-CBlfLibraryKeeper::CBlfLibraryKeeper(BLF::IBlfLibrary* pBlfLib)
-    : m_pBlfLib(pBlfLib)
+CBlfReaderKeeper::CBlfReaderKeeper(BLF::IBlfReader* pBlfReader)
+    : m_pBlfReader(pBlfReader)
 {
 }
 
-CBlfLibraryKeeper::~CBlfLibraryKeeper()
+CBlfReaderKeeper::~CBlfReaderKeeper()
 {
-    if(m_pBlfLib != NULL)
+    if(m_pBlfReader != NULL)
     {
-        m_pBlfLib->UnLoad();
+        m_pBlfReader->Close();
     }
 }
 
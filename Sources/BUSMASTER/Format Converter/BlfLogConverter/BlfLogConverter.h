@@ -40,19 +40,19 @@ using namespace std;
 #define ERR_UNABLE_TO_CONVERT            (-4)
 #define ERR_PROTOCOL_NOT_SUPPORTED       (-5)
 
-//! Class that care of BlfLibrary, use it when Load blf file to unload automatically
+//! Class that care of BlfReader, use it when Open blf file to close automatically
 //! in destructor
-class CBlfLibraryKeeper
+class CBlfReaderKeeper
 {
 public:
     //! Creates keeper object
-    //! \param pBlfLib Pointer to library, it is considered, that function Load is called before destroying of keeper object
-    CBlfLibraryKeeper(BLF::IBlfLibrary* pBlfLib);
-    //! Unload blf file when object destroyed
-    ~CBlfLibraryKeeper();
+    //! \param pBlfReader Pointer to reader, it is considered, that function Open is called before destroying of keeper object
+    CBlfReaderKeeper(BLF::IBlfReader* pBlfReader);
+    //! Close blf file when object destroyed
+    ~CBlfReaderKeeper();
 private:
-    //! Pointer to Blf library
-    BLF::IBlfLibrary* m_pBlfLib;
+    //! Pointer to Blf reader
+    BLF::IBlfReader* m_pBlfReader;
 };
 
 class CBlfLogConverter : public CBaseConverter
@@ -79,7 +79,7 @@ public:
         return S_FALSE;
     };
 private:
-    HRESULT WriteToLog(BLF::IBlfLibrary* pBlfLib, std::ofstream& stream) const;
+    HRESULT WriteToLog(BLF::IBlfReader* pBlfReader, std::ofstream& stream) const;
     void AddFunctionHeader(std::ofstream& stream
                            , WORD day
                            , WORD month
@@ -0,0 +1,471 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LineStreamConverter.cpp
+ * \brief     Implementation of the CLineStreamConverter class.
+ *
+ * Implementation of the streaming converter core.
+ */
+
+/* Project includes */
+#include "LineStreamConverter.h"
+
+/**
+ * Lines of a text file.
+ */
+class CFileLineSource : public CLineSource
+{
+public:
+    CFileLineSource(FILE* fpInput)
+    {
+        m_fpInput = fpInput;
+    }
+    virtual size_t nRead(char* pchBuffer, size_t nSize)
+    {
+        return fread(pchBuffer, 1, nSize, m_fpInput);
+    }
+    virtual bool bFailed(void) const
+    {
+        return (ferror(m_fpInput) != 0);
+    }
+
+private:
+    FILE* m_fpInput;
+};
+
+/**
+ * \brief      Next token of the line
+ * \param[out] sToken Token found
+ * \return     false if the line has no more tokens
+ *
+ * Tokens are separated by blanks, a carriage return counts as blank.
+ */
+bool CLineTokenizer::bNext(STEXTVIEW& sToken)
+{
+    while ( (m_pchPos < m_pchEnd) && ((*m_pchPos == ' ') || (*m_pchPos == '\t') || (*m_pchPos == '\r')) )
+    {
+        m_pchPos++;
+    }
+    if (m_pchPos == m_pchEnd)
+    {
+        return false;
+    }
+
+    sToken.m_pchText = m_pchPos;
+    while ( (m_pchPos < m_pchEnd) && (*m_pchPos != ' ') && (*m_pchPos != '\t') && (*m_pchPos != '\r') )
+    {
+        m_pchPos++;
+    }
+    sToken.m_nLength = m_pchPos - sToken.m_pchText;
+    return true;
+}
+
+/**
+ * \brief Constructor
+ *
+ * Constructor of CLineWriter
+ */
+CLineWriter::CLineWriter()
+{
+    m_nSize = 0;
+}
+
+/**
+ * \brief     Appends a decimal number
+ * \param[in] un64Value Number to append
+ * \param[in] nMinDigits Number of digits at least, leading zeros are added
+ */
+void CLineWriter::vAppendUInt(unsigned __int64 un64Value, int nMinDigits)
+{
+    char achDigits[24];
+    int nDigits = 0;
+    do
+    {
+        achDigits[nDigits++] = (char)('0' + (un64Value % 10));
+        un64Value /= 10;
+    }
+    while ( (un64Value > 0) && (nDigits < (int)sizeof(achDigits)) );
+
+    while ( (nDigits < nMinDigits) && (nDigits < (int)sizeof(achDigits)) )
+    {
+        achDigits[nDigits++] = '0';
+    }
+    while (nDigits > 0)
+    {
+        vAppendChar(achDigits[--nDigits]);
+    }
+}
+
+void CLineWriter::vGrow(size_t nLength)
+{
+    size_t nNewSize = m_ouBuffer.size() * 2;
+    if (nNewSize < m_nSize + nLength)
+    {
+        nNewSize = m_nSize + nLength;
+    }
+    if (nNewSize < 64 * 1024)
+    {
+        nNewSize = 64 * 1024;
+    }
+    m_ouBuffer.resize(nNewSize);
+}
+
+/**
+ * \brief Constructor
+ *
+ * Constructor of CLineStreamConverter
+ */
+CLineStreamConverter::CLineStreamConverter(void)
+{
+    m_unThreads = 0;
+    m_un64BytesRead = 0;
+    m_dSeconds = 0;
+    m_pouInputStage = NULL;
+}
+
+/**
+ * \brief Destructor
+ *
+ * Destructor of CLineStreamConverter
+ */
+CLineStreamConverter::~CLineStreamConverter(void)
+{
+    for (size_t i = 0; i < m_ouChunks.size(); i++)
+    {
+        delete m_ouChunks[i];
+    }
+}
+
+/**
+ * \brief     Converts a file
+ * \param[in] fpInput File to convert, opened for binary reading
+ * \param[in] fpOutput Converted file, opened for binary writing
+ * \return    S_OK, S_FALSE if a file could not be read or written
+ */
+HRESULT CLineStreamConverter::hConvert(FILE* fpInput, FILE* fpOutput)
+{
+    if (NULL == fpInput)
+    {
+        return E_INVALIDARG;
+    }
+    CFileLineSource ouInput(fpInput);
+    return hConvert(ouInput, fpOutput);
+}
+
+/**
+ * \brief     Converts the lines of a source
+ * \param[in] ouInput Lines to convert
+ * \param[in] fpOutput Converted file, opened for binary writing
+ * \return    S_OK, S_FALSE if the input could not be read or the file not written
+ *
+ * The input is read in windows of defSTREAM_WINDOW_SIZE bytes, a line cut
+ * by the window end is moved to the next window.
+ */
+HRESULT CLineStreamConverter::hConvert(CLineSource& ouInput, FILE* fpOutput)
+{
+    if (NULL == fpOutput)
+    {
+        return E_INVALIDARG;
+    }
+
+    LARGE_INTEGER sFrequency, sStart, sEnd;
+    QueryPerformanceFrequency(&sFrequency);
+    QueryPerformanceCounter(&sStart);
+
+    HRESULT hResult = S_OK;
+    m_un64BytesRead = 0;
+
+    size_t nReserve = nGetHeaderReserve();
+    if (nReserve > 0)
+    {
+        std::vector<char> ouBlank(nReserve, ' ');
+        fwrite(&ouBlank[0], 1, nReserve, fpOutput);
+    }
+
+    std::vector<char> ouWindow(defSTREAM_WINDOW_SIZE);
+    size_t nCarry = 0;
+    bool bLastWindow = false;
+    while (false == bLastWindow)
+    {
+        size_t nRead = ouInput.nRead(&ouWindow[nCarry], ouWindow.size() - nCarry);
+        m_un64BytesRead += nRead;
+        bLastWindow = (nRead < ouWindow.size() - nCarry);
+
+        const char* pchBegin = &ouWindow[0];
+        const char* pchFilled = pchBegin + nCarry + nRead;
+        const char* pchEnd = pchFilled;
+        if (false == bLastWindow)
+        {
+            while ( (pchEnd > pchBegin) && (pchEnd[-1] != '\n') )
+            {
+                pchEnd--;
+            }
+            if (pchEnd == pchBegin)
+            {
+                //A single line fills the window
+                nCarry = ouWindow.size();
+                ouWindow.resize(ouWindow.size() * 2);
+                continue;
+            }
+        }
+
+        UINT unChunks = unSplitWindow(pchBegin, pchEnd);
+        if (unChunks > 0)
+        {
+            if (NULL != m_pouInputStage)
+            {
+                vRunStage(unChunks);
+            }
+            vBeginWindow(unChunks);
+            vRunChunks(unChunks, true, this);
+            vJoinChunks(unChunks);
+            vRunChunks(unChunks, false, this);
+
+            for (UINT i = 0; i < unChunks; i++)
+            {
+                CLineWriter& ouWriter = m_ouChunks[i]->m_ouWriter;
+                if ( (ouWriter.nGetSize() > 0) &&
+                        (fwrite(ouWriter.pchGetData(), 1, ouWriter.nGetSize(), fpOutput) != ouWriter.nGetSize()) )
+                {
+                    hResult = S_FALSE;
+                }
+            }
+        }
+
+        nCarry = pchFilled - pchEnd;
+        if (nCarry > 0)
+        {
+            memmove(&ouWindow[0], pchEnd, nCarry);
+        }
+    }
+    if (ouInput.bFailed())
+    {
+        hResult = S_FALSE;
+    }
+
+    if (nReserve > 0)
+    {
+        CLineWriter ouHeader;
+        vWriteHeader(ouHeader);
+        size_t nLength = min(ouHeader.nGetSize(), nReserve);
+        if (nLength > 0)
+        {
+            fseek(fpOutput, 0L, SEEK_SET);
+            fwrite(ouHeader.pchGetData(), 1, nLength, fpOutput);
+            fseek(fpOutput, 0L, SEEK_END);
+        }
+    }
+    if (ferror(fpOutput))
+    {
+        hResult = S_FALSE;
+    }
+
+    QueryPerformanceCounter(&sEnd);
+    m_dSeconds = (double)(sEnd.QuadPart - sStart.QuadPart) / sFrequency.QuadPart;
+    return hResult;
+}
+
+/**
+ * \brief     Sets the input stage
+ * \param[in] pouStage Converter of the input lines, NULL reads them as they are
+ *
+ * The stage scans, joins and converts every window first, only its chunk
+ * output is handed on. Its header is not written.
+ */
+void CLineStreamConverter::vSetInputStage(CLineStreamConverter* pouStage)
+{
+    m_pouInputStage = (pouStage == this) ? NULL : pouStage;
+}
+
+void CLineStreamConverter::vSetThreadCount(UINT unThreads)
+{
+    m_unThreads = unThreads;
+}
+
+unsigned __int64 CLineStreamConverter::un64GetBytesRead(void) const
+{
+    return m_un64BytesRead;
+}
+
+double CLineStreamConverter::dGetSeconds(void) const
+{
+    return m_dSeconds;
+}
+
+void CLineStreamConverter::vAppendThroughput(std::string& omstrStatus) const
+{
+    double dMegaBytes = m_un64BytesRead / (1024.0 * 1024.0);
+    char acText[64];
+    if (m_dSeconds > 0)
+    {
+        sprintf_s(acText, sizeof(acText), " (%.1f MB, %.1f MB/s)", dMegaBytes, dMegaBytes / m_dSeconds);
+    }
+    else
+    {
+        sprintf_s(acText, sizeof(acText), " (%.1f MB)", dMegaBytes);
+    }
+    omstrStatus += acText;
+}
+
+size_t CLineStreamConverter::nGetHeaderReserve(void) const
+{
+    return 0;
+}
+
+void CLineStreamConverter::vWriteHeader(CLineWriter& /*ouWriter*/)
+{
+}
+
+void CLineStreamConverter::vBeginWindow(UINT /*unChunks*/)
+{
+}
+
+void CLineStreamConverter::vScanChunk(UINT /*unChunk*/, const char* /*pchBegin*/, const char* /*pchEnd*/)
+{
+}
+
+void CLineStreamConverter::vJoinChunks(UINT /*unChunks*/)
+{
+}
+
+/**
+ * \brief     Splits a window into chunks
+ * \param[in] pchBegin Window start
+ * \param[in] pchEnd Window end, after the last line end unless it is the last window
+ * \return    Number of chunks
+ *
+ * Every chunk ends on a line end and holds defSTREAM_CHUNK_SIZE bytes at least,
+ * except for the last one.
+ */
+UINT CLineStreamConverter::unSplitWindow(const char* pchBegin, const char* pchEnd)
+{
+    UINT unChunks = 0;
+    const char* pchPos = pchBegin;
+    while (pchPos < pchEnd)
+    {
+        const char* pchChunkEnd = pchEnd;
+        if ((size_t)(pchEnd - pchPos) > defSTREAM_CHUNK_SIZE)
+        {
+            pchChunkEnd = (const char*)memchr(pchPos + defSTREAM_CHUNK_SIZE, '\n',
+                                              (pchEnd - pchPos) - defSTREAM_CHUNK_SIZE);
+            pchChunkEnd = (NULL == pchChunkEnd) ? pchEnd : (pchChunkEnd + 1);
+        }
+
+        if (unChunks == m_ouChunks.size())
+        {
+            m_ouChunks.push_back(new sCHUNK);
+        }
+        sCHUNK* psChunk = m_ouChunks[unChunks++];
+        psChunk->m_pchBegin = pchPos;
+        psChunk->m_pchEnd = pchChunkEnd;
+        psChunk->m_ouWriter.vClear();
+        psChunk->m_ouStageWriter.vClear();
+
+        pchPos = pchChunkEnd;
+    }
+    return unChunks;
+}
+
+/**
+ * \brief     Runs the input stage on all chunks of the window
+ * \param[in] unChunks Number of chunks
+ *
+ * Afterwards every chunk holds the lines written by the stage.
+ */
+void CLineStreamConverter::vRunStage(UINT unChunks)
+{
+    m_pouInputStage->vBeginWindow(unChunks);
+    vRunChunks(unChunks, true, m_pouInputStage);
+    m_pouInputStage->vJoinChunks(unChunks);
+    vRunChunks(unChunks, false, m_pouInputStage);
+
+    for (UINT i = 0; i < unChunks; i++)
+    {
+        sCHUNK* psChunk = m_ouChunks[i];
+        psChunk->m_pchBegin = psChunk->m_ouStageWriter.pchGetData();
+        psChunk->m_pchEnd = psChunk->m_pchBegin + psChunk->m_ouStageWriter.nGetSize();
+    }
+}
+
+/**
+ * \brief     Scans or converts all chunks of the window
+ * \param[in] unChunks Number of chunks
+ * \param[in] bScan true to scan, false to convert
+ * \param[in] pouTarget This converter or its input stage
+ *
+ * Workers take the next chunk until all are done, the calling thread takes
+ * part as well so the window completes even if no thread could be created.
+ */
+void CLineStreamConverter::vRunChunks(UINT unChunks, bool bScan, CLineStreamConverter* pouTarget)
+{
+    sJOB sJob;
+    sJob.m_pouConverter = this;
+    sJob.m_pouTarget = pouTarget;
+    sJob.m_bScan = bScan;
+    sJob.m_unChunks = unChunks;
+    sJob.m_lNextChunk = 0;
+
+    UINT unThreads = m_unThreads;
+    if (0 == unThreads)
+    {
+        SYSTEM_INFO sSysInfo;
+        GetSystemInfo(&sSysInfo);
+        unThreads = max(sSysInfo.dwNumberOfProcessors, (DWORD)1);
+    }
+    unThreads = min(unThreads, unChunks);
+
+    std::vector<HANDLE> ouThreads;
+    for (UINT i = 1; i < unThreads; i++)
+    {
+        HANDLE hThread = CreateThread(NULL, 0, dwChunkThreadProc, &sJob, 0, NULL);
+        if (NULL != hThread)
+        {
+            ouThreads.push_back(hThread);
+        }
+    }
+    dwChunkThreadProc(&sJob);
+    if (false == ouThreads.empty())
+    {
+        WaitForMultipleObjects((DWORD)ouThreads.size(), &ouThreads[0], TRUE, INFINITE);
+        for (size_t i = 0; i < ouThreads.size(); i++)
+        {
+            CloseHandle(ouThreads[i]);
+        }
+    }
+}
+
+DWORD WINAPI CLineStreamConverter::dwChunkThreadProc(LPVOID pParam)
+{
+    sJOB* psJob = (sJOB*)pParam;
+    CLineStreamConverter* pouConverter = psJob->m_pouConverter;
+    CLineStreamConverter* pouTarget = psJob->m_pouTarget;
+    LONG lChunk;
+    while ( (lChunk = InterlockedIncrement(&psJob->m_lNextChunk) - 1) < (LONG)psJob->m_unChunks )
+    {
+        //Each worker touches only its own chunk
+        sCHUNK* psChunk = pouConverter->m_ouChunks[lChunk];
+        if (psJob->m_bScan)
+        {
+            pouTarget->vScanChunk((UINT)lChunk, psChunk->m_pchBegin, psChunk->m_pchEnd);
+        }
+        else
+        {
+            CLineWriter& ouWriter = (pouTarget == pouConverter) ? psChunk->m_ouWriter : psChunk->m_ouStageWriter;
+            pouTarget->vConvertChunk((UINT)lChunk, psChunk->m_pchBegin, psChunk->m_pchEnd, ouWriter);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LineStreamConverter.h
+ * \brief     Definition of the CLineStreamConverter class.
+ *
+ * Streaming core of the line based log format converters.
+ */
+
+#pragma once
+
+/* C++ includes */
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+/* Windows includes */
+#include <windows.h>
+
+#define defSTREAM_WINDOW_SIZE       (64 * 1024 * 1024)  // Input bytes read at once
+#define defSTREAM_CHUNK_SIZE        (1024 * 1024)       // Input bytes converted by one worker at a time
+
+/**
+ * Text of a token or line inside the read buffer, nothing is copied.
+ */
+struct sTEXTVIEW
+{
+    const char* m_pchText;
+    size_t m_nLength;
+
+    sTEXTVIEW()
+    {
+        m_pchText = NULL;
+        m_nLength = 0;
+    }
+    bool bEquals(const char* pchText) const
+    {
+        return (strlen(pchText) == m_nLength) && (memcmp(m_pchText, pchText, m_nLength) == 0);
+    }
+    bool bEqualsNoCase(const char* pchText) const
+    {
+        return (strlen(pchText) == m_nLength) && (_strnicmp(m_pchText, pchText, m_nLength) == 0);
+    }
+    //Decimal digits only
+    bool bIsNumber(void) const
+    {
+        for (size_t i = 0; i < m_nLength; i++)
+        {
+            if ( (m_pchText[i] < '0') || (m_pchText[i] > '9') )
+            {
+                return false;
+            }
+        }
+        return (m_nLength > 0);
+    }
+    //Hexadecimal digits only
+    bool bIsHexNumber(void) const
+    {
+        for (size_t i = 0; i < m_nLength; i++)
+        {
+            if (0 == isxdigit((unsigned char)m_pchText[i]))
+            {
+                return false;
+            }
+        }
+        return (m_nLength > 0);
+    }
+    //Value of the leading decimal digits
+    unsigned __int64 un64GetNumber(void) const
+    {
+        unsigned __int64 un64Value = 0;
+        for (size_t i = 0; (i < m_nLength) && (m_pchText[i] >= '0') && (m_pchText[i] <= '9'); i++)
+        {
+            un64Value = (un64Value * 10) + (m_pchText[i] - '0');
+        }
+        return un64Value;
+    }
+};
+typedef sTEXTVIEW STEXTVIEW;
+
+/**
+ * Splits a line into blank separated tokens.
+ */
+class CLineTokenizer
+{
+public:
+    CLineTokenizer(const char* pchBegin, const char* pchEnd)
+    {
+        m_pchPos = pchBegin;
+        m_pchEnd = pchEnd;
+    }
+    bool bNext(STEXTVIEW& sToken);
+
+private:
+    const char* m_pchPos;
+    const char* m_pchEnd;
+};
+
+/**
+ * Output buffer of one chunk, grows once and is reused for the next chunks.
+ */
+class CLineWriter
+{
+public:
+    CLineWriter();
+
+    void vClear(void)
+    {
+        m_nSize = 0;
+    }
+    void vAppend(const char* pchText, size_t nLength)
+    {
+        if (m_nSize + nLength > m_ouBuffer.size())
+        {
+            vGrow(nLength);
+        }
+        memcpy(&m_ouBuffer[m_nSize], pchText, nLength);
+        m_nSize += nLength;
+    }
+    void vAppend(const char* pchText)
+    {
+        vAppend(pchText, strlen(pchText));
+    }
+    void vAppend(const STEXTVIEW& sText)
+    {
+        vAppend(sText.m_pchText, sText.m_nLength);
+    }
+    void vAppendChar(char chValue)
+    {
+        if (m_nSize + 1 > m_ouBuffer.size())
+        {
+            vGrow(1);
+        }
+        m_ouBuffer[m_nSize++] = chValue;
+    }
+    //Decimal number with at least nMinDigits digits, zero padded
+    void vAppendUInt(unsigned __int64 un64Value, int nMinDigits = 1);
+
+    const char* pchGetData(void) const
+    {
+        return m_ouBuffer.empty() ? NULL : &m_ouBuffer[0];
+    }
+    size_t nGetSize(void) const
+    {
+        return m_nSize;
+    }
+
+private:
+    std::vector<char> m_ouBuffer;
+    size_t m_nSize;
+
+    void vGrow(size_t nLength);
+};
+
+/**
+ * Input that is turned into lines while it is read, like a binary log.
+ */
+class CLineSource
+{
+public:
+    virtual ~CLineSource(void) {}
+
+    //Copies up to nSize bytes of lines to pchBuffer, fewer only at the end of the input
+    virtual size_t nRead(char* pchBuffer, size_t nSize) = 0;
+    //The input could not be read to its end
+    virtual bool bFailed(void) const = 0;
+};
+
+/**
+ * Reads the input in large windows, splits every window on line boundaries
+ * into chunks and converts the chunks on all processors. Chunk results are
+ * written in input order.
+ *
+ * Formats whose lines depend on earlier header lines first scan every chunk
+ * for such lines, then hand the state from chunk to chunk in order, then
+ * convert. The derived class keeps that state per chunk.
+ *
+ * An input stage converts every chunk into the lines this converter reads,
+ * e.g. ASC lines into LOG lines, without an intermediate file.
+ */
+class CLineStreamConverter
+{
+public:
+    CLineStreamConverter(void);
+    virtual ~CLineStreamConverter(void);
+
+    //Converts fpInput into fpOutput, both opened in binary mode
+    HRESULT hConvert(FILE* fpInput, FILE* fpOutput);
+    //Converts the lines of ouInput into fpOutput
+    HRESULT hConvert(CLineSource& ouInput, FILE* fpOutput);
+    //Converts every chunk with pouStage before this converter reads it, NULL for none
+    void vSetInputStage(CLineStreamConverter* pouStage);
+    //0 uses one thread per processor
+    void vSetThreadCount(UINT unThreads);
+    //Throughput of the last conversion
+    unsigned __int64 un64GetBytesRead(void) const;
+    double dGetSeconds(void) const;
+    //Appends " (<MB> MB, <MB/s> MB/s)" to a status text
+    void vAppendThroughput(std::string& omstrStatus) const;
+
+protected:
+    //Bytes left blank at the start of the output for vWriteHeader, which is then called at the end
+    virtual size_t nGetHeaderReserve(void) const;
+    virtual void vWriteHeader(CLineWriter& ouWriter);
+    //A window of unChunks chunks is about to be converted
+    virtual void vBeginWindow(UINT unChunks);
+    //Collects the header lines of one chunk, called in parallel
+    virtual void vScanChunk(UINT unChunk, const char* pchBegin, const char* pchEnd);
+    //Hands the collected state from chunk to chunk, called once after all chunks are scanned
+    virtual void vJoinChunks(UINT unChunks);
+    //Converts the lines of one chunk, called in parallel
+    virtual void vConvertChunk(UINT unChunk, const char* pchBegin, const char* pchEnd, CLineWriter& ouWriter) = 0;
+
+private:
+    struct sCHUNK
+    {
+        const char* m_pchBegin;
+        const char* m_pchEnd;
+        CLineWriter m_ouWriter;
+        CLineWriter m_ouStageWriter;    // Output of the input stage
+    };
+    struct sJOB
+    {
+        CLineStreamConverter* m_pouConverter;
+        CLineStreamConverter* m_pouTarget;  // m_pouConverter or its input stage
+        bool m_bScan;
+        UINT m_unChunks;
+        volatile LONG m_lNextChunk;
+    };
+
+    UINT m_unThreads;
+    unsigned __int64 m_un64BytesRead;
+    double m_dSeconds;
+    std::vector<sCHUNK*> m_ouChunks;
+    CLineStreamConverter* m_pouInputStage;
+
+    UINT unSplitWindow(const char* pchBegin, const char* pchEnd);
+    void vRunStage(UINT unChunks);
+    void vRunChunks(UINT unChunks, bool bScan, CLineStreamConverter* pouTarget);
+    static DWORD WINAPI dwChunkThreadProc(LPVOID pParam);
+};
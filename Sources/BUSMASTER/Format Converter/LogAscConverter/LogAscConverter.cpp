@@ -24,8 +24,7 @@
 
 /* Project includes */
 #include "LogAscConverter.h"
-
-extern "C" int nConvertFile(FILE* fpInputFile, FILE* fpOutputFile);
+#include "LogAscStream.h"
 
 /**
  * \brief Constructor
@@ -175,22 +174,28 @@ HRESULT CLogAscConverter::ConvertFile(string& chInputFile, string& chOutputFile)
     HRESULT hResult = S_OK;
     FILE* fpInputFile = NULL;
     FILE* fpOutputFile = NULL;
-    fopen_s(&fpInputFile, chInputFile.c_str(), _T("r"));
+    fopen_s(&fpInputFile, chInputFile.c_str(), _T("rb"));
 
     if(NULL != fpInputFile)
     {
-        fopen_s(&fpOutputFile, chOutputFile.c_str(), _T("w"));
+        fopen_s(&fpOutputFile, chOutputFile.c_str(), _T("wb"));
 
         if(NULL != fpOutputFile)
         {
-            //yydebug = 1;
-            if (nConvertFile(fpInputFile, fpOutputFile) == -2)
+            CLogAscStream ouStream;
+            if (ouStream.hConvert(fpInputFile, fpOutputFile) != S_OK)
+            {
+                m_omstrConversionStatus = _("Conversion failed");
+                hResult = S_FALSE;
+            }
+            else if (ouStream.bSystemMode())
             {
                 m_omstrConversionStatus = _("Conversion May not be work with CANoe since the input file is logged in system mode");
             }
             else
             {
                 m_omstrConversionStatus = _("Conversion Completed Successfully");
+                ouStream.vAppendThroughput(m_omstrConversionStatus);
             }
             if(fpInputFile != NULL)
             {
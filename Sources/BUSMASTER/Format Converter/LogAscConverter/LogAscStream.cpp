@@ -0,0 +1,293 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LogAscStream.cpp
+ * \brief     Implementation of the CLogAscStream class.
+ *
+ * Converts BUSMASTER CAN log lines into CANoe ASC lines.
+ */
+
+/* Project includes */
+#include "LogAscStream.h"
+
+#define DEF_LOG_DATE_TEXT           "***START DATE AND TIME"
+#define DEF_ASC_MODE_TRAILER        "no internal events logged\r\n// version 7.1.0\r\n"
+
+extern "C" int nGetDayFromDate(char* pchDate, char* pchMonth, char* chWeekDay);
+
+/**
+ * \brief Constructor
+ *
+ * Constructor of CLogAscStream
+ */
+CLogAscStream::CLogAscStream(void)
+{
+    m_lSystemMode = 0;
+}
+
+bool CLogAscStream::bSystemMode(void) const
+{
+    return (m_lSystemMode != 0);
+}
+
+/**
+ * \brief      Converts the lines of a chunk
+ * \param[in]  unChunk Chunk index
+ * \param[in]  pchBegin Chunk start
+ * \param[in]  pchEnd Chunk end
+ * \param[out] ouWriter Converted lines
+ */
+void CLogAscStream::vConvertChunk(UINT /*unChunk*/, const char* pchBegin, const char* pchEnd, CLineWriter& ouWriter)
+{
+    const char* pchLine = pchBegin;
+    while (pchLine < pchEnd)
+    {
+        const char* pchLineEnd = (const char*)memchr(pchLine, '\n', pchEnd - pchLine);
+        if (NULL == pchLineEnd)
+        {
+            pchLineEnd = pchEnd;
+        }
+
+        CLineTokenizer ouTokens(pchLine, pchLineEnd);
+        STEXTVIEW sToken;
+        if (ouTokens.bNext(sToken))
+        {
+            if ( (sToken.m_pchText[0] >= '0') && (sToken.m_pchText[0] <= '9') )
+            {
+                vConvertMessage(sToken, ouTokens, ouWriter);
+            }
+            else if (sToken.m_pchText[0] == '*')
+            {
+                //Whole line without surrounding blanks
+                STEXTVIEW sLine = sToken;
+                sLine.m_nLength = pchLineEnd - sToken.m_pchText;
+                while ( (sLine.m_nLength > 0) && ((sLine.m_pchText[sLine.m_nLength - 1] == ' ') ||
+                        (sLine.m_pchText[sLine.m_nLength - 1] == '\t') || (sLine.m_pchText[sLine.m_nLength - 1] == '\r')) )
+                {
+                    sLine.m_nLength--;
+                }
+                vConvertHeaderLine(sLine, ouWriter);
+            }
+        }
+        pchLine = pchLineEnd + 1;
+    }
+}
+
+/**
+ * \brief      Converts a "***...***" line of the log
+ * \param[in]  sLine Line without surrounding blanks
+ * \param[out] ouWriter Converted line
+ */
+void CLogAscStream::vConvertHeaderLine(const STEXTVIEW& sLine, CLineWriter& ouWriter)
+{
+    size_t nDateLength = strlen(DEF_LOG_DATE_TEXT);
+    if ( (sLine.m_nLength > nDateLength) && (_strnicmp(sLine.m_pchText, DEF_LOG_DATE_TEXT, nDateLength) == 0) )
+    {
+        CLineTokenizer ouTokens(sLine.m_pchText + nDateLength, sLine.m_pchText + sLine.m_nLength);
+        vConvertDate(ouTokens, ouWriter);
+    }
+    else if (sLine.bEqualsNoCase("***HEX***"))
+    {
+        ouWriter.vAppend("base hex  ");
+    }
+    else if (sLine.bEqualsNoCase("***DEC***"))
+    {
+        ouWriter.vAppend("base dec  ");
+    }
+    else if (sLine.bEqualsNoCase("***RELATIVE MODE***"))
+    {
+        ouWriter.vAppend("timestamps relative\r\n" DEF_ASC_MODE_TRAILER);
+    }
+    else if (sLine.bEqualsNoCase("***ABSOLUTE MODE***"))
+    {
+        ouWriter.vAppend("timestamps absolute\r\n" DEF_ASC_MODE_TRAILER);
+    }
+    else if (sLine.bEqualsNoCase("***SYSTEM MODE***"))
+    {
+        InterlockedExchange(&m_lSystemMode, 1);
+        ouWriter.vAppend(DEF_ASC_MODE_TRAILER);
+    }
+    else if (sLine.bEqualsNoCase("***[STOP LOGGING SESSION]***"))
+    {
+        ouWriter.vAppend("End TriggerBlock\r\n\r\n");
+    }
+}
+
+/**
+ * \brief      Converts the start date of a session
+ * \param[in]  ouTokens "d:m:y h:m:s:ms***"
+ * \param[out] ouWriter "date Fri Dec 9 11:58:31 am 2011"
+ */
+void CLogAscStream::vConvertDate(CLineTokenizer& ouTokens, CLineWriter& ouWriter)
+{
+    STEXTVIEW sDate, sTime;
+    unsigned int aunDate[3], aunTime[3];
+    if ( (false == ouTokens.bNext(sDate)) || (false == ouTokens.bNext(sTime)) ||
+            (nGetFields(sDate, aunDate, 3) != 3) || (nGetFields(sTime, aunTime, 3) != 3) )
+    {
+        return;
+    }
+    if ( (aunDate[0] < 1) || (aunDate[0] > 31) || (aunDate[1] < 1) || (aunDate[1] > 12) || (aunDate[2] < 1970) )
+    {
+        return;
+    }
+
+    char acDate[32], acMonth[4] = "", acWeekDay[4] = "";
+    sprintf_s(acDate, sizeof(acDate), "%u:%u:%u", aunDate[0], aunDate[1], aunDate[2]);
+    nGetDayFromDate(acDate, acMonth, acWeekDay);
+
+    bool bPm = (aunTime[0] > 12);
+    if (bPm)
+    {
+        aunTime[0] -= 12;
+    }
+
+    ouWriter.vAppend("date ");
+    ouWriter.vAppend(acWeekDay);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppend(acMonth);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppendUInt(aunDate[0]);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppendUInt(aunTime[0]);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt(aunTime[1]);
+    ouWriter.vAppendChar(':');
+    ouWriter.vAppendUInt(aunTime[2]);
+    ouWriter.vAppend(bPm ? " pm " : " am ");
+    ouWriter.vAppendUInt(aunDate[2]);
+    ouWriter.vAppend("\r\n");
+}
+
+/**
+ * \brief      Converts a message line
+ * \param[in]  sTime First token of the line, h:m:s:ffff
+ * \param[in]  ouTokens Remaining tokens
+ * \param[out] ouWriter Converted line
+ *
+ * "<h:m:s:ffff> <Rx|Tx> <channel> <id> <s|x>[r] <dlc> <data bytes>" becomes
+ * "<seconds.micro> <channel> <id>[x] <Rx|Tx> d <dlc> <data bytes>" or
+ * "<seconds.micro> <channel> <id>[x] <Rx|Tx> r".
+ */
+void CLogAscStream::vConvertMessage(const STEXTVIEW& sTime, CLineTokenizer& ouTokens, CLineWriter& ouWriter)
+{
+    unsigned int aunTime[4];
+    STEXTVIEW sDir, sChannel, sId, sType, sDlc, sByte;
+    if ( (nGetFields(sTime, aunTime, 4) != 4) ||
+            (false == ouTokens.bNext(sDir)) || (false == ouTokens.bNext(sChannel)) ||
+            (false == ouTokens.bNext(sId)) || (false == ouTokens.bNext(sType)) ||
+            (false == ouTokens.bNext(sDlc)) || (false == sDlc.bIsHexNumber()) || (false == sChannel.bIsNumber()) )
+    {
+        return;
+    }
+    if ( (false == sDir.bEqualsNoCase("Tx")) && (false == sDir.bEqualsNoCase("Rx")) )
+    {
+        return;
+    }
+    if ( (sId.m_nLength > 2) && (sId.m_pchText[0] == '0') && ((sId.m_pchText[1] == 'x') || (sId.m_pchText[1] == 'X')) )
+    {
+        sId.m_pchText += 2;
+        sId.m_nLength -= 2;
+    }
+    if (false == sId.bIsHexNumber())
+    {
+        return;
+    }
+
+    bool bExtended, bRemote;
+    if (sType.bEqualsNoCase("s") || sType.bEqualsNoCase("x"))
+    {
+        bRemote = false;
+    }
+    else if (sType.bEqualsNoCase("sr") || sType.bEqualsNoCase("xr"))
+    {
+        bRemote = true;
+    }
+    else
+    {
+        return;
+    }
+    bExtended = (sType.m_pchText[0] == 'x') || (sType.m_pchText[0] == 'X');
+
+    ouWriter.vAppendUInt(((unsigned __int64)aunTime[0] * 3600) + (aunTime[1] * 60) + aunTime[2]);
+    ouWriter.vAppendChar('.');
+    ouWriter.vAppendUInt((unsigned __int64)aunTime[3] * 100, 6);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppend(sChannel);
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppend(sId);
+    if (bExtended)
+    {
+        ouWriter.vAppendChar('x');
+    }
+    ouWriter.vAppendChar(' ');
+    ouWriter.vAppend(sDir);
+
+    if (bRemote)
+    {
+        ouWriter.vAppend(" r\r\n");
+        return;
+    }
+
+    ouWriter.vAppend(" d ");
+    ouWriter.vAppend(sDlc);
+    ouWriter.vAppendChar(' ');
+    while (ouTokens.bNext(sByte) && sByte.bIsHexNumber())
+    {
+        ouWriter.vAppend(sByte);
+        ouWriter.vAppendChar(' ');
+    }
+    ouWriter.vAppend("\r\n");
+}
+
+/**
+ * \brief      Splits "a:b:c..." into numbers
+ * \param[in]  sText Text to split, parsing stops at the first other character
+ * \param[out] punFields Numbers found
+ * \param[in]  nMaxFields Size of punFields
+ * \return     Number of fields found
+ */
+int CLogAscStream::nGetFields(const STEXTVIEW& sText, unsigned int* punFields, int nMaxFields)
+{
+    int nFields = 0;
+    bool bDigits = false;
+    for (size_t i = 0; i < sText.m_nLength; i++)
+    {
+        char chValue = sText.m_pchText[i];
+        if ( (chValue >= '0') && (chValue <= '9') )
+        {
+            if (false == bDigits)
+            {
+                if (nFields == nMaxFields)
+                {
+                    break;
+                }
+                punFields[nFields++] = 0;
+                bDigits = true;
+            }
+            punFields[nFields - 1] = (punFields[nFields - 1] * 10) + (chValue - '0');
+        }
+        else if ( (':' == chValue) && bDigits )
+        {
+            bDigits = false;
+        }
+        else
+        {
+            break;
+        }
+    }
+    return nFields;
+}
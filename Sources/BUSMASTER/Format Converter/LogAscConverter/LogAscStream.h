@@ -0,0 +1,50 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LogAscStream.h
+ * \brief     Definition of the CLogAscStream class.
+ *
+ * Converts BUSMASTER CAN log lines into CANoe ASC lines.
+ */
+
+#pragma once
+
+/* Project includes */
+#include "../FormatConverterApp/LineStreamConverter.h"
+
+/**
+ * LOG to ASC conversion. Every line converts on its own, so chunks need no
+ * scan phase.
+ */
+class CLogAscStream : public CLineStreamConverter
+{
+public:
+    CLogAscStream(void);
+
+    //The log holds a session in system time mode, which CANoe may not read
+    bool bSystemMode(void) const;
+
+protected:
+    virtual void vConvertChunk(UINT unChunk, const char* pchBegin, const char* pchEnd, CLineWriter& ouWriter);
+
+private:
+    volatile LONG m_lSystemMode;
+
+    void vConvertHeaderLine(const STEXTVIEW& sLine, CLineWriter& ouWriter);
+    static void vConvertDate(CLineTokenizer& ouTokens, CLineWriter& ouWriter);
+    static void vConvertMessage(const STEXTVIEW& sTime, CLineTokenizer& ouTokens, CLineWriter& ouWriter);
+    static int nGetFields(const STEXTVIEW& sText, unsigned int* punFields, int nMaxFields);
+};
@@ -0,0 +1,151 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      BlfLineSource.cpp
+ * \brief     Implementation of the CBlfLineSource class.
+ *
+ * CAN messages of a BLF file as BUSMASTER log lines.
+ */
+
+/* Project includes */
+#include "BlfLineSource.h"
+
+/**
+ * \brief     Constructor
+ * \param[in] pouReader Reader with the BLF file opened
+ */
+CBlfLineSource::CBlfLineSource(BLF::IBlfReader* pouReader)
+{
+    m_pouReader = pouReader;
+    m_bStarted = false;
+    m_nLinePos = 0;
+}
+
+/**
+ * \brief      Copies the next log lines
+ * \param[out] pchBuffer Lines, a line may continue in the next call
+ * \param[in]  nSize Size of pchBuffer
+ * \return     Bytes copied, less than nSize only after the last message
+ */
+size_t CBlfLineSource::nRead(char* pchBuffer, size_t nSize)
+{
+    size_t nCopied = 0;
+    while (nCopied < nSize)
+    {
+        if ( (m_nLinePos == m_ouLine.nGetSize()) && (false == bRenderNextLine()) )
+        {
+            break;
+        }
+        size_t nLength = min(m_ouLine.nGetSize() - m_nLinePos, nSize - nCopied);
+        memcpy(pchBuffer + nCopied, m_ouLine.pchGetData() + m_nLinePos, nLength);
+        m_nLinePos += nLength;
+        nCopied += nLength;
+    }
+    return nCopied;
+}
+
+bool CBlfLineSource::bFailed(void) const
+{
+    return (NULL == m_pouReader);
+}
+
+/**
+ * \brief  Renders the next line
+ * \return false after the last message
+ *
+ * The first line sets the number format of the log lines.
+ */
+bool CBlfLineSource::bRenderNextLine(void)
+{
+    m_ouLine.vClear();
+    m_nLinePos = 0;
+    if (NULL == m_pouReader)
+    {
+        return false;
+    }
+
+    if (false == m_bStarted)
+    {
+        m_bStarted = true;
+        m_pouReader->SetFilter(1 << BLF::bokCanMessage, 0);
+        m_pouReader->Rewind();
+        m_ouLine.vAppend("***HEX***\r\n");
+        return true;
+    }
+
+    for (BLF::IBlfObject* pouObject = m_pouReader->GetNextBlfObject(); NULL != pouObject;
+            pouObject = m_pouReader->GetNextBlfObject())
+    {
+        BLF::ICanMessage* pouMessage = pouObject->GetICanMessage();
+        if ( (BLF::bokCanMessage == pouObject->GetKind()) && (NULL != pouMessage) )
+        {
+            vRenderMessage(pouMessage);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * \brief     Renders a CAN message
+ * \param[in] pouMessage Message read from the file
+ *
+ * Time stamps count nanoseconds, as in the BLF to log converter, the log
+ * shows 100 us.
+ */
+void CBlfLineSource::vRenderMessage(BLF::ICanMessage* pouMessage)
+{
+    ULONGLONG ullTime = pouMessage->GetTimestamp() / 100000;
+    m_ouLine.vAppendUInt(ullTime / 36000000);
+    m_ouLine.vAppendChar(':');
+    m_ouLine.vAppendUInt((ullTime / 600000) % 60);
+    m_ouLine.vAppendChar(':');
+    m_ouLine.vAppendUInt((ullTime / 10000) % 60);
+    m_ouLine.vAppendChar(':');
+    m_ouLine.vAppendUInt(ullTime % 10000, 4);
+
+    m_ouLine.vAppend((BLF::mdRx == pouMessage->GetDirection()) ? " Rx " : " Tx ");
+    m_ouLine.vAppendUInt(pouMessage->GetChannelNo());
+    m_ouLine.vAppendChar(' ');
+
+    DWORD dwId = pouMessage->GetId();
+    vAppendHex(m_ouLine, dwId & 0x7FFFFFFF, 1);
+    m_ouLine.vAppend((0 == (dwId & 0x80000000)) ? " s " : " x ");
+
+    UINT unLength = min((UINT)pouMessage->GetDLC(), (UINT)defBLF_MAX_DATA_BYTES);
+    const BYTE* pbyData = pouMessage->GetData();
+    m_ouLine.vAppendUInt(pouMessage->GetDLC());
+    for (UINT i = 0; (NULL != pbyData) && (i < unLength); i++)
+    {
+        m_ouLine.vAppendChar(' ');
+        vAppendHex(m_ouLine, pbyData[i], 2);
+    }
+    m_ouLine.vAppend("\r\n", 2);
+}
+
+void CBlfLineSource::vAppendHex(CLineWriter& ouWriter, UINT unValue, int nMinDigits)
+{
+    static const char acDigits[] = "0123456789ABCDEF";
+    int nDigits = 1;
+    while ( (nDigits < 8) && ((unValue >> (nDigits * 4)) != 0) )
+    {
+        nDigits++;
+    }
+    for (nDigits = max(nDigits, nMinDigits); nDigits > 0; nDigits--)
+    {
+        ouWriter.vAppendChar(acDigits[(unValue >> ((nDigits - 1) * 4)) & 0xF]);
+    }
+}
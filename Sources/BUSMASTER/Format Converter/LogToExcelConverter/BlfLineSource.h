@@ -0,0 +1,54 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      BlfLineSource.h
+ * \brief     Definition of the CBlfLineSource class.
+ *
+ * CAN messages of a BLF file as BUSMASTER log lines.
+ */
+
+#pragma once
+
+/* Project includes */
+#include "../FormatConverterApp/LineStreamConverter.h"
+#include <IBlfLibrary.h>
+
+#define defBLF_MAX_DATA_BYTES       8
+
+/**
+ * Renders the CAN messages of an opened BLF reader as hexadecimal log lines
+ * "<h:m:s:ffff> <Rx|Tx> <channel> <id> <s|x> <dlc> <data bytes>", one message
+ * at a time, so the file is never converted as a whole.
+ */
+class CBlfLineSource : public CLineSource
+{
+public:
+    //pouReader is opened by the caller and stays open while lines are read
+    CBlfLineSource(BLF::IBlfReader* pouReader);
+
+    virtual size_t nRead(char* pchBuffer, size_t nSize);
+    virtual bool bFailed(void) const;
+
+private:
+    BLF::IBlfReader* m_pouReader;
+    bool m_bStarted;
+    CLineWriter m_ouLine;       // Line not yet copied completely
+    size_t m_nLinePos;
+
+    bool bRenderNextLine(void);
+    void vRenderMessage(BLF::ICanMessage* pouMessage);
+    static void vAppendHex(CLineWriter& ouWriter, UINT unValue, int nMinDigits);
+};
@@ -144,6 +144,7 @@ enum
 #define EXPORTTOEXCEL_FILEERROR             _("Enter log and CSV file details!")
 #define EXPORTTOEXCEL_LOGFILEOPENERROR      _("Log file doesn't exist!")
 #define EXPORTTOEXCEL_CSVFILEOPENERROR      _("CSV file doesn't exist!")
+#define EXPORTTOEXCEL_DECODEERROR           _("The database network could not be loaded, signals are not exported.")
 
 #define ERR_EXPORTTOEXCEL_SYNTAXERROR           0xF000
 #define ERR_EXPORTTOEXCEL_FILESNOTOPEN          ERR_EXPORTTOEXCEL_SYNTAXERROR + 1
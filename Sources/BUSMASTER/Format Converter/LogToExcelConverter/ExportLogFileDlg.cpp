@@ -29,12 +29,14 @@
 #define nullptr NULL
 // CDefConverterPage dialog
 #define WM_UPDATEUI WM_USER+1
+#define defDB_FILE_BUFFER_SIZE      (64 * MAX_PATH)
 //To be removed after migrating to VS2012 from VS2008
 IMPLEMENT_DYNAMIC(CExportLogFileDlg, CPropertyPage)
 CExportLogFileDlg::CExportLogFileDlg(ETYPE_BUS eBus, CWnd* pParent /*=NULL*/)
     : CPropertyPage(CExportLogFileDlg::IDD)
     , m_omStrLogFileName("")
     , m_omStrCSVFileName("")
+    , m_bDecodeSignals(FALSE)
 {
     m_eBus = eBus;
     m_unNoOfFileds = 0;
@@ -72,6 +74,7 @@ void CExportLogFileDlg::DoDataExchange(CDataExchange* pDX)
     DDX_Control(pDX, IDC_BUTTON_REMOVEONE, m_omRemoveOneField);
     DDX_Control(pDX, IDC_BUTTON_REMOVEALL, m_omRemoveAllFields);
     DDX_Control(pDX, IDC_COMBO_BUSTYPE, m_omBusType);
+    DDX_Check(pDX, IDC_CHECK_DECODE_SIGNALS, m_bDecodeSignals);
 }
 
 BEGIN_MESSAGE_MAP(CExportLogFileDlg, CPropertyPage)
@@ -117,7 +120,7 @@ void CExportLogFileDlg::OnBnClickedBtnLogBrowse()
         if ( nIndex >= 0)
         {
             CString omStrOutputFile = m_omStrLogFileName.Left(nIndex);
-            omStrOutputFile += ".xls";
+            omStrOutputFile += "." defSTR_CSV_FORMAT;
             m_omStrCSVFileName = omStrOutputFile;
         }
 
@@ -135,10 +138,10 @@ void CExportLogFileDlg::OnBnClickedBtnCsvBrowse()
     UpdateData( TRUE );
     // Create Save File Dialog with overwrite warning
     CFileDialog omSaveAsDlg( FALSE,                 // Save File dialog
-                             defSTR_XLS_FORMAT,     // Default Extension,
+                             defSTR_CSV_FORMAT,     // Default Extension,
                              NULL,
                              OFN_HIDEREADONLY | OFN_OVERWRITEPROMPT,
-                             _(defSTR_XLS_FORMAT_SPECIFIER),
+                             _(defSTR_EXPORT_FORMAT_SPECIFIER),
                              NULL );
     // Set Title to Export
     omSaveAsDlg.m_ofn.lpstrTitle  = _(defSTR_CSV_DIALOG_CAPTION);
@@ -256,6 +259,7 @@ BOOL CExportLogFileDlg::OnInitDialog()
     }
 
     m_omBusType.SelectString(0, omStrBus);
+    GetDlgItem(IDC_CHECK_DECODE_SIGNALS)->EnableWindow(m_eBus == CAN);
     vPopulateAvailableList();
     vEnableDisableControls();
     return TRUE;
@@ -265,7 +269,9 @@ LPARAM CExportLogFileDlg::UpdateUI(WPARAM wParam, LPARAM)
     HRESULT hResult = (HRESULT)wParam;
     if( S_OK == hResult )
     {
-        MessageBox(_(EXPORTTOEXCEL_SUCCESSMSG),_(APPLICATION_NAME),MB_OK);
+        CString omStrMessage(_(EXPORTTOEXCEL_SUCCESSMSG));
+        omStrMessage += m_omStrThroughput;
+        MessageBox(omStrMessage,_(APPLICATION_NAME),MB_OK);
         //OnOK();
     }
     GetDlgItem(ID_CONVERT)->EnableWindow(TRUE);
@@ -293,9 +299,14 @@ DWORD WINAPI ExportLogFileThreadProc(LPVOID pVoid)
 
         /* Set the bus type */
         oExport.vSetBUSType(pExportLogFileDlg->m_eBus);
-
-        //convert log file to excel file
-        HRESULT hResult = oExport.bConvert();;
+        oExport.vSetDecodeSignals(pExportLogFileDlg->m_bDecodeSignals);
+        oExport.vSetDatabases(pExportLogFileDlg->m_omDatabases);
+
+        //convert log file to csv or columnar file
+        HRESULT hResult = oExport.bConvert();
+        string omStrThroughput;
+        oExport.vGetThroughput(omStrThroughput);
+        pExportLogFileDlg->m_omStrThroughput = omStrThroughput.c_str();
         pExportLogFileDlg->PostMessage(WM_UPDATEUI,(WPARAM)hResult,0);
     }
     else
@@ -311,6 +322,7 @@ DWORD WINAPI ExportLogFileThreadProc(LPVOID pVoid)
  */
 void CExportLogFileDlg::OnBnClickedConvert()
 {
+    UpdateData( TRUE );
 
     // Log File name and Excel File name
     CString strLogFileName = m_omStrLogFileName;
@@ -321,6 +333,7 @@ void CExportLogFileDlg::OnBnClickedConvert()
     {
         if( m_omSelectedList.GetCount() != 0 )
         {
+            vSelectDatabases();
             GetDlgItem(ID_CONVERT)->EnableWindow(FALSE);
             mExprtLogFileThrdHandle = CreateThread(nullptr, 0, ExportLogFileThreadProc, this, 0, 0x0);
         }
@@ -336,6 +349,43 @@ void CExportLogFileDlg::OnBnClickedConvert()
 }
 
 
+/**
+ * \brief Select Databases
+ *
+ * ASC and BLF files don't name their databases, so they are asked for when
+ * signals shall be decoded. Without a selection only the fields are exported.
+ */
+void CExportLogFileDlg::vSelectDatabases()
+{
+    m_omDatabases.clear();
+    string strLogFileName = (LPCSTR)m_omStrLogFileName;
+    if ( (FALSE == m_bDecodeSignals) ||
+            ((false == CLogToExcel::bIsAscFile(strLogFileName)) && (false == CLogToExcel::bIsBlfFile(strLogFileName))) )
+    {
+        return;
+    }
+
+    vector<char> acFiles(defDB_FILE_BUFFER_SIZE, '\0');
+    CFileDialog omDatabaseDlg( TRUE,
+                               NULL,
+                               NULL,
+                               OFN_HIDEREADONLY | OFN_FILEMUSTEXIST | OFN_ALLOWMULTISELECT | OFN_EXPLORER,
+                               defSTR_DB_FORMAT_SPECIFIER,
+                               this );
+    omDatabaseDlg.m_ofn.lpstrTitle = defSTR_DB_DIALOG_CAPTION;
+    omDatabaseDlg.m_ofn.lpstrFile = &acFiles[0];
+    omDatabaseDlg.m_ofn.nMaxFile = (DWORD)acFiles.size();
+
+    if ( omDatabaseDlg.DoModal() == IDOK )
+    {
+        POSITION pos = omDatabaseDlg.GetStartPosition();
+        while (NULL != pos)
+        {
+            m_omDatabases.push_back((LPCSTR)omDatabaseDlg.GetNextPathName(pos));
+        }
+    }
+}
+
 /**
  * \brief On Listbutton Select Change List Available
  *
@@ -541,6 +591,7 @@ void CExportLogFileDlg::OnCbnSelchangeComboBustype()
     }
 
     SetWindowText(omTitle);
+    GetDlgItem(IDC_CHECK_DECODE_SIGNALS)->EnableWindow(m_eBus == CAN);
     vPopulateAvailableList();
     vEnableDisableControls();
     m_omStrLogFileName = "";
@@ -56,11 +56,15 @@ public:
     CString m_omStrLogFileName;
     afx_msg void OnBnClickedBtnCsvBrowse();
     CString m_omStrCSVFileName;
+    BOOL m_bDecodeSignals;
+    vector<string> m_omDatabases;
+    CString m_omStrThroughput;
     afx_msg void OnBnClickedButtonSelectall();
     virtual BOOL OnInitDialog();
 private:
     void vPopulateAvailableList();
     void vEnableDisableControls();
+    void vSelectDatabases();
 
 public:
     CListBox m_omAvailableList;
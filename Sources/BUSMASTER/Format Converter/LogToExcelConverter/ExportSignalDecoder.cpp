@@ -0,0 +1,237 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      ExportSignalDecoder.cpp
+ * \brief     Implementation of the CExportSignalDecoder class.
+ *
+ * Signals of the CAN databases used by the log export.
+ */
+
+/* C++ includes */
+#include <algorithm>
+
+/* Project includes */
+#include "ExportSignalDecoder.h"
+#include "../../../Kernel/BusmasterKernel/IBusMasterKernel.h"
+#include "../../../Kernel/ProtocolDefinitions/CANDefines.h"
+
+#define defKERNEL_DLL_NAME          "BusmasterKernel.dll"
+#define defKERNEL_GET_FUNC          "getBusmasterKernel"
+
+static bool bColumnLess(const SEXPORT_VALUE& sLeft, const SEXPORT_VALUE& sRight)
+{
+    return sLeft.m_unColumn < sRight.m_unColumn;
+}
+
+/**
+ * \brief Constructor
+ *
+ * Constructor of CExportSignalDecoder
+ */
+CExportSignalDecoder::CExportSignalDecoder(void)
+{
+    m_pouNetwork = NULL;
+    m_unColumns = 0;
+}
+
+/**
+ * \brief Destructor
+ *
+ * Releases the loaded databases.
+ */
+CExportSignalDecoder::~CExportSignalDecoder(void)
+{
+    if (NULL != m_pouNetwork)
+    {
+        m_pouNetwork->ReSetNetwork(CAN);
+    }
+}
+
+/**
+ * \brief  Attaches the database network
+ * \return S_OK, E_FAIL if the kernel can not be loaded
+ *
+ * The converters run from the BUSMASTER binary folder, so the kernel is
+ * found there. It stays loaded for the process, as in the application.
+ */
+HRESULT CExportSignalDecoder::hOpenNetwork(void)
+{
+    if (NULL == m_pouNetwork)
+    {
+        HMODULE hKernel = LoadLibrary(defKERNEL_DLL_NAME);
+        pGetBusmasterKernel pfGetKernel = (NULL == hKernel) ? NULL : (pGetBusmasterKernel)GetProcAddress(hKernel, defKERNEL_GET_FUNC);
+        IBusMasterKernel* pouKernel = NULL;
+        if ( (NULL == pfGetKernel) || (pfGetKernel(&pouKernel) != S_OK) || (NULL == pouKernel) )
+        {
+            return E_FAIL;
+        }
+        //Sets the service though it returns S_FALSE
+        pouKernel->getDatabaseService(&m_pouNetwork);
+        if (NULL == m_pouNetwork)
+        {
+            return E_FAIL;
+        }
+    }
+    m_pouNetwork->ReSetNetwork(CAN);
+    m_pouNetwork->SetChannelCount(CAN, 1);
+    m_omMessages.clear();
+    m_unColumns = 0;
+    return S_OK;
+}
+
+/**
+ * \brief     Adds the frames of a database
+ * \param[in] omStrFileName Database file, any format the network parses
+ * \return    S_OK, S_FALSE if it can not be loaded, E_FAIL without network
+ *
+ * A frame found in several databases keeps the signals of the first one.
+ */
+HRESULT CExportSignalDecoder::hLoadDatabase(const std::string& omStrFileName)
+{
+    if (NULL == m_pouNetwork)
+    {
+        return E_FAIL;
+    }
+    return (EC_SUCCESS == m_pouNetwork->LoadDb(CAN, 0, omStrFileName)) ? S_OK : S_FALSE;
+}
+
+/**
+ * \brief Numbers the signal columns
+ *
+ * Signals of a frame get adjacent columns in name order, frames follow in
+ * ID order.
+ */
+void CExportSignalDecoder::vAssignColumns(void)
+{
+    m_omMessages.clear();
+    m_unColumns = 0;
+    if (NULL == m_pouNetwork)
+    {
+        return;
+    }
+
+    std::list<IFrame*> ouFrames;
+    m_pouNetwork->GetFrameList(CAN, 0, ouFrames);
+    for (std::list<IFrame*>::iterator itFrame = ouFrames.begin(); itFrame != ouFrames.end(); ++itFrame)
+    {
+        IFrame* pouFrame = *itFrame;
+        unsigned int unId = 0;
+        CANFrameProps ouProps;
+        ouProps.m_canMsgType = eCan_Standard;
+        pouFrame->GetFrameId(unId);
+        pouFrame->GetProperties(ouProps);
+        UINT unKey = (eCan_Extended == ouProps.m_canMsgType) ? (unId | defEXPORT_EXTENDED_KEY) : unId;
+
+        std::map<ISignal*, SignalInstanse> ouSignals;
+        pouFrame->GetSignalList(ouSignals);
+        if ( ouSignals.empty() || (m_omMessages.find(unKey) != m_omMessages.end()) )
+        {
+            continue;
+        }
+
+        SEXPORT_MESSAGE& sMessage = m_omMessages[unKey];
+        sMessage.m_pouFrame = pouFrame;
+        sMessage.m_unFirstColumn = 0;
+        pouFrame->GetName(sMessage.m_omStrName);
+        for (std::map<ISignal*, SignalInstanse>::iterator itSignal = ouSignals.begin(); itSignal != ouSignals.end(); ++itSignal)
+        {
+            std::string omStrSignal;
+            itSignal->first->GetName(omStrSignal);
+            sMessage.m_ouSignalNames.push_back(omStrSignal);
+        }
+        std::sort(sMessage.m_ouSignalNames.begin(), sMessage.m_ouSignalNames.end());
+        sMessage.m_ouSignalNames.erase(std::unique(sMessage.m_ouSignalNames.begin(), sMessage.m_ouSignalNames.end()),
+                                       sMessage.m_ouSignalNames.end());
+    }
+
+    for (std::map<UINT, SEXPORT_MESSAGE>::iterator itMessage = m_omMessages.begin(); itMessage != m_omMessages.end(); ++itMessage)
+    {
+        itMessage->second.m_unFirstColumn = m_unColumns;
+        m_unColumns += (UINT)itMessage->second.m_ouSignalNames.size();
+    }
+}
+
+UINT CExportSignalDecoder::unGetColumnCount(void) const
+{
+    return m_unColumns;
+}
+
+/**
+ * \brief      Names of the signal columns
+ * \param[out] ouNames "<message>.<signal>", in column order
+ */
+void CExportSignalDecoder::vGetColumnNames(std::vector<std::string>& ouNames) const
+{
+    ouNames.clear();
+    ouNames.reserve(m_unColumns);
+    for (std::map<UINT, SEXPORT_MESSAGE>::const_iterator itMessage = m_omMessages.begin(); itMessage != m_omMessages.end(); ++itMessage)
+    {
+        for (size_t i = 0; i < itMessage->second.m_ouSignalNames.size(); i++)
+        {
+            ouNames.push_back(itMessage->second.m_omStrName + "." + itMessage->second.m_ouSignalNames[i]);
+        }
+    }
+}
+
+/**
+ * \brief     Looks up the signals of a frame
+ * \param[in] unId Frame ID
+ * \param[in] bExtended Extended frame
+ * \return    Message or NULL
+ */
+const SEXPORT_MESSAGE* CExportSignalDecoder::psGetMessage(UINT unId, bool bExtended) const
+{
+    std::map<UINT, SEXPORT_MESSAGE>::const_iterator itMessage = m_omMessages.find(bExtended ? (unId | defEXPORT_EXTENDED_KEY) : unId);
+    if (itMessage == m_omMessages.end())
+    {
+        return NULL;
+    }
+    return &itMessage->second;
+}
+
+/**
+ * \brief      Decodes the signals of a frame
+ * \param[in]  sMessage Frame looked up with psGetMessage
+ * \param[in]  pbyData Data bytes of the frame
+ * \param[in]  unLength Number of data bytes
+ * \param[out] ouValues Physical values appended, sorted by column
+ *
+ * The frame of the network interprets the bytes, including multiplexed
+ * signals. Only the multiplexed signals selected by the frame get a value.
+ */
+void CExportSignalDecoder::vDecode(const SEXPORT_MESSAGE& sMessage, const BYTE* pbyData, UINT unLength, std::vector<SEXPORT_VALUE>& ouValues)
+{
+    std::vector<SignalValue> ouSignals;
+    if ( (0 == unLength) || (EC_SUCCESS != sMessage.m_pouFrame->InterpretSignals(pbyData, (int)unLength, ouSignals)) )
+    {
+        return;
+    }
+
+    size_t nFirst = ouValues.size();
+    for (size_t i = 0; i < ouSignals.size(); i++)
+    {
+        std::vector<std::string>::const_iterator itName =
+            std::lower_bound(sMessage.m_ouSignalNames.begin(), sMessage.m_ouSignalNames.end(), ouSignals[i].mName);
+        if ( (itName != sMessage.m_ouSignalNames.end()) && (*itName == ouSignals[i].mName) )
+        {
+            SEXPORT_VALUE sValue;
+            sValue.m_unColumn = sMessage.m_unFirstColumn + (UINT)(itName - sMessage.m_ouSignalNames.begin());
+            sValue.m_dValue = ouSignals[i].mPhyicalValue;
+            ouValues.push_back(sValue);
+        }
+    }
+    std::sort(ouValues.begin() + nFirst, ouValues.end(), bColumnLess);
+}
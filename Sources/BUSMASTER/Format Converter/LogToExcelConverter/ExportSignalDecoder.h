@@ -0,0 +1,92 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      ExportSignalDecoder.h
+ * \brief     Definition of the CExportSignalDecoder class.
+ *
+ * Signals of the CAN databases used by the log export.
+ */
+
+#pragma once
+
+/* C++ includes */
+#include <map>
+#include <string>
+#include <vector>
+
+/* Windows includes */
+#include <windows.h>
+
+#define defEXPORT_EXTENDED_KEY      0x80000000  // Added to the ID of extended frames in the message map
+
+class IFrame;
+class IBMNetWorkService;
+
+/**
+ * Physical value of one signal column.
+ */
+struct sEXPORT_VALUE
+{
+    UINT m_unColumn;
+    double m_dValue;
+};
+typedef sEXPORT_VALUE SEXPORT_VALUE;
+
+/**
+ * Signals of one frame. They own the output columns
+ * m_unFirstColumn .. m_unFirstColumn + m_ouSignalNames.size() - 1.
+ */
+struct sEXPORT_MESSAGE
+{
+    std::string m_omStrName;
+    IFrame* m_pouFrame;
+    UINT m_unFirstColumn;
+    std::vector<std::string> m_ouSignalNames;   // Sorted, in column order
+};
+typedef sEXPORT_MESSAGE SEXPORT_MESSAGE;
+
+/**
+ * Loads CAN databases into the database network of the BUSMASTER kernel and
+ * decodes data bytes of logged frames with it, so the export reads every
+ * format the application reads. Decoding only reads the loaded frames, so
+ * the export workers share one decoder.
+ */
+class CExportSignalDecoder
+{
+public:
+    CExportSignalDecoder(void);
+    ~CExportSignalDecoder(void);
+
+    //Attaches the kernel's database network and empties it, E_FAIL if the kernel can not be loaded
+    HRESULT hOpenNetwork(void);
+    //Adds the frames of a CAN database, S_FALSE if it can not be loaded
+    HRESULT hLoadDatabase(const std::string& omStrFileName);
+    //Numbers the signal columns in frame ID order, call after the last database is loaded
+    void vAssignColumns(void);
+
+    UINT unGetColumnCount(void) const;
+    //"<message>.<signal>" of every column
+    void vGetColumnNames(std::vector<std::string>& ouNames) const;
+    //NULL if the frame is unknown
+    const SEXPORT_MESSAGE* psGetMessage(UINT unId, bool bExtended) const;
+    //Appends the physical values of the frame's signals to ouValues, in column order
+    static void vDecode(const SEXPORT_MESSAGE& sMessage, const BYTE* pbyData, UINT unLength, std::vector<SEXPORT_VALUE>& ouValues);
+
+private:
+    IBMNetWorkService* m_pouNetwork;
+    std::map<UINT, SEXPORT_MESSAGE> m_omMessages;
+    UINT m_unColumns;
+};
@@ -0,0 +1,653 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LogExportStream.cpp
+ * \brief     Implementation of the CLogExportStream class.
+ *
+ * Exports the fields and decoded signals of BUSMASTER log lines.
+ */
+
+/* C++ includes */
+#include <limits>
+
+/* Project includes */
+#include "LogExportStream.h"
+
+#define defEXPORT_MAX_DATA_BYTES    64
+
+/**
+ * \brief     Constructor
+ * \param[in] eFormat CSV or columnar output
+ * \param[in] unFields Fields per log line
+ */
+CLogExportStream::CLogExportStream(EEXPORT_FORMAT eFormat, UINT unFields)
+{
+    m_eFormat = eFormat;
+    m_unFields = min(unFields, (UINT)defEXPORT_MAX_FIELDS);
+    m_pouDecoder = NULL;
+    m_unSignalColumns = 0;
+    m_bHex = true;
+    vBuildHeader();
+}
+
+/**
+ * \brief     Adds a field column
+ * \param[in] unField Field index in the log line
+ * \param[in] pchName Column name
+ */
+void CLogExportStream::vSelectField(UINT unField, const char* pchName)
+{
+    if (unField < m_unFields)
+    {
+        m_ouSelectedFields.push_back(unField);
+        m_ouFieldNames.push_back(pchName);
+        vBuildHeader();
+    }
+}
+
+/**
+ * \brief     Adds the signal columns
+ * \param[in] pouDecoder Databases of the log, NULL exports no signals
+ */
+void CLogExportStream::vSetDecoder(const CExportSignalDecoder* pouDecoder)
+{
+    m_pouDecoder = pouDecoder;
+    m_unSignalColumns = (NULL == pouDecoder) ? 0 : pouDecoder->unGetColumnCount();
+    if (0 == m_unSignalColumns)
+    {
+        m_pouDecoder = NULL;
+    }
+    vBuildHeader();
+}
+
+/**
+ * \brief Builds the column header
+ *
+ * The header is complete before the first line is read, so it is reserved
+ * with its exact size.
+ */
+void CLogExportStream::vBuildHeader(void)
+{
+    std::vector<std::string> ouNames(m_ouFieldNames);
+    std::vector<BYTE> ouTypes;
+    for (size_t i = 0; i < m_ouSelectedFields.size(); i++)
+    {
+        ouTypes.push_back((m_ouSelectedFields[i] == defEXPORT_FIELD_TIME) ? defEXPORT_COLUMN_F64 : defEXPORT_COLUMN_TEXT);
+    }
+    if (NULL != m_pouDecoder)
+    {
+        std::vector<std::string> ouSignalNames;
+        m_pouDecoder->vGetColumnNames(ouSignalNames);
+        ouNames.insert(ouNames.end(), ouSignalNames.begin(), ouSignalNames.end());
+        ouTypes.resize(ouNames.size(), defEXPORT_COLUMN_SPARSE_F64);
+    }
+
+    m_omStrHeader.clear();
+    if (EXPORT_CSV == m_eFormat)
+    {
+        CLineWriter ouWriter;
+        for (size_t i = 0; i < ouNames.size(); i++)
+        {
+            if (i > 0)
+            {
+                ouWriter.vAppendChar(',');
+            }
+            vAppendCsvField(ouWriter, ouNames[i].c_str(), ouNames[i].size());
+        }
+        ouWriter.vAppend("\r\n", 2);
+        m_omStrHeader.assign(ouWriter.pchGetData(), ouWriter.nGetSize());
+        return;
+    }
+
+    UINT unColumns = (UINT)ouNames.size();
+    m_omStrHeader.append(defEXPORT_COLUMNAR_MAGIC);
+    m_omStrHeader.append((const char*)&unColumns, sizeof(unColumns));
+    for (size_t i = 0; i < ouNames.size(); i++)
+    {
+        WORD wLength = (WORD)min(ouNames[i].size(), (size_t)0xFFFF);
+        m_omStrHeader += (char)ouTypes[i];
+        m_omStrHeader.append((const char*)&wLength, sizeof(wLength));
+        m_omStrHeader.append(ouNames[i].c_str(), wLength);
+    }
+}
+
+size_t CLogExportStream::nGetHeaderReserve(void) const
+{
+    return m_omStrHeader.size();
+}
+
+void CLogExportStream::vWriteHeader(CLineWriter& ouWriter)
+{
+    ouWriter.vAppend(m_omStrHeader.c_str(), m_omStrHeader.size());
+}
+
+/**
+ * \brief     Prepares the per chunk state
+ * \param[in] unChunks Chunks in the window
+ */
+void CLogExportStream::vBeginWindow(UINT unChunks)
+{
+    m_ouChunkStates.resize(unChunks);
+    for (UINT i = 0; i < unChunks; i++)
+    {
+        m_ouChunkStates[i].m_bStartHex = m_bHex;
+        m_ouChunkStates[i].m_nLastFormat = -1;
+    }
+
+    if (EXPORT_COLUMNAR == m_eFormat)
+    {
+        if (m_ouColumnChunks.size() < unChunks)
+        {
+            m_ouColumnChunks.resize(unChunks);
+        }
+        for (UINT i = 0; i < unChunks; i++)
+        {
+            m_ouColumnChunks[i].m_unRows = 0;
+            m_ouColumnChunks[i].m_ouValues.resize(m_ouSelectedFields.size());
+            m_ouColumnChunks[i].m_ouOffsets.resize(m_ouSelectedFields.size());
+        }
+    }
+}
+
+/**
+ * \brief     Finds the last number format line of a chunk
+ * \param[in] unChunk Chunk index
+ * \param[in] pchBegin Chunk start
+ * \param[in] pchEnd Chunk end
+ */
+void CLogExportStream::vScanChunk(UINT unChunk, const char* pchBegin, const char* pchEnd)
+{
+    if (NULL == m_pouDecoder)
+    {
+        return;
+    }
+
+    const char* pchLine = pchBegin;
+    while (pchLine < pchEnd)
+    {
+        const char* pchLineEnd = (const char*)memchr(pchLine, '\n', pchEnd - pchLine);
+        if (NULL == pchLineEnd)
+        {
+            pchLineEnd = pchEnd;
+        }
+        if ( (pchLine < pchLineEnd) && (pchLine[0] == '*') )
+        {
+            int nFormat = nGetFormatLine(pchLine, pchLineEnd);
+            if (nFormat >= 0)
+            {
+                m_ouChunkStates[unChunk].m_nLastFormat = nFormat;
+            }
+        }
+        pchLine = pchLineEnd + 1;
+    }
+}
+
+/**
+ * \brief     Hands the number format from chunk to chunk
+ * \param[in] unChunks Chunks in the window
+ */
+void CLogExportStream::vJoinChunks(UINT unChunks)
+{
+    for (UINT i = 0; i < unChunks; i++)
+    {
+        m_ouChunkStates[i].m_bStartHex = m_bHex;
+        if (m_ouChunkStates[i].m_nLastFormat >= 0)
+        {
+            m_bHex = (m_ouChunkStates[i].m_nLastFormat == 1);
+        }
+    }
+}
+
+/**
+ * \brief      Exports the message lines of a chunk
+ * \param[in]  unChunk Chunk index
+ * \param[in]  pchBegin Chunk start
+ * \param[in]  pchEnd Chunk end
+ * \param[out] ouWriter CSV rows or one columnar block
+ *
+ * Header lines and lines starting with a blank are skipped.
+ */
+void CLogExportStream::vConvertChunk(UINT unChunk, const char* pchBegin, const char* pchEnd, CLineWriter& ouWriter)
+{
+    bool bHex = m_ouChunkStates[unChunk].m_bStartHex;
+    std::vector<SEXPORT_VALUE>& ouValues = m_ouChunkStates[unChunk].m_ouValues;
+    STEXTVIEW asFields[defEXPORT_MAX_FIELDS];
+
+    const char* pchLine = pchBegin;
+    while (pchLine < pchEnd)
+    {
+        const char* pchLineEnd = (const char*)memchr(pchLine, '\n', pchEnd - pchLine);
+        if (NULL == pchLineEnd)
+        {
+            pchLineEnd = pchEnd;
+        }
+
+        if ( (pchLine == pchLineEnd) || (pchLine[0] == ' ') || (pchLine[0] == '\r') )
+        {
+            //Empty or continuation line
+        }
+        else if (pchLine[0] == '*')
+        {
+            int nFormat = nGetFormatLine(pchLine, pchLineEnd);
+            if (nFormat >= 0)
+            {
+                bHex = (nFormat == 1);
+            }
+        }
+        else
+        {
+            UINT unFieldCount = unSplitLine(pchLine, pchLineEnd, asFields);
+            if (EXPORT_CSV == m_eFormat)
+            {
+                vWriteCsvRow(asFields, unFieldCount, bHex, ouValues, ouWriter);
+            }
+            else
+            {
+                vAddColumnarRow(asFields, unFieldCount, bHex, ouValues, m_ouColumnChunks[unChunk]);
+            }
+        }
+        pchLine = pchLineEnd + 1;
+    }
+
+    if (EXPORT_COLUMNAR == m_eFormat)
+    {
+        vWriteColumnarBlock(m_ouColumnChunks[unChunk], ouWriter);
+    }
+}
+
+/**
+ * \brief      Splits a message line into fields
+ * \param[in]  pchBegin Line start
+ * \param[in]  pchEnd Line end
+ * \param[out] psFields Fields, the last one holds the rest of the line
+ * \return     Number of fields found
+ */
+UINT CLogExportStream::unSplitLine(const char* pchBegin, const char* pchEnd, STEXTVIEW* psFields) const
+{
+    UINT unCount = 0;
+    const char* pchPos = pchBegin;
+    while (unCount < m_unFields)
+    {
+        while ( (pchPos < pchEnd) && ((*pchPos == ' ') || (*pchPos == '\t') || (*pchPos == '\r')) )
+        {
+            pchPos++;
+        }
+        if (pchPos == pchEnd)
+        {
+            break;
+        }
+
+        const char* pchFieldEnd = pchPos;
+        if (unCount == m_unFields - 1)
+        {
+            pchFieldEnd = pchEnd;
+            while ( (pchFieldEnd > pchPos) && ((pchFieldEnd[-1] == ' ') || (pchFieldEnd[-1] == '\t') || (pchFieldEnd[-1] == '\r')) )
+            {
+                pchFieldEnd--;
+            }
+        }
+        else
+        {
+            while ( (pchFieldEnd < pchEnd) && (*pchFieldEnd != ' ') && (*pchFieldEnd != '\t') && (*pchFieldEnd != '\r') )
+            {
+                pchFieldEnd++;
+            }
+        }
+        psFields[unCount].m_pchText = pchPos;
+        psFields[unCount].m_nLength = pchFieldEnd - pchPos;
+        unCount++;
+        pchPos = pchFieldEnd;
+    }
+    return unCount;
+}
+
+/**
+ * \brief      Decodes the signals of a CAN message line
+ * \param[in]  psFields Fields of the line
+ * \param[in]  unFieldCount Number of fields
+ * \param[in]  bHex Number format of the ID and data bytes
+ * \param[out] ouValues Signal values sorted by column, empty for unknown and remote frames
+ */
+void CLogExportStream::vDecodeFrame(const STEXTVIEW* psFields, UINT unFieldCount, bool bHex, std::vector<SEXPORT_VALUE>& ouValues) const
+{
+    ouValues.clear();
+    if ( (NULL == m_pouDecoder) || (unFieldCount <= defEXPORT_CAN_FIELD_DATA) )
+    {
+        return;
+    }
+
+    const STEXTVIEW& sType = psFields[defEXPORT_CAN_FIELD_TYPE];
+    if ( (sType.m_nLength > 1) && ((sType.m_pchText[1] == 'r') || (sType.m_pchText[1] == 'R')) )
+    {
+        return;
+    }
+    bool bExtended = (sType.m_pchText[0] == 'x') || (sType.m_pchText[0] == 'X');
+
+    UINT unId;
+    if (false == bGetNumber(psFields[defEXPORT_CAN_FIELD_ID], bHex, unId))
+    {
+        return;
+    }
+    const SEXPORT_MESSAGE* psMessage = m_pouDecoder->psGetMessage(unId, bExtended);
+    if (NULL == psMessage)
+    {
+        return;
+    }
+
+    BYTE abyData[defEXPORT_MAX_DATA_BYTES];
+    UINT unLength = 0;
+    const STEXTVIEW& sData = psFields[defEXPORT_CAN_FIELD_DATA];
+    CLineTokenizer ouBytes(sData.m_pchText, sData.m_pchText + sData.m_nLength);
+    STEXTVIEW sByte;
+    UINT unValue;
+    while ( (unLength < defEXPORT_MAX_DATA_BYTES) && ouBytes.bNext(sByte) && bGetNumber(sByte, bHex, unValue) )
+    {
+        abyData[unLength++] = (BYTE)unValue;
+    }
+    CExportSignalDecoder::vDecode(*psMessage, abyData, unLength, ouValues);
+}
+
+/**
+ * \brief      Writes a CSV row
+ * \param[in]  psFields Fields of the line
+ * \param[in]  unFieldCount Number of fields
+ * \param[in]  bHex Number format of the line
+ * \param[out] ouValues Signal values of the line, reused from row to row
+ * \param[out] ouWriter Row
+ */
+void CLogExportStream::vWriteCsvRow(const STEXTVIEW* psFields, UINT unFieldCount, bool bHex, std::vector<SEXPORT_VALUE>& ouValues, CLineWriter& ouWriter) const
+{
+    for (size_t i = 0; i < m_ouSelectedFields.size(); i++)
+    {
+        if (i > 0)
+        {
+            ouWriter.vAppendChar(',');
+        }
+        if (m_ouSelectedFields[i] < unFieldCount)
+        {
+            const STEXTVIEW& sField = psFields[m_ouSelectedFields[i]];
+            vAppendCsvField(ouWriter, sField.m_pchText, sField.m_nLength);
+        }
+    }
+
+    if (NULL != m_pouDecoder)
+    {
+        UINT unColumn = 0;
+        vDecodeFrame(psFields, unFieldCount, bHex, ouValues);
+        for (size_t i = 0; i < ouValues.size(); i++)
+        {
+            for (; unColumn <= ouValues[i].m_unColumn; unColumn++)
+            {
+                ouWriter.vAppendChar(',');
+            }
+            char acValue[32];
+            int nLength = sprintf_s(acValue, sizeof(acValue), "%.10g", ouValues[i].m_dValue);
+            ouWriter.vAppend(acValue, (nLength > 0) ? nLength : 0);
+        }
+        for (; unColumn < m_unSignalColumns; unColumn++)
+        {
+            ouWriter.vAppendChar(',');
+        }
+    }
+    ouWriter.vAppend("\r\n", 2);
+}
+
+/**
+ * \brief      Adds a row to the columns of a chunk
+ * \param[in]  psFields Fields of the line
+ * \param[in]  unFieldCount Number of fields
+ * \param[in]  bHex Number format of the line
+ * \param[out] ouValues Signal values of the line, reused from row to row
+ * \param[out] sChunk Columns of the chunk
+ */
+void CLogExportStream::vAddColumnarRow(const STEXTVIEW* psFields, UINT unFieldCount, bool bHex, std::vector<SEXPORT_VALUE>& ouValues, sCOLUMN_CHUNK& sChunk) const
+{
+    UINT unRow = sChunk.m_unRows++;
+    for (size_t i = 0; i < m_ouSelectedFields.size(); i++)
+    {
+        UINT unField = m_ouSelectedFields[i];
+        if (unField == defEXPORT_FIELD_TIME)
+        {
+            double dTime = (unField < unFieldCount) ? dGetSeconds(psFields[unField]) : std::numeric_limits<double>::quiet_NaN();
+            sChunk.m_ouValues[i].vAppend((const char*)&dTime, sizeof(dTime));
+        }
+        else
+        {
+            if (unField < unFieldCount)
+            {
+                sChunk.m_ouValues[i].vAppend(psFields[unField]);
+            }
+            vAppendUInt32(sChunk.m_ouOffsets[i], (UINT)sChunk.m_ouValues[i].nGetSize());
+        }
+    }
+
+    vDecodeFrame(psFields, unFieldCount, bHex, ouValues);
+    for (size_t i = 0; i < ouValues.size(); i++)
+    {
+        sSIGNAL_VALUE sValue;
+        sValue.m_unColumn = ouValues[i].m_unColumn;
+        sValue.m_unRow = unRow;
+        sValue.m_dValue = ouValues[i].m_dValue;
+        sChunk.m_ouSignals.push_back(sValue);
+    }
+}
+
+/**
+ * \brief      Writes the columns of a chunk as one block
+ * \param[in]  sChunk Columns of the chunk, cleared afterwards
+ * \param[out] ouWriter Block
+ *
+ * Signal values are collected in row order and sorted by column with a
+ * counting sort, rows stay ascending inside a column.
+ */
+void CLogExportStream::vWriteColumnarBlock(sCOLUMN_CHUNK& sChunk, CLineWriter& ouWriter) const
+{
+    if (0 == sChunk.m_unRows)
+    {
+        return;
+    }
+
+    vAppendUInt32(ouWriter, sChunk.m_unRows);
+    for (size_t i = 0; i < m_ouSelectedFields.size(); i++)
+    {
+        CLineWriter& ouValues = sChunk.m_ouValues[i];
+        if (m_ouSelectedFields[i] == defEXPORT_FIELD_TIME)
+        {
+            vAppendUInt32(ouWriter, (UINT)ouValues.nGetSize());
+        }
+        else
+        {
+            CLineWriter& ouOffsets = sChunk.m_ouOffsets[i];
+            vAppendUInt32(ouWriter, (UINT)(ouOffsets.nGetSize() + ouValues.nGetSize()));
+            ouWriter.vAppend(ouOffsets.pchGetData(), ouOffsets.nGetSize());
+            ouOffsets.vClear();
+        }
+        ouWriter.vAppend(ouValues.pchGetData(), ouValues.nGetSize());
+        ouValues.vClear();
+    }
+
+    if (m_unSignalColumns > 0)
+    {
+        //Start of every column, then moved on to its end while placing the values
+        std::vector<UINT>& ouEnds = sChunk.m_ouSignalCounts;
+        ouEnds.assign(m_unSignalColumns, 0);
+        for (size_t i = 0; i < sChunk.m_ouSignals.size(); i++)
+        {
+            ouEnds[sChunk.m_ouSignals[i].m_unColumn]++;
+        }
+        UINT unStart = 0;
+        for (UINT unColumn = 0; unColumn < m_unSignalColumns; unColumn++)
+        {
+            UINT unCount = ouEnds[unColumn];
+            ouEnds[unColumn] = unStart;
+            unStart += unCount;
+        }
+        sChunk.m_ouSorted.resize(sChunk.m_ouSignals.size());
+        for (size_t i = 0; i < sChunk.m_ouSignals.size(); i++)
+        {
+            sChunk.m_ouSorted[ouEnds[sChunk.m_ouSignals[i].m_unColumn]++] = sChunk.m_ouSignals[i];
+        }
+
+        UINT unBegin = 0;
+        for (UINT unColumn = 0; unColumn < m_unSignalColumns; unColumn++)
+        {
+            UINT unCount = ouEnds[unColumn] - unBegin;
+            vAppendUInt32(ouWriter, sizeof(UINT) + (unCount * (sizeof(UINT) + sizeof(double))));
+            vAppendUInt32(ouWriter, unCount);
+            for (; unBegin < ouEnds[unColumn]; unBegin++)
+            {
+                vAppendUInt32(ouWriter, sChunk.m_ouSorted[unBegin].m_unRow);
+                ouWriter.vAppend((const char*)&sChunk.m_ouSorted[unBegin].m_dValue, sizeof(double));
+            }
+        }
+        sChunk.m_ouSignals.clear();
+    }
+    sChunk.m_unRows = 0;
+}
+
+/**
+ * \brief     Recognizes "***HEX***" and "***DEC***" lines
+ * \param[in] pchLine Line start
+ * \param[in] pchLineEnd Line end
+ * \return    1 for hex, 0 for dec, -1 for other lines
+ */
+int CLogExportStream::nGetFormatLine(const char* pchLine, const char* pchLineEnd)
+{
+    STEXTVIEW sLine;
+    sLine.m_pchText = pchLine;
+    sLine.m_nLength = pchLineEnd - pchLine;
+    while ( (sLine.m_nLength > 0) && ((sLine.m_pchText[sLine.m_nLength - 1] == ' ') ||
+            (sLine.m_pchText[sLine.m_nLength - 1] == '\t') || (sLine.m_pchText[sLine.m_nLength - 1] == '\r')) )
+    {
+        sLine.m_nLength--;
+    }
+    if (sLine.bEqualsNoCase("***HEX***"))
+    {
+        return 1;
+    }
+    if (sLine.bEqualsNoCase("***DEC***"))
+    {
+        return 0;
+    }
+    return -1;
+}
+
+/**
+ * \brief      Reads an ID or data byte
+ * \param[in]  sText Number, "0x" is allowed in hex mode
+ * \param[in]  bHex Hexadecimal or decimal
+ * \param[out] unValue Value
+ * \return     true if sText is a number
+ */
+bool CLogExportStream::bGetNumber(STEXTVIEW sText, bool bHex, UINT& unValue)
+{
+    if (false == bHex)
+    {
+        unValue = (UINT)sText.un64GetNumber();
+        return sText.bIsNumber();
+    }
+    if ( (sText.m_nLength > 2) && (sText.m_pchText[0] == '0') && ((sText.m_pchText[1] == 'x') || (sText.m_pchText[1] == 'X')) )
+    {
+        sText.m_pchText += 2;
+        sText.m_nLength -= 2;
+    }
+    if (false == sText.bIsHexNumber())
+    {
+        return false;
+    }
+    unValue = 0;
+    for (size_t i = 0; i < sText.m_nLength; i++)
+    {
+        char chDigit = sText.m_pchText[i];
+        unValue = (unValue << 4) | ((chDigit <= '9') ? (chDigit - '0') : ((chDigit | 0x20) - 'a' + 10));
+    }
+    return true;
+}
+
+/**
+ * \brief     Converts a log time stamp
+ * \param[in] sTime "h:m:s:ffff"
+ * \return    Seconds, NaN if sTime is no time stamp
+ */
+double CLogExportStream::dGetSeconds(const STEXTVIEW& sTime)
+{
+    unsigned __int64 aun64Fields[4] = { 0, 0, 0, 0 };
+    double dFraction = 1;
+    int nField = 0;
+    for (size_t i = 0; i < sTime.m_nLength; i++)
+    {
+        char chValue = sTime.m_pchText[i];
+        if ( (chValue >= '0') && (chValue <= '9') )
+        {
+            aun64Fields[nField] = (aun64Fields[nField] * 10) + (chValue - '0');
+            if (3 == nField)
+            {
+                dFraction *= 10;
+            }
+        }
+        else if ( (':' == chValue) && (nField < 3) )
+        {
+            nField++;
+        }
+        else
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+    if (nField != 3)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return (double)((aun64Fields[0] * 3600) + (aun64Fields[1] * 60) + aun64Fields[2]) + (aun64Fields[3] / dFraction);
+}
+
+void CLogExportStream::vAppendUInt32(CLineWriter& ouWriter, UINT unValue)
+{
+    ouWriter.vAppend((const char*)&unValue, sizeof(unValue));
+}
+
+/**
+ * \brief      Appends a CSV field, quoted as in RFC 4180 if it holds a
+ *             separator, a quote or a line break
+ * \param[out] ouWriter Row
+ * \param[in]  pchText Field text
+ * \param[in]  nLength Field length
+ */
+void CLogExportStream::vAppendCsvField(CLineWriter& ouWriter, const char* pchText, size_t nLength)
+{
+    const char* pchEnd = pchText + nLength;
+    bool bQuote = false;
+    for (const char* pchPos = pchText; (pchPos < pchEnd) && (false == bQuote); pchPos++)
+    {
+        bQuote = (*pchPos == ',') || (*pchPos == '"') || (*pchPos == '\r') || (*pchPos == '\n');
+    }
+    if (false == bQuote)
+    {
+        ouWriter.vAppend(pchText, nLength);
+        return;
+    }
+
+    ouWriter.vAppendChar('"');
+    for (const char* pchPos = pchText; pchPos < pchEnd; pchPos++)
+    {
+        if (*pchPos == '"')
+        {
+            ouWriter.vAppendChar('"');
+        }
+        ouWriter.vAppendChar(*pchPos);
+    }
+    ouWriter.vAppendChar('"');
+}
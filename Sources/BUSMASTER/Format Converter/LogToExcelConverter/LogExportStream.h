@@ -0,0 +1,123 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      LogExportStream.h
+ * \brief     Definition of the CLogExportStream class.
+ *
+ * Exports the fields and decoded signals of BUSMASTER log lines.
+ */
+
+#pragma once
+
+/* Project includes */
+#include "../FormatConverterApp/LineStreamConverter.h"
+#include "ExportSignalDecoder.h"
+
+//Fields of a CAN log line
+#define defEXPORT_FIELD_TIME        0
+#define defEXPORT_CAN_FIELD_ID      3
+#define defEXPORT_CAN_FIELD_TYPE    4
+#define defEXPORT_CAN_FIELD_DATA    6
+#define defEXPORT_MAX_FIELDS        16
+
+//Columnar file layout, all numbers little endian:
+//  "BMCOL001", UINT32 column count, per column UINT8 type, UINT16 name length, name
+//  then blocks until the end of the file: UINT32 row count, per column UINT32 size, data
+#define defEXPORT_COLUMNAR_MAGIC    "BMCOL001"
+#define defEXPORT_COLUMN_F64        1   // Double per row, NaN if the field is not a time
+#define defEXPORT_COLUMN_TEXT       2   // UINT32 end offset per row, then the text
+#define defEXPORT_COLUMN_SPARSE_F64 3   // UINT32 count, then UINT32 row and double per value
+
+typedef enum eEXPORT_FORMAT
+{
+    EXPORT_CSV = 0,
+    EXPORT_COLUMNAR
+} EEXPORT_FORMAT;
+
+/**
+ * LOG to CSV or columnar export. Every message line becomes one row with the
+ * selected fields, followed by one column per database signal which is only
+ * filled for the signals of the logged frame.
+ *
+ * The number format of the data bytes is given by the last "***HEX***" or
+ * "***DEC***" line, so chunks are only scanned when signals are decoded.
+ */
+class CLogExportStream : public CLineStreamConverter
+{
+public:
+    //unFields fields per line, the last one takes the rest of the line
+    CLogExportStream(EEXPORT_FORMAT eFormat, UINT unFields);
+
+    //Exports field unField as next column
+    void vSelectField(UINT unField, const char* pchName);
+    //Adds the signal columns of pouDecoder, for CAN logs
+    void vSetDecoder(const CExportSignalDecoder* pouDecoder);
+
+protected:
+    virtual size_t nGetHeaderReserve(void) const;
+    virtual void vWriteHeader(CLineWriter& ouWriter);
+    virtual void vBeginWindow(UINT unChunks);
+    virtual void vScanChunk(UINT unChunk, const char* pchBegin, const char* pchEnd);
+    virtual void vJoinChunks(UINT unChunks);
+    virtual void vConvertChunk(UINT unChunk, const char* pchBegin, const char* pchEnd, CLineWriter& ouWriter);
+
+private:
+    struct sSIGNAL_VALUE
+    {
+        UINT m_unColumn;
+        UINT m_unRow;
+        double m_dValue;
+    };
+    struct sCHUNK_STATE
+    {
+        bool m_bStartHex;       // Number format at the chunk start
+        int m_nLastFormat;      // Last format line of the chunk, -1 none, 0 dec, 1 hex
+        std::vector<SEXPORT_VALUE> m_ouValues;  // Signals of the line being exported
+    };
+    //Columns of one chunk until it is written as block
+    struct sCOLUMN_CHUNK
+    {
+        UINT m_unRows;
+        std::vector<CLineWriter> m_ouValues;
+        std::vector<CLineWriter> m_ouOffsets;
+        std::vector<sSIGNAL_VALUE> m_ouSignals;
+        std::vector<sSIGNAL_VALUE> m_ouSorted;
+        std::vector<UINT> m_ouSignalCounts;
+    };
+
+    EEXPORT_FORMAT m_eFormat;
+    UINT m_unFields;
+    std::vector<UINT> m_ouSelectedFields;
+    std::vector<std::string> m_ouFieldNames;
+    const CExportSignalDecoder* m_pouDecoder;
+    UINT m_unSignalColumns;
+    std::string m_omStrHeader;
+    bool m_bHex;                // In effect after the chunks joined so far
+    std::vector<sCHUNK_STATE> m_ouChunkStates;
+    std::vector<sCOLUMN_CHUNK> m_ouColumnChunks;
+
+    void vBuildHeader(void);
+    UINT unSplitLine(const char* pchBegin, const char* pchEnd, STEXTVIEW* psFields) const;
+    void vDecodeFrame(const STEXTVIEW* psFields, UINT unFieldCount, bool bHex, std::vector<SEXPORT_VALUE>& ouValues) const;
+    void vWriteCsvRow(const STEXTVIEW* psFields, UINT unFieldCount, bool bHex, std::vector<SEXPORT_VALUE>& ouValues, CLineWriter& ouWriter) const;
+    void vAddColumnarRow(const STEXTVIEW* psFields, UINT unFieldCount, bool bHex, std::vector<SEXPORT_VALUE>& ouValues, sCOLUMN_CHUNK& sChunk) const;
+    void vWriteColumnarBlock(sCOLUMN_CHUNK& sChunk, CLineWriter& ouWriter) const;
+    static int nGetFormatLine(const char* pchLine, const char* pchLineEnd);
+    static bool bGetNumber(STEXTVIEW sText, bool bHex, UINT& unValue);
+    static double dGetSeconds(const STEXTVIEW& sTime);
+    static void vAppendUInt32(CLineWriter& ouWriter, UINT unValue);
+    static void vAppendCsvField(CLineWriter& ouWriter, const char* pchText, size_t nLength);
+};
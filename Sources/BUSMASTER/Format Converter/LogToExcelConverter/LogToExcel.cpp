@@ -25,6 +25,13 @@
 /* Project includes */
 #include "Defines.h"
 #include "LogToExcel.h"
+#include "LogExportStream.h"
+#include "BlfLineSource.h"
+#include "../AscLogConverter/AscLogStream.h"
+
+#define defLOG_HEADER_LINE_LENGTH   1024
+#define defLOG_DATABASES_START      "***START DATABASE FILES***"
+#define defLOG_DATABASES_END        "***END DATABASE FILES***"
 
 /**
  * \brief Initializing the Column fields map table
@@ -101,7 +108,7 @@ CLogToExcel::CLogToExcel(string strLogFileName, string strExcelFileName, UINT un
     m_strLogFileName = strLogFileName;
     m_strExcelFileName = strExcelFileName;
     m_unNumOfFields = unNoOfFields;
-    m_bFilesOpened = FALSE;
+    m_bDecodeSignals = FALSE;
     fnSetFields();
 }
 
@@ -115,223 +122,230 @@ CLogToExcel::~CLogToExcel()
 }
 
 /**
- * \brief Retrieves each line from the file and stores it in m_strBuffer
+ * \brief Enables the export of signal values
  *
- * Retrieves each line from the file and stores it in m_strBuffer
+ * Signals are decoded with the databases listed in the header of a CAN log,
+ * or with those set by vSetDatabases for ASC and BLF input.
  */
-UINT CLogToExcel::unGetLine()
+void CLogToExcel::vSetDecodeSignals(BOOL bDecodeSignals)
 {
-    UINT unBufferIndex = 0;  //index to traverse m_strBuffer string
-    char ch;               // stores each character read from the file
+    m_bDecodeSignals = bDecodeSignals;
+}
 
-    //reads log file till end of line is not reached
-    while ( (ch = (char)m_pLogFile.get()) != '\n' )
-    {
-        //m_strBuffer contains each line read from log file
-        m_strBuffer.append(1,ch);
+/**
+ * \brief Sets the databases of ASC and BLF input
+ *
+ * Sets the databases of ASC and BLF input
+ */
+void CLogToExcel::vSetDatabases(const vector<string>& omDatabases)
+{
+    m_omDatabases = omDatabases;
+}
 
-        if( ch == EOF )
-        {
-            m_strBuffer.append(1,'\0');
-            return 1;
-        }
+bool CLogToExcel::bHasExtension(const string& strFileName, const char* pchExtension)
+{
+    size_t nExtension = strFileName.find_last_of('.');
+    return (nExtension != string::npos) && (_stricmp(strFileName.c_str() + nExtension + 1, pchExtension) == 0);
+}
 
-        unBufferIndex++;
-    }
+bool CLogToExcel::bIsAscFile(const string& strFileName)
+{
+    return bHasExtension(strFileName, defSTR_ASC_FORMAT);
+}
 
-    m_strBuffer.append(1,'\0');
-    return 0;
+bool CLogToExcel::bIsBlfFile(const string& strFileName)
+{
+    return bHasExtension(strFileName, defSTR_BLF_FORMAT);
 }
 
 /**
- * \brief Retrieves each field from m_strBuffer and writes it into Excel file.
+ * \brief Retrieves the throughput of the last conversion
  *
- * Retrieves each field from m_strBuffer and writes it into Excel file.
+ * Retrieves the throughput of the last conversion
  */
-void CLogToExcel::vPrintFields()
+void CLogToExcel::vGetThroughput(string& omStrThroughput)
 {
-    // ignore the headers in log file
-    if( (m_strBuffer.empty() ) ||(m_strBuffer[0] == '*') ||(m_strBuffer[0] == ' ')  )
-    {
-        return;
-    }
+    omStrThroughput = m_strThroughput;
+}
 
-    /*if(m_strBuffer[0] != '<')
-       return;*/
-    UINT unBufferIndex = 0;     //index to traverse m_strBuffer string
-    UINT unFieldBufferIndex=0;  //index to traverse m_strFieldBuffer string
-    UINT unFieldIndex = 0;      // field index
-    bool bFieldIndexExists  = false;
-    m_pExcelFile << "<TR>";
+/**
+ * \brief Reads the header lines in front of the first message
+ *
+ * Checks the protocol of the log and collects the database files.
+ * Returns S_FALSE if the log doesn't match the selected bus type.
+ */
+HRESULT CLogToExcel::hReadLogHeader(FILE* fpLog, vector<string>& omDatabases)
+{
+    char acLine[defLOG_HEADER_LINE_LENGTH];
+    bool bDatabases = false;
 
-    while( unFieldIndex != m_unNumOfFields && m_strBuffer[unBufferIndex] != '\0' )
+    while (fgets(acLine, sizeof(acLine), fpLog) != NULL)
     {
-        unFieldBufferIndex = 0;
-        m_strFieldBuffer.clear();
+        string omStrLine = acLine;
+        omStrLine.erase(omStrLine.find_last_not_of(" \t\r\n") + 1);
 
-        if( unFieldIndex != m_unNumOfFields-1 )
+        if (omStrLine.empty())
         {
-            //reading each field from m_strBuffer
-            while( m_strBuffer[unBufferIndex] != ' ' && m_strBuffer[unBufferIndex] != '\0')
-            {
-                m_strFieldBuffer.append(1,m_strBuffer[unBufferIndex]);
-                unFieldBufferIndex++;
-                unBufferIndex++;
-            }// while - m_strBuffer[unBufferIndex] != " "
-
-            if( m_strBuffer.length() != unBufferIndex && m_strBuffer[unBufferIndex] == ' ')
-            {
-                unBufferIndex++;
-            }
-
-            if( m_strBuffer.length() != unBufferIndex && m_strBuffer[unBufferIndex] == ' ')
-            {
-                unBufferIndex++;
-            }
-        }// unFieldIndex != m_unNumOfFields-1
-        else
+            continue;
+        }
+        if (omStrLine[0] != '*')
         {
-            // reading the data bytes field from m_strBuffer
-            unFieldBufferIndex = 0;
-
-            while((m_strBuffer[unBufferIndex] != '\0') && (m_strBuffer[unBufferIndex] != '\n'))
-            {
-                m_strFieldBuffer.append(1,m_strBuffer[unBufferIndex]);
-                unFieldBufferIndex++;
-                unBufferIndex++;
-            }
-        } // else
-
-        m_strFieldBuffer.append(1,'\0');
+            // first message line
+            break;
+        }
 
-        //writing the field into excel file
-        for(UINT nIndex = 0; nIndex < m_unNumOfFields; nIndex++)
+        if ( (omStrLine.find("***PROTOCOL") != string::npos) && (omStrLine.find(m_strBUSNameInLog) == string::npos) )
         {
-            if ( unSelectedField[nIndex] == unFieldIndex )
-            {
-                bFieldIndexExists = true;
-                break;
-            } // if unSelectedField[nIndex] == unFieldIndex
-        }// for loop - unSelectedField
-
-        if ( bFieldIndexExists )
+            return S_FALSE;
+        }
+        else if (omStrLine == defLOG_DATABASES_START)
         {
-            m_pExcelFile << "<TD>" << m_strFieldBuffer.c_str() << "</TD>";
-            bFieldIndexExists = false;
+            bDatabases = true;
         }
-        else
+        else if (omStrLine == defLOG_DATABASES_END)
         {
-            m_strFieldBuffer="";
+            bDatabases = false;
         }
-
-        unFieldIndex++;
-    }// While - field navigation
-
-    m_strFieldBuffer.clear();
-    m_pExcelFile << "</TR>";
+        else if ( bDatabases && (omStrLine.size() > 6) )
+        {
+            // ***<database file path>***
+            omDatabases.push_back(omStrLine.substr(3, omStrLine.size() - 6));
+        }
+    }
+    return S_OK;
 }
 
 /**
- * \brief Converts the .log file to .xls file
+ * \brief Converts the .log, .asc or .blf file to a .csv or columnar .bmcol file
  *
- * Converts the .log file to .xls file
+ * The input is streamed through CLogExportStream, so memory use doesn't grow
+ * with its size. ASC lines are turned into log lines chunk by chunk on the
+ * way, BLF messages are rendered as log lines while the file is read.
  */
 HRESULT CLogToExcel::bConvert()
 {
-    HRESULT hRetVal = S_OK;
-    //open log file in read mode
-    m_pLogFile.open(m_strLogFileName.c_str(), fstream::in);
+    FILE* fpLog = NULL;
+    FILE* fpExport = NULL;
+    BLF::IBlfReader* pouBlfReader = NULL;
+    bool bAsc = bIsAscFile(m_strLogFileName);
+    bool bBlf = bIsBlfFile(m_strLogFileName);
+    m_strThroughput.clear();
+
+    /* CANoe logs hold CAN frames only */
+    if ( (bAsc || bBlf) && (m_eBus != CAN) )
+    {
+        MessageBox(NULL,_(EXPORTTOEXCEL_FAILUREMSG),_(APPLICATION_NAME),MB_OK);
+        return S_FALSE;
+    }
 
-    if(!m_pLogFile.is_open())
+    //open log file in read mode
+    vector<string> omDatabases(m_omDatabases);
+    if (bBlf)
+    {
+        pouBlfReader = BLF::GetIBlfReader();
+        if ( (NULL == pouBlfReader) || (pouBlfReader->Open(m_strLogFileName) != S_OK) )
+        {
+            return ERR_EXPORTTOEXCEL_LOGFILEOPENERROR;
+        }
+    }
+    else if ( (fopen_s(&fpLog, m_strLogFileName.c_str(), "rb") != 0) || (NULL == fpLog) )
     {
         //log file could not be opened
-        hRetVal = ERR_EXPORTTOEXCEL_LOGFILEOPENERROR;
-        //MessageBox(NULL,EXPORTTOEXCEL_LOGFILEOPENERROR,APPLICATION_NAME,MB_OK);
-        m_bFilesOpened = FALSE;
+        return ERR_EXPORTTOEXCEL_LOGFILEOPENERROR;
     }
-    else
+    else if (false == bAsc)
     {
-        //open Excel file in write
-        m_pExcelFile.open(m_strExcelFileName.c_str(), fstream::out);
+        /* If the current BUS type and log file selected don't match, don't perform conversion */
+        omDatabases.clear();
+        if (hReadLogHeader(fpLog, omDatabases) != S_OK)
+        {
+            fclose(fpLog);
+            MessageBox(NULL,_(EXPORTTOEXCEL_FAILUREMSG),_(APPLICATION_NAME),MB_OK);
+            return S_FALSE;
+        }
+        rewind(fpLog);
+    }
 
-        if(!m_pExcelFile.is_open())
+    //open export file in write mode
+    if ( (fopen_s(&fpExport, m_strExcelFileName.c_str(), "wb") != 0) || (NULL == fpExport) )
+    {
+        //export file could not be opened
+        if (NULL != fpLog)
         {
-            //Excel file could not be opened
-            hRetVal = ERR_EXPORTTOEXCEL_CSVFILEOPENERROR;
-            //MessageBox(NULL,EXPORTTOEXCEL_CSVFILEOPENERROR,APPLICATION_NAME,MB_OK);
-            m_bFilesOpened = FALSE;
+            fclose(fpLog);
         }
-        else
+        if (NULL != pouBlfReader)
         {
-            m_bFilesOpened = TRUE;
-
+            pouBlfReader->Close();
         }
+        return ERR_EXPORTTOEXCEL_CSVFILEOPENERROR;
     }
 
-    if(m_bFilesOpened == TRUE)
+    EEXPORT_FORMAT eFormat = EXPORT_CSV;
+    if (bHasExtension(m_strExcelFileName, defSTR_COLUMNAR_FORMAT))
     {
-        m_pExcelFile << "<HTML><HEAD></HEAD><BODY>" << endl;
-        m_pExcelFile << _("<FONT COLOR =\"GREEN\"><CENTER><B>BUSMASTER - Exported Log File Report</B></CENTER>");
-        m_pExcelFile << "<BR><BR>";
-        m_pExcelFile << "<TABLE BORDER COLOR=\"BLACK\"><TR>";
-
-        // write column headers
-        for( UINT unIndex = 0; unIndex < m_unNumOfFields; unIndex++)
-            if(unSelectedField[unIndex]!=-1)
-            {
-                m_pExcelFile << "<TD><FONT COLOR=\"Green\"><B> " << m_pacFields[unIndex] << " </B></TD>";
-            }
-
-        m_pExcelFile << "</TR>";
-
-        size_t found;
+        eFormat = EXPORT_COLUMNAR;
+    }
 
-        // write each column
-        while(!unGetLine())
+    CLogExportStream ouExportStream(eFormat, m_unNumOfFields);
+    for (UINT unIndex = 0; unIndex < m_unNumOfFields; unIndex++)
+    {
+        if (unSelectedField[unIndex] != (UINT)-1)
         {
-            found = 0;
-            if ( m_strBuffer.find("***PROTOCOL") !=  string::npos )
-            {
-                found = m_strBuffer.find( m_strBUSNameInLog );
-            }
+            ouExportStream.vSelectField(unIndex, m_pacFields[unIndex]);
+        }
+    }
 
-            /* If the current BUS type and log file selected matches, then perform conversion */
-            if (found!=string::npos)
-            {
-                vPrintFields();
-            }
-            else
+    CExportSignalDecoder ouSignalDecoder;
+    if ( m_bDecodeSignals && (m_eBus == CAN) && (false == omDatabases.empty()) )
+    {
+        if (ouSignalDecoder.hOpenNetwork() == S_OK)
+        {
+            for (size_t i = 0; i < omDatabases.size(); i++)
             {
-                MessageBox(NULL,_(EXPORTTOEXCEL_FAILUREMSG),_(APPLICATION_NAME),MB_OK);
-                //close file
-                m_pExcelFile.close();
-                m_pLogFile.close();
-                ::DeleteFile(m_strExcelFileName.c_str());
-                return S_FALSE;
+                // a database which was moved since logging only leaves its signal columns out
+                ouSignalDecoder.hLoadDatabase(omDatabases[i]);
             }
-            m_strBuffer.clear();
+            ouSignalDecoder.vAssignColumns();
+            ouExportStream.vSetDecoder(&ouSignalDecoder);
+        }
+        else
+        {
+            MessageBox(NULL,_(EXPORTTOEXCEL_DECODEERROR),_(APPLICATION_NAME),MB_OK);
         }
+    }
 
-        m_pExcelFile << "</TABLE></BODY></HTML>" << endl;
-        //close file
-        m_pExcelFile.close();
-        m_pLogFile.close();
-        hRetVal =S_OK;
+    HRESULT hRetVal = S_OK;
+    if (bBlf)
+    {
+        CBlfLineSource ouBlfLines(pouBlfReader);
+        hRetVal = ouExportStream.hConvert(ouBlfLines, fpExport);
+        pouBlfReader->Close();
+    }
+    else if (bAsc)
+    {
+        CAscLogStream ouAscStream;
+        ouAscStream.vSetFormatLines(true);
+        ouExportStream.vSetInputStage(&ouAscStream);
+        hRetVal = ouExportStream.hConvert(fpLog, fpExport);
+        fclose(fpLog);
     }
     else
     {
-        if(m_pLogFile.is_open())
-        {
-            m_pLogFile.close();
-        }
-        if(m_pExcelFile.is_open())
-        {
-            m_pExcelFile.close();
-        }
+        hRetVal = ouExportStream.hConvert(fpLog, fpExport);
+        fclose(fpLog);
     }
+    fclose(fpExport);
 
-    return hRetVal;
+    if (hRetVal != S_OK)
+    {
+        ::DeleteFile(m_strExcelFileName.c_str());
+        return ERR_EXPORTTOEXCEL_SYNTAXERROR;
+    }
+    ouExportStream.vAppendThroughput(m_strThroughput);
+    return S_OK;
 }
+
 void CLogToExcel::GetErrorString(HRESULT hResult, string& omStrErrorString)
 {
     switch(hResult)
@@ -31,9 +31,9 @@
 #include <afxext.h>         /* MFC extensions */
 
 /* C++ includes */
-#include <fstream>
 #include <map>
 #include <string>
+#include <vector>
 
 using namespace std;
 
@@ -68,12 +68,16 @@ __declspec( selectany ) char acFields_J1939[defNO_OF_FIELDS_J1939][20] = {  "Tim
 #define defSTR_CSV_FORMAT_SPECIFIER  _("Comma Separated Values file(s) (*.csv)|*.csv||")
 #define defSTR_CSV_FORMAT            "csv"
 
-#define defSTR_XLS_FORMAT_SPECIFIER  _("Excel file(s) (*.xls)|*.xls||")
-#define defSTR_XLS_FORMAT            "xls"
+#define defSTR_EXPORT_FORMAT_SPECIFIER  _("Comma Separated Values file(s) (*.csv)|*.csv|Columnar file(s) (*.bmcol)|*.bmcol||")
+#define defSTR_COLUMNAR_FORMAT       "bmcol"
 
 #define defSTR_LOG_DIALOG_CAPTION    _("Select log file")
-#define defSTR_LOG_FORMAT_SPECIFIER  "*.log|*.log||"
+#define defSTR_LOG_FORMAT_SPECIFIER  _("Log file(s) (*.log;*.asc;*.blf)|*.log;*.asc;*.blf|BUSMASTER log(s) (*.log)|*.log|CANoe ASC log(s) (*.asc)|*.asc|CANoe BLF log(s) (*.blf)|*.blf||")
 #define defSTR_LOG_FORMAT            "log"
+#define defSTR_ASC_FORMAT            "asc"
+#define defSTR_BLF_FORMAT            "blf"
+#define defSTR_DB_DIALOG_CAPTION     _("Select databases to decode the signals")
+#define defSTR_DB_FORMAT_SPECIFIER   _("Database file(s) (*.dbf;*.dbc;*.arxml)|*.dbf;*.dbc;*.arxml||")
 #define defSTR_FILE_NAME_EMPTY       _("Please enter log file and export file names")
 //#define defSTR_FILE_OPEN_ERROR       _("Unable to open the file %s")
 
@@ -89,6 +93,14 @@ public:
     void GetErrorString(HRESULT hResult, string& omStrErrorString);
     void fnSetFields();
     void vSetBUSType(ETYPE_BUS eBus);
+    void vSetDecodeSignals(BOOL bDecodeSignals);
+    //Databases of ASC and BLF input, a BUSMASTER log names its own
+    void vSetDatabases(const vector<string>& omDatabases);
+    //Input is an ASC or BLF file of CANoe
+    static bool bIsAscFile(const string& strFileName);
+    static bool bIsBlfFile(const string& strFileName);
+    //" (<MB> MB, <MB/s> MB/s)" of the last conversion
+    void vGetThroughput(string& omStrThroughput);
 
 private:
     ETYPE_BUS m_eBus;
@@ -98,13 +110,11 @@ private:
     map<string, DWORD> :: const_iterator pMapValue;
     string m_strLogFileName;
     string m_strExcelFileName;
-    fstream m_pLogFile;
-    fstream m_pExcelFile;
-    string m_strBuffer;
-    string m_strFieldBuffer;
     UINT unSelectedField[defNO_OF_FIELDS_J1939];
     UINT m_unNumOfFields;
-    UINT unGetLine();
-    void vPrintFields();
-    BOOL m_bFilesOpened;
+    BOOL m_bDecodeSignals;
+    vector<string> m_omDatabases;
+    string m_strThroughput;
+    HRESULT hReadLogHeader(FILE* fpLog, vector<string>& omDatabases);
+    static bool bHasExtension(const string& strFileName, const char* pchExtension);
 };
@@ -41,6 +41,7 @@
 #define IDC_BTN_CSV_BROWSE              1011
 #define ID_CONVERT                      1012
 #define IDC_COMBO_BUSTYPE               1015
+#define IDC_CHECK_DECODE_SIGNALS        1016
 
 // Next default values for new objects
 //
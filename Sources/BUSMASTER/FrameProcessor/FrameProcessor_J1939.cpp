@@ -13,6 +13,7 @@
 //#include "DIL_Interface_extern.h"
 #include "FrameProcessor_J1939.h"
 #include "LogObjectJ1939.h"
+#include "J1939MsgPool.h"
 #include "Utility\MultiLanguageSupport.h"
 #include "Application/StdAfx.h"
 
@@ -44,15 +45,7 @@ CFrameProcessor_J1939::CFrameProcessor_J1939():m_ouFormatMsgJ1939(m_ouRefTimer)
     m_sJ1939ProcParams.dwClientID = 0x0;
 
     // Allocate necessary amount of memory.
-
-    m_sJ1939Data.m_unDLC = MAX_DATA_LEN_J1939;
-    m_sJ1939Data.m_pbyData = new BYTE[m_sJ1939Data.m_unDLC];// For basic data object
-    ASSERT(nullptr != m_sJ1939Data.m_pbyData);
-
-    // For raw data bytes. It should be equal to the size of m_sJ1939Data
-    m_pbyJ1939Data = new BYTE[m_sJ1939Data.unGetSize()];
-    ASSERT(nullptr != m_pbyJ1939Data);
-
+    // m_sJ1939Data has no data of its own, it refers to the messages read
     USHORT Length = ushCalculateStrLen(true, MAX_DATA_LEN_J1939);
     m_sCurrFormatDat.m_pcDataHex = new char[Length];
     ASSERT(nullptr != m_sCurrFormatDat.m_pcDataHex);
@@ -62,14 +55,13 @@ CFrameProcessor_J1939::CFrameProcessor_J1939():m_ouFormatMsgJ1939(m_ouRefTimer)
     ASSERT(nullptr != m_sCurrFormatDat.m_pcDataDec);
     memset(m_sCurrFormatDat.m_pcDataDec, '\0', Length * sizeof(char));
     m_sDataCopyThread.m_hActionEvent = m_ouVSEBufJ1939.hGetNotifyingEvent();
+    // The DIL writes pool references, the dropped ones are released
+    m_ouVSEBufJ1939.vSetDropHandler(CJ1939MsgPool::vReleaseEntry);
     m_bIsDataLogged = FALSE;
 }
 
 CFrameProcessor_J1939::~CFrameProcessor_J1939()
 {
-    DELETE_ARRAY(m_pbyJ1939Data);
-    DELETE_ARRAY(m_sJ1939Data.m_pbyData);
-
     vEmptyLogObjArray(m_omLogListTmp);
     vEmptyLogObjArray(m_omLogObjectArray);
 }
@@ -127,23 +119,14 @@ void CFrameProcessor_J1939::CreateTimeModeMapping(SYSTEMTIME& CurrSysTime,
 
 void CFrameProcessor_J1939::vRetrieveDataFromBuffer(void)
 {
-    static INT nType = 0;
-    static HRESULT Result = 0;
+    sJ1939POOLMSG* psPoolMsg = nullptr;
 
     while (m_ouVSEBufJ1939.GetMsgCount() > 0)
     {
-        INT nSize = MAX_MSG_LEN_J1939;
-        // First read the J1939 message
-        Result = m_ouVSEBufJ1939.ReadFromBuffer(nType, m_pbyJ1939Data, nSize);
-        if (Result == ERR_READ_MEMORY_SHORT)
-        {
-            CString omBuf;
-            omBuf.Format(_("ERR_READ_MEMORY_SHORT  nSize: %d"), nSize);
-            //AfxMessageBox(omBuf);
-        }
-        else if (Result == EMPTY_APP_BUFFER)
+        // The DIL message is shared with the other clients, it is only read
+        if (CJ1939MsgPool::hReadFromBuffer(m_ouVSEBufJ1939, psPoolMsg) != CALL_SUCCESS)
         {
-            //AfxMessageBox(_T("EMPTY_APP_BUFFER"));
+            continue;
         }
 
         if (m_bLogEnabled == TRUE)
@@ -156,26 +139,42 @@ void CFrameProcessor_J1939::vRetrieveDataFromBuffer(void)
                 m_ouFormatMsgJ1939.m_LogSysTime = m_LogSysTime;
                 m_bResetAbsTime = FALSE;
             }
-            // Save it into the J1939 message structure
-            m_sJ1939Data.vSetDataStream(m_pbyJ1939Data);
-
-            // Format current J1939 frame in the necessary settings
-            m_ouFormatMsgJ1939.vFormatJ1939DataMsg(&m_sJ1939Data,
-                                                   &m_sCurrFormatDat, m_bExprnFlag_Log);
+            m_sJ1939Data.vAttachDataStream(psPoolMsg->m_abyStream);
 
+            // The message is formatted only when a log object takes it. The
+            // reset of the absolute time takes the first message of a session.
+            bool bFormatted = false;
+            if ((TRUE == m_ouFormatMsgJ1939.m_bResetMsgAbsTime) && IS_TM_ABS_RES(m_bExprnFlag_Log))
+            {
+                m_ouFormatMsgJ1939.vFormatJ1939DataMsg(&m_sJ1939Data,
+                                                       &m_sCurrFormatDat, m_bExprnFlag_Log);
+                bFormatted = true;
+            }
             USHORT ushBlocks = (USHORT) (m_omLogObjectArray.GetSize());
             for (USHORT i = 0; i < ushBlocks; i++)
             {
                 CBaseLogObject* pouLogObjBase = m_omLogObjectArray.GetAt(i);
                 CLogObjectJ1939* pouLogObjCon = static_cast<CLogObjectJ1939*> (pouLogObjBase);
-                BOOL bIsDataLogged = pouLogObjCon->bLogData(m_sCurrFormatDat);
-
-                if(bIsDataLogged == TRUE)
+                if (pouLogObjCon->bToBeLogged(m_sJ1939Data) == true)
                 {
+                    if (false == bFormatted)
+                    {
+                        m_ouFormatMsgJ1939.vFormatJ1939DataMsg(&m_sJ1939Data,
+                                                               &m_sCurrFormatDat, m_bExprnFlag_Log);
+                        bFormatted = true;
+                    }
+                    pouLogObjCon->vWriteData(m_sCurrFormatDat);
                     m_bIsDataLogged = TRUE;
                 }
             }
+            // The relative time refers to the previous message, logged or not
+            if ((false == bFormatted) && IS_TM_REL_SET(m_bExprnFlag_Log))
+            {
+                m_ouFormatMsgJ1939.vSetRelBaseTime(m_sJ1939Data.m_sMsgProperties.m_un64TimeStamp);
+            }
+            m_sJ1939Data.vDetachDataStream();
         }
+        CJ1939MsgPool::vRelease(psPoolMsg);
     }
 }
 
@@ -39,7 +39,6 @@ private:
     CBaseDILI_J1939*    m_pouDIL_J1939;
     CMsgBufVSE          m_ouVSEBufJ1939;
     STJ1939_MSG         m_sJ1939Data;
-    BYTE*               m_pbyJ1939Data;
     SFORMATTEDATA_J1939 m_sCurrFormatDat;
     CFormatMsgJ1939     m_ouFormatMsgJ1939;
 
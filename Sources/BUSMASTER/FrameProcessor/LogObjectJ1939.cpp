@@ -74,6 +74,25 @@ bool CLogObjectJ1939::bLogData(const SFORMATTEDATA_J1939& sDataJ1939)
         return false;
     }
 
+    vWriteData(sDataJ1939);
+    return true;
+}
+
+// Checks a J1939 message against the channel, the filter and the trigger, before it is formatted
+bool CLogObjectJ1939::bToBeLogged(const STJ1939_MSG& sJ1939Msg)
+{
+    SFRAMEINFO_BASIC_J1939 J1939Info_Basic =
+    {
+        sJ1939Msg.m_sMsgProperties.m_uExtendedID.m_s29BitId.unGetPGN(),
+        sJ1939Msg.m_sMsgProperties.m_byChannel,
+        (DIR_TX == sJ1939Msg.m_sMsgProperties.m_eDirection) ? DIR_TX : DIR_RX
+    };
+    return bToBeLogged(J1939Info_Basic);
+}
+
+// Writes a formatted J1939 message that passed bToBeLogged
+void CLogObjectJ1939::vWriteData(const SFORMATTEDATA_J1939& sDataJ1939)
+{
     CString omLogText = "";
     char* pTimeData = nullptr;
     char acID[16] = {'\0'};
@@ -154,8 +173,6 @@ bool CLogObjectJ1939::bLogData(const SFORMATTEDATA_J1939& sDataJ1939)
                        pData);
 
     vWriteTextToFile(omLogText, J1939);
-
-    return true;
 }
 
 // To format the header
@@ -68,6 +68,12 @@ public:
     // Log a J1939 data object
     bool bLogData(const SFORMATTEDATA_J1939&);
 
+    // Check a J1939 message before it is formatted, updates the trigger
+    bool bToBeLogged(const STJ1939_MSG& sJ1939Msg);
+
+    // Write a J1939 data object that passed bToBeLogged
+    void vWriteData(const SFORMATTEDATA_J1939&);
+
     // Enable / disable filter
     void EnableFilter(bool bEnable);
 
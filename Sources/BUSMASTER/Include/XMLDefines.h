@@ -244,6 +244,7 @@
 #define DEF_NODE_PREFERRED_ADDRESS  "Preferred_Address" //J1939
 #define DEF_NODE_ECU_NAME           "ECU_Name"          //J1939
 #define DEF_IS_NODE_ENABLED         "Is_Enabled"
+#define DEF_NODE_PARALLEL_HANDLERS  "Parallel_Message_Handlers"
 #define DEF_NODE_FILE_TYPE          "File_Type"
 #define DEF_NODE_FILE_PATH          "File_Path"
 
@@ -38,6 +38,7 @@
 //#include "DataTypes\Cluster.h"
 #include "IBMNetWorkGetService.h"
 #include "Error.h"
+#include "ClientDispatch.h"
 #define USAGE_EXPORT
 #include "LIN_ISOLAR_EVE_VLIN_Extern.h"
 
@@ -46,6 +47,7 @@ END_MESSAGE_MAP()
 
 
 static STLINDATA sg_EVE_LINMsg;
+static CClientDispatch<STLINDATA> sg_ouClientDispatch;
 static STLIN_MSG asLinTxMsg[LIN_PID_MAX];
 
 static LARGE_INTEGER sg_QueryTickCount;
@@ -180,47 +182,6 @@ HRESULT CDIL_ISOLAR_EVE_VLIN::LIN_DeRegisterLinHeader(DWORD& dwClientId, int& nC
 
 CDIL_ISOLAR_EVE_VLIN* g_pouDIL_ISOLAR_EVE_VLIN = NULL;
 
-/**
-* \brief         Function to store the Tx message entry into sg_asAckMapBuf list.
-* \param[in]     RefObj, is SACK_MAP entry
-* \return        void
-* \authors       Arunkumar Karri
-* \date          12.10.2011 Created
-*/
-void vMarkEntryIntoMap(const SACK_MAP& RefObj)
-{
-    //EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    sg_asAckMapBuf.push_back(RefObj);
-    //LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-}
-
-/**
-* \brief         Function to retreive the Tx message entry from sg_asAckMapBuf list and delete.
-*                Also returns the respective client ID.
-* \param[in]     RefObj, is SACK_MAP entry to find and delete
-* \param[out]    ClientID, is client ID of the RefObj found
-* \return        TRUE if RefObj is found, else FALSE
-* \authors       Arunkumar Karri
-* \date          12.10.2011 Created
-*/
-BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
-{
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    BOOL bResult = FALSE;
-    CACK_MAP_LIST::iterator  iResult =
-        std::find( sg_asAckMapBuf.begin(), sg_asAckMapBuf.end(), RefObj );
-
-    //if ((*iResult).m_ClientID > 0)
-    if (iResult != sg_asAckMapBuf.end())
-    {
-        bResult = TRUE;
-        ClientID = (*iResult).m_ClientID;
-        sg_asAckMapBuf.erase(iResult);
-    }
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-    return bResult;
-}
-
 /**
 * \brief         Writes the message 'sLinData' to the corresponding clients buffer
 * \param[out]    sLinData, is STLINDATA structure
@@ -261,20 +222,8 @@ static void vWriteIntoClientsBuffer(STLINDATA& sLinData)
 
 
     //Write into the client's buffer and Increment message Count
-    static SACK_MAP sAckMap;
-    UINT ClientId = 0;
-    static UINT Index = (UINT)-1;
-    sAckMap.m_Channel = sLinData.m_uDataInfo.m_sLINMsg.m_ucChannel;
-    sAckMap.m_MsgID = sLinData.m_uDataInfo.m_sLINMsg.m_ucMsgID;
-
-    for (UINT i = 0; i < sg_unClientCnt; i++)
-    {
-        for (UINT j = 0; j < sg_asClientToBufMap[i].unBufCount; j++)
-        {
-            sg_asClientToBufMap[i].pClientBuf[j]->WriteIntoBuffer(&sLinData);
-        }
-    }
-
+    sg_ouClientDispatch.vAddFrame(sLinData, 0);
+    sg_ouClientDispatch.vFlush(sg_asClientToBufMap, sg_unClientCnt);
 }
 
 static void vValidateReceivedLinPID(STLIN_MSG& RxMsg)
@@ -67,19 +67,6 @@ static SCLIENTBUFMAP sg_asClientToBufMap[MAX_CLIENT_ALLOWED];
 /* Receive Thread object */
 static CPARAM_THREADPROC sg_sParmRThread;
 
-/* For maintaining Acknwoledgement map entries */
-typedef struct tagAckMap
-{
-    UINT m_MsgID;
-    UINT m_ClientID;
-    UINT m_Channel;
-
-    BOOL operator == (const tagAckMap& RefObj)const
-    {
-        return ((m_MsgID == RefObj.m_MsgID) && (m_Channel == RefObj.m_Channel));
-    }
-} SACK_MAP;
-
 //typedef struct sTLIN_FRAME
 //{
 //  unsigned char m_ucMsgID;        // Protected Identifier
@@ -87,10 +74,6 @@ typedef struct tagAckMap
 //  unsigned char m_ucChksum;       // Checksum
 //} STLIN_FRAME, *PSTLIN_FRAME;
 
-static  CRITICAL_SECTION sg_CritSectForAckBuf;       // To make it thread safe
-typedef std::list<SACK_MAP> CACK_MAP_LIST;
-static CACK_MAP_LIST sg_asAckMapBuf;
-
 static HWND sg_hOwnerWnd = nullptr;
 
 std::string sg_acErrStr = "";
@@ -82,9 +82,6 @@ typedef sClientBufMap* PSCLIENTBUFMAP;
 
 static DWORD  sg_dwClientID = 0;
 
-typedef std::list<SACK_MAP> CACK_MAP_LIST;
-static CACK_MAP_LIST sg_asAckMapBuf;
-
 /* Harware Network List structure */
 struct tagHwNetList
 {
@@ -111,8 +108,6 @@ static UINT64 sg_TimeStampRef = 0;
 static LARGE_INTEGER sg_QueryTickCount;
 static HWND sg_hOwnerWnd = NULL;
 
-static  CRITICAL_SECTION sg_CritSectForAckBuf;       // To make it thread safe
-
 
 static CPARAM_THREADPROC sg_sParmRThread;
 static STATUSMSG sg_sCurrStatus;
@@ -367,29 +362,6 @@ static BOOL bRemoveClient(DWORD dwClientId)
     return bResult;
 }
 
-void vMarkEntryIntoMap(const SACK_MAP& RefObj)
-{
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    sg_asAckMapBuf.push_back(RefObj);
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-}
-
-BOOL bRemoveMapEntry(const SACK_MAP& RefObj, UINT& ClientID)
-{
-    EnterCriticalSection(&sg_CritSectForAckBuf); // Lock the buffer
-    BOOL bResult = FALSE;
-    CACK_MAP_LIST::iterator  iResult =
-        std::find( sg_asAckMapBuf.begin(), sg_asAckMapBuf.end(), RefObj );
-    //if ((*iResult).m_ClientID > 0)
-    if (iResult != sg_asAckMapBuf.end())
-    {
-        bResult = TRUE;
-        ClientID = (*iResult).m_unClientID;
-        sg_asAckMapBuf.erase(iResult);
-    }
-    LeaveCriticalSection(&sg_CritSectForAckBuf); // Unlock the buffer
-    return bResult;
-}
 /* Static Global common functions starts*/
 
 
@@ -24,14 +24,11 @@
 #include "GlobalObj.h"
 #include "AppServicesCAN.h"
 
-UINT gunSendMsg_CAN(STCAN_MSG* psTxMsg, HMODULE hModule)
-{
-    UINT Return = 1;
+#define defNODE_TX_BATCH        64      //Messages of a node handed to the DIL per call
 
-    VALIDATE_POINTER_RETURN_VAL(psTxMsg, Return);
-    CExecuteFunc* pmCEexecuteFunc =
-        CExecuteManager::ouGetExecuteManager(CAN, &CGlobalObj::ouGetObj(CAN)).pmGetNodeObject(hModule);
-    STCAN_MSG       sMsg  ;
+/* Copies a message of a node, limiting the data length to the frame type */
+static void vCopyNodeTxMsg(const STCAN_MSG* psTxMsg, STCAN_MSG& sMsg)
+{
     sMsg.m_unMsgID = psTxMsg->m_unMsgID;
     sMsg.m_ucRTR = psTxMsg->m_ucRTR;
     sMsg.m_ucEXTENDED = psTxMsg->m_ucEXTENDED;
@@ -58,6 +55,17 @@ UINT gunSendMsg_CAN(STCAN_MSG* psTxMsg, HMODULE hModule)
     {
         sMsg.m_ucData[i] = psTxMsg->m_ucData[i];
     }
+}
+
+UINT gunSendMsg_CAN(STCAN_MSG* psTxMsg, HMODULE hModule)
+{
+    UINT Return = 1;
+
+    VALIDATE_POINTER_RETURN_VAL(psTxMsg, Return);
+    CExecuteFunc* pmCEexecuteFunc =
+        CExecuteManager::ouGetExecuteManager(CAN, &CGlobalObj::ouGetObj(CAN)).pmGetNodeObject(hModule);
+    STCAN_MSG       sMsg  ;
+    vCopyNodeTxMsg(psTxMsg, sMsg);
 
 
     if (pmCEexecuteFunc != nullptr)
@@ -74,6 +82,52 @@ UINT gunSendMsg_CAN(STCAN_MSG* psTxMsg, HMODULE hModule)
     return Return;
 }
 
+/******************************************************************************
+    Function Name    :  gunSendMsgs_CAN
+    Input(s)         :  pvTxMsgs, messages of the node
+                        unCount, number of messages
+                        unMsgSize, size of a message in the node, the node's
+                        message structure may be larger than STCAN_MSG
+                        hModule, node DLL
+    Output           :  0 if all messages were sent, else 1
+    Functionality    :  Hands the messages to the DIL in calls of up to
+                        defNODE_TX_BATCH messages, instead of one call each.
+******************************************************************************/
+UINT gunSendMsgs_CAN(void* pvTxMsgs, UINT unCount, UINT unMsgSize, HMODULE hModule)
+{
+    UINT Return = 1;
+
+    VALIDATE_POINTER_RETURN_VAL(pvTxMsgs, Return);
+    if (unMsgSize < sizeof(STCAN_MSG))
+    {
+        return Return;
+    }
+    CExecuteFunc* pmCEexecuteFunc =
+        CExecuteManager::ouGetExecuteManager(CAN, &CGlobalObj::ouGetObj(CAN)).pmGetNodeObject(hModule);
+    if ( (pmCEexecuteFunc == nullptr) || (FALSE == pmCEexecuteFunc->bGetMsgTxFlag()) )
+    {
+        return Return;
+    }
+
+    Return = 0;
+    STCAN_MSG asMsgs[defNODE_TX_BATCH];
+    const BYTE* pbyTxMsg = (const BYTE*)pvTxMsgs;
+    for (UINT unSent = 0; unSent < unCount; )
+    {
+        UINT unBatch = min(unCount - unSent, (UINT)defNODE_TX_BATCH);
+        for (UINT i = 0; i < unBatch; i++)
+        {
+            vCopyNodeTxMsg((const STCAN_MSG*)(pbyTxMsg + (size_t)(unSent + i) * unMsgSize), asMsgs[i]);
+        }
+        if (CGlobalObj::GetICANDIL()->DILC_SendMsgs(pmCEexecuteFunc->dwGetNodeClientId(), asMsgs, unBatch, nullptr) != S_OK)
+        {
+            Return = 1;
+        }
+        unSent += unBatch;
+    }
+    return Return;
+}
+
 /******************************************************************************
     Function Name    :  gvControllerMode
     Input(s)         :  bNewMode, new mode
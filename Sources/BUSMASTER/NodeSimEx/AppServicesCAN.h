@@ -23,6 +23,8 @@
 #include "AppServices.h"
 //Send can message
 UINT gunSendMsg_CAN(STCAN_MSG* psTxMsg, HMODULE hModule);
+//Send several can messages in one call, unMsgSize is the stride of pvTxMsgs
+UINT gunSendMsgs_CAN(void* pvTxMsgs, UINT unCount, UINT unMsgSize, HMODULE hModule);
 // To set the controller mode Passive/Active
 BOOL gvSetControllerMode_CAN(BOOL);
 // To connect/diaconnect with the Hardware
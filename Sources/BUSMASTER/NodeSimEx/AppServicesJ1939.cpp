@@ -51,7 +51,8 @@ UINT g_unSendMsg_J1939(J1939_MSG* psJ1939TxMsg, HMODULE hModule)
     UINT Return = 0;
     VALIDATE_POINTER_RETURN_VAL(psJ1939TxMsg, Return);
 
-    STJ1939_MSG* psTxMsg = new STJ1939_MSG;
+    STJ1939_MSG sTxMsg;
+    STJ1939_MSG* psTxMsg = &sTxMsg;
     psTxMsg->m_sMsgProperties.m_uExtendedID.m_unExtID = psJ1939TxMsg->id.extendedId;
     psTxMsg->m_sMsgProperties.m_byChannel = psJ1939TxMsg->cluster;
     psTxMsg->m_sMsgProperties.m_eType = psJ1939TxMsg->msgType;
@@ -59,8 +60,9 @@ UINT g_unSendMsg_J1939(J1939_MSG* psJ1939TxMsg, HMODULE hModule)
     psTxMsg->m_sMsgProperties.m_eDirection = psJ1939TxMsg->direction;
     psTxMsg->m_unDLC = psJ1939TxMsg->dlc;
 
-    psTxMsg->vInitialize(psJ1939TxMsg->dlc);
+    // The message refers to the data of the node, it does not own it
     psTxMsg->m_pbyData = psJ1939TxMsg->data;
+    psTxMsg->m_bAttached = true;
     /*for (int index = 0; index < psTxMsg->m_unDLC; index++)
     {
         psTxMsg->m_pbyData[index] = psTxMsg1->data[index];
@@ -91,7 +93,6 @@ UINT g_unSendMsg_J1939(J1939_MSG* psJ1939TxMsg, HMODULE hModule)
         }
     }
 
-    //DELETE_ARRAY(psTxMsg->m_pbyData);
     return Return;
 }
 
@@ -59,6 +59,8 @@ public:
     virtual BOOL NS_IsSimSysConfigChanged() = 0;
     virtual int NS_nOnBusConnected(bool bConnected) = 0;
     virtual void NS_SetJ1939ActivationStatus(bool bActivated) =0;
+    //Message handler counters of all nodes of the bus
+    virtual void NS_GetMsgHandlerStats(SMSG_HANDLER_STATS& sTotal) = 0;
     //INTERFACE FUNCTIONS ENDS
 
     // FOR Passing Cluster Config
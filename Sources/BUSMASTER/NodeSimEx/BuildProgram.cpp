@@ -92,428 +92,28 @@ CBuildProgram::~CBuildProgram()
 BOOL CBuildProgram::bBuildProgram(PSNODEINFO psNodeInfo, BOOL bLoadDLL, BOOL bDisplaySuccessful)
 {
     BOOL bReturn            = FALSE;
-    CString omStrFilePath   = "";
-    CString omStrErrorMsg   = "";
     int iMajorVer = 0;
     int iMinorVer = 0;
     BOOL bVersion = FALSE ;
     CString omFileName=psNodeInfo->m_omStrCFileName;
-    //psNodeInfo->m_eNodeState = NODE_NOT_BUILT;
     CString omLongFileName=omFileName;
-    PROCESS_INFORMATION sProcessInfo;
-    STARTUPINFO         sStartInfo;
-    SECURITY_ATTRIBUTES sSecurityAttr;
     CWaitCursor omWait;
-    DWORD makeResult = 1;		//non-zero initialisation
 
     // Check if file name passed as parameter is not empty
     if(omFileName.IsEmpty()==FALSE)
     {
-        UpdatedDbCheckSumInfo(psNodeInfo);
-        //CFileFind omFileFind;
-        /*If the .dll file is already exists delete the .dll files
-        so that on checking creation of .dll file we say build is
-        success or failure*/
-
-        // Remove all items in this string array before adding.
-        m_omStrArray.RemoveAll();
-        m_omStrArray.Add(" ");
-        m_omStrArray.Add(omFileName);
-        m_omStrSourceFilename = omFileName;
-
-        CString omStrDllFile = omFileName;
-        omStrDllFile.Replace(".cpp",".dll");
-        /*if(omFileFind.FindFile(omStrDllFile) != 0)
+        sBUILD_JOB sJob;
+        bReturn = bPrepareBuildJob(psNodeInfo, sJob);
+        if(bReturn == TRUE && sJob.m_bUpToDate == false)
         {
-            if(DeleteFile(omStrDllFile) == 0)
-            {
-                omStrErrorMsg.Format(defERROR_DELETE_DLL,
-                                     omStrDllFile);
-                m_omStrArray.Add(omStrErrorMsg);
-                bAddString(m_omStrArray);
-                return FALSE;
-            }
-        }*/
-
-        LONG lError = 0;
-        //HKEY sKey;
-        BYTE acGCCPath[1024];
-
-        // Get the installation path for FRAME
-        lError = ERROR_SUCCESS;
-        /*lError = RegOpenKeyEx(  HKEY_LOCAL_MACHINE,
-                 defREGISTRY_LOCATION,
-                 0,
-                 KEY_READ,
-                 &sKey);*/
-        // If the registry key open successfully, get the value in "path"
-        // sub key
-        if(lError==ERROR_SUCCESS)
-        {
-            HANDLE hStdInput        = nullptr; // Standard input handle of the child process.
-            HANDLE hStdOutput       = nullptr; // - Standard output handle of the child process.
-            HANDLE hStdError        = nullptr; //- Standard error handle of the child process.
-
-            lError = ERROR_SUCCESS;
-            /*lError = RegQueryValueEx(sKey,_T("path"),0, &ulType, acGCCPath,&dwSize);
-            RegCloseKey(sKey);*/
-            // Check if value is read successfully.
-            if(lError !=ERROR_SUCCESS)
-            {
-                m_omStrArray.Add(defERROR_IN_REGISTRY);
-                // Add string to list box attached to output window after
-                // displaying it if not displayed already.
-                bAddString(m_omStrArray);
-
-                bReturn = FALSE;
-                return bReturn;
-            }
-            // create an output file will be used by create process to send
-            // output of process.
-            sSecurityAttr.nLength = sizeof(SECURITY_ATTRIBUTES);
-            sSecurityAttr.bInheritHandle = TRUE;
-            sSecurityAttr.lpSecurityDescriptor = nullptr;
-
-            omStrFilePath   = omFileName.Left(omFileName.ReverseFind('\\'));
-            omStrFilePath  += "\\output.txt";
-
-            hStdOutput =  CreateFile(LPCTSTR(omStrFilePath) ,
-                                     GENERIC_WRITE|GENERIC_READ, // access mode
-                                     FILE_SHARE_WRITE  |FILE_SHARE_WRITE,
-                                     &sSecurityAttr,
-                                     CREATE_ALWAYS,
-                                     FILE_ATTRIBUTE_NORMAL,
-                                     nullptr ) ;
-
-            // check if file is open successfully
-            if(hStdOutput== INVALID_HANDLE_VALUE)
-            {
-                DWORD dwError = GetLastError();
-                omStrErrorMsg.Format("%s: %d",
-                                     "Error in opening output file",
-                                     dwError);
-                m_omStrArray.Add(omStrErrorMsg);
-                // Add string to list box attached to output window after
-                // displaying it if not displayed already.
-                bAddString(m_omStrArray);
-
-                bReturn = FALSE;
-                return bReturn;
-            }
-
-            // Create an error file which will be used by create process to put
-            // all error message generated.
-            sSecurityAttr.nLength = sizeof(SECURITY_ATTRIBUTES);
-            sSecurityAttr.bInheritHandle = TRUE;
-            sSecurityAttr.lpSecurityDescriptor = nullptr;
-
-            omStrFilePath   = omFileName.Left(omFileName.ReverseFind('\\'));
-            omStrFilePath  += "\\error.txt";
-
-            hStdError =  CreateFile(LPCTSTR(omStrFilePath),
-                                    GENERIC_WRITE|GENERIC_READ, // access mode
-                                    FILE_SHARE_READ | FILE_SHARE_WRITE,
-                                    &sSecurityAttr,
-                                    CREATE_ALWAYS,
-                                    FILE_ATTRIBUTE_NORMAL,
-                                    nullptr );
-
-            // check if error file is created successfully
-            if(hStdError == INVALID_HANDLE_VALUE)
-            {
-                DWORD dwError =   GetLastError();
-                omStrErrorMsg.Format("%s: %d",
-                                     "Error in opening error file",
-                                     dwError);
-                m_omStrArray.Add(omStrErrorMsg);
-                // Add string to list box attached to output window after
-                // displaying it if not displayed already.
-                bAddString(m_omStrArray);
-
-                bReturn = FALSE;
-                // close output if error file is not created
-                // successfully
-                CloseHandle(hStdOutput);
-                return bReturn;
-            }
-
-            // create input file which will be used by create process
-            sSecurityAttr.nLength = sizeof(SECURITY_ATTRIBUTES);
-            sSecurityAttr.bInheritHandle = TRUE;
-            sSecurityAttr.lpSecurityDescriptor = nullptr;
-
-            omStrFilePath   = omFileName.Left(omFileName.ReverseFind('\\'));
-            omStrFilePath  += "\\input.txt";
-
-            hStdInput =  CreateFile(LPCTSTR(omStrFilePath),
-                                    GENERIC_WRITE|GENERIC_READ,    // access mode
-                                    FILE_SHARE_READ | FILE_SHARE_WRITE,
-                                    &sSecurityAttr,
-                                    CREATE_ALWAYS,
-                                    FILE_ATTRIBUTE_NORMAL,
-                                    nullptr );
-
-            // Check if input file created successfully
-            if(hStdInput == INVALID_HANDLE_VALUE)
-            {
-                DWORD dwError =   GetLastError();
-                omStrErrorMsg.Format("%s: %d",
-                                     "Error in opening input file",
-                                     dwError);
-                m_omStrArray.Add(omStrErrorMsg);
-                // Add string to list box attached to output window after
-                // displaying it if not displayed already.
-                bAddString(m_omStrArray);
-
-                // close output and error files if input file is not created
-                // successfully
-                CloseHandle(hStdError);
-                CloseHandle(hStdOutput);
-                bReturn = FALSE;
-                return bReturn;
-            }
-
-            // Create process using input, output and error file handle.
-            // Set up the start up info struct.
-            ZeroMemory(&sProcessInfo, sizeof(sProcessInfo) );
-            ZeroMemory(&sStartInfo,sizeof(STARTUPINFO));
-            sStartInfo.cb           = sizeof(STARTUPINFO);
-            //to use the specified handles
-            sStartInfo.dwFlags      = STARTF_USESTDHANDLES;
-            sStartInfo.hStdOutput   = hStdOutput;
-            sStartInfo.hStdInput    = hStdInput;
-            sStartInfo.hStdError    = hStdError;
-            // Use this if you want to hide the child:
-            sStartInfo.wShowWindow  = SW_HIDE;
-
-            // Get the make file template path.
-            CString omStrMakeFileTemplateName;
-            omStrMakeFileTemplateName  = acGCCPath;
-            CString omTempGccFile = m_pGlobalObj->m_omAppDirectory;
-            /*kadoor*/
-            omStrMakeFileTemplateName = omTempGccFile;
-            CString omGccMakeFileName = "\\GCCDLLMakeTemplate";
-
-
-            omStrMakeFileTemplateName += omGccMakeFileName;
-
-            // Create make file in the path where source file to by compiled is
-            // Located
-            CString omStrTemp          = omFileName.Left(
-                                             omFileName.ReverseFind('\\'));
-            CString omStrMakeFileName  = omStrTemp;
-            omStrMakeFileName         += "\\DLLMake";
-            bReturn = bCreateMakeFile(psNodeInfo, omStrMakeFileTemplateName,
-                                      omStrMakeFileName);
-            char acStrShortPath[1024];
-            dwConvertShortPathName(omStrMakeFileName,acStrShortPath);
-
-            // check if make file is created successfully.
-            if(bReturn == TRUE)
-            {
-                CString omStrGccMakeFile = "";
-                CString omStrGccParamter = "";
-                CString omStrGCCPath     = "";
-                // Create process after giving the command line input
-                omStrGccMakeFile  = acGCCPath;
-
-                /*kadoor*/
-                omStrGccMakeFile = omTempGccFile;
-                /*omStrGccMakeFile += "\\MinGW\\bin";
-                omStrGCCPath      = omStrGccMakeFile;*/
-                omStrGccMakeFile = "mingw32-make.exe";
-                omStrGccParamter  =  "--silent --file=";
-                omStrGccParamter += acStrShortPath;
-
-                char* pucGccMakeFile  = (TCHAR*)omStrGccMakeFile.GetBuffer(
-                                            omStrGccMakeFile.GetLength());
-                char* pucGccParameter = (TCHAR*)omStrGccParamter.GetBuffer(
-                                            omStrGccParamter.GetLength());
-                char* pucGCCPath      = (TCHAR*)omStrGCCPath.GetBuffer(
-                                            omStrGCCPath.GetLength());
-                CString omStrCommandParam = pucGccMakeFile ;
-                omStrCommandParam += " ";
-                omStrCommandParam += pucGccParameter;
-
-                char path_buffer[_MAX_PATH];
-                char drive[_MAX_DRIVE];
-                char dir[_MAX_DIR];
-                char fname[_MAX_FNAME];
-                char ext[_MAX_EXT];
-
-                _splitpath( omLongFileName, drive, dir, fname, ext );
-                PathCombine(path_buffer, drive, dir );
-
-                SetCurrentDirectory(path_buffer);
-
-                if ( psNodeInfo->m_eNodeState == NODE_REQ_CLEAN_BUILT)
-                {
-                    CString StrCleanCommandPram = omStrCommandParam + " clean";
-                    INT nSuccess = CreateProcess( nullptr, StrCleanCommandPram.GetBuffer(MAX_PATH),
-                                                  nullptr, nullptr,
-                                                  true, CREATE_NO_WINDOW,
-                                                  nullptr, nullptr,
-                                                  &sStartInfo, &sProcessInfo);
-                    if (nSuccess!=0)
-                    {
-                        WaitForSingleObject(sProcessInfo.hProcess, INFINITE );
-                    }
-                }
-                psNodeInfo->m_eNodeState = NODE_NOT_BUILT;//Whether success or not move to next build step
-
-                INT nSuccess = CreateProcess( nullptr, omStrCommandParam.GetBuffer(MAX_PATH),
-                                              nullptr, nullptr,
-                                              true, CREATE_NO_WINDOW,
-                                              nullptr, nullptr,
-                                              &sStartInfo, &sProcessInfo);
-
-                // check if process is not created successfully else
-                // wait for the process to to complete with time out value
-                if (nSuccess==0)
-                {
-                    DWORD dwError =   GetLastError();
-                    LPTSTR pcMessageBuffer;
-                    DWORD dwFormatFlags = FORMAT_MESSAGE_ALLOCATE_BUFFER |
-                                          FORMAT_MESSAGE_IGNORE_INSERTS |
-                                          FORMAT_MESSAGE_FROM_SYSTEM ;
-
-                    FormatMessage(
-                        dwFormatFlags,
-                        nullptr, // module to get message from (nullptr == system)
-                        dwError,
-                        MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT), // default language
-                        (LPTSTR) &pcMessageBuffer,
-                        0,
-                        nullptr
-                    );
-
-                    omStrErrorMsg.Format("%s: %s",
-                                         "Invoking MinGW gcc compiler Failed",
-                                         pcMessageBuffer);
-                    LocalFree(pcMessageBuffer);
-                    m_omStrArray.Add(omStrErrorMsg);
-                    omStrErrorMsg = "Refer \"MinGW Installation\" Section in BUSMASTER Help File for Further Information";
-                    m_omStrArray.Add(omStrErrorMsg);
-                    // Add string to list box attached to output window after
-                    // displaying it if not displayed already.
-                    bAddString(m_omStrArray);
-
-                    omStrGccParamter.ReleaseBuffer(omStrGccParamter.GetLength());
-                    omStrGccMakeFile.ReleaseBuffer(omStrGccMakeFile.GetLength());
-                    omStrGCCPath.ReleaseBuffer(omStrGCCPath.GetLength());
-
-                    // close all three files if create process is not successfull
-                    CloseHandle(hStdError);
-                    CloseHandle(hStdOutput);
-                    CloseHandle(hStdInput);
-                    bReturn = FALSE;
-                    return bReturn;
-                }
-                else
-                {
-
-                    if (nSuccess!=0)
-                    {
-                        WaitForSingleObject(sProcessInfo.hProcess, INFINITE );
-                        GetExitCodeProcess(sProcessInfo.hProcess, &makeResult);
-                    }
-                }
-                omStrGccParamter.ReleaseBuffer(omStrGccParamter.GetLength());
-                omStrGccMakeFile.ReleaseBuffer(omStrGccMakeFile.GetLength());
-                omStrGCCPath.ReleaseBuffer(omStrGCCPath.GetLength());
-                // close the created files
-                CloseHandle(hStdError);
-                CloseHandle(hStdOutput);
-                CloseHandle(hStdInput);
-
-                // Get the output or error message from the corresponding file
-                // and add it to CStringArray
-                omStrFilePath   = omFileName.Left(omFileName.ReverseFind('\\'));
-                omStrFilePath  += "\\error.txt";
-                bAddStrToArrayFromFile(omStrFilePath,m_omStrArray);
-                // to generate a message that dll is created successfully.
-                // If there is no message in error file -> DLL created
-                // successfully
-
-                omStrFilePath.Replace("error.txt","output.txt");
-                bAddStrToArrayFromFile(omStrFilePath,m_omStrArray);
-
-                CString omStrDLLFile = "";
-                //compiled properly
-                if(makeResult == 0)								
-                {
-                    CString omStrFileNameInSDLLFile="";
-                    CString omStrFileNameInLongFileName="";
-                    CString omStrDLLFile   = "";
-                    char acStrShortPath[1000];
-                    dwConvertShortPathName(omFileName,acStrShortPath);
-                    omFileName    = acStrShortPath;
-                    omStrDLLFile  = omFileName.Left(omFileName.ReverseFind('.'));
-                    omStrDLLFile += defDOT_DLL;
-                    int nLength=omStrDLLFile.GetLength();
-                    nLength-=omStrDLLFile.ReverseFind('\\');
-                    nLength--;
-                    omStrFileNameInSDLLFile=omStrDLLFile.
-                                            Right(nLength);
-                    int nLastDotPlace=omLongFileName.ReverseFind('.');
-                    omLongFileName=omLongFileName.Left(nLastDotPlace);
-                    omLongFileName+= defDOT_DLL;
-                    nLength=omLongFileName.GetLength();
-                    nLength-=omLongFileName.ReverseFind('\\');
-                    nLength--;
-                    omStrFileNameInLongFileName=omLongFileName.
-                                                Right(nLength);
-                    if(omStrFileNameInLongFileName.
-                            CompareNoCase(omStrFileNameInSDLLFile))
-                    {
-                        BOOL bCopyFileStatus=COPYFILE(omStrDLLFile,omLongFileName);
-                        if(bCopyFileStatus!=FALSE)
-                        {
-                            DeleteFile(omStrDLLFile);
-                        }
-                    }
-                    psNodeInfo->m_omStrDllName=omLongFileName;
-                    omLongFileName +=" created successfully";
-
-
-
-                    if(bDisplaySuccessful)
-                    {
-                        m_omStrArray.Add(omLongFileName);
-                        bAddString(m_omStrArray);
-                    }
-                }
-                else
-                {
-                    // Error in building DLL
-                    omStrDLLFile  ="Error in creating ";
-                    omStrDLLFile += omLongFileName.Left(omLongFileName.ReverseFind('.'));
-                    omStrDLLFile += defDOT_DLL;
-                    m_omStrArray.Add(omStrDLLFile);
-                    bReturn = FALSE;
-                    bAddString(m_omStrArray);
-                }
-                // Add all items in CStringArray to list box attached to
-                // output window.after displaying it if not displayed
-
-            }
-            else
-            {
-                // close the created files
-                CloseHandle(hStdError);
-                CloseHandle(hStdOutput);
-                CloseHandle(hStdInput);
-                bReturn = FALSE;
-            }
-
+            CRITICAL_SECTION omCritSec;
+            InitializeCriticalSection(&omCritSec);
+            vRunBuildJob(&sJob, &omCritSec);
+            DeleteCriticalSection(&omCritSec);
         }
-        else
+        if(bReturn == TRUE)
         {
-            m_omStrArray.Add(defERROR_OPEN_REGISTRY);
-            // Add string to list box attached to output window
-            // after displaying it if not displayed already.
-            bAddString(m_omStrArray);
-            bReturn = FALSE;
+            bReturn = bCompleteBuildJob(sJob, bDisplaySuccessful);
         }
         // Load the DLL if the flag passed as parameter is set
         // Unloading of already loaded library is done in CMainFrame.
@@ -609,6 +209,651 @@ BOOL CBuildProgram::bBuildProgram(PSNODEINFO psNodeInfo, BOOL bLoadDLL, BOOL bDi
     }
     return bReturn;
 }
+
+namespace
+{
+const UINT64 FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+const UINT64 FNV_PRIME        = 0x100000001b3ULL;
+
+UINT64 un64Fnv1a(const void* pvData, size_t unSize, UINT64 un64Hash)
+{
+    const BYTE* pbyData = (const BYTE*)pvData;
+    for (size_t i = 0; i < unSize; i++)
+    {
+        un64Hash ^= pbyData[i];
+        un64Hash *= FNV_PRIME;
+    }
+    return un64Hash;
+}
+
+// Adds the content of a file, FALSE if it can not be read
+BOOL bHashFileContent(const CString& omStrFile, UINT64& un64Hash)
+{
+    std::ifstream omFile((LPCTSTR)omStrFile, std::ios::in | std::ios::binary);
+    if (!omFile.good())
+    {
+        return FALSE;
+    }
+    char acBuffer[4096];
+    while (omFile.read(acBuffer, sizeof(acBuffer)) || omFile.gcount() > 0)
+    {
+        un64Hash = un64Fnv1a(acBuffer, (size_t)omFile.gcount(), un64Hash);
+    }
+    return TRUE;
+}
+
+// Adds name, size and modification time of a file, FALSE if it does not exist
+BOOL bHashFileStamp(const CString& omStrFile, UINT64& un64Hash)
+{
+    WIN32_FILE_ATTRIBUTE_DATA sAttributes;
+    if (GetFileAttributesEx(omStrFile, GetFileExInfoStandard, &sAttributes) == FALSE)
+    {
+        return FALSE;
+    }
+    un64Hash = un64Fnv1a((LPCTSTR)omStrFile, omStrFile.GetLength(), un64Hash);
+    un64Hash = un64Fnv1a(&sAttributes.ftLastWriteTime, sizeof(FILETIME), un64Hash);
+    un64Hash = un64Fnv1a(&sAttributes.nFileSizeHigh, sizeof(DWORD), un64Hash);
+    un64Hash = un64Fnv1a(&sAttributes.nFileSizeLow, sizeof(DWORD), un64Hash);
+    return TRUE;
+}
+
+// Reads the prerequisites from a dependency file of gcc -MMD:
+// "target.o: first.cpp header.h \" with spaces in names escaped by '\'
+BOOL bReadDependencies(const CString& omStrDepFile, const CString& omStrWorkDir, CStringArray& omStrDeps)
+{
+    std::ifstream omFile((LPCTSTR)omStrDepFile, std::ios::in | std::ios::binary);
+    if (!omFile.good())
+    {
+        return FALSE;
+    }
+    std::string strContent((std::istreambuf_iterator<char>(omFile)), std::istreambuf_iterator<char>());
+    std::string strToken;
+    bool bTargetDone = false;
+    for (size_t i = 0; i <= strContent.size(); i++)
+    {
+        char cChar = (i < strContent.size()) ? strContent[i] : ' ';
+        if (cChar == '\\' && i + 1 < strContent.size()
+                && (strContent[i + 1] == ' ' || strContent[i + 1] == '\r' || strContent[i + 1] == '\n'))
+        {
+            if (strContent[i + 1] == ' ')
+            {
+                strToken += ' ';
+            }
+            i++;
+            continue;
+        }
+        if (cChar != ' ' && cChar != '\t' && cChar != '\r' && cChar != '\n')
+        {
+            strToken += cChar;
+            continue;
+        }
+        if (strToken.empty() == false)
+        {
+            if (bTargetDone == false && strToken[strToken.size() - 1] == ':')
+            {
+                bTargetDone = true;
+            }
+            else
+            {
+                CString omStrDep = strToken.c_str();
+                if (PathIsRelative(omStrDep) == TRUE)
+                {
+                    omStrDep = omStrWorkDir + "\\" + omStrDep;
+                }
+                omStrDeps.Add(omStrDep);
+            }
+            strToken.clear();
+        }
+    }
+    return bTargetDone;
+}
+
+// Reads the link inputs and forced includes of a generated make file: every
+// file of the BM_LIB folder and the quoted files of DBOBJFILE and DBINCLUDES.
+// The headers of the BM_INCLUDES folder are listed in the dependency file.
+BOOL bReadMakeInputs(const CString& omStrMakeFile, CStringArray& omStrInputs)
+{
+    std::ifstream omFile((LPCTSTR)omStrMakeFile, std::ios::in);
+    if (!omFile.good())
+    {
+        return FALSE;
+    }
+    std::string strLine;
+    while (std::getline(omFile, strLine))
+    {
+        bool bLib = (strLine.compare(0, 6, "BM_LIB") == 0);
+        if (bLib == false && strLine.compare(0, 9, "DBOBJFILE") != 0 && strLine.compare(0, 10, "DBINCLUDES") != 0)
+        {
+            continue;
+        }
+        // Quoted names
+        size_t unStart = strLine.find('"');
+        while (unStart != std::string::npos)
+        {
+            size_t unEnd = strLine.find('"', unStart + 1);
+            if (unEnd == std::string::npos)
+            {
+                break;
+            }
+            CString omStrName = strLine.substr(unStart + 1, unEnd - unStart - 1).c_str();
+            if (bLib == false)
+            {
+                omStrInputs.Add(omStrName);
+            }
+            else
+            {
+                WIN32_FIND_DATA sFindData;
+                HANDLE hFind = FindFirstFile(omStrName + "\\*", &sFindData);
+                if (hFind != INVALID_HANDLE_VALUE)
+                {
+                    do
+                    {
+                        if ((sFindData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+                        {
+                            omStrInputs.Add(omStrName + "\\" + sFindData.cFileName);
+                        }
+                    }
+                    while (FindNextFile(hFind, &sFindData) != FALSE);
+                    FindClose(hFind);
+                }
+            }
+            unStart = strLine.find('"', unEnd + 1);
+        }
+    }
+    return TRUE;
+}
+
+// Jobs of bBuildPrograms, taken by the worker threads in turn
+struct sBUILD_BATCH
+{
+    std::vector<sBUILD_JOB*> m_ouJobs;
+    CRITICAL_SECTION m_omCritSec;       // Serialises the start of the make processes
+    volatile LONG m_lNextIndex;
+};
+}
+
+/******************************************************************************/
+/*  Function Name    :  bBuildPrograms                                        */
+/*  Input(s)         :  Nodes to be built, flag to display success messages   */
+/*  Output           :  TRUE if all nodes are built                           */
+/*  Functionality    :  Builds the DLLs of the nodes. The make files are      */
+/*                      created here, make runs for several nodes at a time   */
+/*                      on worker threads. Nodes whose sources, headers and   */
+/*                      databases are unchanged since their last build are    */
+/*                      not built again. Output and node states are updated   */
+/*                      in the order of the nodes once all runs are done.     */
+/*  Member of        :  CBuildProgram                                         */
+/******************************************************************************/
+BOOL CBuildProgram::bBuildPrograms(std::vector<PSNODEINFO>& ouNodes, BOOL bDisplaySuccessful)
+{
+    BOOL bReturn = TRUE;
+    CWaitCursor omWait;
+    std::vector<PSNODEINFO> ouSharedSources;
+    sBUILD_BATCH sBatch;
+    sBatch.m_lNextIndex = 0;
+
+    for (auto itrNode = ouNodes.begin(); itrNode != ouNodes.end(); ++itrNode)
+    {
+        PSNODEINFO psNodeInfo = *itrNode;
+        if (psNodeInfo->m_omStrCFileName.IsEmpty() == TRUE)
+        {
+            continue;
+        }
+        // Two makes must not run in the same files. A node sharing its source is
+        // built after the others and then normally finds its DLL up to date.
+        bool bShared = false;
+        for (auto itrJob = sBatch.m_ouJobs.begin(); itrJob != sBatch.m_ouJobs.end(); ++itrJob)
+        {
+            if ((*itrJob)->m_psNodeInfo->m_omStrCFileName.CompareNoCase(psNodeInfo->m_omStrCFileName) == 0)
+            {
+                bShared = true;
+                break;
+            }
+        }
+        if (bShared == true)
+        {
+            ouSharedSources.push_back(psNodeInfo);
+            continue;
+        }
+        sBUILD_JOB* psJob = new sBUILD_JOB;
+        bPrepareBuildJob(psNodeInfo, *psJob);
+        sBatch.m_ouJobs.push_back(psJob);
+    }
+
+    InitializeCriticalSection(&sBatch.m_omCritSec);
+    SYSTEM_INFO sSysInfo;
+    GetSystemInfo(&sSysInfo);
+    size_t unThreads = min(sBatch.m_ouJobs.size(), (size_t)max(sSysInfo.dwNumberOfProcessors, (DWORD)1));
+    std::vector<HANDLE> ouThreads;
+    for (size_t i = 1; i < unThreads; i++)
+    {
+        HANDLE hThread = CreateThread(nullptr, 0, dwBuildThreadProc, &sBatch, 0, nullptr);
+        if (hThread != nullptr)
+        {
+            ouThreads.push_back(hThread);
+        }
+    }
+    //Calling thread takes part as well, so the batch completes even if no thread could be created
+    dwBuildThreadProc(&sBatch);
+    if (ouThreads.empty() == false)
+    {
+        WaitForMultipleObjects((DWORD)ouThreads.size(), &ouThreads[0], TRUE, INFINITE);
+        for (auto itr = ouThreads.begin(); itr != ouThreads.end(); ++itr)
+        {
+            CloseHandle(*itr);
+        }
+    }
+    DeleteCriticalSection(&sBatch.m_omCritSec);
+
+    for (auto itrJob = sBatch.m_ouJobs.begin(); itrJob != sBatch.m_ouJobs.end(); ++itrJob)
+    {
+        sBUILD_JOB* psJob = *itrJob;
+        if (bCompleteBuildJob(*psJob, bDisplaySuccessful) == TRUE)
+        {
+            psJob->m_psNodeInfo->m_eNodeState = NODE_BUILD_SUCCESS;
+        }
+        else
+        {
+            psJob->m_psNodeInfo->m_eNodeState = NODE_BUILD_FAIL;
+            bReturn = FALSE;
+        }
+        delete psJob;
+    }
+
+    for (auto itrNode = ouSharedSources.begin(); itrNode != ouSharedSources.end(); ++itrNode)
+    {
+        if (bBuildProgram(*itrNode, FALSE, bDisplaySuccessful) == FALSE)
+        {
+            bReturn = FALSE;
+        }
+    }
+    return bReturn;
+}
+
+DWORD WINAPI CBuildProgram::dwBuildThreadProc(LPVOID pParam)
+{
+    sBUILD_BATCH* psBatch = (sBUILD_BATCH*)pParam;
+    LONG lIndex;
+    while ((lIndex = InterlockedIncrement(&psBatch->m_lNextIndex) - 1) < (LONG)psBatch->m_ouJobs.size())
+    {
+        sBUILD_JOB* psJob = psBatch->m_ouJobs[lIndex];
+        if (psJob->m_bUpToDate == false && psJob->m_omStrMakeCommand.IsEmpty() == FALSE)
+        {
+            vRunBuildJob(psJob, &psBatch->m_omCritSec);
+        }
+    }
+    return 0;
+}
+
+/******************************************************************************/
+/*  Function Name    :  bPrepareBuildJob                                      */
+/*  Input(s)         :  Node to be built, job to be filled                    */
+/*  Output           :  FALSE if the make file could not be created           */
+/*  Functionality    :  Creates the make file of the node and the make        */
+/*                      command. The job is marked up to date if the hash of  */
+/*                      the node sources, the make file and the database      */
+/*                      checksum matches the one stored by the last build.    */
+/*  Member of        :  CBuildProgram                                         */
+/******************************************************************************/
+BOOL CBuildProgram::bPrepareBuildJob(PSNODEINFO psNodeInfo, sBUILD_JOB& sJob)
+{
+    CString omFileName = psNodeInfo->m_omStrCFileName;
+    UpdatedDbCheckSumInfo(psNodeInfo);
+
+    char drive[_MAX_DRIVE];
+    char dir[_MAX_DIR];
+    char fname[_MAX_FNAME];
+    char ext[_MAX_EXT];
+    _splitpath( omFileName, drive, dir, fname, ext );
+
+    sJob.m_psNodeInfo       = psNodeInfo;
+    sJob.m_omStrWorkDir     = omFileName.Left(omFileName.ReverseFind('\\'));
+    sJob.m_omStrFileTitle   = fname;
+    sJob.m_omStrDllFile     = omFileName.Left(omFileName.ReverseFind('.')) + defDOT_DLL;
+    sJob.m_bClean           = (psNodeInfo->m_eNodeState == NODE_REQ_CLEAN_BUILT);
+    sJob.m_bUpToDate        = false;
+    sJob.m_un64Hash         = 0;
+    sJob.m_bMakeStarted     = FALSE;
+    sJob.m_dwMakeResult     = 1;        //non-zero initialisation
+
+    // Create make file in the path where source file to by compiled is
+    // Located
+    CString omStrMakeFileTemplateName = m_pGlobalObj->m_omAppDirectory;
+    omStrMakeFileTemplateName += "\\GCCDLLMakeTemplate";
+    CString omStrMakeFileName = sJob.m_omStrWorkDir;
+    omStrMakeFileName += "\\DLLMake";
+    BOOL bReturn = bCreateMakeFile(psNodeInfo, omStrMakeFileTemplateName,
+                                   omStrMakeFileName);
+    if(bReturn == TRUE)
+    {
+        char acStrShortPath[1024];
+        dwConvertShortPathName(omStrMakeFileName,acStrShortPath);
+        sJob.m_omStrMakeCommand  = "mingw32-make.exe --silent --file=";
+        sJob.m_omStrMakeCommand += acStrShortPath;
+
+        sJob.m_un64Hash = un64GetBuildHash(sJob);
+        if (sJob.m_bClean == false && sJob.m_un64Hash != 0
+                && GetFileAttributes(sJob.m_omStrDllFile) != INVALID_FILE_ATTRIBUTES)
+        {
+            std::ifstream omHashFile((LPCTSTR)omGetJobFile(sJob, ".bmhash"), std::ios::in);
+            std::string strHash;
+            if (omHashFile.good() && (omHashFile >> strHash))
+            {
+                sJob.m_bUpToDate = (_strtoui64(strHash.c_str(), nullptr, 16) == sJob.m_un64Hash);
+            }
+        }
+    }
+    psNodeInfo->m_eNodeState = NODE_NOT_BUILT;//Whether success or not move to next build step
+    return bReturn;
+}
+
+/******************************************************************************/
+/*  Function Name    :  un64GetBuildHash                                      */
+/*  Input(s)         :  Build job                                             */
+/*  Output           :  Hash, 0 if it can not be computed                     */
+/*  Functionality    :  Hashes the node source and make file content, the     */
+/*                      database checksum, the size and time of the libraries */
+/*                      and database files named in the make file and of the  */
+/*                      headers listed in the dependency file of the last     */
+/*                      build. Without that file the headers are unknown, so  */
+/*                      no hash is given. Computed before the build, so       */
+/*                      inputs changed while make runs are seen next time.    */
+/*  Member of        :  CBuildProgram                                         */
+/******************************************************************************/
+UINT64 CBuildProgram::un64GetBuildHash(sBUILD_JOB& sJob)
+{
+    CStringArray omStrDeps;
+    if (bReadDependencies(omGetJobFile(sJob, ".d"), sJob.m_omStrWorkDir, omStrDeps) == FALSE
+            || bReadMakeInputs(omGetJobFile(sJob, "make"), omStrDeps) == FALSE)
+    {
+        return 0;
+    }
+    UINT64 un64Hash = un64Fnv1a(&sJob.m_psNodeInfo->m_ouLastDBChecksum,
+                                sizeof(sJob.m_psNodeInfo->m_ouLastDBChecksum), FNV_OFFSET_BASIS);
+    if (bHashFileContent(sJob.m_psNodeInfo->m_omStrCFileName, un64Hash) == FALSE
+            || bHashFileContent(omGetJobFile(sJob, "make"), un64Hash) == FALSE)
+    {
+        return 0;
+    }
+    for (INT_PTR i = 0; i < omStrDeps.GetSize(); i++)
+    {
+        // A removed header or library forces the build, which then reports it
+        if (bHashFileStamp(omStrDeps.GetAt(i), un64Hash) == FALSE)
+        {
+            return 0;
+        }
+    }
+    return (un64Hash != 0) ? un64Hash : 1;
+}
+
+CString CBuildProgram::omGetJobFile(const sBUILD_JOB& sJob, LPCTSTR pcSuffix)
+{
+    return sJob.m_omStrWorkDir + "\\" + sJob.m_omStrFileTitle + pcSuffix;
+}
+
+/******************************************************************************/
+/*  Function Name    :  vRunBuildJob                                          */
+/*  Input(s)         :  Build job, lock for starting processes                */
+/*  Output           :                                                        */
+/*  Functionality    :  Runs make clean if requested and make for the node.   */
+/*                      Called on the worker threads of bBuildPrograms, so    */
+/*                      only the job is written.                              */
+/*  Member of        :  CBuildProgram                                         */
+/******************************************************************************/
+void CBuildProgram::vRunBuildJob(sBUILD_JOB* psJob, CRITICAL_SECTION* pCritSec)
+{
+    HANDLE hProcess = nullptr;
+    BOOL bAppend = FALSE;
+    if (psJob->m_bClean == true)
+    {
+        if (bStartMake(psJob, psJob->m_omStrMakeCommand + " clean", FALSE, pCritSec, hProcess) == TRUE)
+        {
+            WaitForSingleObject(hProcess, INFINITE);
+            CloseHandle(hProcess);
+            bAppend = TRUE;
+        }
+        // A failed clean is reported by the build itself
+        psJob->m_omStrErrors.RemoveAll();
+    }
+    if (bStartMake(psJob, psJob->m_omStrMakeCommand, bAppend, pCritSec, hProcess) == TRUE)
+    {
+        psJob->m_bMakeStarted = TRUE;
+        WaitForSingleObject(hProcess, INFINITE);
+        GetExitCodeProcess(hProcess, &psJob->m_dwMakeResult);
+        CloseHandle(hProcess);
+    }
+}
+
+/******************************************************************************/
+/*  Function Name    :  bStartMake                                            */
+/*  Input(s)         :  Build job, command line, flag to append to the output */
+/*                      files, lock for starting processes                    */
+/*  Output           :  TRUE and the process handle if make is started        */
+/*  Functionality    :  Opens input, output and error file of the job and     */
+/*                      starts the command with them as standard handles in   */
+/*                      the folder of the node source. The inheritable file   */
+/*                      handles exist only while the lock is held, so a make  */
+/*                      started by another worker does not inherit them.      */
+/*  Member of        :  CBuildProgram                                         */
+/******************************************************************************/
+BOOL CBuildProgram::bStartMake(sBUILD_JOB* psJob, CString omStrCommand, BOOL bAppend,
+                               CRITICAL_SECTION* pCritSec, HANDLE& hProcess)
+{
+    static LPCTSTR const s_apcSuffix[] = { "_output.txt", "_error.txt", "_input.txt" };
+    static LPCTSTR const s_apcName[]   = { "output", "error", "input" };
+    HANDLE ahStdHandles[3] = { INVALID_HANDLE_VALUE, INVALID_HANDLE_VALUE, INVALID_HANDLE_VALUE };
+    SECURITY_ATTRIBUTES sSecurityAttr;
+    sSecurityAttr.nLength = sizeof(SECURITY_ATTRIBUTES);
+    sSecurityAttr.bInheritHandle = TRUE;
+    sSecurityAttr.lpSecurityDescriptor = nullptr;
+    CString omStrErrorMsg;
+    BOOL bReturn = TRUE;
+    hProcess = nullptr;
+
+    EnterCriticalSection(pCritSec);
+    for (int i = 0; i < 3 && bReturn == TRUE; i++)
+    {
+        ahStdHandles[i] = CreateFile(omGetJobFile(*psJob, s_apcSuffix[i]),
+                                     GENERIC_WRITE|GENERIC_READ, // access mode
+                                     FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                     &sSecurityAttr,
+                                     (bAppend == TRUE) ? OPEN_ALWAYS : CREATE_ALWAYS,
+                                     FILE_ATTRIBUTE_NORMAL,
+                                     nullptr );
+        if (ahStdHandles[i] == INVALID_HANDLE_VALUE)
+        {
+            omStrErrorMsg.Format("Error in opening %s file: %d", s_apcName[i], GetLastError());
+            psJob->m_omStrErrors.Add(omStrErrorMsg);
+            bReturn = FALSE;
+        }
+        else if (bAppend == TRUE)
+        {
+            SetFilePointer(ahStdHandles[i], 0, nullptr, FILE_END);
+        }
+    }
+    if (bReturn == TRUE)
+    {
+        PROCESS_INFORMATION sProcessInfo;
+        STARTUPINFO         sStartInfo;
+        ZeroMemory(&sProcessInfo, sizeof(sProcessInfo) );
+        ZeroMemory(&sStartInfo,sizeof(STARTUPINFO));
+        sStartInfo.cb           = sizeof(STARTUPINFO);
+        //to use the specified handles
+        sStartInfo.dwFlags      = STARTF_USESTDHANDLES;
+        sStartInfo.hStdOutput   = ahStdHandles[0];
+        sStartInfo.hStdError    = ahStdHandles[1];
+        sStartInfo.hStdInput    = ahStdHandles[2];
+        // Use this if you want to hide the child:
+        sStartInfo.wShowWindow  = SW_HIDE;
+
+        INT nSuccess = CreateProcess( nullptr, omStrCommand.GetBuffer(MAX_PATH),
+                                      nullptr, nullptr,
+                                      true, CREATE_NO_WINDOW,
+                                      nullptr, psJob->m_omStrWorkDir,
+                                      &sStartInfo, &sProcessInfo);
+        omStrCommand.ReleaseBuffer();
+        if (nSuccess != 0)
+        {
+            CloseHandle(sProcessInfo.hThread);
+            hProcess = sProcessInfo.hProcess;
+        }
+        else
+        {
+            DWORD dwError =   GetLastError();
+            LPTSTR pcMessageBuffer;
+            DWORD dwFormatFlags = FORMAT_MESSAGE_ALLOCATE_BUFFER |
+                                  FORMAT_MESSAGE_IGNORE_INSERTS |
+                                  FORMAT_MESSAGE_FROM_SYSTEM ;
+
+            FormatMessage(
+                dwFormatFlags,
+                nullptr, // module to get message from (nullptr == system)
+                dwError,
+                MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT), // default language
+                (LPTSTR) &pcMessageBuffer,
+                0,
+                nullptr
+            );
+
+            omStrErrorMsg.Format("%s: %s",
+                                 "Invoking MinGW gcc compiler Failed",
+                                 pcMessageBuffer);
+            LocalFree(pcMessageBuffer);
+            psJob->m_omStrErrors.Add(omStrErrorMsg);
+            omStrErrorMsg = "Refer \"MinGW Installation\" Section in BUSMASTER Help File for Further Information";
+            psJob->m_omStrErrors.Add(omStrErrorMsg);
+            bReturn = FALSE;
+        }
+    }
+    // The child has its own copies, the files are read once it has finished
+    for (int i = 0; i < 3; i++)
+    {
+        if (ahStdHandles[i] != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(ahStdHandles[i]);
+        }
+    }
+    LeaveCriticalSection(pCritSec);
+    return bReturn;
+}
+
+/******************************************************************************/
+/*  Function Name    :  bCompleteBuildJob                                     */
+/*  Input(s)         :  Finished build job, flag to display success message   */
+/*  Output           :  TRUE if the DLL is built or up to date                */
+/*  Functionality    :  Adds the make output to the output window, sets the   */
+/*                      DLL name of the node and stores the hash of the       */
+/*                      inputs taken before the build.                        */
+/*  Member of        :  CBuildProgram                                         */
+/******************************************************************************/
+BOOL CBuildProgram::bCompleteBuildJob(sBUILD_JOB& sJob, BOOL bDisplaySuccessful)
+{
+    BOOL bReturn = FALSE;
+    CString omFileName = sJob.m_psNodeInfo->m_omStrCFileName;
+    CString omLongFileName = omFileName;
+
+    // Remove all items in this string array before adding.
+    m_omStrArray.RemoveAll();
+    m_omStrArray.Add(" ");
+    m_omStrArray.Add(omFileName);
+    m_omStrSourceFilename = omFileName;
+
+    if (sJob.m_bUpToDate == true)
+    {
+        sJob.m_psNodeInfo->m_omStrDllName = sJob.m_omStrDllFile;
+        if(bDisplaySuccessful)
+        {
+            m_omStrArray.Add(sJob.m_omStrDllFile + " is up to date");
+            bAddString(m_omStrArray);
+        }
+        return TRUE;
+    }
+    if (sJob.m_bMakeStarted == FALSE)
+    {
+        // Add string to list box attached to output window after
+        // displaying it if not displayed already.
+        m_omStrArray.Append(sJob.m_omStrErrors);
+        bAddString(m_omStrArray);
+        return FALSE;
+    }
+
+    // Get the output or error message from the corresponding file
+    // and add it to CStringArray
+    CString omStrFilePath = omGetJobFile(sJob, "_error.txt");
+    bAddStrToArrayFromFile(omStrFilePath,m_omStrArray);
+    omStrFilePath = omGetJobFile(sJob, "_output.txt");
+    bAddStrToArrayFromFile(omStrFilePath,m_omStrArray);
+
+    CString omStrDLLFile = "";
+    //compiled properly
+    if(sJob.m_dwMakeResult == 0)
+    {
+        CString omStrFileNameInSDLLFile="";
+        CString omStrFileNameInLongFileName="";
+        CString omStrDLLFile   = "";
+        char acStrShortPath[1000];
+        dwConvertShortPathName(omFileName,acStrShortPath);
+        omFileName    = acStrShortPath;
+        omStrDLLFile  = omFileName.Left(omFileName.ReverseFind('.'));
+        omStrDLLFile += defDOT_DLL;
+        int nLength=omStrDLLFile.GetLength();
+        nLength-=omStrDLLFile.ReverseFind('\\');
+        nLength--;
+        omStrFileNameInSDLLFile=omStrDLLFile.
+                                Right(nLength);
+        int nLastDotPlace=omLongFileName.ReverseFind('.');
+        omLongFileName=omLongFileName.Left(nLastDotPlace);
+        omLongFileName+= defDOT_DLL;
+        nLength=omLongFileName.GetLength();
+        nLength-=omLongFileName.ReverseFind('\\');
+        nLength--;
+        omStrFileNameInLongFileName=omLongFileName.
+                                    Right(nLength);
+        if(omStrFileNameInLongFileName.
+                CompareNoCase(omStrFileNameInSDLLFile))
+        {
+            BOOL bCopyFileStatus=COPYFILE(omStrDLLFile,omLongFileName);
+            if(bCopyFileStatus!=FALSE)
+            {
+                DeleteFile(omStrDLLFile);
+            }
+        }
+        sJob.m_psNodeInfo->m_omStrDllName=omLongFileName;
+        omLongFileName +=" created successfully";
+
+        // Inputs hashed before the build. Without the dependency file of an
+        // earlier build there is none, the next build then has one.
+        if (sJob.m_un64Hash != 0)
+        {
+            char acHash[32];
+            sprintf_s(acHash, sizeof(acHash), "%016I64x", sJob.m_un64Hash);
+            std::ofstream omHashFile((LPCTSTR)omGetJobFile(sJob, ".bmhash"), std::ios::out | std::ios::trunc);
+            omHashFile << acHash << std::endl;
+        }
+        else
+        {
+            DeleteFile(omGetJobFile(sJob, ".bmhash"));
+        }
+
+        if(bDisplaySuccessful)
+        {
+            m_omStrArray.Add(omLongFileName);
+            bAddString(m_omStrArray);
+        }
+        bReturn = TRUE;
+    }
+    else
+    {
+        DeleteFile(omGetJobFile(sJob, ".bmhash"));
+        // Error in building DLL
+        omStrDLLFile  ="Error in creating ";
+        omStrDLLFile += omLongFileName.Left(omLongFileName.ReverseFind('.'));
+        omStrDLLFile += defDOT_DLL;
+        m_omStrArray.Add(omStrDLLFile);
+        bAddString(m_omStrArray);
+    }
+    return bReturn;
+}
 /******************************************************************************/
 /*  Function Name    :  bCreateMakeFile                                       */
 /*  Input(s)         :  Make file template and make file name with path       */
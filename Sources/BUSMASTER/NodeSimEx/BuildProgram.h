@@ -27,14 +27,34 @@
 #include"OutWnd.h"
 #include"SimSysNodeInfo.h"
 #include "GlobalObj.h"
+#include <vector>
 //#include "ExecuteManager.h"
 class CExecuteManager;
 
+// Build of one node. The make run of a job may take place on a worker thread,
+// everything touching the node info or the output window is done by the caller.
+struct sBUILD_JOB
+{
+    PSNODEINFO      m_psNodeInfo;
+    CString         m_omStrMakeCommand;     // mingw32-make command line
+    CString         m_omStrWorkDir;         // Folder of the node source, make runs there
+    CString         m_omStrFileTitle;       // Source file name without extension
+    CString         m_omStrDllFile;
+    bool            m_bClean;               // Clean target is run before the build
+    bool            m_bUpToDate;            // Sources and databases unchanged since the last build
+    UINT64          m_un64Hash;             // 0 if the dependencies of the node are not known
+    BOOL            m_bMakeStarted;         // FALSE if an output file or the process could not be opened
+    DWORD           m_dwMakeResult;
+    CStringArray    m_omStrErrors;          // Messages of a failed start
+};
+
 class CBuildProgram
 {
 public:
     // Build the DLL from the source file and call function to display the output based on bDisplaySuccessful flag.
     BOOL bBuildProgram(PSNODEINFO psNodeInfo,BOOL bLoadDLL, BOOL bDisplaySuccessful);
+    // Build the DLLs of several nodes, the make runs of the nodes are done in parallel.
+    BOOL bBuildPrograms(std::vector<PSNODEINFO>& ouNodes, BOOL bDisplaySuccessful);
     // Default contructor
     CBuildProgram(ETYPE_BUS eBus, CGlobalObj*, CExecuteManager* pExecuteMgr = nullptr, HMODULE hModuleHandle =nullptr);
     // Default destructor
@@ -61,6 +81,18 @@ private:
 
 
     BOOL UpdatedDbCheckSumInfo(PSNODEINFO psInfo);
+    // Create the make file and check the build cache
+    BOOL bPrepareBuildJob(PSNODEINFO psNodeInfo, sBUILD_JOB& sJob);
+    // Report the make run and set the DLL name
+    BOOL bCompleteBuildJob(sBUILD_JOB& sJob, BOOL bDisplaySuccessful);
+    // Hash of the node source, its make file, libraries and the headers it included last time
+    UINT64 un64GetBuildHash(sBUILD_JOB& sJob);
+    static CString omGetJobFile(const sBUILD_JOB& sJob, LPCTSTR pcSuffix);
+    // Runs clean and make of a job, called on the worker threads
+    static void vRunBuildJob(sBUILD_JOB* psJob, CRITICAL_SECTION* pCritSec);
+    static BOOL bStartMake(sBUILD_JOB* psJob, CString omStrCommand, BOOL bAppend,
+                           CRITICAL_SECTION* pCritSec, HANDLE& hProcess);
+    static DWORD WINAPI dwBuildThreadProc(LPVOID pParam);
 
     // Source file name to be built to DLL
     CString m_omStrSourceFilename;
@@ -62,10 +62,6 @@ extern UINT unTimerHandlerProc(LPVOID pParam);
 
 // Trace window API
 extern UINT gunWriteToTrace(CHAR* pcOutStrTrace);
-//thread function from utility file
-UINT unReadNodeMsgHandlerBuffer(LPVOID pParam);
-UINT unReadNodeMsgHandlerBufferLIN(LPVOID pParam);
-
 extern BOOL gbMsgTransmissionOnOff(BOOL bOnOff,HMODULE hModule);
 extern HMODULE ghGetNodeDllHandler(char* strNodeName);
 extern HWND g_hMainGUI;
@@ -137,16 +133,8 @@ CExecuteFunc::CExecuteFunc(ETYPE_BUS eBus, CGlobalObj* pGlobalObj, CONST CString
     m_psOnBusEventHandlers(nullptr),
     m_bDllLoaded(TRUE),
     m_bMsgTxOnFlag(TRUE),
-    m_unQMsgCount(0),
-    m_unQMsgCountLIN(0),
-
-    m_unReadQMsgIndex(0),
-    m_unWriteQMsgIndex(0),
-    m_unReadQMsgIndexLIN(0),
-    m_unWriteQMsgIndexLIN(0),
-
-    m_pomMsgHandlerThrd(nullptr),
-    m_pomMsgHandlerThrdLIN(nullptr),
+    m_pouMsgQueueCAN(nullptr),
+    m_pouMsgQueueLIN(nullptr),
 
     m_psFirstTimerStrList(nullptr),
     m_psLastTimerStrList(nullptr),
@@ -166,17 +154,6 @@ CExecuteFunc::CExecuteFunc(ETYPE_BUS eBus, CGlobalObj* pGlobalObj, CONST CString
     m_omStrArrayMsgIDandName.RemoveAll();
     m_omStrArrayMsgHandlers.RemoveAll();
     m_bIsStatWndCreated = FALSE;
-    //initialization of buffer
-    for(int nBufferCnt=0; nBufferCnt<defMAX_FUNC_MSG; nBufferCnt++)
-    {
-        memset(&m_asQMsg[m_unWriteQMsgIndex], 0, CANMSG_STRUCT_SIZE);
-    }
-
-    //initialization of buffer
-    for(int nBufferCnt=0; nBufferCnt<defMAX_FUNC_MSG; nBufferCnt++)
-    {
-        memset(&m_asQMsgLIN[m_unWriteQMsgIndexLIN], 0, LINMSG_STRUCT_SIZE);
-    }
     // All void pointer for memory allocated inside is initialised to nullptr
     for(UINT i=0; i<defEVENT_EXFUNC_TOTAL; i++)
     {
@@ -192,20 +169,19 @@ CExecuteFunc::CExecuteFunc(ETYPE_BUS eBus, CGlobalObj* pGlobalObj, CONST CString
     // Init CMap with the Hash table size.(any prime number)
     m_omMsgHandlerMapCAN.InitHashTable(def_MSG_MAP_HASH_SIZE);
     m_omMsgHandlerMap.InitHashTable(def_MSG_MAP_HASH_SIZE);
-    // Initialise critical section used in buffer access
+    // Initialise critical section used in handler lookup
+    InitializeCriticalSection(&m_CritSectForHandlerMap);
 
-    //creating read and execute message handler thread
+    //creating message handler queue, the shared handler pool executes it
     if ( m_eBus == CAN )
     {
-        m_pomMsgHandlerThrd=AfxBeginThread(unReadNodeMsgHandlerBuffer,this);
-        InitializeCriticalSection(&m_CritSectForFuncBuf);
-
+        m_pouMsgQueueCAN = new CNodeMsgQueue<STCAN_TIME_MSG, CExecuteFunc>(this,
+                &CExecuteFunc::vExecuteOnMessageHandlerCAN, defMAX_FUNC_MSG);
     }
     if ( m_eBus == LIN )
     {
-        m_pomMsgHandlerThrdLIN=AfxBeginThread(unReadNodeMsgHandlerBufferLIN,this);
-        InitializeCriticalSection(&m_CritSectForFuncBufLIN);
-
+        m_pouMsgQueueLIN = new CNodeMsgQueue<STLIN_TIME_MSG, CExecuteFunc>(this,
+                &CExecuteFunc::vExecuteOnMessageHandlerLIN, defMAX_FUNC_MSG);
     }
 }
 
@@ -240,6 +216,17 @@ CExecuteFunc::CExecuteFunc(ETYPE_BUS eBus, CGlobalObj* pGlobalObj, CONST CString
 /******************************************************************************/
 CExecuteFunc::~CExecuteFunc()
 {
+    // Wait for running message handlers before the handler data goes
+    if (m_pouMsgQueueCAN != nullptr)
+    {
+        delete m_pouMsgQueueCAN;
+        m_pouMsgQueueCAN = nullptr;
+    }
+    if (m_pouMsgQueueLIN != nullptr)
+    {
+        delete m_pouMsgQueueLIN;
+        m_pouMsgQueueLIN = nullptr;
+    }
     // Delete key handlers array of structure.
     if(m_psOnKeyHandlers!=nullptr)
     {
@@ -301,15 +288,7 @@ CExecuteFunc::~CExecuteFunc()
 
 
     // Free Cirical Section Resource
-    if (m_eBus == CAN)
-    {
-        DeleteCriticalSection(&m_CritSectForFuncBuf);
-    }
-
-    if (m_eBus == LIN)
-    {
-        DeleteCriticalSection(&m_CritSectForFuncBufLIN);
-    }
+    DeleteCriticalSection(&m_CritSectForHandlerMap);
 }
 
 BOOL CExecuteFunc::vInitBusSpecificMsgStruct(CStringArray& omErrorArray)
@@ -458,22 +437,6 @@ void CExecuteFunc::vExecuteOnPGNHandler(void* pRxMsg)
     if(sMsgData.m_pFMsgHandler != nullptr)
     {
         m_bStopMsgHandlers = FALSE;
-        // Check for Message Type Big or Little Endian
-        // and reverse data bytes if it is not in intel format
-        if( sMsgData.nMsgFormat != -1 && sMsgData.nMsgFormat != eEndianess::eIntel)
-        {
-            register BYTE byTmp;
-            register BYTE* pbyMsgData = psJ1939Msg->m_pbyData;
-            register UINT unLimit = sMsgData.unDLC / 2;
-
-            for ( register UINT nIndex = 0; nIndex < unLimit; nIndex++)
-            {
-                register UINT unTempIndex = sMsgData.unDLC - 1 - nIndex;
-                byTmp = pbyMsgData[nIndex];
-                pbyMsgData[nIndex] = pbyMsgData[unTempIndex];
-                pbyMsgData[unTempIndex] = byTmp;
-            }
-        }
         // Catch user program errors here
         try
         {
@@ -486,6 +449,23 @@ void CExecuteFunc::vExecuteOnPGNHandler(void* pRxMsg)
             objMsg.timeStamp = psJ1939Msg->m_sMsgProperties.m_un64TimeStamp;
 
 			memcpy(objMsg.data, psJ1939Msg->m_pbyData, objMsg.dlc);
+            // Check for Message Type Big or Little Endian and reverse data
+            // bytes if it is not in intel format. The copy is reversed, the
+            // message data is shared with the other DIL clients.
+            if( sMsgData.nMsgFormat != -1 && sMsgData.nMsgFormat != eEndianess::eIntel)
+            {
+                register BYTE byTmp;
+                register BYTE* pbyMsgData = objMsg.data;
+                register UINT unLimit = sMsgData.unDLC / 2;
+
+                for ( register UINT nIndex = 0; nIndex < unLimit; nIndex++)
+                {
+                    register UINT unTempIndex = sMsgData.unDLC - 1 - nIndex;
+                    byTmp = pbyMsgData[nIndex];
+                    pbyMsgData[nIndex] = pbyMsgData[unTempIndex];
+                    pbyMsgData[unTempIndex] = byTmp;
+                }
+            }
             sMsgData.m_pFMsgHandler(objMsg);
         }
         catch(...)
@@ -522,6 +502,8 @@ void CExecuteFunc::vExecuteOnMessageHandlerCAN(STCAN_TIME_MSG sRxMsgInfo)
     // Search for msg name and msg ID handler matching the message ID.
     UINT unMsgID = sExecuteMsgHandler.m_sRxMsg.m_unMsgID;
 
+    // The map is filled on first use, lanes of other IDs may do the same
+    EnterCriticalSection(&m_CritSectForHandlerMap);
     // Check for Id in Name/Id specific Handler
     SMSGHANDLERDATA_CAN sMsgData = m_omMsgHandlerMapCAN[unMsgID];
 
@@ -559,6 +541,7 @@ void CExecuteFunc::vExecuteOnMessageHandlerCAN(STCAN_TIME_MSG sRxMsgInfo)
         // This will avoide search for the same message ID next time
         m_omMsgHandlerMapCAN[unMsgID] = sMsgData;
     }
+    LeaveCriticalSection(&m_CritSectForHandlerMap);
     // If the handler found then proceed further
     if(sMsgData.m_pFMsgHandler != nullptr)
     {
@@ -618,6 +601,8 @@ void CExecuteFunc::vExecuteOnMessageHandlerLIN(STLIN_TIME_MSG sRxMsgInfo)
     // Search for msg name and msg ID handler matching the message ID.
     UCHAR unMsgID = sExecuteMsgHandler.m_sRxMsg.m_ucMsgID;
 
+    // The map is filled on first use, lanes of other IDs may do the same
+    EnterCriticalSection(&m_CritSectForHandlerMap);
     // Check for Id in Name/Id specific Handler
     SMSGHANDLERDATA_LIN sMsgData = m_omMsgHandlerMapLIN[unMsgID];
 
@@ -655,6 +640,7 @@ void CExecuteFunc::vExecuteOnMessageHandlerLIN(STLIN_TIME_MSG sRxMsgInfo)
         // This will avoide search for the same message ID next time
         m_omMsgHandlerMapLIN[unMsgID] = sMsgData;
     }
+    LeaveCriticalSection(&m_CritSectForHandlerMap);
     // If the handler found then proceed further
     if(sMsgData.m_pFMsgHandler != nullptr)
     {
@@ -1622,6 +1608,7 @@ BOOL CExecuteFunc::bInitTimerStruct(CStringArray& omErrorArray)
                             psTimerHandlerList->sTimerHandler.bTimerType=FALSE;
                             psTimerHandlerList->sTimerHandler.unTimerID=0;
                             psTimerHandlerList->sTimerHandler.pomThreadHandle=nullptr;
+                            psTimerHandlerList->sTimerHandler.pouHeldClock=nullptr;
                             psTimerHandlerList->sTimerHandler.unCurrTime=0;
                             psTimerHandlerList->psNextTimer=nullptr;
 
@@ -3230,7 +3217,15 @@ void CExecuteFunc::vSetNodeInfo(PSNODEINFO psNodeInfo)
     m_sNodeInfo.m_byPrefAddress         = psNodeInfo->m_byPrefAddress;
     m_sNodeInfo.m_eBus                  = psNodeInfo->m_eBus;
     m_sNodeInfo.m_unEcuName             = psNodeInfo->m_unEcuName;
-
+    m_sNodeInfo.m_bParallelMsgHandlers  = psNodeInfo->m_bParallelMsgHandlers;
+    if (m_pouMsgQueueCAN != nullptr)
+    {
+        m_pouMsgQueueCAN->vSetPerIdLanes(m_sNodeInfo.m_bParallelMsgHandlers == TRUE);
+    }
+    if (m_pouMsgQueueLIN != nullptr)
+    {
+        m_pouMsgQueueLIN->vSetPerIdLanes(m_sNodeInfo.m_bParallelMsgHandlers == TRUE);
+    }
 }
 void CExecuteFunc::vGetNodeInfo(sNODEINFO& sNodeInfo) const
 {
@@ -3241,6 +3236,7 @@ void CExecuteFunc::vGetNodeInfo(sNODEINFO& sNodeInfo) const
     sNodeInfo.m_byPrefAddress         = m_sNodeInfo.m_byPrefAddress;
     sNodeInfo.m_eBus                  = m_sNodeInfo.m_eBus;
     sNodeInfo.m_unEcuName             = m_sNodeInfo.m_unEcuName;
+    sNodeInfo.m_bParallelMsgHandlers  = m_sNodeInfo.m_bParallelMsgHandlers;
 }
 
 DWORD CExecuteFunc::dwGetNodeClientId()
@@ -3268,47 +3264,18 @@ void CExecuteFunc::vDestroyUtilityThreads(UINT unMaxWaitTime, BYTE byThreadCode)
 
     bySelectThread  =
         static_cast<UCHAR>( byThreadCode & BIT_MSG_HANDLER_THREAD );
-    // if key handler thread exists
-    if ( bySelectThread != 0 && m_pomMsgHandlerThrd != nullptr &&
-            (m_pomMsgHandlerThrd->m_hThread != nullptr ))
+    // Drop the queued messages and wait for the running handlers. A handler
+    // that does not return in time has its pool worker replaced.
+    if ( bySelectThread != 0 )
     {
-        // Set the flag to exit from thread.
         m_bStopMsgHandlers = TRUE;
-        // Wait for thread to exit.
-        dwResult = WaitForSingleObject(m_aomState[defMSG_HANDLER_THREAD],
-                                       unMaxWaitTime);
-        // If time out, come to begining of buffer there
-        // will not be read or write operation,thread will be in
-        //waiting state
-        if( dwResult == WAIT_TIMEOUT )
+        if ( m_pouMsgQueueCAN != nullptr )
         {
-            m_unReadQMsgIndex=0;
-            m_unWriteQMsgIndex=0;
-            TerminateThread(m_pomMsgHandlerThrd->m_hThread,0);
-            //delete m_pomMsgHandlerThrd ;
-            m_pomMsgHandlerThrd = nullptr;
+            m_pouMsgQueueCAN->bStop(unMaxWaitTime);
         }
-    }
-
-    // if key handler thread exists
-    if ( bySelectThread != 0 && m_pomMsgHandlerThrdLIN != nullptr &&
-            (m_pomMsgHandlerThrdLIN->m_hThread != nullptr ))
-    {
-        // Set the flag to exit from thread.
-        m_bStopMsgHandlers = TRUE;
-        // Wait for thread to exit.
-        dwResult = WaitForSingleObject(m_aomState[defMSG_HANDLER_THREAD],
-                                       unMaxWaitTime);
-        // If time out, come to begining of buffer there
-        // will not be read or write operation,thread will be in
-        //waiting state
-        if( dwResult == WAIT_TIMEOUT )
+        if ( m_pouMsgQueueLIN != nullptr )
         {
-            m_unReadQMsgIndexLIN=0;
-            m_unWriteQMsgIndexLIN=0;
-            TerminateThread(m_pomMsgHandlerThrdLIN->m_hThread,0);
-            //delete m_pomMsgHandlerThrd ;
-            m_pomMsgHandlerThrdLIN = nullptr;
+            m_pouMsgQueueLIN->bStop(unMaxWaitTime);
         }
     }
 
@@ -3446,10 +3413,6 @@ BOOL CExecuteFunc::bUnloadDll()
     // Set the flag to exit from thread.
     m_bDllLoaded = FALSE;
 
-
-    m_omReadFromQEvent.SetEvent();
-    m_omReadFromQEventLIN.SetEvent();
-
     vSetReadEvents();
 
     BYTE byThread = BIT_MSG_HANDLER_THREAD | BIT_KEY_HANDLER_THREAD | BIT_ERROR_HANDLER_THREAD | BIT_DLL_LOAD_HANDLER_THREAD | BIT_DLL_UNLOAD_HANDLER_THREAD;
@@ -3503,40 +3466,26 @@ void CExecuteFunc::vSetDllHandle(HMODULE hModuleHandle)
     Input(s)         :  sTCANDATA / message structure
     Output           :
     Functionality    :  This function write into message handler buffer associated to
-                        each object.
+                        each object. The handler pool executes the handler;
+                        if the buffer is full the message is dropped and counted.
     Member of        :  CExecuteFunc
     Author(s)        :  Anish kumar
     Date Created     :  16.12.05
 ****************************************************************************************/
 void CExecuteFunc::vWriteInQMsg(STCAN_TIME_MSG sRxMsgInfo)
 {
-    if(m_bStopMsgHandlers==FALSE)
+    if(m_bStopMsgHandlers==FALSE && m_pouMsgQueueCAN != nullptr)
     {
-        if(m_unQMsgCount<1000)
-        {
-            EnterCriticalSection(&m_CritSectForFuncBuf);
-            CBaseDIL_CAN* pBaseDIL_CAN = CGlobalObj::GetICANDIL();
-            if(pBaseDIL_CAN)
-            {
-                SYSTEMTIME CurrSysTime;
-                UINT64 unAbsTime;
-                LARGE_INTEGER QueryTickCount;
-                pBaseDIL_CAN->DILC_GetTimeModeMapping(CurrSysTime, unAbsTime, QueryTickCount);
-                sRxMsgInfo.m_ulTimeStamp -= (ULONG)unAbsTime;
-            }
-            m_asQMsg[m_unWriteQMsgIndex] = sRxMsgInfo;
-            LeaveCriticalSection(&m_CritSectForFuncBuf);
-            m_unQMsgCount++;
-            //for circular buffer
-            m_unWriteQMsgIndex=(m_unWriteQMsgIndex+1)%defMAX_FUNC_MSG;
-            //set event for read thread
-            m_omReadFromQEvent.SetEvent();
-        }
-        else
+        CBaseDIL_CAN* pBaseDIL_CAN = CGlobalObj::GetICANDIL();
+        if(pBaseDIL_CAN)
         {
-            //COMMENTED BY AK********
-            //::PostMessage(g_hMainGUI,WM_ERROR,ERROR_DLLMSG_BUFF_OVERFLOW,0);
+            SYSTEMTIME CurrSysTime;
+            UINT64 unAbsTime;
+            LARGE_INTEGER QueryTickCount;
+            pBaseDIL_CAN->DILC_GetTimeModeMapping(CurrSysTime, unAbsTime, QueryTickCount);
+            sRxMsgInfo.m_ulTimeStamp -= (ULONG)unAbsTime;
         }
+        m_pouMsgQueueCAN->bAddMsg(sRxMsgInfo);
     }
 }
 
@@ -3546,110 +3495,56 @@ void CExecuteFunc::vWriteInQMsg(STCAN_TIME_MSG sRxMsgInfo)
     Input(s)         :  sTCANDATA / message structure
     Output           :
     Functionality    :  This function write into message handler buffer associated to
-                        each object.
+                        each object. The handler pool executes the handler;
+                        if the buffer is full the message is dropped and counted.
     Member of        :  CExecuteFunc
     Author(s)        :  Anish kumar
     Date Created     :  16.12.05
 ****************************************************************************************/
 void CExecuteFunc::vWriteInQMsgLIN(STLIN_TIME_MSG sRxMsgInfo)
 {
-    if(m_bStopMsgHandlers==FALSE)
+    if(m_bStopMsgHandlers==FALSE && m_pouMsgQueueLIN != nullptr)
     {
-        if(m_unQMsgCountLIN<1000)
-        {
-            EnterCriticalSection(&m_CritSectForFuncBufLIN);
-            CBaseDIL_LIN* pBaseDIL_LIN = CGlobalObj::GetILINDIL();
-            if(pBaseDIL_LIN)
-            {
-                SYSTEMTIME CurrSysTime;
-                UINT64 unAbsTime;
-                LARGE_INTEGER QueryTickCount;
-                pBaseDIL_LIN->DILL_GetTimeModeMapping(CurrSysTime, unAbsTime, QueryTickCount);
-                sRxMsgInfo.m_ulTimeStamp -= (ULONG)unAbsTime;
-            }
-            m_asQMsgLIN[m_unWriteQMsgIndexLIN] = sRxMsgInfo;
-            LeaveCriticalSection(&m_CritSectForFuncBufLIN);
-            m_unQMsgCountLIN++;
-            //for circular buffer
-            m_unWriteQMsgIndexLIN=(m_unWriteQMsgIndexLIN+1)%defMAX_FUNC_MSG;
-            //set event for read thread
-            m_omReadFromQEventLIN.SetEvent();
-        }
-        else
+        CBaseDIL_LIN* pBaseDIL_LIN = CGlobalObj::GetILINDIL();
+        if(pBaseDIL_LIN)
         {
-            //COMMENTED BY AK********
-            //::PostMessage(g_hMainGUI,WM_ERROR,ERROR_DLLMSG_BUFF_OVERFLOW,0);
+            SYSTEMTIME CurrSysTime;
+            UINT64 unAbsTime;
+            LARGE_INTEGER QueryTickCount;
+            pBaseDIL_LIN->DILL_GetTimeModeMapping(CurrSysTime, unAbsTime, QueryTickCount);
+            sRxMsgInfo.m_ulTimeStamp -= (ULONG)unAbsTime;
         }
+        m_pouMsgQueueLIN->bAddMsg(sRxMsgInfo);
     }
 }
 
 /****************************************************************************************
-    Function Name    :  sReadFromQMsg
-    Input(s)         :
-    Output           :  message structure
-    Functionality    :  This function read fron message queue
-    Member of        :  CExecuteFunc
-    Author(s)        :  Anish kumar
-    Date Created     :  16.12.05
-****************************************************************************************/
-STLIN_TIME_MSG CExecuteFunc::sReadFromQMsgLIN()
-{
-    STLIN_TIME_MSG sRxMsgInfo;
-    EnterCriticalSection(&m_CritSectForFuncBufLIN);
-    sRxMsgInfo = m_asQMsgLIN[m_unReadQMsgIndexLIN];
-    LeaveCriticalSection(&m_CritSectForFuncBufLIN);
-    m_unQMsgCountLIN--;
-    m_unReadQMsgIndexLIN=(m_unReadQMsgIndexLIN+1)%defMAX_FUNC_MSG;
-    return sRxMsgInfo;
-}
-
-/****************************************************************************************
-    Function Name    :  sReadFromQMsg
-    Input(s)         :
-    Output           :  message structure
-    Functionality    :  This function read fron message queue
-    Member of        :  CExecuteFunc
-    Author(s)        :  Anish kumar
-    Date Created     :  16.12.05
-****************************************************************************************/
-STCAN_TIME_MSG CExecuteFunc::sReadFromQMsg()
-{
-    STCAN_TIME_MSG sRxMsgInfo;
-    EnterCriticalSection(&m_CritSectForFuncBuf);
-    sRxMsgInfo = m_asQMsg[m_unReadQMsgIndex];
-    LeaveCriticalSection(&m_CritSectForFuncBuf);
-    m_unQMsgCount--;
-    m_unReadQMsgIndex=(m_unReadQMsgIndex+1)%defMAX_FUNC_MSG;
-    return sRxMsgInfo;
-}
-
-/****************************************************************************************
-    Function Name    :  unGetBufferMsgCnt
-    Input(s)         :
-    Output           :  no. of messages in message queue/buffer
-    Functionality    :  Returns no. of messages in message queue/buffer
-    Member of        :  CExecuteFunc
-    Author(s)        :  Anish kumar
-    Date Created     :  16.12.05
-****************************************************************************************/
-UINT CExecuteFunc::unGetBufferMsgCnt()
-{
-    return m_unQMsgCount;
-}
-
-
-/****************************************************************************************
-    Function Name    :  unGetBufferMsgCntLIN
-    Input(s)         :
-    Output           :  no. of messages in message queue/buffer
-    Functionality    :  Returns no. of messages in message queue/buffer
+    Function Name    :  vGetMsgHandlerStats
+    Input(s)         :  sTotal   - Counters of all message handlers of the node
+                        pomPerId - Counters per message ID, may be nullptr
+    Output           :
+    Functionality    :  Returns executed and dropped messages, queue depth,
+                        latency from queueing to handler start and handler
+                        run time of the message handlers.
     Member of        :  CExecuteFunc
-    Author(s)        :  Anish kumar
-    Date Created     :  16.12.05
 ****************************************************************************************/
-UINT CExecuteFunc::unGetBufferMsgCntLIN()
+void CExecuteFunc::vGetMsgHandlerStats(SMSG_HANDLER_STATS& sTotal,
+                                       std::map<UINT, SMSG_HANDLER_STATS>* pomPerId)
 {
-    return m_unQMsgCountLIN;
+    SMSG_HANDLER_STATS sEmpty = {0};
+    sTotal = sEmpty;
+    if (pomPerId != nullptr)
+    {
+        pomPerId->clear();
+    }
+    if (m_pouMsgQueueCAN != nullptr)
+    {
+        m_pouMsgQueueCAN->vGetStats(sTotal, pomPerId);
+    }
+    if (m_pouMsgQueueLIN != nullptr)
+    {
+        m_pouMsgQueueLIN->vGetStats(sTotal, pomPerId);
+    }
 }
 
 void CExecuteFunc::vInitialiseInterfaceFnPtrs(HMODULE hLib)
@@ -3874,6 +3769,12 @@ void CExecuteFunc::vInitialiseInterfaceFnPtrsCAN(HMODULE hModuleHandle)
     {
         (*DllFuncProc)((APPFUNCPROC)gunSendMsg_CAN);
     }
+    DLLFUNCPROCMULTI DllFuncMultiProc = (DLLFUNCPROCMULTI) GetProcAddress(
+                                            hModuleHandle, (char*) NAME_FUNC_USERDLL_MULTI);
+    if (DllFuncMultiProc != nullptr)
+    {
+        (*DllFuncMultiProc)(gunSendMsgs_CAN);
+    }
 
     DLLLOGPROC DllLogEnableProc = (DLLLOGPROC)
                                   GetProcAddress(hModuleHandle,
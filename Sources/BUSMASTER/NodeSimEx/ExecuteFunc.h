@@ -30,6 +30,17 @@
 #include "ExecuteManager.h"
 //#include "DataTypes\Cluster.h"
 #include "ICluster.h"
+#include "HandlerPool.h"
+
+// Message handler queues keep one lane per message ID in parallel mode
+inline UINT unGetHandlerKey(const STCAN_TIME_MSG& sMsg)
+{
+    return sMsg.m_unMsgID;
+}
+inline UINT unGetHandlerKey(const STLIN_TIME_MSG& sMsg)
+{
+    return sMsg.m_ucMsgID;
+}
 
 class CExecuteFunc
 {
@@ -78,22 +89,12 @@ public:
     virtual void vDestroyUtilityThreads(UINT unMaxWaitTime, BYTE byThreadCode);
     STHREADINFO m_asUtilThread[defEVENT_EXFUNC_TOTAL];
     CEvent  m_aomState[defEVENT_EXFUNC_TOTAL];
-    //associated to handler thread
+    //queue the message for the handler pool
     void vWriteInQMsg(STCAN_TIME_MSG sRxMsgInfo);
     void vWriteInQMsgLIN(STLIN_TIME_MSG sRxMsgInfo);
-
-    STLIN_TIME_MSG sReadFromQMsgLIN();
-
-    STCAN_TIME_MSG sReadFromQMsg();
-    CEvent m_omReadFromQEvent;       //event set after writing into buffer,for reading
-    CEvent m_omReadFromQEventLIN;       //event set after writing into buffer,for reading
-
-
-    CRITICAL_SECTION m_CritSectForFuncBuf; //critical section for buffer
-    CRITICAL_SECTION m_CritSectForFuncBufLIN; //critical section for buffer
-
-    UINT unGetBufferMsgCnt(); //called from read buffer thread
-    UINT unGetBufferMsgCntLIN();
+    //latency and queue depth of the message handlers, pomPerId may be nullptr
+    void vGetMsgHandlerStats(SMSG_HANDLER_STATS& sTotal,
+                             std::map<UINT, SMSG_HANDLER_STATS>* pomPerId = nullptr);
 
     BOOL bIsDllLoaded() ;
     //made public to make it easily accessed by read msg handler thread
@@ -240,24 +241,13 @@ private:
 
 
 
-    UINT m_unQMsgCount;
-    UINT m_unQMsgCountLIN;
-
-    STCAN_TIME_MSG m_asQMsg[ defMAX_FUNC_MSG ];     //for message handler msg array
-    STLIN_TIME_MSG m_asQMsgLIN[ defMAX_FUNC_MSG ];     //for message handler msg array
-
-    UINT m_unReadQMsgIndex;         // index from which the message to be read
-    UINT m_unWriteQMsgIndex;        //index at which message is to be written
-
-
-    UINT m_unReadQMsgIndexLIN;         // index from which the message to be read
-    UINT m_unWriteQMsgIndexLIN;        //index at which message is to be written
-
-
+    //message handler queues, drained by the handler pool
+    CNodeMsgQueue<STCAN_TIME_MSG, CExecuteFunc>* m_pouMsgQueueCAN;
+    CNodeMsgQueue<STLIN_TIME_MSG, CExecuteFunc>* m_pouMsgQueueLIN;
+    //handlers of several message IDs may run at once
+    CRITICAL_SECTION m_CritSectForHandlerMap;
 
     BOOL m_bDllLoaded;
-    CWinThread* m_pomMsgHandlerThrd;
-    CWinThread* m_pomMsgHandlerThrdLIN;
 
     PSTIMERHANDLERLIST m_psFirstTimerStrList;
     PSTIMERHANDLERLIST m_psLastTimerStrList;
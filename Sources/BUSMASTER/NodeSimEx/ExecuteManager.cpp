@@ -28,6 +28,7 @@
 #include "Export_UserDllCAN.h"
 #include "SimSysManager.h"
 #include "GlobalObj.h"
+#include "IClockService.h"
 #include <array>
 
 #ifdef _DEBUG
@@ -435,6 +436,45 @@ void CExecuteManager::vManageOnMessageHandlerLIN(PSTLIN_TIME_MSG sRxMsgInfo, DWO
     LeaveCriticalSection(&m_CritSectPsNodeObject);
 }
 
+/***************************************************************************************
+    Function Name    :  vGetMsgHandlerStats
+    Input(s)         :  sTotal - Counters of the message handlers of all nodes
+    Output           :
+    Functionality    :  Adds up the handler counters of the nodes. Depths and
+                        counts are summed, maxima are the largest of any node
+                        and means are weighted by the executed messages.
+    Member of        :  CExecuteManager
+***************************************************************************************/
+void CExecuteManager::vGetMsgHandlerStats(SMSG_HANDLER_STATS& sTotal)
+{
+    SMSG_HANDLER_STATS sEmpty = {0};
+    sTotal = sEmpty;
+    UINT64 un64LatencySumUs = 0;
+    UINT64 un64RunSumUs = 0;
+    EnterCriticalSection(&m_CritSectPsNodeObject);
+    PSNODEOBJECT psTempNodeObject = m_psFirstNodeObject;
+    while(psTempNodeObject != nullptr)
+    {
+        SMSG_HANDLER_STATS sNode;
+        psTempNodeObject->m_psExecuteFunc->vGetMsgHandlerStats(sNode, nullptr);
+        sTotal.m_un64Executed += sNode.m_un64Executed;
+        sTotal.m_un64Dropped += sNode.m_un64Dropped;
+        sTotal.m_unDepth += sNode.m_unDepth;
+        sTotal.m_unMaxDepth = max(sTotal.m_unMaxDepth, sNode.m_unMaxDepth);
+        sTotal.m_un64MaxLatencyUs = max(sTotal.m_un64MaxLatencyUs, sNode.m_un64MaxLatencyUs);
+        sTotal.m_un64MaxRunUs = max(sTotal.m_un64MaxRunUs, sNode.m_un64MaxRunUs);
+        un64LatencySumUs += sNode.m_un64MeanLatencyUs * sNode.m_un64Executed;
+        un64RunSumUs += sNode.m_un64MeanRunUs * sNode.m_un64Executed;
+        psTempNodeObject = psTempNodeObject->m_psNextNode;
+    }
+    LeaveCriticalSection(&m_CritSectPsNodeObject);
+    if (sTotal.m_un64Executed > 0)
+    {
+        sTotal.m_un64MeanLatencyUs = un64LatencySumUs / sTotal.m_un64Executed;
+        sTotal.m_un64MeanRunUs = un64RunSumUs / sTotal.m_un64Executed;
+    }
+}
+
 /**************************************************************************************
     Function Name    :  vManageOnMessageHandler
     Input(s)         :  Error Message structure and code
@@ -764,6 +804,39 @@ BOOL CExecuteManager::bExecuteDllBuild(PSNODEINFO psNodeInfo, BOOL bDisplaySucce
     return bReturn;
 }
 
+/***************************************************************************************
+    Function Name    :  nExecuteDllBuildAll
+    Input(s)         :  nodes to be built, array for the files that failed
+    Output           :  int, number of failed nodes
+    Functionality    :  compile the files of the nodes, the make runs of the nodes
+                        are done in parallel
+    Member of        :  CExecuteManager
+***************************************************************************************/
+int CExecuteManager::nExecuteDllBuildAll(std::vector<PSNODEINFO>& ouNodes, CStringArray& omStrFailedFiles)
+{
+    int nFailure = 0;
+    if(ouNodes.empty() == false)
+    {
+        if(m_pouBuildProgram==nullptr)
+        {
+            m_pouBuildProgram = new CBuildProgram(m_eBus, m_pGlobalObj, this);
+        }
+        if(m_pouBuildProgram!=nullptr)
+        {
+            m_pouBuildProgram->bBuildPrograms(ouNodes, FALSE);
+        }
+        for(auto itrNode = ouNodes.begin(); itrNode != ouNodes.end(); ++itrNode)
+        {
+            if((*itrNode)->m_eNodeState != NODE_BUILD_SUCCESS)
+            {
+                nFailure++;
+                omStrFailedFiles.Add((*itrNode)->m_omStrCFileName);
+            }
+        }
+    }
+    return nFailure;
+}
+
 /***************************************************************************************
     Function Name    :  bExecuteDllUnload
     Input(s)         :  nodeinfo structure list from UI
@@ -1375,12 +1448,14 @@ void CExecuteManager::vStartTimer()
     Function Name    :  vManageTimerExecution
     Input(s)         :
     Output           :
-    Functionality    :  Manage execution of timers
+    Functionality    :  Manage execution of timers. unElapsed milliseconds have
+                        passed since the last call. With pouHoldClock every
+                        started handler holds the virtual time until it returns.
     Member of        :  CExecuteManager
     Author(s)        :  Anish kumar
     Date Created     :  04.05.06
 ***************************************************************************************/
-void CExecuteManager::vManageTimerExecution()
+void CExecuteManager::vManageTimerExecution(UINT unElapsed, IClockService* pouHoldClock)
 {
     PSNODEOBJECT psTempNode = m_psFirstNodeObject;
     while( psTempNode != nullptr )
@@ -1391,13 +1466,22 @@ void CExecuteManager::vManageTimerExecution()
         {
             if( psNodeTimerList->sTimerHandler.bTimerSelected )
             {
-                ++( psNodeTimerList->sTimerHandler.unCurrTime );
+                psNodeTimerList->sTimerHandler.unCurrTime += unElapsed;
 
                 if( (psNodeTimerList->sTimerHandler.unCurrTime %
                         psNodeTimerList->sTimerHandler.unTimerVal==0) &&
                         psNodeTimerList->sTimerHandler.hDllHandle)
                 {
-
+                    if( pouHoldClock != nullptr )
+                    {
+                        pouHoldClock->vHold();
+                        //A hold not yet released by the handler covers this run too
+                        if( InterlockedCompareExchangePointer( (PVOID*)&psNodeTimerList->sTimerHandler.pouHeldClock,
+                                                               pouHoldClock, nullptr ) != nullptr )
+                        {
+                            pouHoldClock->vRelease();
+                        }
+                    }
                     psNodeTimerList->sTimerHandler.omWaitEvent.SetEvent();
 
                 }
@@ -1409,6 +1493,43 @@ void CExecuteManager::vManageTimerExecution()
     }
 }
 
+/***************************************************************************************
+    Function Name    :  unGetTicksToNextTimer
+    Input(s)         :
+    Output           :  UINT
+    Functionality    :  Milliseconds until the next selected timer is due,
+                        0 if no timer is running
+    Member of        :  CExecuteManager
+***************************************************************************************/
+UINT CExecuteManager::unGetTicksToNextTimer()
+{
+    UINT unTicks = 0;
+    PSNODEOBJECT psTempNode = m_psFirstNodeObject;
+    while( psTempNode != nullptr )
+    {
+        PSTIMERHANDLERLIST psNodeTimerList = psTempNode->
+                                             m_psExecuteFunc->psGetTimerListPtr();
+        while( psNodeTimerList != nullptr )
+        {
+            if( psNodeTimerList->sTimerHandler.bTimerSelected &&
+                    psNodeTimerList->sTimerHandler.hDllHandle &&
+                    (psNodeTimerList->sTimerHandler.unTimerVal > 0) )
+            {
+                UINT unLeft = psNodeTimerList->sTimerHandler.unTimerVal -
+                              (psNodeTimerList->sTimerHandler.unCurrTime %
+                               psNodeTimerList->sTimerHandler.unTimerVal);
+                if( (unTicks == 0) || (unLeft < unTicks) )
+                {
+                    unTicks = unLeft;
+                }
+            }
+            psNodeTimerList = psNodeTimerList->psNextTimer;
+        }
+        psTempNode=psTempNode->m_psNextNode;
+    }
+    return unTicks;
+}
+
 /***************************************************************************************
     Function Name    :  bDLLBuildAll
     Input(s)         :
@@ -1423,7 +1544,6 @@ void CExecuteManager::vManageTimerExecution()
 BOOL CExecuteManager::bDLLBuildAll()
 {
     BOOL bReturn = FALSE;
-    BOOL bSuccess = FALSE;
     int nFailure = 0;
     CSimSysNodeInfo* pSimSysNodeInfo = m_pSimSysMgr->pomGetSimSysNodeInfo();
     //CSimSysManager::ouGetSimSysManager(m_eBus, m_pGlobalObj).pomGetSimSysNodeInfo();
@@ -1433,6 +1553,7 @@ BOOL CExecuteManager::bDLLBuildAll()
     omStrBuildFiles.RemoveAll();
     vClearOutputWnd();
 
+    std::vector<PSNODEINFO> ouBuildNodes;
     PSNODELIST pTempNode = pSimSysNodeInfo->m_psNodesList;
     while(pTempNode != nullptr)
     {
@@ -1451,17 +1572,11 @@ BOOL CExecuteManager::bDLLBuildAll()
                 pTempNode->m_sNodeInfo->m_bIsNodeEnabled==TRUE)
         {
             //Build all modified and Enabled nodes
-            bSuccess =
-                bExecuteDllBuild((pTempNode->m_sNodeInfo),FALSE);
-            if(!bSuccess)
-            {
-                nFailure++;
-                omStrBuildFiles.Add(pTempNode->m_sNodeInfo->m_omStrCFileName);
-            }
-
+            ouBuildNodes.push_back(pTempNode->m_sNodeInfo);
         }
         pTempNode = pTempNode->m_psNextNode;
     }
+    nFailure = nExecuteDllBuildAll(ouBuildNodes, omStrBuildFiles);
 
     if((nFailure == 0) || (nFailure != nNodeCount))
     {
@@ -1677,6 +1792,7 @@ BOOL CExecuteManager::bDLLBuildLoadAllEnabled()
     omStrBuildFiles.RemoveAll();
     PSNODELIST pTempNode = pSimSysNodeInfo->m_psNodesList;
 
+    std::vector<PSNODEINFO> ouBuildNodes;
     while(pTempNode != nullptr)
     {
         if(pTempNode->m_sNodeInfo->m_eNodeFileType == NODE_FILE_C_CPP &&
@@ -1684,16 +1800,11 @@ BOOL CExecuteManager::bDLLBuildLoadAllEnabled()
                 && pTempNode->m_sNodeInfo->m_eNodeState != NODE_BUILD_SUCCESS)
         {
             //Build all modified and Enabled nodes
-            bSuccess =
-                bExecuteDllBuild((pTempNode->m_sNodeInfo),FALSE);
-            if(!bSuccess)
-            {
-                nFailure++;
-                omStrBuildFiles.Add(pTempNode->m_sNodeInfo->m_omStrCFileName);
-            }
+            ouBuildNodes.push_back(pTempNode->m_sNodeInfo);
         }
         pTempNode = pTempNode->m_psNextNode;
     }
+    nFailure = nExecuteDllBuildAll(ouBuildNodes, omStrBuildFiles);
 
 
     if(nFailure==0)
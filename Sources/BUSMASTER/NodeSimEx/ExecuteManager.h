@@ -58,11 +58,13 @@ public:
     void vExSetNodeInfo(const CString NodeName ,const PSNODEINFO psNodeInf);
 
     void vManageOnMessageHandlerLIN(PSTLIN_TIME_MSG sRxMsgInfo, DWORD& dwClientId);
+    void vGetMsgHandlerStats(SMSG_HANDLER_STATS& sTotal);
 
     const HMODULE hReturnDllHandle(const CString NodeName);
     BOOL bDllLoaded;//if any one dll is loaded
     BOOL bExecuteDllBuildLoad(PSNODEINFO psNodeInfo,BOOL bDisplaySuccessful);
     BOOL bExecuteDllBuild(PSNODEINFO psNodeInfo,BOOL bDisplaySuccessful);
+    int nExecuteDllBuildAll(std::vector<PSNODEINFO>& ouNodes, CStringArray& omStrFailedFiles);
     BOOL bExecuteDllUnload(PSNODEINFO psNodeInfo);//It can be called for delete system
     BOOL bExecuteDllLoad(PSNODEINFO psNodeInfo,BOOL bDisplaySuccessful);
     //manage starting of timers
@@ -96,7 +98,8 @@ public:
     void vStopThreads();
     void vStopTimer();
     void vStartTimer();
-    void vManageTimerExecution();
+    void vManageTimerExecution(UINT unElapsed = 1, IClockService* pouHoldClock = nullptr);
+    UINT unGetTicksToNextTimer();
 
 
 
@@ -27,6 +27,11 @@ typedef int (*APPFUNCPROC) (STCAN_TIME_MSG,HMODULE);
 // Prototype of the exported function from user-defined DLL
 typedef void (*DLLFUNCPROC)(APPFUNCPROC);
 
+// Sends several messages, the DLL passes the size of its message structure
+typedef UINT (*APPFUNCPROCMULTI) (void*,UINT,UINT,HMODULE);
+// Prototype of the exported function from user-defined DLL
+typedef void (*DLLFUNCPROCMULTI)(APPFUNCPROCMULTI);
+
 
 typedef int (*CONTROLLERMODE) (BOOL);
 // Prototype of the exported function from user-defined DLL
@@ -42,6 +47,7 @@ typedef void (*DLLDISCONNECTPROC)(DISCONNECT);
 
 // Name of the exported function from user-defined DLL
 #define NAME_FUNC_USERDLL               "vSetSendMsgProcAddress"
+#define NAME_FUNC_USERDLL_MULTI         "vSetSendMsgsProcAddress"
 #define NAME_FUNC_CONTROLLER_MODE       "vSetControllerModeProcAddress"
 #define NAME_FUNC_ONLINE                "vSetGoOnlineProcAddress"
 #define NAME_FUNC_OFFLINE               "vSetGoOfflineProcAddress"
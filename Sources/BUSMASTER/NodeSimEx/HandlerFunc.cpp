@@ -22,6 +22,7 @@
 #include "HandlerFunc.h"
 #include "ExecuteManager.h"
 #include "AppServicesCAN.h"
+#include "IClockService.h"
 #include "Utility\MultiLanguageSupport.h"
 //#include "../Application/GettextBusmaster.h"
 
@@ -452,92 +453,6 @@ UINT unBusDisConnectHandlerProc(LPVOID pParam)
 
     return 0;
 }
-/******************************************************************************
-    Function Name    :  unReadNodeMsgHandlerBuffer
-    Input(s)         :  pParam - Typecasted address CExecuteFunc object
-    Output           :  Zero
-    Functionality    :  This is a thread control function to process
-                        reading of CExecutFunc's buffer
-    Member of        :  Global Thread Function
-    Friend of        :      -
-    Author(s)        :  Anish kumar
-    Date Created     :  22.12.2005
-    Modification By  :  Anish Kumar
-    Modification on  :  29.01.07, Removed memory leak due to msg handler thread
-                        termination
-******************************************************************************/
-UINT unReadNodeMsgHandlerBuffer(LPVOID pParam)
-{
-    if(pParam != nullptr)
-    {
-        CExecuteFunc* pCExecuteFunc=(CExecuteFunc*)pParam;
-        pCExecuteFunc->m_aomState[defMSG_HANDLER_THREAD].ResetEvent();
-        //if dll is unloaded exit loop and end thread
-        while(pCExecuteFunc->bIsDllLoaded())
-        {
-            WaitForSingleObject( pCExecuteFunc->m_omReadFromQEvent,INFINITE);
-            //wait for event set by write thread
-            pCExecuteFunc->m_omReadFromQEvent.ResetEvent();
-            UINT unMsgCnt=pCExecuteFunc->unGetBufferMsgCnt();
-            //if buffer is empty wait for read event
-            while( unMsgCnt>0 && pCExecuteFunc->bIsDllLoaded() &&
-                    !(pCExecuteFunc->m_bStopMsgHandlers) )
-            {
-                STCAN_TIME_MSG sCanMsg=pCExecuteFunc->sReadFromQMsg();
-                pCExecuteFunc->vExecuteOnMessageHandlerCAN(sCanMsg);
-                unMsgCnt=pCExecuteFunc->unGetBufferMsgCnt();
-            }
-        }
-        pCExecuteFunc->m_aomState[defMSG_HANDLER_THREAD].SetEvent( );
-    }
-    return 0;
-}
-
-/******************************************************************************
-    Function Name    :  unReadNodeMsgHandlerBuffer
-    Input(s)         :  pParam - Typecasted address CExecuteFunc object
-    Output           :  Zero
-    Functionality    :  This is a thread control function to process
-                        reading of CExecutFunc's buffer
-    Member of        :  Global Thread Function
-    Friend of        :      -
-    Author(s)        :  Anish kumar
-    Date Created     :  22.12.2005
-    Modification By  :  Anish Kumar
-    Modification on  :  29.01.07, Removed memory leak due to msg handler thread
-                        termination
-******************************************************************************/
-UINT unReadNodeMsgHandlerBufferLIN(LPVOID pParam)
-{
-    if(pParam != nullptr)
-    {
-        CExecuteFunc* pCExecuteFunc=(CExecuteFunc*)pParam;
-
-        if(nullptr != pCExecuteFunc)
-        {
-            pCExecuteFunc->m_aomState[defMSG_HANDLER_THREAD].ResetEvent();
-            //if dll is unloaded exit loop and end thread
-            while(pCExecuteFunc->bIsDllLoaded())
-            {
-                WaitForSingleObject( pCExecuteFunc->m_omReadFromQEventLIN,INFINITE);
-                //wait for event set by write thread
-                pCExecuteFunc->m_omReadFromQEventLIN.ResetEvent();
-                UINT unMsgCnt=pCExecuteFunc->unGetBufferMsgCntLIN();
-                //if buffer is empty wait for read event
-                while( unMsgCnt>0 && pCExecuteFunc->bIsDllLoaded() &&
-                        !(pCExecuteFunc->m_bStopMsgHandlers) )
-                {
-                    STLIN_TIME_MSG sLinMsg=pCExecuteFunc->sReadFromQMsgLIN();
-                    pCExecuteFunc->vExecuteOnMessageHandlerLIN(sLinMsg);
-                    unMsgCnt=pCExecuteFunc->unGetBufferMsgCntLIN();
-                }
-            }
-            pCExecuteFunc->m_aomState[defMSG_HANDLER_THREAD].SetEvent( );
-        }
-    }
-    return 0;
-}
-
 /******************************************************************************
     Function Name    :  unReadDllMsgBuffer
     Input(s)         :  pParam - Typecasted address CExecuteFunc object
@@ -590,6 +505,24 @@ UINT unReadDllMsgBuffer(LPVOID pParam)
     Date Created     :  16.12.05
 **************************************************************************/
 
+/*************************************************************************
+    Function Name    : vReleaseTimerClock
+    Input(s)         : PSTIMERHANDLER
+    Output           :
+    Functionality    : Lets the virtual time go on once the timer handler
+                       started at the due time has returned
+    Member of        : Global timer handler
+**************************************************************************/
+static void vReleaseTimerClock(PSTIMERHANDLER psTimerStruct)
+{
+    IClockService* pouClock = (IClockService*)InterlockedExchangePointer(
+                                  (PVOID*)&psTimerStruct->pouHeldClock, nullptr);
+    if(pouClock != nullptr)
+    {
+        pouClock->vRelease();
+    }
+}
+
 UINT unTimerHandlerProc(LPVOID pParam)
 {
     PSTIMERHANDLER psTimerStruct=(PSTIMERHANDLER)pParam;
@@ -628,10 +561,12 @@ UINT unTimerHandlerProc(LPVOID pParam)
                 }
 
             }
+            vReleaseTimerClock(psTimerStruct);
 
         }
     if(psTimerStruct != nullptr)
     {
+        vReleaseTimerClock(psTimerStruct);
         psTimerStruct->pomThreadHandle=nullptr;
     }
     return 0;
@@ -47,10 +47,5 @@ UINT unEventHandlerProc(LPVOID pParam);
 // prototype of fuontion having common processing of timer call back func.
 // prototype for timer thread
 UINT unTimerHandlerProc(LPVOID pParam);
-// to read node buffer of message queue
-UINT unReadNodeMsgHandlerBuffer(LPVOID pParam);
-
-UINT unReadNodeMsgHandlerBufferLIN(LPVOID pParam);
-
 // to read ExecuteManager buffer of message queue
 UINT unReadDllMsgBuffer(LPVOID pParam);
@@ -0,0 +1,208 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      HandlerPool.cpp
+ * \brief     Implementation of CHandlerPool class
+ *
+ * Implementation of CHandlerPool class
+ */
+
+#include "NodeSimEx_stdafx.h"
+#include "HandlerPool.h"
+
+static CHandlerPool* s_pouHandlerPool = nullptr;
+
+/******************************************************************************
+  Function Name    :  ouGetPool
+  Input(s)         :  -
+  Output           :  The only CHandlerPool object
+  Functionality    :  Creates the pool and its workers on the first call.
+                      Message queues of several buses may ask for it at the
+                      same time, so the object is published atomically.
+  Member of        :  CHandlerPool
+******************************************************************************/
+CHandlerPool& CHandlerPool::ouGetPool()
+{
+    if (nullptr == s_pouHandlerPool)
+    {
+        CHandlerPool* pouPool = new CHandlerPool();
+        if (nullptr != InterlockedCompareExchangePointer((PVOID*)&s_pouHandlerPool, pouPool, nullptr))
+        {
+            //Another thread was first, its workers have not seen this object
+            delete pouPool;
+        }
+        else
+        {
+            for (UINT unIndex = 0; unIndex < pouPool->m_apsWorkers.size(); unIndex++)
+            {
+                pouPool->vStartWorker(unIndex);
+            }
+        }
+    }
+    return *s_pouHandlerPool;
+}
+
+CHandlerPool::CHandlerPool()
+{
+    SYSTEM_INFO sSysInfo;
+    GetSystemInfo(&sSysInfo);
+    UINT unWorkers = max((UINT)sSysInfo.dwNumberOfProcessors, (UINT)defMIN_HANDLER_WORKERS);
+
+    InitializeCriticalSection(&m_omCritSec);
+    m_hTaskCount = CreateSemaphore(nullptr, 0, LONG_MAX, nullptr);
+    m_dwTlsIndex = TlsAlloc();
+    m_lNextWorker = 0;
+    for (UINT unIndex = 0; unIndex < unWorkers; unIndex++)
+    {
+        sWORKER* psWorker = new sWORKER;
+        InitializeCriticalSection(&psWorker->m_omCritSec);
+        psWorker->m_hThread = nullptr;
+        psWorker->m_dwThreadId = 0;
+        m_apsWorkers.push_back(psWorker);
+    }
+}
+
+//Only reached for a pool that lost the race in ouGetPool, no worker runs
+CHandlerPool::~CHandlerPool()
+{
+    for (UINT unIndex = 0; unIndex < m_apsWorkers.size(); unIndex++)
+    {
+        DeleteCriticalSection(&m_apsWorkers[unIndex]->m_omCritSec);
+        delete m_apsWorkers[unIndex];
+    }
+    TlsFree(m_dwTlsIndex);
+    CloseHandle(m_hTaskCount);
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+UINT CHandlerPool::unGetWorkerCount() const
+{
+    return (UINT)m_apsWorkers.size();
+}
+
+void CHandlerPool::vSubmit(IHandlerTask* pouTask)
+{
+    UINT unIndex = (UINT)(UINT_PTR)TlsGetValue(m_dwTlsIndex);
+    if (0 == unIndex)
+    {
+        unIndex = (UINT)InterlockedIncrement(&m_lNextWorker) % m_apsWorkers.size();
+    }
+    else
+    {
+        unIndex--;
+    }
+    sWORKER* psWorker = m_apsWorkers[unIndex];
+    EnterCriticalSection(&psWorker->m_omCritSec);
+    psWorker->m_ouTasks.push_back(pouTask);
+    LeaveCriticalSection(&psWorker->m_omCritSec);
+    ReleaseSemaphore(m_hTaskCount, 1, nullptr);
+}
+
+/******************************************************************************
+  Function Name    :  hRetireWorker
+  Input(s)         :  dwThreadId - Worker that does not come back from a task
+  Output           :  Handle of the retired worker, nullptr if no worker has
+                      that ID
+  Functionality    :  Starts another worker on the task deque, so a hanging
+                      handler of an unloaded node does not cost the pool a
+                      worker. The retired worker no longer owns the slot and
+                      leaves as soon as its task returns. The caller joins
+                      it and closes the handle.
+  Member of        :  CHandlerPool
+******************************************************************************/
+HANDLE CHandlerPool::hRetireWorker(DWORD dwThreadId)
+{
+    HANDLE hThread = nullptr;
+    EnterCriticalSection(&m_omCritSec);
+    for (UINT unIndex = 0; unIndex < m_apsWorkers.size(); unIndex++)
+    {
+        sWORKER* psWorker = m_apsWorkers[unIndex];
+        if (psWorker->m_dwThreadId == dwThreadId && nullptr != psWorker->m_hThread)
+        {
+            hThread = psWorker->m_hThread;
+            vStartWorker(unIndex);
+            break;
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+    return hThread;
+}
+
+//The worker starts suspended, it must see its ID in the slot
+void CHandlerPool::vStartWorker(UINT unIndex)
+{
+    sWORKER* psWorker = m_apsWorkers[unIndex];
+    DWORD dwThreadId = 0;
+    psWorker->m_hThread = CreateThread(nullptr, 0, dwWorkerProc, (LPVOID)(UINT_PTR)unIndex,
+                                       CREATE_SUSPENDED, &dwThreadId);
+    psWorker->m_dwThreadId = dwThreadId;
+    if (nullptr != psWorker->m_hThread)
+    {
+        ResumeThread(psWorker->m_hThread);
+    }
+}
+
+DWORD WINAPI CHandlerPool::dwWorkerProc(LPVOID pParam)
+{
+    s_pouHandlerPool->vWorkerLoop((UINT)(UINT_PTR)pParam);
+    return 0;
+}
+
+void CHandlerPool::vWorkerLoop(UINT unIndex)
+{
+    TlsSetValue(m_dwTlsIndex, (LPVOID)(UINT_PTR)(unIndex + 1));
+    sWORKER* psWorker = m_apsWorkers[unIndex];
+    DWORD dwThreadId = GetCurrentThreadId();
+    //A retired worker takes no further task, its replacement owns the slot
+    while (psWorker->m_dwThreadId == dwThreadId
+            && WAIT_OBJECT_0 == WaitForSingleObject(m_hTaskCount, INFINITE))
+    {
+        IHandlerTask* pouTask = pouTakeTask(unIndex);
+        pouTask->vRun();
+    }
+}
+
+/******************************************************************************
+  Function Name    :  pouTakeTask
+  Input(s)         :  unIndex - Worker asking for a task
+  Output           :  The task to run
+  Functionality    :  Takes the oldest task of the own deque, otherwise the
+                      oldest task of the next worker that has one. A lane
+                      that yields after a batch goes behind the tasks
+                      already queued, so every queued lane gets its turn.
+                      The caller got a count of the semaphore, so one task
+                      is queued for it and the search ends.
+  Member of        :  CHandlerPool
+******************************************************************************/
+IHandlerTask* CHandlerPool::pouTakeTask(UINT unIndex)
+{
+    IHandlerTask* pouTask = nullptr;
+    while (nullptr == pouTask)
+    {
+        for (UINT unCount = 0; unCount < m_apsWorkers.size() && nullptr == pouTask; unCount++)
+        {
+            sWORKER* psWorker = m_apsWorkers[(unIndex + unCount) % m_apsWorkers.size()];
+            EnterCriticalSection(&psWorker->m_omCritSec);
+            if (!psWorker->m_ouTasks.empty())
+            {
+                pouTask = psWorker->m_ouTasks.front();
+                psWorker->m_ouTasks.pop_front();
+            }
+            LeaveCriticalSection(&psWorker->m_omCritSec);
+        }
+    }
+    return pouTask;
+}
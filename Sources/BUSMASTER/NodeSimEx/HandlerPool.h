@@ -0,0 +1,454 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      HandlerPool.h
+ * \brief     Definition of CHandlerPool and CNodeMsgQueue classes
+ *
+ * Worker pool that runs the message handlers of all simulated nodes.
+ */
+
+#pragma once
+
+#include <Windows.h>
+#include <deque>
+#include <map>
+#include <vector>
+#include "NodeSimEx_Struct.h"
+
+#define defHANDLER_BATCH            16      // Messages a lane handles before it yields its worker
+#define defMIN_HANDLER_WORKERS      2
+#define defHANDLER_JOIN_WAIT        1000    // ms a retired worker gets to finish its handler
+
+/* Task the handler pool can run */
+class IHandlerTask
+{
+public:
+    virtual ~IHandlerTask() {}
+    virtual void vRun() = 0;
+};
+
+/**
+ * Work stealing pool shared by the message handlers of all nodes.
+ *
+ * Every worker has its own task deque. A task submitted from a worker goes
+ * to the back of that worker's deque, other tasks are spread round robin.
+ * A worker takes its oldest task first and, when its deque is empty, steals
+ * the oldest task of another worker. A lane resubmitting itself after a
+ * batch therefore waits behind the lanes already queued on its worker. A
+ * semaphore counts the queued tasks, so idle workers sleep instead of
+ * polling.
+ *
+ * The pool is created on first use and lives until the process ends.
+ */
+class CHandlerPool
+{
+public:
+    static CHandlerPool& ouGetPool();
+
+    void vSubmit(IHandlerTask* pouTask);
+    //Lets the worker leave after its task and starts a new one in its place.
+    //Handle of the retired worker, closed by the caller, nullptr if none.
+    HANDLE hRetireWorker(DWORD dwThreadId);
+    UINT unGetWorkerCount() const;
+
+private:
+    struct sWORKER
+    {
+        CRITICAL_SECTION m_omCritSec;   // Guards m_ouTasks
+        std::deque<IHandlerTask*> m_ouTasks;
+        HANDLE m_hThread;
+        volatile DWORD m_dwThreadId;    // Owner of the slot, a retired worker leaves
+    };
+
+    CHandlerPool();
+    ~CHandlerPool();
+
+    void vStartWorker(UINT unIndex);
+    void vWorkerLoop(UINT unIndex);
+    IHandlerTask* pouTakeTask(UINT unIndex);
+    static DWORD WINAPI dwWorkerProc(LPVOID pParam);
+
+    std::vector<sWORKER*> m_apsWorkers;
+    CRITICAL_SECTION m_omCritSec;       // Guards thread handles during a retirement
+    HANDLE m_hTaskCount;                // Semaphore, one count per queued task
+    DWORD m_dwTlsIndex;                 // Worker index + 1 of the calling thread
+    volatile LONG m_lNextWorker;
+
+    CHandlerPool(const CHandlerPool&);
+    CHandlerPool& operator=(const CHandlerPool&);
+};
+
+/**
+ * Message queue of one node, drained by the handler pool.
+ *
+ * The messages are kept in lanes. A lane is a pool task that is queued at
+ * most once at a time, so the messages of a lane are handled one after the
+ * other in arrival order. By default a node has a single lane and keeps the
+ * order of all its messages; a node whose handlers do not share state can
+ * use one lane per message ID, so handlers of different IDs run in parallel
+ * while every ID keeps its order. Nodes never share a lane.
+ *
+ * SMSG needs an unGetHandlerKey(const SMSG&) overload giving its ID.
+ */
+template <typename SMSG, typename TOWNER>
+class CNodeMsgQueue
+{
+public:
+    typedef void (TOWNER::*PFEXECUTE)(SMSG);
+
+    CNodeMsgQueue(TOWNER* pouOwner, PFEXECUTE pfExecute, UINT unMaxDepth) :
+        m_pouOwner(pouOwner),
+        m_pfExecute(pfExecute),
+        m_unMaxDepth(unMaxDepth)
+    {
+        LARGE_INTEGER lnFrequency;
+        QueryPerformanceFrequency(&lnFrequency);
+        m_n64QpcFreq = lnFrequency.QuadPart;
+        InitializeCriticalSection(&m_omCritSec);
+        m_hIdle = CreateEvent(nullptr, TRUE, TRUE, nullptr);
+        m_lActive = 0;
+        m_bStopped = false;
+        m_bPerId = false;
+        m_bPerIdWanted = false;
+        vClearStats(m_sTotal);
+    }
+
+    ~CNodeMsgQueue()
+    {
+        bStop(INFINITE);
+        for (auto itr = m_ouLanes.begin(); itr != m_ouLanes.end(); ++itr)
+        {
+            delete itr->second;
+        }
+        CloseHandle(m_hIdle);
+        DeleteCriticalSection(&m_omCritSec);
+    }
+
+    //Takes effect once no message of the node is queued
+    void vSetPerIdLanes(bool bPerId)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        m_bPerIdWanted = bPerId;
+        LeaveCriticalSection(&m_omCritSec);
+    }
+
+    //false if the message was dropped
+    bool bAddMsg(const SMSG& sMsg)
+    {
+        LARGE_INTEGER lnNow;
+        QueryPerformanceCounter(&lnNow);
+        UINT unKey = unGetHandlerKey(sMsg);
+        CLane* pouSubmit = nullptr;
+
+        EnterCriticalSection(&m_omCritSec);
+        if (m_bStopped)
+        {
+            LeaveCriticalSection(&m_omCritSec);
+            return false;
+        }
+        sSTAT& sStat = m_ouStats[unKey];
+        if (m_sTotal.m_sStats.m_unDepth >= m_unMaxDepth)
+        {
+            sStat.m_sStats.m_un64Dropped++;
+            m_sTotal.m_sStats.m_un64Dropped++;
+            LeaveCriticalSection(&m_omCritSec);
+            return false;
+        }
+        if (0 == m_lActive)
+        {
+            m_bPerId = m_bPerIdWanted;
+        }
+        CLane*& pouLane = m_ouLanes[m_bPerId ? unKey : 0];
+        if (nullptr == pouLane)
+        {
+            pouLane = new CLane(this);
+        }
+        sENTRY sEntry;
+        sEntry.m_sMsg = sMsg;
+        sEntry.m_unKey = unKey;
+        sEntry.m_n64Queued = lnNow.QuadPart;
+        pouLane->m_ouMsgs.push_back(sEntry);
+        vAddDepth(sStat.m_sStats, 1);
+        vAddDepth(m_sTotal.m_sStats, 1);
+        if (!pouLane->m_bQueued)
+        {
+            pouLane->m_bQueued = true;
+            if (0 == m_lActive++)
+            {
+                ResetEvent(m_hIdle);
+            }
+            pouSubmit = pouLane;
+        }
+        LeaveCriticalSection(&m_omCritSec);
+
+        if (nullptr != pouSubmit)
+        {
+            CHandlerPool::ouGetPool().vSubmit(pouSubmit);
+        }
+        return true;
+    }
+
+    //Drops the queued messages and waits until no handler of the node runs.
+    //A handler still running after dwMaxWaitMs has its worker retired and
+    //gets defHANDLER_JOIN_WAIT more to return before the worker is
+    //terminated. false if a worker had to be retired.
+    bool bStop(DWORD dwMaxWaitMs)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        m_bStopped = true;
+        for (auto itr = m_ouLanes.begin(); itr != m_ouLanes.end(); ++itr)
+        {
+            itr->second->m_ouMsgs.clear();
+        }
+        for (auto itr = m_ouStats.begin(); itr != m_ouStats.end(); ++itr)
+        {
+            itr->second.m_sStats.m_unDepth = 0;
+        }
+        m_sTotal.m_sStats.m_unDepth = 0;
+        LeaveCriticalSection(&m_omCritSec);
+
+        if (WAIT_OBJECT_0 == WaitForSingleObject(m_hIdle, dwMaxWaitMs))
+        {
+            //The last lane sets the event right after leaving the lock
+            EnterCriticalSection(&m_omCritSec);
+            LeaveCriticalSection(&m_omCritSec);
+            return true;
+        }
+
+        //The retired workers leave once their handler returns, the lane then
+        //finishes as usual. Only a worker that does not get there is
+        //terminated, it is inside the handler and holds no lock of the queue.
+        std::vector< std::pair<DWORD, HANDLE> > aouRetired;
+        EnterCriticalSection(&m_omCritSec);
+        for (auto itr = m_ouLanes.begin(); itr != m_ouLanes.end(); ++itr)
+        {
+            DWORD dwThreadId = itr->second->m_dwThreadId;
+            HANDLE hThread = (0 != dwThreadId) ? CHandlerPool::ouGetPool().hRetireWorker(dwThreadId) : nullptr;
+            if (nullptr != hThread)
+            {
+                aouRetired.push_back(std::make_pair(dwThreadId, hThread));
+            }
+        }
+        LeaveCriticalSection(&m_omCritSec);
+        for (size_t unIndex = 0; unIndex < aouRetired.size(); unIndex++)
+        {
+            HANDLE hThread = aouRetired[unIndex].second;
+            if (WAIT_OBJECT_0 != WaitForSingleObject(hThread, defHANDLER_JOIN_WAIT))
+            {
+                EnterCriticalSection(&m_omCritSec);
+                for (auto itr = m_ouLanes.begin(); itr != m_ouLanes.end(); ++itr)
+                {
+                    CLane* pouLane = itr->second;
+                    if (pouLane->m_dwThreadId == aouRetired[unIndex].first)
+                    {
+                        TerminateThread(hThread, 0);
+                        pouLane->m_dwThreadId = 0;
+                        pouLane->m_bQueued = false;
+                        if (0 == --m_lActive)
+                        {
+                            SetEvent(m_hIdle);
+                        }
+                    }
+                }
+                LeaveCriticalSection(&m_omCritSec);
+            }
+            CloseHandle(hThread);
+        }
+        //Lanes still queued in the pool only have to find a free worker
+        WaitForSingleObject(m_hIdle, dwMaxWaitMs);
+        EnterCriticalSection(&m_omCritSec);
+        LeaveCriticalSection(&m_omCritSec);
+        return false;
+    }
+
+    //pomPerId may be nullptr
+    void vGetStats(SMSG_HANDLER_STATS& sTotal, std::map<UINT, SMSG_HANDLER_STATS>* pomPerId)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        sTotal = sGetStats(m_sTotal);
+        if (nullptr != pomPerId)
+        {
+            pomPerId->clear();
+            for (auto itr = m_ouStats.begin(); itr != m_ouStats.end(); ++itr)
+            {
+                (*pomPerId)[itr->first] = sGetStats(itr->second);
+            }
+        }
+        LeaveCriticalSection(&m_omCritSec);
+    }
+
+private:
+    struct sENTRY
+    {
+        SMSG m_sMsg;
+        UINT m_unKey;
+        LONGLONG m_n64Queued;       // Performance counter when the message was queued
+    };
+
+    struct sSTAT
+    {
+        SMSG_HANDLER_STATS m_sStats;
+        UINT64 m_un64LatencySumUs;
+        UINT64 m_un64RunSumUs;
+    };
+
+    class CLane : public IHandlerTask
+    {
+    public:
+        CLane(CNodeMsgQueue* pouQueue) :
+            m_pouQueue(pouQueue),
+            m_bQueued(false),
+            m_dwThreadId(0)
+        {
+        }
+        void vRun()
+        {
+            m_pouQueue->vRunLane(*this);
+        }
+
+        CNodeMsgQueue* m_pouQueue;
+        std::deque<sENTRY> m_ouMsgs;
+        bool m_bQueued;             // Submitted to the pool and not yet finished
+        DWORD m_dwThreadId;         // Worker running the lane, 0 if none
+    };
+
+    void vRunLane(CLane& ouLane)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        ouLane.m_dwThreadId = GetCurrentThreadId();
+        for (UINT unCount = 0; unCount < defHANDLER_BATCH && !ouLane.m_ouMsgs.empty() && !m_bStopped; unCount++)
+        {
+            sENTRY sEntry = ouLane.m_ouMsgs.front();
+            ouLane.m_ouMsgs.pop_front();
+            vRemoveDepth(m_ouStats[sEntry.m_unKey].m_sStats);
+            vRemoveDepth(m_sTotal.m_sStats);
+            LeaveCriticalSection(&m_omCritSec);
+
+            LARGE_INTEGER lnStart, lnEnd;
+            QueryPerformanceCounter(&lnStart);
+            (m_pouOwner->*m_pfExecute)(sEntry.m_sMsg);
+            QueryPerformanceCounter(&lnEnd);
+
+            EnterCriticalSection(&m_omCritSec);
+            if (m_bStopped)
+            {
+                break;
+            }
+            UINT64 un64LatencyUs = un64ToUs(lnStart.QuadPart - sEntry.m_n64Queued);
+            UINT64 un64RunUs = un64ToUs(lnEnd.QuadPart - lnStart.QuadPart);
+            vAddRun(m_ouStats[sEntry.m_unKey], un64LatencyUs, un64RunUs);
+            vAddRun(m_sTotal, un64LatencyUs, un64RunUs);
+        }
+
+        if (!ouLane.m_ouMsgs.empty() && !m_bStopped)
+        {
+            //Give the worker to other lanes and nodes between batches, the
+            //lane goes behind the tasks already queued on this worker
+            ouLane.m_dwThreadId = 0;
+            LeaveCriticalSection(&m_omCritSec);
+            CHandlerPool::ouGetPool().vSubmit(&ouLane);
+            return;
+        }
+        ouLane.m_dwThreadId = 0;
+        ouLane.m_bQueued = false;
+        HANDLE hIdle = nullptr;
+        if (0 == --m_lActive)
+        {
+            hIdle = m_hIdle;
+        }
+        LeaveCriticalSection(&m_omCritSec);
+        //The queue may be destroyed as soon as the event is set
+        if (nullptr != hIdle)
+        {
+            SetEvent(hIdle);
+        }
+    }
+
+    static void vClearStats(sSTAT& sStat)
+    {
+        SMSG_HANDLER_STATS sEmpty = {0};
+        sStat.m_sStats = sEmpty;
+        sStat.m_un64LatencySumUs = 0;
+        sStat.m_un64RunSumUs = 0;
+    }
+
+    static void vAddDepth(SMSG_HANDLER_STATS& sStats, UINT unCount)
+    {
+        sStats.m_unDepth += unCount;
+        if (sStats.m_unDepth > sStats.m_unMaxDepth)
+        {
+            sStats.m_unMaxDepth = sStats.m_unDepth;
+        }
+    }
+
+    static void vRemoveDepth(SMSG_HANDLER_STATS& sStats)
+    {
+        if (sStats.m_unDepth > 0)
+        {
+            sStats.m_unDepth--;
+        }
+    }
+
+    static void vAddRun(sSTAT& sStat, UINT64 un64LatencyUs, UINT64 un64RunUs)
+    {
+        SMSG_HANDLER_STATS& sStats = sStat.m_sStats;
+        sStats.m_un64Executed++;
+        sStat.m_un64LatencySumUs += un64LatencyUs;
+        sStat.m_un64RunSumUs += un64RunUs;
+        if (un64LatencyUs > sStats.m_un64MaxLatencyUs)
+        {
+            sStats.m_un64MaxLatencyUs = un64LatencyUs;
+        }
+        if (un64RunUs > sStats.m_un64MaxRunUs)
+        {
+            sStats.m_un64MaxRunUs = un64RunUs;
+        }
+    }
+
+    static SMSG_HANDLER_STATS sGetStats(const sSTAT& sStat)
+    {
+        SMSG_HANDLER_STATS sStats = sStat.m_sStats;
+        if (sStats.m_un64Executed > 0)
+        {
+            sStats.m_un64MeanLatencyUs = sStat.m_un64LatencySumUs / sStats.m_un64Executed;
+            sStats.m_un64MeanRunUs = sStat.m_un64RunSumUs / sStats.m_un64Executed;
+        }
+        return sStats;
+    }
+
+    UINT64 un64ToUs(LONGLONG n64Ticks) const
+    {
+        return (n64Ticks <= 0) ? 0 : (UINT64)((n64Ticks * 1000000) / m_n64QpcFreq);
+    }
+
+    TOWNER* m_pouOwner;
+    PFEXECUTE m_pfExecute;
+    UINT m_unMaxDepth;
+    LONGLONG m_n64QpcFreq;
+
+    CRITICAL_SECTION m_omCritSec;       // Guards everything below
+    std::map<UINT, CLane*> m_ouLanes;   // Lane 0 only, or one lane per message ID
+    std::map<UINT, sSTAT> m_ouStats;    // Per message ID
+    sSTAT m_sTotal;
+    LONG m_lActive;                     // Lanes queued in the pool or running
+    HANDLE m_hIdle;                     // Set while m_lActive is 0
+    bool m_bStopped;
+    bool m_bPerId;
+    bool m_bPerIdWanted;
+
+    CNodeMsgQueue(const CNodeMsgQueue&);
+    CNodeMsgQueue& operator=(const CNodeMsgQueue&);
+};
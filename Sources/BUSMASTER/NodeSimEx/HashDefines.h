@@ -569,6 +569,7 @@ struct sTIMERHANDLER
     //  sTIMERHANDLER*  psNextTimer;
     HANDLE          hDllHandle;
     CWinThread*     pomThreadHandle;
+    IClockService*  pouHeldClock;          // Virtual time held until the handler returns
 };
 typedef sTIMERHANDLER STIMERHANDLER;
 typedef STIMERHANDLER* PSTIMERHANDLER;
@@ -595,6 +596,7 @@ typedef sNODETIMERLIST SNODETIMERLIST;
 typedef SNODETIMERLIST* PSNODETIMERLIST;
 
 class CExecuteFunc;
+class IClockService;
 
 //New data structure to store  node name and the "CExecuteFunc" pointer associated to that node:
 struct sNODEOBJECT
@@ -58,6 +58,7 @@ CNodeDetailsDlg::CNodeDetailsDlg(ETYPE_BUS eBus, CGlobalObj* pGlobalObj, CSimSys
     //{{AFX_DATA_INIT(CNodeDetailsDlg)
     m_omStrDllPath = "";
     m_omStrNodeName = "";
+    m_bParallelHandlers = FALSE;
     //}}AFX_DATA_INIT
     m_psNodeStuctPtr = pNode;
     m_bIsNodeModified = FALSE;
@@ -75,6 +76,7 @@ void CNodeDetailsDlg::DoDataExchange(CDataExchange* pDX)
     //{{AFX_DATA_MAP(CNodeDetailsDlg)
     DDX_Text(pDX, IDC_EDIT_NODE_FILE_PATH, m_omStrNodeFilePath);
     DDX_Text(pDX, IDC_EDIT_ANODE_NAME, m_omStrNodeName);
+    DDX_Check(pDX, IDC_CHK_PARALLEL_HANDLERS, m_bParallelHandlers);
     //}}AFX_DATA_MAP
     DDX_Control(pDX, IDC_EDIT_ADDRESS, m_omPreferedAddress);
     DDX_Control(pDX, IDC_EDIT_ECU_NAME, m_omEcuName);
@@ -137,6 +139,8 @@ BOOL CNodeDetailsDlg::OnInitDialog()
         pWnd->ShowWindow(TRUE);
         m_omPreferedAddress.ShowWindow(TRUE);
         m_omEcuName.ShowWindow(TRUE);
+        //J1939 messages are not run by the handler pool
+        GetDlgItem(IDC_CHK_PARALLEL_HANDLERS)->ShowWindow(FALSE);
         if(m_bEdit == TRUE)
         {
             m_omPreferedAddress.EnableWindow(FALSE);
@@ -153,6 +157,7 @@ BOOL CNodeDetailsDlg::OnInitDialog()
         m_omStrCFile     = m_psNodeStuctPtr->m_omStrCFileName;
         m_omPreferedAddress.vSetValue(m_psNodeStuctPtr->m_byPrefAddress);
         m_omEcuName.vSetValue(m_psNodeStuctPtr->m_unEcuName);
+        m_bParallelHandlers = m_psNodeStuctPtr->m_bParallelMsgHandlers;
 
 
         if(m_psNodeStuctPtr->m_eNodeFileType == NODE_FILE_DLL && !m_omStrDllPath.IsEmpty())
@@ -284,6 +289,11 @@ void CNodeDetailsDlg::OnOK()
             m_bIsNodeModified = TRUE;
             m_psNodeStuctPtr->m_unEcuName = (UINT64)(m_omEcuName.lGetValue());
         }
+        if (m_psNodeStuctPtr->m_bParallelMsgHandlers != m_bParallelHandlers)
+        {
+            m_bIsNodeModified = TRUE;
+            m_psNodeStuctPtr->m_bParallelMsgHandlers = m_bParallelHandlers;
+        }
         if(!m_omStrNodeFilePath.IsEmpty())
         {
             int nReturnVal = IDYES;
@@ -44,6 +44,7 @@ public:
     CString m_omStrNodeName;
     CString m_omStrNodeFilePath;
     CString m_omStrCFile;
+    BOOL    m_bParallelHandlers;
     //}}AFX_DATA
 
 
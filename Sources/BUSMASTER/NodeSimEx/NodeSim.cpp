@@ -366,6 +366,10 @@ int  CNodeSim::NS_nOnBusConnected(bool bConnected)
     }
     return TRUE;
 }
+void CNodeSim::NS_GetMsgHandlerStats(SMSG_HANDLER_STATS& sTotal)
+{
+    m_pExecuteMgr->vGetMsgHandlerStats(sTotal);
+}
 BOOL CNodeSim::NS_IsSimSysConfigChanged()
 {
     return CSimSysManager::ouGetSimSysManager(m_eBus, mpGlobalObj).bIsConfigChanged();
@@ -67,6 +67,7 @@ public:
     virtual void NS_SetSimSysConfigData(xmlNodePtr pXmlNodePtr);
     BOOL NS_IsSimSysConfigChanged();
     int NS_nOnBusConnected(bool bConnected);
+    void NS_GetMsgHandlerStats(SMSG_HANDLER_STATS& sTotal);
     void NS_SetJ1939ActivationStatus(bool bActivated);
     // Save simulation file
 
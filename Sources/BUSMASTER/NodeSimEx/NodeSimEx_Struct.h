@@ -118,6 +118,19 @@ typedef struct tagDbNameMsg
 
 typedef CList<SDB_NAME_MSG, SDB_NAME_MSG&> CMsgNameMsgCodeListDataBase;
 
+/* Counters of the message handlers of a node or of one message ID */
+struct SMSG_HANDLER_STATS
+{
+    UINT64 m_un64Executed;          // Messages handed to the handler
+    UINT64 m_un64Dropped;           // Messages dropped because the queue was full
+    UINT m_unDepth;                 // Messages queued right now
+    UINT m_unMaxDepth;
+    UINT64 m_un64MaxLatencyUs;      // Longest time from queueing to handler start
+    UINT64 m_un64MeanLatencyUs;
+    UINT64 m_un64MaxRunUs;          // Longest handler run
+    UINT64 m_un64MeanRunUs;
+};
+
 class CBaseAppServices;
 typedef struct
 {
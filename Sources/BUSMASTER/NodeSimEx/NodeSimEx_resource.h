@@ -121,6 +121,7 @@
 #define IDC_RBTN_PDU_NAME               4033
 #define IDC_STATIC_MSG_LIST             4035
 #define IDC_STATIC_SIG_LIST             4036
+#define IDC_CHK_PARALLEL_HANDLERS       4037
 #define IDD_MSG_SG_DLG                  5000
 #define ID_FUNCTIONEDITOR_SAVE          35000
 #define ID_ROOTMENU_ADD                 35001
@@ -155,7 +156,7 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NEXT_RESOURCE_VALUE        5000
 #define _APS_NEXT_COMMAND_VALUE         35027
-#define _APS_NEXT_CONTROL_VALUE         4037
+#define _APS_NEXT_CONTROL_VALUE         4038
 #define _APS_NEXT_SYMED_VALUE           4000
 #endif
 #endif
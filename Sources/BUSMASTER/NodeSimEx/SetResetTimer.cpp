@@ -28,6 +28,7 @@
 //accessin manager class object
 #include "ExecuteManager.h"
 #include "SimSysManager.h"
+#include "IBusMasterKernel.h"
 #include "Utility\MultiLanguageSupport.h"
 //#include "../Application/GettextBusmaster.h"
 
@@ -287,6 +288,7 @@ void CSetResetTimer::vStartTimer()
         CSetResetTimer::sm_eBus = m_eBus;
         m_psCalTimerThreadStruct->m_bThreadStop = FALSE;
         m_psCalTimerThreadStruct->m_omExitThreadEvent.ResetEvent();
+        m_psCalTimerThreadStruct->m_omStopEvent.ResetEvent();
         m_psCalTimerThreadStruct->m_eBus = m_eBus;
         m_psCalTimerThreadStruct->m_pGlobalObj = m_pGlobalObj;
         m_psCalTimerThreadStruct->m_pExecuteMgr = m_pExecuteMgr;
@@ -320,6 +322,7 @@ void CSetResetTimer::vStopTimer()
     if(m_psCalTimerThreadStruct != nullptr)
     {
         m_psCalTimerThreadStruct->m_bThreadStop = TRUE;
+        m_psCalTimerThreadStruct->m_omStopEvent.SetEvent();
         omMainTimerEvent.SetEvent();
         WaitForSingleObject(m_psCalTimerThreadStruct->m_omExitThreadEvent,20);
         timeKillEvent(m_unTimerID);
@@ -426,7 +429,9 @@ void CSetResetTimer::vRestoreTimerStatus(CString omNodeName,
     Function Name    : CalcTimersExecTime
     Input(s)         :
     Output           :
-    Functionality    :
+    Functionality    :  Runs the timer handlers on the 1 ms multimedia timer.
+                        In virtual time it waits on the clock until the next
+                        timer is due instead, without spending the time between.
     Member of        :
     Author(s)        :  Anish kumar
     Date Created     :
@@ -435,8 +440,37 @@ void CSetResetTimer::vRestoreTimerStatus(CString omNodeName,
 UINT CalcTimersExecTime(LPVOID pParam)
 {
     PSCALCEXECTIMERTHREAD psThreadInfo = (PSCALCEXECTIMERTHREAD)pParam;
+    IClockService* pouClock = nullptr;
+    CLOCK_GetInterface(&pouClock);
+    bool bAttached = false;
     while( !psThreadInfo->m_bThreadStop )
     {
+        UINT unTicks = 0;
+        if( (pouClock != nullptr) && pouClock->bIsVirtual() )
+        {
+            unTicks = psThreadInfo->m_pExecuteMgr->unGetTicksToNextTimer();
+        }
+        if( unTicks > 0 )
+        {
+            if( !bAttached )
+            {
+                pouClock->vAttach();
+                bAttached = true;
+            }
+            UINT64 un64Due = pouClock->un64GetTime() + ((UINT64)unTicks * 1000);
+            if( (pouClock->dwWaitUntil(psThreadInfo->m_omStopEvent, un64Due) == WAIT_TIMEOUT) &&
+                    !psThreadInfo->m_bThreadStop )
+            {
+                psThreadInfo->m_pExecuteMgr->vManageTimerExecution(unTicks, pouClock);
+            }
+            continue;
+        }
+        if( bAttached )
+        {
+            //No timer is running, nothing to wait for on the clock
+            pouClock->vDetach();
+            bAttached = false;
+        }
         WaitForSingleObject(omMainTimerEvent,INFINITE);
         omMainTimerEvent.ResetEvent();
         if(!psThreadInfo->m_bThreadStop)
@@ -445,6 +479,10 @@ UINT CalcTimersExecTime(LPVOID pParam)
             //CExecuteManager::ouGetExecuteManager(psThreadInfo->m_eBus, psThreadInfo->m_pGlobalObj).vManageTimerExecution(); //Added for issue #356
         }
     }
+    if( bAttached )
+    {
+        pouClock->vDetach();
+    }
     psThreadInfo->m_pomThreadPtr = nullptr;
     psThreadInfo->m_omExitThreadEvent.SetEvent();
     return 0;
@@ -35,6 +35,7 @@ typedef struct tagSCALCEXECTIMERTHREAD
     bool            m_bThreadStop;
     CWinThread*     m_pomThreadPtr;
     CEvent          m_omExitThreadEvent;
+    CEvent          m_omStopEvent;      // Ends a wait on the virtual clock
     CTransmitMsg*   m_pTransmitMsg;
     ETYPE_BUS       m_eBus; //Added for issue #356
     CGlobalObj*     m_pGlobalObj;
@@ -207,6 +207,18 @@ bool CSimSysManager::bGetConfigData(xmlNodePtr pNodePtr)
         xmlNodePtr pSimSysIsNodeEnabled = xmlNewChild(pSimSysNode, nullptr, BAD_CAST DEF_IS_NODE_ENABLED,BAD_CAST omcVarChar);
         xmlAddChild(pSimSysNode, pSimSysIsNodeEnabled);
 
+        //Parallel_Message_Handlers
+        if(pTempNode->m_sNodeInfo->m_bParallelMsgHandlers)
+        {
+            omcVarChar = "TRUE";
+        }
+        else
+        {
+            omcVarChar = "FALSE";
+        }
+        xmlNodePtr pSimSysParallel = xmlNewChild(pSimSysNode, nullptr, BAD_CAST DEF_NODE_PARALLEL_HANDLERS,BAD_CAST omcVarChar);
+        xmlAddChild(pSimSysNode, pSimSysParallel);
+
         //File_Type
         if(pTempNode->m_sNodeInfo->m_eNodeFileType == NODE_FILE_C_CPP)
         {
@@ -571,6 +583,16 @@ void CSimSysManager :: vLoadNodeInfoFromConfiguration(xmlNodePtr pNode)
                 xmlFree(key);
             }
         }
+        if ((!xmlStrcmp(pNode->name, (const xmlChar*)DEF_NODE_PARALLEL_HANDLERS)))
+        {
+            xmlChar* key = xmlNodeListGetString(pNode->doc, pNode->xmlChildrenNode, 1);
+            if(nullptr != key)
+            {
+                CString omStrKey = (char*)key;
+                pTempNode->m_sNodeInfo->m_bParallelMsgHandlers = (omStrKey == "TRUE") ? TRUE : FALSE;
+                xmlFree(key);
+            }
+        }
         if ((!xmlStrcmp(pNode->name, (const xmlChar*)DEF_NODE_FILE_TYPE)))
         {
             xmlChar* key = xmlNodeListGetString(pNode->doc, pNode->xmlChildrenNode, 1);
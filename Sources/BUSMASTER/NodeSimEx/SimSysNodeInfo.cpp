@@ -33,6 +33,7 @@
 //#include "GlobalObj.h"
 //#include "DIL_Interface_extern.h"
 #include "BaseDIL_CAN.h"
+#include "J1939MsgPool.h"
 #include "ConvertCpp.h"
 //#include "DataTypes/BaseAppServices.h"
 #include "AppServices.h"
@@ -230,16 +231,9 @@ int ReadNodeDataBuffer(PSNODEINFO psNodeInfo)
             {
                 while (psNodeInfo->m_ouMsgBufVSE->GetMsgCount() > 0)
                 {
-                    static STJ1939_MSG sJ1939Msg;
-                    static BYTE m_byTempData[MAX_MSG_LEN_J1939] = {0};
-                    static int nType = 0;
-                    int nSize = MAX_MSG_LEN_J1939;
-                    INT Result = psNodeInfo->m_ouMsgBufVSE->ReadFromBuffer(nType, m_byTempData, nSize);
-                    if (Result == ERR_READ_MEMORY_SHORT)
-                    {
-                        TRACE("ERR_READ_MEMORY_SHORT");
-                        break;
-                    }
+                    STJ1939_MSG sJ1939Msg;
+                    sJ1939POOLMSG* psPoolMsg = nullptr;
+                    INT Result = CJ1939MsgPool::hReadFromBuffer(*psNodeInfo->m_ouMsgBufVSE, psPoolMsg);
                     if (Result == EMPTY_APP_BUFFER)
                     {
                         TRACE("EMPTY_APP_BUFFER");
@@ -248,10 +242,14 @@ int ReadNodeDataBuffer(PSNODEINFO psNodeInfo)
                     // Give the msg to NodeSimx for simulation
                     if (Result == CALL_SUCCESS)
                     {
-                        sJ1939Msg.vSetDataStream(m_byTempData);
+                        // The message is shared with the other DIL clients, the
+                        // handler gets a copy of its data
+                        sJ1939Msg.vAttachDataStream(psPoolMsg->m_abyStream);
                         CExecuteFunc* pExecFunc = CExecuteManager::ouGetExecuteManager(psNodeInfo->m_eBus, &CGlobalObj::ouGetObj(J1939)).
                                                   pouGetExecuteFunc(psNodeInfo->m_dwClientId);
                         pExecFunc->vExecuteOnPGNHandler(&sJ1939Msg);
+                        sJ1939Msg.vDetachDataStream();
+                        CJ1939MsgPool::vRelease(psPoolMsg);
 
                     }
                 }
@@ -421,6 +419,7 @@ sNODEINFO::sNODEINFO(ETYPE_BUS eBus, CGlobalObj* pGlobalObj)
     m_omStrDllName      = "";
 
     m_bIsNodeEnabled      = TRUE;
+    m_bParallelMsgHandlers = FALSE;
 
     m_ouCanBufFSE = nullptr;
     m_ouLinBufSE = nullptr;
@@ -435,6 +434,8 @@ sNODEINFO::sNODEINFO(ETYPE_BUS eBus, CGlobalObj* pGlobalObj)
             break;
         case J1939:
             m_ouMsgBufVSE = new CMsgBufVSE();
+            // The DIL writes pool references, the dropped ones are released
+            m_ouMsgBufVSE->vSetDropHandler(CJ1939MsgPool::vReleaseEntry);
             break;
         default:
             break;
@@ -496,6 +497,7 @@ sNODEINFO& sNODEINFO::operator=(const sNODEINFO& sobj)
     this->m_omStrDllName = sobj.m_omStrDllName;
     this->m_hModuleHandle = sobj.m_hModuleHandle;
     this->m_bIsNodeEnabled = sobj.m_bIsNodeEnabled;
+    this->m_bParallelMsgHandlers = sobj.m_bParallelMsgHandlers;
     this->m_eNodeState = sobj.m_eNodeState;
     this->m_eNodeFileType = sobj.m_eNodeFileType;
     this->m_unChannel = sobj.m_unChannel;
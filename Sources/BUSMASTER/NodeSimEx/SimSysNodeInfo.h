@@ -61,6 +61,7 @@ struct sNODEINFO:private IDirectoryUpdate
     CString m_omStrDllName;                     // DLL Name
     HINSTANCE m_hModuleHandle;
     BOOL m_bIsNodeEnabled;                      //Check Node is Enabled = 1; Disabled = 0;
+    BOOL m_bParallelMsgHandlers;                //Handlers of different message IDs may run at once
     eNODE_STATE m_eNodeState;
     eNODE_FILE_TYPE m_eNodeFileType;
     UINT m_unChannel;
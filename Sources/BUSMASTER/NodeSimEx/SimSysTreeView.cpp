@@ -742,6 +742,8 @@ void CSimSysTreeView::OnConfigNode()
             {
                 CTreeCtrl& omTree = GetTreeCtrl();
                 omTree.SetItemText(m_hSelectedTreeItem, psNodeInfo->m_omStrNodeName);
+                //A loaded node switches its handler lanes once it is idle
+                mpExecuteMgr->vExSetNodeInfo(psNodeInfo->m_omStrNodeName, psNodeInfo);
             }
 
             if(psNodeInfo->m_eNodeFileType == NODE_FILE_DLL)
@@ -0,0 +1,242 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      CanSymbolTable.cpp
+ * \brief     Implementation of CCanSymbolTable class
+ *
+ * Implementation of CCanSymbolTable class
+ */
+
+#include "PSDI_CAN/stdafx_CAN.h"
+#include <list>
+#include <vector>
+#include <algorithm>
+#include "CanSymbolTable.h"
+
+CCanSymbolTable::CCanSymbolTable(void)
+{
+    InitializeCriticalSection(&m_omCritSec);
+    m_pouNetwork = nullptr;
+    m_pouSymbols = std::make_shared<CCanSymbols>();
+    m_hBuildThread = nullptr;
+    m_bBuilding = false;
+    m_bStop = false;
+}
+
+CCanSymbolTable::~CCanSymbolTable(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_bStop = true;
+    LeaveCriticalSection(&m_omCritSec);
+    vSetNetwork(nullptr);
+
+    EnterCriticalSection(&m_omCritSec);
+    HANDLE hThread = m_hBuildThread;
+    m_hBuildThread = nullptr;
+    LeaveCriticalSection(&m_omCritSec);
+    if (nullptr != hThread)
+    {
+        WaitForSingleObject(hThread, INFINITE);
+        CloseHandle(hThread);
+    }
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  vSetNetwork
+  Input(s)         :  pouNetwork - Database service, nullptr to detach
+  Output           :  -
+  Functionality    :  Moves the change listener to the new database service
+                      and starts building its symbols. Until the build is
+                      done lookups see the symbols of the old service.
+  Member of        :  CCanSymbolTable
+******************************************************************************/
+void CCanSymbolTable::vSetNetwork(IBMNetWorkGetService* pouNetwork)
+{
+    EnterCriticalSection(&m_omCritSec);
+    IBMNetWorkGetService* pouOld = m_pouNetwork;
+    m_pouNetwork = pouNetwork;
+    LeaveCriticalSection(&m_omCritSec);
+    if (pouOld == pouNetwork)
+    {
+        return;
+    }
+    if (nullptr != pouOld)
+    {
+        pouOld->ManageClientForDbChanges(this, false);
+    }
+    if (nullptr != pouNetwork)
+    {
+        pouNetwork->ManageClientForDbChanges(this, true);
+    }
+    vRequestBuild(pouNetwork);
+}
+
+CCanSymbolsPtr CCanSymbolTable::GetSymbols(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    CCanSymbolsPtr pouSymbols = m_pouSymbols;
+    LeaveCriticalSection(&m_omCritSec);
+    return pouSymbols;
+}
+
+void CCanSymbolTable::OnDataBaseChange(bool /*bIsAdded*/, const DBChangeInfo& sInfo)
+{
+    if (CAN == sInfo.mBusType)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        IBMNetWorkGetService* pouNetwork = m_pouNetwork;
+        LeaveCriticalSection(&m_omCritSec);
+        vRequestBuild(pouNetwork);
+    }
+}
+
+/******************************************************************************
+  Function Name    :  vRequestBuild
+  Input(s)         :  pouNetwork - Database service, may be nullptr
+  Output           :  -
+  Functionality    :  Collects the frames of the service on the calling
+                      thread and hands them to the worker thread, which is
+                      started if it is not running.
+  Member of        :  CCanSymbolTable
+******************************************************************************/
+void CCanSymbolTable::vRequestBuild(IBMNetWorkGetService* pouNetwork)
+{
+    std::shared_ptr<CCanSymbols> pouFrames = CollectFrames(pouNetwork);
+
+    EnterCriticalSection(&m_omCritSec);
+    m_pouPending = pouFrames;
+    if (false == m_bBuilding && false == m_bStop)
+    {
+        //The previous worker has left its loop, it is done with this object
+        if (nullptr != m_hBuildThread)
+        {
+            CloseHandle(m_hBuildThread);
+        }
+        m_hBuildThread = CreateThread(nullptr, 0, dwBuildThreadProc, this, 0, nullptr);
+        m_bBuilding = (nullptr != m_hBuildThread);
+    }
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+DWORD WINAPI CCanSymbolTable::dwBuildThreadProc(LPVOID pParam)
+{
+    ((CCanSymbolTable*)pParam)->vBuildLoop();
+    return 0;
+}
+
+void CCanSymbolTable::vBuildLoop(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    while (false == m_bStop && nullptr != m_pouPending)
+    {
+        std::shared_ptr<CCanSymbols> pouSymbols = m_pouPending;
+        m_pouPending.reset();
+        LeaveCriticalSection(&m_omCritSec);
+
+        vRankNames(*pouSymbols);
+
+        EnterCriticalSection(&m_omCritSec);
+        m_pouSymbols = pouSymbols;
+    }
+    m_bBuilding = false;
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  CollectFrames
+  Input(s)         :  pouNetwork - Database service, may be nullptr
+  Output           :  Frames of all CAN channels without name ranks
+  Functionality    :  Copies identifier, name and signal count of every
+                      frame and prepares the name as the message window
+                      shows it. If several databases of a channel define an
+                      identifier the first one wins, as with
+                      IBMNetWorkGetService::GetFrame. Must be called where
+                      the databases can not change meanwhile.
+  Member of        :  CCanSymbolTable
+******************************************************************************/
+std::shared_ptr<CCanSymbols> CCanSymbolTable::CollectFrames(IBMNetWorkGetService* pouNetwork)
+{
+    std::shared_ptr<CCanSymbols> pouSymbols = std::make_shared<CCanSymbols>();
+    int nChannels = 0;
+    if (nullptr == pouNetwork || EC_SUCCESS != pouNetwork->GetChannelCount(CAN, nChannels))
+    {
+        return pouSymbols;
+    }
+
+    for (int nChannel = 0; nChannel < nChannels; nChannel++)
+    {
+        std::list<IFrame*> ouFrames;
+        pouNetwork->GetFrameList(CAN, nChannel, ouFrames);
+        for (auto itrFrame = ouFrames.begin(); itrFrame != ouFrames.end(); ++itrFrame)
+        {
+            unsigned int unId = 0;
+            if (nullptr == *itrFrame || EC_SUCCESS != (*itrFrame)->GetFrameId(unId))
+            {
+                continue;
+            }
+            //The databases count channels from 0, the frames from 1
+            UINT64 un64Key = CCanSymbols::un64GetKey(nChannel + 1, unId);
+            if (pouSymbols->m_omFrames.end() != pouSymbols->m_omFrames.find(un64Key))
+            {
+                continue;
+            }
+            std::string strName;
+            (*itrFrame)->GetName(strName);
+            sFRAME_SYMBOL& sSymbol = pouSymbols->m_omFrames[un64Key];
+            sSymbol.m_omName = strName.c_str();
+            strncpy_s(sSymbol.m_acDisplayName, strName.c_str(), _TRUNCATE);
+            sSymbol.m_unNameRank = 0;
+            sSymbol.m_unSignalCount = (*itrFrame)->GetSignalCount();
+            sSymbol.m_bInterpretable = (sSymbol.m_unSignalCount > 0);
+        }
+    }
+    return pouSymbols;
+}
+
+/******************************************************************************
+  Function Name    :  vRankNames
+  Input(s)         :  ouSymbols - Collected frames
+  Output           :  -
+  Functionality    :  Sets the name ranks of the frames. Equal names,
+                      ignoring case, get the same rank.
+  Member of        :  CCanSymbolTable
+******************************************************************************/
+void CCanSymbolTable::vRankNames(CCanSymbols& ouSymbols)
+{
+    std::vector<sFRAME_SYMBOL*> ouByName;
+    ouByName.reserve(ouSymbols.m_omFrames.size());
+    for (auto itrFrame = ouSymbols.m_omFrames.begin(); itrFrame != ouSymbols.m_omFrames.end(); ++itrFrame)
+    {
+        ouByName.push_back(&itrFrame->second);
+    }
+
+    std::sort(ouByName.begin(), ouByName.end(), [](const sFRAME_SYMBOL* psLeft, const sFRAME_SYMBOL* psRight)
+    {
+        return psLeft->m_omName.CompareNoCase(psRight->m_omName) < 0;
+    });
+    UINT unRank = 0;
+    for (size_t nIndex = 0; nIndex < ouByName.size(); nIndex++)
+    {
+        //Frames without a name sort like unknown identifiers
+        if ((0 == nIndex) ? (FALSE == ouByName[nIndex]->m_omName.IsEmpty())
+                : (0 != ouByName[nIndex]->m_omName.CompareNoCase(ouByName[nIndex - 1]->m_omName)))
+        {
+            unRank++;
+        }
+        ouByName[nIndex]->m_unNameRank = unRank;
+    }
+}
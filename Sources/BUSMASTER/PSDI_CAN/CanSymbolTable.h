@@ -0,0 +1,110 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      CanSymbolTable.h
+ * \brief     Definition of CCanSymbolTable class
+ *
+ * Message names and properties of the CAN databases, prepared for the
+ * message window.
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include "IBMNetWorkService.h"
+#include "include/BaseDefs.h"
+
+/* What the message window needs to know about one database frame */
+struct sFRAME_SYMBOL
+{
+    CString m_omName;               //Display name
+    char m_acDisplayName[LENGTH_STR_DESCRIPTION_CAN];   //Name column text of the message window
+    UINT m_unNameRank;              //Position of the name in case-insensitive order, 0 if empty
+    UINT m_unSignalCount;
+    bool m_bInterpretable;          //The frame has signals
+};
+
+/* Immutable snapshot of the frame symbols of all CAN channels */
+class CCanSymbols
+{
+public:
+    //The symbol of unId on nChannel, the channel of the frame starting at 1.
+    //nullptr if no database defines it.
+    const sFRAME_SYMBOL* psFind(int nChannel, UINT unId) const
+    {
+        auto itr = m_omFrames.find(un64GetKey(nChannel, unId));
+        return (m_omFrames.end() == itr) ? nullptr : &itr->second;
+    }
+
+    //Sort key of the name of unId, 0 for frames without a name
+    UINT unGetNameRank(int nChannel, UINT unId) const
+    {
+        const sFRAME_SYMBOL* psSymbol = psFind(nChannel, unId);
+        return (nullptr == psSymbol) ? 0 : psSymbol->m_unNameRank;
+    }
+
+    static UINT64 un64GetKey(int nChannel, UINT unId)
+    {
+        return ((UINT64)(UINT)nChannel << 32) | unId;
+    }
+
+    std::unordered_map<UINT64, sFRAME_SYMBOL> m_omFrames;
+};
+typedef std::shared_ptr<const CCanSymbols> CCanSymbolsPtr;
+
+/**
+ * Keeps a CCanSymbols snapshot of the CAN databases up to date.
+ *
+ * The snapshot is rebuilt whenever a database is added or removed, so the
+ * GUI and the read thread look up names and interpretability in a hash map
+ * instead of asking the database. The frames are collected on the thread
+ * that reports the change, since the database objects may only be used
+ * there; a worker thread then sorts the names. Until it is done the
+ * previous snapshot stays valid; a change meanwhile queues the newer
+ * frames for it.
+ */
+class CCanSymbolTable : public IDbChangeListner
+{
+public:
+    CCanSymbolTable(void);
+    ~CCanSymbolTable(void);
+
+    //Attaches to the database service and builds the first snapshot
+    void vSetNetwork(IBMNetWorkGetService* pouNetwork);
+    //The current snapshot, never nullptr
+    CCanSymbolsPtr GetSymbols(void);
+
+    void OnDataBaseChange(bool bIsAdded, const DBChangeInfo& sInfo);
+
+private:
+    void vRequestBuild(IBMNetWorkGetService* pouNetwork);
+    void vBuildLoop(void);
+    static std::shared_ptr<CCanSymbols> CollectFrames(IBMNetWorkGetService* pouNetwork);
+    static void vRankNames(CCanSymbols& ouSymbols);
+    static DWORD WINAPI dwBuildThreadProc(LPVOID pParam);
+
+    CRITICAL_SECTION m_omCritSec;       //Guards the members below
+    IBMNetWorkGetService* m_pouNetwork;
+    CCanSymbolsPtr m_pouSymbols;
+    std::shared_ptr<CCanSymbols> m_pouPending;  //Collected frames waiting for their name ranks
+    HANDLE m_hBuildThread;
+    bool m_bBuilding;                   //The worker has not yet decided to exit
+    bool m_bStop;
+
+    CCanSymbolTable(const CCanSymbolTable&);
+    CCanSymbolTable& operator=(const CCanSymbolTable&);
+};
@@ -23,6 +23,7 @@
  */
 
 #include "PSDI_CAN/stdafx_CAN.h"
+#include <algorithm>
 #include "include/Utils_Macro.h"
 #include "error.h"
 #include "Include/BaseDefs.h"
@@ -46,6 +47,7 @@ const int nBitsIn4Bytes          = 32;
 #define MAKE_CHANNEL_SPECIFIC_MESSAGE(MSGID, CHANNELID) ( ((unsigned __int64)((UINT)(MSGID))) | (((__int64)(CHANNELID)) << nBitsIn4Bytes) )
 #define MAKE_ERROR_MESSAGE_TYPE(ERRID)      (ERRID | 0x40000000)
 #define COLOUR_ERROR_MSG                     RGB(255, 0, 0);
+#define defREAD_BATCH_SIZE                   64  // Frames taken from the DIL buffer per lock
 
 const int ERRORS_DEFINED = 15;
 
@@ -137,6 +139,8 @@ CMsgContainerCAN::CMsgContainerCAN(void)
 {
     InitializeCriticalSection(&m_sCritSecDataSync);
     InitializeCriticalSection(&m_omCritSecFilter);
+    m_bHistoryQuery = false;
+    m_unAppendLayoutVersion = 0;
 }
 
 /******************************************************************************
@@ -272,7 +276,8 @@ static void vFormatCANDataMsg(STCANDATA* pMsgCAN,
 
 BOOL CMsgContainerCAN::bTobeBlocked(STCANDATA& sCanData)
 {
-    static SFRAMEINFO_BASIC_CAN sBasicCanInfo;
+    //Also called from the GUI thread while the append view is rebuilt
+    SFRAMEINFO_BASIC_CAN sBasicCanInfo;
     vFormatCANDataMsg(&sCanData, &sBasicCanInfo);
 
     EnterCriticalSection(&m_omCritSecFilter);
@@ -361,6 +366,8 @@ void CMsgContainerCAN::vProcessNewData(STCANDATA& sCanData)
 
         STCANDATA* pStcan = &m_sCANReadDataSpl;
         *pStcan = sCanData;
+        //Blocked frames are kept too, the append view hides them
+        m_ouAppendCanBuf.WriteIntoBuffer(&m_sCANReadDataSpl);
         if (!bTobeBlocked(sCanData))
         {
             unsigned char FDataType = m_sCANReadDataSpl.m_ucDataType;
@@ -369,7 +376,6 @@ void CMsgContainerCAN::vProcessNewData(STCANDATA& sCanData)
                 HRESULT h_Evaluate = EvaluateMessage(m_sCANReadDataSpl.m_uDataInfo.m_sCANMsg);
             }
 
-            m_ouAppendCanBuf.WriteIntoBuffer(&m_sCANReadDataSpl);
             if (nullptr != m_pRxMsgCallBack)
             {
                 m_pRxMsgCallBack->onRxMsg((void*)&sCanData);
@@ -389,10 +395,10 @@ void CMsgContainerCAN::vProcessNewData(STCANDATA& sCanData)
         }
         STCANDATA* pStcan = &m_sCANReadDataSpl;
         *pStcan = sCanData;
+        m_ouAppendCanBuf.WriteIntoBuffer(&m_sCANReadDataSpl);
 
         if (!bTobeBlocked(sCanData))
         {
-            m_ouAppendCanBuf.WriteIntoBuffer(&m_sCANReadDataSpl);
             if (nullptr != m_pRxMsgCallBack)
             {
                 m_pRxMsgCallBack->onRxMsg((void*)&sCanData);
@@ -413,13 +419,18 @@ void CMsgContainerCAN::vProcessNewData(STCANDATA& sCanData)
 ******************************************************************************/
 void CMsgContainerCAN::vRetrieveDataFromBuffer()
 {
+    if (nullptr == m_pouDIL_CAN_Interface)
+    {
+        return;
+    }
     EnterCriticalSection(&m_sCritSecDataSync);
-    while (m_ouMCCanBufFSE.GetMsgCount() > 0)
+    STCANDATA asCanData[defREAD_BATCH_SIZE];
+    UINT unRead = 0;
+    while (m_pouDIL_CAN_Interface->DILC_ReadMsgs(&m_ouMCCanBufFSE, asCanData, defREAD_BATCH_SIZE, unRead) == S_OK)
     {
-        STCANDATA sCanData;
-        if (m_ouMCCanBufFSE.ReadFromBuffer(&sCanData) == CALL_SUCCESS)
+        for (UINT i = 0; i < unRead; i++)
         {
-            vProcessNewData(sCanData);
+            vProcessNewData(asCanData[i]);
         }
     }
     LeaveCriticalSection(&m_sCritSecDataSync);
@@ -541,6 +552,7 @@ void CMsgContainerCAN::vEditClearAll()
     m_ouOWCanBuf.vClearMessageBuffer();
     m_ouAppendCanBuf.vClearMessageBuffer();
     memset(&m_sCANReadDataSpl, 0, sizeof(m_sCANReadDataSpl));
+    vMarkAllChanged();
 }
 
 /******************************************************************************
@@ -634,22 +646,16 @@ void CMsgContainerCAN::vSaveOWandGetDetails( void* pMsg,
 
 
     interPretable = MODE_NONE;
-    if (nullptr != mBmNetwork)
+    CCanSymbolsPtr pouSymbols = m_ouSymbolTable.GetSymbols();
+    const sFRAME_SYMBOL* psSymbol = pouSymbols->psFind(pouCANData->m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                    pouCANData->m_uDataInfo.m_sCANMsg.m_unMsgID);
+    if (nullptr != psSymbol && true == psSymbol->m_bInterpretable)
     {
-        int nCount = 0;
-
-        IFrame* pouFrame = nullptr;
-        mBmNetwork->GetFrame(CAN, 0, pouCANData->m_uDataInfo.m_sCANMsg.m_unMsgID, nullptr, &pouFrame);
-        if (nullptr != pouFrame)
-        {
-            if (pouFrame->GetSignalCount() > 0)
-            {
-                interPretable = INTERPRETABLE;
-            }
-        }
+        interPretable = INTERPRETABLE;
     }
     //Now write into the array
     m_ouOWCanBuf.WriteIntoBuffer(pouCANData, dwMapIndex, nBufferIndex);
+    vMarkChanged(dwMapIndex);
 }
 
 HRESULT CMsgContainerCAN::ApplyFilterScheme(void* pvFilterApplied)
@@ -666,6 +672,7 @@ HRESULT CMsgContainerCAN::ApplyFilterScheme(void* pvFilterApplied)
             hResult = S_OK;
         }
         LeaveCriticalSection(&m_omCritSecFilter);
+        vUpdateAppendView();
     }
     return hResult;
 }
@@ -689,6 +696,198 @@ HRESULT CMsgContainerCAN::EnableFilterApplied(BOOL bEnable)
     EnterCriticalSection(&m_omCritSecFilter);
     m_sFilterCAN.m_bEnabled = bEnable;
     LeaveCriticalSection(&m_omCritSecFilter);
+    vUpdateAppendView();
+    return S_OK;
+}
+
+/******************************************************************************
+    Function Name    :  bMatchesHistoryQuery
+    Input(s)         :  sQuery - History query
+                        sFrame - Frame
+    Output           :  TRUE if the frame matches identifiers and channel
+    Functionality    :  Error frames have no identifier, they match only
+                        queries without identifiers.
+    Member of        :  -
+******************************************************************************/
+static BOOL bMatchesHistoryQuery(const SMSGHISTORYQUERY& sQuery, const STCANDATASPL& sFrame)
+{
+    const STCAN_MSG& sCanMsg = sFrame.m_uDataInfo.m_sCANMsg;
+    if (false == sQuery.m_ouMsgIds.empty())
+    {
+        if (!IS_A_MESSAGE(sFrame.m_ucDataType) ||
+                sQuery.m_ouMsgIds.end() == std::find(sQuery.m_ouMsgIds.begin(), sQuery.m_ouMsgIds.end(), sCanMsg.m_unMsgID))
+        {
+            return FALSE;
+        }
+    }
+    if (0 != sQuery.m_unChannel && IS_A_MESSAGE(sFrame.m_ucDataType) && sQuery.m_unChannel != sCanMsg.m_ucChannel)
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/******************************************************************************
+    Function Name    :  bIsFrameShown
+    Input(s)         :  sFrame - Frame
+                        pvParam - The message container
+    Output           :  TRUE if the frame passes the filter and the applied
+                        history query
+    Functionality    :  Frame filter of the append view. Called with the
+                        append buffer locked.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+BOOL CMsgContainerCAN::bIsFrameShown(const STCANDATASPL& sFrame, void* pvParam)
+{
+    CMsgContainerCAN* pouContainer = (CMsgContainerCAN*)pvParam;
+    STCANDATA sCanData = sFrame;
+    if (TRUE == pouContainer->bTobeBlocked(sCanData))
+    {
+        return FALSE;
+    }
+    EnterCriticalSection(&pouContainer->m_omCritSecFilter);
+    BOOL bShown = (false == pouContainer->m_bHistoryQuery) || bMatchesHistoryQuery(pouContainer->m_sHistoryQuery, sFrame);
+    LeaveCriticalSection(&pouContainer->m_omCritSecFilter);
+    return bShown;
+}
+
+/******************************************************************************
+    Function Name    :  bIsFrameFound
+    Input(s)         :  sFrame - Frame
+                        pvParam - The history query
+    Output           :  TRUE if the frame matches the query
+    Functionality    :  Frame filter of the history search.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+BOOL CMsgContainerCAN::bIsFrameFound(const STCANDATASPL& sFrame, void* pvParam)
+{
+    return bMatchesHistoryQuery(*(const SMSGHISTORYQUERY*)pvParam, sFrame);
+}
+
+/******************************************************************************
+    Function Name    :  vMakeFrameQuery
+    Input(s)         :  psQuery - History query, nullptr for none
+                        sQuery - Append buffer query. An [out] parameter.
+    Output           :  void
+    Functionality    :  Converts the duration of a history query to the time
+                        range ending at the latest frame.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+void CMsgContainerCAN::vMakeFrameQuery(const SMSGHISTORYQUERY* psQuery, SFRAMEQUERY& sQuery)
+{
+    if (nullptr != psQuery && psQuery->m_n64Duration > 0)
+    {
+        sQuery.m_llFromTime = m_ouAppendCanBuf.llGetLastTime() - psQuery->m_n64Duration;
+    }
+}
+
+/******************************************************************************
+    Function Name    :  vUpdateAppendView
+    Input(s)         :  void
+    Output           :  void
+    Functionality    :  Shows the frames of the append buffer passing the
+                        filter and the history query. Must not be called
+                        with m_omCritSecFilter held.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+void CMsgContainerCAN::vUpdateAppendView(void)
+{
+    EnterCriticalSection(&m_omCritSecFilter);
+    bool bFiltered = (FALSE != m_sFilterCAN.m_bEnabled) || (true == m_bHistoryQuery);
+    SFRAMEQUERY sQuery;
+    vMakeFrameQuery((true == m_bHistoryQuery) ? &m_sHistoryQuery : nullptr, sQuery);
+    LeaveCriticalSection(&m_omCritSecFilter);
+
+    if (true == bFiltered)
+    {
+        sQuery.m_pfFilter = bIsFrameShown;
+        sQuery.m_pvParam = this;
+        m_ouAppendCanBuf.vApplyView(sQuery);
+    }
+    else
+    {
+        m_ouAppendCanBuf.vClearView();
+    }
+    vMarkAllChanged();
+}
+
+/******************************************************************************
+    Function Name    :  GetChangedRows
+    Input(s)         :  sChanges - The changes. An [out] parameter.
+    Output           :  -
+    Functionality    :  Adds a full repaint when the append rows have moved
+                        because old frames were dropped.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+void CMsgContainerCAN::GetChangedRows(SMSGWNDCHANGES& sChanges)
+{
+    CMsgContainerBase::GetChangedRows(sChanges);
+    UINT unLayoutVersion = m_ouAppendCanBuf.unGetLayoutVersion();
+    if (unLayoutVersion != m_unAppendLayoutVersion)
+    {
+        m_unAppendLayoutVersion = unLayoutVersion;
+        sChanges.m_bAllChanged = true;
+        sChanges.m_ouChangedKeys.clear();
+    }
+}
+
+/******************************************************************************
+    Function Name    :  ApplyHistoryQuery
+    Input(s)         :  psQuery - History query, nullptr to remove it
+    Output           :  S_OK
+    Functionality    :  Restricts the append view to the kept frames matching
+                        the query, frames received later are checked too.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+HRESULT CMsgContainerCAN::ApplyHistoryQuery(const SMSGHISTORYQUERY* psQuery)
+{
+    EnterCriticalSection(&m_omCritSecFilter);
+    m_bHistoryQuery = (nullptr != psQuery);
+    m_sHistoryQuery = (nullptr != psQuery) ? *psQuery : SMSGHISTORYQUERY();
+    LeaveCriticalSection(&m_omCritSecFilter);
+    vUpdateAppendView();
+    return S_OK;
+}
+
+/******************************************************************************
+    Function Name    :  FindInHistory
+    Input(s)         :  sQuery - History query
+                        ouIndices - Append view indices of the matching
+                                    frames. An [out] parameter.
+    Output           :  S_OK
+    Functionality    :  Searches the append view without changing it.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+HRESULT CMsgContainerCAN::FindInHistory(const SMSGHISTORYQUERY& sQuery, std::vector<int>& ouIndices)
+{
+    SFRAMEQUERY sFrameQuery;
+    vMakeFrameQuery(&sQuery, sFrameQuery);
+    sFrameQuery.m_pfFilter = bIsFrameFound;
+    sFrameQuery.m_pvParam = (void*)&sQuery;
+    m_ouAppendCanBuf.vFindRows(sFrameQuery, ouIndices);
+    return S_OK;
+}
+
+/******************************************************************************
+    Function Name    :  GetHistoryQueryAt
+    Input(s)         :  nIndex - Append view index
+                        sQuery - Query for the identifier and channel of the
+                                 frame. An [out] parameter.
+    Output           :  S_OK, S_FALSE for an error frame or a wrong index
+    Functionality    :  Gives the query that shows the frames like the one
+                        at the index.
+    Member of        :  CMsgContainerCAN
+******************************************************************************/
+HRESULT CMsgContainerCAN::GetHistoryQueryAt(int nIndex, SMSGHISTORYQUERY& sQuery)
+{
+    STCANDATASPL sFrame;
+    if (CALL_SUCCESS != m_ouAppendCanBuf.ReadFromBuffer(&sFrame, nIndex) || !IS_A_MESSAGE(sFrame.m_ucDataType))
+    {
+        return S_FALSE;
+    }
+    sQuery = SMSGHISTORYQUERY();
+    sQuery.m_ouMsgIds.push_back(sFrame.m_uDataInfo.m_sCANMsg.m_unMsgID);
+    sQuery.m_unChannel = sFrame.m_uDataInfo.m_sCANMsg.m_ucChannel;
     return S_OK;
 }
 /******************************************************************************
@@ -748,9 +947,23 @@ HRESULT CMsgContainerCAN::hUpdateFormattedMsgStruct(int nListIndex,
         //Now add the name of message if present in database else show the code
         nMsgCode = sCANCurrData.m_uDataInfo.m_sCANMsg.m_unMsgID;
 
-        CString name;
-        GetMessageName(sCANCurrData, name, IS_NUM_HEX_SET(bExprnFlag_Disp));
-        strcpy(m_sOutFormattedData.m_acMsgDesc, name.GetBuffer(0));
+        const sFRAME_SYMBOL* psSymbol = nullptr;
+        CCanSymbolsPtr pouSymbols = m_ouSymbolTable.GetSymbols();
+        if (!(IS_ERR_MESSAGE(sCANCurrData.m_ucDataType)))
+        {
+            psSymbol = pouSymbols->psFind(sCANCurrData.m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                          sCANCurrData.m_uDataInfo.m_sCANMsg.m_unMsgID);
+        }
+        if (nullptr != psSymbol)
+        {
+            strcpy_s(m_sOutFormattedData.m_acMsgDesc, psSymbol->m_acDisplayName);
+        }
+        else
+        {
+            CString name;
+            GetMessageName(sCANCurrData, name, IS_NUM_HEX_SET(bExprnFlag_Disp));
+            strcpy(m_sOutFormattedData.m_acMsgDesc, name.GetBuffer(0));
+        }
     }
     else
     {
@@ -928,13 +1141,20 @@ void CMsgContainerCAN::SetClientID(DWORD dwClientID)
 }
 
 
+//Name sort key of the overwrite buffer sort, pvSymbols is a CCanSymbols
+static UINT unGetNameRank(const void* pvSymbols, UINT unChannel, UINT unMsgId)
+{
+    return ((const CCanSymbols*)pvSymbols)->unGetNameRank(unChannel, unMsgId);
+}
+
 void CMsgContainerCAN::DoSortBuffer(int nField,bool bAscending)
 {
-    CCANMsgWndDataHandler<STCANDATASPL>::SortBufferData ( nField, bAscending, mBmNetwork, m_ouAppendCanBuf.nGetBuffer (), m_ouAppendCanBuf.GetBufferLength () );
-    m_ouAppendCanBuf.vDoSortIndexMapArray ();
+    CCanSymbolsPtr pouSymbols = m_ouSymbolTable.GetSymbols();
+    m_ouAppendCanBuf.vDoSortBuffer ( nField, bAscending, pouSymbols.get() );
 
-    CCANMsgWndDataHandler<STCANDATA>::SortBufferData ( nField, bAscending, mBmNetwork, m_ouOWCanBuf.nGetBuffer(), m_ouOWCanBuf.GetBufferLength() );
+    CCANMsgWndDataHandler<STCANDATA>::SortBufferData ( nField, bAscending, unGetNameRank, pouSymbols.get(), m_ouOWCanBuf.nGetBuffer(), m_ouOWCanBuf.GetBufferLength() );
     m_ouOWCanBuf.vDoSortIndexMapArray ();
+    vMarkAllChanged();
 }
 
 void CMsgContainerCAN::GetMapIndexAtID(int nIndex,__int64& nMapIndex)
@@ -954,6 +1174,7 @@ HRESULT CMsgContainerCAN::OverwritePage(const unsigned long& /*nLineNo*/)
 HRESULT CMsgContainerCAN::SetIBMNetWorkGetService(void* pBmNetWork)
 {
     mBmNetwork = (IBMNetWorkGetService*)pBmNetWork;
+    m_ouSymbolTable.vSetNetwork(mBmNetwork);
     return S_OK;
 }
 
@@ -1084,13 +1305,12 @@ HRESULT CMsgContainerCAN::GetMessageName(STCANDATA& sCANMsg, CString& msgName, b
     else
     {
         //Message Name
-        std::string strName = "";
-        IFrame* pouFrame = nullptr;
-        ERRORCODE eResult = mBmNetwork->GetFrame(CAN, 0, sCANMsg.m_uDataInfo.m_sCANMsg.m_unMsgID, nullptr, &pouFrame);
-        if (EC_SUCCESS == eResult && nullptr != pouFrame)
+        CCanSymbolsPtr pouSymbols = m_ouSymbolTable.GetSymbols();
+        const sFRAME_SYMBOL* psSymbol = pouSymbols->psFind(sCANMsg.m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                        sCANMsg.m_uDataInfo.m_sCANMsg.m_unMsgID);
+        if (nullptr != psSymbol)
         {
-            pouFrame->GetName(strName);
-            msgName = strName.c_str();
+            msgName = psSymbol->m_omName;
         }
         else
         {
@@ -39,29 +39,18 @@
 //#include "DIL_Interface_extern.h"
 #include "UDS_Protocol/UDS_Extern.h"
 #include "MsgBufFSE.h"
+#include "MsgFrameStoreCAN.h"
+#include "CanSymbolTable.h"
 
 typedef CMsgBufCANVFSE<STCANDATA> CCANBufVFSE;
 typedef void (*MSG_RX_CALL_BK)(void* pParam, ETYPE_BUS eBusType);
 
-// To save delta time in case of append mode
-typedef struct stCanDataSpl : public STCANDATA
-{
-    __int64      m_nDeltime;
-
-    stCanDataSpl()
-    {
-        m_nDeltime = 0;
-    }
-} STCANDATASPL;
-
-typedef CMsgBufCANVFSE<STCANDATASPL> CMsgBufCANVFSEspl;
-
 class CMsgContainerCAN: public CMsgContainerBase
 {
 private:
     CMsgBufFSE<STCANDATA>   m_ouMCCanBufFSE;
     CCANBufVFSE             m_ouOWCanBuf;
-    CMsgBufCANVFSEspl       m_ouAppendCanBuf;
+    CMsgFrameStoreCAN       m_ouAppendCanBuf;
     SFORMATTEDDATA_CAN      m_sOutFormattedData;
     //STCANDATA               m_sCANReadData;
     STCANDATASPL            m_sCANReadDataSpl;
@@ -69,6 +58,7 @@ private:
     DWORD                   m_dwClientId;
     CBaseDIL_CAN*           m_pouDIL_CAN_Interface;
     IBMNetWorkGetService*   mBmNetwork;
+    CCanSymbolTable         m_ouSymbolTable;    //Frame names and properties of mBmNetwork
 private:
     //ReadMcNetData virtual function
     void vProcessNewData(STCANDATA& sCanData);
@@ -77,11 +67,18 @@ private:
                                BYTE byRxError,
                                BYTE byTxError );
     BOOL bTobeBlocked(STCANDATA& sCanData);
+    void vUpdateAppendView(void);
+    void vMakeFrameQuery(const SMSGHISTORYQUERY* psQuery, SFRAMEQUERY& sQuery);
+    static BOOL bIsFrameShown(const STCANDATASPL& sFrame, void* pvParam);
+    static BOOL bIsFrameFound(const STCANDATASPL& sFrame, void* pvParam);
     USHORT usProcessCurrErrorEntry(SERROR_INFO& sErrInfo);
 
     CRITICAL_SECTION m_sCritSecDataSync;
     CRITICAL_SECTION m_omCritSecFilter;
     SFILTERAPPLIED_CAN m_sFilterCAN;
+    SMSGHISTORYQUERY m_sHistoryQuery;  //Guarded by m_omCritSecFilter
+    bool m_bHistoryQuery;
+    UINT m_unAppendLayoutVersion;       //Append buffer layout at the last display update
     ERROR_STATE m_eCurrErrorState[ defNO_OF_CHANNELS ];
     HRESULT GetInterPretedSignalList(STCAN_MSG& ouMsg, SSignalInfoArray& ouSSignalInfoArray, bool isHexMode);
     HRESULT GetMessageName(STCANDATA&, CString& msgName, bool formatHexForId);
@@ -125,6 +122,10 @@ public:
     HRESULT ApplyFilterScheme(void* pvFilterApplied);
     HRESULT GetFilterScheme(void* pvFilterApplied);
     HRESULT EnableFilterApplied(BOOL bEnable);
+    HRESULT ApplyHistoryQuery(const SMSGHISTORYQUERY* psQuery);
+    HRESULT FindInHistory(const SMSGHISTORYQUERY& sQuery, std::vector<int>& ouIndices);
+    HRESULT GetHistoryQueryAt(int nIndex, SMSGHISTORYQUERY& sQuery);
+    void GetChangedRows(SMSGWNDCHANGES& sChanges);
     __int64 nCreateMapIndexKey( LPVOID pMsgData );
     //Import Log File.
     HRESULT LoadPage(const unsigned long& nPageNo);
@@ -24,6 +24,7 @@
 //#include "DataTypes/MsgBufAll_Datatypes.h"
 //#include "DIL_Datatypes.h"
 #include "MsgContainer_J1939.h"
+#include "J1939MsgPool.h"
 #include "Utility\MultiLanguageSupport.h"
 //#include "../Application/GettextBusmaster.h"
 #include "../Application/HashDefines.h"
@@ -61,6 +62,8 @@ CMsgContainerJ1939::CMsgContainerJ1939(void)
     InitializeCriticalSection(&m_sCritSecDataSync);
     InitializeCriticalSection(&m_omCritSecFilter);
     m_pouDIL_J1939 = nullptr;
+    // The DIL writes pool references, the dropped ones are released
+    m_ouVSEBufJ1939.vSetDropHandler(CJ1939MsgPool::vReleaseEntry);
     // Allocate necessary amount of memory.
     m_sJ1939Data.m_unDLC = MAX_DATA_LEN_J1939;
     m_sJ1939Data.m_pbyData = new BYTE[m_sJ1939Data.m_unDLC];// For basic data object
@@ -181,22 +184,15 @@ BOOL CMsgContainerJ1939::bTobeBlocked(STJ1939_MSG& sJ1939Data)
 void CMsgContainerJ1939::vRetrieveDataFromBuffer()
 {
     EnterCriticalSection(&m_sCritSecDataSync);
-    static INT nType = 0;
     static HRESULT Result = 0;
+    sJ1939POOLMSG* psPoolMsg = nullptr;
     while (m_ouVSEBufJ1939.GetMsgCount() > 0)
     {
         STJ1939_MSG sJ1939Msg;
-        INT nSize = MAX_MSG_LEN_J1939;
-        // First read the J1939 message
-        Result = m_ouVSEBufJ1939.ReadFromBuffer(nType, m_pbyJ1939Data, nSize);
+        // First read the J1939 message, it is shared with the other DIL clients
+        Result = CJ1939MsgPool::hReadFromBuffer(m_ouVSEBufJ1939, psPoolMsg);
 
-        if (Result == ERR_READ_MEMORY_SHORT)
-        {
-            CString omBuf;
-            omBuf.Format(_("J1939 PSDI - ERR_READ_MEMORY_SHORT  nSize: %d"), nSize);
-            ASSERT(!AfxMessageBox(omBuf));
-        }
-        else if (Result == EMPTY_APP_BUFFER)
+        if (Result == EMPTY_APP_BUFFER)
         {
             CString omBuf;
             omBuf.Format(_("J1939 PSDI - EMPTY_APP_BUFFER"));
@@ -204,10 +200,12 @@ void CMsgContainerJ1939::vRetrieveDataFromBuffer()
         }
         if (Result == CALL_SUCCESS)
         {
-            // Save it into the J1939 message structure
-            m_sJ1939Data.vSetDataStream(m_pbyJ1939Data);
+            // The message refers to the shared stream, its data is not copied
+            sJ1939Msg.vAttachDataStream(psPoolMsg->m_abyStream);
 
-            vProcessNewData(m_sJ1939Data);
+            vProcessNewData(sJ1939Msg, psPoolMsg->m_abyStream);
+            sJ1939Msg.vDetachDataStream();
+            CJ1939MsgPool::vRelease(psPoolMsg);
         }
     }
     LeaveCriticalSection(&m_sCritSecDataSync);
@@ -239,7 +237,8 @@ void stJ1939MsgSpl::vGetDataStream(BYTE* pbyData) const
 
 /******************************************************************************
     Function Name    :  vProcessNewData
-    Input(s)         :  sJ1939Msg
+    Input(s)         :  sJ1939Msg, pbyMsgStream - sJ1939Msg as rendered by
+                        vGetDataStream
     Output           :
     Functionality    :  Process a new Rx/Tx msg
     Member of        :  CMsgContainerJ1939
@@ -247,8 +246,10 @@ void stJ1939MsgSpl::vGetDataStream(BYTE* pbyData) const
     Author(s)        :  Arun kumar K
     Date Created     :  31.01.2010
 ******************************************************************************/
-void CMsgContainerJ1939::vProcessNewData(STJ1939_MSG& sJ1939Msg)
+void CMsgContainerJ1939::vProcessNewData(STJ1939_MSG& sJ1939Msg, const BYTE* pbyMsgStream)
 {
+    // The append buffer entry, the message stream followed by the delta time
+    BYTE abyEntry[MAX_MSG_LEN_J1939 + sizeof(__int64)];
 
     // append : 1. Add item, get count, SetItemCount.
     // OW     : 1. Get ID, Create map index, Search if it is present in map
@@ -270,14 +271,13 @@ void CMsgContainerJ1939::vProcessNewData(STJ1939_MSG& sJ1939Msg)
             m_sJ1939ReadMsgSpl.m_nDeltime = _abs64( sJ1939Msg.m_sMsgProperties.m_un64TimeStamp -
                                                     m_sJ1939ReadMsgSpl.m_sMsgProperties.m_un64TimeStamp);
         }
-        static BYTE arrBuf[MAX_MSG_LEN_J1939 + sizeof(__int64)];
-
         if (!bTobeBlocked(sJ1939Msg))
         {
-            sJ1939Msg.vGetDataStream(arrBuf);
-            m_sJ1939ReadMsgSpl.vSetDataStream(arrBuf);
-            m_sJ1939ReadMsgSpl.vGetDataStream(arrBuf);
-            m_ouAppendJ1939Buf.WriteIntoBuffer(J1939, arrBuf/*(BYTE*)&m_sJ1939ReadMsgSpl*/, m_sJ1939ReadMsgSpl.nGetSize());
+            m_sJ1939ReadMsgSpl.m_sMsgProperties = sJ1939Msg.m_sMsgProperties;
+            UINT unSize = sJ1939Msg.unGetSize();
+            memcpy(abyEntry, pbyMsgStream, unSize);
+            memcpy(abyEntry + unSize, &m_sJ1939ReadMsgSpl.m_nDeltime, sizeof(__int64));
+            m_ouAppendJ1939Buf.WriteIntoBuffer(J1939, abyEntry, unSize + sizeof(__int64));
 
             if (nullptr != m_pRxMsgCallBack)
             {
@@ -412,6 +412,7 @@ void CMsgContainerJ1939::vEditClearAll()
     m_ouOWJ1939Buf.vClearMessageBuffer();
     m_ouAppendJ1939Buf.vClearMessageBuffer();
     memset(&m_sJ1939ReadMsgSpl, 0, sizeof(m_sJ1939ReadMsgSpl));
+    vMarkAllChanged();
 }
 
 /******************************************************************************
@@ -529,6 +530,7 @@ void CMsgContainerJ1939::vSaveOWandGetDetails( void* pMsg,
 
     //Now write into the array
     m_ouOWJ1939Buf.WriteIntoBuffer(pouJ1939Data, dwMapIndex, nBufferIndex);
+    vMarkChanged(dwMapIndex);
 }
 
 /******************************************************************************
@@ -894,6 +896,7 @@ void CMsgContainerJ1939::DoSortBuffer(int nField,bool bAscending)
 {
     m_ouOWJ1939Buf.vDoSortBuffer(nField, bAscending);
     //m_ouAppendJ1939Buf.vDoSortBuffer(nField, bAscending);
+    vMarkAllChanged();
 }
 
 /******************************************************************************
@@ -65,7 +65,7 @@ private:
     //private:
     //
     //    //ReadMcNetData virtual function
-    void vProcessNewData(STJ1939_MSG& sJ1939Msg);
+    void vProcessNewData(STJ1939_MSG& sJ1939Msg, const BYTE* pbyMsgStream);
     USHORT ushCalculateStrLen(bool bForHex, USHORT ushLength);
     //    void vProcessCurrErrorEntry(const SERROR_INFO& sErrInfo);
     //    BOOL bIsTransitionInState( UINT unChannel,
@@ -428,6 +428,7 @@ void CMsgContainerLIN::vEditClearAll()
     m_ouOWLinBuf.vClearMessageBuffer();
     m_ouAppendLinBuf.vClearMessageBuffer();
     memset(&m_sLINReadDataSpl, 0, sizeof(m_sLINReadDataSpl));
+    vMarkAllChanged();
 }
 
 /******************************************************************************
@@ -543,6 +544,7 @@ void CMsgContainerLIN::vSaveOWandGetDetails( void* pMsg,
 
     //Now write into the array
     m_ouOWLinBuf.WriteIntoBuffer(pouLINData, dwMapIndex, nBufferIndex);
+    vMarkChanged(dwMapIndex);
 }
 
 HRESULT CMsgContainerLIN::ApplyFilterScheme(void* pvFilterApplied)
@@ -884,6 +886,7 @@ void CMsgContainerLIN::DoSortBuffer(int nField,bool bAscending)
 {
     m_ouAppendLinBuf.vDoSortBuffer(nField,bAscending);
     m_ouOWLinBuf.vDoSortBuffer(nField,bAscending);
+    vMarkAllChanged();
 }
 
 void CMsgContainerLIN::GetMapIndexAtID(int nIndex,__int64& nMapIndex)
@@ -0,0 +1,1184 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      MsgFrameStoreCAN.cpp
+ * \brief     Implementation of CMsgFrameStoreCAN class
+ */
+
+#include "PSDI_CAN/stdafx_CAN.h"
+#include <algorithm>
+#include "error.h"
+#include "MsgFrameStoreCAN.h"
+#include "..\Utility\SortData.h"
+
+/* Record layout: data type, flags, time stamp relative to the chunk base,
+   optional delta time, then either the identifier, channel, length and
+   data bytes of a message or the raw error information. */
+#define defRECORD_EXTENDED      0x01
+#define defRECORD_RTR           0x02
+#define defRECORD_CANFD         0x04
+#define defRECORD_DELTIME       0x08    //Delta time differs from the time to the previous row
+
+static BYTE* pbyPutVarint(BYTE* pbyRecord, unsigned __int64 un64Value)
+{
+    while (un64Value >= 0x80)
+    {
+        *pbyRecord++ = (BYTE)(un64Value | 0x80);
+        un64Value >>= 7;
+    }
+    *pbyRecord++ = (BYTE)un64Value;
+    return pbyRecord;
+}
+
+static const BYTE* pbyGetVarint(const BYTE* pbyRecord, unsigned __int64& un64Value)
+{
+    un64Value = 0;
+    for (int nShift = 0; nShift < 64; nShift += 7)
+    {
+        BYTE byValue = *pbyRecord++;
+        un64Value |= (unsigned __int64)(byValue & 0x7F) << nShift;
+        if (0 == (byValue & 0x80))
+        {
+            break;
+        }
+    }
+    return pbyRecord;
+}
+
+/******************************************************************************
+  Function Name    :  CMsgFrameStoreCAN
+  Input(s)         :  -
+  Output           :  -
+  Functionality    :  Standard constructor
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+CMsgFrameStoreCAN::CMsgFrameStoreCAN()
+{
+    InitializeCriticalSection(&m_omCritSec);
+    m_unOpenRows = 0;
+    m_nRowCount = 0;
+    m_un64EvictedRows = 0;
+    m_llLastTime = 0;
+    m_nMemoryUsed = 0;
+    m_nMemoryBudget = defFRAME_STORE_DEF_BUDGET;
+    m_bKeyOverflow = false;
+    m_bViewActive = false;
+    m_bViewSorted = false;
+    m_bViewFiltered = false;
+    m_nViewStart = 0;
+    m_lLayoutVersion = 0;
+    m_lViewVersion = 0;
+    m_un64ViewPosBase = 0;
+    m_nViewDropped = 0;
+}
+
+/******************************************************************************
+  Function Name    :  ~CMsgFrameStoreCAN
+  Input(s)         :  -
+  Output           :  -
+  Functionality    :  Destructor
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+CMsgFrameStoreCAN::~CMsgFrameStoreCAN()
+{
+    vClearMessageBuffer();
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  vClearMessageBuffer
+  Input(s)         :  void
+  Output           :  void
+  Functionality    :  Releases all chunks and their index. An applied query
+                      stays active for the following frames.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vClearMessageBuffer(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    for (auto itrChunk = m_ouChunks.begin(); itrChunk != m_ouChunks.end(); ++itrChunk)
+    {
+        vDeleteChunk(*itrChunk);
+    }
+    m_ouChunks.clear();
+    m_ouKeyOrdinals.clear();
+    m_ouKeys.clear();
+    m_bKeyOverflow = false;
+    m_unOpenRows = 0;
+    m_nRowCount = 0;
+    m_un64EvictedRows = 0;
+    m_llLastTime = 0;
+    m_nMemoryUsed = 0;
+    m_ouViewKeyPass.clear();
+    m_ouView.clear();
+    m_nViewStart = 0;
+    m_bViewSorted = false;
+    m_bViewActive = m_bViewFiltered;
+    m_ouViewPos.clear();
+    m_ouViewBlockTree.clear();
+    m_nViewDropped = 0;
+    m_lLayoutVersion++;
+    m_lViewVersion++;
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  vSetMemoryBudget
+  Input(s)         :  nBytes - Memory the stored frames may occupy
+  Output           :  void
+  Functionality    :  Sets the memory budget, the oldest frames are dropped
+                      when it is exceeded.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vSetMemoryBudget(size_t nBytes)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_nMemoryBudget = nBytes;
+    vEvictChunks();
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  nGetMemoryUsed
+  Input(s)         :  void
+  Output           :  Bytes held by the completed chunks and their index
+  Functionality    :  Returns the memory used by the stored frames.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+size_t CMsgFrameStoreCAN::nGetMemoryUsed(void) const
+{
+    return m_nMemoryUsed;
+}
+
+/******************************************************************************
+  Function Name    :  GetBufferLength
+  Input(s)         :  void
+  Output           :  Number of displayed frames
+  Functionality    :  Returns the number of rows of the current view.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+int CMsgFrameStoreCAN::GetBufferLength(void) const
+{
+    return (true == m_bViewActive) ? (int)(m_ouView.size() - m_nViewStart - m_nViewDropped) : m_nRowCount;
+}
+
+/******************************************************************************
+  Function Name    :  llGetLastTime
+  Input(s)         :  void
+  Output           :  Time stamp of the latest frame, 0 if there is none
+  Functionality    :  Returns the time stamp of the latest frame.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+LONGLONG CMsgFrameStoreCAN::llGetLastTime(void) const
+{
+    return m_llLastTime;
+}
+
+/******************************************************************************
+  Function Name    :  unGetLayoutVersion
+  Input(s)         :  void
+  Output           :  Layout version
+  Functionality    :  Returns a number that changes when rows are dropped,
+                      sorted, filtered or cleared.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+UINT CMsgFrameStoreCAN::unGetLayoutVersion(void) const
+{
+    return (UINT)m_lLayoutVersion;
+}
+
+/******************************************************************************
+  Function Name    :  vSealOpenChunk
+  Input(s)         :  void
+  Output           :  void
+  Functionality    :  Moves the records of the full chunk from the write
+                      area to an allocation of their exact size.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vSealOpenChunk(void)
+{
+    sCHUNK* psChunk = m_ouChunks.back();
+    BYTE* pbyRecords = new BYTE[ psChunk->m_unSize ];
+    memcpy(pbyRecords, m_abyOpenRecords, psChunk->m_unSize);
+    psChunk->m_pbyRecords = pbyRecords;
+    m_nMemoryUsed += sizeof(sCHUNK) + psChunk->m_unSize + defFRAME_STORE_CHUNK_ROWS * sizeof(FRAMEROW);
+}
+
+/******************************************************************************
+  Function Name    :  vDeleteChunk
+  Input(s)         :  psChunk - Chunk no longer stored
+  Output           :  void
+  Functionality    :  Frees a chunk, or leaves it to the sort decoding it.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vDeleteChunk(sCHUNK* psChunk)
+{
+    if (psChunk->m_nSortRefs > 0)
+    {
+        psChunk->m_bDropped = true;
+        return;
+    }
+    if (psChunk->m_pbyRecords != m_abyOpenRecords)
+    {
+        delete[] psChunk->m_pbyRecords;
+    }
+    delete psChunk;
+}
+
+/******************************************************************************
+  Function Name    :  vEvictChunks
+  Input(s)         :  void
+  Output           :  void
+  Functionality    :  Drops the oldest chunks while the budget is exceeded.
+                      The rows shift down and leave the key row lists and
+                      the view. In a sorted view they are only marked, so
+                      the cost does not depend on the view size.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vEvictChunks(void)
+{
+    bool bEvicted = false;
+    while (m_nMemoryUsed > m_nMemoryBudget && m_ouChunks.size() > 1)
+    {
+        sCHUNK* psChunk = m_ouChunks.front();
+        m_ouChunks.pop_front();
+        m_nMemoryUsed -= sizeof(sCHUNK) + psChunk->m_unSize + defFRAME_STORE_CHUNK_ROWS * sizeof(FRAMEROW);
+        m_nRowCount -= defFRAME_STORE_CHUNK_ROWS;
+        m_un64EvictedRows += defFRAME_STORE_CHUNK_ROWS;
+
+        //The dropped rows are the first ones of their keys
+        for (UINT unSlot = 0; unSlot < defFRAME_STORE_CHUNK_ROWS; unSlot++)
+        {
+            if (true == m_bViewActive && true == m_bViewSorted)
+            {
+                vDropSortedViewRow(m_un64EvictedRows - defFRAME_STORE_CHUNK_ROWS + unSlot);
+            }
+            if (defFRAME_STORE_NO_KEY != psChunk->m_ausKey[unSlot])
+            {
+                sKEYINDEX& sKey = m_ouKeys[ psChunk->m_ausKey[unSlot] ];
+                if (++sKey.m_nStart >= defFRAME_STORE_COMPACT_ROWS && sKey.m_nStart * 2 >= sKey.m_ouRows.size())
+                {
+                    sKey.m_ouRows.erase(sKey.m_ouRows.begin(), sKey.m_ouRows.begin() + sKey.m_nStart);
+                    sKey.m_nStart = 0;
+                }
+            }
+        }
+        vDeleteChunk(psChunk);
+        bEvicted = true;
+    }
+
+    if (true == bEvicted)
+    {
+        m_lLayoutVersion++;
+    }
+    if (true == bEvicted && true == m_bViewActive)
+    {
+        if (true == m_bViewSorted)
+        {
+            //Compacting visits the whole view, it is done once half of it is dropped
+            if (m_nViewDropped >= defFRAME_STORE_COMPACT_ROWS && m_nViewDropped * 2 >= m_ouView.size())
+            {
+                m_ouView.erase(std::remove(m_ouView.begin(), m_ouView.end(), defFRAME_STORE_NO_ROW), m_ouView.end());
+                vIndexSortedView();
+            }
+        }
+        else
+        {
+            while (m_nViewStart < m_ouView.size() && m_ouView[m_nViewStart] < m_un64EvictedRows)
+            {
+                m_nViewStart++;
+            }
+            if (m_nViewStart >= defFRAME_STORE_COMPACT_ROWS && m_nViewStart * 2 >= m_ouView.size())
+            {
+                m_ouView.erase(m_ouView.begin(), m_ouView.begin() + m_nViewStart);
+                m_nViewStart = 0;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+  Function Name    :  un64GetFrameKey
+  Input(s)         :  sMsg - Frame
+  Output           :  Key of the frame
+  Functionality    :  Combines everything the message filters look at: data
+                      type, identifier, channel and frame format.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+unsigned __int64 CMsgFrameStoreCAN::un64GetFrameKey(const STCANDATASPL& sMsg)
+{
+    const STCAN_MSG& sCanMsg = sMsg.m_uDataInfo.m_sCANMsg;
+    unsigned __int64 un64Key = sCanMsg.m_unMsgID;
+    un64Key |= (unsigned __int64)sMsg.m_ucDataType << 32;
+    un64Key |= (unsigned __int64)sCanMsg.m_ucChannel << 40;
+    un64Key |= (unsigned __int64)((0 != sCanMsg.m_ucEXTENDED) ? 1 : 0) << 48;
+    un64Key |= (unsigned __int64)((0 != sCanMsg.m_ucRTR) ? 1 : 0) << 49;
+    un64Key |= (unsigned __int64)((true == sCanMsg.m_bCANFD) ? 1 : 0) << 50;
+    return un64Key;
+}
+
+/******************************************************************************
+  Function Name    :  usGetKeyOrdinal
+  Input(s)         :  sMsg - Frame
+  Output           :  Ordinal of the frame key or defFRAME_STORE_NO_KEY
+  Functionality    :  Looks up the key of a frame, new keys are added while
+                      there are ordinals left.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+USHORT CMsgFrameStoreCAN::usGetKeyOrdinal(const STCANDATASPL& sMsg)
+{
+    unsigned __int64 un64Key = un64GetFrameKey(sMsg);
+    auto itrOrdinal = m_ouKeyOrdinals.find(un64Key);
+    if (m_ouKeyOrdinals.end() != itrOrdinal)
+    {
+        return itrOrdinal->second;
+    }
+    if (m_ouKeys.size() >= defFRAME_STORE_NO_KEY)
+    {
+        m_bKeyOverflow = true;
+        return defFRAME_STORE_NO_KEY;
+    }
+
+    USHORT usOrdinal = (USHORT)m_ouKeys.size();
+    m_ouKeys.push_back(sKEYINDEX());
+    sKEYINDEX& sKey = m_ouKeys.back();
+    sKey.m_un64Key = un64Key;
+    sKey.m_sSample = sMsg;
+    sKey.m_nStart = 0;
+    m_ouKeyOrdinals[un64Key] = usOrdinal;
+    return usOrdinal;
+}
+
+/******************************************************************************
+  Function Name    :  WriteIntoBuffer
+  Input(s)         :  psMsg - The source message entry. An [in] parameter.
+  Output           :  CALL_SUCCESS
+  Functionality    :  Encodes a frame as the last row and adds it to the
+                      index and to the view if it matches the applied query.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+int CMsgFrameStoreCAN::WriteIntoBuffer(const STCANDATASPL* psMsg)
+{
+    EnterCriticalSection(&m_omCritSec);
+
+    if (m_ouChunks.empty() || defFRAME_STORE_CHUNK_ROWS == m_unOpenRows)
+    {
+        if (false == m_ouChunks.empty())
+        {
+            vSealOpenChunk();
+        }
+        sCHUNK* psChunk = new sCHUNK;
+        psChunk->m_llBaseTime = psMsg->m_lTickCount.QuadPart;
+        psChunk->m_pbyRecords = m_abyOpenRecords;
+        psChunk->m_unSize = 0;
+        psChunk->m_nSortRefs = 0;
+        psChunk->m_bDropped = false;
+        m_ouChunks.push_back(psChunk);
+        m_unOpenRows = 0;
+        vEvictChunks();
+    }
+
+    sCHUNK* psChunk = m_ouChunks.back();
+    LONGLONG llTime = psMsg->m_lTickCount.QuadPart;
+    BYTE* pbyStart = m_abyOpenRecords + psChunk->m_unSize;
+    BYTE* pbyRecord = pbyStart;
+    BYTE byFlags = 0;
+    if (0 == m_unOpenRows || psMsg->m_nDeltime != _abs64(llTime - m_llLastTime))
+    {
+        byFlags |= defRECORD_DELTIME;
+    }
+
+    *pbyRecord++ = psMsg->m_ucDataType;
+    BYTE* pbyFlags = pbyRecord++;
+    LONGLONG llDelta = llTime - psChunk->m_llBaseTime;
+    pbyRecord = pbyPutVarint(pbyRecord, ((unsigned __int64)llDelta << 1) ^ (unsigned __int64)(llDelta >> 63));
+    if (0 != (byFlags & defRECORD_DELTIME))
+    {
+        pbyRecord = pbyPutVarint(pbyRecord, (unsigned __int64)psMsg->m_nDeltime);
+    }
+    if (IS_A_MESSAGE(psMsg->m_ucDataType))
+    {
+        const STCAN_MSG& sCanMsg = psMsg->m_uDataInfo.m_sCANMsg;
+        byFlags |= (0 != sCanMsg.m_ucEXTENDED) ? defRECORD_EXTENDED : 0;
+        byFlags |= (0 != sCanMsg.m_ucRTR) ? defRECORD_RTR : 0;
+        byFlags |= (true == sCanMsg.m_bCANFD) ? defRECORD_CANFD : 0;
+        pbyRecord = pbyPutVarint(pbyRecord, sCanMsg.m_unMsgID);
+        *pbyRecord++ = sCanMsg.m_ucChannel;
+        *pbyRecord++ = sCanMsg.m_ucDataLen;
+        if (0 == sCanMsg.m_ucRTR)
+        {
+            int nDataLen = min((int)sCanMsg.m_ucDataLen, (int)sizeof(sCanMsg.m_ucData));
+            memcpy(pbyRecord, sCanMsg.m_ucData, nDataLen);
+            pbyRecord += nDataLen;
+        }
+    }
+    else
+    {
+        memcpy(pbyRecord, &psMsg->m_uDataInfo.m_sErrInfo, sizeof(SERROR_INFO));
+        pbyRecord += sizeof(SERROR_INFO);
+    }
+    *pbyFlags = byFlags;
+
+    FRAMEROW un64Row = m_un64EvictedRows + (FRAMEROW)m_nRowCount;
+    USHORT usKey = usGetKeyOrdinal(*psMsg);
+    if (defFRAME_STORE_NO_KEY != usKey)
+    {
+        m_ouKeys[usKey].m_ouRows.push_back(un64Row);
+    }
+    psChunk->m_ausOffset[m_unOpenRows] = (USHORT)psChunk->m_unSize;
+    psChunk->m_ausKey[m_unOpenRows] = usKey;
+    psChunk->m_unSize += (UINT)(pbyRecord - pbyStart);
+    m_unOpenRows++;
+    m_nRowCount++;
+    m_llLastTime = llTime;
+
+    if (true == m_bViewActive)
+    {
+        bool bShown = (false == m_bViewFiltered || true == bRowPasses(m_sViewQuery, un64Row, m_ouViewKeyPass));
+        if (true == m_bViewSorted)
+        {
+            m_ouViewPos.push_back((true == bShown) ? (UINT)m_ouView.size() : defFRAME_STORE_NO_POS);
+        }
+        if (true == bShown && true == m_bViewSorted)
+        {
+            vPushSortedViewRow(un64Row);
+        }
+        else if (true == bShown)
+        {
+            m_ouView.push_back(un64Row);
+        }
+    }
+
+    LeaveCriticalSection(&m_omCritSec);
+    return CALL_SUCCESS;
+}
+
+/******************************************************************************
+  Function Name    :  pbyDecodeTime
+  Input(s)         :  psChunk - Chunk of the row
+                      unSlot - Row within the chunk
+                      llTime - Time stamp of the row. An [out] parameter.
+                      byFlags - Record flags. An [out] parameter.
+  Output           :  Position after the time stamp
+  Functionality    :  Decodes the header of a record.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+const BYTE* CMsgFrameStoreCAN::pbyDecodeTime(const sCHUNK* psChunk, UINT unSlot, LONGLONG& llTime, BYTE& byFlags)
+{
+    const BYTE* pbyRecord = psChunk->m_pbyRecords + psChunk->m_ausOffset[unSlot];
+    byFlags = pbyRecord[1];
+    unsigned __int64 un64Delta = 0;
+    pbyRecord = pbyGetVarint(pbyRecord + 2, un64Delta);
+    llTime = psChunk->m_llBaseTime + (LONGLONG)((un64Delta >> 1) ^ (0 - (un64Delta & 1)));
+    return pbyRecord;
+}
+
+/******************************************************************************
+  Function Name    :  llGetRowTime
+  Input(s)         :  un64Row - Stored row number
+  Output           :  Time stamp of the row
+  Functionality    :  Decodes only the time stamp of a row.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+LONGLONG CMsgFrameStoreCAN::llGetRowTime(FRAMEROW un64Row) const
+{
+    const sCHUNK* psChunk = m_ouChunks[(size_t)((un64Row - m_un64EvictedRows) / defFRAME_STORE_CHUNK_ROWS)];
+    LONGLONG llTime = 0;
+    BYTE byFlags = 0;
+    pbyDecodeTime(psChunk, (UINT)(un64Row % defFRAME_STORE_CHUNK_ROWS), llTime, byFlags);
+    return llTime;
+}
+
+/******************************************************************************
+  Function Name    :  vDecodeRecord
+  Input(s)         :  psChunk - Chunk of the row
+                      unSlot - Row within the chunk
+                      sMsg - The target message entry. An [out] parameter.
+  Output           :  void
+  Functionality    :  Decodes a record, at most the previous record's time
+                      stamp is read besides the record itself.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vDecodeRecord(const sCHUNK* psChunk, UINT unSlot, STCANDATASPL& sMsg)
+{
+    LONGLONG llTime = 0;
+    BYTE byFlags = 0;
+    const BYTE* pbyRecord = pbyDecodeTime(psChunk, unSlot, llTime, byFlags);
+
+    memset(&sMsg.m_uDataInfo, 0, sizeof(sMsg.m_uDataInfo));
+    sMsg.m_ucDataType = psChunk->m_pbyRecords[ psChunk->m_ausOffset[unSlot] ];
+    sMsg.m_lTickCount.QuadPart = llTime;
+    if (0 != (byFlags & defRECORD_DELTIME))
+    {
+        unsigned __int64 un64Deltime = 0;
+        pbyRecord = pbyGetVarint(pbyRecord, un64Deltime);
+        sMsg.m_nDeltime = (__int64)un64Deltime;
+    }
+    else
+    {
+        LONGLONG llPrevTime = 0;
+        BYTE byPrevFlags = 0;
+        pbyDecodeTime(psChunk, unSlot - 1, llPrevTime, byPrevFlags);
+        sMsg.m_nDeltime = _abs64(llTime - llPrevTime);
+    }
+    if (IS_A_MESSAGE(sMsg.m_ucDataType))
+    {
+        STCAN_MSG& sCanMsg = sMsg.m_uDataInfo.m_sCANMsg;
+        unsigned __int64 un64MsgID = 0;
+        pbyRecord = pbyGetVarint(pbyRecord, un64MsgID);
+        sCanMsg.m_unMsgID = (unsigned int)un64MsgID;
+        sCanMsg.m_ucChannel = *pbyRecord++;
+        sCanMsg.m_ucDataLen = *pbyRecord++;
+        sCanMsg.m_ucEXTENDED = (0 != (byFlags & defRECORD_EXTENDED)) ? 1 : 0;
+        sCanMsg.m_ucRTR = (0 != (byFlags & defRECORD_RTR)) ? 1 : 0;
+        sCanMsg.m_bCANFD = (0 != (byFlags & defRECORD_CANFD));
+        if (0 == sCanMsg.m_ucRTR)
+        {
+            memcpy(sCanMsg.m_ucData, pbyRecord, min((int)sCanMsg.m_ucDataLen, (int)sizeof(sCanMsg.m_ucData)));
+        }
+    }
+    else
+    {
+        memcpy(&sMsg.m_uDataInfo.m_sErrInfo, pbyRecord, sizeof(SERROR_INFO));
+    }
+}
+
+/******************************************************************************
+  Function Name    :  vDecodeRow
+  Input(s)         :  un64Row - Stored row number
+                      sMsg - The target message entry. An [out] parameter.
+  Output           :  void
+  Functionality    :  Decodes a stored row.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vDecodeRow(FRAMEROW un64Row, STCANDATASPL& sMsg)
+{
+    //Dropped rows are whole chunks, so the slot does not depend on them
+    const sCHUNK* psChunk = m_ouChunks[(size_t)((un64Row - m_un64EvictedRows) / defFRAME_STORE_CHUNK_ROWS)];
+    vDecodeRecord(psChunk, (UINT)(un64Row % defFRAME_STORE_CHUNK_ROWS), sMsg);
+}
+
+/******************************************************************************
+  Function Name    :  ReadFromBuffer
+  Input(s)         :  psMsg - The target message entry. An [out] parameter.
+                      nIndex - Row in display order
+  Output           :  EMPTY_APP_BUFFER if buffer is empty, ERR_INVALID_INDEX
+                      for a row out of range; else CALL_SUCCESS.
+  Functionality    :  Reads the frame of a row.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+int CMsgFrameStoreCAN::ReadFromBuffer(STCANDATASPL* psMsg, int nIndex)
+{
+    int nResult = CALL_SUCCESS;
+
+    EnterCriticalSection(&m_omCritSec);
+    int nLength = GetBufferLength();
+    if (0 == nLength)
+    {
+        nResult = EMPTY_APP_BUFFER;
+    }
+    else if (nIndex < 0 || nIndex >= nLength)
+    {
+        nResult = ERR_INVALID_INDEX;
+    }
+    else
+    {
+        vDecodeRow(un64GetViewRow(nIndex), *psMsg);
+    }
+    LeaveCriticalSection(&m_omCritSec);
+
+    return nResult;
+}
+
+/******************************************************************************
+  Function Name    :  un64GetViewRow
+  Input(s)         :  nIndex - Row in display order, within the view
+  Output           :  Stored row number
+  Functionality    :  Maps a display index to its row. In a sorted view with
+                      dropped rows the block counts give the block of the
+                      index, only that block is scanned.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+FRAMEROW CMsgFrameStoreCAN::un64GetViewRow(int nIndex)
+{
+    if (false == m_bViewActive)
+    {
+        return m_un64EvictedRows + (FRAMEROW)nIndex;
+    }
+    if (0 == m_nViewDropped)
+    {
+        return m_ouView[m_nViewStart + nIndex];
+    }
+
+    //Descends the Fenwick tree to the block holding the nIndex-th shown row
+    size_t nBlocks = m_ouViewBlockTree.size() - 1;
+    size_t nNode = 0;
+    UINT unLeft = (UINT)nIndex;
+    size_t nStep = 1;
+    while (nStep * 2 <= nBlocks)
+    {
+        nStep *= 2;
+    }
+    for (; nStep > 0; nStep /= 2)
+    {
+        if (nNode + nStep <= nBlocks && m_ouViewBlockTree[nNode + nStep] <= unLeft)
+        {
+            nNode += nStep;
+            unLeft -= m_ouViewBlockTree[nNode];
+        }
+    }
+    size_t nPos = nNode * defFRAME_STORE_VIEW_BLOCK;
+    for (; nPos < m_ouView.size(); nPos++)
+    {
+        if (defFRAME_STORE_NO_ROW != m_ouView[nPos])
+        {
+            if (0 == unLeft)
+            {
+                break;
+            }
+            unLeft--;
+        }
+    }
+    return m_ouView[nPos];
+}
+
+/******************************************************************************
+  Function Name    :  vAddViewBlockRows
+  Input(s)         :  nBlock - Block of view positions
+                      nRows - Shown rows added to the block, negative if
+                              dropped
+  Output           :  void
+  Functionality    :  Updates the Fenwick tree of the sorted view.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vAddViewBlockRows(size_t nBlock, int nRows)
+{
+    for (size_t nNode = nBlock + 1; nNode < m_ouViewBlockTree.size(); nNode += (nNode & (0 - nNode)))
+    {
+        m_ouViewBlockTree[nNode] += nRows;
+    }
+}
+
+/******************************************************************************
+  Function Name    :  vIndexSortedView
+  Input(s)         :  void
+  Output           :  void
+  Functionality    :  Builds the position of every stored row and the block
+                      counts of a sorted view without dropped rows. After a
+                      compaction only the positions of the view rows are
+                      rewritten.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vIndexSortedView(void)
+{
+    if (m_un64ViewPosBase != m_un64EvictedRows || m_ouViewPos.size() != (size_t)m_nRowCount)
+    {
+        m_un64ViewPosBase = m_un64EvictedRows;
+        m_ouViewPos.assign((size_t)m_nRowCount, defFRAME_STORE_NO_POS);
+    }
+    for (size_t nPos = 0; nPos < m_ouView.size(); nPos++)
+    {
+        m_ouViewPos[(size_t)(m_ouView[nPos] - m_un64ViewPosBase)] = (UINT)nPos;
+    }
+
+    //Node n covers the blocks after n - lowbit(n) up to n
+    size_t nBlocks = (m_ouView.size() + defFRAME_STORE_VIEW_BLOCK - 1) / defFRAME_STORE_VIEW_BLOCK;
+    m_ouViewBlockTree.assign(nBlocks + 1, 0);
+    for (size_t nNode = 1; nNode <= nBlocks; nNode++)
+    {
+        size_t nEnd = min(nNode * defFRAME_STORE_VIEW_BLOCK, m_ouView.size());
+        m_ouViewBlockTree[nNode] += (UINT)(nEnd - (nNode - 1) * defFRAME_STORE_VIEW_BLOCK);
+        size_t nParent = nNode + (nNode & (0 - nNode));
+        if (nParent <= nBlocks)
+        {
+            m_ouViewBlockTree[nParent] += m_ouViewBlockTree[nNode];
+        }
+    }
+    m_nViewDropped = 0;
+}
+
+/******************************************************************************
+  Function Name    :  vPushSortedViewRow
+  Input(s)         :  un64Row - Row arrived after the sort
+  Output           :  void
+  Functionality    :  Appends a row to the sorted view and its block count.
+                      The caller records its position.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vPushSortedViewRow(FRAMEROW un64Row)
+{
+    size_t nBlock = m_ouView.size() / defFRAME_STORE_VIEW_BLOCK;
+    m_ouView.push_back(un64Row);
+    if (nBlock + 1 == m_ouViewBlockTree.size())
+    {
+        //A new node covers the blocks after nNode - lowbit(nNode), sum them
+        size_t nNode = nBlock + 1;
+        UINT unSum = 0;
+        for (size_t nChild = nNode - 1; nChild > nNode - (nNode & (0 - nNode)); nChild -= (nChild & (0 - nChild)))
+        {
+            unSum += m_ouViewBlockTree[nChild];
+        }
+        m_ouViewBlockTree.push_back(unSum);
+    }
+    vAddViewBlockRows(nBlock, 1);
+}
+
+/******************************************************************************
+  Function Name    :  vDropSortedViewRow
+  Input(s)         :  un64Row - Row dropped from the store
+  Output           :  void
+  Functionality    :  Marks the position of the row in the sorted view, the
+                      view is compacted later. Rows are dropped oldest
+                      first, so the row is the first one of the positions.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vDropSortedViewRow(FRAMEROW un64Row)
+{
+    if (un64Row != m_un64ViewPosBase || m_ouViewPos.empty())
+    {
+        return;
+    }
+    UINT unPos = m_ouViewPos.front();
+    m_ouViewPos.pop_front();
+    m_un64ViewPosBase++;
+    if (defFRAME_STORE_NO_POS != unPos)
+    {
+        m_ouView[unPos] = defFRAME_STORE_NO_ROW;
+        vAddViewBlockRows(unPos / defFRAME_STORE_VIEW_BLOCK, -1);
+        m_nViewDropped++;
+    }
+}
+
+/******************************************************************************
+  Function Name    :  vDoSortBuffer
+  Input(s)         :  nField - The column to be used as the sorting key.
+                      bAscending - Sorting order
+                      psSymbols - Message names of the databases
+  Output           :  -
+  Functionality    :  Builds the display order of the rows of the current
+                      view. The frames are not moved, equal keys keep their
+                      order. Rows added later follow in arrival order.
+                      The rows are taken under the lock, the keys of the
+                      completed chunks are decoded and sorted outside of it
+                      while the chunks are held. Rows dropped meanwhile are
+                      left out, rows added meanwhile follow the sorted ones.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vDoSortBuffer(int nField, bool bAscending, const CCanSymbols* psSymbols)
+{
+    struct sSORTKEY
+    {
+        LONGLONG m_llKey;
+        FRAMEROW m_un64Row;
+        const sCHUNK* m_psChunk;                    //nullptr if the key is decoded under the lock
+    };
+
+    EColumnType eColumn = (EColumnType)nField;
+    if (!(eTimeStampCol == eColumn || eChannelCol == eColumn || eCANIDCol == eColumn
+            || (eMsgNameCol == eColumn && nullptr != psSymbols)))
+    {
+        EnterCriticalSection(&m_omCritSec);
+        if (true == m_bViewSorted)
+        {
+            vResetViewOrder();
+        }
+        LeaveCriticalSection(&m_omCritSec);
+        return;
+    }
+
+    auto llGetKey = [eColumn, psSymbols](const STCANDATASPL& sMsg) -> LONGLONG
+    {
+        switch (eColumn)
+        {
+            case eTimeStampCol:
+                return sMsg.m_lTickCount.QuadPart;
+            case eChannelCol:
+                return sMsg.m_uDataInfo.m_sCANMsg.m_ucChannel;
+            case eMsgNameCol:
+                return psSymbols->unGetNameRank(sMsg.m_uDataInfo.m_sCANMsg.m_ucChannel, sMsg.m_uDataInfo.m_sCANMsg.m_unMsgID);
+            default:
+                return sMsg.m_uDataInfo.m_sCANMsg.m_unMsgID;
+        }
+    };
+
+    std::vector<sSORTKEY> ouKeys;
+    std::vector<sCHUNK*> ouHeldChunks;
+    STCANDATASPL sMsg;
+
+    EnterCriticalSection(&m_omCritSec);
+    LONG lViewVersion = m_lViewVersion;
+    FRAMEROW un64End = m_un64EvictedRows + (FRAMEROW)m_nRowCount;
+    int nLength = GetBufferLength();
+    ouKeys.reserve(nLength);
+    for (auto itrChunk = m_ouChunks.begin(); itrChunk != m_ouChunks.end(); ++itrChunk)
+    {
+        if ((*itrChunk)->m_pbyRecords != m_abyOpenRecords)
+        {
+            (*itrChunk)->m_nSortRefs++;
+            ouHeldChunks.push_back(*itrChunk);
+        }
+    }
+    size_t nPos = m_nViewStart;
+    for (int nIndex = 0; nIndex < nLength; nIndex++)
+    {
+        sSORTKEY sKey;
+        if (true == m_bViewActive)
+        {
+            while (defFRAME_STORE_NO_ROW == m_ouView[nPos])
+            {
+                nPos++;
+            }
+            sKey.m_un64Row = m_ouView[nPos++];
+        }
+        else
+        {
+            sKey.m_un64Row = m_un64EvictedRows + (FRAMEROW)nIndex;
+        }
+        sKey.m_llKey = 0;
+        sKey.m_psChunk = m_ouChunks[(size_t)((sKey.m_un64Row - m_un64EvictedRows) / defFRAME_STORE_CHUNK_ROWS)];
+        //The open chunk is written on, its rows are decoded now
+        if (sKey.m_psChunk->m_pbyRecords == m_abyOpenRecords)
+        {
+            vDecodeRecord(sKey.m_psChunk, (UINT)(sKey.m_un64Row % defFRAME_STORE_CHUNK_ROWS), sMsg);
+            sKey.m_llKey = llGetKey(sMsg);
+            sKey.m_psChunk = nullptr;
+        }
+        ouKeys.push_back(sKey);
+    }
+    LeaveCriticalSection(&m_omCritSec);
+
+    for (auto itrKey = ouKeys.begin(); itrKey != ouKeys.end(); ++itrKey)
+    {
+        if (nullptr != itrKey->m_psChunk)
+        {
+            vDecodeRecord(itrKey->m_psChunk, (UINT)(itrKey->m_un64Row % defFRAME_STORE_CHUNK_ROWS), sMsg);
+            itrKey->m_llKey = llGetKey(sMsg);
+        }
+    }
+    std::stable_sort(ouKeys.begin(), ouKeys.end(), [bAscending](const sSORTKEY& sLeft, const sSORTKEY& sRight)
+    {
+        return (true == bAscending) ? (sLeft.m_llKey < sRight.m_llKey) : (sLeft.m_llKey > sRight.m_llKey);
+    });
+
+    EnterCriticalSection(&m_omCritSec);
+    for (auto itrChunk = ouHeldChunks.begin(); itrChunk != ouHeldChunks.end(); ++itrChunk)
+    {
+        (*itrChunk)->m_nSortRefs--;
+        if (true == (*itrChunk)->m_bDropped)
+        {
+            vDeleteChunk(*itrChunk);
+        }
+    }
+    //A view rebuilt meanwhile wins over the sort
+    if (lViewVersion == m_lViewVersion)
+    {
+        FRAMEROW un64NewEnd = m_un64EvictedRows + (FRAMEROW)m_nRowCount;
+        std::vector<FRAMEROW> ouView;
+        ouView.reserve(ouKeys.size() + (size_t)(un64NewEnd - un64End));
+        for (auto itrKey = ouKeys.begin(); itrKey != ouKeys.end(); ++itrKey)
+        {
+            if (itrKey->m_un64Row >= m_un64EvictedRows)
+            {
+                ouView.push_back(itrKey->m_un64Row);
+            }
+        }
+        if (true == m_bViewActive)
+        {
+            //Rows added meanwhile were appended in arrival order, the view may be compacted since
+            size_t nView = m_ouView.size();
+            while (nView > m_nViewStart && (defFRAME_STORE_NO_ROW == m_ouView[nView - 1] || m_ouView[nView - 1] >= un64End))
+            {
+                nView--;
+            }
+            for (; nView < m_ouView.size(); nView++)
+            {
+                if (defFRAME_STORE_NO_ROW != m_ouView[nView])
+                {
+                    ouView.push_back(m_ouView[nView]);
+                }
+            }
+        }
+        else
+        {
+            for (FRAMEROW un64Row = max(un64End, m_un64EvictedRows); un64Row < un64NewEnd; un64Row++)
+            {
+                ouView.push_back(un64Row);
+            }
+        }
+        m_ouView.swap(ouView);
+        m_nViewStart = 0;
+        m_bViewActive = true;
+        m_bViewSorted = true;
+        m_ouViewPos.clear();
+        vIndexSortedView();
+        m_lLayoutVersion++;
+        m_lViewVersion++;
+    }
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  vResetViewOrder
+  Input(s)         :  void
+  Output           :  void
+  Functionality    :  Returns the view to arrival order: the rows matching
+                      the applied query or all rows.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vResetViewOrder(void)
+{
+    m_lLayoutVersion++;
+    m_lViewVersion++;
+    m_bViewSorted = false;
+    m_nViewStart = 0;
+    m_ouViewPos.clear();
+    m_ouViewBlockTree.clear();
+    m_nViewDropped = 0;
+    if (true == m_bViewFiltered)
+    {
+        vSelectRows(m_sViewQuery, m_ouViewKeyPass, m_ouView);
+    }
+    else
+    {
+        m_bViewActive = false;
+        m_ouView.clear();
+    }
+}
+
+/******************************************************************************
+  Function Name    :  bKeyPasses
+  Input(s)         :  sQuery - Query
+                      usKey - Key ordinal
+                      ouKeyPass - Filter results of the query per key
+  Output           :  true if frames of the key match the query filter
+  Functionality    :  Evaluates the query filter once per key.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+bool CMsgFrameStoreCAN::bKeyPasses(const SFRAMEQUERY& sQuery, USHORT usKey, std::vector<char>& ouKeyPass)
+{
+    if (nullptr == sQuery.m_pfFilter)
+    {
+        return true;
+    }
+    if (usKey >= ouKeyPass.size())
+    {
+        ouKeyPass.resize(m_ouKeys.size(), -1);
+    }
+    if (-1 == ouKeyPass[usKey])
+    {
+        ouKeyPass[usKey] = (TRUE == sQuery.m_pfFilter(m_ouKeys[usKey].m_sSample, sQuery.m_pvParam)) ? 1 : 0;
+    }
+    return (1 == ouKeyPass[usKey]);
+}
+
+/******************************************************************************
+  Function Name    :  bRowPasses
+  Input(s)         :  sQuery - Query
+                      un64Row - Stored row number
+                      ouKeyPass - Filter results of the query per key
+  Output           :  true if the row matches the query
+  Functionality    :  Checks the time range and the filter result of the
+                      row's key. Rows without key are decoded and filtered.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+bool CMsgFrameStoreCAN::bRowPasses(const SFRAMEQUERY& sQuery, FRAMEROW un64Row, std::vector<char>& ouKeyPass)
+{
+    const sCHUNK* psChunk = m_ouChunks[(size_t)((un64Row - m_un64EvictedRows) / defFRAME_STORE_CHUNK_ROWS)];
+    UINT unSlot = (UINT)(un64Row % defFRAME_STORE_CHUNK_ROWS);
+    if (LLONG_MIN != sQuery.m_llFromTime || LLONG_MAX != sQuery.m_llToTime)
+    {
+        LONGLONG llTime = 0;
+        BYTE byFlags = 0;
+        pbyDecodeTime(psChunk, unSlot, llTime, byFlags);
+        if (llTime < sQuery.m_llFromTime || llTime > sQuery.m_llToTime)
+        {
+            return false;
+        }
+    }
+    if (defFRAME_STORE_NO_KEY != psChunk->m_ausKey[unSlot])
+    {
+        return bKeyPasses(sQuery, psChunk->m_ausKey[unSlot], ouKeyPass);
+    }
+    if (nullptr == sQuery.m_pfFilter)
+    {
+        return true;
+    }
+    STCANDATASPL sMsg;
+    vDecodeRecord(psChunk, unSlot, sMsg);
+    return (TRUE == sQuery.m_pfFilter(sMsg, sQuery.m_pvParam));
+}
+
+/******************************************************************************
+  Function Name    :  vSelectRows
+  Input(s)         :  sQuery - Query
+                      ouKeyPass - Filter results of the query per key
+                      ouRows - Matching rows in arrival order. An [out] parameter.
+  Output           :  void
+  Functionality    :  Finds the stored rows matching a query. When the
+                      matching keys hold few rows only their row lists are
+                      visited, else the key ordinals of all rows are checked.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vSelectRows(const SFRAMEQUERY& sQuery, std::vector<char>& ouKeyPass, std::vector<FRAMEROW>& ouRows)
+{
+    ouRows.clear();
+
+    size_t nCandidates = 0;
+    int nMatchingKeys = 0;
+    for (USHORT usKey = 0; usKey < m_ouKeys.size(); usKey++)
+    {
+        if (true == bKeyPasses(sQuery, usKey, ouKeyPass))
+        {
+            nCandidates += m_ouKeys[usKey].m_ouRows.size() - m_ouKeys[usKey].m_nStart;
+            nMatchingKeys++;
+        }
+    }
+
+    if (false == m_bKeyOverflow && nCandidates * 4 < (size_t)m_nRowCount)
+    {
+        ouRows.reserve(nCandidates);
+        for (USHORT usKey = 0; usKey < m_ouKeys.size(); usKey++)
+        {
+            if (true == bKeyPasses(sQuery, usKey, ouKeyPass))
+            {
+                const sKEYINDEX& sKey = m_ouKeys[usKey];
+                ouRows.insert(ouRows.end(), sKey.m_ouRows.begin() + sKey.m_nStart, sKey.m_ouRows.end());
+            }
+        }
+        if (nMatchingKeys > 1)
+        {
+            std::sort(ouRows.begin(), ouRows.end());
+        }
+        if (LLONG_MIN != sQuery.m_llFromTime || LLONG_MAX != sQuery.m_llToTime)
+        {
+            ouRows.erase(std::remove_if(ouRows.begin(), ouRows.end(), [this, &sQuery](FRAMEROW un64Row)
+            {
+                LONGLONG llTime = llGetRowTime(un64Row);
+                return (llTime < sQuery.m_llFromTime || llTime > sQuery.m_llToTime);
+            }), ouRows.end());
+        }
+    }
+    else
+    {
+        FRAMEROW un64End = m_un64EvictedRows + (FRAMEROW)m_nRowCount;
+        for (FRAMEROW un64Row = m_un64EvictedRows; un64Row < un64End; un64Row++)
+        {
+            if (true == bRowPasses(sQuery, un64Row, ouKeyPass))
+            {
+                ouRows.push_back(un64Row);
+            }
+        }
+    }
+}
+
+/******************************************************************************
+  Function Name    :  vApplyView
+  Input(s)         :  sQuery - Query
+  Output           :  void
+  Functionality    :  Shows the stored frames matching the query in arrival
+                      order. Frames added later are shown if they match.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vApplyView(const SFRAMEQUERY& sQuery)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_sViewQuery = sQuery;
+    m_ouViewKeyPass.clear();
+    m_bViewFiltered = true;
+    m_bViewActive = true;
+    vResetViewOrder();
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  vClearView
+  Input(s)         :  void
+  Output           :  void
+  Functionality    :  Shows all stored frames in arrival order.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vClearView(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_sViewQuery = SFRAMEQUERY();
+    m_ouViewKeyPass.clear();
+    m_bViewFiltered = false;
+    vResetViewOrder();
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+  Function Name    :  vFindRows
+  Input(s)         :  sQuery - Query
+                      ouIndices - Display indices of the matching rows. An
+                                  [out] parameter.
+  Output           :  void
+  Functionality    :  Searches the rows of the current view without changing
+                      it.
+  Member of        :  CMsgFrameStoreCAN
+******************************************************************************/
+void CMsgFrameStoreCAN::vFindRows(const SFRAMEQUERY& sQuery, std::vector<int>& ouIndices)
+{
+    std::vector<char> ouKeyPass;
+    std::vector<FRAMEROW> ouRows;
+    ouIndices.clear();
+
+    EnterCriticalSection(&m_omCritSec);
+    if (false == m_bViewActive)
+    {
+        vSelectRows(sQuery, ouKeyPass, ouRows);
+        ouIndices.reserve(ouRows.size());
+        for (auto itrRow = ouRows.begin(); itrRow != ouRows.end(); ++itrRow)
+        {
+            ouIndices.push_back((int)(*itrRow - m_un64EvictedRows));
+        }
+    }
+    else if (false == m_bViewSorted)
+    {
+        //Both lists are in arrival order
+        vSelectRows(sQuery, ouKeyPass, ouRows);
+        size_t nView = m_nViewStart;
+        for (auto itrRow = ouRows.begin(); itrRow != ouRows.end() && nView < m_ouView.size(); ++itrRow)
+        {
+            while (nView < m_ouView.size() && m_ouView[nView] < *itrRow)
+            {
+                nView++;
+            }
+            if (nView < m_ouView.size() && m_ouView[nView] == *itrRow)
+            {
+                ouIndices.push_back((int)(nView - m_nViewStart));
+            }
+        }
+    }
+    else
+    {
+        //Dropped rows of the sorted view have no display index
+        int nIndex = 0;
+        for (size_t nView = m_nViewStart; nView < m_ouView.size(); nView++)
+        {
+            if (defFRAME_STORE_NO_ROW == m_ouView[nView])
+            {
+                continue;
+            }
+            if (true == bRowPasses(sQuery, m_ouView[nView], ouKeyPass))
+            {
+                ouIndices.push_back(nIndex);
+            }
+            nIndex++;
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+}
@@ -0,0 +1,189 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      MsgFrameStoreCAN.h
+ * \brief     Definition of CMsgFrameStoreCAN class
+ *
+ * Compact, chunked store of the append mode message window frames.
+ */
+
+#pragma once
+
+#include <climits>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include "CANDriverDefines.h"
+#include "CanSymbolTable.h"
+
+#define defFRAME_STORE_CHUNK_ROWS       256
+#define defFRAME_STORE_MAX_RECORD       96      //Largest encoded frame, CAN FD with 64 bytes
+#define defFRAME_STORE_DEF_BUDGET       (512 * 1024 * 1024)
+#define defFRAME_STORE_NO_KEY           0xFFFF  //Row of a frame key beyond the indexed ones
+#define defFRAME_STORE_COMPACT_ROWS     1024    //Dropped entries kept before a row list is compacted
+#define defFRAME_STORE_VIEW_BLOCK       1024    //View positions counted together in a sorted view
+#define defFRAME_STORE_NO_ROW           ((FRAMEROW)-1)  //Dropped row in a sorted view
+#define defFRAME_STORE_NO_POS           UINT_MAX        //Row not in the sorted view
+
+//Number of a stored row, counted from the last clear. 64 bit, a long
+//session passes 4G frames.
+typedef unsigned __int64 FRAMEROW;
+
+// To save delta time in case of append mode
+typedef struct stCanDataSpl : public STCANDATA
+{
+    __int64      m_nDeltime;
+
+    stCanDataSpl()
+    {
+        m_nDeltime = 0;
+    }
+} STCANDATASPL;
+
+/* Decides if frames of one key are shown, the key is the data type,
+   identifier, channel and frame format */
+typedef BOOL (*PFFRAMEFILTER)(const STCANDATASPL& sFrame, void* pvParam);
+
+/* Query over the stored frames */
+struct sFRAMEQUERY
+{
+    PFFRAMEFILTER m_pfFilter;       //nullptr accepts every frame
+    void* m_pvParam;
+    LONGLONG m_llFromTime;          //Time stamp range, both inclusive
+    LONGLONG m_llToTime;
+
+    sFRAMEQUERY()
+    {
+        m_pfFilter = nullptr;
+        m_pvParam = nullptr;
+        m_llFromTime = LLONG_MIN;
+        m_llToTime = LLONG_MAX;
+    }
+};
+typedef sFRAMEQUERY SFRAMEQUERY;
+
+/* Append mode frames are encoded into chunks of defFRAME_STORE_CHUNK_ROWS
+   variable length records: time stamps are stored relative to the chunk,
+   identifiers as variable length integers and only the used data bytes.
+   Every chunk keeps the offset of each record, so any row is decoded
+   without touching its neighbours. When the memory budget is exceeded the
+   oldest chunk is dropped, shifting the rows like the circular buffer did.
+
+   Every distinct frame key gets an ordinal stored per row and the list of
+   its rows, so a query is evaluated once per key and only the rows of
+   the matching keys are visited. The result is a view, a list of rows in
+   display order that is extended as frames arrive.
+
+   Rows dropped from a sorted view are only marked, a count of the shown
+   rows per block of view positions maps display indices past them. The
+   view is compacted once half of it is dropped. */
+class CMsgFrameStoreCAN
+{
+public:
+    CMsgFrameStoreCAN();
+    ~CMsgFrameStoreCAN();
+
+    int WriteIntoBuffer(const STCANDATASPL* psMsg);
+    int ReadFromBuffer(STCANDATASPL* psMsg, int nIndex);
+    int GetBufferLength(void) const;
+    void vClearMessageBuffer(void);
+    void vSetMemoryBudget(size_t nBytes);
+    size_t nGetMemoryUsed(void) const;
+    void vDoSortBuffer(int nField, bool bAscending, const CCanSymbols* psSymbols);
+
+    //Shows only the frames matching the query, including the ones already stored
+    void vApplyView(const SFRAMEQUERY& sQuery);
+    //Shows every frame in arrival order
+    void vClearView(void);
+    //Display indices of the frames matching the query within the current view
+    void vFindRows(const SFRAMEQUERY& sQuery, std::vector<int>& ouIndices);
+    //Time stamp of the latest frame
+    LONGLONG llGetLastTime(void) const;
+    //Changes whenever displayed rows move to another index
+    UINT unGetLayoutVersion(void) const;
+
+private:
+    struct sCHUNK
+    {
+        LONGLONG m_llBaseTime;                      //Time stamp of the first record
+        BYTE* m_pbyRecords;
+        UINT m_unSize;
+        USHORT m_ausOffset[ defFRAME_STORE_CHUNK_ROWS ];
+        USHORT m_ausKey[ defFRAME_STORE_CHUNK_ROWS ];   //Key ordinal of every row or defFRAME_STORE_NO_KEY
+        int m_nSortRefs;                            //Sorts decoding the chunk outside the lock
+        bool m_bDropped;                            //Dropped while a sort decodes it
+    };
+    /* Rows of one frame key in arrival order. Rows are numbered from the
+       first frame after the last clear, rows of dropped chunks are before
+       m_nStart. */
+    struct sKEYINDEX
+    {
+        unsigned __int64 m_un64Key;
+        STCANDATASPL m_sSample;                     //First frame of the key, given to the filters
+        std::vector<FRAMEROW> m_ouRows;
+        size_t m_nStart;
+    };
+
+    CRITICAL_SECTION m_omCritSec;
+    std::deque<sCHUNK*> m_ouChunks;                 //Oldest first, the last one is being filled
+    BYTE m_abyOpenRecords[ defFRAME_STORE_CHUNK_ROWS * defFRAME_STORE_MAX_RECORD ];
+    UINT m_unOpenRows;                              //Rows in the last chunk
+    int m_nRowCount;
+    FRAMEROW m_un64EvictedRows;                     //Number of the oldest stored row
+    LONGLONG m_llLastTime;                          //Time stamp of the last row written
+    size_t m_nMemoryUsed;                           //Completed chunks and their index entries
+    size_t m_nMemoryBudget;
+
+    std::unordered_map<unsigned __int64, USHORT> m_ouKeyOrdinals;
+    std::vector<sKEYINDEX> m_ouKeys;
+    bool m_bKeyOverflow;                            //Rows without key ordinal are stored
+
+    //Current view, rows in display order starting at m_nViewStart
+    bool m_bViewActive;
+    bool m_bViewSorted;
+    bool m_bViewFiltered;
+    SFRAMEQUERY m_sViewQuery;
+    std::vector<char> m_ouViewKeyPass;              //Filter result per key ordinal, -1 if not evaluated
+    std::vector<FRAMEROW> m_ouView;
+    size_t m_nViewStart;
+    volatile LONG m_lLayoutVersion;
+    LONG m_lViewVersion;                            //Changes when the view is rebuilt
+
+    //Index of a sorted view
+    std::deque<UINT> m_ouViewPos;                   //View position of every row from m_un64ViewPosBase on
+    FRAMEROW m_un64ViewPosBase;
+    std::vector<UINT> m_ouViewBlockTree;            //Fenwick tree of the shown rows per view block
+    size_t m_nViewDropped;                          //Positions of dropped rows in the view
+
+    void vSealOpenChunk(void);
+    void vEvictChunks(void);
+    void vDeleteChunk(sCHUNK* psChunk);
+    USHORT usGetKeyOrdinal(const STCANDATASPL& sMsg);
+    static unsigned __int64 un64GetFrameKey(const STCANDATASPL& sMsg);
+    static const BYTE* pbyDecodeTime(const sCHUNK* psChunk, UINT unSlot, LONGLONG& llTime, BYTE& byFlags);
+    static void vDecodeRecord(const sCHUNK* psChunk, UINT unSlot, STCANDATASPL& sMsg);
+    LONGLONG llGetRowTime(FRAMEROW un64Row) const;
+    void vDecodeRow(FRAMEROW un64Row, STCANDATASPL& sMsg);
+    bool bKeyPasses(const SFRAMEQUERY& sQuery, USHORT usKey, std::vector<char>& ouKeyPass);
+    bool bRowPasses(const SFRAMEQUERY& sQuery, FRAMEROW un64Row, std::vector<char>& ouKeyPass);
+    void vSelectRows(const SFRAMEQUERY& sQuery, std::vector<char>& ouKeyPass, std::vector<FRAMEROW>& ouRows);
+    void vResetViewOrder(void);
+    FRAMEROW un64GetViewRow(int nIndex);
+    void vIndexSortedView(void);
+    void vAddViewBlockRows(size_t nBlock, int nRows);
+    void vPushSortedViewRow(FRAMEROW un64Row);
+    void vDropSortedViewRow(FRAMEROW un64Row);
+};
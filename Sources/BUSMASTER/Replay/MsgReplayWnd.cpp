@@ -494,6 +494,7 @@ void CMsgReplayWnd::vCmdStep()
 void CMsgReplayWnd::vCmdStop()
 {
     m_ouReplayDetails.m_bStopReplayThread = TRUE;
+    m_ouReplayDetails.m_omStopEvent.SetEvent();
 }
 
 /******************************************************************************/
@@ -878,6 +879,7 @@ BOOL CMsgReplayWnd::bSetThreadStopSignal()
     {
         // Indicate to stop the thread
         m_ouReplayDetails.m_bStopReplayThread = TRUE;
+        m_ouReplayDetails.m_omStopEvent.SetEvent();
         bIsValid = TRUE;
     }
     //m_ouReplayDetails.vCloseReplayFile();
@@ -482,7 +482,7 @@ void CReplayFileConfigDlg::OnBtnBrowse()
                                defSTR_LOG_FILE_EXTENSION,
                                ouFile.m_omStrFileName,
                                dwFlags,
-                               defLOG_FILTER,
+                               defREPLAY_FILTER,
                                nullptr );
         //Set the caption
         omFileDlg.m_ofn.lpstrTitle = _(defSTR_REPLAY_FILE_SELECTION_TITLE);
@@ -725,7 +725,7 @@ void CReplayFileConfigDlg::OnBtnAddFile()
                            defSTR_LOG_FILE_EXTENSION,
                            nullptr,
                            dwFlags,
-                           defLOG_FILTER,
+                           defREPLAY_FILTER,
                            nullptr );
     //Set the caption
     omFileDlg.m_ofn.lpstrTitle = _(defSTR_REPLAY_FILE_SELECTION_TITLE);
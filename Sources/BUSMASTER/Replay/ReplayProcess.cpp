@@ -38,10 +38,14 @@
 #include "Error.h"         // For Errors
 #include "Utility_Replay.h"
 #include "Utility\UtilFunctions.h"
+#include "Format Converter/BlfLibrary/Src/IBlfLibrary.h"
 #
 #define PEG_STEP 1
+#define defBLF_PEG_STEP 64 // BLF messages are read on from the pegged one
+#define defBLF_LIBRARY "ConverterPlugins\\BlfLibrary.dll"
 #define BYTES_PER_LINE 20
 #define MAX_FILE_SIZE_INTERACTIVE_REPLAY 52428800 //50MB
+#define defREPLAY_MAX_BURST 64 // Messages of one time stamp sent in one call
 CBaseDIL_CAN* CReplayProcess::s_pouDIL_CAN_Interface = nullptr;
 DWORD CReplayProcess::s_dwClientID = 0;
 
@@ -64,8 +68,16 @@ CReplayProcess::CReplayProcess(const CReplayFile& ouReplayFile) :
     m_nCurrentIndex( 0 ),
     m_nUserSelectionIndex( 0 ),
     m_nNoOfMessagesToPlay( 0 ),
-    m_bStopReplayThread( TRUE )
+    m_bStopReplayThread( TRUE ),
+    m_pouClock( nullptr ),
+    m_un64DelayDue( 0 ),
+    m_pouBlfReader( nullptr ),
+    m_hBlfLibrary( nullptr ),
+    m_dwBlfNextMsg( 0 ),
+    m_dwBlfMsgsRead( 0 )
 {
+    m_asBlfRecent[0].m_dwMsgNo = (DWORD)-1;
+    m_asBlfRecent[1].m_dwMsgNo = (DWORD)-1;
 
     m_omSelectedIndex.RemoveAll();
     //DIL related code
@@ -87,6 +99,11 @@ CReplayProcess::CReplayProcess(const CReplayFile& ouReplayFile) :
 *******************************************************************************/
 CReplayProcess::~CReplayProcess()
 {
+    vReleaseBlfReader();
+    if (nullptr != m_hBlfLibrary)
+    {
+        FreeLibrary(m_hBlfLibrary);
+    }
     DeleteCriticalSection(&m_omCritSecFilter);
 }
 
@@ -146,6 +163,7 @@ UINT CReplayProcess::sunReplayMonoshotThreadFunc( LPVOID pParam )
 
         // Create the event object to wait for
         HANDLE hEventReplayWait = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        pReplayDetails->vBeginReplayTiming();
         // Assign the message delay time
 
         UINT unDelay;
@@ -205,9 +223,8 @@ UINT CReplayProcess::sunReplayMonoshotThreadFunc( LPVOID pParam )
                 }
 
 
-                timeSetEvent( unDelay, time.wPeriodMin,
-                              (LPTIMECALLBACK) hEventReplayWait, 0,
-                              TIME_CALLBACK_EVENT_SET | TIME_ONESHOT);
+                pReplayDetails->vStartReplayDelay( unDelay, time.wPeriodMin,
+                                                   hEventReplayWait );
             }
             // Send message in CAN bus if the message ID is valid
 
@@ -245,7 +262,7 @@ UINT CReplayProcess::sunReplayMonoshotThreadFunc( LPVOID pParam )
             else
             {
                 // Wait for the event
-                WaitForSingleObject(hEventReplayWait, INFINITE);
+                pReplayDetails->vWaitReplayDelay( hEventReplayWait );
             }
 
             if(bNxtProtocolMismatch)
@@ -272,6 +289,7 @@ UINT CReplayProcess::sunReplayMonoshotThreadFunc( LPVOID pParam )
         {
             timeEndPeriod(time.wPeriodMin);
         }
+        pReplayDetails->vEndReplayTiming();
         CloseHandle(hEventReplayWait);
 
         if( pWnd != nullptr )
@@ -364,6 +382,7 @@ UINT CReplayProcess::sunReplayCyclicThreadFunc( LPVOID pParam )
 
         // Create the event object to wait for
         HANDLE hEventReplayWait = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        pReplayDetails->vBeginReplayTiming();
         // main loop for message transmission.
         nIndex = 0;
         while( pReplayDetails->m_bStopReplayThread == FALSE )
@@ -396,9 +415,8 @@ UINT CReplayProcess::sunReplayCyclicThreadFunc( LPVOID pParam )
                 unDelay = unCycleDelay;
             }
 
-            timeSetEvent( unDelay, time.wPeriodMin,
-                          (LPTIMECALLBACK) hEventReplayWait, NULL,
-                          TIME_CALLBACK_EVENT_SET | TIME_ONESHOT);
+            pReplayDetails->vStartReplayDelay( unDelay, time.wPeriodMin,
+                                               hEventReplayWait );
             // Send message in CAN bus if the message ID is valid
 
             if ( sCurCanMsg.m_uDataInfo.m_sCANMsg.m_unMsgID != -1 )
@@ -429,12 +447,13 @@ UINT CReplayProcess::sunReplayCyclicThreadFunc( LPVOID pParam )
             nIndex++;
             nIndex %= nCount;
             // Wait for the event
-            WaitForSingleObject(hEventReplayWait, INFINITE);
+            pReplayDetails->vWaitReplayDelay( hEventReplayWait );
         }
         if (mmResult == TIMERR_NOERROR)
         {
             timeEndPeriod(time.wPeriodMin);
         }
+        pReplayDetails->vEndReplayTiming();
         CloseHandle(hEventReplayWait);
 
         if( pWnd != nullptr )
@@ -512,6 +531,11 @@ BOOL CReplayProcess::bOpenReplayFile(BOOL bIsInteractive)
     // Clear error message
     m_omStrError = "";
     m_bIsEmptySession = false;
+    vReleaseBlfReader();
+    if (0 == m_ouReplayFile.m_omStrFileName.Right(4).CompareNoCase(".blf"))
+    {
+        return bOpenBlfFile(bIsInteractive);
+    }
     TRY
     {
         omInReplayFile.open( m_ouReplayFile.m_omStrFileName,
@@ -702,6 +726,7 @@ UINT CReplayProcess::sunNIReplayThreadFunc( LPVOID pParam )
 
         // Create the event object to wait for
         HANDLE hEventReplayWait = CreateEvent(NULL, FALSE, FALSE, NULL);
+        pReplayDetails->vBeginReplayTiming();
         // main loop for message transmission.
         UINT unTime;
         pReplayDetails->omInReplayFile.clear(); // clear eof and fail bits
@@ -834,6 +859,8 @@ UINT CReplayProcess::sunNIReplayThreadFunc( LPVOID pParam )
             }
 
 
+            // Messages logged with the same time stamp are sent together
+            bool bSameTime = false;
             if( (pReplayDetails->m_ouReplayFile.m_nTimeMode ==
                     defREPLAY_RETAIN_DELAY) && bIsValidMessage && !bIsProtocolMismatch)
             {
@@ -842,6 +869,7 @@ UINT CReplayProcess::sunNIReplayThreadFunc( LPVOID pParam )
                 if( unTime == 0 )
                 {
                     unTime = 1;
+                    bSameTime = (omStrNext.IsEmpty() == FALSE);
                 }
                 unMsgDelay = unTime;
             }
@@ -849,19 +877,23 @@ UINT CReplayProcess::sunNIReplayThreadFunc( LPVOID pParam )
             if((pReplayDetails->m_ouReplayFile.m_nSessionMode == defREPLAY_SPECIFIC_SESSION_DELAY) && bDetectSession == true)
             {
                 unMsgDelay = unSessionDelay;
+                bSameTime = false;
             }
 
             if(bDetectEOF && pReplayDetails->m_ouReplayFile.m_nReplayMode ==    defREPLAY_MODE_CYCLIC)
             {
                 unMsgDelay = unCycleDelay;
+                bSameTime = false;
                 pReplayDetails->omInReplayFile.clear(); // clear eof and fail bits
                 pReplayDetails->omInReplayFile.seekg(0, std::ios::beg);
             }
 
             // Send message in CAN bus if the message ID is valid
-            timeSetEvent( unMsgDelay, time.wPeriodMin,
-                          (LPTIMECALLBACK) hEventReplayWait, NULL,
-                          TIME_CALLBACK_EVENT_SET | TIME_ONESHOT);
+            if (false == bSameTime)
+            {
+                pReplayDetails->vStartReplayDelay( unMsgDelay, time.wPeriodMin,
+                                                   hEventReplayWait );
+            }
 
             if (sCanMsg.m_uDataInfo.m_sCANMsg.m_unMsgID != -1 )
             {
@@ -885,9 +917,11 @@ UINT CReplayProcess::sunNIReplayThreadFunc( LPVOID pParam )
 
                 if(bTobeBlocked == FALSE )
                 {
-                    // Use HIL Function to send CAN message
-
-                    hRet = s_pouDIL_CAN_Interface->DILC_SendMsg(s_dwClientID, sCanMsg.m_uDataInfo.m_sCANMsg);
+                    pReplayDetails->m_ouReplayBurst.push_back(sCanMsg.m_uDataInfo.m_sCANMsg);
+                }
+                if( (false == bSameTime) || (pReplayDetails->m_ouReplayBurst.size() >= defREPLAY_MAX_BURST) )
+                {
+                    hRet = pReplayDetails->hSendReplayBurst();
                 }
 
                 if (hRet != 0)
@@ -909,10 +943,14 @@ UINT CReplayProcess::sunNIReplayThreadFunc( LPVOID pParam )
                 }
 
             }
+            if (false == bSameTime)
+            {
+                pReplayDetails->hSendReplayBurst();
+            }
             // Wait for the event
-            if( pReplayDetails->m_bStopReplayThread == FALSE)
+            if( (pReplayDetails->m_bStopReplayThread == FALSE) && (false == bSameTime) )
             {
-                WaitForSingleObject(hEventReplayWait, INFINITE);
+                pReplayDetails->vWaitReplayDelay( hEventReplayWait );
             }
 
             if(bIsProtocolMismatch && bIsValidMessage)
@@ -925,10 +963,13 @@ UINT CReplayProcess::sunNIReplayThreadFunc( LPVOID pParam )
 
             }
         }
+        // Messages still collected when replay was stopped are not sent
+        pReplayDetails->m_ouReplayBurst.clear();
         if (mmResult == TIMERR_NOERROR)
         {
             timeEndPeriod(time.wPeriodMin);
         }
+        pReplayDetails->vEndReplayTiming();
         CloseHandle(hEventReplayWait);
         pReplayDetails->m_omThreadEvent.SetEvent();
 
@@ -981,6 +1022,7 @@ BOOL CReplayProcess::bSetThreadStopSignal()
     if( m_hThread != nullptr )
     {
         m_bStopReplayThread = TRUE;
+        m_omStopEvent.SetEvent();
         bIsValid = TRUE;
     }
     vCloseReplayFile();
@@ -1012,6 +1054,105 @@ BOOL CReplayProcess::bStopReplayThread()
     return bIsThreadKilled;
 }
 
+/*******************************************************************************
+  Function Name  : vBeginReplayTiming
+  Input(s)       : -
+  Output         : -
+  Functionality  : Called by a replay thread before its first delay. In virtual
+                   time the thread attaches to the clock and the delays run on it.
+  Member of      : CReplayProcess
+*******************************************************************************/
+void CReplayProcess::vBeginReplayTiming()
+{
+    m_omStopEvent.ResetEvent();
+    m_pouClock = nullptr;
+    IClockService* pouClock = nullptr;
+    if( (CLOCK_GetInterface( &pouClock ) == S_OK) && (pouClock != nullptr) && pouClock->bIsVirtual() )
+    {
+        m_pouClock = pouClock;
+        m_pouClock->vAttach();
+    }
+}
+
+/*******************************************************************************
+  Function Name  : vEndReplayTiming
+  Input(s)       : -
+  Output         : -
+  Functionality  : Called by a replay thread after its last delay
+  Member of      : CReplayProcess
+*******************************************************************************/
+void CReplayProcess::vEndReplayTiming()
+{
+    if( m_pouClock != nullptr )
+    {
+        m_pouClock->vDetach();
+        m_pouClock = nullptr;
+    }
+}
+
+/*******************************************************************************
+  Function Name  : vStartReplayDelay
+  Input(s)       : unDelay - Delay in ms before the next message
+                   unPeriod - Resolution of the multimedia timer
+                   hEvent - Event set by the multimedia timer
+  Output         : -
+  Functionality  : Starts the delay before the next message, which runs while
+                   the current one is sent
+  Member of      : CReplayProcess
+*******************************************************************************/
+void CReplayProcess::vStartReplayDelay( UINT unDelay, UINT unPeriod, HANDLE hEvent )
+{
+    if( m_pouClock != nullptr )
+    {
+        m_un64DelayDue = m_pouClock->un64GetTime() + ((UINT64)unDelay * 1000);
+    }
+    else
+    {
+        timeSetEvent( unDelay, unPeriod, (LPTIMECALLBACK) hEvent, 0,
+                      TIME_CALLBACK_EVENT_SET | TIME_ONESHOT );
+    }
+}
+
+/*******************************************************************************
+  Function Name  : vWaitReplayDelay
+  Input(s)       : hEvent - Event set by the multimedia timer
+  Output         : -
+  Functionality  : Waits for the end of the delay started last. In virtual time
+                   a stop request ends the wait at once.
+  Member of      : CReplayProcess
+*******************************************************************************/
+void CReplayProcess::vWaitReplayDelay( HANDLE hEvent )
+{
+    if( m_pouClock != nullptr )
+    {
+        m_pouClock->dwWaitUntil( m_omStopEvent, m_un64DelayDue );
+    }
+    else
+    {
+        WaitForSingleObject( hEvent, INFINITE );
+    }
+}
+
+/*******************************************************************************
+  Function Name  : hSendReplayBurst
+  Input(s)       : -
+  Output         : Result of the DIL, S_OK if there was nothing to send
+  Functionality  : Hands the collected messages of one time stamp to the DIL in
+                   one call and empties the collection.
+  Member of      : CReplayProcess
+*******************************************************************************/
+HRESULT CReplayProcess::hSendReplayBurst()
+{
+    HRESULT hRet = S_OK;
+    if( m_ouReplayBurst.empty() == false )
+    {
+        hRet = s_pouDIL_CAN_Interface->DILC_SendMsgs( s_dwClientID, &m_ouReplayBurst[0],
+                (UINT)m_ouReplayBurst.size(), nullptr );
+        m_ouReplayBurst.clear();
+    }
+    return hRet;
+}
+
 BOOL CReplayProcess::bMessageTobeBlocked( SFRAMEINFO_BASIC_CAN& sBasicCanInfo )
 {
     BOOL bReturn = TRUE;
@@ -1031,6 +1172,11 @@ BOOL CReplayProcess::bMessageTobeBlocked( SFRAMEINFO_BASIC_CAN& sBasicCanInfo )
 }
 DWORD CReplayProcess::dwGetNoOfMsgsInLog()
 {
+    if (nullptr != m_pouBlfReader)
+    {
+        // Counts all objects, the list is cut at the end of the file
+        return (DWORD)m_pouBlfReader->GetBlfObjectsCount();
+    }
     omInReplayFile.seekg(0, std::ios::end);
     DWORD dwEnd = omInReplayFile.tellg();
     omInReplayFile.clear();
@@ -1058,6 +1204,12 @@ CString CReplayProcess::omStrGetMsgFromLog(DWORD dwLineNo,STCANDATA& sCanMsg,boo
     bEOFflag = false;
     bProtocolMismatch = false;
     bInvalidMsg = false;
+    if (nullptr != m_pouBlfReader)
+    {
+        CString omStrLine = omStrGetMsgFromBlf(dwLineNo, sCanMsg, bEOFflag, bInvalidMsg);
+        LeaveCriticalSection(&m_omCritSecFilter);
+        return omStrLine;
+    }
     DWORD dwPegOffset = dwLineNo%PEG_STEP;
     DWORD dwPegCount = dwLineNo/PEG_STEP;
     DWORD dwLinesNotPegged = dwLineNo - vecPeg.size()*PEG_STEP;
@@ -1215,8 +1367,150 @@ CString CReplayProcess::omStrGetMsgFromLog(DWORD dwLineNo,STCANDATA& sCanMsg,boo
 }
 DWORD CReplayProcess::dwGetvecPegSize()
 {
+    if (nullptr != m_pouBlfReader)
+    {
+        return m_dwBlfMsgsRead;
+    }
     return vecPeg.size();
 }
+/*******************************************************************************
+  Function Name  : bOpenBlfFile
+  Input(s)       : bIsInteractive - TRUE for the replay window
+  Output         : BOOL - TRUE if the file is opened
+  Functionality  : Opens a BLF replay file through the BLF library. Only the
+                   headers of the log containers are read here, the messages
+                   are read when the window or the replay thread asks for them.
+  Member of      : CReplayProcess
+*******************************************************************************/
+BOOL CReplayProcess::bOpenBlfFile(BOOL bIsInteractive)
+{
+    // The non interactive thread reads the lines of log files
+    if (FALSE == bIsInteractive)
+    {
+        m_omStrError = defSTR_BLF_NI_REPLAY_UNSUPPORTED;
+        return FALSE;
+    }
+    if (nullptr == m_hBlfLibrary)
+    {
+        // The library is installed with the format converters
+        char acPath[MAX_PATH] = "";
+        GetModuleFileName(nullptr, acPath, MAX_PATH);
+        CString omStrPath = acPath;
+        omStrPath = omStrPath.Left(omStrPath.ReverseFind('\\') + 1) + defBLF_LIBRARY;
+        m_hBlfLibrary = LoadLibraryEx(omStrPath, nullptr, LOAD_WITH_ALTERED_SEARCH_PATH);
+    }
+    typedef BLF::IBlfReader* (*PFCREATEIBLFREADER)();
+    PFCREATEIBLFREADER pfCreateReader = nullptr;
+    if (nullptr != m_hBlfLibrary)
+    {
+        pfCreateReader = (PFCREATEIBLFREADER)GetProcAddress(m_hBlfLibrary, "CreateIBlfReader");
+    }
+    if (nullptr == pfCreateReader)
+    {
+        m_omStrError = defSTR_BLF_LIBRARY_MISSING;
+        return FALSE;
+    }
+    m_pouBlfReader = pfCreateReader();
+    if (S_OK != m_pouBlfReader->Open((LPCSTR)m_ouReplayFile.m_omStrFileName))
+    {
+        m_omStrError = defSTR_FILE_OPEN_ERROR;
+        vReleaseBlfReader();
+        return FALSE;
+    }
+    m_pouBlfReader->SetFilter(1 << BLF::bokCanMessage, 0);
+    m_pouBlfReader->Rewind();
+    m_vecBlfPeg.push_back(m_pouBlfReader->GetPosition());
+    // Messages are formatted as lines of a hex log file in absolute time mode
+    m_bReplayHexON = TRUE;
+    m_wLogReplayTimeMode = eABSOLUTE_MODE;
+    return TRUE;
+}
+void CReplayProcess::vReleaseBlfReader()
+{
+    if (nullptr != m_pouBlfReader)
+    {
+        typedef void (*PFRELEASEIBLFREADER)(BLF::IBlfReader*);
+        PFRELEASEIBLFREADER pfReleaseReader = (PFRELEASEIBLFREADER)GetProcAddress(m_hBlfLibrary, "ReleaseIBlfReader");
+        if (nullptr != pfReleaseReader)
+        {
+            pfReleaseReader(m_pouBlfReader);
+        }
+        m_pouBlfReader = nullptr;
+    }
+    m_vecBlfPeg.clear();
+    m_dwBlfNextMsg = 0;
+    m_dwBlfMsgsRead = 0;
+    m_asBlfRecent[0].m_dwMsgNo = (DWORD)-1;
+    m_asBlfRecent[1].m_dwMsgNo = (DWORD)-1;
+}
+/*******************************************************************************
+  Function Name  : omStrGetMsgFromBlf
+  Input(s)       : dwMsgNo - Index of the CAN message in the BLF file
+  Output         : CString - The message as a line of a log file
+  Functionality  : Reads a message of the BLF file. The reader goes on from the
+                   current message or from the pegged one before the desired
+                   message, so the file is never read from its beginning again.
+                   Called by omStrGetMsgFromLog within m_omCritSecFilter.
+  Member of      : CReplayProcess
+*******************************************************************************/
+CString CReplayProcess::omStrGetMsgFromBlf(DWORD dwMsgNo, STCANDATA& sCanMsg, bool& bEOFflag, bool& bInvalidMsg)
+{
+    sBLFREPLAYMSG& sRecent = m_asBlfRecent[dwMsgNo % 2];
+    if (sRecent.m_dwMsgNo != dwMsgNo)
+    {
+        DWORD dwPeg = min(dwMsgNo / defBLF_PEG_STEP, (DWORD)m_vecBlfPeg.size() - 1);
+        if ((dwMsgNo < m_dwBlfNextMsg) || (dwPeg * defBLF_PEG_STEP > m_dwBlfNextMsg))
+        {
+            m_pouBlfReader->SetPosition(m_vecBlfPeg[dwPeg]);
+            m_dwBlfNextMsg = dwPeg * defBLF_PEG_STEP;
+        }
+        BLF::ICanMessage* pouMsg = nullptr;
+        while (m_dwBlfNextMsg <= dwMsgNo)
+        {
+            if ((0 == m_dwBlfNextMsg % defBLF_PEG_STEP) && (m_dwBlfNextMsg / defBLF_PEG_STEP == m_vecBlfPeg.size()))
+            {
+                m_vecBlfPeg.push_back(m_pouBlfReader->GetPosition());
+            }
+            BLF::IBlfObject* pouObject = m_pouBlfReader->GetNextBlfObject();
+            pouMsg = (nullptr != pouObject) ? pouObject->GetICanMessage() : nullptr;
+            if (nullptr == pouMsg)
+            {
+                break;
+            }
+            ++m_dwBlfNextMsg;
+        }
+        m_dwBlfMsgsRead = max(m_dwBlfMsgsRead, m_dwBlfNextMsg);
+        if (nullptr == pouMsg)
+        {
+            bEOFflag = true;
+            return "";
+        }
+
+        // Time stamp in ns as hours, minutes, seconds and 0.1 ms
+        ULONGLONG ullTime = pouMsg->GetTimestamp() / 100000;
+        DWORD dwId = pouMsg->GetId();
+        UINT unDLC = min((UINT)pouMsg->GetDLC(), (UINT)8);
+        sRecent.m_omStrLine.Format("%u:%u:%u:%04u %s %u 0x%X %c %u",
+                                   (UINT)(ullTime / 36000000), (UINT)(ullTime / 600000 % 60),
+                                   (UINT)(ullTime / 10000 % 60), (UINT)(ullTime % 10000),
+                                   (BLF::mdTx == pouMsg->GetDirection()) ? "Tx" : "Rx",
+                                   (UINT)pouMsg->GetChannelNo(), dwId & 0x7FFFFFFF,
+                                   (0 != (dwId & 0x80000000)) ? defMSGID_EXTENDED : defMSGID_STD, unDLC);
+        for (UINT i = 0; i < unDLC; i++)
+        {
+            sRecent.m_omStrLine.AppendFormat(" %02X", pouMsg->GetData()[i]);
+        }
+        ZeroMemory(&sRecent.m_sCanMsg, sizeof(STCANDATA));
+        if (!bGetMsgInfoFromMsgStr(sRecent.m_omStrLine, &sRecent.m_sCanMsg, TRUE))
+        {
+            bInvalidMsg = true;
+            return "";
+        }
+        sRecent.m_dwMsgNo = dwMsgNo;
+    }
+    sCanMsg = sRecent.m_sCanMsg;
+    return sRecent.m_omStrLine;
+}
 bool CReplayProcess::bGetbIsProtocolMismatch()
 {
     return m_bIsProtocolMismatch;
@@ -25,6 +25,10 @@
 #pragma once
 #include "ReplayManager.h"
 class CBaseDIL_CAN;
+namespace BLF
+{
+class IBlfReader;
+}
 class CReplayProcess
 {
 public:
@@ -83,6 +87,12 @@ private:
     HANDLE m_hThread;
     // Event for Thread Indication
     CEvent m_omThreadEvent;
+    // Ends a delay on the virtual clock when the thread is stopped
+    CEvent m_omStopEvent;
+    // Clock of the running thread in virtual time, else nullptr
+    IClockService* m_pouClock;
+    // End of the current delay in virtual time
+    UINT64 m_un64DelayDue;
     //To store the location of a line(in bytes) in log file.
     std::vector<DWORD> vecPeg;
     //To track the sessions crossed by reading the log file.
@@ -109,8 +119,36 @@ private:
     bool m_bIsProtocolMismatch;
     bool m_bIsInvalidMessage;
     bool m_bIsEmptySession;
+    // Reader of a BLF replay file, nullptr for a log file
+    BLF::IBlfReader* m_pouBlfReader;
+    HMODULE m_hBlfLibrary;
+    // Reader positions of every defBLF_PEG_STEP message
+    std::vector<ULONGLONG> m_vecBlfPeg;
+    // Message the reader is positioned at, and count of messages read so far
+    DWORD m_dwBlfNextMsg;
+    DWORD m_dwBlfMsgsRead;
+    // Last decoded messages, the replay threads ask for the next message before the current one
+    struct sBLFREPLAYMSG
+    {
+        DWORD m_dwMsgNo;
+        STCANDATA m_sCanMsg;
+        CString m_omStrLine;
+    };
+    sBLFREPLAYMSG m_asBlfRecent[2];
 private:
     void vFormatCANDataMsg(STCANDATA* pMsgCAN, tagSFRAMEINFO_BASIC_CAN* CurrDataCAN);
+    // BLF replay files, read through the BLF library of the format converters
+    BOOL bOpenBlfFile(BOOL bIsInteractive);
+    void vReleaseBlfReader();
+    CString omStrGetMsgFromBlf(DWORD dwMsgNo, STCANDATA& sCanMsg, bool& bEOFflag, bool& bInvalidMsg);
     BOOL bMessageTobeBlocked(SFRAMEINFO_BASIC_CAN& sBasicCanInfo);
+    // Delays between the messages, on the multimedia timer or the virtual clock
+    void vBeginReplayTiming();
+    void vEndReplayTiming();
+    void vStartReplayDelay(UINT unDelay, UINT unPeriod, HANDLE hEvent);
+    void vWaitReplayDelay(HANDLE hEvent);
+    // Messages of one time stamp, sent in one call
+    std::vector<STCAN_MSG> m_ouReplayBurst;
+    HRESULT hSendReplayBurst();
 
 };
@@ -9,6 +9,8 @@ CBaseSignalWatchImp::CBaseSignalWatchImp(ETYPE_BUS busType)
     mBusType = busType;
     mDbCluster = nullptr;
     m_pouSigWnd = nullptr;
+    m_bHex = false;
+    InitializeCriticalSection(&m_omCritSecSW);
 }
 
 CBaseSignalWatchImp::~CBaseSignalWatchImp()
@@ -26,7 +28,6 @@ HRESULT CBaseSignalWatchImp::SW_DoInitialization(IBMNetWorkGetService* dbCluster
 {
     AFX_MANAGE_STATE(AfxGetStaticModuleState());
 
-    InitializeCriticalSection(&m_omCritSecSW);
     //m_pouSigWnd = nullptr;
 
     mDbCluster = (IBMNetWorkGetService*)dbCluster;
@@ -50,6 +51,8 @@ HRESULT CBaseSignalWatchImp::SW_ShowAddDelSignalsDlg(CWnd* pParent, void* /*dbCl
     //WndPlace=odDlg.wpPosition();
 
     int nRet = odDlg.DoModal();
+    //Watch list may have changed, entries are recreated on reception
+    m_ouValueTable.vClear();
     return (HRESULT)nRet;
 }
 HRESULT CBaseSignalWatchImp::SW_ShowSigWatchWnd(CWnd* /*pParent*/, HWND hMainWnd, INT nCmd)
@@ -95,9 +98,9 @@ HRESULT CBaseSignalWatchImp::SW_GetConfigData(xmlNodePtr pNodePtr)
 				{
 					int selkey = -1;
 					((IFrame*)itr->second)->GetFrameId(unId);
-					if (m_mapMsgIDtoSignallst->find(unId) != m_mapMsgIDtoSignallst->end())
+					if (i < defSW_MAX_CHANNELS && m_mapMsgIDtoSignallst[i].find(unId) != m_mapMsgIDtoSignallst[i].end())
 					{
-						selkey = m_mapMsgIDtoSignallst->find(unId)->first;
+						selkey = m_mapMsgIDtoSignallst[i].find(unId)->first;
 					}
 					CString strMessageId = "";
 					if (selkey == unId)
@@ -110,10 +113,18 @@ HRESULT CBaseSignalWatchImp::SW_GetConfigData(xmlNodePtr pNodePtr)
 						xmlNodePtr pMsgPtr = xmlNewChild(pMsgTagPtr, nullptr, BAD_CAST DEF_MSGID
 							, BAD_CAST strMessageId.GetBufferSetLength(strMessageId.GetLength()));
 						xmlAddChild(pMsgTagPtr, pMsgPtr);
+						if (i > 0)
+						{
+							CString strChannel;
+							strChannel.Format("%d", i + 1);
+							xmlNodePtr pChannelPtr = xmlNewChild(pMsgTagPtr, nullptr, BAD_CAST DEF_CHANNEL
+								, BAD_CAST strChannel.GetBufferSetLength(strChannel.GetLength()));
+							xmlAddChild(pMsgTagPtr, pChannelPtr);
+						}
 						CString strSignalName = "";
 						if (selkey == unId)
 						{
-							std::list<std::string> lstSignals = m_mapMsgIDtoSignallst->find(unId)->second;
+							std::list<std::string> lstSignals = m_mapMsgIDtoSignallst[i].find(unId)->second;
 							std::list<std::string>::iterator itrselSignals = lstSignals.begin();
 
 							while (itrselSignals != lstSignals.end())
@@ -228,13 +239,18 @@ HRESULT CBaseSignalWatchImp::SW_SetConfigData(xmlNodePtr pNode)
     INT nRetValue = S_OK;
     if ((pNode != nullptr) && (m_pouSigWnd != nullptr))
     {
-		m_mapMsgIDtoSignallst->clear();
+        for (int i = 0; i < defSW_MAX_CHANNELS; i++)
+        {
+            m_mapMsgIDtoSignallst[i].clear();
+        }
+        m_ouValueTable.vClear();
         WINDOWPLACEMENT WndPlace;
         while (pNode != nullptr)
         {
             if ((!xmlStrcmp(pNode->name, (const xmlChar*)"Message")))
             {
                 int id = 0;
+                int nChannel = 0;
                 std::list<std::string> signame;
 
                 xmlNodePtr child = pNode->children;
@@ -249,6 +265,15 @@ HRESULT CBaseSignalWatchImp::SW_SetConfigData(xmlNodePtr pNode)
                         }
                     }
 
+                    if ((!xmlStrcmp(child->name, (const xmlChar*)DEF_CHANNEL)))
+                    {
+                        xmlChar* key = xmlNodeListGetString(child->doc, child->xmlChildrenNode, 1);
+                        if (nullptr != key)
+                        {
+                            nChannel = atoi((char*)key) - 1;
+                        }
+                    }
+
                     if ((!xmlStrcmp(child->name, (const xmlChar*)"Signal")))
                     {
                         xmlChar* key = xmlNodeListGetString(child->doc, child->xmlChildrenNode, 1);
@@ -261,7 +286,11 @@ HRESULT CBaseSignalWatchImp::SW_SetConfigData(xmlNodePtr pNode)
                     child = child->next;
                 }
 
-				m_mapMsgIDtoSignallst[0].insert(std::map<long, std::list<std::string>>::value_type(id, signame));
+                if (nChannel < 0 || nChannel >= defSW_MAX_CHANNELS)
+                {
+                    nChannel = 0;
+                }
+                m_mapMsgIDtoSignallst[nChannel].insert(std::map<long, std::list<std::string>>::value_type(id, signame));
             }
 
             if ((!xmlStrcmp(pNode->name, (const xmlChar*)"Window_Position")))
@@ -296,7 +325,11 @@ HRESULT CBaseSignalWatchImp::SW_SetConfigData(xmlNodePtr pNode)
     if (pNode == nullptr)
     {
         WINDOWPLACEMENT WndPlace;
-        m_mapMsgIDtoSignallst->clear();
+        for (int i = 0; i < defSW_MAX_CHANNELS; i++)
+        {
+            m_mapMsgIDtoSignallst[i].clear();
+        }
+        m_ouValueTable.vClear();
         //     // memcpy(&WndPlace, pbyConfigData, sizeof (WINDOWPLACEMENT));
         //      m_pouSigWnd->MoveWindow(&(WndPlace.rcNormalPosition), FALSE);
         //Signal watch window will move the List control in OnSize().
@@ -337,6 +370,55 @@ HRESULT CBaseSignalWatchImp::SW_SetDisplayMode(BOOL bHex)
 }
 HRESULT CBaseSignalWatchImp::SW_SetClusterInfo(void* ouCluster)
 {
+    EnterCriticalSection(&m_omCritSecSW);
     mDbCluster = (IBMNetWorkGetService*)ouCluster;
+    //Entries refer to signals of the previous database
+    m_ouValueTable.vClear();
+    LeaveCriticalSection(&m_omCritSecSW);
     return S_FALSE;
+}
+
+CSignalValueTable& CBaseSignalWatchImp::ouGetValueTable()
+{
+    return m_ouValueTable;
+}
+
+bool CBaseSignalWatchImp::bIsHexMode()
+{
+    return m_bHex;
+}
+
+int CBaseSignalWatchImp::nGetDbChannelIndex(UCHAR ucChannel)
+{
+    //Channels without a database of their own use the one of the first channel
+    int nChannelIndex = (int)ucChannel - 1;
+    int nChannelCount = 0;
+    mDbCluster->GetChannelCount(mBusType, nChannelCount);
+    if (nChannelIndex < 0 || nChannelIndex >= nChannelCount || nChannelIndex >= defSW_MAX_CHANNELS)
+    {
+        return 0;
+    }
+    int nDbCount = 0;
+    mDbCluster->GetDBServiceCount(mBusType, nChannelIndex, nDbCount);
+    return (nDbCount > 0) ? nChannelIndex : 0;
+}
+
+void CBaseSignalWatchImp::vUpdateSignalValues(UCHAR ucChannel, unsigned int unFrameId, const unsigned char* pbyData, int nLength)
+{
+    EnterCriticalSection(&m_omCritSecSW);
+    if (mDbCluster != nullptr)
+    {
+        int nDbChannel = nGetDbChannelIndex(ucChannel);
+        auto itr = m_mapMsgIDtoSignallst[nDbChannel].find(unFrameId);
+        if (itr != m_mapMsgIDtoSignallst[nDbChannel].end() && false == itr->second.empty())
+        {
+            IFrame* pFrame = nullptr;
+            mDbCluster->GetFrame(mBusType, nDbChannel, unFrameId, nullptr, &pFrame);
+            if (nullptr != pFrame)
+            {
+                m_ouValueTable.vUpdate(ucChannel, itr->first, pFrame, itr->second, pbyData, nLength);
+            }
+        }
+    }
+    LeaveCriticalSection(&m_omCritSecSW);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "BaseSignalWatch.h"
 #include "Utility/Utility_Thread.h"
 #include "SigWatchDlg.h"
+#include "SignalValueTable.h"
+#include "SignalWatchDefs.h"
 class CBaseSignalWatchImp : public CBaseSignalWatch
 {
 
@@ -22,13 +24,20 @@ public:
 
     virtual HRESULT DoInitialization() = 0;
     virtual HRESULT StartSigWatchReadThread() = 0;
+
+    CSignalValueTable& ouGetValueTable();
+    bool bIsHexMode();
 protected:
+    void vUpdateSignalValues(UCHAR ucChannel, unsigned int unFrameId, const unsigned char* pbyData, int nLength);
+    int nGetDbChannelIndex(UCHAR ucChannel);
+
     ETYPE_BUS mBusType;
     bool m_bHex;
     class CSigWatchDlg* m_pouSigWnd;
     CPARAM_THREADPROC m_ouReadThread;
     CRITICAL_SECTION m_omCritSecSW;
     IBMNetWorkGetService* mDbCluster;
-    std::map<long, std::list<std::string>> m_mapMsgIDtoSignallst[16];
+    std::map<long, std::list<std::string>> m_mapMsgIDtoSignallst[defSW_MAX_CHANNELS];
+    CSignalValueTable m_ouValueTable;
 };
 
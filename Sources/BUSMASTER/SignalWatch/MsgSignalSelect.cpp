@@ -1,6 +1,7 @@
 #include "SignalWatch_stdafx.h"
 #include "MsgSignalSelect.h"
 #include "SignalWatch_resource.h"
+#include "SignalWatchDefs.h"
 #include "Application\HashDefines.h"
 
 #define TREE_VIEW_CHECK_STATE_CHANGE (WM_USER + 100)
@@ -242,18 +243,20 @@ BOOL CMsgSignalSelect::OnInitDialog()
 void CMsgSignalSelect::vStoreintoMap()
 {
     EnterCriticalSection(&m_omCritSecSW);
-    m_mapMsgIDtoSignallst->clear();
-    HTREEITEM root = pTreeStruct->GetRootItem();
-
-    if (root == nullptr)
+    for (int i = 0; i < defSW_MAX_CHANNELS; i++)
     {
-        LeaveCriticalSection(&m_omCritSecSW);
-        return;
+        m_mapMsgIDtoSignallst[i].clear();
     }
 
+    //One root item per channel, in channel order
     int i = 0;
-    if (pTreeStruct->ItemHasChildren(root) && pTreeStruct->GetCheck(root))
+    for (HTREEITEM root = pTreeStruct->GetRootItem(); root != nullptr && i < defSW_MAX_CHANNELS;
+            root = pTreeStruct->GetNextSiblingItem(root), i++)
     {
+        if (!pTreeStruct->ItemHasChildren(root) || !pTreeStruct->GetCheck(root))
+        {
+            continue;
+        }
         HTREEITEM msgs = pTreeStruct->GetChildItem(root);
 
         while (msgs != nullptr)
@@ -291,18 +294,7 @@ void CMsgSignalSelect::vStoreintoMap()
             }
 
             msgs = pTreeStruct->GetNextSiblingItem(msgs);
-
-            if (msgs == nullptr)
-            {
-                break;
-            }
         }
-
-        i++;
-    }
-    else
-    {
-        m_mapMsgIDtoSignallst[i].clear();
     }
     LeaveCriticalSection(&m_omCritSecSW);
 }
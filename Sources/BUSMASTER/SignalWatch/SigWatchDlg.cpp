@@ -67,6 +67,9 @@ CSigWatchDlg::CSigWatchDlg(CBaseSignalWatchImp* baseSignalWatch, CWnd* pParent /
     m_pParent = pParent;
     m_hMainWnd = nullptr;
     m_bEscape = false;
+    m_unTableGeneration = 0;
+    m_un64LastSequence = 0;
+    m_bHexShown = false;
 }
 
 CSigWatchDlg::~CSigWatchDlg()
@@ -188,186 +191,95 @@ void CSigWatchDlg::OnOK()
     // Don't call parents OnOK function
 }
 
-void CSigWatchDlg::vAddMsgSigIntoList(   const CString& omStrMsgName,
-        const CStringArray& omSASignals,
-        const CStringArray& omSARaw,
-        const CStringArray& omSAPhysical,
-        BOOL bIntptrDone)
+/******************************************************************************
+ Function Name  :   vFormatSignalValue
+ Input(s)       :   sValue - Latest value of a watched signal
+ Output         :   omRawValue, omPhyValue - Display strings
+ Functionality  :   Formats the raw value as per the display mode and the
+                    physical value (or its value description) with unit
+ Member of      :   CSigWatchDlg
+******************************************************************************/
+void CSigWatchDlg::vFormatSignalValue(const sSIGVALUE& sValue, CString& omRawValue, CString& omPhyValue)
 {
-
-    m_omCSDispEntry.Lock();
-
-    ASSERT( omSASignals.GetSize() == omSARaw.GetSize() &&
-            omSARaw.GetSize() == omSAPhysical.GetSize() );
-
-    if( bIntptrDone == FALSE)
+    if (true == m_bHexShown)
     {
-        int nSize = (int)omSASignals.GetSize();
-        //check the valid entries in the signal watch window.
-
-        POSITION ListPos = m_odSigEntryList.GetHeadPosition();
-        while(ListPos)
-        {
-            POSITION TempPos = ListPos;
-            sSIGENTRY& sTempList = m_odSigEntryList.GetNext(ListPos);
-            CString strMsgName = sTempList.m_omMsgName;
-            CString strSigName = sTempList.m_omSigName;
-
-            //check for valid message name
-            if(strMsgName.CompareNoCase(omStrMsgName) == 0 )
-            {
-                bool bDeleteMsgSignal = true;
-                int iCount = 0;
-                for(; iCount < nSize; iCount++)
-                {
-                    CString strSignal = omSASignals.GetAt(iCount);
-                    if(strSignal.CompareNoCase(strSigName) == 0 )
-                    {
-                        //signal is valid, just check for next
-                        bDeleteMsgSignal = false;
-                        break;
-                    }
-                }
-                if(bDeleteMsgSignal) //some invalid signal found
-                {
-                    m_odSigEntryList.RemoveAt(TempPos); //remove the signal from list
-                    POSITION ResetPos = m_odSigEntryList.GetHeadPosition();
-                    iCount = 0;
-                    while(ResetPos) //reset the m_nEntryIndex in the list
-                    {
-                        sSIGENTRY& sResetList = m_odSigEntryList.GetNext(ResetPos);
-                        sResetList.m_nEntryIndex = iCount;
-                        iCount++;
-                    }
-
-                    //check for signal in the signal watch window
-                    iCount = m_omSignalList.GetItemCount();
-                    if(iCount > 0)
-                    {
-                        //delete the last entry form the signal watch window
-                        m_omSignalList.DeleteItem(iCount -1);
-                    }
-                }
-            }
-        }
-
-        for( register int index = 0; index < nSize; index++)
-        {
-            CString omStrSignalInfo;
-            CString omListStr = omSASignals.GetAt(index);
-            POSITION pos = nullptr;
-            sSIGENTRY sEntry;
-            sEntry.m_omMsgName = omStrMsgName;
-            sEntry.m_omSigName = omListStr;
-            sEntry.m_omPhyValue = omSAPhysical.GetAt(index);
-            sEntry.m_omRawValue = omSARaw.GetAt(index);
-            if (nullptr != (pos = m_odSigEntryList.Find(sEntry)))
-            {
-                sSIGENTRY& sTemp = m_odSigEntryList.GetAt(pos);
-                sTemp.m_omPhyValue = sEntry.m_omPhyValue;
-                sTemp.m_omRawValue = sEntry.m_omRawValue;
-            }
-            else
-            {
-                m_odSigEntryList.AddTail(sEntry);
-            }
-        }
+        unsigned __int64 un64Mask = (sValue.m_unLength >= 64) ? ~0ULL : ((1ULL << sValue.m_unLength) - 1);
+        omRawValue.Format("%I64X", sValue.m_un64RawValue & un64Mask);
     }
-    m_omCSDispEntry.Unlock();
-}
-
-
-void CSigWatchDlg::vAddMsgToWnd(SSignalInfoArray* sSingnalinfo, BOOL bIntptrDone, std::map<long, std::list<std::string>>* m_mapDetails, long mID)
-{
-
-    m_omCSDispEntry.Lock();
-
-    m_mapMsgIDtoSignallst=m_mapDetails;
-
-    if( bIntptrDone == FALSE && sSingnalinfo != nullptr && m_mapDetails!=nullptr)
+    else if (true == sValue.m_bSigned)
     {
-
-        SSignalInfo sTempSignal;
-        int nCnt = sSingnalinfo->GetSize();
-        std::list<std::string> lstSignals=m_mapMsgIDtoSignallst->find(mID)->second;
-        for (int i = 0; i < nCnt; i++)
-        {
-            sTempSignal = sSingnalinfo->GetAt(i);
-
-            if(find(lstSignals.begin(),lstSignals.end(),string(sTempSignal.m_omSigName)) != lstSignals.end())
-            {
-                POSITION pos = nullptr;
-                sSIGENTRY sEntry;
-                sEntry.m_omMsgName = sTempSignal.m_msgName;
-                sEntry.m_omSigName = sTempSignal.m_omSigName;
-                sEntry.m_omPhyValue = sTempSignal.m_omEnggValue + " " + sTempSignal.m_omUnit;
-                sEntry.m_omRawValue = sTempSignal.m_omRawValue;
-                sEntry.m_nKey = mID;
-                if (nullptr != (pos = m_odSigEntryList.Find(sEntry)))
-                {
-                    sSIGENTRY& sTemp = m_odSigEntryList.GetAt(pos);
-                    sTemp.m_omPhyValue = sEntry.m_omPhyValue;
-                    sTemp.m_omRawValue = sEntry.m_omRawValue;
-                }
-                else
-                {
-                    m_odSigEntryList.AddTail(sEntry);
-                }
-            }
-        }
+        omRawValue.Format("%I64d", (__int64)sValue.m_un64RawValue);
+    }
+    else
+    {
+        omRawValue.Format("%I64u", sValue.m_un64RawValue);
     }
-    m_omCSDispEntry.Unlock();
-
 
+    if (false == sValue.m_strDescription.empty())
+    {
+        omPhyValue = sValue.m_strDescription.c_str();
+    }
+    else
+    {
+        omPhyValue.Format(defSTR_FORMAT_PHY_VALUE, sValue.m_dPhyValue);
+    }
+    omPhyValue += " ";
+    omPhyValue += sValue.m_strUnit.c_str();
 }
 
-
+/******************************************************************************
+ Function Name  :   vDisplayMsgSigList
+ Input(s)       :   -
+ Output         :   -
+ Functionality  :   Pulls the signal values updated since the previous refresh
+                    and updates only their rows. Values received in between
+                    refreshes are coalesced by the value table.
+ Member of      :   CSigWatchDlg
+******************************************************************************/
 void CSigWatchDlg::vDisplayMsgSigList(void)
 {
-    m_omCSDispEntry.Lock();
+    if (nullptr == mBaseSignalWatch)
+    {
+        return;
+    }
+    bool bHex = mBaseSignalWatch->bIsHexMode();
+    if (bHex != m_bHexShown)
+    {
+        //Reformat every row in the new mode
+        m_bHexShown = bHex;
+        m_un64LastSequence = 0;
+    }
+
+    if (true == mBaseSignalWatch->ouGetValueTable().bGetChanges(m_unTableGeneration, m_un64LastSequence, m_ouChangedValues))
+    {
+        m_omSignalList.DeleteAllItems();
+        m_anEntryRow.clear();
+    }
+    if (m_ouChangedValues.empty())
+    {
+        return;
+    }
 
-    POSITION pos = m_odSigEntryList.GetHeadPosition();
-    //UINT unCount = 0;
-    while (pos)
+    m_omSignalList.SetRedraw(FALSE);
+    CString omRawValue, omPhyValue;
+    for (auto itr = m_ouChangedValues.begin(); itr != m_ouChangedValues.end(); ++itr)
     {
-        sSIGENTRY& sEntry = m_odSigEntryList.GetNext(pos);
-        // Insert Message Name
-        if (sEntry.m_nEntryIndex != -1)
+        if (itr->m_nIndex >= (int)m_anEntryRow.size())
         {
-            m_omSignalList.SetItemText(sEntry.m_nEntryIndex,defSTR_SW_MSG_COL,
-                                       sEntry.m_omMsgName);
-            // Insert Signal Name
-            m_omSignalList.SetItemText( sEntry.m_nEntryIndex,
-                                        defSTR_SW_SIG_COL,
-                                        sEntry.m_omSigName);
-            // Insert Raw Value
-            m_omSignalList.SetItemText( sEntry.m_nEntryIndex,
-                                        defSTR_SW_RAW_VAL_COL,
-                                        sEntry.m_omRawValue);
-            // Insert Physical Value
-            m_omSignalList.SetItemText( sEntry.m_nEntryIndex,
-                                        defSTR_SW_PHY_VAL_COL,
-                                        sEntry.m_omPhyValue);
+            m_anEntryRow.resize(itr->m_nIndex + 1, -1);
         }
-        else
+        int& nRow = m_anEntryRow[itr->m_nIndex];
+        if (-1 == nRow)
         {
-            sEntry.m_nEntryIndex = m_omSignalList.InsertItem(
-                                       m_omSignalList.GetItemCount(),
-                                       sEntry.m_omMsgName);
-            m_omSignalList.SetItemText( sEntry.m_nEntryIndex,
-                                        defSTR_SW_SIG_COL,
-                                        sEntry.m_omSigName);
-            m_omSignalList.SetItemText( sEntry.m_nEntryIndex,
-                                        defSTR_SW_RAW_VAL_COL,
-                                        sEntry.m_omRawValue);
-            m_omSignalList.SetItemText( sEntry.m_nEntryIndex,
-                                        defSTR_SW_PHY_VAL_COL,
-                                        sEntry.m_omPhyValue);
-
+            nRow = m_omSignalList.InsertItem(m_omSignalList.GetItemCount(), itr->m_strMsgName.c_str());
+            m_omSignalList.SetItemText(nRow, defSTR_SW_SIG_COL, itr->m_strSigName.c_str());
         }
-
+        vFormatSignalValue(*itr, omRawValue, omPhyValue);
+        m_omSignalList.SetItemText(nRow, defSTR_SW_RAW_VAL_COL, omRawValue);
+        m_omSignalList.SetItemText(nRow, defSTR_SW_PHY_VAL_COL, omPhyValue);
     }
-    m_omCSDispEntry.Unlock();
+    m_omSignalList.SetRedraw(TRUE);
+    m_omSignalList.Invalidate(FALSE);
 }
 
 /******************************************************************************
@@ -407,43 +319,21 @@ void CSigWatchDlg::OnClose()
 *******************************************************************************/
 LRESULT CSigWatchDlg::vRemoveSignalFromMap(WPARAM /* wParam */, LPARAM lParam)
 {
-    // remove all entry from the map
-    m_omCSDispEntry.Lock();
-    if(lParam != 0) // remove only specified msg entry from the signal watch list
+    // Rows are rebuilt from the value table on the next refresh
+    if (nullptr == mBaseSignalWatch)
+    {
+        m_omSignalList.DeleteAllItems();
+    }
+    else if(lParam != 0) // remove only specified msg entry from the signal watch list
     {
         CString* pMsgString = (CString*)lParam;
-        CString strMsgName = *pMsgString;
-        int iCount = m_omSignalList.GetItemCount();
-        for(int iIndex = 0; iIndex < iCount; iIndex++)
-        {
-            //check the same message name
-            if(strMsgName.CompareNoCase(m_omSignalList.GetItemText(iIndex, 0)) == 0)
-            {
-                //delete the signal from the signal watch window
-                m_omSignalList.DeleteItem(iIndex);
-                //reset the index
-                iIndex--;
-                iCount = m_omSignalList.GetItemCount();
-            }
-        }
-        //delete the all entries of this message from the Signal Entry List also
-        POSITION ListPos = m_odSigEntryList.GetHeadPosition();
-        while(ListPos)
-        {
-            POSITION TempPos = ListPos;
-            sSIGENTRY& sTempList = m_odSigEntryList.GetNext(ListPos);
-            if(strMsgName.CompareNoCase(sTempList.m_omMsgName) == 0)//check for the specific message.
-            {
-                m_odSigEntryList.RemoveAt(TempPos);
-            }
-        }
+        mBaseSignalWatch->ouGetValueTable().vRemoveMessage((LPCSTR)*pMsgString);
     }
     else //remove all signal entries from the signal watch window
     {
-        m_omSignalList.DeleteAllItems();
-        m_odSigEntryList.RemoveAll();
+        mBaseSignalWatch->ouGetValueTable().vClear();
     }
-    m_omCSDispEntry.Unlock();
+    vDisplayMsgSigList();
     return 0;
 }
 
@@ -689,7 +579,8 @@ void CSigWatchDlg::OnTimer(UINT nIDEvent)
 {
     // TODO: Add your message handler code here and/or call default
     CDialog::OnTimer(nIDEvent);
-    if (m_unTimerId == nIDEvent)
+    // Nothing to format while hidden, the table keeps the latest values
+    if (m_unTimerId == nIDEvent && IsWindowVisible())
     {
         vDisplayMsgSigList();
     }
@@ -30,33 +30,11 @@
 #include "SignalWatchDefs.h"
 #include "SignalWatch_resource.h"
 #include "DataTypes/MsgSignal_Datatypes.h"
+#include "SignalValueTable.h"
 
 /////////////////////////////////////////////////////////////////////////////
 // CSigWatchDlg dialog
 
-struct sSIGENTRY
-{
-    long m_nKey;
-    CString m_omMsgName;
-    CString m_omSigName;
-    CString m_omRawValue;
-    CString m_omPhyValue;
-    INT    m_nEntryIndex;
-    BOOL operator == (const sSIGENTRY& RefObj) const
-    {
-        bool bRet = false;
-
-        bRet = ( (m_nKey == RefObj.m_nKey) && (m_omMsgName == RefObj.m_omMsgName)&&(m_omSigName == RefObj.m_omSigName));
-        return bRet;
-    }
-    sSIGENTRY()
-    {
-        m_nEntryIndex = -1;
-    }
-};
-
-
-typedef CList<sSIGENTRY, sSIGENTRY&> CSigEntryList;
 class CSigWatchDlg : public CDialog
 {
 public:
@@ -73,14 +51,7 @@ public:
     // Construction
     CSigWatchDlg(class CBaseSignalWatchImp* baseSignalWatch, CWnd* pParent = nullptr, ETYPE_BUS eBus = CAN);   // standard constructor
     ~CSigWatchDlg();
-    void vAddMsgToWnd(SSignalInfoArray* sSingnalinfo, BOOL bIntptrDone, std::map<long, std::list<std::string>>* m_mapDetails, long mID);
-    std::map<long,std::list<std::string>>* m_mapMsgIDtoSignallst;
     // Operation
-    void vAddMsgSigIntoList(const CString& omStrMsgName,
-                            const CStringArray& omSASignals,
-                            const CStringArray& omSARaw,
-                            const CStringArray& omSAPhysical,
-                            BOOL bIntptrDone);
     //void vUpdateWndCo_Ords();
     void vSaveDefaultWinStatus( );
     void vSetDefaultWinStatus( );
@@ -116,8 +87,6 @@ protected:
 private:
     bool m_bEscape;
     ETYPE_BUS m_eBus;
-    CSigEntryList m_odSigEntryList;
-    CSigEntryList m_odSigEntryListLIN;
     class CBaseSignalWatchImp* mBaseSignalWatch;
 
     // For Wnd Co-ordinates
@@ -128,7 +97,12 @@ private:
     HWND m_hMainWnd;
 private:
     void vDisplayMsgSigList(void);
-    CCriticalSection m_omCSDispEntry;
+    void vFormatSignalValue(const sSIGVALUE& sValue, CString& omRawValue, CString& omPhyValue);
+    UINT m_unTableGeneration;
+    UINT64 m_un64LastSequence;
+    bool m_bHexShown;
+    std::vector<int> m_anEntryRow;                  // Value table entry -> list row
+    std::vector<sSIGVALUE> m_ouChangedValues;
     UINT m_unTimerId;
 public:
     afx_msg void OnTimer(UINT nIDEvent);
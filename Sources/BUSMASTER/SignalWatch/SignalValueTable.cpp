@@ -0,0 +1,174 @@
+#include "SignalWatch_stdafx.h"
+#include "SignalValueTable.h"
+
+CSignalValueTable::CSignalValueTable()
+{
+    InitializeCriticalSection(&m_omCritSec);
+    m_un64Sequence = 0;
+    m_unGeneration = 1;
+}
+
+CSignalValueTable::~CSignalValueTable()
+{
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+CSignalValueTable::sFRAMESLOT& CSignalValueTable::ouCreateFrameSlot(const FRAMEKEY& ouKey, IFrame* pouFrame,
+        const std::list<std::string>& ouWatchedSignals)
+{
+    sFRAMESLOT& ouSlot = m_ouFrameSlots[ouKey];
+
+    pouFrame->GetName(ouSlot.m_strFrameName);
+    std::string strMsgName = ouSlot.m_strFrameName;
+    if (ouKey.first > 1)
+    {
+        char acChannel[16];
+        sprintf_s(acChannel, sizeof(acChannel), " (Ch %d)", ouKey.first);
+        strMsgName += acChannel;
+    }
+
+    std::map<ISignal*, SignalInstanse> ouSignals;
+    pouFrame->GetSignalList(ouSignals);
+    for (auto itrWatched = ouWatchedSignals.begin(); itrWatched != ouWatchedSignals.end(); ++itrWatched)
+    {
+        for (auto itrSignal = ouSignals.begin(); itrSignal != ouSignals.end(); ++itrSignal)
+        {
+            std::string strSigName;
+            itrSignal->first->GetName(strSigName);
+            if (strSigName != *itrWatched || ouSlot.m_ouSignalIndex.end() != ouSlot.m_ouSignalIndex.find(strSigName))
+            {
+                continue;
+            }
+            sSIGVALUE sEntry;
+            sEntry.m_nIndex = (int)m_ouEntries.size();
+            sEntry.m_ucChannel = ouKey.first;
+            sEntry.m_nMsgKey = ouKey.second;
+            sEntry.m_strMsgName = strMsgName;
+            sEntry.m_strSigName = strSigName;
+            itrSignal->first->GetUnit(sEntry.m_strUnit);
+            sEntry.m_pouCoding = nullptr;
+            itrSignal->first->GetEncoding(&sEntry.m_pouCoding);
+            sEntry.m_unLength = 0;
+            itrSignal->first->GetLength(sEntry.m_unLength);
+            eSignalDataType eDataType = eUnsigned;
+            itrSignal->first->GetDataType(eDataType);
+            sEntry.m_bSigned = (eSigned == eDataType);
+            sEntry.m_un64RawValue = 0;
+            sEntry.m_dPhyValue = 0;
+            sEntry.m_un64Sequence = 0;
+
+            ouSlot.m_ouSignalIndex[strSigName] = sEntry.m_nIndex;
+            m_ouEntries.push_back(sEntry);
+            break;
+        }
+    }
+    return ouSlot;
+}
+
+void CSignalValueTable::vUpdate(UCHAR ucChannel, long nMsgKey, IFrame* pouFrame, const std::list<std::string>& ouWatchedSignals,
+                                const unsigned char* pbyData, int nLength)
+{
+    if (nullptr == pouFrame || nullptr == pbyData)
+    {
+        return;
+    }
+    EnterCriticalSection(&m_omCritSec);
+
+    FRAMEKEY ouKey(ucChannel, nMsgKey);
+    auto itrSlot = m_ouFrameSlots.find(ouKey);
+    sFRAMESLOT& ouSlot = (m_ouFrameSlots.end() != itrSlot) ? itrSlot->second : ouCreateFrameSlot(ouKey, pouFrame, ouWatchedSignals);
+
+    if (false == ouSlot.m_ouSignalIndex.empty())
+    {
+        m_ouDecoded.clear();
+        pouFrame->InterpretSignals(pbyData, nLength, m_ouDecoded);
+
+        UINT64 un64Sequence = ++m_un64Sequence;
+        for (auto itrValue = m_ouDecoded.begin(); itrValue != m_ouDecoded.end(); ++itrValue)
+        {
+            auto itrIndex = ouSlot.m_ouSignalIndex.find(itrValue->mName);
+            if (ouSlot.m_ouSignalIndex.end() != itrIndex)
+            {
+                sSIGVALUE& sEntry = m_ouEntries[itrIndex->second];
+                sEntry.m_un64RawValue = itrValue->mUnValue;
+                sEntry.m_dPhyValue = itrValue->mPhyicalValue;
+                sEntry.m_un64Sequence = un64Sequence;
+            }
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+void CSignalValueTable::vClear()
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_ouEntries.clear();
+    m_ouFrameSlots.clear();
+    m_unGeneration++;
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+void CSignalValueTable::vRemoveMessage(const std::string& strMsgName)
+{
+    EnterCriticalSection(&m_omCritSec);
+
+    //Drop the slots of the message on all channels and compact the entries of the others
+    std::vector<sSIGVALUE> ouEntries;
+    for (auto itrSlot = m_ouFrameSlots.begin(); itrSlot != m_ouFrameSlots.end();)
+    {
+        if (0 == _stricmp(itrSlot->second.m_strFrameName.c_str(), strMsgName.c_str()))
+        {
+            itrSlot = m_ouFrameSlots.erase(itrSlot);
+            continue;
+        }
+        for (auto itrIndex = itrSlot->second.m_ouSignalIndex.begin(); itrIndex != itrSlot->second.m_ouSignalIndex.end(); ++itrIndex)
+        {
+            sSIGVALUE sEntry = m_ouEntries[itrIndex->second];
+            sEntry.m_nIndex = (int)ouEntries.size();
+            itrIndex->second = sEntry.m_nIndex;
+            ouEntries.push_back(sEntry);
+        }
+        ++itrSlot;
+    }
+    m_ouEntries.swap(ouEntries);
+    m_unGeneration++;
+
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+bool CSignalValueTable::bGetChanges(UINT& unGeneration, UINT64& un64LastSequence, std::vector<sSIGVALUE>& ouChanged)
+{
+    ouChanged.clear();
+    EnterCriticalSection(&m_omCritSec);
+
+    bool bReset = (unGeneration != m_unGeneration);
+    if (true == bReset)
+    {
+        unGeneration = m_unGeneration;
+        un64LastSequence = 0;
+    }
+    if (un64LastSequence != m_un64Sequence || true == bReset)
+    {
+        for (auto itr = m_ouEntries.begin(); itr != m_ouEntries.end(); ++itr)
+        {
+            if (itr->m_un64Sequence > un64LastSequence)
+            {
+                ouChanged.push_back(*itr);
+                //The coding belongs to the database, which is replaced only after the table is cleared
+                sSIGVALUE& sValue = ouChanged.back();
+                if (nullptr != sValue.m_pouCoding)
+                {
+                    if (EC_SUCCESS != sValue.m_pouCoding->GetValueDescription((int)sValue.m_un64RawValue, sValue.m_strDescription))
+                    {
+                        sValue.m_strDescription.clear();
+                    }
+                    sValue.m_pouCoding = nullptr;
+                }
+            }
+        }
+        un64LastSequence = m_un64Sequence;
+    }
+
+    LeaveCriticalSection(&m_omCritSec);
+    return bReset;
+}
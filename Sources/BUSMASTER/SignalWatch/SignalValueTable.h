@@ -0,0 +1,62 @@
+#pragma once
+#include <map>
+#include <list>
+#include <string>
+#include <vector>
+#include "IBMNetWorkGetService.h"
+
+/* Latest decoded value of one watched signal */
+struct sSIGVALUE
+{
+    int m_nIndex;                       // Position in the table, stable until the next reset
+    UCHAR m_ucChannel;                  // Hardware channel, 1 based
+    long m_nMsgKey;
+    std::string m_strMsgName;
+    std::string m_strSigName;
+    std::string m_strUnit;
+    ICoding* m_pouCoding;               // For value descriptions, may be nullptr. Used under the table lock only
+    unsigned int m_unLength;
+    bool m_bSigned;
+    unsigned __int64 m_un64RawValue;
+    double m_dPhyValue;
+    UINT64 m_un64Sequence;              // Table sequence of the last update, 0 if never received
+    std::string m_strDescription;       // Value description of the raw value, set in the copies of bGetChanges
+};
+
+/* Signal watch keeps only the latest numeric value per (channel, message,
+   signal). The read thread decodes into the table, the window pulls the
+   entries updated since its previous refresh and formats only those. */
+class CSignalValueTable
+{
+public:
+    CSignalValueTable();
+    ~CSignalValueTable();
+
+    void vUpdate(UCHAR ucChannel, long nMsgKey, IFrame* pouFrame, const std::list<std::string>& ouWatchedSignals,
+                 const unsigned char* pbyData, int nLength);
+    void vClear();
+    /* Removes the entries of the message on every channel */
+    void vRemoveMessage(const std::string& strMsgName);
+
+    /* Copies the entries updated after un64LastSequence. Returns true if the
+       table was reset since unGeneration, in which case all rows are stale
+       and every entry received so far is returned. */
+    bool bGetChanges(UINT& unGeneration, UINT64& un64LastSequence, std::vector<sSIGVALUE>& ouChanged);
+
+private:
+    struct sFRAMESLOT
+    {
+        std::string m_strFrameName;                     // Database name, without the channel suffix of the rows
+        std::map<std::string, int> m_ouSignalIndex;    // Signal name -> entry
+    };
+    typedef std::pair<UCHAR, long> FRAMEKEY;
+
+    CRITICAL_SECTION m_omCritSec;
+    std::vector<sSIGVALUE> m_ouEntries;
+    std::map<FRAMEKEY, sFRAMESLOT> m_ouFrameSlots;
+    std::vector<SignalValue> m_ouDecoded;               // Reused for every frame
+    UINT64 m_un64Sequence;
+    UINT m_unGeneration;
+
+    sFRAMESLOT& ouCreateFrameSlot(const FRAMEKEY& ouKey, IFrame* pouFrame, const std::list<std::string>& ouWatchedSignals);
+};
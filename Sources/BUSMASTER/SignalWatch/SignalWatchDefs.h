@@ -27,6 +27,7 @@
 #define defSTR_RAW_COLUMN           "Raw Value"
 
 #define defSW_LIST_COLUMN_COUNT     4
+#define defSW_MAX_CHANNELS          16
 #define defSTR_SW_MSG_NAME          "Message"
 #define defSTR_SW_MSG_COL           0
 #define defSTR_SW_SIG_NAME          "Signal"
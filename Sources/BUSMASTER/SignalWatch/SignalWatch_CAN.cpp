@@ -116,57 +116,8 @@ HRESULT CSignalWatch_CAN::StartSigWatchReadThread()
 
 void CSignalWatch_CAN::vDisplayInSigWatchWnd(STCANDATA& sCanData)
 {
-    EnterCriticalSection( &m_omCritSecSW );
-    if ( mDbCluster != nullptr )
-    {
-        //STLINDATA * sLinData;
-        static CString omMsgName;
-        static CStringArray omSigNames, omRawValues, omPhyValues;
-
-        SSignalInfoArray sSingnalinfo;
-        std::list<InterpreteSignals> sInterPretedSignals;
-        std::string msgName;
-
-        int channel = 0;/*sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;*/
-        auto itr = m_mapMsgIDtoSignallst[channel].find( sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID );
-        if ( itr != m_mapMsgIDtoSignallst[channel].end() )
-        {
-            int mID = itr->first;
-
-            //if ( mID == sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID )
-            {
-                IFrame* pFrame = nullptr;
-                mDbCluster->GetFrame( CAN, 0 /*channel index*/, sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID, nullptr, &pFrame );
-                if ( nullptr != pFrame )
-                {
-                    pFrame->InterpretSignals( sCanData.m_uDataInfo.m_sCANMsg.m_ucData, sCanData.m_uDataInfo.m_sCANMsg.m_ucDataLen, sInterPretedSignals, m_bHex );
-
-                    SSignalInfoArray ouSSignalInfoArray;
-                    SSignalInfo ouSSignalInfo;
-                    std::string strName;
-                    pFrame->GetName( strName );
-                    ouSSignalInfo.m_msgName = strName.c_str();
-for ( auto itr : sInterPretedSignals )
-                    {
-                        ouSSignalInfo.m_omEnggValue = itr.m_omEnggValue.c_str();
-                        ouSSignalInfo.m_omRawValue = itr.m_omRawValue.c_str();
-                        ouSSignalInfo.m_omSigName = itr.m_omSigName.c_str();
-                        ouSSignalInfo.m_omUnit = itr.m_omUnit.c_str();
-                        ouSSignalInfoArray.Add( ouSSignalInfo );
-                    }
-
-
-
-                    if ( ouSSignalInfoArray.GetSize() > 0 && m_mapMsgIDtoSignallst->size() != 0 )
-                    {
-                        m_pouSigWnd->vAddMsgToWnd( &ouSSignalInfoArray, FALSE, m_mapMsgIDtoSignallst, mID );
-                    }
-                }
-            }
-        }
-    }
-
-    LeaveCriticalSection( &m_omCritSecSW );
+    STCAN_MSG& sCanMsg = sCanData.m_uDataInfo.m_sCANMsg;
+    vUpdateSignalValues( sCanMsg.m_ucChannel, sCanMsg.m_unMsgID, sCanMsg.m_ucData, sCanMsg.m_ucDataLen );
 }
 
 
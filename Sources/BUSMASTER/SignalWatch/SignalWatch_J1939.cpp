@@ -17,28 +17,26 @@
 #include "include/XMLDefines.h"
 #include "MsgSignalSelect.h"
 #include "Error.h"
+#include "J1939MsgPool.h"
 int CSignalWatch_J1939::ReadJ1939DataBuffer( CSignalWatch_J1939* pSWJ1939 )
 {
     VALIDATE_POINTER_RETURN_VAL(pSWJ1939, -1);
     while (pSWJ1939->m_ouMsgBufVSE_J.GetMsgCount() > 0)
     {
         static STJ1939_MSG sMsg;
-        static BYTE abyData[MAX_MSG_LEN_J1939] = {0xFF};
-        INT nType = 0;
-        INT nSize = MAX_MSG_LEN_J1939;
-        HRESULT Result = pSWJ1939->m_ouMsgBufVSE_J.ReadFromBuffer(nType, abyData, nSize);
-        if (Result == ERR_READ_MEMORY_SHORT)
-        {
-            TRACE("ERR_READ_MEMORY_SHORT");
-        }
-        else if (Result == EMPTY_APP_BUFFER)
+        sJ1939POOLMSG* psPoolMsg = nullptr;
+        HRESULT Result = CJ1939MsgPool::hReadFromBuffer(pSWJ1939->m_ouMsgBufVSE_J, psPoolMsg);
+        if (Result == EMPTY_APP_BUFFER)
         {
             TRACE("EMPTY_APP_BUFFER");
         }
         else if (Result == CALL_SUCCESS)
         {
-            sMsg.vSetDataStream(abyData);
+            // The message is shared with the other DIL clients, it is only read
+            sMsg.vAttachDataStream(psPoolMsg->m_abyStream);
             pSWJ1939->vDisplayInSigWatchWnd(sMsg);
+            sMsg.vDetachDataStream();
+            CJ1939MsgPool::vRelease(psPoolMsg);
         }
 
     }
@@ -94,7 +92,8 @@ DWORD WINAPI CSignalWatch_J1939::SigWatchDataReadThreadProc_J( LPVOID pVoid )
 }
 CSignalWatch_J1939::CSignalWatch_J1939():CBaseSignalWatchImp( J1939 )
 {
-
+    // The DIL writes pool references, the dropped ones are released
+    m_ouMsgBufVSE_J.vSetDropHandler(CJ1939MsgPool::vReleaseEntry);
 }
 CSignalWatch_J1939::~CSignalWatch_J1939( void )
 {
@@ -111,57 +110,8 @@ HRESULT CSignalWatch_J1939::StartSigWatchReadThread()
 
 void CSignalWatch_J1939::vDisplayInSigWatchWnd(STJ1939_MSG& sMsg)
 {
-    EnterCriticalSection( &m_omCritSecSW );
-    if ( mDbCluster != nullptr )
-    {
-        //STLINDATA * sLinData;
-        static CString omMsgName;
-        static CStringArray omSigNames, omRawValues, omPhyValues;
-
-        SSignalInfoArray sSingnalinfo;
-        std::list<InterpreteSignals> sInterPretedSignals;
-        std::string msgName;
-
-        int channel = 0;/*sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel;*/
-        auto itr = m_mapMsgIDtoSignallst[channel].find( sMsg.m_sMsgProperties.m_uExtendedID.m_s29BitId.unGetPGN() );
-        if ( itr != m_mapMsgIDtoSignallst[channel].end() )
-        {
-            int mID = itr->first;
-
-            //if ( mID == sCanData.m_uDataInfo.m_sCANMsg.m_unMsgID )
-            {
-                IFrame* pFrame = nullptr;
-                mDbCluster->GetFrame( J1939, 0 /*channel index*/, sMsg.m_sMsgProperties.m_uExtendedID.m_s29BitId.unGetPGN(), nullptr, &pFrame );
-                if ( nullptr != pFrame )
-                {
-                    pFrame->InterpretSignals(sMsg.m_pbyData, sMsg.m_unDLC, sInterPretedSignals, m_bHex);
-
-                    SSignalInfoArray ouSSignalInfoArray;
-                    SSignalInfo ouSSignalInfo;
-                    std::string strName;
-                    pFrame->GetName( strName );
-                    ouSSignalInfo.m_msgName = strName.c_str();
-for ( auto itr : sInterPretedSignals )
-                    {
-                        ouSSignalInfo.m_omEnggValue = itr.m_omEnggValue.c_str();
-                        ouSSignalInfo.m_omRawValue = itr.m_omRawValue.c_str();
-                        ouSSignalInfo.m_omSigName = itr.m_omSigName.c_str();
-                        ouSSignalInfo.m_omUnit = itr.m_omUnit.c_str();
-                        ouSSignalInfoArray.Add( ouSSignalInfo );
-                    }
-
-
-
-                    if ( ouSSignalInfoArray.GetSize() > 0 && m_mapMsgIDtoSignallst->size() != 0 )
-                    {
-                        m_pouSigWnd->vAddMsgToWnd( &ouSSignalInfoArray, FALSE, m_mapMsgIDtoSignallst, mID );
-                    }
-                }
-            }
-        }
-    }
-
-    LeaveCriticalSection( &m_omCritSecSW );
+    vUpdateSignalValues( sMsg.m_sMsgProperties.m_byChannel, sMsg.m_sMsgProperties.m_uExtendedID.m_s29BitId.unGetPGN(),
+                         sMsg.m_pbyData, sMsg.m_unDLC );
 }
 
 
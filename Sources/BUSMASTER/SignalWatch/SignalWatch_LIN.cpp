@@ -120,59 +120,8 @@ HRESULT CSignalWatch_LIN::StartSigWatchReadThread()
 
 void CSignalWatch_LIN::vDisplayInSigWatchWnd(STLINDATA& sLinData)
 {
-    EnterCriticalSection(&m_omCritSecSW);
-    if ( mDbCluster != nullptr )
-    {
-        //STLINDATA * sLinData;
-        static CString omMsgName;
-        static CStringArray omSigNames, omRawValues, omPhyValues;
-        /*if (m_pMsgInterPretObj->bInterpretMsgSigList(sLinData.m_uDataInfo.m_sLINMsg.m_ucMsgID,
-        sLinData.m_uDataInfo.m_sLINMsg.m_ucData,omMsgName, omSigNames, omRawValues, omPhyValues, m_bHex))*/
-        SSignalInfoArray sSingnalinfo;
-        std::list<InterpreteSignals> sInterPretedSignals;
-        std::string msgName;
-
-        int mID = 0;
-        auto itr = m_mapMsgIDtoSignallst->find(sLinData.m_uDataInfo.m_sLINMsg.m_ucMsgID);
-
-        if (itr != m_mapMsgIDtoSignallst->end())
-        {
-            mID = itr->first;
-            if (mID == sLinData.m_uDataInfo.m_sLINMsg.m_ucMsgID)
-            {
-                IFrame* pFrame = nullptr;
-                mDbCluster->GetFrame(LIN, 0 /*channel index*/, sLinData.m_uDataInfo.m_sLINMsg.m_ucMsgID, nullptr, &pFrame);
-                if (nullptr != pFrame)
-                {
-                    pFrame->InterpretSignals(sLinData.m_uDataInfo.m_sLINMsg.m_ucData, sLinData.m_uDataInfo.m_sLINMsg.m_ucDataLen, sInterPretedSignals, m_bHex);
-
-                    SSignalInfoArray ouSSignalInfoArray;
-                    SSignalInfo ouSSignalInfo;
-                    std::string strName;
-                    pFrame->GetName(strName);
-                    ouSSignalInfo.m_msgName = strName.c_str();
-for (auto itr : sInterPretedSignals)
-                    {
-                        ouSSignalInfo.m_omEnggValue = itr.m_omEnggValue.c_str();
-                        ouSSignalInfo.m_omRawValue = itr.m_omRawValue.c_str();
-                        ouSSignalInfo.m_omSigName = itr.m_omSigName.c_str();
-                        ouSSignalInfo.m_omUnit = itr.m_omUnit.c_str();
-                        ouSSignalInfoArray.Add(ouSSignalInfo);
-                    }
-
-
-
-                    if (ouSSignalInfoArray.GetSize() > 0 && m_mapMsgIDtoSignallst->size() != 0)
-                    {
-                        m_pouSigWnd->vAddMsgToWnd(&ouSSignalInfoArray, FALSE, m_mapMsgIDtoSignallst, mID);
-                    }
-                }
-            }
-        }
-
-    }
-
-    LeaveCriticalSection( &m_omCritSecSW );
+    STLIN_MSG& sLinMsg = sLinData.m_uDataInfo.m_sLINMsg;
+    vUpdateSignalValues( sLinMsg.m_ucChannel, sLinMsg.m_ucMsgID, sLinMsg.m_ucData, sLinMsg.m_ucDataLen );
 }
 
 
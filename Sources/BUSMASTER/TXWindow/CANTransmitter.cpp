@@ -43,16 +43,45 @@ DWORD WINAPI CCANTransmitter::TransmitThread(LPVOID pVoid)
         return (DWORD)-1;
     }
 
+    IClockService* pouClock = nullptr;
+    CLOCK_GetInterface(&pouClock);
+    bool bAttached = false;
     bool bLoopON = true;
 
     while (bLoopON)
     {
-        WaitForSingleObject(pThreadParam->m_hActionEvent, 1);
+        int nElapsed = 1;
+        int nTicks = 0;
+        if ((nullptr != pouClock) && pouClock->bIsVirtual() && (INVOKE_FUNCTION == pThreadParam->m_unActionCode))
+        {
+            nTicks = pouData->nGetTimeToNextTransmission();
+        }
+        if (nTicks > 0)
+        {
+            //Virtual time: no polling, the clock jumps to the next due message
+            if (false == bAttached)
+            {
+                pouClock->vAttach();
+                bAttached = true;
+            }
+            UINT64 un64Start = pouClock->un64GetTime();
+            pouClock->dwWaitUntil(pThreadParam->m_hActionEvent, un64Start + ((UINT64)nTicks * 1000));
+            nElapsed = (int)((pouClock->un64GetTime() - un64Start) / 1000);
+        }
+        else
+        {
+            WaitForSingleObject(pThreadParam->m_hActionEvent, 1);
+        }
+        if ((true == bAttached) && ((0 == nTicks) || (INVOKE_FUNCTION != pThreadParam->m_unActionCode)))
+        {
+            pouClock->vDetach();
+            bAttached = false;
+        }
         switch (pThreadParam->m_unActionCode)
         {
             case INVOKE_FUNCTION:
             {
-                pouData->TransmitAll();
+                pouData->TransmitElapsed(nElapsed);
             }
             break;
 
@@ -226,6 +255,18 @@ Date Created     : 14.02.2016
 Requirement ID   :
 ***************************************************************************************/
 int CCANTransmitter::TransmitAll()
+{
+    return TransmitElapsed(1);
+}
+/**************************************************************************************
+Function Name    : TransmitElapsed
+Input(s)         : nElapsed - Milliseconds passed since the last call.
+Output           : -
+Functionality    : Transmits the cyclic messages whose time has come. The messages
+                   due together are handed to the DIL in one call.
+Member of        : CCANTransmitter
+***************************************************************************************/
+int CCANTransmitter::TransmitElapsed(int nElapsed)
 {
     int hResult = S_FALSE;
     if (nullptr == m_pouTxDataStore)
@@ -234,8 +275,10 @@ int CCANTransmitter::TransmitAll()
     }
     hResult = S_OK;
 
+    m_ouDueMsgs.clear();
     int nSize = m_pouTxDataStore->GetMsgItemCount();
     ITxMsgItem* pouMsgItem = nullptr;
+    STCAN_MSG ouMsg;
     for (int nCount = 0; nCount < nSize; nCount++)
     {
         m_pouTxDataStore->GetMsgItem(nCount, pouMsgItem);
@@ -243,10 +286,13 @@ int CCANTransmitter::TransmitAll()
         {
             if (true == pouMsgItem->TxDetails.m_bTimerEnabled)
             {
-                pouMsgItem->TxDetails.nCurrentTimerVal--;
+                pouMsgItem->TxDetails.nCurrentTimerVal -= nElapsed;
                 if (pouMsgItem->TxDetails.nCurrentTimerVal <= 0)
                 {
-                    TransmitAt(nCount);
+                    if (S_OK == nGetMsgAt(nCount, ouMsg))
+                    {
+                        m_ouDueMsgs.push_back(ouMsg);
+                    }
                     pouMsgItem->TxDetails.nCurrentTimerVal = pouMsgItem->TxDetails.nActualTimer;
                 }
                 m_pouTxDataStore->SetMsgItem(nCount, pouMsgItem);
@@ -254,9 +300,51 @@ int CCANTransmitter::TransmitAll()
         }
 
     }
+
+    if (false == m_ouDueMsgs.empty())
+    {
+        CBaseDIL_CAN* pouBaseDIL_CAN = nullptr;
+        DIL_GetInterface(CAN, (void**)&pouBaseDIL_CAN);
+        if (nullptr != pouBaseDIL_CAN)
+        {
+            pouBaseDIL_CAN->DILC_SendMsgs(m_ulClientId, &m_ouDueMsgs[0], (UINT)m_ouDueMsgs.size(), nullptr);
+        }
+    }
     return hResult;
 }
 /**************************************************************************************
+Function Name    : nGetTimeToNextTransmission
+Input(s)         : -
+Output           : Milliseconds until the next cyclic message is due, 0 if there is none.
+Functionality    : Used to wait on the virtual clock instead of polling every millisecond.
+Member of        : CCANTransmitter
+***************************************************************************************/
+int CCANTransmitter::nGetTimeToNextTransmission()
+{
+    int nTicks = 0;
+    if (nullptr == m_pouTxDataStore)
+    {
+        return nTicks;
+    }
+
+    int nSize = m_pouTxDataStore->GetMsgItemCount();
+    ITxMsgItem* pouMsgItem = nullptr;
+    for (int nCount = 0; nCount < nSize; nCount++)
+    {
+        pouMsgItem = nullptr;
+        m_pouTxDataStore->GetMsgItem(nCount, pouMsgItem);
+        if ((nullptr != pouMsgItem) && (true == pouMsgItem->TxDetails.m_bTimerEnabled))
+        {
+            int nLeft = max(pouMsgItem->TxDetails.nCurrentTimerVal, 1);
+            if ((0 == nTicks) || (nLeft < nTicks))
+            {
+                nTicks = nLeft;
+            }
+        }
+    }
+    return nTicks;
+}
+/**************************************************************************************
 Function Name    : OnKeyPressed
 Input(s)         : chKey - Key associated with the message pressed by the user
 Output           : S_OK - If msg is transmitted successfully on key press, else S_FALSE.
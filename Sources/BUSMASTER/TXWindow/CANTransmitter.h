@@ -24,6 +24,7 @@
 #include "stdafx.h"
 #include "..\Utility\Utility_Thread.h"
 #include"ITransmitter.h"
+#include <vector>
 
 class CCANTransmitter :public ITransmitter
 {
@@ -33,6 +34,7 @@ private:
     unsigned long m_ulClientId;
     CTxDataStore* m_pouTxDataStore;
     ESTATUS_BUS m_eBusStatus;
+    std::vector<STCAN_MSG> m_ouDueMsgs;     //Cyclic messages due at a tick, sent in one call
 
     CPARAM_THREADPROC m_ouTransmitThread;
     //CAN Msg Transmission Thread.
@@ -47,6 +49,8 @@ private:
 
     //Helpers
     int nGetMsgAt(int nIndex, STCAN_MSG& ouCANMsg);
+    int TransmitElapsed(int nElapsed);
+    int nGetTimeToNextTransmission();
 
 public:
     //Gets Singleton Instance
@@ -384,23 +384,10 @@ int CLINScheduleDataStore::nGetTableHandle(int nChannel, int nTableIndex)
     return -1;
 }
 
-bool CLINScheduleDataStore::bIsFrameSupported(eCommandType eCmdType)
+bool CLINScheduleDataStore::bIsFrameSupported(eCommandType /*eCmdType*/)
 {
-    switch(eCmdType)
-    {
-        case COMMAND_SPORADIC:
-        case COMMAND_EVENT:
-        {
-            return false;
-        }
-
-        break;
-        default:
-        {
-            return true;
-        }
-        break;
-    }
+    //The driver schedule runs sporadic and event triggered slots as well
+    return true;
 }
 
 int CLINScheduleDataStore::nEnableCommands(CSheduleTable& ouTable, bool bEnable)
@@ -21,48 +21,484 @@
 
 #include "TSExecutorGUI_StdAfx.h"
 #include "ExpressionExecutor.h"
-extern "C" int bGetExpressionResult(char* pchExpression);
+#include <math.h>
+#include <ctype.h>
+#include <string>
+
+#define defMAX_EVAL_DEPTH   64
+
 /******************************************************************************
-Function Name  :  SubstituteX
-Input(s)       :  DWORD dwVal - value that has to be replaced with
-Output         :  BOOL
-Functionality  :
-Member of      :  CExpressionExecutor
-Friend of      :  -
-Author(s)      :  Venkatanarayana Makam
-Date Created   :  01/04/2011
-Modifications  :
+Function Name  :  CCompiledExpression
+Input(s)       :  -
+Output         :  -
+Functionality  :  Constructor
+Member of      :  CCompiledExpression
+******************************************************************************/
+CCompiledExpression::CCompiledExpression()
+{
+    m_nMaxDepth = 0;
+    m_bValid = FALSE;
+    m_pcCursor = nullptr;
+    m_eToken = TOK_END;
+    m_eTokenOp = OP_CONST;
+    m_dTokenValue = 0;
+    m_nDepth = 0;
+}
+
+/******************************************************************************
+Function Name  :  nGetPrecedence
+Input(s)       :  eOpCode - Binary operator
+Output         :  int - Binding strength, 0 if not a left associative operator
+Functionality  :  Operator precedence as declared in parser.y
+Member of      :  CCompiledExpression
+******************************************************************************/
+int CCompiledExpression::nGetPrecedence(eOPCODE eOpCode)
+{
+    switch (eOpCode)
+    {
+        case OP_OR:
+            return 1;
+        case OP_AND:
+            return 2;
+        case OP_EQ:
+        case OP_NE:
+            return 3;
+        case OP_GT:
+        case OP_LT:
+        case OP_GE:
+        case OP_LE:
+            return 4;
+        case OP_ADD:
+        case OP_SUB:
+            return 5;
+        case OP_MUL:
+        case OP_DIV:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+/******************************************************************************
+Function Name  :  vNextToken
+Input(s)       :  -
+Output         :  -
+Functionality  :  Reads the next token, the rules are the ones of lexer.l.
+                  ';' or the end of the string terminates the expression.
+Member of      :  CCompiledExpression
+******************************************************************************/
+void CCompiledExpression::vNextToken()
+{
+    while (' ' == *m_pcCursor || '\t' == *m_pcCursor)
+    {
+        m_pcCursor++;
+    }
+    char ch = *m_pcCursor;
+    if ('\0' == ch || ';' == ch)
+    {
+        m_eToken = TOK_END;
+        return;
+    }
+    if ('x' == ch || 'X' == ch)
+    {
+        m_pcCursor++;
+        m_eToken = TOK_VAR;
+        return;
+    }
+    if (isdigit((unsigned char)ch) || '.' == ch)
+    {
+        const char* pcStart = m_pcCursor;
+        int nDigits = 0;
+        while (isdigit((unsigned char)*m_pcCursor))
+        {
+            m_pcCursor++;
+            nDigits++;
+        }
+        if ('.' == *m_pcCursor)
+        {
+            m_pcCursor++;
+            while (isdigit((unsigned char)*m_pcCursor))
+            {
+                m_pcCursor++;
+                nDigits++;
+            }
+        }
+        if (0 == nDigits)
+        {
+            m_eToken = TOK_ERROR;
+            return;
+        }
+        m_eToken = TOK_NUMBER;
+        m_dTokenValue = atof(std::string(pcStart, m_pcCursor).c_str());
+        return;
+    }
+
+    m_eToken = TOK_BINARY;
+    char chNext = m_pcCursor[1];
+    m_pcCursor++;
+    switch (ch)
+    {
+        case '+':
+            m_eTokenOp = OP_ADD;
+            break;
+        case '-':
+            m_eTokenOp = OP_SUB;
+            break;
+        case '*':
+            m_eTokenOp = OP_MUL;
+            break;
+        case '/':
+            m_eTokenOp = OP_DIV;
+            break;
+        case '^':
+            m_eTokenOp = OP_POW;
+            break;
+        case '(':
+            m_eToken = TOK_OPEN;
+            break;
+        case ')':
+            m_eToken = TOK_CLOSE;
+            break;
+        case '>':
+        case '<':
+            if ('=' == chNext)
+            {
+                m_pcCursor++;
+                m_eTokenOp = ('>' == ch) ? OP_GE : OP_LE;
+            }
+            else
+            {
+                m_eTokenOp = ('>' == ch) ? OP_GT : OP_LT;
+            }
+            break;
+        case '=':
+        case '!':
+        case '|':
+        case '&':
+            if (('=' == ch && '=' == chNext) || ('!' == ch && '=' == chNext)
+                    || ('|' == ch && '|' == chNext) || ('&' == ch && '&' == chNext))
+            {
+                m_pcCursor++;
+                m_eTokenOp = ('=' == ch) ? OP_EQ : ('!' == ch) ? OP_NE : ('|' == ch) ? OP_OR : OP_AND;
+            }
+            else
+            {
+                m_eToken = TOK_ERROR;
+            }
+            break;
+        default:
+            m_eToken = TOK_ERROR;
+            break;
+    }
+}
+
+/******************************************************************************
+Function Name  :  vEmit
+Input(s)       :  eOpCode - Instruction, dOperand - Constant for OP_CONST
+Output         :  -
+Functionality  :  Appends an instruction and tracks the evaluation stack depth
+Member of      :  CCompiledExpression
+******************************************************************************/
+void CCompiledExpression::vEmit(eOPCODE eOpCode, double dOperand)
+{
+    if (OP_CONST == eOpCode || OP_VAR == eOpCode)
+    {
+        m_nDepth++;
+    }
+    else if (OP_NEG != eOpCode)
+    {
+        m_nDepth--;
+    }
+    if (m_nDepth > m_nMaxDepth)
+    {
+        m_nMaxDepth = m_nDepth;
+    }
+
+    sINSTRUCTION sInstruction;
+    sInstruction.m_eOpCode = eOpCode;
+    sInstruction.m_dOperand = dOperand;
+    m_ouCode.push_back(sInstruction);
+}
+
+/******************************************************************************
+Function Name  :  bParsePrimary
+Input(s)       :  -
+Output         :  BOOL - FALSE on a syntax error
+Functionality  :  Number, X or a parenthesised expression
+Member of      :  CCompiledExpression
 ******************************************************************************/
-BOOL CExpressionExecutor::SubstituteX(CString& omFormula, float fVal)
+BOOL CCompiledExpression::bParsePrimary()
 {
-    CString omStrVal;
-    omStrVal.Format("%f", fVal);
-    omFormula.Replace("X", "x");
-    omFormula.Replace("x", omStrVal);
+    if (TOK_NUMBER == m_eToken)
+    {
+        vEmit(OP_CONST, m_dTokenValue);
+        vNextToken();
+        return TRUE;
+    }
+    if (TOK_VAR == m_eToken)
+    {
+        vEmit(OP_VAR);
+        vNextToken();
+        return TRUE;
+    }
+    if (TOK_OPEN == m_eToken)
+    {
+        vNextToken();
+        if (FALSE == bParseBinary(1) || TOK_CLOSE != m_eToken)
+        {
+            return FALSE;
+        }
+        vNextToken();
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/******************************************************************************
+Function Name  :  bParseUnary
+Input(s)       :  -
+Output         :  BOOL - FALSE on a syntax error
+Functionality  :  Unary minus and the right associative power operator.
+                  '^' binds stronger than the unary minus: -2^2 is -4.
+Member of      :  CCompiledExpression
+******************************************************************************/
+BOOL CCompiledExpression::bParseUnary()
+{
+    if (TOK_BINARY == m_eToken && OP_SUB == m_eTokenOp)
+    {
+        vNextToken();
+        if (FALSE == bParseUnary())
+        {
+            return FALSE;
+        }
+        vEmit(OP_NEG);
+        return TRUE;
+    }
+    if (FALSE == bParsePrimary())
+    {
+        return FALSE;
+    }
+    if (TOK_BINARY == m_eToken && OP_POW == m_eTokenOp)
+    {
+        vNextToken();
+        if (FALSE == bParseUnary())
+        {
+            return FALSE;
+        }
+        vEmit(OP_POW);
+    }
+    return TRUE;
+}
+
+/******************************************************************************
+Function Name  :  bParseBinary
+Input(s)       :  nMinPrecedence - Weakest operator accepted at this level
+Output         :  BOOL - FALSE on a syntax error
+Functionality  :  Left associative binary operators by precedence climbing
+Member of      :  CCompiledExpression
+******************************************************************************/
+BOOL CCompiledExpression::bParseBinary(int nMinPrecedence)
+{
+    if (FALSE == bParseUnary())
+    {
+        return FALSE;
+    }
+    while (TOK_BINARY == m_eToken && nGetPrecedence(m_eTokenOp) >= nMinPrecedence)
+    {
+        eOPCODE eOpCode = m_eTokenOp;
+        vNextToken();
+        if (FALSE == bParseBinary(nGetPrecedence(eOpCode) + 1))
+        {
+            return FALSE;
+        }
+        vEmit(eOpCode);
+    }
     return TRUE;
 }
+
+/******************************************************************************
+Function Name  :  bCompile
+Input(s)       :  omFormula - Verify condition
+Output         :  BOOL - FALSE if the condition is not a valid expression
+Functionality  :  Compiles the condition into postfix code. An invalid
+                  condition is kept and evaluates to FALSE, as before.
+Member of      :  CCompiledExpression
+******************************************************************************/
+BOOL CCompiledExpression::bCompile(const CString& omFormula)
+{
+    m_ouCode.clear();
+    m_nMaxDepth = 0;
+    m_nDepth = 0;
+    m_bValid = FALSE;
+
+    //Leading empty statements are allowed by the grammar
+    m_pcCursor = (LPCSTR)omFormula;
+    while (';' == *m_pcCursor || ' ' == *m_pcCursor || '\t' == *m_pcCursor)
+    {
+        m_pcCursor++;
+    }
+    if ('\0' == *m_pcCursor)
+    {
+        return FALSE;
+    }
+    vNextToken();
+    m_bValid = (TRUE == bParseBinary(1) && TOK_END == m_eToken && m_nMaxDepth <= defMAX_EVAL_DEPTH);
+    m_pcCursor = nullptr;
+    if (FALSE == m_bValid)
+    {
+        m_ouCode.clear();
+    }
+    return m_bValid;
+}
+
+/******************************************************************************
+Function Name  :  bEvaluate
+Input(s)       :  dValue - Value of X
+Output         :  BOOL - TRUE if the condition holds
+Functionality  :  Runs the postfix code. A division by zero fails the
+                  condition, as in parser.y.
+Member of      :  CCompiledExpression
+******************************************************************************/
+BOOL CCompiledExpression::bEvaluate(double dValue) const
+{
+    if (FALSE == m_bValid)
+    {
+        return FALSE;
+    }
+    double adStack[defMAX_EVAL_DEPTH];
+    int nTop = -1;
+    for (auto itr = m_ouCode.begin(); itr != m_ouCode.end(); ++itr)
+    {
+        if (OP_CONST == itr->m_eOpCode)
+        {
+            adStack[++nTop] = itr->m_dOperand;
+            continue;
+        }
+        if (OP_VAR == itr->m_eOpCode)
+        {
+            adStack[++nTop] = dValue;
+            continue;
+        }
+        if (OP_NEG == itr->m_eOpCode)
+        {
+            adStack[nTop] = -adStack[nTop];
+            continue;
+        }
+        double dRight = adStack[nTop--];
+        double& dLeft = adStack[nTop];
+        switch (itr->m_eOpCode)
+        {
+            case OP_ADD:
+                dLeft = dLeft + dRight;
+                break;
+            case OP_SUB:
+                dLeft = dLeft - dRight;
+                break;
+            case OP_MUL:
+                dLeft = dLeft * dRight;
+                break;
+            case OP_DIV:
+                if (0 == dRight)
+                {
+                    return FALSE;
+                }
+                dLeft = dLeft / dRight;
+                break;
+            case OP_POW:
+                dLeft = pow(dLeft, dRight);
+                break;
+            case OP_GT:
+                dLeft = (dLeft > dRight) ? 1 : 0;
+                break;
+            case OP_LT:
+                dLeft = (dLeft < dRight) ? 1 : 0;
+                break;
+            case OP_GE:
+                dLeft = (dLeft >= dRight) ? 1 : 0;
+                break;
+            case OP_LE:
+                dLeft = (dLeft <= dRight) ? 1 : 0;
+                break;
+            case OP_EQ:
+                dLeft = (dLeft == dRight) ? 1 : 0;
+                break;
+            case OP_NE:
+                dLeft = (dLeft != dRight) ? 1 : 0;
+                break;
+            case OP_OR:
+                dLeft = (int)dLeft | (int)dRight;
+                break;
+            case OP_AND:
+                dLeft = ((int)dLeft && (int)dRight) ? 1 : 0;
+                break;
+            default:
+                return FALSE;
+        }
+    }
+    //Truncated to an integer, only 1 is TRUE
+    return (adStack[0] >= 1.0 && adStack[0] < 2.0) ? TRUE : FALSE;
+}
+
+/******************************************************************************
+Function Name  :  CExpressionExecutor
+Input(s)       :  -
+Output         :  -
+Functionality  :  Constructor
+Member of      :  CExpressionExecutor
+******************************************************************************/
+CExpressionExecutor::CExpressionExecutor()
+{
+    InitializeCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+Function Name  :  ~CExpressionExecutor
+Input(s)       :  -
+Output         :  -
+Functionality  :  Destructor
+Member of      :  CExpressionExecutor
+******************************************************************************/
+CExpressionExecutor::~CExpressionExecutor()
+{
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+/******************************************************************************
+Function Name  :  ouGetCompiledExpression
+Input(s)       :  omFormula - Expression
+Output         :  const CCompiledExpression& - Valid as long as the executor
+Functionality  :  Every distinct condition is compiled once, verify windows
+                  then only evaluate the cached code per received frame.
+Member of      :  CExpressionExecutor
+******************************************************************************/
+const CCompiledExpression& CExpressionExecutor::ouGetCompiledExpression(const CString& omFormula)
+{
+    EnterCriticalSection(&m_omCritSec);
+    auto itr = m_ouCompiled.find(omFormula);
+    if (m_ouCompiled.end() == itr)
+    {
+        itr = m_ouCompiled.insert(std::make_pair(omFormula, CCompiledExpression())).first;
+        itr->second.bCompile(omFormula);
+    }
+    const CCompiledExpression& ouExpression = itr->second;
+    LeaveCriticalSection(&m_omCritSec);
+    return ouExpression;
+}
+
 /******************************************************************************
 Function Name  :  bGetExpressionValue
 Input(s)       :  CString omFormula - Expression
-                  DWORD dwValue - Variable Value
+                  double dValue - Variable Value
 Output         :  BOOL
 Functionality  :  Evaluates the Expressioin
 Member of      :  CExpressionExecutor
 Friend of      :  -
 Author(s)      :  Venkatanarayana Makam
 Date Created   :  01/04/2011
-Modifications  :
+Modifications  :  Evaluates the compiled condition instead of substituting
+                  the value into the text and parsing it again
 ******************************************************************************/
-BOOL CExpressionExecutor::bGetExpressionValue(CString omFormula, float fValue)
+BOOL CExpressionExecutor::bGetExpressionValue(const CString& omFormula, double dValue)
 {
-    if(omFormula.GetLength() == 0)
-    {
-        return FALSE;
-    }
-    SubstituteX(omFormula, fValue);
-    char chBuffer[1024] = {'\n'};
-    strcpy(chBuffer, omFormula.GetBuffer(MAX_PATH));
-    chBuffer[omFormula.GetLength()-1] = ';';
-    int val = bGetExpressionResult(chBuffer);
-    return val;
+    return ouGetCompiledExpression(omFormula).bEvaluate(dValue);
 }
@@ -22,20 +22,73 @@
 #pragma once
 
 #include "Afxtempl.h"
+#include <map>
+#include <vector>
 
 const int SIZE_CHAR = sizeof(CHAR);
 
+/* A verify condition compiled into postfix code. The grammar and the
+   operator semantics are the ones of parser.y; X (or x) is the signal value. */
+class CCompiledExpression
+{
+public:
+    CCompiledExpression();
+    BOOL bCompile(const CString& omFormula);
+    BOOL bIsValid() const
+    {
+        return m_bValid;
+    }
+    /* TRUE if the condition holds for dValue. As with the former parser the
+       result is truncated to an integer and only 1 is a success. */
+    BOOL bEvaluate(double dValue) const;
+
+private:
+    enum eOPCODE
+    {
+        OP_CONST, OP_VAR, OP_NEG,
+        OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_POW,
+        OP_GT, OP_LT, OP_GE, OP_LE, OP_EQ, OP_NE, OP_OR, OP_AND
+    };
+    enum eTOKEN
+    {
+        TOK_END, TOK_NUMBER, TOK_VAR, TOK_OPEN, TOK_CLOSE, TOK_BINARY, TOK_ERROR
+    };
+    struct sINSTRUCTION
+    {
+        eOPCODE m_eOpCode;
+        double m_dOperand;
+    };
+    std::vector<sINSTRUCTION> m_ouCode;
+    int m_nMaxDepth;
+    BOOL m_bValid;
+
+    //Compile time state
+    const char* m_pcCursor;
+    eTOKEN m_eToken;
+    eOPCODE m_eTokenOp;
+    double m_dTokenValue;
+    int m_nDepth;
+
+    void vNextToken();
+    BOOL bParseBinary(int nMinPrecedence);
+    BOOL bParseUnary();
+    BOOL bParsePrimary();
+    void vEmit(eOPCODE eOpCode, double dOperand = 0);
+    static int nGetPrecedence(eOPCODE eOpCode);
+};
+
 class CExpressionExecutor
 {
     //Member Variables
 private:
-    CString m_omFormula;
+    CRITICAL_SECTION m_omCritSec;
+    std::map<CString, CCompiledExpression> m_ouCompiled;
 
     //Member Functions
-    BOOL SubstituteX(CString& omFormula, float fVal);
 public:
-    CExpressionExecutor() {};
-    BOOL bGetExpressionValue(CString omFormula, float fValue);
-    ~CExpressionExecutor() {};
+    CExpressionExecutor();
+    /* Returns the compiled form of omFormula, compiling it on first use */
+    const CCompiledExpression& ouGetCompiledExpression(const CString& omFormula);
+    BOOL bGetExpressionValue(const CString& omFormula, double dValue);
+    ~CExpressionExecutor();
 };
-
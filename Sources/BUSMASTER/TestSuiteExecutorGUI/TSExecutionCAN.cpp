@@ -99,9 +99,7 @@ HRESULT VerifyCurrentMessage(STCANDATA& sCanData, CTSExecutionCAN* pTSXCan)
                     CMessageResult ouMsgResult;
                     if ( ouMsgData.m_byChannelNumber == sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel )    // solves issue #711, 4th bullet point
                     {
-                        std::list<InterpreteSignals> signlaList;
-                        sMsg->InterpretSignals( pucData, sizeof( pucData ), signlaList, false );
-                        if ( pTSXCan->bVerifyCanMessage( ouMsgData, signlaList, ouMsgResult ) == TRUE )
+                        if ( pTSXCan->bVerifyCanMessage( ouMsgData, sMsg, pucData, sizeof( pucData ), ouMsgResult, FALSE ) == TRUE )
                         {
                             //pTSXCan->m_nVerifyCount++;
 
@@ -354,8 +352,18 @@ HRESULT CTSExecutionCAN::TSX_VerifyResponse(CBaseEntityTA* pEntity, CResultVerif
     LARGE_INTEGER Tick1;
 
     QueryPerformanceCounter(&Tick1);
-    //Wait For Specified duration
-    HRESULT hResult = WaitForSingleObject(m_ouVerifyEvent, m_pCurrentVerify->m_ushDuration);
+    //Wait For Specified duration, on the BUSMASTER clock so that it passes at once in virtual time
+    IClockService* pouClock = nullptr;
+    CLOCK_GetInterface(&pouClock);
+    HRESULT hResult;
+    if(pouClock != nullptr)
+    {
+        hResult = pouClock->dwWait(m_ouVerifyEvent, m_pCurrentVerify->m_ushDuration);
+    }
+    else
+    {
+        hResult = WaitForSingleObject(m_ouVerifyEvent, m_pCurrentVerify->m_ushDuration);
+    }
 
     m_ouReadThread.m_unActionCode = INVOKE_FUNCTION;
 
@@ -451,8 +459,6 @@ HRESULT CTSExecutionCAN::TSX_VerifyMessage(CBaseEntityTA* pEntity, CResultVerify
             return S_FALSE;
         }
 
-        std::list<InterpreteSignals> interPretedSignalList;
-        sMsg->InterpretSignals( pucData, dataSize, interPretedSignalList, false );
         CString strVerDisplay = _("Verifying Message ")+ouVerifyData.m_omMessageName;
         TSX_DisplayMessage(strVerDisplay);
         //Verify The Signals
@@ -460,7 +466,7 @@ HRESULT CTSExecutionCAN::TSX_VerifyMessage(CBaseEntityTA* pEntity, CResultVerify
         omResult = _("SUCCESS");
         if( ouVerifyData.m_byChannelNumber == sCanData.m_uDataInfo.m_sCANMsg.m_ucChannel )    // solves issue #711, 4th bullet point
         {
-            if ( bVerifyCanMessage( ouVerifyData, interPretedSignalList, ouMsgResult ) == FALSE )
+            if ( bVerifyCanMessage( ouVerifyData, sMsg, pucData, dataSize, ouMsgResult, TRUE ) == FALSE )
             {
 
                 omResult = _("FAIL");
@@ -485,55 +491,91 @@ HRESULT CTSExecutionCAN::TSX_VerifyMessage(CBaseEntityTA* pEntity, CResultVerify
 
 /******************************************************************************
 Function Name  :  bVerifyCanMessage
-Input(s)       :
+Input(s)       :  ouVerifyData - Signal conditions of the message
+                  pouFrame - Database frame, pucData/nDataSize - Frame data
+                  bReportFailure - Fill the signal results of a failed message
 Output         :  BOOL
-Functionality  :
+Functionality  :  Evaluates the compiled signal conditions on the decoded
+                  numeric signal values. The display strings of the result
+                  are formatted only if the result is kept.
 Member of      :  CTSExecutionCAN
 Friend of      :  -
 Author(s)      :  Venkatanarayana Makam
 Date Created   :  01/04/2011
-Modifications  :
+Modifications  :  Conditions are compiled once and evaluated in double
+                  precision without converting the values to strings
 ******************************************************************************/
-BOOL CTSExecutionCAN::bVerifyCanMessage( CVerify_MessageData& ouVerifyData, std::list<InterpreteSignals>& ouSignalInfo, CMessageResult& ouMsgResult )
+BOOL CTSExecutionCAN::bVerifyCanMessage( CVerify_MessageData& ouVerifyData, IFrame* pouFrame, const unsigned char* pucData, int nDataSize,
+        CMessageResult& ouMsgResult, BOOL bReportFailure )
 {
     BOOL bResult = TRUE;
 
-    ouMsgResult.m_omMessage = ouVerifyData.m_omMessageName;
-    INT nSignalCount = (INT)ouSignalInfo.size();
+    std::vector<SignalValue> ouSignalValues;
+    pouFrame->InterpretSignals( pucData, nDataSize, ouSignalValues );
 
-for ( auto signalInfo : ouSignalInfo )
+    //Condition and outcome of every verified signal, in frame order
+    std::vector<std::pair<CSignalCondition*, BOOL> > ouOutcomes;
+    for ( auto itrValue = ouSignalValues.begin(); itrValue != ouSignalValues.end(); ++itrValue )
     {
-        CString omStrCondition;
         //TODO::Handle condition for having Same Signals are presenent(Like mAllrad_1)
-        if ( ouVerifyData.GetSignalCondition( CString(signalInfo.m_omSigName.c_str()), omStrCondition ) == S_OK )
+        CSignalCondition* pouCondition = nullptr;
+        POSITION pos = ouVerifyData.m_odSignalConditionList.GetHeadPosition();
+        while ( nullptr != pos )
         {
-            CSignalResult ouSignalResult;
-            ouSignalResult.m_omSignal = signalInfo.m_omSigName.c_str();
-            ouSignalResult.m_omSignalCondition = omStrCondition;
-            ouSignalResult.m_omResult = _("SUCCESS");
-            BOOL bRetVal;
-            if(ouVerifyData.m_eSignalUnitType == RAW)
-            {
-                //ouSignalResult.m_omSignalValue.Format("%I64u", ouSignal.m_un64RawValue);
-                ouSignalResult.m_omSignalValue = signalInfo.m_omRawValue.c_str();
-                __int64 value = _atoi64( signalInfo.m_omRawValue.c_str() );
-                bRetVal = m_ouExpressionEWxecutor.bGetExpressionValue( omStrCondition, (float)value );
-            }
-            else
+            CSignalCondition& ouCondition = ouVerifyData.m_odSignalConditionList.GetNext( pos );
+            if ( 0 == strcmp( ouCondition.m_omSigName, itrValue->mName.c_str() ) )
             {
-                //ouSignalResult.m_omSignalValue.Format("%f", ouSignal.m_dPhyValue);
-                ouSignalResult.m_omSignalValue = signalInfo.m_omEnggValue.c_str();
-                double value = atof( signalInfo.m_omEnggValue.c_str() );
-                bRetVal = m_ouExpressionEWxecutor.bGetExpressionValue( omStrCondition, (float)value );
+                pouCondition = &ouCondition;
             }
-            if(bRetVal != TRUE)
+        }
+        if ( nullptr == pouCondition )
+        {
+            continue;
+        }
+
+        double dValue;
+        if ( ouVerifyData.m_eSignalUnitType == RAW )
+        {
+            dValue = ( true == itrValue->mIsSigned ) ? (double)itrValue->mValue : (double)itrValue->mUnValue;
+        }
+        else
+        {
+            dValue = itrValue->mPhyicalValue;
+        }
+        BOOL bRetVal = m_ouExpressionEWxecutor.ouGetCompiledExpression( pouCondition->m_omCondition ).bEvaluate( dValue );
+        if ( bRetVal != TRUE )
+        {
+            //if One signal failed total message and total Testcase will be failed
+            bResult = FALSE;
+        }
+        ouOutcomes.push_back( std::make_pair( pouCondition, bRetVal ) );
+    }
+
+    if ( FALSE == bResult && FALSE == bReportFailure )
+    {
+        return bResult;
+    }
+
+    //Same display strings as the message window, including value descriptions
+    std::list<InterpreteSignals> ouSignalInfo;
+    pouFrame->InterpretSignals( pucData, nDataSize, ouSignalInfo, false );
+    ouMsgResult.m_omMessage = ouVerifyData.m_omMessageName;
+    for ( auto itrOutcome = ouOutcomes.begin(); itrOutcome != ouOutcomes.end(); ++itrOutcome )
+    {
+        CSignalResult ouSignalResult;
+        ouSignalResult.m_omSignal = itrOutcome->first->m_omSigName;
+        ouSignalResult.m_omSignalCondition = itrOutcome->first->m_omCondition;
+        ouSignalResult.m_omResult = ( TRUE == itrOutcome->second ) ? _("SUCCESS") : _("FAIL");
+        for ( auto itrInfo = ouSignalInfo.begin(); itrInfo != ouSignalInfo.end(); ++itrInfo )
+        {
+            if ( 0 == strcmp( itrOutcome->first->m_omSigName, itrInfo->m_omSigName.c_str() ) )
             {
-                ouSignalResult.m_omResult = _("FAIL");
-                //if One signal failed total message and total Testcase will be failed
-                bResult = FALSE;
+                ouSignalResult.m_omSignalValue = ( ouVerifyData.m_eSignalUnitType == RAW ) ?
+                                                 itrInfo->m_omRawValue.c_str() : itrInfo->m_omEnggValue.c_str();
+                break;
             }
-            ouMsgResult.m_SignalResultList.AddTail(ouSignalResult);
         }
+        ouMsgResult.m_SignalResultList.AddTail( ouSignalResult );
     }
     return bResult;
 }
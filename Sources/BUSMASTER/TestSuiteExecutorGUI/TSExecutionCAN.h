@@ -81,8 +81,9 @@ public:
     HRESULT TSX_VerifyResponse(CBaseEntityTA* pEntity, CResultVerify& ouVerifyResult);
     //Descrutor
     // HRESULT VerifyCurrentMessage(STCANDATA& sCanData);
-    //Verifies the can Message
-    BOOL bVerifyCanMessage( CVerify_MessageData& ouVerifyData, std::list<InterpreteSignals>&, CMessageResult& ouMsgResult );
+    //Verifies the can Message, the signal results are filled if it passes or bReportFailure is set
+    BOOL bVerifyCanMessage( CVerify_MessageData& ouVerifyData, IFrame* pouFrame, const unsigned char* pucData, int nDataSize,
+                            CMessageResult& ouMsgResult, BOOL bReportFailure );
     virtual ~CTSExecutionCAN(void);
 
 private:
@@ -286,6 +286,7 @@ USAGEMODE HRESULT TS_DoDeInitialization(ETYPE_BUS /*eBus*/)
     if (nullptr!= g_podTSExecutor)
     {
         delete g_podTSExecutor;
+        g_podTSExecutor = nullptr;
     }
     //Place this at the end of the export function.
     //switch back to previous resource handle.
@@ -323,4 +324,39 @@ USAGEMODE HRESULT TS_SetBUSMASTERVersionInfo(const BYTE bytMajor, const BYTE byt
     strBUSMASTERVersion.Format("%d.%d.%d",bytMajor, bytMinor, bytBuild);
     g_pomTSExecutorChildWindow->vSetBUSMASTERVersionInfo(strBUSMASTERVersion);
     return S_OK;
-}
\ No newline at end of file
+}
+
+/* Runs the test setup file, or the test suite of the configuration, on the
+   executor of TS_DoInitialization. Results go to the report files of the
+   test setups only. S_FALSE if there is no executor or nothing to run. */
+USAGEMODE HRESULT TS_hExecuteTestSuite(ETYPE_BUS eBus, const char* pchTestSetupFile, UINT* punExecuted, UINT* punFailed)
+{
+    if(g_podTSExecutor == nullptr || punExecuted == nullptr || punFailed == nullptr)
+    {
+        return S_FALSE;
+    }
+    HINSTANCE hInst = AfxGetResourceHandle();
+    AfxSetResourceHandle(TestSuiteExecutor.hResource);
+
+    CTSExecutorLIB ouTSExecutor;
+    ouTSExecutor.SelectBus(eBus);
+    HRESULT hResult = S_FALSE;
+    if(pchTestSetupFile != nullptr && pchTestSetupFile[0] != '\0')
+    {
+        DWORD dwID = 0;
+        hResult = ouTSExecutor.AddTestSetup(pchTestSetupFile, dwID);
+    }
+    else if(m_pXmlConfigNode != nullptr)
+    {
+        hResult = ouTSExecutor.SetConfigurationData(m_pXmlConfigNode);
+    }
+    if(hResult == S_OK)
+    {
+        ouTSExecutor.Execute();
+        ouTSExecutor.vGetVerdict(*punExecuted, *punFailed);
+    }
+    //Place this at the end of the export function.
+    //switch back to previous resource handle.
+    AfxSetResourceHandle(hInst);
+    return hResult;
+}
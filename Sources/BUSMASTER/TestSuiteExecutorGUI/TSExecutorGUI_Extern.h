@@ -49,6 +49,8 @@ extern "C" {  // only need to export C interface if used by C++ source code
     USAGEMODE HRESULT TS_GetInterface(ETYPE_BUS eBus, void** ppvInterface);
     USAGEMODE HRESULT TS_BUSConnected(bool bConnected);
     USAGEMODE HRESULT TS_SetBUSMASTERVersionInfo(const BYTE bytMajor, const BYTE bytMinor, const BYTE bytBuild);
+    //Runs a test setup file, or the test suite of the configuration if pchTestSetupFile is empty, without a window
+    USAGEMODE HRESULT TS_hExecuteTestSuite(ETYPE_BUS eBus, const char* pchTestSetupFile, UINT* punExecuted, UINT* punFailed);
 
 #ifdef __cplusplus
 }
@@ -55,6 +55,8 @@ CTSExecutorLIB::CTSExecutorLIB(void)
     m_ouTestSetupEntityList.RemoveAll();
     m_bTestSuiteStatus = FALSE;
     m_ompResultDisplayWnd = nullptr;
+    m_unExecutedTC = 0;
+    m_unFailedTC = 0;
 }
 
 /******************************************************************************
@@ -1118,6 +1120,16 @@ Code Tag       :
 HRESULT CTSExecutorLIB::Execute( /*PFCALLBACKRESULTTC pfResultTC*/)
 {
     HRESULT hResult = S_OK;
+    //The waits of the test cases run on the BUSMASTER clock. Attached, the
+    //virtual time does not advance while a test case is between two waits.
+    IClockService* pouClock = nullptr;
+    CLOCK_GetInterface(&pouClock);
+    if(pouClock != nullptr)
+    {
+        pouClock->vAttach();
+    }
+    m_unExecutedTC = 0;
+    m_unFailedTC = 0;
     INT nTSCount = (INT)m_ouTestSetupEntityList.GetCount();
     for(INT nTSIndex=0; nTSIndex<nTSCount; nTSIndex++)
     {
@@ -1128,6 +1140,10 @@ HRESULT CTSExecutorLIB::Execute( /*PFCALLBACKRESULTTC pfResultTC*/)
             bExecuteTestSetup(ouTestSetupEntity);
         }
     }
+    if(pouClock != nullptr)
+    {
+        pouClock->vDetach();
+    }
     return hResult;
 }
 
@@ -1170,10 +1186,12 @@ bool CTSExecutorLIB::bExecuteTestSetup(CTestSetupEntity& ouTestSetupEntity)
             //Now Execute;
             ouTestCaseResult.m_eResult = SUCCESS;
             bool bResult = bExecuteTestCase(pouTestCase, ouTestCaseResult);
+            m_unExecutedTC++;
             if(bResult == false)
             {
                 //TODO:: ProperHandling Required
                 ouTestCaseResult.m_eResult = ERRORS;
+                m_unFailedTC++;
             }
             GetLocalTime(&ouTestCaseResult.m_sEndTime);
             m_ouResult.m_odTcResultList.AddTail(ouTestCaseResult);
@@ -1210,27 +1228,41 @@ bool CTSExecutorLIB::bExecuteTestCase(CBaseEntityTA* pTCEntity, CResultTc& ouTes
     ouTestCaseResult.m_ouVerifyList.RemoveAll();
 
     ((CTestCaseEntity*)pTCEntity)->GetTestCaseDetails(omStrTilte, omStrID, eExp);
-    int nCurrentRow = m_ompResultDisplayWnd->GetItemCount();
-    m_ompResultDisplayWnd->InsertItem(nCurrentRow, omStrTilte);
+    //Without a result window (headless run) the steps are not displayed
+    int nCurrentRow = 0;
+    if(m_ompResultDisplayWnd != nullptr)
+    {
+        nCurrentRow = m_ompResultDisplayWnd->GetItemCount();
+        m_ompResultDisplayWnd->InsertItem(nCurrentRow, omStrTilte);
+    }
 
     UINT unCount;
     pTCEntity->GetSubEntryCount(unCount);
     for(UINT unIndex = 0; unIndex < unCount; unIndex++)
     {
-        nCurrentRow = m_ompResultDisplayWnd->GetItemCount();
-        m_ompResultDisplayWnd->InsertItem(nCurrentRow, "");
+        if(m_ompResultDisplayWnd != nullptr)
+        {
+            nCurrentRow = m_ompResultDisplayWnd->GetItemCount();
+            m_ompResultDisplayWnd->InsertItem(nCurrentRow, "");
+        }
         pTCEntity->GetSubEntityObj(unIndex, &pEntity);
         switch(pEntity->GetEntityType())
         {
             case SEND:
             {
-                m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, _("Sending Messages Started"));
+                if(m_ompResultDisplayWnd != nullptr)
+                {
+                    m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, _("Sending Messages Started"));
+                }
                 g_podTSExecutor->TSX_SendMessage(pEntity);
             }
             break;
             case VERIFY:
             {
-                m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, _("Verifying Started"));
+                if(m_ompResultDisplayWnd != nullptr)
+                {
+                    m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, _("Verifying Started"));
+                }
                 CResultVerify ouVerifyResult;
                 if(g_podTSExecutor->TSX_VerifyMessage(pEntity, ouVerifyResult) == S_FALSE)
                 {
@@ -1245,13 +1277,28 @@ bool CTSExecutorLIB::bExecuteTestCase(CBaseEntityTA* pTCEntity, CResultTc& ouTes
                 CWaitEntityData ouWaitData;
                 pEntity->GetEntityData(WAIT, &ouWaitData);
                 omStrTemp.Format(_("Waiting %d msec for %s"), ouWaitData.m_ushDuration, ouWaitData.m_omPurpose);
-                m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, omStrTemp);
-                Sleep(ouWaitData.m_ushDuration);
+                if(m_ompResultDisplayWnd != nullptr)
+                {
+                    m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, omStrTemp);
+                }
+                IClockService* pouClock = nullptr;
+                CLOCK_GetInterface(&pouClock);
+                if(pouClock != nullptr)
+                {
+                    pouClock->dwWait(nullptr, ouWaitData.m_ushDuration);
+                }
+                else
+                {
+                    Sleep(ouWaitData.m_ushDuration);
+                }
             }
             break;
             case VERIFYRESPONSE:
             {
-                m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, _("VerifyRequest Started"));
+                if(m_ompResultDisplayWnd != nullptr)
+                {
+                    m_ompResultDisplayWnd->SetItemText(nCurrentRow, 1, _("VerifyRequest Started"));
+                }
                 CResultVerify ouVerifyResult;
                 if(g_podTSExecutor->TSX_VerifyResponse(pEntity, ouVerifyResult) == S_FALSE)
                 {
@@ -1273,4 +1320,18 @@ bool CTSExecutorLIB::bExecuteTestCase(CBaseEntityTA* pTCEntity, CResultTc& ouTes
 void CTSExecutorLIB::vSetVersionInfo(CString& omStrVersionInfo)
 {
     m_ouResult.m_omStrVersion = omStrVersionInfo;
+}
+
+/******************************************************************************
+Function Name  :  vGetVerdict
+Input(s)       :  UINT& unExecuted, UINT& unFailed
+Output         :  -
+Functionality  :  Returns the test cases run by the last Execute and the
+                  ones among them that failed
+Member of      :  CTSExecutorLIB
+******************************************************************************/
+void CTSExecutorLIB::vGetVerdict(UINT& unExecuted, UINT& unFailed) const
+{
+    unExecuted = m_unExecutedTC;
+    unFailed = m_unFailedTC;
 }
\ No newline at end of file
@@ -51,6 +51,8 @@ class CTSExecutorLIB
     ETYPE_BUS m_eBusType;
     CResultGenerator m_ouResult;
     CListCtrl* m_ompResultDisplayWnd;
+    UINT m_unExecutedTC;        //Test cases run by the last Execute
+    UINT m_unFailedTC;
 public:
     bool m_bTestSuiteStatus;
     CTSExecutorLIB(void);
@@ -80,6 +82,7 @@ public:
     HRESULT Execute( /*PFCALLBACKRESULTTC pfResultTC*/);
     HRESULT SetResultDisplayWnd(CListCtrl* pWnd);
     void vSetVersionInfo(CString& omStrVersionInfo);
+    void vGetVerdict(UINT& unExecuted, UINT& unFailed) const;
     virtual ~CTSExecutorLIB(void);
 private:
     bool bExecuteTestSetup(CTestSetupEntity& pEntiy );
@@ -1,5 +1,4 @@
 
-#include "IBMNetWorkService.h"
 #include "CANDriverDefines.h"
 #include "..\Application\Hashdefines.h"
 #include <algorithm>
@@ -17,13 +16,17 @@ enum EColumnType
     eMsgDLCCol
 };
 
+//Sort key of the name of a message identifier on a channel, pvContext is the one given to SortBufferData
+typedef UINT (*PFGETNAMERANK)(const void* pvContext, UINT unChannel, UINT unMsgId);
+
 template <typename SBUFFERTYPE>
 class CCANMsgWndDataHandler
 {
 private:
     static EColumnType  m_nSortField;
     static int  m_nMFactor;
-    static IBMNetWorkGetService * m_pNetworkService;
+    static PFGETNAMERANK m_pfGetNameRank;
+    static const void * m_pvRankContext;
 
     static void SetColumnField ( int nField )
     {
@@ -62,9 +65,10 @@ public:
     {
         this->m_nSortField = EColumnType::eNoColType;
         m_nMFactor = -1;
-        m_pNetworkService = nullptr;
+        m_pfGetNameRank = nullptr;
+        m_pvRankContext = nullptr;
     }
-    static void SortBufferData ( int nField, bool bAscending, IBMNetWorkGetService * pNetworkService, SBUFFERTYPE * bufferData, int nCntOfDataEntries );
+    static void SortBufferData ( int nField, bool bAscending, PFGETNAMERANK pfGetNameRank, const void * pvRankContext, SBUFFERTYPE * bufferData, int nCntOfDataEntries );
     static int CompareBufferData ( const void* pEntry1, const void* pEntry2 );
 };
 
@@ -73,13 +77,16 @@ EColumnType  CCANMsgWndDataHandler<SBUFFERTYPE>::m_nSortField = EColumnType::eNo
 template<typename SBUFFERTYPE>
 int  CCANMsgWndDataHandler<SBUFFERTYPE>::m_nMFactor = -1;
 template<typename SBUFFERTYPE>
-IBMNetWorkGetService * CCANMsgWndDataHandler<SBUFFERTYPE>::m_pNetworkService = nullptr;
+PFGETNAMERANK CCANMsgWndDataHandler<SBUFFERTYPE>::m_pfGetNameRank = nullptr;
+template<typename SBUFFERTYPE>
+const void * CCANMsgWndDataHandler<SBUFFERTYPE>::m_pvRankContext = nullptr;
 
 
 template<typename SBUFFERTYPE>
-void CCANMsgWndDataHandler<SBUFFERTYPE>::SortBufferData ( int nField, bool bAscending, IBMNetWorkGetService * pNetworkService, SBUFFERTYPE * bufferData, int nCntOfDataEntries )
+void CCANMsgWndDataHandler<SBUFFERTYPE>::SortBufferData ( int nField, bool bAscending, PFGETNAMERANK pfGetNameRank, const void * pvRankContext, SBUFFERTYPE * bufferData, int nCntOfDataEntries )
 {
-    m_pNetworkService = pNetworkService;
+    m_pfGetNameRank = pfGetNameRank;
+    m_pvRankContext = pvRankContext;
     SetColumnField ( nField );
     m_nMFactor = bAscending ? 1 : -1;
     size_t tLenOfBuff = (size_t)nCntOfDataEntries;
@@ -105,26 +112,12 @@ int CCANMsgWndDataHandler<SBUFFERTYPE>::CompareBufferData ( const void* pEntry1,
         //}
         case EColumnType::eMsgNameCol: // Sort by message name
         {
-            CString msgName1, msgName2;
-            IFrame* pouFrame = nullptr;
-            ERRORCODE eResult = m_pNetworkService->GetFrame ( CAN, 0, pCANDataEntry1->m_uDataInfo.m_sCANMsg.m_unMsgID, nullptr, &pouFrame );
-            if ( EC_SUCCESS == eResult && nullptr != pouFrame )
-            {
-                std::string strName;
-                pouFrame->GetName ( strName );
-                msgName1 = strName.c_str();
-            }
-
-            pouFrame = nullptr;
-            eResult = m_pNetworkService->GetFrame ( CAN, 0, pCANDataEntry2->m_uDataInfo.m_sCANMsg.m_unMsgID, nullptr, &pouFrame );
-            if ( EC_SUCCESS == eResult && nullptr != pouFrame )
-            {
-                std::string strName;
-                pouFrame->GetName ( strName );
-                msgName2 = strName.c_str();
-            }
-
-            nRetValue = msgName1.CompareNoCase ( msgName2 );
+            // Ranks follow the case-insensitive order of the names
+            UINT unRank1 = m_pfGetNameRank ( m_pvRankContext, pCANDataEntry1->m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                             pCANDataEntry1->m_uDataInfo.m_sCANMsg.m_unMsgID );
+            UINT unRank2 = m_pfGetNameRank ( m_pvRankContext, pCANDataEntry2->m_uDataInfo.m_sCANMsg.m_ucChannel,
+                                             pCANDataEntry2->m_uDataInfo.m_sCANMsg.m_unMsgID );
+            nRetValue = (unRank1 < unRank2) ? -1 : ((unRank1 > unRank2) ? 1 : 0);
             break;
         }
         case EColumnType::eCANIDCol: // Sort by CAN id
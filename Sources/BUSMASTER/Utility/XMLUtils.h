@@ -1,14 +1,17 @@
 #pragma once
 
 /* C++ includes */
+#include <algorithm>
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 /* libxml includes */
 #include <libxml/xmlmemory.h>
 #include <libxml/parser.h>
 #include <libxml/xpath.h>
+#include <libxml/xpathInternals.h>
 #include "../include/BaseDefs.h"
 #include "DeviceListInfo.h"
 #include "../DataTypes/MsgSignal_Datatypes.h"
@@ -50,13 +53,173 @@ enum eLineType
     Stick = 9
 };
 
+/* Element paths of a document, collected in one walk over the tree.
+   The index hangs at xmlDoc::_private, so pGetNodes of every module finds it.
+   It only holds plain arrays, modules built against another heap just read it. */
+#define defXML_DOC_INDEX_SIGNATURE  0x58444958
+
+struct sXML_PATH_ENTRY
+{
+    char* m_pchPath;            // "ROOT/Child/Child", no leading slash
+    xmlNodePtr* m_ppNodes;      // Document order
+    int m_nNodes;
+};
+
+struct sXML_DOC_INDEX
+{
+    DWORD m_dwSignature;
+    int m_nEntries;
+    sXML_PATH_ENTRY* m_psEntries;   // Sorted by path
+    bool m_bRootNameNested;         // An element below the root has the root name
+};
+
 class xmlUtils
 {
 public:
+    /* Indexes every element path of pDoc. Call once after reading the
+       document, and vFreeDocIndex before the document is modified or freed. */
+    static bool bCreateDocIndex(xmlDocPtr pDoc)
+    {
+        xmlNodePtr pRoot = xmlDocGetRootElement(pDoc);
+        if ( (nullptr == pRoot) || (nullptr != pDoc->_private) )
+        {
+            return false;
+        }
+
+        std::map< std::string, std::vector<xmlNodePtr> > ouPaths;
+        bool bRootNameNested = false;
+        std::vector< std::pair<xmlNodePtr, std::string> > ouStack;
+        ouStack.push_back(std::make_pair(pRoot, std::string((char*)pRoot->name)));
+        while (false == ouStack.empty())
+        {
+            xmlNodePtr pNode = ouStack.back().first;
+            std::string strPath = ouStack.back().second;
+            ouStack.pop_back();
+            ouPaths[strPath].push_back(pNode);
+
+            //Children go on the stack last to first, so they come off in document order
+            size_t unFirstChild = ouStack.size();
+            for (xmlNodePtr pChild = pNode->children; pChild != nullptr; pChild = pChild->next)
+            {
+                if ( (XML_ELEMENT_NODE == pChild->type) && (nullptr == pChild->ns) )
+                {
+                    ouStack.push_back(std::make_pair(pChild, strPath + "/" + (char*)pChild->name));
+                    bRootNameNested = bRootNameNested || (xmlStrEqual(pChild->name, pRoot->name) != 0);
+                }
+            }
+            std::reverse(ouStack.begin() + unFirstChild, ouStack.end());
+        }
+
+        sXML_DOC_INDEX* psIndex = new sXML_DOC_INDEX;
+        psIndex->m_dwSignature = defXML_DOC_INDEX_SIGNATURE;
+        psIndex->m_nEntries = (int)ouPaths.size();
+        psIndex->m_psEntries = new sXML_PATH_ENTRY[ouPaths.size()];
+        psIndex->m_bRootNameNested = bRootNameNested;
+        int nEntry = 0;
+        for (auto itr = ouPaths.begin(); itr != ouPaths.end(); ++itr, nEntry++)
+        {
+            sXML_PATH_ENTRY& sEntry = psIndex->m_psEntries[nEntry];
+            sEntry.m_pchPath = new char[itr->first.size() + 1];
+            strcpy_s(sEntry.m_pchPath, itr->first.size() + 1, itr->first.c_str());
+            sEntry.m_nNodes = (int)itr->second.size();
+            sEntry.m_ppNodes = new xmlNodePtr[itr->second.size()];
+            std::copy(itr->second.begin(), itr->second.end(), sEntry.m_ppNodes);
+        }
+        pDoc->_private = psIndex;
+        return true;
+    }
+
+    static void vFreeDocIndex(xmlDocPtr pDoc)
+    {
+        sXML_DOC_INDEX* psIndex = psGetDocIndex(pDoc);
+        if (nullptr == psIndex)
+        {
+            return;
+        }
+        for (int i = 0; i < psIndex->m_nEntries; i++)
+        {
+            delete[] psIndex->m_psEntries[i].m_pchPath;
+            delete[] psIndex->m_psEntries[i].m_ppNodes;
+        }
+        delete[] psIndex->m_psEntries;
+        delete psIndex;
+        pDoc->_private = nullptr;
+    }
+
+    /* Answers "/ROOT/a/b" from the index of pDoc, and "//ROOT/a/b" if no element
+       below the root has the root name, so the path can only start at the root.
+       Returns false if pDoc has no index or the path needs the XPath engine. */
+    static bool bGetIndexedNodes(xmlDocPtr pDoc, const char* pchXpath, xmlXPathObjectPtr& pXpathNodePtr)
+    {
+        sXML_DOC_INDEX* psIndex = psGetDocIndex(pDoc);
+        if ( (nullptr == psIndex) || (pchXpath[0] != '/') )
+        {
+            return false;
+        }
+        bool bAnyDepth = (pchXpath[1] == '/');
+        if ( (true == bAnyDepth) && (true == psIndex->m_bRootNameNested) )
+        {
+            //"//ROOT" also matches the nested elements of that name
+            return false;
+        }
+        const char* pchPath = pchXpath + ((true == bAnyDepth) ? 2 : 1);
+        const char* pchRootEnd = strchr(pchPath, '/');
+        size_t unRootLength = (nullptr == pchRootEnd) ? strlen(pchPath) : (pchRootEnd - pchPath);
+        xmlNodePtr pRoot = xmlDocGetRootElement(pDoc);
+        if ( (nullptr == pRoot) || (xmlStrlen(pRoot->name) != (int)unRootLength) ||
+                (strncmp((const char*)pRoot->name, pchPath, unRootLength) != 0) )
+        {
+            //"//Name" may match elements below the root
+            return false;
+        }
+        for (const char* pchChar = pchPath; *pchChar != '\0'; pchChar++)
+        {
+            if ( (false == isalnum((unsigned char)*pchChar)) && (*pchChar != '_') && (*pchChar != '-') && (*pchChar != '.') &&
+                    ( (*pchChar != '/') || (pchChar[1] == '/') || (pchChar[1] == '\0') ) )
+            {
+                //Predicates, axes, functions and wildcards
+                return false;
+            }
+        }
+
+        pXpathNodePtr = nullptr;
+        int nLow = 0;
+        int nHigh = psIndex->m_nEntries - 1;
+        while (nLow <= nHigh)
+        {
+            int nMid = (nLow + nHigh) / 2;
+            int nCompare = strcmp(psIndex->m_psEntries[nMid].m_pchPath, pchPath);
+            if (nCompare == 0)
+            {
+                sXML_PATH_ENTRY& sEntry = psIndex->m_psEntries[nMid];
+                xmlNodeSetPtr pNodeSet = xmlXPathNodeSetCreate(sEntry.m_ppNodes[0]);
+                for (int i = 1; (nullptr != pNodeSet) && (i < sEntry.m_nNodes); i++)
+                {
+                    xmlXPathNodeSetAddUnique(pNodeSet, sEntry.m_ppNodes[i]);
+                }
+                pXpathNodePtr = xmlXPathWrapNodeSet(pNodeSet);
+                break;
+            }
+            else if (nCompare < 0)
+            {
+                nLow = nMid + 1;
+            }
+            else
+            {
+                nHigh = nMid - 1;
+            }
+        }
+        return true;
+    }
+
     static xmlXPathObjectPtr pGetNodes (xmlDocPtr pDoc, xmlChar* pchXpath)
     {
         xmlXPathContextPtr pDocContext;
         xmlXPathObjectPtr pXpathNodePtr;
+        if ( bGetIndexedNodes(pDoc, (const char*)pchXpath, pXpathNodePtr) )
+        {
+            return pXpathNodePtr;
+        }
         //Get Context
         pDocContext = xmlXPathNewContext(pDoc);
         if ( nullptr == pDocContext )
@@ -775,4 +938,15 @@ public:
         delete[] npOrder;
         return nRetVal;
     }
+
+private:
+    static sXML_DOC_INDEX* psGetDocIndex(xmlDocPtr pDoc)
+    {
+        if ( (nullptr == pDoc) || (nullptr == pDoc->_private) ||
+                (((sXML_DOC_INDEX*)pDoc->_private)->m_dwSignature != defXML_DOC_INDEX_SIGNATURE) )
+        {
+            return nullptr;
+        }
+        return (sXML_DOC_INDEX*)pDoc->_private;
+    }
 };
@@ -5,6 +5,7 @@
 #include <sstream>      // std::ostringstream
 #include <sys/stat.h>
 #include <map>
+#include <vector>
 //#include <unistd.h>
 //#include <time.h>
 //#include "NodeSimCodeGenerator.h"
@@ -157,16 +158,196 @@ ERRORCODE BMNetwork::LoadDb( ETYPE_BUS forCluster, int channelIndex, std::string
     //Delete current cluster If Exists
     DeleteDBService( forCluster , channelIndex, dbFilePath);
 
-    std::list<ICluster*> clusterList;
-    ParseDbFile( dbFilePath, forCluster, clusterList );
+    ICluster* pouCluster = nullptr;
+    auto itrPreloaded = mPreloadedClusters[forCluster].find(dbFilePath);
+    if ( mPreloadedClusters[forCluster].end() != itrPreloaded )
+    {
+        pouCluster = itrPreloaded->second;
+        mPreloadedClusters[forCluster].erase(itrPreloaded);
+    }
+    else
+    {
+        bool bFromCache = false;
+        LoadCluster( forCluster, dbFilePath, &pouCluster, bFromCache );
+    }
 
     //Load First Cluster Only
-    if ( clusterList.size() > 0 )
+    if ( nullptr != pouCluster )
     {
-        return AddDBService( forCluster, channelIndex, *( clusterList.begin() ) );
+        return AddDBService( forCluster, channelIndex, pouCluster );
     }
     return EC_FAILURE;
 }
+
+ERRORCODE BMNetwork::LoadCluster( ETYPE_BUS eouProtocol, const std::string& strDbPath, ICluster** ppouCluster, bool& bFromCache )
+{
+    *ppouCluster = nullptr;
+    bFromCache = false;
+
+    DbSourceIdentity ouIdentity;
+    bool bCacheable = CompiledDbCache::isBusSupported(eouProtocol)
+                      && EC_SUCCESS == mCompiledDbCache.GetSourceIdentity(strDbPath, ouIdentity);
+    if ( true == bCacheable && EC_SUCCESS == mCompiledDbCache.LoadCluster(strDbPath, eouProtocol, ouIdentity, ppouCluster) )
+    {
+        EnterCriticalSection(&mCompiledClustersLock);
+        mCompiledClusters.insert(*ppouCluster);
+        LeaveCriticalSection(&mCompiledClustersLock);
+        bFromCache = true;
+        return EC_SUCCESS;
+    }
+
+    std::list<ICluster*> clusterList;
+    ERRORCODE ecCode = ParseDbFile( strDbPath, eouProtocol, clusterList );
+    if ( clusterList.empty() )
+    {
+        return EC_FAILURE;
+    }
+    *ppouCluster = *( clusterList.begin() );
+
+    //Images hold a single cluster, multi cluster databases are always parsed
+    if ( true == bCacheable && EC_SUCCESS == ecCode && 1 == clusterList.size() )
+    {
+        mCompiledDbCache.StoreCluster(strDbPath, eouProtocol, ouIdentity, *ppouCluster);
+    }
+    return EC_SUCCESS;
+}
+
+namespace
+{
+class DbPreloadJob
+{
+public:
+    BMNetwork* m_pouNetwork;
+    ETYPE_BUS m_eBusType;
+    std::vector<std::string> m_ouPaths;
+    std::vector<ICluster*> m_ouClusters;
+    std::vector<BYTE> m_ouFromCache;        //Not vector<bool>, which packs neighbouring slots into one word
+    std::vector<double> m_ouTimesMs;
+    LARGE_INTEGER m_sFrequency;
+    volatile LONG m_lNextIndex;
+};
+
+DWORD WINAPI DbPreloadThreadProc(LPVOID pParam)
+{
+    DbPreloadJob* pouJob = (DbPreloadJob*)pParam;
+    LONG lIndex;
+    while ( ( lIndex = InterlockedIncrement(&pouJob->m_lNextIndex) - 1 ) < (LONG)pouJob->m_ouPaths.size() )
+    {
+        LARGE_INTEGER sStart, sEnd;
+        QueryPerformanceCounter(&sStart);
+        bool bFromCache = false;
+        ICluster* pouCluster = nullptr;
+        pouJob->m_pouNetwork->LoadCluster(pouJob->m_eBusType, pouJob->m_ouPaths[lIndex], &pouCluster, bFromCache);
+        QueryPerformanceCounter(&sEnd);
+
+        //Each worker writes only its own slot
+        pouJob->m_ouClusters[lIndex] = pouCluster;
+        pouJob->m_ouFromCache[lIndex] = ( true == bFromCache ) ? 1 : 0;
+        pouJob->m_ouTimesMs[lIndex] = ( sEnd.QuadPart - sStart.QuadPart ) * 1000.0 / pouJob->m_sFrequency.QuadPart;
+    }
+    return 0;
+}
+}
+
+ERRORCODE BMNetwork::PreloadDbFiles( ETYPE_BUS eouProtocol, std::list<std::string>& ouDbFilePaths, DbLoadReport& ouReport )
+{
+    ouReport = DbLoadReport();
+    vClearPreloadedClusters(eouProtocol);
+
+    DbPreloadJob ouJob;
+    ouJob.m_pouNetwork = this;
+    ouJob.m_eBusType = eouProtocol;
+    ouJob.m_lNextIndex = 0;
+    for ( auto itr = ouDbFilePaths.begin(); itr != ouDbFilePaths.end(); ++itr )
+    {
+        if ( ouJob.m_ouPaths.end() == std::find(ouJob.m_ouPaths.begin(), ouJob.m_ouPaths.end(), *itr) )
+        {
+            ouJob.m_ouPaths.push_back(*itr);
+        }
+    }
+    if ( ouJob.m_ouPaths.empty() )
+    {
+        return EC_SUCCESS;
+    }
+    ouJob.m_ouClusters.assign(ouJob.m_ouPaths.size(), nullptr);
+    ouJob.m_ouFromCache.assign(ouJob.m_ouPaths.size(), 0);
+    ouJob.m_ouTimesMs.assign(ouJob.m_ouPaths.size(), 0.0);
+    QueryPerformanceFrequency(&ouJob.m_sFrequency);
+
+    LARGE_INTEGER sStart, sEnd;
+    QueryPerformanceCounter(&sStart);
+
+    SYSTEM_INFO sSysInfo;
+    GetSystemInfo(&sSysInfo);
+    size_t unThreads = min(ouJob.m_ouPaths.size(), (size_t)max(sSysInfo.dwNumberOfProcessors, (DWORD)1));
+    std::vector<HANDLE> ouThreads;
+    for ( size_t i = 1; i < unThreads; i++ )
+    {
+        HANDLE hThread = CreateThread(nullptr, 0, DbPreloadThreadProc, &ouJob, 0, nullptr);
+        if ( nullptr != hThread )
+        {
+            ouThreads.push_back(hThread);
+        }
+    }
+    //Calling thread takes part as well, so the job completes even if no thread could be created
+    DbPreloadThreadProc(&ouJob);
+    if ( false == ouThreads.empty() )
+    {
+        WaitForMultipleObjects(ouThreads.size(), &ouThreads[0], TRUE, INFINITE);
+        for ( auto itr = ouThreads.begin(); itr != ouThreads.end(); ++itr )
+        {
+            CloseHandle(*itr);
+        }
+    }
+    QueryPerformanceCounter(&sEnd);
+    ouReport.m_dTotalTimeMs = ( sEnd.QuadPart - sStart.QuadPart ) * 1000.0 / ouJob.m_sFrequency.QuadPart;
+
+    for ( size_t i = 0; i < ouJob.m_ouPaths.size(); i++ )
+    {
+        ouReport.m_ouFileTimesMs.push_back(std::make_pair(ouJob.m_ouPaths[i], ouJob.m_ouTimesMs[i]));
+        if ( nullptr == ouJob.m_ouClusters[i] )
+        {
+            ouReport.m_unFailed++;
+            continue;
+        }
+        if ( 1 == ouJob.m_ouFromCache[i] )
+        {
+            ouReport.m_unFromCache++;
+        }
+        else
+        {
+            ouReport.m_unParsed++;
+        }
+        mPreloadedClusters[eouProtocol][ouJob.m_ouPaths[i]] = ouJob.m_ouClusters[i];
+    }
+    return ( 0 == ouReport.m_unFailed ) ? EC_SUCCESS : EC_FAILURE;
+}
+
+void BMNetwork::vFreeCluster( ICluster* pouCluster )
+{
+    EnterCriticalSection(&mCompiledClustersLock);
+    bool bCompiled = ( 1 == mCompiledClusters.erase(pouCluster) );
+    LeaveCriticalSection(&mCompiledClustersLock);
+
+    if ( true == bCompiled )
+    {
+        delete pouCluster;
+    }
+    else if ( nullptr != mDbManagerAcessor.mFreeCluster )
+    {
+        mDbManagerAcessor.mFreeCluster(pouCluster);
+    }
+}
+
+void BMNetwork::vClearPreloadedClusters( ETYPE_BUS eouProtocol )
+{
+    for ( auto itr = mPreloadedClusters[eouProtocol].begin(); itr != mPreloadedClusters[eouProtocol].end(); ++itr )
+    {
+        vFreeCluster(itr->second);
+    }
+    mPreloadedClusters[eouProtocol].clear();
+}
+
 ERRORCODE BMNetwork::DeleteDBService(ETYPE_BUS eouProtocol, int nChannelIndex, std::string dbPath)
 {
 	std::list<ICluster*> clusterList;
@@ -180,7 +361,7 @@ ERRORCODE BMNetwork::DeleteDBService(ETYPE_BUS eouProtocol, int nChannelIndex, s
 		{
 			if (EC_SUCCESS == m_ouProtocolConfig[eouProtocol].ReleaseDbService(nChannelIndex, index))
 			{
-				mDbManagerAcessor.mFreeCluster(cluster);
+				vFreeCluster(cluster);
 				IDbChangeListner::DBChangeInfo changeInfo;
 				changeInfo.mBusType = eouProtocol;
 				changeInfo.mChannel = nChannelIndex;
@@ -244,6 +425,7 @@ for (auto itr : pathList)
             DeleteDBService(eouProtocol, i, itr);
         }
     }
+    vClearPreloadedClusters(eouProtocol);
     return m_ouProtocolConfig[eouProtocol].ResetConfiguration();
 }
 
@@ -252,7 +434,18 @@ for (auto itr : pathList)
 
 BMNetwork::BMNetwork()
 {
+    InitializeCriticalSection(&mDbManagerLock);
+    InitializeCriticalSection(&mCompiledClustersLock);
+}
 
+BMNetwork::~BMNetwork()
+{
+    for ( int i = 0; i < ETYPE_BUS::BUS_INVALID; i++ )
+    {
+        vClearPreloadedClusters((ETYPE_BUS)i);
+    }
+    DeleteCriticalSection(&mCompiledClustersLock);
+    DeleteCriticalSection(&mDbManagerLock);
 }
 
 
@@ -268,7 +461,14 @@ ERRORCODE BMNetwork::ParseDbFile( std::string strFileName, ETYPE_BUS clusterType
 
     ouClusterList.clear();
 
+    if ( nullptr == mDbManagerAcessor.mParseDbFile )
+    {
+        return EC_FAILURE;
+    }
+    //Cache misses are parsed one at a time, preloading runs only hashing, cache hits and image writes in parallel
+    EnterCriticalSection(&mDbManagerLock);
     ERRORCODE ecCode = mDbManagerAcessor.mParseDbFile( strFileName, clusterType, ouClusterResult);
+    LeaveCriticalSection(&mDbManagerLock);
 
     if ( EC_FAILURE != ecCode )
     {
@@ -4,6 +4,9 @@
 #include "Include/IBMNetWorkService.h"
 #include <algorithm>
 #include "AccessDBManager.h"
+#include "CompiledDbCache.h"
+#include <map>
+#include <set>
 #include "../BusmasterDriverInterface/Include/DeviceListInfo.h"
 
 
@@ -81,9 +84,15 @@ private:
     //std::string GetUniqueFrameName(IFrame* pouFrame);
     AccessDBManager mDbManagerAcessor;
 	DBChangeManger mDBChangeManger;
+    CompiledDbCache mCompiledDbCache;
+    std::set<ICluster*> mCompiledClusters;                  //Owned by BMNetwork, not by DBManager
+    std::map<std::string, ICluster*> mPreloadedClusters[ETYPE_BUS::BUS_INVALID];
+    CRITICAL_SECTION mDbManagerLock;                        //Database parser is not known to be reentrant
+    CRITICAL_SECTION mCompiledClustersLock;
 public:
 
     BMNetwork();
+    ~BMNetwork();
     ERRORCODE GetChannelSettings(ETYPE_BUS eouProtocol, int nChannelIndex, ChannelSettings* );
     ERRORCODE SetChannelSettings(ETYPE_BUS eouProtocol, int nChannelIndex, ChannelSettings* );
     ERRORCODE GetChannelCount(ETYPE_BUS eouProtocol, int& nChannelsConfigured);
@@ -114,9 +123,15 @@ public:
 
     ERRORCODE ParseDbFile( std::string strFileName, ETYPE_BUS forCluster, std::list<ICluster*>& );
     ERRORCODE LoadDb( ETYPE_BUS eouProtocol, int nChannelIndex, std::string );
+    ERRORCODE PreloadDbFiles( ETYPE_BUS eouProtocol, std::list<std::string>& ouDbFilePaths, DbLoadReport& ouReport );
 
     ERRORCODE ReSetNetwork(ETYPE_BUS eouProtocol);
 
+    /* Cache aware load of the first cluster of a database, safe to call from worker threads */
+    ERRORCODE LoadCluster( ETYPE_BUS eouProtocol, const std::string& strDbPath, ICluster** ppouCluster, bool& bFromCache );
+
 private:
     ERRORCODE ParseDBFile(std::string strFileName, std::list<ClusterResult>& ouClusterResultList);
+    void vFreeCluster( ICluster* pouCluster );
+    void vClearPreloadedClusters( ETYPE_BUS eouProtocol );
 };
@@ -0,0 +1,1280 @@
+#include "CompiledCluster.h"
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+
+namespace
+{
+template <typename T>
+const T* psGetSection(const BYTE* pbyImage, unsigned int unImageSize, CompiledDb::eImageSection eSection, unsigned int& unCount)
+{
+    const CompiledDb::ImageHeader* psHeader = (const CompiledDb::ImageHeader*)pbyImage;
+    const CompiledDb::SectionInfo& sSection = psHeader->m_asSections[eSection];
+    unsigned __int64 un64End = (unsigned __int64)sSection.m_unOffset + (unsigned __int64)sSection.m_unCount * sizeof(T);
+
+    unCount = 0;
+    if ( un64End > unImageSize )
+    {
+        return nullptr;
+    }
+    unCount = sSection.m_unCount;
+    return (const T*)(pbyImage + sSection.m_unOffset);
+}
+
+/* Reads nLength bits starting at nStartBit (LSB of the signal). Intel signals
+   continue in the following bytes, Motorola signals in the preceding ones.
+   Bits outside the data length are read as 0. */
+unsigned __int64 un64ExtractBits(const unsigned char* pchData, int nDataLength, int nStartBit, int nLength, bool bIntel)
+{
+    unsigned __int64 un64Value = 0;
+    if ( nullptr == pchData || nLength <= 0 || nStartBit < 0 )
+    {
+        return 0;
+    }
+    int nByte = nStartBit / defBITS_IN_BYTE;
+    int nBitInByte = nStartBit % defBITS_IN_BYTE;
+    int nStep = bIntel ? 1 : -1;
+    int nBitsRead = 0;
+
+    while ( nBitsRead < nLength && nByte >= 0 && nByte < nDataLength )
+    {
+        int nBits = min(defBITS_IN_BYTE - nBitInByte, nLength - nBitsRead);
+        unsigned __int64 un64Byte = (pchData[nByte] >> nBitInByte) & ((1 << nBits) - 1);
+        un64Value |= un64Byte << nBitsRead;
+        nBitsRead += nBits;
+        nBitInByte = 0;
+        nByte += nStep;
+    }
+    return un64Value;
+}
+
+unsigned __int64 un64GetMask(unsigned int unLength)
+{
+    return (unLength >= 64) ? 0xFFFFFFFFFFFFFFFFULL : ((1ULL << unLength) - 1);
+}
+
+bool bIsInRange(const ValueRange& sRange, double dRawValue)
+{
+    return ( dRawValue >= (double)(__int64)sRange.m_dwLowerLimit ) && ( dRawValue <= (double)(__int64)sRange.m_dwUpperLimit );
+}
+
+double dApplyLinear(const CompuLinearCode& sCode, double dRawValue)
+{
+    double dValue = sCode.m_dN0 + ( sCode.m_dN1 * dRawValue );
+    if ( sCode.m_dD0 != 0 )
+    {
+        dValue /= sCode.m_dD0;
+    }
+    return dValue;
+}
+}
+
+/* CompiledCoding */
+
+CompiledCoding::CompiledCoding(ICluster* pCluster) : ICoding(pCluster)
+{
+    m_oueElementType = eCodingElement;
+    m_ouCompuMethod.m_eCompuType = IDENTICAL_ENUM;
+    m_ouCompuMethod.m_ouLinearCode.m_dN0 = 0;
+    m_ouCompuMethod.m_ouLinearCode.m_dN1 = 1;
+    m_ouCompuMethod.m_ouLinearCode.m_dD0 = 1;
+}
+
+ERRORCODE CompiledCoding::RegisterForChangeNotification(INotifyClusterChange*)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCoding::GetProperties(CompuMethodProps& ouProps)
+{
+    if ( eCANProtocol != ouProps.m_eType )
+    {
+        return EC_FAILURE;
+    }
+    ((CANCompuMethods&)ouProps).m_CompuMethod = m_ouCompuMethod;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCoding::SetProperties(CompuMethodProps&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCoding::GetValueDescriptions(std::map<int, std::string>& ouValueDescs)
+{
+    ouValueDescs = m_ouValueDescs;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCoding::SetValueDescriptions(std::map<int, std::string>&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCoding::GetValueDescription(int nValue, std::string& strDesc)
+{
+    auto itr = m_ouValueDescs.find(nValue);
+    if ( m_ouValueDescs.end() == itr )
+    {
+        return EC_FAIL_ELEMENT_NOT_FOUND;
+    }
+    strDesc = itr->second;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCoding::SetValueDescription(int, std::string&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCoding::GetSignalList(std::map<UID_ELEMENT, ISignal*>& lstSignals)
+{
+    lstSignals = m_ouSignals;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCoding::MapSignal(UID_ELEMENT)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCoding::UnMapSignal(UID_ELEMENT)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCoding::GetEngValue(eSignalDataType eDataType, int nSiglength, unsigned __int64 unRawValue, double& dEngValue)
+{
+    unsigned __int64 un64Mask = un64GetMask(nSiglength);
+    double dRawValue = (double)(unRawValue & un64Mask);
+    if ( eSigned == eDataType && nSiglength > 0 && nSiglength < 64 && ( unRawValue & ( 1ULL << ( nSiglength - 1 ) ) ) )
+    {
+        dRawValue = (double)(__int64)( unRawValue | ~un64Mask );
+    }
+    else if ( eSigned == eDataType )
+    {
+        dRawValue = (double)(__int64)unRawValue;
+    }
+    dEngValue = dGetEngValue(dRawValue);
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCoding::GetRawValue(double dEngValue, unsigned __int64& unRawValue)
+{
+    double dRawValue = dEngValue;
+    switch ( m_ouCompuMethod.m_eCompuType )
+    {
+        case LINEAR_ENUM:
+        case SCALE_LINEAR_TEXTTABLE_ENUM:
+        {
+            const CompuLinearCode& sCode = m_ouCompuMethod.m_ouLinearCode;
+            if ( sCode.m_dN1 != 0 )
+            {
+                double dD0 = ( sCode.m_dD0 != 0 ) ? sCode.m_dD0 : 1;
+                dRawValue = ( dEngValue * dD0 - sCode.m_dN0 ) / sCode.m_dN1;
+            }
+        }
+        break;
+        case SCALE_LINEAR_ENUM:
+            for ( auto itr = m_ouCompuMethod.m_ouCompuScaleLinear.begin(); itr != m_ouCompuMethod.m_ouCompuScaleLinear.end(); ++itr )
+            {
+                if ( itr->m_dN1 != 0 )
+                {
+                    double dD0 = ( itr->m_dD0 != 0 ) ? itr->m_dD0 : 1;
+                    double dCandidate = ( dEngValue * dD0 - itr->m_dN0 ) / itr->m_dN1;
+                    if ( bIsInRange(itr->m_sRange, floor(dCandidate + 0.5)) )
+                    {
+                        dRawValue = dCandidate;
+                        break;
+                    }
+                }
+            }
+            break;
+        case TAB_NOINTP_ENUM:
+            for ( auto itr = m_ouCompuMethod.m_ouTabCode.begin(); itr != m_ouCompuMethod.m_ouTabCode.end(); ++itr )
+            {
+                if ( itr->m_dPhysVal == dEngValue )
+                {
+                    dRawValue = (double)(__int64)itr->m_sRange.m_dwLowerLimit;
+                    break;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    unRawValue = (unsigned __int64)(__int64)floor(dRawValue + 0.5);
+    return EC_SUCCESS;
+}
+
+double CompiledCoding::dGetEngValue(double dRawValue) const
+{
+    switch ( m_ouCompuMethod.m_eCompuType )
+    {
+        case LINEAR_ENUM:
+        case SCALE_LINEAR_TEXTTABLE_ENUM:
+            return dApplyLinear(m_ouCompuMethod.m_ouLinearCode, dRawValue);
+        case SCALE_LINEAR_ENUM:
+            for ( auto itr = m_ouCompuMethod.m_ouCompuScaleLinear.begin(); itr != m_ouCompuMethod.m_ouCompuScaleLinear.end(); ++itr )
+            {
+                if ( bIsInRange(itr->m_sRange, dRawValue) )
+                {
+                    return dApplyLinear(*itr, dRawValue);
+                }
+            }
+            break;
+        case TAB_NOINTP_ENUM:
+            for ( auto itr = m_ouCompuMethod.m_ouTabCode.begin(); itr != m_ouCompuMethod.m_ouTabCode.end(); ++itr )
+            {
+                if ( bIsInRange(itr->m_sRange, dRawValue) )
+                {
+                    return itr->m_dPhysVal;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    return dRawValue;
+}
+
+const std::string* CompiledCoding::pGetValueDescription(__int64 n64RawValue) const
+{
+    if ( false == m_ouValueDescs.empty() && n64RawValue >= INT_MIN && n64RawValue <= INT_MAX )
+    {
+        auto itr = m_ouValueDescs.find((int)n64RawValue);
+        if ( m_ouValueDescs.end() != itr )
+        {
+            return &itr->second;
+        }
+    }
+    if ( TEXTTABLE_ENUM == m_ouCompuMethod.m_eCompuType || SCALE_LINEAR_TEXTTABLE_ENUM == m_ouCompuMethod.m_eCompuType )
+    {
+        for ( auto itr = m_ouCompuMethod.m_ouTextCode.begin(); itr != m_ouCompuMethod.m_ouTextCode.end(); ++itr )
+        {
+            if ( bIsInRange(itr->m_sRange, (double)n64RawValue) )
+            {
+                return &itr->m_aTextName;
+            }
+        }
+    }
+    return nullptr;
+}
+
+/* CompiledSignal */
+
+CompiledSignal::CompiledSignal(ICluster* pCluster) : ISignal(pCluster)
+{
+    m_oueElementType = eSignalElement;
+    m_un64MinValue = 0;
+    m_un64MaxValue = 0;
+    m_pouCoding = nullptr;
+}
+
+ERRORCODE CompiledSignal::RegisterForChangeNotification(INotifyClusterChange*)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledSignal::GetEcus(eDIR eDirection, std::list<IEcu*>& ouNodes)
+{
+    ouNodes.clear();
+    if ( eTx == eDirection || eAllDir == eDirection )
+    {
+        ouNodes.insert(ouNodes.end(), m_ouTxEcus.begin(), m_ouTxEcus.end());
+    }
+    if ( eRx == eDirection || eAllDir == eDirection )
+    {
+        ouNodes.insert(ouNodes.end(), m_ouRxEcus.begin(), m_ouRxEcus.end());
+    }
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::GetLength(unsigned int& unSignalLength)
+{
+    unSignalLength = m_ouProps.m_unSignalSize;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::GetMinMaxValue(unsigned __int64& unMinValue, unsigned __int64& unMaxValue)
+{
+    unMinValue = m_un64MinValue;
+    unMaxValue = m_un64MaxValue;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::MapNode(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledSignal::UnMapNode(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledSignal::GetEncoding(ICoding** ppouCoding)
+{
+    if ( nullptr == ppouCoding )
+    {
+        return EC_FAILURE;
+    }
+    *ppouCoding = m_pouCoding;
+    return ( nullptr != m_pouCoding ) ? EC_SUCCESS : EC_FAIL_ELEMENT_NOT_FOUND;
+}
+
+ERRORCODE CompiledSignal::SetEncoding(UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledSignal::GetProperties(SignalProps& ouProps)
+{
+    eProtocolType eType = ouProps.eType;
+    ouProps = m_ouProps;
+    ouProps.eType = ( eInvalidProtocol != eType ) ? eType : m_ouProps.eType;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::SetProperties(SignalProps&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledSignal::GetDataType(eSignalDataType& eDataType)
+{
+    eDataType = m_ouProps.m_ouDataType;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::GetUnit(std::string& strUnit)
+{
+    strUnit = m_ouProps.m_omUnit;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::GetRawValue(int nStartBit, int nSignalLength, int nByteLength, bool bIntel, const unsigned char* pchData, unsigned __int64& unRawValue)
+{
+    unRawValue = un64ExtractBits(pchData, nByteLength, nStartBit, nSignalLength, bIntel);
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::GetEnggValueFromRaw(unsigned __int64 dwRawValue, double& dEnggValue)
+{
+    dEnggValue = dGetEngValue(dwRawValue);
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledSignal::GetRawValueFromEng(double dEnggValue, unsigned __int64& dwRawValue)
+{
+    if ( nullptr != m_pouCoding )
+    {
+        m_pouCoding->GetRawValue(dEnggValue, dwRawValue);
+    }
+    else
+    {
+        dwRawValue = (unsigned __int64)(__int64)floor(dEnggValue + 0.5);
+    }
+    dwRawValue &= un64GetMask(m_ouProps.m_unSignalSize);
+    return EC_SUCCESS;
+}
+
+bool CompiledSignal::bIsSigned() const
+{
+    return ( eSigned == m_ouProps.m_ouDataType );
+}
+
+__int64 CompiledSignal::n64ExtendSign(unsigned __int64 un64RawValue) const
+{
+    unsigned int unLength = m_ouProps.m_unSignalSize;
+    unsigned __int64 un64Mask = un64GetMask(unLength);
+    un64RawValue &= un64Mask;
+    if ( bIsSigned() && unLength > 0 && unLength < 64 && ( un64RawValue & ( 1ULL << ( unLength - 1 ) ) ) )
+    {
+        un64RawValue |= ~un64Mask;
+    }
+    return (__int64)un64RawValue;
+}
+
+double CompiledSignal::dGetEngValue(unsigned __int64 un64RawValue) const
+{
+    if ( Float == m_ouProps.m_ouDataType && 32 == m_ouProps.m_unSignalSize )
+    {
+        unsigned int unBits = (unsigned int)un64RawValue;
+        float fValue;
+        memcpy(&fValue, &unBits, sizeof(fValue));
+        return fValue;
+    }
+    if ( Double == m_ouProps.m_ouDataType && 64 == m_ouProps.m_unSignalSize )
+    {
+        double dValue;
+        memcpy(&dValue, &un64RawValue, sizeof(dValue));
+        return dValue;
+    }
+
+    double dRawValue = bIsSigned() ? (double)n64ExtendSign(un64RawValue) : (double)(un64RawValue & un64GetMask(m_ouProps.m_unSignalSize));
+    return ( nullptr != m_pouCoding ) ? m_pouCoding->dGetEngValue(dRawValue) : dRawValue;
+}
+
+/* CompiledFrame */
+
+CompiledFrame::CompiledFrame(ICluster* pCluster) : IFrame(pCluster)
+{
+    m_oueElementType = eFrameElement;
+    m_ouProps.m_nMsgId = 0;
+    m_ouProps.m_unMsgSize = 0;
+    m_ouProps.m_canMsgType = eCan_Standard;
+}
+
+ERRORCODE CompiledFrame::RegisterForChangeNotification(INotifyClusterChange*)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::GetFrameType(eProtocolType& eType)
+{
+    eType = m_ouProps.m_eProtocol;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledFrame::GetFrameId(unsigned int& unFrameId)
+{
+    unFrameId = m_ouProps.m_nMsgId;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledFrame::GetLength(unsigned int& unFrameLength)
+{
+    unFrameLength = m_ouProps.m_unMsgSize;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledFrame::GetEcus(eDIR eDirection, std::list<IEcu*>& ouEcus)
+{
+    ouEcus.clear();
+    if ( eTx == eDirection || eAllDir == eDirection )
+    {
+        ouEcus.insert(ouEcus.end(), m_ouTxEcus.begin(), m_ouTxEcus.end());
+    }
+    if ( eRx == eDirection || eAllDir == eDirection )
+    {
+        ouEcus.insert(ouEcus.end(), m_ouRxEcus.begin(), m_ouRxEcus.end());
+    }
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledFrame::MapSignal(UID_ELEMENT&, SignalInstanse&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::UnMapSignal(UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::MapPdu(UID_ELEMENT&, PduInstanse&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::UnMapPdu(UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::MapNode(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::UnMapNode(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::SetProperties(FrameProps&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::GetProperties(FrameProps& ouProps)
+{
+    if ( eCANProtocol == ouProps.m_eProtocol )
+    {
+        (CANFrameProps&)ouProps = m_ouProps;
+    }
+    else
+    {
+        ouProps.m_eProtocol = m_ouProps.m_eProtocol;
+        ouProps.m_nMsgId = m_ouProps.m_nMsgId;
+        ouProps.m_unMsgSize = m_ouProps.m_unMsgSize;
+    }
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledFrame::GetSignalList(std::map<ISignal*, SignalInstanse>& mapSignals)
+{
+    mapSignals.clear();
+    for ( auto itr = m_ouSignals.begin(); itr != m_ouSignals.end(); ++itr )
+    {
+        mapSignals[itr->first] = itr->second;
+    }
+    return EC_SUCCESS;
+}
+
+unsigned int CompiledFrame::GetSignalCount()
+{
+    return m_ouSignals.size();
+}
+
+ERRORCODE CompiledFrame::GetPduList(std::map<IPdu*, PduInstanse>& mapPdus)
+{
+    mapPdus.clear();
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledFrame::GetUpdatedPdus(unsigned char*, std::map<IPdu*, PduInstanse>& mapPdus)
+{
+    mapPdus.clear();
+    return EC_NA;
+}
+
+ERRORCODE CompiledFrame::InterpretSignals(const unsigned char* pchData, int nSize, std::list<InterpreteSignals>& ouSignalInfoList, bool bIsHex, bool formatHex)
+{
+    std::vector<SignalValue> ouValues;
+    InterpretSignals(pchData, nSize, ouValues);
+
+    ouSignalInfoList.clear();
+    char acValue[64];
+    std::vector<SignalValue>::iterator itrValue = ouValues.begin();
+    for ( auto itr = m_ouSignals.begin(); itr != m_ouSignals.end() && itrValue != ouValues.end(); ++itr )
+    {
+        CompiledSignal* pouSignal = itr->first;
+        if ( itrValue->mName != pouSignal->m_strName )
+        {
+            continue;   //Inactive multiplexed signal
+        }
+
+        InterpreteSignals ouInfo;
+        ouInfo.m_omSigName = itrValue->mName;
+        ouInfo.m_omUnit = itrValue->mUnit;
+        if ( true == bIsHex )
+        {
+            unsigned __int64 un64Raw = itrValue->mUnValue & un64GetMask(pouSignal->m_ouProps.m_unSignalSize);
+            sprintf_s(acValue, sizeof(acValue), ( true == formatHex ) ? "0x%I64X" : "%I64X", un64Raw);
+        }
+        else if ( true == itrValue->mIsSigned )
+        {
+            sprintf_s(acValue, sizeof(acValue), "%I64d", itrValue->mValue);
+        }
+        else
+        {
+            sprintf_s(acValue, sizeof(acValue), "%I64u", itrValue->mUnValue);
+        }
+        ouInfo.m_omRawValue = acValue;
+
+        const std::string* pstrDesc = nullptr;
+        if ( nullptr != pouSignal->m_pouCoding )
+        {
+            pstrDesc = pouSignal->m_pouCoding->pGetValueDescription(pouSignal->n64ExtendSign(itrValue->mUnValue));
+        }
+        if ( nullptr != pstrDesc )
+        {
+            ouInfo.m_omEnggValue = *pstrDesc;
+        }
+        else
+        {
+            sprintf_s(acValue, sizeof(acValue), "%.3f", itrValue->mPhyicalValue);
+            ouInfo.m_omEnggValue = acValue;
+        }
+        ouSignalInfoList.push_back(ouInfo);
+        ++itrValue;
+    }
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledFrame::InterpretSignals(const unsigned char* pchData, int nSize, std::vector<SignalValue>& ouSignalInfoList)
+{
+    ouSignalInfoList.clear();
+    if ( nullptr == pchData )
+    {
+        return EC_FAILURE;
+    }
+
+    //Only the multiplexed signals selected by the switch value are active
+    bool bMultiplexed = false;
+    __int64 n64SwitchValue = 0;
+    for ( auto itr = m_ouSignals.begin(); itr != m_ouSignals.end(); ++itr )
+    {
+        const CANSignalProps& ouProps = itr->first->m_ouProps;
+        if ( eMultiplexSwitch == ouProps.m_eMultiplex || eBoth == ouProps.m_eMultiplex )
+        {
+            n64SwitchValue = itr->first->n64ExtendSign(un64ExtractBits(pchData, nSize, itr->second.m_nStartBit, ouProps.m_unSignalSize, eIntel == itr->second.m_ouSignalEndianess));
+            bMultiplexed = true;
+            break;
+        }
+    }
+
+    ouSignalInfoList.reserve(m_ouSignals.size());
+    for ( auto itr = m_ouSignals.begin(); itr != m_ouSignals.end(); ++itr )
+    {
+        CompiledSignal* pouSignal = itr->first;
+        const CANSignalProps& ouProps = pouSignal->m_ouProps;
+        if ( true == bMultiplexed && eMutiplexedSignal == ouProps.m_eMultiplex && n64SwitchValue != ouProps.m_nMuliplexedValue )
+        {
+            continue;
+        }
+
+        unsigned __int64 un64Raw = un64ExtractBits(pchData, nSize, itr->second.m_nStartBit, ouProps.m_unSignalSize, eIntel == itr->second.m_ouSignalEndianess);
+
+        SignalValue ouValue;
+        ouValue.mName = pouSignal->m_strName;
+        ouValue.mUnit = ouProps.m_omUnit;
+        ouValue.mIsSigned = pouSignal->bIsSigned();
+        if ( true == ouValue.mIsSigned )
+        {
+            ouValue.mValue = pouSignal->n64ExtendSign(un64Raw);
+        }
+        else
+        {
+            ouValue.mUnValue = un64Raw;
+        }
+        ouValue.mPhyicalValue = pouSignal->dGetEngValue(un64Raw);
+        ouSignalInfoList.push_back(ouValue);
+    }
+    return EC_SUCCESS;
+}
+
+/* CompiledEcu */
+
+CompiledEcu::CompiledEcu(ICluster* pCluster) : IEcu(pCluster)
+{
+    m_oueElementType = eEcuElement;
+}
+
+ERRORCODE CompiledEcu::RegisterForChangeNotification(INotifyClusterChange*)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledEcu::GetEcuType(eProtocolType& eType)
+{
+    eType = eCANProtocol;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledEcu::MapFrame(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledEcu::UnMapFrame(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledEcu::MapSignal(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledEcu::UnMapSignal(eDIR, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledEcu::GetFrameList(eDIR eDir, std::list<IFrame*>& ouFrames)
+{
+    ouFrames.clear();
+    if ( eTx == eDir || eAllDir == eDir )
+    {
+        ouFrames.insert(ouFrames.end(), m_ouTxFrames.begin(), m_ouTxFrames.end());
+    }
+    if ( eRx == eDir || eAllDir == eDir )
+    {
+        ouFrames.insert(ouFrames.end(), m_ouRxFrames.begin(), m_ouRxFrames.end());
+    }
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledEcu::GetFrame(UID_ELEMENT& nId, void*, IFrame** ouFrame)
+{
+    if ( nullptr == ouFrame )
+    {
+        return EC_FAILURE;
+    }
+    *ouFrame = nullptr;
+    std::list<IFrame*> ouFrames;
+    GetFrameList(eAllDir, ouFrames);
+    for ( auto itr = ouFrames.begin(); itr != ouFrames.end(); ++itr )
+    {
+        if ( (*itr)->GetUniqueId() == nId )
+        {
+            *ouFrame = *itr;
+            return EC_SUCCESS;
+        }
+    }
+    return EC_FAIL_ELEMENT_NOT_FOUND;
+}
+
+ERRORCODE CompiledEcu::GetSignalList(eDIR eDir, std::map<ISignal*, ISignal*>& ouSignals)
+{
+    ouSignals.clear();
+    std::list<IFrame*> ouFrames;
+    GetFrameList(eDir, ouFrames);
+    for ( auto itrFrame = ouFrames.begin(); itrFrame != ouFrames.end(); ++itrFrame )
+    {
+        std::map<ISignal*, SignalInstanse> ouFrameSignals;
+        (*itrFrame)->GetSignalList(ouFrameSignals);
+        for ( auto itr = ouFrameSignals.begin(); itr != ouFrameSignals.end(); ++itr )
+        {
+            ouSignals[itr->first] = itr->first;
+        }
+    }
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledEcu::GetProperties(EcuProperties& ouProps)
+{
+    ouProps.m_eProtocol = eCANProtocol;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledEcu::SetProperties(EcuProperties&)
+{
+    return EC_NA;
+}
+
+/* CompiledCluster */
+
+CompiledCluster::CompiledCluster()
+{
+    m_eBusType = CAN;
+    m_unNextUid = INVALID_UID_ELEMENT + 1;
+}
+
+CompiledCluster::~CompiledCluster()
+{
+    for ( auto itr = m_ouFrames.begin(); itr != m_ouFrames.end(); ++itr )
+    {
+        delete *itr;
+    }
+    for ( auto itr = m_ouSignals.begin(); itr != m_ouSignals.end(); ++itr )
+    {
+        delete *itr;
+    }
+    for ( auto itr = m_ouCodings.begin(); itr != m_ouCodings.end(); ++itr )
+    {
+        delete *itr;
+    }
+    for ( auto itr = m_ouEcus.begin(); itr != m_ouEcus.end(); ++itr )
+    {
+        delete *itr;
+    }
+}
+
+ERRORCODE CompiledCluster::Create(const BYTE* pbyImage, unsigned int unImageSize, const std::string& strDbPath, CompiledCluster** ppouCluster)
+{
+    using namespace CompiledDb;
+
+    if ( nullptr == ppouCluster )
+    {
+        return EC_FAILURE;
+    }
+    *ppouCluster = nullptr;
+    if ( nullptr == pbyImage || unImageSize < sizeof(ImageHeader) )
+    {
+        return EC_FILE_INVALID;
+    }
+    const ImageHeader* psHeader = (const ImageHeader*)pbyImage;
+    if ( IMAGE_SIGNATURE != psHeader->m_unSignature || IMAGE_VERSION != psHeader->m_unVersion )
+    {
+        return EC_FILE_INVALID;
+    }
+
+    unsigned int unEcus, unFrames, unInstances, unSignals, unCodings, unEntries, unDescs, unIndices, unStringSize;
+    const EcuRecord* psEcus = psGetSection<EcuRecord>(pbyImage, unImageSize, SECTION_ECU, unEcus);
+    const FrameRecord* psFrames = psGetSection<FrameRecord>(pbyImage, unImageSize, SECTION_FRAME, unFrames);
+    const SignalInstanceRecord* psInstances = psGetSection<SignalInstanceRecord>(pbyImage, unImageSize, SECTION_SIGNAL_INSTANCE, unInstances);
+    const SignalRecord* psSignals = psGetSection<SignalRecord>(pbyImage, unImageSize, SECTION_SIGNAL, unSignals);
+    const CodingRecord* psCodings = psGetSection<CodingRecord>(pbyImage, unImageSize, SECTION_CODING, unCodings);
+    const CompuEntryRecord* psEntries = psGetSection<CompuEntryRecord>(pbyImage, unImageSize, SECTION_COMPU_ENTRY, unEntries);
+    const ValueDescRecord* psDescs = psGetSection<ValueDescRecord>(pbyImage, unImageSize, SECTION_VALUE_DESC, unDescs);
+    const unsigned int* punIndices = psGetSection<unsigned int>(pbyImage, unImageSize, SECTION_INDEX, unIndices);
+    const char* pchStrings = psGetSection<char>(pbyImage, unImageSize, SECTION_STRING, unStringSize);
+
+    if ( nullptr == psEcus || nullptr == psFrames || nullptr == psInstances || nullptr == psSignals || nullptr == psCodings
+            || nullptr == psEntries || nullptr == psDescs || nullptr == punIndices || nullptr == pchStrings
+            || 0 == unStringSize || '\0' != pchStrings[unStringSize - 1] )
+    {
+        return EC_FILE_INVALID;
+    }
+
+    bool bValid = true;
+    auto strAt = [&](unsigned int unOffset) -> std::string
+    {
+        if ( unOffset >= unStringSize )
+        {
+            bValid = false;
+            return std::string();
+        }
+        return std::string(pchStrings + unOffset);
+    };
+    auto bCheckRange = [&](const IndexRange& sRange, unsigned int unLimit) -> bool
+    {
+        if ( (unsigned __int64)sRange.m_unFirst + sRange.m_unCount > unIndices )
+        {
+            return false;
+        }
+        for ( unsigned int i = 0; i < sRange.m_unCount; i++ )
+        {
+            if ( punIndices[sRange.m_unFirst + i] >= unLimit )
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    CompiledCluster* pouCluster = new CompiledCluster();
+    pouCluster->m_eBusType = (ETYPE_BUS)psHeader->m_unBusType;
+    pouCluster->m_strName = strAt(psHeader->m_unClusterName);
+    pouCluster->m_strChecksum = strAt(psHeader->m_unDbChecksum);
+    pouCluster->m_strDbPath = strDbPath;
+
+    //Codings
+    pouCluster->m_ouCodings.reserve(unCodings);
+    for ( unsigned int i = 0; i < unCodings && bValid; i++ )
+    {
+        const CodingRecord& sRecord = psCodings[i];
+        if ( (unsigned __int64)sRecord.m_unFirstEntry + sRecord.m_unEntryCount > unEntries
+                || (unsigned __int64)sRecord.m_unFirstDesc + sRecord.m_unDescCount > unDescs )
+        {
+            bValid = false;
+            break;
+        }
+        CompiledCoding* pouCoding = new CompiledCoding(pouCluster);
+        pouCoding->m_strName = strAt(sRecord.m_unName);
+        CCompuMethod& ouCompu = pouCoding->m_ouCompuMethod;
+        ouCompu.m_eCompuType = (eCompuType)sRecord.m_unCompuType;
+        for ( unsigned int j = 0; j < sRecord.m_unEntryCount; j++ )
+        {
+            const CompuEntryRecord& sEntry = psEntries[sRecord.m_unFirstEntry + j];
+            ValueRange sRange;
+            sRange.m_dwLowerLimit = sEntry.m_un64Lower;
+            sRange.m_dwUpperLimit = sEntry.m_un64Upper;
+            switch ( sEntry.m_unEntryType )
+            {
+                case ENTRY_LINEAR:
+                case ENTRY_SCALE_LINEAR:
+                {
+                    CompuLinearCode sCode;
+                    sCode.m_sRange = sRange;
+                    sCode.m_dN0 = sEntry.m_dN0;
+                    sCode.m_dN1 = sEntry.m_dN1;
+                    sCode.m_dD0 = sEntry.m_dD0;
+                    if ( ENTRY_LINEAR == sEntry.m_unEntryType )
+                    {
+                        ouCompu.m_ouLinearCode = sCode;
+                    }
+                    else
+                    {
+                        ouCompu.m_ouCompuScaleLinear.push_back(sCode);
+                    }
+                }
+                break;
+                case ENTRY_TEXT:
+                {
+                    CompuTextable sText;
+                    sText.m_sRange = sRange;
+                    sText.m_aTextName = strAt(sEntry.m_unAux);
+                    ouCompu.m_ouTextCode.push_back(sText);
+                }
+                break;
+                case ENTRY_TAB:
+                {
+                    CompuTabCode sTab;
+                    sTab.m_sRange = sRange;
+                    sTab.m_dPhysVal = sEntry.m_dN0;
+                    ouCompu.m_ouTabCode.push_back(sTab);
+                }
+                break;
+                case ENTRY_IDENTICAL:
+                {
+                    CompuIdenticalCode sIdentical;
+                    sIdentical.m_sRange = sRange;
+                    sIdentical.m_eValidity = (Validity)sEntry.m_unAux;
+                    ouCompu.m_ouIdenticalCode.push_back(sIdentical);
+                }
+                break;
+                default:
+                    bValid = false;
+                    break;
+            }
+        }
+        for ( unsigned int j = 0; j < sRecord.m_unDescCount; j++ )
+        {
+            const ValueDescRecord& sDesc = psDescs[sRecord.m_unFirstDesc + j];
+            pouCoding->m_ouValueDescs[sDesc.m_nValue] = strAt(sDesc.m_unText);
+        }
+        pouCluster->m_ouCodings.push_back(pouCoding);
+        pouCluster->vAddElement(eCodingElement, pouCoding, pouCoding->m_strName);
+    }
+
+    //ECUs, frame mapping is resolved once frames are created
+    pouCluster->m_ouEcus.reserve(unEcus);
+    for ( unsigned int i = 0; i < unEcus && bValid; i++ )
+    {
+        CompiledEcu* pouEcu = new CompiledEcu(pouCluster);
+        pouEcu->m_strName = strAt(psEcus[i].m_unName);
+        pouCluster->m_ouEcus.push_back(pouEcu);
+        pouCluster->vAddElement(eEcuElement, pouEcu, pouEcu->m_strName);
+    }
+
+    //Signals
+    pouCluster->m_ouSignals.reserve(unSignals);
+    for ( unsigned int i = 0; i < unSignals && bValid; i++ )
+    {
+        const SignalRecord& sRecord = psSignals[i];
+        if ( ( INVALID_INDEX != sRecord.m_unCoding && sRecord.m_unCoding >= unCodings )
+                || false == bCheckRange(sRecord.m_sTxEcus, unEcus) || false == bCheckRange(sRecord.m_sRxEcus, unEcus) )
+        {
+            bValid = false;
+            break;
+        }
+        CompiledSignal* pouSignal = new CompiledSignal(pouCluster);
+        pouSignal->m_strName = strAt(sRecord.m_unName);
+        CANSignalProps& ouProps = pouSignal->m_ouProps;
+        ouProps.m_omUnit = strAt(sRecord.m_unUnit);
+        ouProps.m_unSignalSize = sRecord.m_unLength;
+        ouProps.m_ouSignalType = (eSignalType)sRecord.m_unSignalType;
+        ouProps.m_ouDataType = (eSignalDataType)sRecord.m_unDataType;
+        ouProps.m_ouEndianess = (eEndianess)sRecord.m_unEndianess;
+        ouProps.m_nIntialValue = sRecord.m_un64InitialValue;
+        ouProps.m_eMultiplex = (eMultiplexSignalIndicator)sRecord.m_unMultiplex;
+        ouProps.m_nMuliplexedValue = sRecord.m_nMultiplexedValue;
+        pouSignal->m_un64MinValue = sRecord.m_un64MinValue;
+        pouSignal->m_un64MaxValue = sRecord.m_un64MaxValue;
+        if ( INVALID_INDEX != sRecord.m_unCoding )
+        {
+            pouSignal->m_pouCoding = pouCluster->m_ouCodings[sRecord.m_unCoding];
+            pouSignal->m_pouCoding->m_ouSignals[pouSignal->GetUniqueId()] = pouSignal;
+        }
+        for ( unsigned int j = 0; j < sRecord.m_sTxEcus.m_unCount; j++ )
+        {
+            pouSignal->m_ouTxEcus.push_back(pouCluster->m_ouEcus[punIndices[sRecord.m_sTxEcus.m_unFirst + j]]);
+        }
+        for ( unsigned int j = 0; j < sRecord.m_sRxEcus.m_unCount; j++ )
+        {
+            pouSignal->m_ouRxEcus.push_back(pouCluster->m_ouEcus[punIndices[sRecord.m_sRxEcus.m_unFirst + j]]);
+        }
+        pouCluster->m_ouSignals.push_back(pouSignal);
+        pouCluster->vAddElement(eSignalElement, pouSignal, pouSignal->m_strName);
+    }
+
+    //Frames
+    pouCluster->m_ouFrames.reserve(unFrames);
+    for ( unsigned int i = 0; i < unFrames && bValid; i++ )
+    {
+        const FrameRecord& sRecord = psFrames[i];
+        if ( (unsigned __int64)sRecord.m_unFirstInstance + sRecord.m_unInstanceCount > unInstances
+                || false == bCheckRange(sRecord.m_sTxEcus, unEcus) || false == bCheckRange(sRecord.m_sRxEcus, unEcus) )
+        {
+            bValid = false;
+            break;
+        }
+        CompiledFrame* pouFrame = new CompiledFrame(pouCluster);
+        pouFrame->m_strName = strAt(sRecord.m_unName);
+        pouFrame->m_ouProps.m_nMsgId = sRecord.m_unFrameId;
+        pouFrame->m_ouProps.m_unMsgSize = sRecord.m_unLength;
+        pouFrame->m_ouProps.m_canMsgType = (eCANMsgType)sRecord.m_unMsgType;
+        pouFrame->m_ouSignals.reserve(sRecord.m_unInstanceCount);
+        for ( unsigned int j = 0; j < sRecord.m_unInstanceCount; j++ )
+        {
+            const SignalInstanceRecord& sInstance = psInstances[sRecord.m_unFirstInstance + j];
+            if ( sInstance.m_unSignal >= unSignals )
+            {
+                bValid = false;
+                break;
+            }
+            SignalInstanse ouInstance;
+            ouInstance.m_nStartBit = sInstance.m_nStartBit;
+            ouInstance.m_ouSignalEndianess = (eEndianess)sInstance.m_unEndianess;
+            ouInstance.m_nUpdateBitPos = sInstance.m_nUpdateBitPos;
+            pouFrame->m_ouSignals.push_back(std::make_pair(pouCluster->m_ouSignals[sInstance.m_unSignal], ouInstance));
+        }
+        for ( unsigned int j = 0; j < sRecord.m_sTxEcus.m_unCount; j++ )
+        {
+            pouFrame->m_ouTxEcus.push_back(pouCluster->m_ouEcus[punIndices[sRecord.m_sTxEcus.m_unFirst + j]]);
+        }
+        for ( unsigned int j = 0; j < sRecord.m_sRxEcus.m_unCount; j++ )
+        {
+            pouFrame->m_ouRxEcus.push_back(pouCluster->m_ouEcus[punIndices[sRecord.m_sRxEcus.m_unFirst + j]]);
+        }
+        pouCluster->m_ouFrames.push_back(pouFrame);
+        pouCluster->m_ouFrameIdMap[sRecord.m_unFrameId] = pouFrame;
+        pouCluster->vAddElement(eFrameElement, pouFrame, pouFrame->m_strName);
+    }
+
+    //ECU frame mapping
+    for ( unsigned int i = 0; i < unEcus && bValid; i++ )
+    {
+        const EcuRecord& sRecord = psEcus[i];
+        if ( false == bCheckRange(sRecord.m_sTxFrames, unFrames) || false == bCheckRange(sRecord.m_sRxFrames, unFrames) )
+        {
+            bValid = false;
+            break;
+        }
+        CompiledEcu* pouEcu = pouCluster->m_ouEcus[i];
+        for ( unsigned int j = 0; j < sRecord.m_sTxFrames.m_unCount; j++ )
+        {
+            pouEcu->m_ouTxFrames.push_back(pouCluster->m_ouFrames[punIndices[sRecord.m_sTxFrames.m_unFirst + j]]);
+        }
+        for ( unsigned int j = 0; j < sRecord.m_sRxFrames.m_unCount; j++ )
+        {
+            pouEcu->m_ouRxFrames.push_back(pouCluster->m_ouFrames[punIndices[sRecord.m_sRxFrames.m_unFirst + j]]);
+        }
+    }
+
+    if ( false == bValid )
+    {
+        delete pouCluster;
+        return EC_FILE_INVALID;
+    }
+    *ppouCluster = pouCluster;
+    return EC_SUCCESS;
+}
+
+void CompiledCluster::vAddElement(eClusterElementType eType, IElement* pouElement, const std::string& strName)
+{
+    m_ouElementMap[eType][pouElement->GetUniqueId()] = pouElement;
+    //First element wins, like a linear search by name would
+    m_ouNameMap[eType].insert(std::make_pair(strName, pouElement));
+}
+
+ERRORCODE CompiledCluster::GetNextUniqueId(UID_ELEMENT& unId)
+{
+    unId = m_unNextUid++;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::LoadFromFile(std::string&, std::list<ParsingResults>&, std::list<ParsingResults>&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::SaveToFile(std::string&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::ValidateCluster(std::list<std::string>&)
+{
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetDBFilePath(std::string& oustrDbFileList)
+{
+    oustrDbFileList = m_strDbPath;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetDBFileChecksum(std::string& strDBFileChecksum)
+{
+    strDBFileChecksum = m_strChecksum;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::Clear()
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::CreateElement(eClusterElementType, IElement** pElement)
+{
+    if ( nullptr != pElement )
+    {
+        *pElement = nullptr;
+    }
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::DeleteElement(eClusterElementType, UID_ELEMENT&)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::GetProperties(ePropertyType, void*)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::SetProperties(ePropertyType, void*)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::GetElement(eClusterElementType eType, UID_ELEMENT nId, IElement** pElement)
+{
+    if ( nullptr == pElement )
+    {
+        return EC_FAILURE;
+    }
+    *pElement = nullptr;
+    if ( eType >= eAllElement )
+    {
+        eType = GetElementType(nId);
+        if ( eType >= eAllElement )
+        {
+            return EC_FAIL_ELEMENT_NOT_FOUND;
+        }
+    }
+    auto itr = m_ouElementMap[eType].find(nId);
+    if ( m_ouElementMap[eType].end() == itr )
+    {
+        return EC_FAIL_ELEMENT_NOT_FOUND;
+    }
+    *pElement = itr->second;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetElementList(eClusterElementType eType, std::map<UID_ELEMENT, IElement*>& pElement)
+{
+    if ( eAllElement == eType )
+    {
+        pElement.clear();
+        for ( int i = 0; i < eAllElement; i++ )
+        {
+            pElement.insert(m_ouElementMap[i].begin(), m_ouElementMap[i].end());
+        }
+        return EC_SUCCESS;
+    }
+    if ( eType > eAllElement )
+    {
+        return EC_FAILURE;
+    }
+    pElement = m_ouElementMap[eType];
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetElementByName(eClusterElementType eType, std::string ouElementName, IElement** pElement)
+{
+    if ( nullptr == pElement )
+    {
+        return EC_FAILURE;
+    }
+    *pElement = nullptr;
+    if ( eType >= eAllElement )
+    {
+        return EC_FAILURE;
+    }
+    auto itr = m_ouNameMap[eType].find(ouElementName);
+    if ( m_ouNameMap[eType].end() == itr )
+    {
+        return EC_FAIL_ELEMENT_NOT_FOUND;
+    }
+    *pElement = itr->second;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetElementListByName(eClusterElementType, std::string&, std::list<IElement*>& pElementList)
+{
+    pElementList.clear();
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::GetClusterType(ETYPE_BUS& eBusType)
+{
+    eBusType = m_eBusType;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::EnableEventNotofications(bool)
+{
+    return EC_SUCCESS;
+}
+
+bool CompiledCluster::isNotoficationsEnabled()
+{
+    return false;
+}
+
+ERRORCODE CompiledCluster::GetEcu(std::string& strEcuName, IEcu** pEcu)
+{
+    IElement* pouElement = nullptr;
+    ERRORCODE eResult = GetElementByName(eEcuElement, strEcuName, &pouElement);
+    if ( nullptr != pEcu )
+    {
+        *pEcu = (IEcu*)pouElement;
+    }
+    return eResult;
+}
+
+ERRORCODE CompiledCluster::GetName(std::string& strClusterName)
+{
+    strClusterName = m_strName;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetFrame(unsigned int& unId, void*, IFrame** pFrame)
+{
+    if ( nullptr == pFrame )
+    {
+        return EC_FAILURE;
+    }
+    auto itr = m_ouFrameIdMap.find(unId);
+    if ( m_ouFrameIdMap.end() == itr )
+    {
+        *pFrame = nullptr;
+        return EC_FAIL_ELEMENT_NOT_FOUND;
+    }
+    *pFrame = itr->second;
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetEcuList(std::list<IEcu*>& pEcuList)
+{
+    pEcuList.assign(m_ouEcus.begin(), m_ouEcus.end());
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetFrameList(std::list<IFrame*>& pFrameList)
+{
+    pFrameList.assign(m_ouFrames.begin(), m_ouFrames.end());
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetSignalList(std::list<ISignal*>& pSignalList)
+{
+    pSignalList.assign(m_ouSignals.begin(), m_ouSignals.end());
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledCluster::GetPduList(std::list<IPdu*>& pPduList)
+{
+    pPduList.clear();
+    return EC_SUCCESS;
+}
+
+eClusterElementType CompiledCluster::GetElementType(UID_ELEMENT& ouElementUid)
+{
+    for ( int i = 0; i < eAllElement; i++ )
+    {
+        if ( m_ouElementMap[i].end() != m_ouElementMap[i].find(ouElementUid) )
+        {
+            return (eClusterElementType)i;
+        }
+    }
+    return eInvalidElement;
+}
+
+ERRORCODE CompiledCluster::RegisterForChangeNotification(INotifyClusterChange*, UID_ELEMENT)
+{
+    return EC_NA;
+}
+
+ERRORCODE CompiledCluster::NotifyClusterChange(eAction, UID_ELEMENT&, eClusterElementType&, void*)
+{
+    return EC_SUCCESS;
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <Windows.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "../ProtocolDefinitions/ICluster.h"
+#include "../ProtocolDefinitions/CANDefines.h"
+#include "CompiledDbImage.h"
+
+/* Read only cluster materialised from a compiled database image.
+   Used in place of the parser's cluster when the image in the database cache
+   matches the database file, editing calls are not supported (EC_NA). */
+
+class CompiledCluster;
+class CompiledSignal;
+class CompiledFrame;
+
+class CompiledCoding : public ICoding
+{
+    friend class CompiledCluster;
+    CCompuMethod m_ouCompuMethod;
+    std::map<int, std::string> m_ouValueDescs;
+    std::map<UID_ELEMENT, ISignal*> m_ouSignals;
+public:
+    CompiledCoding(ICluster* pCluster);
+    virtual ~CompiledCoding() {};
+
+    ERRORCODE RegisterForChangeNotification(INotifyClusterChange*);
+
+    ERRORCODE GetProperties(CompuMethodProps&);
+    ERRORCODE SetProperties(CompuMethodProps&);
+    ERRORCODE GetValueDescriptions(std::map<int, std::string>&);
+    ERRORCODE SetValueDescriptions(std::map<int, std::string>&);
+    ERRORCODE GetValueDescription(int, std::string&);
+    ERRORCODE SetValueDescription(int, std::string&);
+    ERRORCODE GetSignalList(std::map<UID_ELEMENT, ISignal*>& lstSignals);
+    ERRORCODE MapSignal(UID_ELEMENT);
+    ERRORCODE UnMapSignal(UID_ELEMENT);
+    ERRORCODE GetEngValue(eSignalDataType eDataType, int nSiglength, unsigned __int64 unRawValue, double& dEngValue);
+    ERRORCODE GetRawValue(double dEngValue, unsigned __int64& unRawValue);
+
+    double dGetEngValue(double dRawValue) const;
+    const std::string* pGetValueDescription(__int64 n64RawValue) const;
+};
+
+class CompiledSignal : public ISignal
+{
+    friend class CompiledCluster;
+    friend class CompiledFrame;
+    CANSignalProps m_ouProps;
+    unsigned __int64 m_un64MinValue;
+    unsigned __int64 m_un64MaxValue;
+    CompiledCoding* m_pouCoding;
+    std::list<IEcu*> m_ouTxEcus;
+    std::list<IEcu*> m_ouRxEcus;
+public:
+    CompiledSignal(ICluster* pCluster);
+    virtual ~CompiledSignal() {};
+
+    ERRORCODE RegisterForChangeNotification(INotifyClusterChange*);
+
+    ERRORCODE GetEcus(eDIR eDirection, std::list<IEcu*>& ouNodes);
+    ERRORCODE GetLength(unsigned int& unSignalLength);
+    ERRORCODE GetMinMaxValue(unsigned __int64& unMinValue, unsigned __int64& unMaxValue);
+    ERRORCODE MapNode(eDIR eDirection, UID_ELEMENT&);
+    ERRORCODE UnMapNode(eDIR eDirection, UID_ELEMENT&);
+    ERRORCODE GetEncoding(ICoding**);
+    ERRORCODE SetEncoding(UID_ELEMENT&);
+    ERRORCODE GetProperties(SignalProps&);
+    ERRORCODE SetProperties(SignalProps&);
+    ERRORCODE GetDataType(eSignalDataType&);
+    ERRORCODE GetUnit(std::string&);
+    ERRORCODE GetRawValue(int nStartBit, int nSignalLength, int nByteLength, bool bIntel, const unsigned char* pchData, unsigned __int64& unRawValue);
+    ERRORCODE GetEnggValueFromRaw(unsigned __int64 dwRawValue, double& dEnggValue);
+    ERRORCODE GetRawValueFromEng(double dEnggValue, unsigned __int64& dwRawValue);
+
+    bool bIsSigned() const;
+    __int64 n64ExtendSign(unsigned __int64 un64RawValue) const;
+    double dGetEngValue(unsigned __int64 un64RawValue) const;
+};
+
+class CompiledFrame : public IFrame
+{
+    friend class CompiledCluster;
+    CANFrameProps m_ouProps;
+    std::vector< std::pair<CompiledSignal*, SignalInstanse> > m_ouSignals;
+    std::list<IEcu*> m_ouTxEcus;
+    std::list<IEcu*> m_ouRxEcus;
+public:
+    CompiledFrame(ICluster* pCluster);
+    virtual ~CompiledFrame() {};
+
+    ERRORCODE RegisterForChangeNotification(INotifyClusterChange*);
+
+    ERRORCODE GetFrameType(eProtocolType&);
+    ERRORCODE GetFrameId(unsigned int& unFrameId);
+    ERRORCODE GetLength(unsigned int& unFrameLength);
+    ERRORCODE GetEcus(eDIR eDirection, std::list<IEcu*>&);
+    ERRORCODE MapSignal(UID_ELEMENT& nId, SignalInstanse& ouProps);
+    ERRORCODE UnMapSignal(UID_ELEMENT&);
+    ERRORCODE MapPdu(UID_ELEMENT& nId, PduInstanse& ouProps);
+    ERRORCODE UnMapPdu(UID_ELEMENT&);
+    ERRORCODE MapNode(eDIR eDirection, UID_ELEMENT&);
+    ERRORCODE UnMapNode(eDIR eDirection, UID_ELEMENT&);
+    ERRORCODE SetProperties(FrameProps&);
+    ERRORCODE GetProperties(FrameProps&);
+    ERRORCODE GetSignalList(std::map<ISignal*, SignalInstanse>& mapSignals);
+    unsigned int GetSignalCount();
+    ERRORCODE GetPduList(std::map<IPdu*, PduInstanse>& mapPdus);
+    ERRORCODE GetUpdatedPdus(unsigned char*, std::map<IPdu*, PduInstanse>&);
+    ERRORCODE InterpretSignals(const unsigned char*, int nSize, std::list<InterpreteSignals>& ouSignalInfoList, bool bIsHex, bool formatHex = false);
+    ERRORCODE InterpretSignals(const unsigned char*, int nSize, std::vector<SignalValue>& ouSignalInfoList);
+};
+
+class CompiledEcu : public IEcu
+{
+    friend class CompiledCluster;
+    std::list<IFrame*> m_ouTxFrames;
+    std::list<IFrame*> m_ouRxFrames;
+public:
+    CompiledEcu(ICluster* pCluster);
+    virtual ~CompiledEcu() {};
+
+    ERRORCODE RegisterForChangeNotification(INotifyClusterChange*);
+
+    ERRORCODE GetEcuType(eProtocolType&);
+    ERRORCODE MapFrame(eDIR eDir, UID_ELEMENT& nId);
+    ERRORCODE UnMapFrame(eDIR eDir, UID_ELEMENT& nId);
+    ERRORCODE MapSignal(eDIR eDir, UID_ELEMENT& nId);
+    ERRORCODE UnMapSignal(eDIR eDir, UID_ELEMENT& nId);
+    ERRORCODE GetFrameList(eDIR eDir, std::list<IFrame*>& ouFrames);
+    ERRORCODE GetFrame(UID_ELEMENT& nId, void* pProtocolSpecParam, IFrame** ouFrame);
+    ERRORCODE GetSignalList(eDIR eDir, std::map<ISignal*, ISignal*>& ouSignals);
+    ERRORCODE GetProperties(EcuProperties&);
+    ERRORCODE SetProperties(EcuProperties&);
+};
+
+class CompiledCluster : public ICluster
+{
+    ETYPE_BUS m_eBusType;
+    std::string m_strName;
+    std::string m_strDbPath;
+    std::string m_strChecksum;
+    UID_ELEMENT m_unNextUid;
+
+    std::vector<CompiledEcu*> m_ouEcus;
+    std::vector<CompiledFrame*> m_ouFrames;
+    std::vector<CompiledSignal*> m_ouSignals;
+    std::vector<CompiledCoding*> m_ouCodings;
+
+    std::map<UID_ELEMENT, IElement*> m_ouElementMap[eAllElement];
+    std::map<std::string, IElement*> m_ouNameMap[eAllElement];
+    std::map<unsigned int, CompiledFrame*> m_ouFrameIdMap;
+
+    CompiledCluster();
+public:
+    virtual ~CompiledCluster();
+
+    /* Builds the cluster from a complete, validated image. */
+    static ERRORCODE Create(const BYTE* pbyImage, unsigned int unImageSize, const std::string& strDbPath, CompiledCluster** ppouCluster);
+
+    ERRORCODE GetNextUniqueId(UID_ELEMENT&);
+    ERRORCODE LoadFromFile(std::string& strFileName, std::list<ParsingResults>& ouErrors, std::list<ParsingResults>& ouWarnings);
+    ERRORCODE SaveToFile(std::string& strFileName);
+    ERRORCODE ValidateCluster(std::list<std::string>&);
+    ERRORCODE GetDBFilePath(std::string& oustrDbFileList);
+    ERRORCODE GetDBFileChecksum(std::string& strDBFileChecksum);
+    ERRORCODE Clear();
+
+    ERRORCODE CreateElement(eClusterElementType eType, IElement** pElement);
+    ERRORCODE DeleteElement(eClusterElementType eType, UID_ELEMENT& nUniqueId);
+
+    ERRORCODE GetProperties(ePropertyType ouePropertyType, void* pProperties);
+    ERRORCODE SetProperties(ePropertyType ouePropertyType, void* pProperties);
+
+    ERRORCODE GetElement(eClusterElementType eType, UID_ELEMENT nId, IElement** pElement);
+    ERRORCODE GetElementList(eClusterElementType eType, std::map<UID_ELEMENT, IElement*>& pElement);
+    ERRORCODE GetElementByName(eClusterElementType eType, std::string ouElementName, IElement** pElement);
+    ERRORCODE GetElementListByName(eClusterElementType eType, std::string& strEcuName, std::list<IElement*>& pElementList);
+
+    ERRORCODE GetClusterType(ETYPE_BUS&);
+
+    ERRORCODE EnableEventNotofications(bool bEnable = true);
+    bool isNotoficationsEnabled();
+
+    ERRORCODE GetEcu(std::string& strEcuName, IEcu** pEcu);
+    ERRORCODE GetName(std::string& strClusterName);
+
+    ERRORCODE GetFrame(unsigned int& unId, void* vProtocolFrameParams, IFrame** pFrame);
+    ERRORCODE GetEcuList(std::list<IEcu*>& pEcuList);
+    ERRORCODE GetFrameList(std::list<IFrame*>& pFrameList);
+    ERRORCODE GetSignalList(std::list<ISignal*>& pSignalList);
+    ERRORCODE GetPduList(std::list<IPdu*>& pPduList);
+
+    eClusterElementType GetElementType(UID_ELEMENT& ouElementUid);
+
+    ERRORCODE RegisterForChangeNotification(INotifyClusterChange* ouNotification, UID_ELEMENT uidOnElement = INVALID_UID_ELEMENT);
+    ERRORCODE NotifyClusterChange(eAction oueAction, UID_ELEMENT& m_nUnId, eClusterElementType& oueElementType, void* pAcionData);
+
+private:
+    void vAddElement(eClusterElementType eType, IElement* pouElement, const std::string& strName);
+};
@@ -0,0 +1,730 @@
+#include "CompiledDbCache.h"
+#include "CompiledCluster.h"
+#include "CompiledDbImage.h"
+#include <ShlObj.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include <stdio.h>
+#include <math.h>
+
+#define DB_CACHE_FOLDER         "\\BUSMASTER\\DbCache"
+#define DB_CACHE_EXTENSION      ".bmdc"
+
+namespace
+{
+const unsigned __int64 FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+const unsigned __int64 FNV_PRIME        = 0x100000001b3ULL;
+
+unsigned __int64 un64Fnv1a(const BYTE* pbyData, unsigned __int64 un64Size, unsigned __int64 un64Hash = FNV_OFFSET_BASIS)
+{
+    for ( unsigned __int64 i = 0; i < un64Size; i++ )
+    {
+        un64Hash ^= pbyData[i];
+        un64Hash *= FNV_PRIME;
+    }
+    return un64Hash;
+}
+
+/* Read only mapped view of a file */
+class MappedFile
+{
+    HANDLE m_hFile;
+    HANDLE m_hMapping;
+    const BYTE* m_pbyView;
+    unsigned __int64 m_un64Size;
+public:
+    MappedFile()
+    {
+        m_hFile = INVALID_HANDLE_VALUE;
+        m_hMapping = nullptr;
+        m_pbyView = nullptr;
+        m_un64Size = 0;
+    }
+    ~MappedFile()
+    {
+        if ( nullptr != m_pbyView )
+        {
+            UnmapViewOfFile(m_pbyView);
+        }
+        if ( nullptr != m_hMapping )
+        {
+            CloseHandle(m_hMapping);
+        }
+        if ( INVALID_HANDLE_VALUE != m_hFile )
+        {
+            CloseHandle(m_hFile);
+        }
+    }
+    bool bOpen(const std::string& strPath)
+    {
+        m_hFile = CreateFile(strPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if ( INVALID_HANDLE_VALUE == m_hFile )
+        {
+            return false;
+        }
+        LARGE_INTEGER sSize;
+        if ( FALSE == GetFileSizeEx(m_hFile, &sSize) )
+        {
+            return false;
+        }
+        m_un64Size = sSize.QuadPart;
+        if ( 0 == m_un64Size )
+        {
+            return true;
+        }
+        m_hMapping = CreateFileMapping(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if ( nullptr == m_hMapping )
+        {
+            return false;
+        }
+        m_pbyView = (const BYTE*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+        return ( nullptr != m_pbyView );
+    }
+    const BYTE* pbyGetView() const
+    {
+        return m_pbyView;
+    }
+    unsigned __int64 un64GetSize() const
+    {
+        return m_un64Size;
+    }
+};
+
+/* Flattens a parsed cluster into the image layout described in CompiledDbImage.h */
+class CompiledDbWriter
+{
+    std::vector<CompiledDb::EcuRecord> m_asEcus;
+    std::vector<CompiledDb::FrameRecord> m_asFrames;
+    std::vector<CompiledDb::SignalInstanceRecord> m_asInstances;
+    std::vector<CompiledDb::SignalRecord> m_asSignals;
+    std::vector<CompiledDb::CodingRecord> m_asCodings;
+    std::vector<CompiledDb::CompuEntryRecord> m_asEntries;
+    std::vector<CompiledDb::ValueDescRecord> m_asDescs;
+    std::vector<unsigned int> m_aunIndices;
+    std::string m_strStrings;
+    std::map<std::string, unsigned int> m_ouStringOffsets;
+
+    std::map<IEcu*, unsigned int> m_ouEcuIndex;
+    std::map<IFrame*, unsigned int> m_ouFrameIndex;
+    std::map<ISignal*, unsigned int> m_ouSignalIndex;
+    std::map<ICoding*, unsigned int> m_ouCodingIndex;
+
+public:
+    CompiledDbWriter()
+    {
+        m_strStrings.push_back('\0');
+    }
+
+    bool bCompile(ICluster* pouCluster, ETYPE_BUS eBusType, const DbSourceIdentity& ouIdentity, std::vector<BYTE>& abyImage)
+    {
+        std::list<IEcu*> ouEcus;
+        std::list<IFrame*> ouFrames;
+        pouCluster->GetEcuList(ouEcus);
+        pouCluster->GetFrameList(ouFrames);
+
+        for ( auto itr = ouEcus.begin(); itr != ouEcus.end(); ++itr )
+        {
+            unAddEcu(*itr);
+        }
+        for ( auto itr = ouFrames.begin(); itr != ouFrames.end(); ++itr )
+        {
+            unAddFrame(*itr);
+        }
+        //Frame lists of ECUs can be resolved once all frames are known
+        for ( auto itr = m_ouEcuIndex.begin(); itr != m_ouEcuIndex.end(); ++itr )
+        {
+            std::list<IFrame*> ouEcuFrames;
+            itr->first->GetFrameList(eTx, ouEcuFrames);
+            m_asEcus[itr->second].m_sTxFrames = sAddFrameRefs(ouEcuFrames);
+            ouEcuFrames.clear();
+            itr->first->GetFrameList(eRx, ouEcuFrames);
+            m_asEcus[itr->second].m_sRxFrames = sAddFrameRefs(ouEcuFrames);
+        }
+
+        CompiledDb::ImageHeader sHeader;
+        memset(&sHeader, 0, sizeof(sHeader));
+        sHeader.m_unSignature = CompiledDb::IMAGE_SIGNATURE;
+        sHeader.m_unVersion = CompiledDb::IMAGE_VERSION;
+        sHeader.m_unBusType = eBusType;
+        sHeader.m_un64SourceSize = ouIdentity.m_un64Size;
+        sHeader.m_un64SourceDigest = ouIdentity.m_un64Digest;
+
+        std::string strValue;
+        pouCluster->GetName(strValue);
+        sHeader.m_unClusterName = unAddString(strValue);
+        strValue.clear();
+        pouCluster->GetDBFileChecksum(strValue);
+        sHeader.m_unDbChecksum = unAddString(strValue);
+
+        abyImage.assign(sizeof(sHeader), 0);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_ECU, m_asEcus);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_FRAME, m_asFrames);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_SIGNAL_INSTANCE, m_asInstances);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_SIGNAL, m_asSignals);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_CODING, m_asCodings);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_COMPU_ENTRY, m_asEntries);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_VALUE_DESC, m_asDescs);
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_INDEX, m_aunIndices);
+        std::vector<char> achStrings(m_strStrings.begin(), m_strStrings.end());
+        vAppendSection(abyImage, sHeader, CompiledDb::SECTION_STRING, achStrings);
+
+        sHeader.m_unImageSize = abyImage.size();
+        memcpy(&abyImage[0], &sHeader, sizeof(sHeader));
+        return true;
+    }
+
+private:
+    template <typename T>
+    void vAppendSection(std::vector<BYTE>& abyImage, CompiledDb::ImageHeader& sHeader, CompiledDb::eImageSection eSection, const std::vector<T>& asRecords)
+    {
+        //Keep every section 8 byte aligned for in place access
+        abyImage.resize((abyImage.size() + 7) & ~7, 0);
+        sHeader.m_asSections[eSection].m_unOffset = abyImage.size();
+        sHeader.m_asSections[eSection].m_unCount = asRecords.size();
+        if ( false == asRecords.empty() )
+        {
+            const BYTE* pbyData = (const BYTE*)&asRecords[0];
+            abyImage.insert(abyImage.end(), pbyData, pbyData + asRecords.size() * sizeof(T));
+        }
+    }
+
+    unsigned int unAddString(const std::string& strValue)
+    {
+        if ( strValue.empty() )
+        {
+            return 0;
+        }
+        auto itr = m_ouStringOffsets.find(strValue);
+        if ( m_ouStringOffsets.end() != itr )
+        {
+            return itr->second;
+        }
+        unsigned int unOffset = m_strStrings.size();
+        m_strStrings.append(strValue.c_str(), strValue.size() + 1);
+        m_ouStringOffsets[strValue] = unOffset;
+        return unOffset;
+    }
+
+    CompiledDb::IndexRange sAddEcuRefs(std::list<IEcu*>& ouEcus)
+    {
+        std::vector<unsigned int> aunEcus;
+        for ( auto itr = ouEcus.begin(); itr != ouEcus.end(); ++itr )
+        {
+            if ( nullptr != *itr )
+            {
+                aunEcus.push_back(unAddEcu(*itr));
+            }
+        }
+        //unAddEcu does not touch the index section, so the range is contiguous
+        CompiledDb::IndexRange sRange;
+        sRange.m_unFirst = m_aunIndices.size();
+        sRange.m_unCount = aunEcus.size();
+        m_aunIndices.insert(m_aunIndices.end(), aunEcus.begin(), aunEcus.end());
+        return sRange;
+    }
+
+    CompiledDb::IndexRange sAddFrameRefs(std::list<IFrame*>& ouFrames)
+    {
+        CompiledDb::IndexRange sRange;
+        sRange.m_unFirst = m_aunIndices.size();
+        sRange.m_unCount = 0;
+        for ( auto itr = ouFrames.begin(); itr != ouFrames.end(); ++itr )
+        {
+            auto itrIndex = m_ouFrameIndex.find(*itr);
+            if ( m_ouFrameIndex.end() != itrIndex )
+            {
+                m_aunIndices.push_back(itrIndex->second);
+                sRange.m_unCount++;
+            }
+        }
+        return sRange;
+    }
+
+    unsigned int unAddEcu(IEcu* pouEcu)
+    {
+        auto itr = m_ouEcuIndex.find(pouEcu);
+        if ( m_ouEcuIndex.end() != itr )
+        {
+            return itr->second;
+        }
+        CompiledDb::EcuRecord sRecord;
+        memset(&sRecord, 0, sizeof(sRecord));
+        std::string strName;
+        pouEcu->GetName(strName);
+        sRecord.m_unName = unAddString(strName);
+
+        unsigned int unIndex = m_asEcus.size();
+        m_asEcus.push_back(sRecord);
+        m_ouEcuIndex[pouEcu] = unIndex;
+        return unIndex;
+    }
+
+    unsigned int unAddCoding(ICoding* pouCoding)
+    {
+        auto itr = m_ouCodingIndex.find(pouCoding);
+        if ( m_ouCodingIndex.end() != itr )
+        {
+            return itr->second;
+        }
+        CompiledDb::CodingRecord sRecord;
+        memset(&sRecord, 0, sizeof(sRecord));
+        std::string strName;
+        pouCoding->GetName(strName);
+        sRecord.m_unName = unAddString(strName);
+
+        CANCompuMethods ouCompu;
+        ouCompu.m_CompuMethod.m_eCompuType = IDENTICAL_ENUM;
+        ouCompu.m_CompuMethod.m_ouLinearCode.m_sRange.m_dwLowerLimit = 0;
+        ouCompu.m_CompuMethod.m_ouLinearCode.m_sRange.m_dwUpperLimit = 0;
+        ouCompu.m_CompuMethod.m_ouLinearCode.m_dN0 = 0;
+        ouCompu.m_CompuMethod.m_ouLinearCode.m_dN1 = 1;
+        ouCompu.m_CompuMethod.m_ouLinearCode.m_dD0 = 1;
+        pouCoding->GetProperties(ouCompu);
+        const CCompuMethod& ouMethod = ouCompu.m_CompuMethod;
+        sRecord.m_unCompuType = ouMethod.m_eCompuType;
+
+        sRecord.m_unFirstEntry = m_asEntries.size();
+        vAddLinearEntry(CompiledDb::ENTRY_LINEAR, ouMethod.m_ouLinearCode);
+        for ( auto itrCode = ouMethod.m_ouCompuScaleLinear.begin(); itrCode != ouMethod.m_ouCompuScaleLinear.end(); ++itrCode )
+        {
+            vAddLinearEntry(CompiledDb::ENTRY_SCALE_LINEAR, *itrCode);
+        }
+        for ( auto itrCode = ouMethod.m_ouTextCode.begin(); itrCode != ouMethod.m_ouTextCode.end(); ++itrCode )
+        {
+            CompiledDb::CompuEntryRecord sEntry = sCreateEntry(CompiledDb::ENTRY_TEXT, itrCode->m_sRange);
+            sEntry.m_unAux = unAddString(itrCode->m_aTextName);
+            m_asEntries.push_back(sEntry);
+        }
+        for ( auto itrCode = ouMethod.m_ouTabCode.begin(); itrCode != ouMethod.m_ouTabCode.end(); ++itrCode )
+        {
+            CompiledDb::CompuEntryRecord sEntry = sCreateEntry(CompiledDb::ENTRY_TAB, itrCode->m_sRange);
+            sEntry.m_dN0 = itrCode->m_dPhysVal;
+            m_asEntries.push_back(sEntry);
+        }
+        for ( auto itrCode = ouMethod.m_ouIdenticalCode.begin(); itrCode != ouMethod.m_ouIdenticalCode.end(); ++itrCode )
+        {
+            CompiledDb::CompuEntryRecord sEntry = sCreateEntry(CompiledDb::ENTRY_IDENTICAL, itrCode->m_sRange);
+            sEntry.m_unAux = itrCode->m_eValidity;
+            m_asEntries.push_back(sEntry);
+        }
+        sRecord.m_unEntryCount = m_asEntries.size() - sRecord.m_unFirstEntry;
+
+        std::map<int, std::string> ouDescs;
+        pouCoding->GetValueDescriptions(ouDescs);
+        sRecord.m_unFirstDesc = m_asDescs.size();
+        for ( auto itrDesc = ouDescs.begin(); itrDesc != ouDescs.end(); ++itrDesc )
+        {
+            CompiledDb::ValueDescRecord sDesc;
+            sDesc.m_nValue = itrDesc->first;
+            sDesc.m_unText = unAddString(itrDesc->second);
+            m_asDescs.push_back(sDesc);
+        }
+        sRecord.m_unDescCount = ouDescs.size();
+
+        unsigned int unIndex = m_asCodings.size();
+        m_asCodings.push_back(sRecord);
+        m_ouCodingIndex[pouCoding] = unIndex;
+        return unIndex;
+    }
+
+    CompiledDb::CompuEntryRecord sCreateEntry(CompiledDb::eCompuEntryType eType, const ValueRange& sRange)
+    {
+        CompiledDb::CompuEntryRecord sEntry;
+        memset(&sEntry, 0, sizeof(sEntry));
+        sEntry.m_unEntryType = eType;
+        sEntry.m_un64Lower = sRange.m_dwLowerLimit;
+        sEntry.m_un64Upper = sRange.m_dwUpperLimit;
+        return sEntry;
+    }
+
+    void vAddLinearEntry(CompiledDb::eCompuEntryType eType, const CompuLinearCode& sCode)
+    {
+        CompiledDb::CompuEntryRecord sEntry = sCreateEntry(eType, sCode.m_sRange);
+        sEntry.m_dN0 = sCode.m_dN0;
+        sEntry.m_dN1 = sCode.m_dN1;
+        sEntry.m_dD0 = sCode.m_dD0;
+        m_asEntries.push_back(sEntry);
+    }
+
+    unsigned int unAddSignal(ISignal* pouSignal)
+    {
+        auto itr = m_ouSignalIndex.find(pouSignal);
+        if ( m_ouSignalIndex.end() != itr )
+        {
+            return itr->second;
+        }
+        CompiledDb::SignalRecord sRecord;
+        memset(&sRecord, 0, sizeof(sRecord));
+
+        std::string strName;
+        pouSignal->GetName(strName);
+        sRecord.m_unName = unAddString(strName);
+
+        CANSignalProps ouProps;
+        ouProps.m_unSignalSize = 0;
+        ouProps.m_ouSignalType = eSignalNormal;
+        ouProps.m_ouDataType = eUnsigned;
+        ouProps.m_ouEndianess = eIntel;
+        ouProps.m_nIntialValue = 0;
+        ouProps.m_eMultiplex = eNA;
+        ouProps.m_nMuliplexedValue = 0;
+        pouSignal->GetProperties(ouProps);
+        unsigned int unLength = ouProps.m_unSignalSize;
+        pouSignal->GetLength(unLength);
+        std::string strUnit = ouProps.m_omUnit;
+        if ( strUnit.empty() )
+        {
+            pouSignal->GetUnit(strUnit);
+        }
+
+        sRecord.m_unUnit = unAddString(strUnit);
+        sRecord.m_unLength = unLength;
+        sRecord.m_unSignalType = ouProps.m_ouSignalType;
+        sRecord.m_unDataType = ouProps.m_ouDataType;
+        sRecord.m_unEndianess = ouProps.m_ouEndianess;
+        sRecord.m_unMultiplex = ouProps.m_eMultiplex;
+        sRecord.m_nMultiplexedValue = ouProps.m_nMuliplexedValue;
+        sRecord.m_un64InitialValue = ouProps.m_nIntialValue;
+        pouSignal->GetMinMaxValue(sRecord.m_un64MinValue, sRecord.m_un64MaxValue);
+
+        ICoding* pouCoding = nullptr;
+        pouSignal->GetEncoding(&pouCoding);
+        sRecord.m_unCoding = ( nullptr != pouCoding ) ? unAddCoding(pouCoding) : CompiledDb::INVALID_INDEX;
+
+        std::list<IEcu*> ouEcus;
+        pouSignal->GetEcus(eTx, ouEcus);
+        sRecord.m_sTxEcus = sAddEcuRefs(ouEcus);
+        ouEcus.clear();
+        pouSignal->GetEcus(eRx, ouEcus);
+        sRecord.m_sRxEcus = sAddEcuRefs(ouEcus);
+
+        unsigned int unIndex = m_asSignals.size();
+        m_asSignals.push_back(sRecord);
+        m_ouSignalIndex[pouSignal] = unIndex;
+        return unIndex;
+    }
+
+    unsigned int unAddFrame(IFrame* pouFrame)
+    {
+        auto itr = m_ouFrameIndex.find(pouFrame);
+        if ( m_ouFrameIndex.end() != itr )
+        {
+            return itr->second;
+        }
+        CompiledDb::FrameRecord sRecord;
+        memset(&sRecord, 0, sizeof(sRecord));
+
+        std::string strName;
+        pouFrame->GetName(strName);
+        sRecord.m_unName = unAddString(strName);
+        pouFrame->GetFrameId(sRecord.m_unFrameId);
+        pouFrame->GetLength(sRecord.m_unLength);
+
+        CANFrameProps ouProps;
+        ouProps.m_canMsgType = eCan_Standard;
+        pouFrame->GetProperties(ouProps);
+        sRecord.m_unMsgType = ouProps.m_canMsgType;
+
+        //Signals first, they may append their own ECU references
+        std::map<ISignal*, SignalInstanse> ouSignals;
+        pouFrame->GetSignalList(ouSignals);
+        std::vector<CompiledDb::SignalInstanceRecord> asInstances;
+        for ( auto itrSignal = ouSignals.begin(); itrSignal != ouSignals.end(); ++itrSignal )
+        {
+            CompiledDb::SignalInstanceRecord sInstance;
+            sInstance.m_unSignal = unAddSignal(itrSignal->first);
+            sInstance.m_nStartBit = itrSignal->second.m_nStartBit;
+            sInstance.m_unEndianess = itrSignal->second.m_ouSignalEndianess;
+            sInstance.m_nUpdateBitPos = itrSignal->second.m_nUpdateBitPos;
+            asInstances.push_back(sInstance);
+        }
+        //Interpretation order follows the layout of the frame
+        std::stable_sort(asInstances.begin(), asInstances.end(),
+                         [](const CompiledDb::SignalInstanceRecord & sLeft, const CompiledDb::SignalInstanceRecord & sRight)
+        {
+            return sLeft.m_nStartBit < sRight.m_nStartBit;
+        });
+        sRecord.m_unFirstInstance = m_asInstances.size();
+        sRecord.m_unInstanceCount = asInstances.size();
+        m_asInstances.insert(m_asInstances.end(), asInstances.begin(), asInstances.end());
+
+        std::list<IEcu*> ouEcus;
+        pouFrame->GetEcus(eTx, ouEcus);
+        sRecord.m_sTxEcus = sAddEcuRefs(ouEcus);
+        ouEcus.clear();
+        pouFrame->GetEcus(eRx, ouEcus);
+        sRecord.m_sRxEcus = sAddEcuRefs(ouEcus);
+
+        unsigned int unIndex = m_asFrames.size();
+        m_asFrames.push_back(sRecord);
+        m_ouFrameIndex[pouFrame] = unIndex;
+        return unIndex;
+    }
+};
+
+//Pseudo random payloads checked per frame, besides all bits clear, all set and alternating
+const int VERIFY_RANDOM_PAYLOADS = 8;
+
+bool bSameSignalValues(const std::vector<SignalValue>& ouParsed, const std::vector<SignalValue>& ouCompiled)
+{
+    if ( ouParsed.size() != ouCompiled.size() )
+    {
+        return false;
+    }
+    std::map<std::string, const SignalValue*> ouCompiledByName;
+    for ( auto itr = ouCompiled.begin(); itr != ouCompiled.end(); ++itr )
+    {
+        if ( false == ouCompiledByName.insert(std::make_pair(itr->mName, &(*itr))).second )
+        {
+            return false;
+        }
+    }
+    for ( auto itr = ouParsed.begin(); itr != ouParsed.end(); ++itr )
+    {
+        auto itrCompiled = ouCompiledByName.find(itr->mName);
+        if ( ouCompiledByName.end() == itrCompiled )
+        {
+            return false;
+        }
+        const SignalValue& ouValue = *itrCompiled->second;
+        double dTolerance = 1e-9 * max(1.0, fabs(itr->mPhyicalValue));
+        if ( itr->mIsSigned != ouValue.mIsSigned || itr->mUnValue != ouValue.mUnValue
+                || itr->mUnit != ouValue.mUnit || fabs(itr->mPhyicalValue - ouValue.mPhyicalValue) > dTolerance )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool bSameSignalTexts(const std::list<InterpreteSignals>& ouParsed, const std::list<InterpreteSignals>& ouCompiled)
+{
+    if ( ouParsed.size() != ouCompiled.size() )
+    {
+        return false;
+    }
+    std::map<std::string, const InterpreteSignals*> ouCompiledByName;
+    for ( auto itr = ouCompiled.begin(); itr != ouCompiled.end(); ++itr )
+    {
+        if ( false == ouCompiledByName.insert(std::make_pair(itr->m_omSigName, &(*itr))).second )
+        {
+            return false;
+        }
+    }
+    for ( auto itr = ouParsed.begin(); itr != ouParsed.end(); ++itr )
+    {
+        auto itrCompiled = ouCompiledByName.find(itr->m_omSigName);
+        if ( ouCompiledByName.end() == itrCompiled || itr->m_omRawValue != itrCompiled->second->m_omRawValue
+                || itr->m_omEnggValue != itrCompiled->second->m_omEnggValue || itr->m_omUnit != itrCompiled->second->m_omUnit )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Checks that a compiled cluster decodes like the parsed cluster it was built from.
+   Every frame is interpreted by both for the same payloads, which also select
+   different multiplexed signals. Values, signedness, physical values and the
+   display texts (decimal and hex) have to match. */
+bool bDecodesAlike(ICluster* pouParsed, ICluster* pouCompiled)
+{
+    std::list<IFrame*> ouFrames;
+    pouParsed->GetFrameList(ouFrames);
+    std::vector<unsigned char> abyPayload;
+    for ( auto itr = ouFrames.begin(); itr != ouFrames.end(); ++itr )
+    {
+        unsigned int unId = 0, unLength = 0;
+        (*itr)->GetFrameId(unId);
+        (*itr)->GetLength(unLength);
+        IFrame* pouCompiledFrame = nullptr;
+        if ( EC_SUCCESS != pouCompiled->GetFrame(unId, nullptr, &pouCompiledFrame) || nullptr == pouCompiledFrame )
+        {
+            return false;
+        }
+        if ( 0 == unLength )
+        {
+            continue;
+        }
+
+        abyPayload.resize(unLength);
+        unsigned int unSeed = unId ^ 0x9E3779B9;
+        for ( int nPayload = 0; nPayload < 4 + VERIFY_RANDOM_PAYLOADS; nPayload++ )
+        {
+            for ( unsigned int i = 0; i < unLength; i++ )
+            {
+                switch ( nPayload )
+                {
+                    case 0:
+                        abyPayload[i] = 0x00;
+                        break;
+                    case 1:
+                        abyPayload[i] = 0xFF;
+                        break;
+                    case 2:
+                        abyPayload[i] = 0x55;
+                        break;
+                    case 3:
+                        abyPayload[i] = 0xAA;
+                        break;
+                    default:
+                        unSeed = unSeed * 1664525 + 1013904223;
+                        abyPayload[i] = (unsigned char)( unSeed >> 24 );
+                        break;
+                }
+            }
+
+            std::vector<SignalValue> ouParsedValues, ouCompiledValues;
+            (*itr)->InterpretSignals(&abyPayload[0], unLength, ouParsedValues);
+            pouCompiledFrame->InterpretSignals(&abyPayload[0], unLength, ouCompiledValues);
+            if ( false == bSameSignalValues(ouParsedValues, ouCompiledValues) )
+            {
+                return false;
+            }
+            for ( int nHex = 0; nHex < 2; nHex++ )
+            {
+                std::list<InterpreteSignals> ouParsedTexts, ouCompiledTexts;
+                (*itr)->InterpretSignals(&abyPayload[0], unLength, ouParsedTexts, ( 1 == nHex ), true);
+                pouCompiledFrame->InterpretSignals(&abyPayload[0], unLength, ouCompiledTexts, ( 1 == nHex ), true);
+                if ( false == bSameSignalTexts(ouParsedTexts, ouCompiledTexts) )
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+}
+
+CompiledDbCache::CompiledDbCache()
+{
+    char acPath[MAX_PATH];
+    if ( SUCCEEDED(SHGetFolderPath(nullptr, CSIDL_LOCAL_APPDATA, nullptr, SHGFP_TYPE_CURRENT, acPath)) )
+    {
+        std::string strFolder = acPath;
+        strFolder += "\\BUSMASTER";
+        CreateDirectory(strFolder.c_str(), nullptr);
+        strFolder = acPath;
+        strFolder += DB_CACHE_FOLDER;
+        if ( CreateDirectory(strFolder.c_str(), nullptr) || ERROR_ALREADY_EXISTS == GetLastError() )
+        {
+            m_strCacheFolder = strFolder;
+        }
+    }
+}
+
+bool CompiledDbCache::isCacheAvailable()
+{
+    return ( false == m_strCacheFolder.empty() );
+}
+
+bool CompiledDbCache::isBusSupported(ETYPE_BUS eBusType)
+{
+    return ( CAN == eBusType );
+}
+
+std::string CompiledDbCache::strGetImagePath(const std::string& strDbPath)
+{
+    std::string strKey = strDbPath;
+    std::transform(strKey.begin(), strKey.end(), strKey.begin(), ::tolower);
+    std::replace(strKey.begin(), strKey.end(), '/', '\\');
+
+    char acName[32];
+    sprintf_s(acName, sizeof(acName), "%016I64x", un64Fnv1a((const BYTE*)strKey.c_str(), strKey.size()));
+    return m_strCacheFolder + "\\" + acName + DB_CACHE_EXTENSION;
+}
+
+ERRORCODE CompiledDbCache::GetSourceIdentity(const std::string& strDbPath, DbSourceIdentity& ouIdentity)
+{
+    MappedFile ouFile;
+    if ( false == ouFile.bOpen(strDbPath) )
+    {
+        return EC_FILE_NOT_FOUND;
+    }
+    ouIdentity.m_un64Size = ouFile.un64GetSize();
+    ouIdentity.m_un64Digest = un64Fnv1a(ouFile.pbyGetView(), ( nullptr != ouFile.pbyGetView() ) ? ouFile.un64GetSize() : 0);
+    return EC_SUCCESS;
+}
+
+ERRORCODE CompiledDbCache::LoadCluster(const std::string& strDbPath, ETYPE_BUS eBusType, const DbSourceIdentity& ouIdentity, ICluster** ppouCluster)
+{
+    if ( nullptr == ppouCluster || false == isCacheAvailable() || false == isBusSupported(eBusType) )
+    {
+        return EC_FAILURE;
+    }
+    *ppouCluster = nullptr;
+
+    MappedFile ouImage;
+    if ( false == ouImage.bOpen(strGetImagePath(strDbPath)) || ouImage.un64GetSize() < sizeof(CompiledDb::ImageHeader) )
+    {
+        return EC_FILE_NOT_FOUND;
+    }
+    const CompiledDb::ImageHeader* psHeader = (const CompiledDb::ImageHeader*)ouImage.pbyGetView();
+    if ( CompiledDb::IMAGE_SIGNATURE != psHeader->m_unSignature || CompiledDb::IMAGE_VERSION != psHeader->m_unVersion
+            || (unsigned int)eBusType != psHeader->m_unBusType || psHeader->m_unImageSize != ouImage.un64GetSize()
+            || ouIdentity.m_un64Size != psHeader->m_un64SourceSize || ouIdentity.m_un64Digest != psHeader->m_un64SourceDigest )
+    {
+        return EC_FILE_INVALID;
+    }
+
+    CompiledCluster* pouCluster = nullptr;
+    ERRORCODE eResult = CompiledCluster::Create(ouImage.pbyGetView(), psHeader->m_unImageSize, strDbPath, &pouCluster);
+    if ( EC_SUCCESS == eResult )
+    {
+        *ppouCluster = pouCluster;
+    }
+    return eResult;
+}
+
+ERRORCODE CompiledDbCache::StoreCluster(const std::string& strDbPath, ETYPE_BUS eBusType, const DbSourceIdentity& ouIdentity, ICluster* pouCluster)
+{
+    if ( nullptr == pouCluster || false == isCacheAvailable() || false == isBusSupported(eBusType) )
+    {
+        return EC_FAILURE;
+    }
+
+    std::vector<BYTE> abyImage;
+    CompiledDbWriter ouWriter;
+    if ( false == ouWriter.bCompile(pouCluster, eBusType, ouIdentity, abyImage) )
+    {
+        return EC_FAILURE;
+    }
+
+    //An image that decodes any frame differently from the parser is never stored
+    CompiledCluster* pouCompiled = nullptr;
+    if ( EC_SUCCESS != CompiledCluster::Create(&abyImage[0], abyImage.size(), strDbPath, &pouCompiled) )
+    {
+        return EC_FAILURE;
+    }
+    bool bAlike = bDecodesAlike(pouCluster, pouCompiled);
+    delete pouCompiled;
+    if ( false == bAlike )
+    {
+        return EC_FILE_INVALID;
+    }
+
+    //Write to a temporary file first so that a reader never sees a partial image
+    std::string strImagePath = strGetImagePath(strDbPath);
+    char acSuffix[32];
+    sprintf_s(acSuffix, sizeof(acSuffix), ".%u.tmp", GetCurrentThreadId());
+    std::string strTempPath = strImagePath + acSuffix;
+
+    HANDLE hFile = CreateFile(strTempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if ( INVALID_HANDLE_VALUE == hFile )
+    {
+        return EC_FAILURE;
+    }
+    DWORD dwWritten = 0;
+    BOOL bWritten = WriteFile(hFile, &abyImage[0], abyImage.size(), &dwWritten, nullptr);
+    CloseHandle(hFile);
+
+    if ( FALSE == bWritten || dwWritten != abyImage.size()
+            || FALSE == MoveFileEx(strTempPath.c_str(), strImagePath.c_str(), MOVEFILE_REPLACE_EXISTING) )
+    {
+        DeleteFile(strTempPath.c_str());
+        return EC_FAILURE;
+    }
+    return EC_SUCCESS;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Windows.h>
+#include <string>
+#include "../ProtocolDefinitions/ICluster.h"
+
+/* Identity of a database file, the compiled image is valid only for the
+   exact content it was built from. */
+class DbSourceIdentity
+{
+public:
+    unsigned __int64 m_un64Size;
+    unsigned __int64 m_un64Digest;      //FNV-1a over the file content
+    DbSourceIdentity()
+    {
+        m_un64Size = 0;
+        m_un64Digest = 0;
+    }
+};
+
+/* On-disk cache of compiled database images.
+   Images are stored as <cache folder>\<path hash>.bmdc, one per database file.
+   A lookup succeeds only when the image was built from a file with the same
+   size and content digest; otherwise the caller parses the database and
+   stores a fresh image. All methods are safe to call from multiple threads. */
+class CompiledDbCache
+{
+    std::string m_strCacheFolder;
+public:
+    CompiledDbCache();
+
+    bool isCacheAvailable();
+
+    ERRORCODE GetSourceIdentity(const std::string& strDbPath, DbSourceIdentity& ouIdentity);
+
+    /* Returns EC_SUCCESS and a new cluster (owned by the caller) if a matching image exists. */
+    ERRORCODE LoadCluster(const std::string& strDbPath, ETYPE_BUS eBusType, const DbSourceIdentity& ouIdentity, ICluster** ppouCluster);
+
+    /* Compiles the parsed cluster into an image and stores it in the cache.
+       Returns EC_FILE_INVALID without storing if the image does not decode
+       every frame like the parsed cluster. */
+    ERRORCODE StoreCluster(const std::string& strDbPath, ETYPE_BUS eBusType, const DbSourceIdentity& ouIdentity, ICluster* pouCluster);
+
+    /* Compiled images are supported for CAN databases only. */
+    static bool isBusSupported(ETYPE_BUS eBusType);
+
+private:
+    std::string strGetImagePath(const std::string& strDbPath);
+};
@@ -0,0 +1,138 @@
+#pragma once
+
+/* Layout of a compiled database image (*.bmdc).
+   The image is a header followed by sections of fixed size records, so that a
+   mapped view of the file can be read in place without any tokenizing.
+   Strings are stored once in the string section and referred by offset, offset 0
+   is always the empty string. All element references are section indices. */
+
+namespace CompiledDb
+{
+const unsigned int IMAGE_SIGNATURE  = 0x43444D42;       // "BMDC"
+const unsigned int IMAGE_VERSION    = 1;
+const unsigned int INVALID_INDEX    = 0xFFFFFFFF;
+
+enum eImageSection
+{
+    SECTION_ECU = 0,
+    SECTION_FRAME,
+    SECTION_SIGNAL_INSTANCE,
+    SECTION_SIGNAL,
+    SECTION_CODING,
+    SECTION_COMPU_ENTRY,
+    SECTION_VALUE_DESC,
+    SECTION_INDEX,              //unsigned int lists used by ECU/Frame/Signal references
+    SECTION_STRING,
+    SECTION_TOTAL
+};
+
+enum eCompuEntryType
+{
+    ENTRY_LINEAR = 0,
+    ENTRY_SCALE_LINEAR,
+    ENTRY_TEXT,
+    ENTRY_TAB,
+    ENTRY_IDENTICAL
+};
+
+#pragma pack(push, 4)
+
+struct SectionInfo
+{
+    unsigned int m_unOffset;    //From start of image
+    unsigned int m_unCount;     //Number of records (bytes for SECTION_STRING)
+};
+
+struct IndexRange
+{
+    unsigned int m_unFirst;     //First entry in SECTION_INDEX
+    unsigned int m_unCount;
+};
+
+struct ImageHeader
+{
+    unsigned int m_unSignature;
+    unsigned int m_unVersion;
+    unsigned int m_unBusType;
+    unsigned int m_unImageSize;
+    unsigned __int64 m_un64SourceSize;
+    unsigned __int64 m_un64SourceDigest;
+    unsigned int m_unClusterName;
+    unsigned int m_unDbChecksum;    //Checksum reported by the database parser
+    SectionInfo m_asSections[SECTION_TOTAL];
+};
+
+struct EcuRecord
+{
+    unsigned int m_unName;
+    IndexRange m_sTxFrames;
+    IndexRange m_sRxFrames;
+};
+
+struct FrameRecord
+{
+    unsigned int m_unName;
+    unsigned int m_unFrameId;
+    unsigned int m_unLength;
+    unsigned int m_unMsgType;       //eCANMsgType
+    unsigned int m_unFirstInstance; //SECTION_SIGNAL_INSTANCE
+    unsigned int m_unInstanceCount;
+    IndexRange m_sTxEcus;
+    IndexRange m_sRxEcus;
+};
+
+struct SignalInstanceRecord
+{
+    unsigned int m_unSignal;
+    int m_nStartBit;
+    unsigned int m_unEndianess;
+    int m_nUpdateBitPos;
+};
+
+struct SignalRecord
+{
+    unsigned int m_unName;
+    unsigned int m_unUnit;
+    unsigned int m_unLength;
+    unsigned int m_unSignalType;
+    unsigned int m_unDataType;
+    unsigned int m_unEndianess;
+    unsigned int m_unMultiplex;
+    int m_nMultiplexedValue;
+    unsigned __int64 m_un64InitialValue;
+    unsigned __int64 m_un64MinValue;
+    unsigned __int64 m_un64MaxValue;
+    unsigned int m_unCoding;        //INVALID_INDEX if the signal has no coding
+    IndexRange m_sTxEcus;
+    IndexRange m_sRxEcus;
+};
+
+struct CodingRecord
+{
+    unsigned int m_unName;
+    unsigned int m_unCompuType;     //eCompuType
+    unsigned int m_unFirstEntry;    //SECTION_COMPU_ENTRY
+    unsigned int m_unEntryCount;
+    unsigned int m_unFirstDesc;     //SECTION_VALUE_DESC
+    unsigned int m_unDescCount;
+};
+
+struct CompuEntryRecord
+{
+    unsigned int m_unEntryType;     //eCompuEntryType
+    unsigned int m_unAux;           //Text offset or Validity
+    unsigned __int64 m_un64Lower;
+    unsigned __int64 m_un64Upper;
+    double m_dN0;                   //Physical value for ENTRY_TAB
+    double m_dN1;
+    double m_dD0;
+};
+
+struct ValueDescRecord
+{
+    int m_nValue;
+    unsigned int m_unText;
+};
+
+#pragma pack(pop)
+}
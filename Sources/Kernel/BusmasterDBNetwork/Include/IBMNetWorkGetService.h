@@ -123,6 +123,8 @@ public:
     unsigned char m_listIDs[8];
     int m_nId;
     bool m_bEnabled;
+    std::list<int> m_ouFrameIds;                    //Associated frames of a sporadic or event triggered slot
+    std::string m_strCollisionTable;                //Collision resolving table of an event triggered slot
     CScheduleCommands()
     {
         m_bEnabled = false;
@@ -1,6 +1,25 @@
 #pragma once
 #include "../../ProtocolDefinitions/ICluster.h"
 #include "IBMNetWorkGetService.h"
+
+/* Timing of a PreloadDbFiles call */
+class DbLoadReport
+{
+public:
+    unsigned int m_unFromCache;
+    unsigned int m_unParsed;
+    unsigned int m_unFailed;
+    double m_dTotalTimeMs;
+    std::list< std::pair<std::string, double> > m_ouFileTimesMs;
+    DbLoadReport()
+    {
+        m_unFromCache = 0;
+        m_unParsed = 0;
+        m_unFailed = 0;
+        m_dTotalTimeMs = 0;
+    }
+};
+
 class IBMNetWorkService : public IBMNetWorkGetService
 {
 public:
@@ -10,6 +29,9 @@ public:
     virtual ERRORCODE DeleteDBService( ETYPE_BUS eouProtocol, int nChannelIndex, std::string dbPath ) = 0;
     virtual ERRORCODE AddDBService( ETYPE_BUS eouProtocol, int nChannelIndex, ICluster* ) = 0;
     virtual ERRORCODE LoadDb( ETYPE_BUS eouProtocol, int nChannelIndex, std::string ) = 0;
+    /* Loads the databases in parallel (compiled cache first, parser otherwise).
+       The results are picked up by the following LoadDb calls for the same paths. */
+    virtual ERRORCODE PreloadDbFiles( ETYPE_BUS eouProtocol, std::list<std::string>& ouDbFilePaths, DbLoadReport& ouReport ) = 0;
     virtual ERRORCODE SetChannelCount( ETYPE_BUS eouProtocol, int nCount ) = 0;
     virtual ERRORCODE ParseDbFile( std::string strFileName, ETYPE_BUS clusterType, std::list<ICluster*>& ) = 0;
     virtual ERRORCODE SetSimulatedEcuList( ETYPE_BUS, int nChannelIndex, std::list<IEcu*>& ) = 0;
@@ -639,6 +639,37 @@ HRESULT CDIL_CAN::DILC_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMsg)
     return m_pBaseDILCAN_Controller->CAN_SendMsg(dwClientID, sCanTxMsg);
 }
 
+/**
+ * \brief     Send several messages
+ *
+ * Hands all messages to the driver in one call. Drivers without a batched
+ * transmit path send them one after the other.
+ */
+HRESULT CDIL_CAN::DILC_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults)
+{
+    if ((nullptr == psCanTxMsgs) && (unCount > 0))
+    {
+        return E_POINTER;
+    }
+    return m_pBaseDILCAN_Controller->CAN_SendMsgs(dwClientID, psCanTxMsgs, unCount, phResults);
+}
+
+/**
+ * \brief     Read several received messages
+ *
+ * Empties up to unMaxCount entries of a client buffer under one lock.
+ */
+HRESULT CDIL_CAN::DILC_ReadMsgs(CBaseCANBufFSE* pBufObj, STCANDATA* psCanData, UINT unMaxCount, UINT& unRead)
+{
+    unRead = 0;
+    if ((nullptr == pBufObj) || (nullptr == psCanData))
+    {
+        return E_POINTER;
+    }
+    unRead = (UINT)pBufObj->nReadMultiple(psCanData, (int)unMaxCount);
+    return (unRead > 0) ? S_OK : S_FALSE;
+}
+
 
 
 
@@ -668,6 +699,27 @@ HRESULT CDIL_CAN::DILC_GetCntrlStatus(const HANDLE& hEvent, UINT& unCntrlStatus)
     return m_pBaseDILCAN_Controller->CAN_GetCntrlStatus(hEvent, unCntrlStatus);
 }
 
+/**
+ * \brief     Set the reorder hold time
+ *
+ * Sets the longest time the driver holds received messages back to merge
+ * its channels into timestamp order.
+ */
+HRESULT CDIL_CAN::DILC_SetReorderHoldTime(UINT unHoldTimeMs)
+{
+    return m_pBaseDILCAN_Controller->CAN_SetReorderHoldTime(unHoldTimeMs);
+}
+
+/**
+ * \brief     Get reorder statistics
+ *
+ * Gets the reorder depth and late arrival counters of the driver.
+ */
+HRESULT CDIL_CAN::DILC_GetReorderStats(SREORDER_STATS& sStats)
+{
+    return m_pBaseDILCAN_Controller->CAN_GetReorderStats(sStats);
+}
+
 /**
  * \brief     Get controller parameters
  * \req       RSI_14_022 - DILC_GetControllerParams
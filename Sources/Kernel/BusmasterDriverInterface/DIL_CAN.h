@@ -159,6 +159,8 @@ public:
      * Send messages
      */
     HRESULT DILC_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMsg);
+    HRESULT DILC_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults);
+    HRESULT DILC_ReadMsgs(CBaseCANBufFSE* pBufObj, STCANDATA* psCanData, UINT unMaxCount, UINT& unRead);
 
     /**
      * Call to get descriptive string of the last error occurred
@@ -177,6 +179,12 @@ public:
      */
     HRESULT DILC_GetCntrlStatus(const HANDLE& hEvent, UINT& unCntrlStatus);
 
+    /**
+     * Receive reorder stage of the driver
+     */
+    HRESULT DILC_SetReorderHoldTime(UINT unHoldTimeMs);
+    HRESULT DILC_GetReorderStats(SREORDER_STATS& sStats);
+
     /**
      * Call to get Controller parameters. Value will be returned stored in lParam
      * Possible values for ECONTR_PARAM are ...
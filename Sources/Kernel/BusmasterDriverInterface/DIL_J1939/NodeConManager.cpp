@@ -63,7 +63,40 @@
 #include "TransferLayer.h"
 #include "../../../BUSMASTER/Utility/MultiLanguageSupport.h"
 #include "../Include/J1939DriverDefines.h"
+#include "../Include/J1939MsgPool.h"
+#include "../Include/Error.h"
 #include "../../ProtocolDefinitions/ProtocolsDefinitions.h"
+#include <new>
+
+/******************************************************************************
+Function Name  :  pouGetMsgPool
+Input(s)       :
+Output         :  Pool of the messages written into the clients buffers
+Functionality  :  Creates the pool on first use. It is shared by all the nodes
+                  and never freed, as client buffers may hold its blocks after
+                  the DIL is released; it lives on the process heap so it
+                  outlives this module.
+Member of      :
+Friend of      :  -
+******************************************************************************/
+static CJ1939MsgPool* pouGetMsgPool(void)
+{
+    static CJ1939MsgPool* volatile s_pouMsgPool = nullptr;
+    if (nullptr == s_pouMsgPool)
+    {
+        void* pvPool = HeapAlloc(GetProcessHeap(), 0, sizeof(CJ1939MsgPool));
+        if (nullptr == pvPool)
+        {
+            return nullptr;
+        }
+        CJ1939MsgPool* pouPool = new (pvPool) CJ1939MsgPool;
+        if (nullptr != InterlockedCompareExchangePointer((PVOID volatile*)&s_pouMsgPool, pouPool, nullptr))
+        {
+            HeapFree(GetProcessHeap(), 0, pvPool); // Created by another thread
+        }
+    }
+    return s_pouMsgPool;
+}
 
 /******************************************************************************
 Function Name  :  TP_RxMsgThreadProc
@@ -163,9 +196,11 @@ DWORD WINAPI TransmitMsgThreadProc(LPVOID pVoid)
                 {
                     int nType = 0, nSize = MAX_MSG_LEN_J1939;
                     int nResult = psNodeConMgr->m_ouMsgBufVSE.ReadFromBuffer(nType, psNodeConMgr->m_abyData, nSize);
+                    //Sent from the read data, m_abyData is not touched until the next read
                     STJ1939_MSG sJ1939Msg;
-                    sJ1939Msg.vSetDataStream(psNodeConMgr->m_abyData);
+                    sJ1939Msg.vAttachDataStream(psNodeConMgr->m_abyData);
                     psNodeConMgr->vTransmitMessage(&sJ1939Msg);
+                    sJ1939Msg.vDetachDataStream();
                 }
             }
             break;
@@ -728,13 +763,31 @@ void CNodeConManager::WriteIntoClientsBuffer(STJ1939_MSG& sJ1939Msg)
           sJ1939Msg.m_sMsgProperties.m_eDirection,
           m_byNodeAddress);
 
-    static BYTE abyData[MAX_MSG_LEN_J1939] = {0xFF};
-    for (int i = 0; i < m_OutBufArr.GetSize(); i++)
+    // Rendered once into a pool block, the clients get the block pointer
+    // and hold a reference each.
+    INT nClients = (INT)m_OutBufArr.GetSize();
+    CJ1939MsgPool* pouPool = pouGetMsgPool();
+    if ((0 == nClients) || (nullptr == pouPool))
+    {
+        return;
+    }
+    sJ1939POOLMSG* psPoolMsg = pouPool->psAlloc(sJ1939Msg.unGetSize());
+    if (nullptr == psPoolMsg)
+    {
+        return;
+    }
+    sJ1939Msg.vGetDataStream(psPoolMsg->m_abyStream);
+    CJ1939MsgPool::vAddRef(psPoolMsg, nClients);
+    for (int i = 0; i < nClients; i++)
     {
         CBaseMsgBufVSE* podCurrBuf = m_OutBufArr.GetAt(i);
-        sJ1939Msg.vGetDataStream(abyData);
-        podCurrBuf->WriteIntoBuffer( ETYPE_BUS::J1939, abyData, sJ1939Msg.unGetSize() );
+        int nResult = podCurrBuf->WriteIntoBuffer( ETYPE_BUS::J1939, (BYTE*)&psPoolMsg, sizeof(psPoolMsg) );
+        if ((CALL_SUCCESS != nResult) && (WARN_BUFFER_OVERRUN != nResult))
+        {
+            CJ1939MsgPool::vRelease(psPoolMsg);
+        }
     }
+    CJ1939MsgPool::vRelease(psPoolMsg);
 }
 /******************************************************************************
 Function Name  :  byGetSrcAddress
@@ -691,3 +691,14 @@ HRESULT CDIL_LIN::DIIL_DeRegisterLinHeader(DWORD& dwClientId, int& nChannel, int
     VALIDATE_LIN_POINTER(m_pBaseDILLIN_Controller);
     return m_pBaseDILLIN_Controller->LIN_DeRegisterLinHeader( dwClientId, nChannel, nId);
 }
+
+/**
+ * \brief     Get schedule statistics
+ *
+ * Gets the slot start error counters of the master schedule of a channel.
+ */
+HRESULT CDIL_LIN::DILL_GetScheduleStats(int nChannel, SLIN_SCHEDULE_STATS& sStats)
+{
+    VALIDATE_LIN_POINTER(m_pBaseDILLIN_Controller);
+    return m_pBaseDILLIN_Controller->LIN_GetScheduleStats(nChannel, sStats);
+}
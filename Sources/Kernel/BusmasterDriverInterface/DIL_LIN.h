@@ -216,6 +216,9 @@ public:
     HRESULT DIIL_RegisterLinHeader( DWORD& dwClientId, int& nChannel, int nId, int nCycleTimer);
     HRESULT DIIL_DeRegisterLinHeader( DWORD& dwClientId, int& nChannel, int nId);
 
+    //Master schedule timing
+    HRESULT DILL_GetScheduleStats(int nChannel, SLIN_SCHEDULE_STATS& sStats);
+
 
 
 private:
@@ -145,6 +145,20 @@ public:
      */
     virtual HRESULT DILC_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMsg) = 0;
 
+    /**
+     * Send unCount messages in one call. phResults, if not nullptr, receives
+     * the result of every message. Returns S_OK if all were sent, else the
+     * first failure.
+     */
+    virtual HRESULT DILC_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults) = 0;
+
+    /**
+     * Read up to unMaxCount received messages from pBufObj, a buffer registered
+     * with DILC_ManageMsgBuf, in one call. unRead receives the number read.
+     * Returns S_FALSE if the buffer was empty.
+     */
+    virtual HRESULT DILC_ReadMsgs(CBaseCANBufFSE* pBufObj, STCANDATA* psCanData, UINT unMaxCount, UINT& unRead) = 0;
+
     /**
     * Call to get descriptive string of the last error occurred
      */
@@ -159,6 +173,18 @@ public:
      */
     virtual HRESULT DILC_GetCntrlStatus(const HANDLE& hEvent, UINT& unCntrlStatus) = 0;
 
+    /**
+     * Call to set the longest time received messages are held back to put
+     * the channels into timestamp order, 0 turns the reordering off.
+     */
+    virtual HRESULT DILC_SetReorderHoldTime(UINT unHoldTimeMs) = 0;
+
+    /**
+     * Call to get the reorder depth and late arrival counters of the driver.
+     * Returns WARN_DUMMY_API if the driver does not reorder.
+     */
+    virtual HRESULT DILC_GetReorderStats(SREORDER_STATS& sStats) = 0;
+
     /**
      * Call to get Controller parameters. Value will be returned stored in lParam
      * Possible values for ECONTR_PARAM are ...
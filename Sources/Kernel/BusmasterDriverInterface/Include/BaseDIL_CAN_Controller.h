@@ -116,6 +116,32 @@ public:
      */
     virtual HRESULT CAN_SendMsg(DWORD dwClientID, const STCAN_MSG& sCanTxMsg) = 0;
 
+    /**
+     * Sends unCount STCAN_MSG structures from the client dwClientID.
+     * phResults, if not nullptr, receives the result of every frame.
+     * Drivers that can hand several frames to the hardware at once
+     * override this, the others send frame by frame.
+     *
+     * @return S_OK if all frames were sent, else the first failure
+     */
+    virtual HRESULT CAN_SendMsgs(DWORD dwClientID, const STCAN_MSG* psCanTxMsgs, UINT unCount, HRESULT* phResults)
+    {
+        HRESULT hResult = S_OK;
+        for (UINT i = 0; i < unCount; i++)
+        {
+            HRESULT hFrameResult = CAN_SendMsg(dwClientID, psCanTxMsgs[i]);
+            if (nullptr != phResults)
+            {
+                phResults[i] = hFrameResult;
+            }
+            if ((S_OK == hResult) && (S_OK != hFrameResult))
+            {
+                hResult = hFrameResult;
+            }
+        }
+        return hResult;
+    }
+
     /**
      * Gets last occured error and puts inside acErrorStr.
      */
@@ -165,6 +191,28 @@ public:
      */
     virtual HRESULT CAN_GetCntrlStatus(const HANDLE& hEvent, UINT& unCntrlStatus) = 0;
 
+    /**
+     * Sets the longest time received frames are held back to merge the
+     * channels into timestamp order. 0 passes them on as they are read.
+     * Drivers without a reorder stage keep the default.
+     *
+     * @return S_OK for success, WARN_DUMMY_API if the driver does not reorder
+     */
+    virtual HRESULT CAN_SetReorderHoldTime(UINT /*unHoldTimeMs*/)
+    {
+        return WARN_DUMMY_API;
+    }
+
+    /**
+     * Gets the reorder depth and late arrival counters of the receive path.
+     *
+     * @return S_OK for success, WARN_DUMMY_API if the driver does not reorder
+     */
+    virtual HRESULT CAN_GetReorderStats(SREORDER_STATS& /*sStats*/)
+    {
+        return WARN_DUMMY_API;
+    }
+
     /**
      * Loads BOA related libraries. Updates BOA API pointers
      *
@@ -87,7 +87,10 @@ public:
     1. bAction - When MSGBUF_ADD, adds pBufObj to the target message buffer list.
                 Removes when MSGBUF_CLEAR.
     2. ClientID - Client ID
-    3. pBufObj - Interface to message buffer object.
+    3. pBufObj - Interface to message buffer object. Each entry is a
+                sJ1939POOLMSG pointer (J1939MsgPool.h) holding one reference,
+                the reader releases it and sets CJ1939MsgPool::vReleaseEntry
+                as the drop handler of the buffer.
 
 
     Return value:
@@ -227,6 +227,13 @@ public:
     //Individual commands.
     virtual HRESULT DIIL_RegisterLinHeader(DWORD& dwClientId, int& nChannel, int nId, int nCycleTimer) = 0;
     virtual HRESULT DIIL_DeRegisterLinHeader(DWORD& dwClientId, int& nChannel, int nId) = 0;
+
+    /**
+     * Call to get the slot count and slot start error of the master schedule
+     * of nChannel (0 based). Returns WARN_DUMMY_API if the driver does not
+     * run the schedule itself.
+     */
+    virtual HRESULT DILL_GetScheduleStats(int nChannel, SLIN_SCHEDULE_STATS& sStats) = 0;
 };
 
 #endif // BASEDIL_LIN_H__INCLUDED_
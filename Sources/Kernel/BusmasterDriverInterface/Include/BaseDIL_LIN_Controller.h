@@ -25,6 +25,7 @@
 
 #include "LINDriverDefines.h"
 #include "../../BusmasterDBNetwork/Include/IBMNetWorkGetService.h"
+#include "Error.h"
 class CBaseDIL_LIN_Controller
 {
 public:
@@ -68,4 +69,15 @@ public:
     //Individual Header commands.
     virtual HRESULT LIN_RegisterLinHeader( DWORD& dwClientId, int& nChannel, int nId, int nCycleTimer ) = 0;
     virtual HRESULT LIN_DeRegisterLinHeader( DWORD& dwClientId, int& nChannel, int nId) = 0;
+
+    /**
+     * Gets the slot timing counters of the master schedule of nChannel
+     * (0 based).
+     *
+     * @return S_OK for success, WARN_DUMMY_API if the driver has no schedule
+     */
+    virtual HRESULT LIN_GetScheduleStats(int /*nChannel*/, SLIN_SCHEDULE_STATS& /*sStats*/)
+    {
+        return WARN_DUMMY_API;
+    }
 };
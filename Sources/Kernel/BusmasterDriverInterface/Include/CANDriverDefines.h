@@ -3,6 +3,7 @@
 #include "DeviceListInfo.h"
 #include <windows.h>
 #include "../../Utilities\BaseMsgBufAll.h"
+#include "../../Utilities\ReorderStage.h"
 #include "DILPluginHelperDefs.h"
 
 
@@ -260,12 +260,14 @@ typedef struct tagSTJ1939_MSG
                                                    Channel, Type, Direction) */
     UINT                    m_unDLC;            // Data length. 0 <= m_unDLC <= 1785 bytes.
     BYTE*                   m_pbyData;          // J1939 message data.
+    bool                    m_bAttached;        // m_pbyData points into a stream not owned by the message
 
     tagSTJ1939_MSG()
     {
         memset( &m_sMsgProperties, 0, sizeof( STJ1939_MSG_PROPERTIES ) );
         m_unDLC = 0;
         m_pbyData = nullptr;
+        m_bAttached = false;
     }
 
     /* Destructor */
@@ -273,11 +275,17 @@ typedef struct tagSTJ1939_MSG
     {
         memset( &m_sMsgProperties, 0, sizeof( STJ1939_MSG_PROPERTIES ) );
         m_unDLC = 0;
-        if ( nullptr != m_pbyData )
+        vReleaseData();
+    }
+    /* Frees the data if the message owns it. */
+    void vReleaseData( void )
+    {
+        if ( ( nullptr != m_pbyData ) && ( false == m_bAttached ) )
         {
             delete[] m_pbyData;
-            m_pbyData = nullptr;
         }
+        m_pbyData = nullptr;
+        m_bAttached = false;
     }
     UINT unGetSize( void ) const
     {
@@ -296,22 +304,38 @@ typedef struct tagSTJ1939_MSG
         COPY_DATA_INC_SOURCE( &m_sMsgProperties, pbyData, sizeof( STJ1939_MSG_PROPERTIES ) );
         UINT unTempDLC = 0;
         COPY_DATA_INC_SOURCE( &unTempDLC, pbyData, sizeof( UINT ) );
-        if (/*unTempDLC > m_unDLC*/ m_pbyData == nullptr )
+        if (/*unTempDLC > m_unDLC*/ m_pbyData == nullptr || m_bAttached )
         {
             //DELETE_ARRAY(m_pbyData);
             m_pbyData = new BYTE[MAX_DATA_LEN_J1939];
+            m_bAttached = false;
         }
         m_unDLC = unTempDLC;
         COPY_DATA_INC_SOURCE( m_pbyData, pbyData, ( sizeof( BYTE ) * m_unDLC ) );
     }
+    /* Points the message at a BYTE stream rendered by vGetDataStream. The data is
+       not copied and not owned, the stream shall outlive the message or be given
+       back with vDetachDataStream. Data owned before is freed. */
+    void vAttachDataStream( BYTE* pbyData )
+    {
+        vReleaseData();
+        COPY_DATA_INC_SOURCE( &m_sMsgProperties, pbyData, sizeof( STJ1939_MSG_PROPERTIES ) );
+        COPY_DATA_INC_SOURCE( &m_unDLC, pbyData, sizeof( UINT ) );
+        m_pbyData = pbyData;
+        m_bAttached = true;
+    }
+    /* Releases the stream given to vAttachDataStream. */
+    void vDetachDataStream( void )
+    {
+        m_unDLC = 0;
+        m_pbyData = nullptr;
+        m_bAttached = false;
+    }
     void vInitialize( int nSize )
     {
-        if ( m_unDLC < (UINT)nSize )
+        if ( ( m_unDLC < (UINT)nSize ) || m_bAttached )
         {
-            if ( nullptr != m_pbyData )
-            {
-                delete[] m_pbyData;
-            }
+            vReleaseData();
             m_pbyData = new BYTE[nSize];
         }
         m_unDLC = nSize;
@@ -320,9 +344,9 @@ typedef struct tagSTJ1939_MSG
     tagSTJ1939_MSG& operator=( const tagSTJ1939_MSG& RefObj )
     {
         m_sMsgProperties = RefObj.m_sMsgProperties;
-        if ( m_unDLC < RefObj.m_unDLC )
+        if ( ( m_unDLC < RefObj.m_unDLC ) || m_bAttached )
         {
-            delete[] m_pbyData;
+            vReleaseData();
             m_pbyData = new BYTE[RefObj.m_unDLC];
         }
         memcpy( m_pbyData, RefObj.m_pbyData, RefObj.m_unDLC );
@@ -334,11 +358,7 @@ typedef struct tagSTJ1939_MSG
     {
         m_sMsgProperties.m_eType = MSG_TYPE_NONE;
         m_unDLC = 0;
-        if ( nullptr != m_pbyData )
-        {
-            delete[] m_pbyData;
-            m_pbyData = nullptr;
-        }
+        vReleaseData();
     }
 
 } STJ1939_MSG, *PSTJ1939_MSG;
@@ -0,0 +1,162 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      J1939MsgPool.h
+ * \brief     Reference counted J1939 messages shared by the DIL clients
+ * \copyright Copyright (c) 2011, Robert Bosch Engineering and Business Solutions. All rights reserved.
+ *
+ * The J1939 DIL renders every message once into a pool block and writes only
+ * the block pointer into the buffer of each client. Every client entry holds
+ * one reference, the last release gives the block back to its pool. The
+ * blocks come from the process heap and the functions are inline, so a
+ * client in any module can release a block published by the DIL.
+ */
+
+#pragma once
+
+#include <windows.h>
+#include <stddef.h>
+#include "J1939DriverDefines.h"
+
+#define defJ1939_POOL_SMALL_LEN     64      //Stream bytes of a small block, single frames fit
+#define defJ1939_POOL_CACHED        512     //Free blocks kept per size
+
+class CJ1939MsgPool;
+
+/* J1939 message as rendered by STJ1939_MSG::vGetDataStream. The stream is not
+   changed after the block is published, readers attach to it read only. */
+typedef struct DECLSPEC_ALIGN(MEMORY_ALLOCATION_ALIGNMENT) tagJ1939POOLMSG
+{
+    SLIST_ENTRY     m_sLink;            //Free list link
+    CJ1939MsgPool*  m_pouPool;          //Pool the block returns to
+    volatile LONG   m_lRefCount;        //One per client buffer entry
+    UINT            m_unCapacity;       //Stream bytes allocated
+    UINT            m_unSize;           //Stream bytes used
+    BYTE            m_abyStream[1];
+} sJ1939POOLMSG;
+
+class CJ1939MsgPool
+{
+    SLIST_HEADER m_sSmallFree;
+    SLIST_HEADER m_sLargeFree;
+    volatile LONG m_lAllocated;         //Blocks taken from the heap and not freed
+
+    void vFree(sJ1939POOLMSG* psMsg)
+    {
+        SLIST_HEADER* psFree = (defJ1939_POOL_SMALL_LEN == psMsg->m_unCapacity) ? &m_sSmallFree : &m_sLargeFree;
+        if (QueryDepthSList(psFree) < defJ1939_POOL_CACHED)
+        {
+            InterlockedPushEntrySList(psFree, &psMsg->m_sLink);
+        }
+        else
+        {
+            InterlockedDecrement(&m_lAllocated);
+            HeapFree(GetProcessHeap(), 0, psMsg);
+        }
+    }
+
+public:
+    CJ1939MsgPool()
+    {
+        InitializeSListHead(&m_sSmallFree);
+        InitializeSListHead(&m_sLargeFree);
+        m_lAllocated = 0;
+    }
+
+    /* Frees the cached blocks, the pool shall outlive the blocks in use */
+    ~CJ1939MsgPool()
+    {
+        SLIST_ENTRY* psEntry = nullptr;
+        while ((psEntry = InterlockedPopEntrySList(&m_sSmallFree)) != nullptr)
+        {
+            HeapFree(GetProcessHeap(), 0, psEntry);
+        }
+        while ((psEntry = InterlockedPopEntrySList(&m_sLargeFree)) != nullptr)
+        {
+            HeapFree(GetProcessHeap(), 0, psEntry);
+        }
+    }
+
+    /* Block for unSize stream bytes holding one reference. nullptr if the heap
+       is exhausted. */
+    sJ1939POOLMSG* psAlloc(UINT unSize)
+    {
+        bool bSmall = (unSize <= defJ1939_POOL_SMALL_LEN);
+        sJ1939POOLMSG* psMsg = (sJ1939POOLMSG*)InterlockedPopEntrySList(bSmall ? &m_sSmallFree : &m_sLargeFree);
+        if (nullptr == psMsg)
+        {
+            UINT unCapacity = bSmall ? defJ1939_POOL_SMALL_LEN : MAX_MSG_LEN_J1939;
+            psMsg = (sJ1939POOLMSG*)HeapAlloc(GetProcessHeap(), 0, offsetof(sJ1939POOLMSG, m_abyStream) + unCapacity);
+            if (nullptr == psMsg)
+            {
+                return nullptr;
+            }
+            psMsg->m_pouPool = this;
+            psMsg->m_unCapacity = unCapacity;
+            InterlockedIncrement(&m_lAllocated);
+        }
+        psMsg->m_lRefCount = 1;
+        psMsg->m_unSize = unSize;
+        return psMsg;
+    }
+
+    /* Blocks in use or cached */
+    LONG lGetAllocated(void) const
+    {
+        return m_lAllocated;
+    }
+
+    /* Blocks referenced by a client, approximate while messages flow */
+    LONG lGetInUse(void)
+    {
+        return m_lAllocated - QueryDepthSList(&m_sSmallFree) - QueryDepthSList(&m_sLargeFree);
+    }
+
+    static void vAddRef(sJ1939POOLMSG* psMsg, LONG lCount)
+    {
+        InterlockedExchangeAdd(&psMsg->m_lRefCount, lCount);
+    }
+
+    static void vRelease(sJ1939POOLMSG* psMsg)
+    {
+        if (0 == InterlockedDecrement(&psMsg->m_lRefCount))
+        {
+            psMsg->m_pouPool->vFree(psMsg);
+        }
+    }
+
+    /* Drop handler of the client buffers, releases the entries dropped on
+       overrun or clear. */
+    static void vReleaseEntry(INT /*nType*/, BYTE* pbyEntry, INT nSize)
+    {
+        if (sizeof(sJ1939POOLMSG*) == nSize)
+        {
+            sJ1939POOLMSG* psMsg = nullptr;
+            memcpy(&psMsg, pbyEntry, sizeof(psMsg));
+            vRelease(psMsg);
+        }
+    }
+
+    /* Reads the next block of a client buffer, the caller releases it. */
+    template <typename MsgBuf>
+    static HRESULT hReadFromBuffer(MsgBuf& ouBuf, sJ1939POOLMSG*& psMsg)
+    {
+        INT nType = 0;
+        INT nSize = sizeof(psMsg);
+        psMsg = nullptr;
+        return ouBuf.ReadFromBuffer(nType, (BYTE*)&psMsg, nSize);
+    }
+};
@@ -153,6 +153,26 @@ public:
 };
 typedef SCONTROLLER_DETAILS_LIN* PSCONTROLLER_DETAILS_LIN;
 
+/**
+* Timing of the master schedule of one channel. The start error of a slot is
+* the time between its due time and the moment its header was handed to the
+* hardware.
+*/
+#define defLIN_SLOT_LATE_US     500     // Start error from which a slot counts as late
+
+struct SLIN_SCHEDULE_STATS
+{
+    UINT64 m_un64Slots;             // Slots executed
+    UINT64 m_un64LateSlots;         // Slots started more than defLIN_SLOT_LATE_US late
+    UINT64 m_un64SkippedSlots;      // Slots left silent because they were over before they could start
+    UINT m_unMaxErrorUs;            // Largest start error
+    UINT m_unMeanErrorUs;           // Mean start error
+    UINT m_unLastErrorUs;
+    UINT m_unTableSwitches;
+    UINT m_unCollisions;            // Event triggered collisions that started the resolving table
+    int m_nCurrentTable;            // Handle of the running table, -1 if none
+};
+
 /**
 * This structure is used for communicating between Driver and LIN Application
 */
@@ -23,6 +23,7 @@ BusMasterKernel::BusMasterKernel()
 {
     mDIL_GetInterface = nullptr;
     mBmNetworkService = new BMNetwork();
+    mClockService = new CClockService();
     loadDilInterface();
 }
 
@@ -46,6 +47,11 @@ HRESULT BusMasterKernel::getDatabaseService( IBMNetWorkService** dbService )
     *dbService = mBmNetworkService;
     return S_FALSE;
 }
+HRESULT BusMasterKernel::getClockService( IClockService** clockService )
+{
+    *clockService = mClockService;
+    return S_OK;
+}
 bool BusMasterKernel::loadDilInterface()
 {
     bool result = true;
@@ -130,3 +136,13 @@ KERNEL_USAGEMODE HRESULT DIL_GetInterface( ETYPE_BUS eBusType, void** ppvInterfa
     return S_FALSE;
 }
 
+KERNEL_USAGEMODE HRESULT CLOCK_GetInterface( IClockService** ppouClock )
+{
+    IBusMasterKernel* kernel;
+    getBusmasterKernel( &kernel );
+    if ( nullptr != kernel )
+    {
+        return kernel->getClockService( ppouClock );
+    }
+    return S_FALSE;
+}
@@ -3,17 +3,20 @@
 #include "IBusMasterKernel.h"
 #include "../BusmasterDriverInterface/Include/BusmasterDriverInterface.h"
 #include "../BusmasterDBNetwork/Include/IBMNetWorkService.h"
+#include "ClockService.h"
 class BusMasterKernel : public IBusMasterKernel
 {
     pDIL_GetInterface mDIL_GetInterface;
     HMODULE mDriverLibrary;
     static BusMasterKernel* mKernel;
     IBMNetWorkService* mBmNetworkService;
+    CClockService* mClockService;
 public:
     BusMasterKernel();
     virtual ~BusMasterKernel();
     HRESULT getBusService( ETYPE_BUS busType, IBusService** busService );
     HRESULT getDatabaseService( IBMNetWorkService** dbService );
+    HRESULT getClockService( IClockService** clockService );
     static BusMasterKernel* create();
 private:
     bool loadDilInterface();
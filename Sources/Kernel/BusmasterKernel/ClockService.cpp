@@ -0,0 +1,391 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      ClockService.cpp
+ * \brief     Implementation of the CClockService class.
+ */
+
+#include "stdafx.h"
+#include <limits.h>
+#include <mmsystem.h>
+#include "ClockService.h"
+
+#define defCLOCK_NEVER              _UI64_MAX
+#define defWAIT_MODE_CHANGED        (WAIT_OBJECT_0 + 2)     // The wait has to go on in the other mode
+
+CClockService::CClockService(void)
+{
+    InitializeCriticalSection(&m_omCritSec);
+    QueryPerformanceFrequency(&m_liFrequency);
+    m_n64Offset = 0;
+    m_bVirtual = false;
+    m_un64VirtualTime = 0;
+    m_unSettleMs = defCLOCK_VIRTUAL_SETTLE_MS;
+    m_lWaiting = 0;
+    m_lHolds = 0;
+    m_lGeneration = 0;
+    m_hStateEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    m_hStopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    m_hVirtualEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    m_hStepThread = nullptr;
+}
+
+CClockService::~CClockService(void)
+{
+    hSetVirtual(false, 0);
+    CloseHandle(m_hStateEvent);
+    CloseHandle(m_hStopEvent);
+    CloseHandle(m_hVirtualEvent);
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+/**
+ * \brief  Performance counter in microseconds
+ */
+UINT64 CClockService::un64GetCounterTime(void)
+{
+    LARGE_INTEGER liCounter;
+    QueryPerformanceCounter(&liCounter);
+    UINT64 un64Seconds = liCounter.QuadPart / m_liFrequency.QuadPart;
+    UINT64 un64Rest = liCounter.QuadPart % m_liFrequency.QuadPart;
+    return (un64Seconds * 1000000) + ((un64Rest * 1000000) / m_liFrequency.QuadPart);
+}
+
+UINT64 CClockService::un64GetTime(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    UINT64 un64Time = m_bVirtual ? m_un64VirtualTime : (UINT64)(un64GetCounterTime() + m_n64Offset);
+    LeaveCriticalSection(&m_omCritSec);
+    return un64Time;
+}
+
+bool CClockService::bIsVirtual(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    bool bVirtual = m_bVirtual;
+    LeaveCriticalSection(&m_omCritSec);
+    return bVirtual;
+}
+
+/**
+ * \brief     Switches between real and virtual time
+ * \param[in] bVirtual true for virtual time
+ * \param[in] unSettleMs Real milliseconds waited before each virtual step
+ * \return    S_OK, E_FAIL if the step thread can not be started
+ *
+ * Virtual time starts at the current real time. When it is switched off, the
+ * real time goes on from the virtual time reached and the virtual waits go on
+ * as real waits.
+ */
+HRESULT CClockService::hSetVirtual(bool bVirtual, UINT unSettleMs)
+{
+    HRESULT hResult = S_OK;
+    HANDLE hStepThread = nullptr;
+
+    EnterCriticalSection(&m_omCritSec);
+    m_unSettleMs = unSettleMs;
+    if (bVirtual && !m_bVirtual)
+    {
+        m_un64VirtualTime = un64GetCounterTime() + m_n64Offset;
+        m_bVirtual = true;
+        ResetEvent(m_hStopEvent);
+        m_hStepThread = CreateThread(nullptr, 0, dwStepThreadProc, this, 0, nullptr);
+        if (nullptr == m_hStepThread)
+        {
+            m_bVirtual = false;
+            hResult = E_FAIL;
+        }
+        else
+        {
+            SetEvent(m_hVirtualEvent);
+        }
+        vStateChanged();
+    }
+    else if (!bVirtual && m_bVirtual)
+    {
+        m_n64Offset = (INT64)(m_un64VirtualTime - un64GetCounterTime());
+        m_bVirtual = false;
+        ResetEvent(m_hVirtualEvent);
+        vReleaseAll();
+        hStepThread = m_hStepThread;
+        m_hStepThread = nullptr;
+    }
+    LeaveCriticalSection(&m_omCritSec);
+
+    if (nullptr != hStepThread)
+    {
+        SetEvent(m_hStopEvent);
+        WaitForSingleObject(hStepThread, INFINITE);
+        CloseHandle(hStepThread);
+    }
+    return hResult;
+}
+
+DWORD CClockService::dwWaitUntil(HANDLE hEvent, UINT64 un64Due)
+{
+    DWORD dwResult = defWAIT_MODE_CHANGED;
+    while (defWAIT_MODE_CHANGED == dwResult)
+    {
+        dwResult = bIsVirtual() ? dwWaitVirtual(hEvent, un64Due) : dwWaitReal(hEvent, un64Due);
+    }
+    return dwResult;
+}
+
+DWORD CClockService::dwWait(HANDLE hEvent, DWORD dwMilliseconds)
+{
+    UINT64 un64Due = defCLOCK_NEVER;
+    if (INFINITE != dwMilliseconds)
+    {
+        un64Due = un64GetTime() + ((UINT64)dwMilliseconds * 1000);
+    }
+    return dwWaitUntil(hEvent, un64Due);
+}
+
+/**
+ * \brief Attaches the calling thread, its virtual waits count for the steps
+ */
+void CClockService::vAttach(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_omAttached[GetCurrentThreadId()]++;
+    vStateChanged();
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+void CClockService::vDetach(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    CClockThreads::iterator itThread = m_omAttached.find(GetCurrentThreadId());
+    if ( (itThread != m_omAttached.end()) && (0 == --itThread->second) )
+    {
+        m_omAttached.erase(itThread);
+    }
+    vStateChanged();
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+void CClockService::vHold(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_lHolds++;
+    vStateChanged();
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+void CClockService::vRelease(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_lHolds--;
+    vStateChanged();
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+/**
+ * \brief Wakes the step thread, call with the lock held
+ */
+void CClockService::vStateChanged(void)
+{
+    m_lGeneration++;
+    SetEvent(m_hStateEvent);
+}
+
+/**
+ * \brief Every attached thread waits and nothing holds the clock, call with the lock held
+ */
+bool CClockService::bCanStep(void)
+{
+    return m_bVirtual && (0 == m_lHolds) && (m_lWaiting >= (LONG)m_omAttached.size()) &&
+           !m_omWaiters.empty() && (m_omWaiters.begin()->first != defCLOCK_NEVER);
+}
+
+/**
+ * \brief Moves the virtual time to the earliest due time and ends the waits due then,
+ *        call with the lock held
+ */
+void CClockService::vStep(void)
+{
+    m_un64VirtualTime = max(m_un64VirtualTime, m_omWaiters.begin()->first);
+    while ( !m_omWaiters.empty() && (m_omWaiters.begin()->first <= m_un64VirtualTime) )
+    {
+        sCLOCK_WAITER* psWaiter = m_omWaiters.begin()->second;
+        m_omWaiters.erase(m_omWaiters.begin());
+        if (psWaiter->m_bAttached)
+        {
+            m_lWaiting--;
+        }
+        psWaiter->m_bReleased = true;
+        SetEvent(psWaiter->m_hWakeEvent);
+    }
+}
+
+/**
+ * \brief Ends all virtual waits when virtual time is switched off, call with the lock held
+ */
+void CClockService::vReleaseAll(void)
+{
+    for (CClockWaiters::iterator itWaiter = m_omWaiters.begin(); itWaiter != m_omWaiters.end(); ++itWaiter)
+    {
+        itWaiter->second->m_bReleased = true;
+        itWaiter->second->m_bModeChanged = true;
+        SetEvent(itWaiter->second->m_hWakeEvent);
+    }
+    m_lWaiting = 0;
+    m_omWaiters.clear();
+}
+
+/**
+ * \brief Blocks on hEvent and the due time, switching virtual time on ends the wait
+ */
+DWORD CClockService::dwWaitReal(HANDLE hEvent, UINT64 un64Due)
+{
+    //hEvent comes first so that it wins when both are signalled
+    HANDLE ahWait[2];
+    DWORD dwCount = 0;
+    if (nullptr != hEvent)
+    {
+        ahWait[dwCount++] = hEvent;
+    }
+    ahWait[dwCount++] = m_hVirtualEvent;
+    for (;;)
+    {
+        if (bIsVirtual())
+        {
+            return defWAIT_MODE_CHANGED;
+        }
+        DWORD dwTimeout = INFINITE;
+        if (defCLOCK_NEVER != un64Due)
+        {
+            UINT64 un64Now = un64GetTime();
+            if (un64Now >= un64Due)
+            {
+                return WAIT_TIMEOUT;
+            }
+            dwTimeout = (DWORD)((un64Due - un64Now + 999) / 1000);
+        }
+        DWORD dwResult = WaitForMultipleObjects(dwCount, ahWait, FALSE, dwTimeout);
+        if ( (nullptr != hEvent) && (WAIT_OBJECT_0 == dwResult) )
+        {
+            return WAIT_OBJECT_0;
+        }
+    }
+}
+
+/**
+ * \brief Queues the caller as waiter and blocks until the step thread or hEvent ends the wait
+ */
+DWORD CClockService::dwWaitVirtual(HANDLE hEvent, UINT64 un64Due)
+{
+    EnterCriticalSection(&m_omCritSec);
+    if (!m_bVirtual)
+    {
+        LeaveCriticalSection(&m_omCritSec);
+        return defWAIT_MODE_CHANGED;
+    }
+    if (un64Due <= m_un64VirtualTime)
+    {
+        LeaveCriticalSection(&m_omCritSec);
+        if ( (nullptr != hEvent) && (WaitForSingleObject(hEvent, 0) == WAIT_OBJECT_0) )
+        {
+            return WAIT_OBJECT_0;
+        }
+        return WAIT_TIMEOUT;
+    }
+
+    sCLOCK_WAITER sWaiter;
+    sWaiter.m_hWakeEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    sWaiter.m_bReleased = false;
+    sWaiter.m_bModeChanged = false;
+    sWaiter.m_bAttached = (m_omAttached.find(GetCurrentThreadId()) != m_omAttached.end());
+    CClockWaiters::iterator itWaiter = m_omWaiters.insert(std::make_pair(un64Due, &sWaiter));
+    if (sWaiter.m_bAttached)
+    {
+        m_lWaiting++;
+    }
+    vStateChanged();
+    LeaveCriticalSection(&m_omCritSec);
+
+    //hEvent comes first so that it wins when both are signalled
+    HANDLE ahWait[2];
+    DWORD dwCount = 0;
+    if (nullptr != hEvent)
+    {
+        ahWait[dwCount++] = hEvent;
+    }
+    ahWait[dwCount++] = sWaiter.m_hWakeEvent;
+    DWORD dwResult = WaitForMultipleObjects(dwCount, ahWait, FALSE, INFINITE);
+
+    EnterCriticalSection(&m_omCritSec);
+    if (!sWaiter.m_bReleased)
+    {
+        m_omWaiters.erase(itWaiter);
+        if (sWaiter.m_bAttached)
+        {
+            m_lWaiting--;
+        }
+        vStateChanged();
+    }
+    LeaveCriticalSection(&m_omCritSec);
+    CloseHandle(sWaiter.m_hWakeEvent);
+
+    if ( (nullptr != hEvent) && (WAIT_OBJECT_0 == dwResult) )
+    {
+        return WAIT_OBJECT_0;
+    }
+    return sWaiter.m_bModeChanged ? defWAIT_MODE_CHANGED : WAIT_TIMEOUT;
+}
+
+/**
+ * \brief Takes the virtual steps
+ *
+ * A step is only taken if nothing changed during the settle time, which gives
+ * frames sent at the current time the chance to reach their receivers.
+ */
+DWORD WINAPI CClockService::dwStepThreadProc(LPVOID pParam)
+{
+    CClockService* pouClock = (CClockService*)pParam;
+    HANDLE ahWait[2] = { pouClock->m_hStopEvent, pouClock->m_hStateEvent };
+    bool bStop = false;
+
+    timeBeginPeriod(1);
+    while ( !bStop && (WaitForMultipleObjects(2, ahWait, FALSE, INFINITE) == (WAIT_OBJECT_0 + 1)) )
+    {
+        for (;;)
+        {
+            EnterCriticalSection(&pouClock->m_omCritSec);
+            bool bStep = pouClock->bCanStep();
+            LONG lGeneration = pouClock->m_lGeneration;
+            UINT unSettleMs = pouClock->m_unSettleMs;
+            LeaveCriticalSection(&pouClock->m_omCritSec);
+            if (!bStep)
+            {
+                break;
+            }
+            if ( (unSettleMs > 0) && (WaitForSingleObject(pouClock->m_hStopEvent, unSettleMs) == WAIT_OBJECT_0) )
+            {
+                bStop = true;
+                break;
+            }
+            EnterCriticalSection(&pouClock->m_omCritSec);
+            if ( pouClock->bCanStep() && (lGeneration == pouClock->m_lGeneration) )
+            {
+                pouClock->vStep();
+            }
+            LeaveCriticalSection(&pouClock->m_omCritSec);
+        }
+    }
+    timeEndPeriod(1);
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      ClockService.h
+ * \brief     Definition of the CClockService class.
+ */
+
+#pragma once
+
+#include <map>
+#include "IClockService.h"
+
+/**
+ * Real and virtual time in one object, so that the schedulers keep their
+ * clock when the mode changes. Virtual steps are taken by a thread of the
+ * clock, which lives as long as virtual time is on.
+ */
+class CClockService : public IClockService
+{
+public:
+    CClockService(void);
+    virtual ~CClockService(void);
+
+    UINT64 un64GetTime(void);
+    bool bIsVirtual(void);
+    HRESULT hSetVirtual(bool bVirtual, UINT unSettleMs);
+    DWORD dwWaitUntil(HANDLE hEvent, UINT64 un64Due);
+    DWORD dwWait(HANDLE hEvent, DWORD dwMilliseconds);
+    void vAttach(void);
+    void vDetach(void);
+    void vHold(void);
+    void vRelease(void);
+
+private:
+    struct sCLOCK_WAITER
+    {
+        HANDLE m_hWakeEvent;
+        bool m_bReleased;       // Removed from the waiters by the clock
+        bool m_bModeChanged;    // Released because virtual time was switched off
+        bool m_bAttached;       // Counted in m_lWaiting
+    };
+    typedef std::multimap<UINT64, sCLOCK_WAITER*> CClockWaiters;
+    typedef std::map<DWORD, LONG> CClockThreads;
+
+    CRITICAL_SECTION m_omCritSec;
+    LARGE_INTEGER m_liFrequency;
+    INT64 m_n64Offset;          // Added to the counter time, keeps the time monotonic
+    bool m_bVirtual;
+    UINT64 m_un64VirtualTime;
+    UINT m_unSettleMs;
+    CClockThreads m_omAttached; // vAttach count by thread id
+    LONG m_lWaiting;            // Attached threads in a virtual wait
+    LONG m_lHolds;
+    LONG m_lGeneration;         // Changes whenever a virtual step may become possible or impossible
+    CClockWaiters m_omWaiters;
+    HANDLE m_hStateEvent;
+    HANDLE m_hStopEvent;
+    HANDLE m_hVirtualEvent;     // Set while virtual time is on, ends the real waits
+    HANDLE m_hStepThread;
+
+    UINT64 un64GetCounterTime(void);
+    void vStateChanged(void);
+    bool bCanStep(void);
+    void vStep(void);
+    void vReleaseAll(void);
+    DWORD dwWaitReal(HANDLE hEvent, UINT64 un64Due);
+    DWORD dwWaitVirtual(HANDLE hEvent, UINT64 un64Due);
+    static DWORD WINAPI dwStepThreadProc(LPVOID pParam);
+};
@@ -3,6 +3,7 @@
 #include "../ProtocolDefinitions/ProtocolsDefinitions.h"
 #include "../BusmasterDBNetwork/Include/IBMNetWorkService.h"
 #include "../BusmasterDriverInterface/Include/IBusService.h"
+#include "IClockService.h"
 
 class IBusMasterKernel
 {
@@ -10,6 +11,7 @@ public:
     virtual ~IBusMasterKernel() {};
     virtual HRESULT getBusService(ETYPE_BUS busType, IBusService** busService) = 0;
     virtual HRESULT getDatabaseService( IBMNetWorkService** dbService ) = 0;
+    virtual HRESULT getClockService( IClockService** clockService ) = 0;
 };
 
 
@@ -30,6 +32,7 @@ extern "C" {  // only need to export C interface if used by C++ source code
     KERNEL_USAGEMODE HRESULT getBusmasterKernel( IBusMasterKernel** );
     typedef HRESULT( *pGetBusmasterKernel )( IBusMasterKernel** );
     KERNEL_USAGEMODE HRESULT DIL_GetInterface( ETYPE_BUS eBusType, void** ppvInterface );
+    KERNEL_USAGEMODE HRESULT CLOCK_GetInterface( IClockService** ppouClock );
 #ifdef __cplusplus
 }
 #endif
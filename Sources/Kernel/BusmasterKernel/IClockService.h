@@ -0,0 +1,61 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      IClockService.h
+ * \brief     Interface of the clock the BUSMASTER schedulers run on.
+ */
+
+#pragma once
+
+#include <Windows.h>
+
+#define defCLOCK_VIRTUAL_SETTLE_MS  1       // Real time given to frames in flight before a virtual step
+
+/**
+ * Time in microseconds for the node simulation timers, the transmit window,
+ * replay and the test executor.
+ *
+ * In real time the waits end on the wall clock. In virtual time the clock stands
+ * still while an attached thread runs or a handler holds it. Once every attached
+ * thread waits, it jumps to the earliest due time and ends those waits, so idle
+ * time of a simulation costs nothing.
+ *
+ * A thread waiting on the clock must be attached for as long as it schedules on
+ * it, and detached before it blocks on anything else.
+ */
+class IClockService
+{
+public:
+    virtual ~IClockService() {};
+
+    //Current time, never runs back when the mode changes
+    virtual UINT64 un64GetTime(void) = 0;
+    virtual bool bIsVirtual(void) = 0;
+    //unSettleMs real milliseconds pass before each virtual step, 0 steps at once
+    virtual HRESULT hSetVirtual(bool bVirtual, UINT unSettleMs) = 0;
+
+    //Blocks until hEvent is signalled or the time reaches un64Due,
+    //returns WAIT_OBJECT_0 or WAIT_TIMEOUT like WaitForSingleObject. hEvent may be nullptr.
+    virtual DWORD dwWaitUntil(HANDLE hEvent, UINT64 un64Due) = 0;
+    //dwWaitUntil relative to the current time, INFINITE waits for hEvent only
+    virtual DWORD dwWait(HANDLE hEvent, DWORD dwMilliseconds) = 0;
+
+    virtual void vAttach(void) = 0;
+    virtual void vDetach(void) = 0;
+    //Keeps virtual time from advancing while work due at the current time runs
+    virtual void vHold(void) = 0;
+    virtual void vRelease(void) = 0;
+};
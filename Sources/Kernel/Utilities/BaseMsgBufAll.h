@@ -61,6 +61,13 @@ public:
 
     // To set the current queue length
     virtual int nSetBufferMsgSize(int nMsgDataSize)= 0;
+
+    // To read up to nMaxCount entries in one call. Returns the number read.
+    virtual int nReadMultiple(SMSGBUFFER* psMsgBuffers, int nMaxCount);
+
+    // To write nCount entries in one call. Returns the number written, the
+    // rest did not fit into the queue.
+    virtual int nWriteMultiple(SMSGBUFFER* psMsgBuffers, int nCount);
 };
 
 template <typename SMSGBUFFER> CBaseMsgBufFSE<SMSGBUFFER>::CBaseMsgBufFSE()
@@ -73,6 +80,29 @@ template <typename SMSGBUFFER> CBaseMsgBufFSE<SMSGBUFFER>::~CBaseMsgBufFSE()
     ;
 }
 
+/* Entry by entry, queues that can do better override these */
+template <typename SMSGBUFFER> int CBaseMsgBufFSE<SMSGBUFFER>::nReadMultiple(
+    SMSGBUFFER* psMsgBuffers, int nMaxCount)
+{
+    int nRead = 0;
+    while ((nRead < nMaxCount) && (ReadFromBuffer(&psMsgBuffers[nRead]) == CALL_SUCCESS))
+    {
+        nRead++;
+    }
+    return nRead;
+}
+
+template <typename SMSGBUFFER> int CBaseMsgBufFSE<SMSGBUFFER>::nWriteMultiple(
+    SMSGBUFFER* psMsgBuffers, int nCount)
+{
+    int nWritten = 0;
+    while ((nWritten < nCount) && (WriteIntoBuffer(&psMsgBuffers[nWritten]) == CALL_SUCCESS))
+    {
+        nWritten++;
+    }
+    return nWritten;
+}
+
 
 /* This is the interface class of a circular queue where each entry is of
 variable size. VSE stands for 'variable sized entry'. Therefore, function
@@ -0,0 +1,139 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      ClientDispatch.h
+ * \brief     Definition of the CClientDispatch template class.
+ *
+ * Definition of the CClientDispatch template class.
+ */
+
+#pragma once
+
+#include "TxEchoMap.h"
+
+#ifndef TX_FLAG
+#define TX_FLAG                 0x01
+#define RX_FLAG                 0x02
+#endif
+
+#define defDISPATCH_BATCH_SIZE      64      // Frames collected before the client buffers are written
+
+/**
+ * Fan-out of received frames from a driver to the buffers of its clients.
+ *
+ * The read thread adds frames with the sender found in the TX echo map and
+ * flushes once the driver queue is drained or the batch is full. Every client
+ * buffer is then written once per batch. The sender gets its echoes as TX_FLAG,
+ * the other clients as RX_FLAG; frames without a sender keep their type.
+ *
+ * SDATA is STCANDATA or STLINDATA, SCLIENT the client map entry of the driver
+ * with dwClientID, pClientBuf[] and unBufCount. Drivers with another client map
+ * call vWriteClient for every client and then vClearBatch. Only the read
+ * thread may use one object.
+ */
+template <typename SDATA>
+class CClientDispatch
+{
+public:
+    CClientDispatch(void) : m_unFrames(0), m_bHasSender(false) {}
+
+    //Adds a frame, dwSenderID is 0 if no client sent it
+    void vAddFrame(const SDATA& sData, DWORD dwSenderID)
+    {
+        m_asFrames[m_unFrames] = sData;
+        m_adwSenders[m_unFrames] = dwSenderID;
+        m_bHasSender |= (dwSenderID != 0);
+        m_unFrames++;
+    }
+
+    bool bIsFull(void) const
+    {
+        return (m_unFrames == defDISPATCH_BATCH_SIZE);
+    }
+
+    //Adds a frame and takes its sender from ouEchoMap. Flushes a full batch.
+    template <typename SCLIENT>
+    void vDispatch(const SDATA& sData, CTxEchoMap& ouEchoMap, UINT unChannel, UINT unMsgID,
+                   SCLIENT* psClients, UINT unClientCount)
+    {
+        UINT unSenderID = 0;
+        ouEchoMap.bRemoveEntry(unChannel, unMsgID, unSenderID);
+        vAddFrame(sData, unSenderID);
+        if (bIsFull())
+        {
+            vFlush(psClients, unClientCount);
+        }
+    }
+
+    //Writes the collected frames into the buffers of all clients
+    template <typename SCLIENT>
+    void vFlush(SCLIENT* psClients, UINT unClientCount)
+    {
+        if (m_unFrames == 0)
+        {
+            return;
+        }
+        for (UINT i = 0; i < unClientCount; i++)
+        {
+            vWriteClient(psClients[i].dwClientID, psClients[i].pClientBuf, psClients[i].unBufCount);
+        }
+        vClearBatch();
+    }
+
+    //Writes the collected frames into the buffers of one client
+    template <typename SBUFFER>
+    void vWriteClient(DWORD dwClientID, SBUFFER* const* ppouBuffers, UINT unBufCount)
+    {
+        if (m_unFrames == 0)
+        {
+            return;
+        }
+        SDATA* psFrames = m_asFrames;
+        if (m_bHasSender)
+        {
+            for (UINT k = 0; k < m_unFrames; k++)
+            {
+                m_asClientFrames[k] = m_asFrames[k];
+                if (m_adwSenders[k] == dwClientID)
+                {
+                    m_asClientFrames[k].m_ucDataType = TX_FLAG;
+                }
+                else if (m_adwSenders[k] != 0)
+                {
+                    m_asClientFrames[k].m_ucDataType = RX_FLAG;
+                }
+            }
+            psFrames = m_asClientFrames;
+        }
+        for (UINT j = 0; j < unBufCount; j++)
+        {
+            ppouBuffers[j]->nWriteMultiple(psFrames, (int)m_unFrames);
+        }
+    }
+
+    void vClearBatch(void)
+    {
+        m_unFrames = 0;
+        m_bHasSender = false;
+    }
+
+private:
+    SDATA m_asFrames[defDISPATCH_BATCH_SIZE];
+    SDATA m_asClientFrames[defDISPATCH_BATCH_SIZE];
+    DWORD m_adwSenders[defDISPATCH_BATCH_SIZE];
+    UINT m_unFrames;
+    bool m_bHasSender;
+};
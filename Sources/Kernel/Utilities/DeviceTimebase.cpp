@@ -0,0 +1,237 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      DeviceTimebase.cpp
+ * \brief     Source file for CDeviceTimebase class.
+ *
+ * Source file for CDeviceTimebase class.
+ */
+
+#include "DeviceTimebase.h"
+#include <math.h>
+
+#define defNS_PER_SEC               1000000000ULL
+
+CDeviceTimebase::CDeviceTimebase(void)
+{
+    LARGE_INTEGER lnFrequency;
+    QueryPerformanceFrequency(&lnFrequency);
+    m_n64QpcFreq = lnFrequency.QuadPart;
+    m_un64CounterMask = 0;
+}
+
+CDeviceTimebase::~CDeviceTimebase(void)
+{
+}
+
+void CDeviceTimebase::vInit(UINT unSources, UINT64 un64TicksPerSec, UINT unCounterBits)
+{
+    sSOURCE sSource = sSOURCE();
+    sSource.m_un64TicksPerSec = (un64TicksPerSec > 0) ? un64TicksPerSec : defNS_PER_SEC;
+    m_asSources.assign(unSources, sSource);
+    m_un64CounterMask = (unCounterBits > 0 && unCounterBits < 64) ? ((1ULL << unCounterBits) - 1) : 0;
+}
+
+void CDeviceTimebase::vSetTicksPerSec(UINT unSource, UINT64 un64TicksPerSec)
+{
+    if (unSource < m_asSources.size() && un64TicksPerSec > 0)
+    {
+        m_asSources[unSource].m_un64TicksPerSec = un64TicksPerSec;
+    }
+}
+
+UINT64 CDeviceTimebase::un64GetHostTime(UINT unSource, UINT64 un64DevTicks)
+{
+    LARGE_INTEGER lnQpc;
+    QueryPerformanceCounter(&lnQpc);
+    return un64GetHostTime(unSource, un64DevTicks, lnQpc.QuadPart);
+}
+
+UINT64 CDeviceTimebase::un64GetHostTime(UINT unSource, UINT64 un64DevTicks, LONGLONG n64HostQpc)
+{
+    UINT64 un64HostNs = un64QpcToNs(n64HostQpc);
+    if (unSource >= m_asSources.size())
+    {
+        return un64HostNs;
+    }
+    sSOURCE& sSource = m_asSources[unSource];
+    if (!sSource.m_bStarted)
+    {
+        vStartSource(sSource, un64DevTicks, un64HostNs);
+        sSource.m_un64LastOut = un64HostNs;
+        return un64HostNs;
+    }
+
+    LONGLONG n64Host = (LONGLONG)(un64HostNs - sSource.m_un64HostOrigin);
+    LONGLONG n64Step = 0;
+    if (m_un64CounterMask == 0)
+    {
+        n64Step = (LONGLONG)(un64DevTicks - sSource.m_un64LastRaw);
+    }
+    else
+    {
+        //The host time since the last frame tells how often the counter wrapped
+        UINT64 un64Delta = (un64DevTicks - sSource.m_un64LastRaw) & m_un64CounterMask;
+        double dExpected = (double)(n64Host - sSource.m_n64LastHost) * (double)sSource.m_un64TicksPerSec / (double)defNS_PER_SEC;
+        double dRange = (double)m_un64CounterMask + 1.0;
+        LONGLONG n64Wraps = (LONGLONG)floor((dExpected - (double)un64Delta) / dRange + 0.5);
+        n64Step = (LONGLONG)un64Delta + n64Wraps * (LONGLONG)(m_un64CounterMask + 1);
+    }
+    sSource.m_un64LastRaw = un64DevTicks;
+    sSource.m_n64DevTicks += n64Step;
+    sSource.m_n64LastHost = n64Host;
+
+    LONGLONG n64DevNs = n64TicksToNs(sSource, sSource.m_n64DevTicks);
+    LONGLONG n64Delay = n64Host - n64DevNs;
+    LONGLONG n64Estimate = n64GetDelay(sSource, n64DevNs);
+    if (_abs64(n64Delay - n64Estimate) > defTIMEBASE_RESYNC_NS)
+    {
+        //Device clock was reset or jumped, map it again from this frame on
+        vStartSource(sSource, un64DevTicks, un64HostNs);
+        n64DevNs = 0;
+        n64Delay = 0;
+        n64Estimate = 0;
+    }
+    else if (n64DevNs - sSource.m_n64WindowStart >= defTIMEBASE_WINDOW_NS)
+    {
+        vCloseWindow(sSource, n64DevNs, n64Delay);
+        n64Estimate = n64GetDelay(sSource, n64DevNs);
+    }
+    else if (n64Delay < sSource.m_n64WindowMin)
+    {
+        sSource.m_n64WindowMin = n64Delay;
+        sSource.m_n64WindowMinDev = n64DevNs;
+    }
+
+    //A frame cannot have been received after it was read
+    if (n64Estimate > n64Delay)
+    {
+        n64Estimate = n64Delay;
+    }
+    UINT64 un64Result = (UINT64)((LONGLONG)sSource.m_un64HostOrigin + n64DevNs + n64Estimate);
+    if (un64Result < sSource.m_un64LastOut)
+    {
+        un64Result = sSource.m_un64LastOut;
+    }
+    sSource.m_un64LastOut = un64Result;
+    return un64Result;
+}
+
+BOOL CDeviceTimebase::bGetEstimate(UINT unSource, double& dOffsetNs, double& dDriftPpm) const
+{
+    if (unSource >= m_asSources.size() || !m_asSources[unSource].m_bStarted)
+    {
+        return FALSE;
+    }
+    const sSOURCE& sSource = m_asSources[unSource];
+    //Offset of host against device time, relative to the first frame of the source
+    dOffsetNs = (double)n64GetDelay(sSource, n64TicksToNs(sSource, sSource.m_n64DevTicks));
+    dDriftPpm = (sSource.m_unFitCount >= 2) ? -sSource.m_dDrift * 1000000.0 : 0.0;
+    return TRUE;
+}
+
+UINT64 CDeviceTimebase::un64QpcToNs(LONGLONG n64Qpc) const
+{
+    UINT64 un64Qpc = (UINT64)n64Qpc;
+    UINT64 un64Freq = (UINT64)m_n64QpcFreq;
+    return (un64Qpc / un64Freq) * defNS_PER_SEC + ((un64Qpc % un64Freq) * defNS_PER_SEC) / un64Freq;
+}
+
+UINT64 CDeviceTimebase::un64GetNow(void) const
+{
+    LARGE_INTEGER lnQpc;
+    QueryPerformanceCounter(&lnQpc);
+    return un64QpcToNs(lnQpc.QuadPart);
+}
+
+void CDeviceTimebase::vStartSource(sSOURCE& sSource, UINT64 un64Raw, UINT64 un64HostNs)
+{
+    UINT64 un64LastOut = sSource.m_un64LastOut;
+    UINT64 un64TicksPerSec = sSource.m_un64TicksPerSec;
+    sSource = sSOURCE();
+    sSource.m_bStarted = true;
+    sSource.m_un64TicksPerSec = un64TicksPerSec;
+    sSource.m_un64LastRaw = un64Raw;
+    sSource.m_un64HostOrigin = un64HostNs;
+    sSource.m_un64LastOut = un64LastOut;
+}
+
+void CDeviceTimebase::vCloseWindow(sSOURCE& sSource, LONGLONG n64DevNs, LONGLONG n64Delay)
+{
+    sSource.m_an64FitDev[sSource.m_unFitNext] = sSource.m_n64WindowMinDev;
+    sSource.m_an64FitDelay[sSource.m_unFitNext] = sSource.m_n64WindowMin;
+    sSource.m_unFitNext = (sSource.m_unFitNext + 1) % defTIMEBASE_FIT_POINTS;
+    if (sSource.m_unFitCount < defTIMEBASE_FIT_POINTS)
+    {
+        sSource.m_unFitCount++;
+    }
+
+    //Least squares line delay = offset + drift * device time, relative to the newest minimum
+    //so the sums stay small enough for double
+    LONGLONG n64RefDev = sSource.m_n64WindowMinDev;
+    LONGLONG n64RefDelay = sSource.m_n64WindowMin;
+    double dSumX = 0.0, dSumY = 0.0;
+    for (UINT i = 0; i < sSource.m_unFitCount; i++)
+    {
+        dSumX += (double)(sSource.m_an64FitDev[i] - n64RefDev);
+        dSumY += (double)(sSource.m_an64FitDelay[i] - n64RefDelay);
+    }
+    double dMeanX = dSumX / sSource.m_unFitCount;
+    double dMeanY = dSumY / sSource.m_unFitCount;
+    double dSxx = 0.0, dSxy = 0.0;
+    for (UINT i = 0; i < sSource.m_unFitCount; i++)
+    {
+        double dX = (double)(sSource.m_an64FitDev[i] - n64RefDev) - dMeanX;
+        double dY = (double)(sSource.m_an64FitDelay[i] - n64RefDelay) - dMeanY;
+        dSxx += dX * dX;
+        dSxy += dX * dY;
+    }
+    double dDrift = (dSxx > 0.0) ? (dSxy / dSxx) : 0.0;
+    if (dDrift > defTIMEBASE_MAX_DRIFT)
+    {
+        dDrift = defTIMEBASE_MAX_DRIFT;
+    }
+    else if (dDrift < -defTIMEBASE_MAX_DRIFT)
+    {
+        dDrift = -defTIMEBASE_MAX_DRIFT;
+    }
+    sSource.m_n64FitRef = n64RefDev;
+    sSource.m_dDrift = dDrift;
+    sSource.m_dOffset = (double)n64RefDelay + dMeanY - dDrift * dMeanX;
+
+    sSource.m_n64WindowStart = n64DevNs;
+    sSource.m_n64WindowMin = n64Delay;
+    sSource.m_n64WindowMinDev = n64DevNs;
+}
+
+LONGLONG CDeviceTimebase::n64GetDelay(const sSOURCE& sSource, LONGLONG n64DevNs) const
+{
+    if (sSource.m_unFitCount >= 2)
+    {
+        return (LONGLONG)(sSource.m_dOffset + sSource.m_dDrift * (double)(n64DevNs - sSource.m_n64FitRef));
+    }
+    if (sSource.m_unFitCount == 1 && sSource.m_an64FitDelay[0] < sSource.m_n64WindowMin)
+    {
+        return sSource.m_an64FitDelay[0];
+    }
+    return sSource.m_n64WindowMin;
+}
+
+LONGLONG CDeviceTimebase::n64TicksToNs(const sSOURCE& sSource, LONGLONG n64Ticks)
+{
+    LONGLONG n64Freq = (LONGLONG)sSource.m_un64TicksPerSec;
+    return (n64Ticks / n64Freq) * (LONGLONG)defNS_PER_SEC + ((n64Ticks % n64Freq) * (LONGLONG)defNS_PER_SEC) / n64Freq;
+}
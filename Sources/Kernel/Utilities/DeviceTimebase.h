@@ -0,0 +1,118 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      DeviceTimebase.h
+ * \brief     Definition of the CDeviceTimebase class.
+ *
+ * Definition of the CDeviceTimebase class.
+ */
+
+#pragma once
+
+#include <Windows.h>
+#include <vector>
+
+#define defTIMEBASE_WINDOW_NS       1000000000LL    // Length of one estimation window in device time
+#define defTIMEBASE_FIT_POINTS      8               // Window minima used for the offset and drift fit
+#define defTIMEBASE_RESYNC_NS       1000000000LL    // Mapping error after which a source starts over
+#define defTIMEBASE_MAX_DRIFT       0.001           // Largest drift accepted from the fit (1000 ppm)
+#define defTIMEBASE_NS_PER_TICK     100000          // Nanoseconds per STCANDATA / STLINDATA tick (0.1 ms)
+
+/**
+ * Maps raw device timestamps of one driver into the host clock.
+ *
+ * Every source (usually a channel) has its own device clock. For each frame
+ * the driver passes the raw device timestamp and the performance counter
+ * value at which the frame was read. The delay host - device is the clock
+ * offset plus the transfer latency, so its minimum per window is the best
+ * offset estimate of that window. A least squares fit over the last window
+ * minima gives offset and drift; before the first window is complete the
+ * running minimum is used.
+ *
+ * The result is the host time in nanoseconds on the performance counter
+ * timebase, so frames of different channels and devices can be compared
+ * directly. Keep it in nanoseconds as long as frames are compared and
+ * convert with n64ToTickCount only when the frame is written out. It never goes backwards within a source and is never later than
+ * the moment the frame was read. Device counters narrower than 64 bit are
+ * unwrapped with help of the host time between two frames.
+ *
+ * vInit must be called before the read thread starts, after that only one
+ * thread may feed a source.
+ */
+class CDeviceTimebase
+{
+public:
+    CDeviceTimebase(void);
+    ~CDeviceTimebase(void);
+
+    //Forgets all estimates and sets up unSources sources with the given device clock
+    void vInit(UINT unSources, UINT64 un64TicksPerSec, UINT unCounterBits);
+    //Device clock of one source, for devices whose channels have different timers
+    void vSetTicksPerSec(UINT unSource, UINT64 un64TicksPerSec);
+    //Host time in ns of a frame with device time un64DevTicks read at n64HostQpc
+    UINT64 un64GetHostTime(UINT unSource, UINT64 un64DevTicks, LONGLONG n64HostQpc);
+    //As above, the frame was read just now
+    UINT64 un64GetHostTime(UINT unSource, UINT64 un64DevTicks);
+    //Current offset (ns) and drift (ppm, device faster than host) of a source, FALSE if it has no frames yet
+    BOOL bGetEstimate(UINT unSource, double& dOffsetNs, double& dDriftPpm) const;
+
+    //Host time in ns of a performance counter value
+    UINT64 un64QpcToNs(LONGLONG n64Qpc) const;
+    //Host time in ns now
+    UINT64 un64GetNow(void) const;
+
+    //Converts host ns into the 0.1 ms ticks of STCANDATA::m_lTickCount
+    static LONGLONG n64ToTickCount(UINT64 un64HostNs)
+    {
+        return (LONGLONG)(un64HostNs / defTIMEBASE_NS_PER_TICK);
+    }
+
+private:
+    struct sSOURCE
+    {
+        bool m_bStarted;
+        UINT64 m_un64TicksPerSec;       // Device clock, kept when the source starts over
+        UINT64 m_un64LastRaw;           // Last raw device timestamp
+        LONGLONG m_n64DevTicks;         // Unwrapped device ticks since the origin
+        UINT64 m_un64HostOrigin;        // Host ns of the first frame
+        LONGLONG m_n64LastHost;         // Host ns of the last frame, from the origin
+        UINT64 m_un64LastOut;           // Last returned host time
+
+        LONGLONG m_n64WindowStart;      // Device ns at which the current window started
+        LONGLONG m_n64WindowMin;        // Smallest delay of the current window
+        LONGLONG m_n64WindowMinDev;     // Device ns of that delay
+
+        LONGLONG m_an64FitDev[defTIMEBASE_FIT_POINTS];
+        LONGLONG m_an64FitDelay[defTIMEBASE_FIT_POINTS];
+        UINT m_unFitCount;
+        UINT m_unFitNext;
+        LONGLONG m_n64FitRef;           // Device ns the fit is relative to
+        double m_dOffset;               // Delay at m_n64FitRef
+        double m_dDrift;                // Delay change per device ns
+    };
+
+    std::vector<sSOURCE> m_asSources;
+    UINT64 m_un64CounterMask;           // 0 for a 64 bit counter
+    LONGLONG m_n64QpcFreq;
+
+    void vStartSource(sSOURCE& sSource, UINT64 un64Raw, UINT64 un64HostNs);
+    void vCloseWindow(sSOURCE& sSource, LONGLONG n64DevNs, LONGLONG n64Delay);
+    LONGLONG n64GetDelay(const sSOURCE& sSource, LONGLONG n64DevNs) const;
+    static LONGLONG n64TicksToNs(const sSOURCE& sSource, LONGLONG n64Ticks);
+
+    CDeviceTimebase(const CDeviceTimebase&);
+    CDeviceTimebase& operator=(const CDeviceTimebase&);
+};
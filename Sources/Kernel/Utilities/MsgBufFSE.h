@@ -77,6 +77,22 @@ public:
      */
     HRESULT WriteIntoBuffer(const SMSGBUFFER* psMsgBuffer, __int64 nSlotId, int& nIndex);
 
+    /**
+     * Reads up to nMaxCount entries under one lock.
+     *
+     * @param[out] psMsgBuffers Target entries.
+     * @return Number of entries read.
+     */
+    int nReadMultiple(SMSGBUFFER* psMsgBuffers, int nMaxCount);
+
+    /**
+     * Writes nCount entries under one lock and signals the event once.
+     *
+     * @param[in] psMsgBuffers Source entries.
+     * @return Number of entries written, less than nCount if the buffer got full.
+     */
+    int nWriteMultiple(SMSGBUFFER* psMsgBuffers, int nCount);
+
     /**
      * Returns the number of unread entries in the queue.
      *
@@ -230,6 +246,45 @@ template <typename SMSGBUFFER> HRESULT CMsgBufFSE<SMSGBUFFER>::WriteIntoBuffer(
     return nResult;
 }
 
+template <typename SMSGBUFFER> int CMsgBufFSE<SMSGBUFFER>::nReadMultiple(
+    SMSGBUFFER* psMsgBuffers, int nMaxCount)
+{
+    EnterCriticalSection(&m_CritSectionForGB);
+
+    int nRead = min(nMaxCount, m_nMsgCount);
+    /* At most two copies, the entries may wrap at the end of the queue. */
+    int nFirst = min(nRead, SIZE_APP_BUFFER - m_nIndexRead);
+    memcpy(psMsgBuffers, &(m_asMsgBuffer[m_nIndexRead]), nFirst * m_nMsgSize);
+    memcpy(psMsgBuffers + nFirst, m_asMsgBuffer, (nRead - nFirst) * m_nMsgSize);
+    m_nIndexRead = (m_nIndexRead + nRead) % SIZE_APP_BUFFER;
+    m_nMsgCount -= nRead;
+
+    LeaveCriticalSection(&m_CritSectionForGB);
+
+    return nRead;
+}
+
+template <typename SMSGBUFFER> int CMsgBufFSE<SMSGBUFFER>::nWriteMultiple(
+    SMSGBUFFER* psMsgBuffers, int nCount)
+{
+    EnterCriticalSection(&m_CritSectionForGB);
+
+    int nWritten = min(nCount, SIZE_APP_BUFFER - m_nMsgCount);
+    int nFirst = min(nWritten, SIZE_APP_BUFFER - m_nIndexWrite);
+    memcpy(&(m_asMsgBuffer[m_nIndexWrite]), psMsgBuffers, nFirst * m_nMsgSize);
+    memcpy(m_asMsgBuffer, psMsgBuffers + nFirst, (nWritten - nFirst) * m_nMsgSize);
+    m_nIndexWrite = (m_nIndexWrite + nWritten) % SIZE_APP_BUFFER;
+    m_nMsgCount += nWritten;
+    if (nWritten > 0)
+    {
+        SetEvent(m_hNotifyingEvent);
+    }
+
+    LeaveCriticalSection(&m_CritSectionForGB);
+
+    return nWritten;
+}
+
 template <typename SMSGBUFFER> int CMsgBufFSE<SMSGBUFFER>::
 GetMsgCount(void) const
 {
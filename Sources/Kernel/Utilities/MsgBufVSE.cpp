@@ -63,14 +63,17 @@ CMsgBufVSE::CMsgBufVSE(void)
 {
     m_nBufferSize = MIN_BUFFER_SIZE;
     m_pbyMsgBuffer = new BYTE[MIN_BUFFER_SIZE];// allocate memory first
-    vClearMessageBuffer(); // Clear the message buffer
+    m_pfDropHandler = nullptr;
+    m_nMsgCount = 0;
     InitializeCriticalSection(&m_CritSectionForGB);
+    vClearMessageBuffer(); // Clear the message buffer
     m_hNotifyingEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
 }
 
 //Destructor deallocates memory
 CMsgBufVSE::~CMsgBufVSE(void)
 {
+    vClearMessageBuffer(); // Gives the entries to the drop handler
     CloseHandle(m_hNotifyingEvent);
     m_hNotifyingEvent = nullptr;
     if (m_pbyMsgBuffer != nullptr)
@@ -85,6 +88,7 @@ Function Name   :   vClearMessageBuffer()
 Input           :
 Output          :
 Functionality   :   Clears msg buffer and initializes all variables.
+                    The entries left are given to the drop handler.
 Member of       :   CMsgBufVSE
 Friend of       :   -
 Authors         :   Pradeep Kadoor
@@ -93,11 +97,27 @@ Modifications   :   -
 ************************************************************************************/
 void CMsgBufVSE::vClearMessageBuffer(void)
 {
+    EnterCriticalSection(&m_CritSectionForGB);
+    if (nullptr != m_pfDropHandler)
+    {
+        while (m_nMsgCount > 0)
+        {
+            nAdvanceReadIndex();
+        }
+    }
     memset(m_pbyMsgBuffer, 0, m_nBufferSize);
     m_nIndexRead = 0;
     m_nIndexWrite = 0;
     m_nMsgCount = 0;
     m_nMsgSkipped = 0;
+    LeaveCriticalSection(&m_CritSectionForGB);
+}
+
+void CMsgBufVSE::vSetDropHandler(PFMSGBUF_DROP_HANDLER pfDropHandler)
+{
+    EnterCriticalSection(&m_CritSectionForGB);
+    m_pfDropHandler = pfDropHandler;
+    LeaveCriticalSection(&m_CritSectionForGB);
 }
 
 /**********************************************************************************
@@ -191,6 +211,11 @@ int CMsgBufVSE::GetBufferLength(void) const
     return m_nBufferSize;
 }
 
+int CMsgBufVSE::GetSkippedMsgCount(void) const
+{
+    return m_nMsgSkipped;
+}
+
 /**********************************************************************************
 Function Name   :   nSetBufferSize()
 Output          :   CALL_SUCCESS for success.
@@ -224,6 +249,7 @@ int CMsgBufVSE::nSetBufferSize(int& nSize)
 
     if (m_pbyMsgBuffer != nullptr)
     {
+        vClearMessageBuffer(); // Gives the entries to the drop handler
         delete[] m_pbyMsgBuffer;
     }
     m_nBufferSize = nSize;
@@ -258,6 +284,7 @@ Modifications   :   -
 HRESULT CMsgBufVSE::AdvanceToNextMsg()
 {
     HRESULT Result = CALL_SUCCESS;
+    EnterCriticalSection(&m_CritSectionForGB);
     if (m_nMsgCount == 0)
     {
         Result = EMPTY_APP_BUFFER;
@@ -267,13 +294,15 @@ HRESULT CMsgBufVSE::AdvanceToNextMsg()
         nAdvanceReadIndex();//Helper function to advance the read index
         //to the next msg.
     }
+    LeaveCriticalSection(&m_CritSectionForGB);
     return Result;
 }
 /**********************************************************************************
 Function Name   :   nAdvanceReadIndex()
 Output          :   CALL_SUCCESS for success. CALL_FAILURE for failure.
                     if allocated memory by the caller is not enough.
-Functionality   :   Helper function. Current msg is skipped.
+Functionality   :   Helper function. Current msg is skipped and
+                    given to the drop handler.
 Member of       :   CMsgBufVSE
 Friend of       :   -
 Authors         :   Pradeep Kadoor
@@ -283,6 +312,19 @@ Modifications   :   -
 int CMsgBufVSE::nAdvanceReadIndex(void)
 {
     int nResult = CALL_SUCCESS;
+    if (nullptr != m_pfDropHandler)
+    {
+        BYTE abyEntry[defMSGBUF_DROP_ENTRY_LEN];
+        INT nType = 0;
+        INT nSize = sizeof(abyEntry);
+        if (ReadBuffer(nType, abyEntry, nSize) == CALL_SUCCESS)
+        {
+            m_pfDropHandler(nType, abyEntry, nSize);
+            m_nMsgSkipped++;
+            m_nMsgCount--;
+            return nResult;
+        }
+    }
     static BYTE abyHeader[HEADER_LEN] = {0};
     nGetCurrMsgHeader(abyHeader); // Get current msg header TYPE, MSG LENGTH
 
@@ -26,6 +26,11 @@
 
 #include "BaseMsgBufAll.h"
 
+/* Called for every entry the buffer drops on overrun or clear */
+typedef void (*PFMSGBUF_DROP_HANDLER)(INT nType, BYTE* pbyMsg, INT nSize);
+
+#define defMSGBUF_DROP_ENTRY_LEN    64  //Longest entry given to the drop handler
+
 /////////////////////////////////////////////////////////////////////////////////////
 /**********************************************************************************
 Class Name      :   CMsgBufVSE
@@ -39,6 +44,7 @@ private:
     CRITICAL_SECTION m_CritSectionForGB;
     int m_nBufferSize, m_nIndexRead, m_nIndexWrite, m_nMsgCount, m_nMsgSkipped;
     HANDLE m_hNotifyingEvent;
+    PFMSGBUF_DROP_HANDLER m_pfDropHandler;
     /* Helper function to advance the read index to next msg*/
     int nAdvanceReadIndex(void);
     /* Helper function to read current msg from the circular buffer*/
@@ -75,4 +81,7 @@ public:
     HANDLE hGetNotifyingEvent(void) const;
     /* Gets no of skipped msgs because of buffer overrun */
     int GetSkippedMsgCount(void) const;
+    /* Sets the handler of the entries dropped on overrun or clear, for
+    entries that hold references. Entries are up to defMSGBUF_DROP_ENTRY_LEN */
+    void vSetDropHandler(PFMSGBUF_DROP_HANDLER pfDropHandler);
 };
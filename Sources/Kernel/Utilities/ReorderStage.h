@@ -0,0 +1,364 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      ReorderStage.h
+ * \brief     Definition of the CReorderStage template class.
+ *
+ * Definition of the CReorderStage template class.
+ */
+
+#pragma once
+
+#include <Windows.h>
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+#define defREORDER_HOLD_MS          10      // Default of the longest time a frame is held back
+#define defREORDER_NS_PER_TICK      100000  // Nanoseconds per m_lTickCount tick (0.1 ms)
+
+/**
+ * Counters of a reorder stage.
+ */
+struct SREORDER_STATS
+{
+    UINT64 m_un64Frames;            // Frames released
+    UINT64 m_un64Reordered;         // Frames released ahead of a frame that arrived earlier
+    UINT64 m_un64Late;              // Frames older than a frame already released
+    UINT64 m_un64MaxLateness;       // Largest lateness in ns
+    UINT64 m_un64HoldExpired;       // Frames released because the hold time ran out
+    UINT64 m_un64IdleChannels;      // Times a silent channel was left out of the merge
+    UINT m_unDepth;                 // Frames held right now
+    UINT m_unMaxDepth;              // Most frames held at once
+    UINT m_unHoldTimeMs;            // Current maximum hold time
+    UINT m_unActiveChannels;        // Channels the merge waits for right now
+};
+
+/**
+ * Merges the receive streams of several channels into one stream ordered
+ * by time. A driver that maps the device timestamps into host time passes
+ * the host time in nanoseconds, so frames less than a tick apart keep
+ * their order; otherwise m_lTickCount is used.
+ *
+ * Every channel has its own queue, which is in timestamp order as it comes
+ * from one device clock. A heap of the queue heads gives the oldest frame.
+ * It is released as soon as every channel that has sent before has a frame
+ * queued, because nothing older can arrive then, or when the oldest held
+ * frame has waited the hold time. A frame older than one already released
+ * can no longer be put in order; it goes out next and is counted as late.
+ * A channel that has sent nothing for the hold time is idle and is left
+ * out of the merge until its next frame, so the other channels don't wait
+ * the hold time for every frame.
+ *
+ * Released frames go to a CClientDispatch (or any type with vAddFrame,
+ * bIsFull and vFlush). Only the read thread may add and release frames;
+ * vSetHoldTime and vGetStats may be called from any thread.
+ */
+template <typename SDATA>
+class CReorderStage
+{
+public:
+    CReorderStage(void)
+    {
+        LARGE_INTEGER lnFrequency;
+        QueryPerformanceFrequency(&lnFrequency);
+        m_n64QpcFreq = lnFrequency.QuadPart;
+        m_unHoldTimeMs = defREORDER_HOLD_MS;
+        m_unActiveHoldMs = defREORDER_HOLD_MS;
+        InitializeCriticalSection(&m_omCritSec);
+        vInit(1);
+    }
+
+    ~CReorderStage(void)
+    {
+        DeleteCriticalSection(&m_omCritSec);
+    }
+
+    //Drops the held frames and the counters and sets up unChannels input queues
+    void vInit(UINT unChannels)
+    {
+        m_aouQueues.assign((unChannels > 0) ? unChannels : 1, CEntryQueue());
+        m_abKnown.assign(m_aouQueues.size(), false);
+        m_an64LastArrival.assign(m_aouQueues.size(), 0);
+        m_asHeads.clear();
+        m_unKnown = 0;
+        m_unFilled = 0;
+        m_un64NextSeq = 0;
+        m_n64LastOut = 0;
+        m_bReleased = false;
+        SREORDER_STATS sEmpty = {0};
+        m_sStats = sEmpty;
+        EnterCriticalSection(&m_omCritSec);
+        m_sStats.m_unHoldTimeMs = m_unHoldTimeMs;
+        m_sPublished = m_sStats;
+        LeaveCriticalSection(&m_omCritSec);
+    }
+
+    //0 passes every frame on at the next release
+    void vSetHoldTime(UINT unHoldTimeMs)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        m_unHoldTimeMs = unHoldTimeMs;
+        m_sPublished.m_unHoldTimeMs = unHoldTimeMs;
+        LeaveCriticalSection(&m_omCritSec);
+    }
+
+    void vGetStats(SREORDER_STATS& sStats)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        sStats = m_sPublished;
+        LeaveCriticalSection(&m_omCritSec);
+    }
+
+    //Queues a frame of unChannel (0 based), dwSenderID is 0 if no client sent it
+    void vAddFrame(UINT unChannel, const SDATA& sData, DWORD dwSenderID)
+    {
+        vAddFrame(unChannel, sData, dwSenderID, (UINT64)sData.m_lTickCount.QuadPart * defREORDER_NS_PER_TICK);
+    }
+
+    //As above, the frame is merged by un64TimeNs instead of m_lTickCount
+    void vAddFrame(UINT unChannel, const SDATA& sData, DWORD dwSenderID, UINT64 un64TimeNs)
+    {
+        if (unChannel >= m_aouQueues.size())
+        {
+            unChannel = (UINT)m_aouQueues.size() - 1;
+        }
+        LARGE_INTEGER lnNow;
+        QueryPerformanceCounter(&lnNow);
+
+        CEntryQueue& ouQueue = m_aouQueues[unChannel];
+        sENTRY sEntry;
+        sEntry.m_sData = sData;
+        sEntry.m_dwSenderID = dwSenderID;
+        sEntry.m_n64Time = (LONGLONG)un64TimeNs;
+        sEntry.m_n64Arrival = lnNow.QuadPart;
+        sEntry.m_un64Seq = m_un64NextSeq++;
+        ouQueue.push_back(sEntry);
+        m_an64LastArrival[unChannel] = lnNow.QuadPart;
+        if (ouQueue.size() == 1)
+        {
+            vPushHead(unChannel);
+            m_unFilled++;
+        }
+        if (!m_abKnown[unChannel])
+        {
+            m_abKnown[unChannel] = true;
+            m_unKnown++;
+        }
+        if (++m_sStats.m_unDepth > m_sStats.m_unMaxDepth)
+        {
+            m_sStats.m_unMaxDepth = m_sStats.m_unDepth;
+        }
+    }
+
+    //Hands all frames that are due to ouDispatch, bAll releases everything held
+    template <typename TDISPATCH, typename SCLIENT>
+    void vRelease(TDISPATCH& ouDispatch, SCLIENT* psClients, UINT unClientCount, bool bAll = false)
+    {
+        EnterCriticalSection(&m_omCritSec);
+        m_unActiveHoldMs = m_unHoldTimeMs;
+        LeaveCriticalSection(&m_omCritSec);
+        LONGLONG n64Hold = ((LONGLONG)m_unActiveHoldMs * m_n64QpcFreq) / 1000;
+        LARGE_INTEGER lnNow;
+        QueryPerformanceCounter(&lnNow);
+        vDropIdleChannels(lnNow.QuadPart, n64Hold);
+
+        while (!m_asHeads.empty())
+        {
+            //The front of each queue is its earliest arrival
+            UINT64 un64OldestSeq = _UI64_MAX;
+            LONGLONG n64OldestArrival = lnNow.QuadPart;
+            for (size_t i = 0; i < m_aouQueues.size(); i++)
+            {
+                if (!m_aouQueues[i].empty() && m_aouQueues[i].front().m_un64Seq < un64OldestSeq)
+                {
+                    un64OldestSeq = m_aouQueues[i].front().m_un64Seq;
+                    n64OldestArrival = m_aouQueues[i].front().m_n64Arrival;
+                }
+            }
+            bool bExpired = false;
+            if (!bAll && (m_unFilled < m_unKnown))
+            {
+                if (lnNow.QuadPart - n64OldestArrival < n64Hold)
+                {
+                    break;
+                }
+                bExpired = true;
+            }
+
+            std::pop_heap(m_asHeads.begin(), m_asHeads.end(), bIsLater);
+            UINT unChannel = m_asHeads.back().m_unChannel;
+            m_asHeads.pop_back();
+            CEntryQueue& ouQueue = m_aouQueues[unChannel];
+            const sENTRY& sEntry = ouQueue.front();
+
+            m_sStats.m_un64Frames++;
+            if (sEntry.m_un64Seq != un64OldestSeq)
+            {
+                m_sStats.m_un64Reordered++;
+            }
+            if (bExpired)
+            {
+                m_sStats.m_un64HoldExpired++;
+            }
+            LONGLONG n64Time = sEntry.m_n64Time;
+            if (m_bReleased && (n64Time < m_n64LastOut))
+            {
+                m_sStats.m_un64Late++;
+                if ((UINT64)(m_n64LastOut - n64Time) > m_sStats.m_un64MaxLateness)
+                {
+                    m_sStats.m_un64MaxLateness = (UINT64)(m_n64LastOut - n64Time);
+                }
+            }
+            else
+            {
+                m_n64LastOut = n64Time;
+                m_bReleased = true;
+            }
+
+            ouDispatch.vAddFrame(sEntry.m_sData, sEntry.m_dwSenderID);
+            if (ouDispatch.bIsFull())
+            {
+                ouDispatch.vFlush(psClients, unClientCount);
+            }
+            ouQueue.pop_front();
+            m_sStats.m_unDepth--;
+            if (ouQueue.empty())
+            {
+                m_unFilled--;
+            }
+            else
+            {
+                vPushHead(unChannel);
+            }
+        }
+
+        EnterCriticalSection(&m_omCritSec);
+        UINT unHoldTimeMs = m_sPublished.m_unHoldTimeMs;
+        m_sPublished = m_sStats;
+        m_sPublished.m_unHoldTimeMs = unHoldTimeMs;
+        m_sPublished.m_unActiveChannels = m_unKnown;
+        LeaveCriticalSection(&m_omCritSec);
+    }
+
+    //Milliseconds until the oldest held frame is due or a silent channel
+    //turns idle, INFINITE if none is held
+    DWORD dwGetWaitTime(void)
+    {
+        if (m_asHeads.empty())
+        {
+            return INFINITE;
+        }
+        LONGLONG n64Oldest = 0;
+        bool bFound = false;
+        for (size_t i = 0; i < m_aouQueues.size(); i++)
+        {
+            if (!m_aouQueues[i].empty() && (!bFound || m_aouQueues[i].front().m_n64Arrival < n64Oldest))
+            {
+                n64Oldest = m_aouQueues[i].front().m_n64Arrival;
+                bFound = true;
+            }
+            else if (m_abKnown[i] && m_aouQueues[i].empty() && (!bFound || m_an64LastArrival[i] < n64Oldest))
+            {
+                n64Oldest = m_an64LastArrival[i];
+                bFound = true;
+            }
+        }
+        LARGE_INTEGER lnNow;
+        QueryPerformanceCounter(&lnNow);
+        LONGLONG n64WaitedMs = ((lnNow.QuadPart - n64Oldest) * 1000) / m_n64QpcFreq;
+        return (n64WaitedMs >= (LONGLONG)m_unActiveHoldMs) ? 0 : (DWORD)(m_unActiveHoldMs - n64WaitedMs);
+    }
+
+private:
+    struct sENTRY
+    {
+        SDATA m_sData;
+        DWORD m_dwSenderID;
+        LONGLONG m_n64Time;         // Merge key in ns
+        LONGLONG m_n64Arrival;      // Performance counter when the frame was queued
+        UINT64 m_un64Seq;           // Arrival order over all channels
+    };
+    typedef std::deque<sENTRY> CEntryQueue;
+
+    //Head of a non-empty channel queue
+    struct sHEAD
+    {
+        LONGLONG m_n64Time;
+        UINT64 m_un64Seq;
+        UINT m_unChannel;
+    };
+
+    //Heap order: the earliest timestamp on top, arrival order between equal ones
+    static bool bIsLater(const sHEAD& sFirst, const sHEAD& sSecond)
+    {
+        if (sFirst.m_n64Time != sSecond.m_n64Time)
+        {
+            return sFirst.m_n64Time > sSecond.m_n64Time;
+        }
+        return sFirst.m_un64Seq > sSecond.m_un64Seq;
+    }
+
+    //Leaves the channels out that have nothing queued and sent nothing for
+    //the hold time, vAddFrame takes them back on their next frame
+    void vDropIdleChannels(LONGLONG n64Now, LONGLONG n64Hold)
+    {
+        if (m_unFilled == m_unKnown)
+        {
+            return;
+        }
+        for (size_t i = 0; i < m_aouQueues.size(); i++)
+        {
+            if (m_abKnown[i] && m_aouQueues[i].empty() && (n64Now - m_an64LastArrival[i] >= n64Hold))
+            {
+                m_abKnown[i] = false;
+                m_unKnown--;
+                m_sStats.m_un64IdleChannels++;
+            }
+        }
+    }
+
+    void vPushHead(UINT unChannel)
+    {
+        const sENTRY& sFront = m_aouQueues[unChannel].front();
+        sHEAD sHead;
+        sHead.m_n64Time = sFront.m_n64Time;
+        sHead.m_un64Seq = sFront.m_un64Seq;
+        sHead.m_unChannel = unChannel;
+        m_asHeads.push_back(sHead);
+        std::push_heap(m_asHeads.begin(), m_asHeads.end(), bIsLater);
+    }
+
+    std::vector<CEntryQueue> m_aouQueues;
+    std::vector<bool> m_abKnown;        // Channels that have sent and are not idle
+    std::vector<LONGLONG> m_an64LastArrival;    // Performance counter of the last frame per channel
+    std::vector<sHEAD> m_asHeads;
+    UINT m_unKnown;
+    UINT m_unFilled;                    // Channels with a frame queued
+    UINT64 m_un64NextSeq;
+    LONGLONG m_n64LastOut;              // Merge key of the last frame released in order
+    bool m_bReleased;
+    LONGLONG m_n64QpcFreq;
+    UINT m_unHoldTimeMs;
+    UINT m_unActiveHoldMs;              // Hold time of the last release, read thread copy
+
+    CRITICAL_SECTION m_omCritSec;       // Guards m_unHoldTimeMs and m_sPublished
+    SREORDER_STATS m_sStats;            // Read thread copy
+    SREORDER_STATS m_sPublished;        // Copy for vGetStats, updated on every release
+
+    CReorderStage(const CReorderStage&);
+    CReorderStage& operator=(const CReorderStage&);
+};
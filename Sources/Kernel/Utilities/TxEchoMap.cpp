@@ -0,0 +1,100 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      TxEchoMap.cpp
+ * \brief     Source file for CTxEchoMap class.
+ *
+ * Source file for CTxEchoMap class.
+ */
+
+#include "TxEchoMap.h"
+
+CTxEchoMap::CTxEchoMap(void)
+{
+    InitializeCriticalSection(&m_omCritSec);
+    m_unCount = 0;
+}
+
+CTxEchoMap::~CTxEchoMap(void)
+{
+    DeleteCriticalSection(&m_omCritSec);
+}
+
+void CTxEchoMap::vAddEntry(UINT unChannel, UINT unMsgID, DWORD dwClientID)
+{
+    EnterCriticalSection(&m_omCritSec);
+    //The FIFO of an ID is kept when it runs empty, the deque frees its
+    //blocks as echoes are taken, so a long busy session does not grow it
+    m_omFifos[un64GetKey(unChannel, unMsgID)].push_back(dwClientID);
+    m_unCount++;
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+BOOL CTxEchoMap::bRemoveEntry(UINT unChannel, UINT unMsgID, UINT& unClientID)
+{
+    BOOL bResult = FALSE;
+    EnterCriticalSection(&m_omCritSec);
+    if (m_unCount > 0)
+    {
+        CEchoFifos::iterator itrFifo = m_omFifos.find(un64GetKey(unChannel, unMsgID));
+        if (itrFifo != m_omFifos.end())
+        {
+            CEchoFifo& ouFifo = itrFifo->second;
+            if (!ouFifo.empty())
+            {
+                unClientID = ouFifo.front();
+                ouFifo.pop_front();
+                m_unCount--;
+                bResult = TRUE;
+            }
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+    return bResult;
+}
+
+BOOL CTxEchoMap::bPeekEntry(UINT unChannel, UINT unMsgID, UINT& unClientID)
+{
+    BOOL bResult = FALSE;
+    EnterCriticalSection(&m_omCritSec);
+    if (m_unCount > 0)
+    {
+        CEchoFifos::iterator itrFifo = m_omFifos.find(un64GetKey(unChannel, unMsgID));
+        if (itrFifo != m_omFifos.end() && !itrFifo->second.empty())
+        {
+            unClientID = itrFifo->second.front();
+            bResult = TRUE;
+        }
+    }
+    LeaveCriticalSection(&m_omCritSec);
+    return bResult;
+}
+
+void CTxEchoMap::vClear(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    m_omFifos.clear();
+    m_unCount = 0;
+    LeaveCriticalSection(&m_omCritSec);
+}
+
+UINT CTxEchoMap::unGetCount(void)
+{
+    EnterCriticalSection(&m_omCritSec);
+    UINT unCount = m_unCount;
+    LeaveCriticalSection(&m_omCritSec);
+    return unCount;
+}
@@ -0,0 +1,67 @@
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file      TxEchoMap.h
+ * \brief     Definition of the CTxEchoMap class.
+ *
+ * Definition of the CTxEchoMap class.
+ */
+
+#pragma once
+
+#include <Windows.h>
+#include <deque>
+#include <unordered_map>
+
+/**
+ * Remembers which client sent a frame until the driver reports it back as
+ * transmitted. Entries are kept per (channel, ID) in sending order, so the
+ * echo of a frame finds its client in constant time however many transmits
+ * are pending. The map is thread safe.
+ */
+class CTxEchoMap
+{
+public:
+    CTxEchoMap(void);
+    ~CTxEchoMap(void);
+
+    //Marks a frame sent by dwClientID
+    void vAddEntry(UINT unChannel, UINT unMsgID, DWORD dwClientID);
+    //Takes the oldest sender of (unChannel, unMsgID), FALSE if there is none
+    BOOL bRemoveEntry(UINT unChannel, UINT unMsgID, UINT& unClientID);
+    //Like bRemoveEntry, but the entry stays
+    BOOL bPeekEntry(UINT unChannel, UINT unMsgID, UINT& unClientID);
+    //Forgets all pending transmits, e.g. on disconnect
+    void vClear(void);
+    UINT unGetCount(void);
+
+private:
+    //Senders of one (channel, ID), the front is the oldest pending one
+    typedef std::deque<DWORD> CEchoFifo;
+    typedef std::unordered_map<UINT64, CEchoFifo> CEchoFifos;
+
+    CRITICAL_SECTION m_omCritSec;
+    CEchoFifos m_omFifos;
+    UINT m_unCount;
+
+    static UINT64 un64GetKey(UINT unChannel, UINT unMsgID)
+    {
+        return ((UINT64)unChannel << 32) | unMsgID;
+    }
+
+    CTxEchoMap(const CTxEchoMap&);
+    CTxEchoMap& operator=(const CTxEchoMap&);
+};
@@ -23,19 +23,6 @@ MSBuild "BUSMASTER\Language Dlls\Language Dlls.sln" /property:Configuration=Rele
 MSBuild "BUSMASTER\LDFEditor\LDFEditor.sln" /property:Configuration=Release /p:VisualStudioVersion=12.0 
 MSBuild "BUSMASTER\LDFViewer\LDFViewer.sln" /property:Configuration=Release /p:VisualStudioVersion=12.0
 
-REM Asc Log
-cd ..\Tools\flex 
-"flex.exe" -i -L -o"..\..\Sources\BUSMASTER\Format Converter\AscLogConverter\Asc_Log_Lexer.c" "..\..\Sources\BUSMASTER\Format Converter\AscLogConverter\Asc_Log_Lexer.l"
-cd ..\bison
-"bison.exe" -d -l -o"..\..\Sources\BUSMASTER\Format Converter\AscLogConverter\Asc_Log_Parser.c" "..\..\Sources\BUSMASTER\Format Converter\AscLogConverter\Asc_Log_Parser.y"
-
-REM Log Asc
-cd ..\flex 
-"flex.exe" -i -L -o"..\..\Sources\BUSMASTER\Format Converter\LogAscConverter\Log_Asc_Lexer.c" "..\..\Sources\BUSMASTER\Format Converter\LogAscConverter\Log_Asc_Lexer.l"
-cd ..\bison
-"bison.exe" -d -l -o"..\..\Sources\BUSMASTER\Format Converter\LogAscConverter\Log_Asc_Parser.c" "..\..\Sources\BUSMASTER\Format Converter\LogAscConverter\Log_Asc_Parser.y"
-
-cd ..\..\Sources
 MSBuild "BUSMASTER\Format Converter\FormatConverter.sln" /property:Configuration=Release /p:VisualStudioVersion=12.0 
 :END
 